@@ -2437,6 +2437,7 @@ void cmd_the_guide(byte init_search_type, int init_lineno, char* init_search_str
 	FILE *fff;
 #else
 	static int fseek_pseudo = 0; //fake a file position, within our buffered guide string array
+	int skip_to;
 #endif
 	int i, j;
 	char *res;
@@ -2455,6 +2456,11 @@ void cmd_the_guide(byte init_search_type, int init_lineno, char* init_search_str
 	int first_result = -1; //for QoL hack to drop from /? guide search to basic text search tier
 
 
+#ifdef BUFFER_GUIDE
+	/* Pick up a Guide that was updated meanwhile */
+	guide_check_update();
+#endif
+
 	/* empty file? */
 	if (guide_lastline == -1) {
 		if (guide_errno <= 0) {
@@ -2845,6 +2851,20 @@ void cmd_the_guide(byte init_search_type, int init_lineno, char* init_search_str
 			if (backwards) res = fgets_inverse(buf, MAX_CHARS + 1, fff);
 			else res = fgets(buf, MAX_CHARS + 1, fff);
 #else
+			/* While searching, skip straight to the next line that contains the search term at all.
+			   Stop at the line where a wrapped-around search ends, so that is still noticed. */
+			if (chapter[0] || (searchstr[0] && !marking
+ #ifdef REGEX_SEARCH
+			    && !search_regexp
+ #endif
+			    )) {
+				if (chapter[0]) skip_to = guide_find_line(chapter, fseek_pseudo, backwards ? -1 : guide_lastline + 1);
+				else if (backwards) skip_to = guide_find_line(searchstr, fseek_pseudo, searchwrap ? guide_lastline - line : -1);
+				else skip_to = guide_find_line(searchstr, fseek_pseudo, searchwrap ? line : guide_lastline + 1);
+				searchline += backwards ? fseek_pseudo - skip_to : skip_to - fseek_pseudo;
+				fseek_pseudo = skip_to;
+			}
+
 			if (backwards) {
 				if (fseek_pseudo < 0) {
 					fseek_pseudo = 0;
@@ -3371,27 +3391,16 @@ void cmd_the_guide(byte init_search_type, int init_lineno, char* init_search_str
 		/* normal manual operation (resumed) */
 		if (!c_override) {
 #ifdef BUFFER_GUIDE
-			/* Hack: Backtrack to find out in which chapter we currently are, and display it in the top line */
-			int lc;
-			char chapter_header[MAX_CHARS] = { 0 }, *lcc;
-
-			/* Search for chapter headers */
-			for (lc = line; lc >= guide_endofcontents; lc--) {
-				if (guide_line[lc][0] == '(' && guide_line[lc][1] >= '0' && guide_line[lc][1] <= '9') {
-					/* Major chapter */
-					if (guide_line[lc][2] == ')') { /* (x) */
-						strcpy(chapter_header, guide_line[lc]);
-						chapter_header[3] = 0;
-						break;
-					}
-					/* Minor chapter */
-					else if (guide_line[lc][2] == '.' && guide_line[lc][3] >= '0' && guide_line[lc][3] <= '9'
-					    && (lcc = strchr(guide_line[lc], ')')) <= guide_line[lc] + 8) { /* (x.y...), max (x.yzAbX) */
-						strcpy(chapter_header, guide_line[lc]);
-						*(chapter_header + (lcc - guide_line[lc]) + 1) = 0;
-						break;
-					}
-				}
+			/* Display in which chapter we currently are in the top line */
+			int lc = (line >= 0 && line <= guide_lastline) ? guide_line_chapter[line] : -1;
+			char chapter_header[MAX_CHARS] = { 0 };
+
+			/* Just the chapter number, up to the ')', a whole guide line might not fit */
+			if (lc != -1) {
+				cptr paren = strchr(guide_line[lc], ')');
+
+				strnfmt(chapter_header, sizeof(chapter_header), "%.*s",
+				    paren ? (int)(paren + 1 - guide_line[lc]) : (int)strlen(guide_line[lc]), guide_line[lc]);
 			}
 			/* Found one? */
 			if (chapter_header[0]) Term_putstr(14,  0, -1, TERM_L_BLUE, format("[The Guide - line %5d of %5d - chapter %s]", line + 1, guide_lastline + 1, chapter_header));
@@ -8039,6 +8048,42 @@ void cmd_message(void) {
 			c_msg_format("Client version: %d.%d.%d.%d.%d.%d%s, OS %d/%d.", VERSION_MAJOR, VERSION_MINOR, VERSION_PATCH, VERSION_EXTRA, VERSION_BRANCH, VERSION_BUILD, CLIENT_VERSION_TAG, VERSION_OS, VERSION_OS_SUB);
 			inkey_msg = FALSE;
 			return;
+#if defined(USE_X11) && defined(USE_GRAPHICS)
+		} else if (!strcasecmp(buf, "/gfxcache") || !strcasecmp(buf, "/gfxcache reset")) {
+			tile_cache_report(buf[9] != 0);
+			inkey_msg = FALSE;
+			return;
+#endif
+#if defined(USE_X11) && defined(X11_FRAMEBUFFER)
+		} else if (!strcasecmp(buf, "/frametime") || !strcasecmp(buf, "/frametime reset")) {
+			frametime_report(buf[10] != 0);
+			inkey_msg = FALSE;
+			return;
+		} else if (!strcasecmp(buf, "/frametime overlay")) {
+			x11_frametime = !x11_frametime;
+			c_msg_format("Frame time overlay is %s.", x11_frametime ? "on" : "off");
+			inkey_msg = FALSE;
+			return;
+#endif
+#ifdef CLIENT_LATENCY
+		} else if (!strcasecmp(buf, "/latency") || !strcasecmp(buf, "/latency reset")) {
+			latency_report(buf[8] != 0);
+			inkey_msg = FALSE;
+			return;
+		} else if (!strcasecmp(buf, "/latency overlay")) {
+			latency_overlay = !latency_overlay;
+ #if defined(USE_X11) && defined(X11_FRAMEBUFFER)
+			c_msg_format("Latency overlay is %s.", latency_overlay ? "on" : "off");
+ #else
+			c_msg_print("The latency overlay is only available in the X11 client.");
+ #endif
+			inkey_msg = FALSE;
+			return;
+		} else if (!strcasecmp(buf, "/latency dump") || !strncasecmp(buf, "/latency dump ", 14)) {
+			latency_dump(buf[13] && buf[14] ? buf + 14 : "tomenet-latency.txt");
+			inkey_msg = FALSE;
+			return;
+#endif
 		} else if (!strcasecmp(buf, "/apickup")) { //purely client-side, so Client_setup.options[] doesn't need to be changed
 			c_cfg.auto_pickup = !c_cfg.auto_pickup;
 			c_msg_format("Auto-pickup mode is %s.", c_cfg.auto_pickup ? "on" : "off");
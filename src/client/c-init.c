@@ -16,6 +16,8 @@
 /* For opendir */
 #include <sys/types.h>
 #include <dirent.h>
+/* For stat() of the guide */
+#include <sys/stat.h>
 
 /* For dirname */
 #include <libgen.h>
@@ -2949,12 +2951,130 @@ static void init_floor_mapping(void) {
 	my_fclose(fff);
 }
 
+#ifdef BUFFER_GUIDE
+/* Free the buffered guide, before reloading it */
+static void guide_free(void) {
+	free(guide_data);
+	free(guide_lower);
+	free(guide_line);
+	free(guide_line_chapter);
+	guide_data = guide_lower = NULL;
+	guide_line = NULL;
+	guide_line_chapter = NULL;
+}
+
+/*
+ * Read the whole guide into one buffer and index its lines in place, instead of
+ * reading it line by line. Also keeps a lower-case copy with the same layout
+ * for guide_find_line(). Returns the number of lines or -1 if out of memory.
+ */
+static int guide_load(FILE *fff, int *filesize) {
+	int lines = 0, size, i;
+	char *p, *eol;
+
+	fseek(fff, 0, SEEK_END);
+	size = ftell(fff);
+	fseek(fff, 0, SEEK_SET);
+	*filesize = size;
+
+	guide_data = malloc(size + 1);
+	guide_lower = malloc(size + 1);
+	if (!guide_data || !guide_lower) return(-1);
+
+	/* (Text mode may drop CRs, so the actual size can be smaller) */
+	size = fread(guide_data, 1, size, fff);
+	guide_data[size] = 0;
+
+	for (p = guide_data; *p; p++)
+		if (*p == '\n') lines++;
+	if (size && guide_data[size - 1] != '\n') lines++;
+
+	/* Each line gets terminated where its newline was, the extra pointer marks the end */
+	guide_line = malloc(sizeof(char*) * (lines + 1));
+	guide_line_chapter = malloc(sizeof(int) * (lines + 1));
+	if (!guide_line || !guide_line_chapter) return(-1);
+
+	for (i = 0, p = guide_data; i < lines; i++) {
+		guide_line[i] = p;
+		eol = strchr(p, '\n');
+		p = eol ? eol + 1 : guide_data + size;
+		if (eol) {
+			*eol = 0;
+			if (eol > guide_line[i] && eol[-1] == '\r') eol[-1] = 0;
+		}
+		/* Lines are displayed and searched through fixed-size buffers */
+		if (strlen(guide_line[i]) > MAX_CHARS) guide_line[i][MAX_CHARS] = 0;
+	}
+	guide_line[lines] = guide_data + size;
+
+	for (i = 0; i <= size; i++) guide_lower[i] = tolower((unsigned char)guide_data[i]);
+
+	return(lines);
+}
+
+/* Remember for each line which chapter heading "(x)" or "(x.y...)" it is under, for the guide's top line */
+static void guide_index_chapters(void) {
+	int lc, cur = -1;
+	char *l, *lcc;
+
+	for (lc = 0; lc <= guide_lastline; lc++) {
+		l = guide_line[lc];
+		if (lc >= guide_endofcontents && l[0] == '(' && l[1] >= '0' && l[1] <= '9') {
+			/* Major chapter (x) or minor chapter (x.y...), max (x.yzAbX) */
+			if (l[2] == ')') cur = lc;
+			else if (l[2] == '.' && l[3] >= '0' && l[3] <= '9' && (lcc = strchr(l, ')')) && lcc <= l + 8) cur = lc;
+		}
+		guide_line_chapter[lc] = cur;
+	}
+}
+
+/*
+ * Find the first line from 'from' towards 'to' (exclusive, either direction)
+ * that contains 'str', ignoring case, or return 'to' if there is none.
+ * Searches and chapter jumps use this to skip lines that can't match.
+ */
+int guide_find_line(cptr str, int from, int to) {
+	char needle[MAX_CHARS + 1];
+	int i, len, step = (to >= from ? 1 : -1);
+
+	/* Mirror my_strcasestr_skipcol(): a trailing '$$' only anchors the match at the end of a line */
+	for (len = 0; str[len] && len < MAX_CHARS; len++) {
+		if (str[len] == '\377') return(from);
+		needle[len] = tolower((unsigned char)str[len]);
+	}
+	needle[len] = 0;
+	if (len >= 4 && needle[len - 1] == '$' && needle[len - 2] == '$') needle[len - 2] = 0;
+	if (!needle[0] || guide_lastline == -1) return(from);
+
+	for (i = from; i != to; i += step) {
+		if (i < 0 || i > guide_lastline) return(to);
+		if (strstr(guide_lower + (guide_line[i] - guide_data), needle)) return(i);
+	}
+	return(to);
+}
+
+/* Reload the guide if the file changed since we read it, eg by =U or the TomeNET-Updater */
+void guide_check_update(void) {
+	char path[1024];
+	struct stat st;
+
+	path_build(path, 1024, "", "TomeNET-Guide.txt");
+	if (stat(path, &st)) return;
+	if (st.st_mtime == guide_mtime && (long)st.st_size == guide_size) return;
+	init_guide();
+}
+#endif
+
 /* Initialize info for the in-client guide search */
 void init_guide(void) {
-	int i, filesize, guide_lines_reserved = 1000, linelen, gl_mem;
+	int i;
+#ifdef BUFFER_GUIDE
+	int lines, lc, filesize;
+	struct stat st;
+#endif
 
 	FILE *fff;
-	char path[1024], buf[MAX_CHARS * 2 + 1], *c, *c2, **guide_line_tmp;
+	char path[1024], buf[MAX_CHARS * 2 + 1], *c, *c2;
 	byte contents = 0;
 
 	guide_lastline = -1;
@@ -2973,50 +3093,33 @@ void init_guide(void) {
 		return;
 	}
 
-	fseek(fff, 0, SEEK_END);
-	filesize = ftell(fff);
-	fseek(fff, 0, SEEK_SET);
-	guide_data = calloc(1, filesize + 1); //0-termination by strcpy()
-	if (!guide_data) {
-		c_msg_format("\377yCouldn't allocate the required %d bytes for the Guide.", filesize);
-		return;
+#ifdef BUFFER_GUIDE
+	guide_free();
+	if (!stat(path, &st)) {
+		guide_mtime = st.st_mtime;
+		guide_size = (long)st.st_size;
 	}
-	gl_mem = sizeof(char*) * guide_lines_reserved;
-	guide_line = malloc(gl_mem);
-	if (!guide_line) {
-		c_msg_format("\377yCouldn't allocate the required %d bytes for Guide line buffer.", gl_mem);
-		free(guide_data);
+	lines = guide_load(fff, &filesize);
+	if (lines == -1) {
+		c_msg_format("\377yCouldn't allocate the required memory for the %d bytes of the Guide.", filesize);
+		guide_free();
+		my_fclose(fff);
 		return;
 	}
+#endif
 
 	/* count lines */
+#ifdef BUFFER_GUIDE
+	for (lc = 0; lc < lines; lc++) {
+		strcpy(buf, guide_line[lc]);
+		guide_lastline++; //note: guide_lastline was initialized to -1, so it'll start at 0 here as it should
+#else
 	while (fgets(buf, 81 , fff)) {
 		guide_lastline++; //note: guide_lastline was initialized to -1, so it'll start at 0 here as it should
 
-#ifdef BUFFER_GUIDE
-		if (guide_lastline + 1 >= guide_lines_reserved) {
-			guide_lines_reserved += 1000;
-			gl_mem = sizeof(char*) * guide_lines_reserved;
-			guide_line_tmp = realloc(guide_line, gl_mem);
-			if (!guide_line_tmp) {
-				free(guide_data);
-				free(guide_line);
-				c_msg_format("\377yCouldn't allocate the required %d bytes for Guide line buffer.", gl_mem);
-				return;
-			}
-			guide_line = guide_line_tmp;
-		}
-		linelen = strlen(buf);
-		if (guide_lastline == 0) {
-			guide_line[0] = guide_data;
-			guide_line[1] = guide_data + linelen;
-		} else guide_line[guide_lastline + 1] = guide_line[guide_lastline] + linelen;
-		strcpy(guide_line[guide_lastline], buf);
-		guide_line[guide_lastline][linelen - 1] = 0; //replace newline by string terminator
-#endif
-
 		/* and also remember chapter titles */
 		buf[strlen(buf) - 1] = 0; /* remove trailing newline */
+#endif
 		switch (contents) {
 		case 0: /* beginning of contents */
 			if (!strcmp(buf, "Contents")) contents = 1;
@@ -3064,6 +3167,9 @@ void init_guide(void) {
 			continue;
 		}
 	}
+#ifdef BUFFER_GUIDE
+	guide_index_chapters();
+#endif
 	my_fclose(fff);
 
 	/* empty file? */
@@ -12,6 +12,10 @@
 extern bool disable_tile_cache;
 #ifdef USE_X11
 extern int gfx_resize_type;
+extern int tile_cache_size;
+ #ifdef X11_FRAMEBUFFER
+extern bool x11_framebuffer;
+ #endif
 #endif
 
 char mangrc_filename[100] = "";
@@ -258,6 +262,16 @@ retry_mangrc:
 				if (colornum >= 0 && colornum < BASE_PALETTE_SIZE && c < 0x01000000) client_color_map[colornum] = c;
 			}
 
+#if defined(USE_X11) && defined(X11_FRAMEBUFFER)
+			if (!strncmp(buf, "x11Framebuffer", 14)) {
+				char *p;
+
+				p = strtok(buf, " \t\n");
+				p = strtok(NULL, "\t\n");
+				if (p) x11_framebuffer = (atoi(p) != 0);
+			}
+#endif
+
 #ifdef USE_GRAPHICS
 			/* graphics */
 			if (!strncmp(buf, "graphics", 8)) {
@@ -303,6 +317,16 @@ retry_mangrc:
 				p = strtok(NULL, "\t\n");
 				if (atoi(p) != 0) disable_tile_cache = TRUE;
 			}
+ #ifdef USE_X11
+			if (!strncmp(buf, "gfxCacheSize", 12)) { //TILE_CACHE_SIZE
+				char *p;
+
+				p = strtok(buf, " \t\n");
+				p = strtok(NULL, "\t\n");
+				/* Each entry holds one or two tile-sized pixmaps on the X server */
+				if (p && atoi(p) >= 16 && atoi(p) <= 16384) tile_cache_size = atoi(p);
+			}
+ #endif
 #endif
 #ifdef USE_SOUND
 			/* sound */
@@ -947,6 +971,9 @@ bool write_mangrc(bool creds_only, bool update_creds, bool audiopacks_only) {
 			fputs("#colormap_15\t\t#c79d55\n", config2);
 			fputs("\n", config2);
 
+#if defined(USE_X11) && defined(X11_FRAMEBUFFER)
+			fputs(format("x11Framebuffer\t\t%d\n", x11_framebuffer ? 1 : 0), config2);
+#endif
 			fputs(format("graphics\t\t%d\n", use_graphics_new), config2);
 #ifdef USE_GRAPHICS
 			/* On writing a default .tomenetrc, also default to 16x24sv tileset */
@@ -959,6 +986,7 @@ bool write_mangrc(bool creds_only, bool update_creds, bool audiopacks_only) {
 				fputs(format("graphic_tiles%d\t\t%d\n", i, graphic_subtiles[i] ? 1 : 0), config2);
 			fputs("disableGfxCache\t\t0\n", config2);
 #ifdef USE_X11
+			fputs(format("gfxCacheSize\t\t%d\n", tile_cache_size), config2);
 			fputs(format("graphic_resize_type\t%d\n", gfx_resize_type), config2);
 #endif
 #endif
@@ -383,8 +383,13 @@ extern rawpict_tile tiles_rawpict_org_sub[MAX_SUBFONTS][MAX_TILES_RAWPICT + 1];
 extern signed char tiles_rawpict_subtileset[MAX_TILES_RAWPICT + 1];
 #ifdef USE_X11
 extern void resize_term_gfx(int term_idx);
+extern void tile_cache_report(bool reset);
 #endif
 #endif
+#if defined(USE_X11) && defined(X11_FRAMEBUFFER)
+extern bool x11_frametime;
+extern void frametime_report(bool reset);
+#endif
 extern bool use_sound, use_sound_org;
 extern bool quiet_mode;
 extern bool noweather_mode;
@@ -648,6 +653,10 @@ extern void artifact_lore_aux(int aidx, int alidx, char paste_lines[18][MSG_LEN]
 extern void artifact_stats_aux(int aidx, int alidx, char paste_lines[18][MSG_LEN], bool to_chat);
 extern bool check_dir2(cptr s);
 extern void init_guide(void);
+#ifdef BUFFER_GUIDE
+extern int guide_find_line(cptr str, int from, int to);
+extern void guide_check_update(void);
+#endif
 extern void ask_for_graphics_generic(void);
 
 /* c-inven.c */
@@ -916,6 +925,16 @@ extern int Net_start(int sex, int race, int class);
 extern int Net_input(void);
 extern int Flush_queue(void);
 extern int next_frame(void);
+#ifdef CLIENT_LATENCY
+extern bool latency_overlay;
+extern u64b latency_now(void);
+extern void latency_key(void);
+extern void latency_fresh(term *t, u64b start, bool drew);
+extern void latency_present(u32b us);
+extern void latency_overlay_text(char *out);
+extern void latency_report(bool reset);
+extern void latency_dump(cptr fname);
+#endif
 
 extern int Send_file_check(int ind, unsigned short id, char *fname);
 extern int Send_file_init(int ind, unsigned short id, char *fname);
@@ -1320,6 +1339,10 @@ extern char guide_chapter[256][MAX_CHARS], guide_chapter_no[256][8];
 extern int guide_chapters, guide_endofcontents;
 #ifdef BUFFER_GUIDE
 extern char *guide_data, **guide_line;
+extern char *guide_lower;
+extern int *guide_line_chapter;
+extern time_t guide_mtime;
+extern long guide_size;
 #endif
 #ifdef BUFFER_LOCAL_FILE
 extern char *local_file_data, **local_file_line;
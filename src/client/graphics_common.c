@@ -153,3 +153,296 @@ double lanczosKernel(double x, int lanczos_a) {
         return 0.0;
     }
 }
+
+/*
+ * Fixed-point tileset resampling.
+ *
+ * Produces the same picture as the per-pixel xInterpolation*() functions of
+ * main-x11.c (source position = target position * size ratio, samples clamped
+ * to the tile they belong to), but all of that is separable: the source
+ * positions and weights of every target column and row are computed once per
+ * axis, then each target row is made from a few horizontally filtered source
+ * rows. Weights have RESAMPLE_BITS fractional bits, the vertical pass runs on
+ * 8 (SSE2) or 16 (AVX2) pixels at once and gives the same result as the
+ * scalar code, so the output doesn't depend on the CPU. Bands of tile rows
+ * are independent and get resized by up to RESAMPLE_MAX_THREADS threads.
+ */
+
+#include <pthread.h>
+#include <unistd.h>
+#ifdef __SSE2__
+ #include <emmintrin.h>
+#endif
+#ifdef __AVX2__
+ #include <immintrin.h>
+#endif
+
+/* Source rows kept horizontally filtered per thread, must exceed RESAMPLE_MAX_TAPS */
+#define RESAMPLE_ROW_CACHE (RESAMPLE_MAX_TAPS + 1)
+
+/* Number of threads for resize_tileset(), 0 = one per online CPU */
+int resize_threads = 0;
+
+int rgb_planes_alloc(rgb_planes *planes, int width, int height)
+{
+    int c;
+
+    planes->width = width;
+    planes->height = height;
+    for (c = 0; c < 3; c++) {
+        planes->plane[c] = malloc((size_t)width * height);
+        if (!planes->plane[c]) {
+            rgb_planes_free(planes);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void rgb_planes_free(rgb_planes *planes)
+{
+    int c;
+
+    for (c = 0; c < 3; c++) {
+        free(planes->plane[c]);
+        planes->plane[c] = NULL;
+    }
+}
+
+/*
+ * Compute source positions and weights along one axis of a tileset that
+ * has tiles of 'tile_src' pixels and is resized to tiles of 'tile_dst'.
+ */
+void resample_axis_init(resample_axis *axis, int src_size, int tile_src, int tile_dst, int type)
+{
+    int dst_size = tile_dst * src_size / tile_src;
+    float ratio = (float)src_size / (float)dst_size;
+    double w[RESAMPLE_MAX_TAPS], sum;
+    int i, k, pos, first, last, big, total;
+
+    axis->size = dst_size;
+    switch (type) {
+    case INTERPOLATION_LINEAR: axis->taps = 2; break;
+    case INTERPOLATION_LANCZOS: axis->taps = 2 * LANCZOS_A + 1; break;
+    default: axis->taps = 1;
+    }
+    axis->index = malloc(sizeof(int) * dst_size * axis->taps);
+    axis->weight = malloc(sizeof(unsigned short) * dst_size * axis->taps);
+
+    for (i = 0; i < dst_size; i++) {
+        float src = (float)i * ratio;
+        int *index = axis->index + i * axis->taps;
+
+        /* Samples are clamped to the tile the target pixel belongs to */
+        first = (i / tile_dst) * tile_src;
+        last = first + tile_src - 1;
+
+        switch (type) {
+        case INTERPOLATION_LINEAR:
+            index[0] = (int)floor(src);
+            index[1] = (int)ceil(src);
+            w[1] = src - index[0];
+            w[0] = 1.0 - w[1];
+            break;
+        case INTERPOLATION_LANCZOS:
+            pos = (int)round(src);
+            for (k = 0; k < axis->taps; k++) {
+                index[k] = pos - LANCZOS_A + k;
+                w[k] = lanczosKernel(src - index[k], LANCZOS_A);
+            }
+            break;
+        default:
+            index[0] = (int)round(src);
+            w[0] = 1.0;
+        }
+
+        /* Normalize to fixed point, the tap with most weight absorbs the rounding */
+        for (sum = 0.0, k = 0; k < axis->taps; k++) sum += w[k];
+        for (big = 0, total = 0, k = 0; k < axis->taps; k++) {
+            if (index[k] < first) index[k] = first;
+            if (index[k] > last) index[k] = last;
+            axis->weight[i * axis->taps + k] = (unsigned short)(w[k] / sum * (1 << RESAMPLE_BITS) + 0.5);
+            total += axis->weight[i * axis->taps + k];
+            if (w[k] > w[big]) big = k;
+        }
+        axis->weight[i * axis->taps + big] += (1 << RESAMPLE_BITS) - total;
+    }
+}
+
+void resample_axis_free(resample_axis *axis)
+{
+    free(axis->index);
+    free(axis->weight);
+    axis->index = NULL;
+    axis->weight = NULL;
+}
+
+/* Filter one source row of all three planes horizontally into 'out' (3 * ax->size values) */
+static void resample_horizontal(const rgb_planes *src, int sy, const resample_axis *ax, unsigned short *out)
+{
+    int c, x, k, sum;
+
+    for (c = 0; c < 3; c++) {
+        const unsigned char *in = src->plane[c] + (size_t)sy * src->width;
+        const int *index = ax->index;
+        const unsigned short *weight = ax->weight;
+
+        for (x = 0; x < ax->size; x++) {
+            for (sum = 0, k = 0; k < ax->taps; k++) sum += weight[k] * in[index[k]];
+            out[x] = sum;
+            index += ax->taps;
+            weight += ax->taps;
+        }
+        out += ax->size;
+    }
+}
+
+/*
+ * Blend the horizontally filtered rows into one target row. Every product is
+ * (row * (weight << VSHIFT)) >> 16, which is what _mm_mulhi_epu16() computes.
+ */
+#define RESAMPLE_VSHIFT (15 - RESAMPLE_BITS)
+#define RESAMPLE_FRAC (RESAMPLE_BITS - 1)
+static void resample_vertical(unsigned char *out, unsigned short **rows, const unsigned short *weight, int taps, int width)
+{
+    int x = 0, k;
+    unsigned int acc;
+
+#ifdef __AVX2__
+    __m256i w256[RESAMPLE_MAX_TAPS], bias256 = _mm256_set1_epi16(1 << (RESAMPLE_FRAC - 1));
+
+    for (k = 0; k < taps; k++) w256[k] = _mm256_set1_epi16(weight[k] << RESAMPLE_VSHIFT);
+    for (; x + 16 <= width; x += 16) {
+        __m256i sum = bias256;
+
+        for (k = 0; k < taps; k++)
+            sum = _mm256_add_epi16(sum, _mm256_mulhi_epu16(_mm256_loadu_si256((const __m256i *)(rows[k] + x)), w256[k]));
+        sum = _mm256_srli_epi16(sum, RESAMPLE_FRAC);
+        sum = _mm256_permute4x64_epi64(_mm256_packus_epi16(sum, sum), 0xD8);
+        _mm_storeu_si128((__m128i *)(out + x), _mm256_castsi256_si128(sum));
+    }
+#endif
+#ifdef __SSE2__
+    __m128i w128[RESAMPLE_MAX_TAPS], bias128 = _mm_set1_epi16(1 << (RESAMPLE_FRAC - 1));
+
+    for (k = 0; k < taps; k++) w128[k] = _mm_set1_epi16(weight[k] << RESAMPLE_VSHIFT);
+    for (; x + 8 <= width; x += 8) {
+        __m128i sum = bias128;
+
+        for (k = 0; k < taps; k++)
+            sum = _mm_add_epi16(sum, _mm_mulhi_epu16(_mm_loadu_si128((const __m128i *)(rows[k] + x)), w128[k]));
+        sum = _mm_srli_epi16(sum, RESAMPLE_FRAC);
+        _mm_storel_epi64((__m128i *)(out + x), _mm_packus_epi16(sum, sum));
+    }
+#endif
+    for (; x < width; x++) {
+        acc = 1 << (RESAMPLE_FRAC - 1);
+        for (k = 0; k < taps; k++) acc += ((unsigned int)rows[k][x] * (weight[k] << RESAMPLE_VSHIFT)) >> 16;
+        acc >>= RESAMPLE_FRAC;
+        out[x] = acc > 255 ? 255 : acc;
+    }
+}
+
+/* Resize target rows [y_from, y_to) of 'dst', which must already have the size given by the axes */
+void resample_rows(const rgb_planes *src, rgb_planes *dst, const resample_axis *ax, const resample_axis *ay, int y_from, int y_to)
+{
+    int w = ax->size, y, k, c, s, sy, oldest;
+    int cached[RESAMPLE_ROW_CACHE], used[RESAMPLE_ROW_CACHE], stamp = 0;
+    unsigned short *mid, *rows[3][RESAMPLE_MAX_TAPS];
+
+    mid = malloc(sizeof(unsigned short) * RESAMPLE_ROW_CACHE * 3 * w);
+    if (!mid) return;
+    for (s = 0; s < RESAMPLE_ROW_CACHE; s++) cached[s] = used[s] = -1;
+
+    for (y = y_from; y < y_to; y++) {
+        for (k = 0; k < ay->taps; k++) {
+            sy = ay->index[y * ay->taps + k];
+
+            /* Neighbouring target rows mostly share their source rows */
+            for (s = 0; s < RESAMPLE_ROW_CACHE; s++)
+                if (cached[s] == sy) break;
+            if (s == RESAMPLE_ROW_CACHE) {
+                for (oldest = 0, s = 1; s < RESAMPLE_ROW_CACHE; s++)
+                    if (used[s] < used[oldest]) oldest = s;
+                s = oldest;
+                resample_horizontal(src, sy, ax, mid + s * 3 * w);
+                cached[s] = sy;
+            }
+            used[s] = stamp++;
+
+            for (c = 0; c < 3; c++) rows[c][k] = mid + (s * 3 + c) * w;
+        }
+
+        for (c = 0; c < 3; c++)
+            resample_vertical(dst->plane[c] + (size_t)y * w, rows[c], ay->weight + y * ay->taps, ay->taps, w);
+    }
+
+    free(mid);
+}
+
+typedef struct {
+    const rgb_planes *src;
+    rgb_planes *dst;
+    const resample_axis *ax, *ay;
+    int y_from, y_to;
+} resample_job;
+
+static void *resample_worker(void *arg)
+{
+    resample_job *job = (resample_job *)arg;
+
+    resample_rows(job->src, job->dst, job->ax, job->ay, job->y_from, job->y_to);
+    return NULL;
+}
+
+/*
+ * Resize a tileset with tiles of tile_w * tile_h pixels to tiles of
+ * font_w * font_h pixels, allocating 'dst'. Returns -1 if out of memory.
+ */
+int resize_tileset(const rgb_planes *src, rgb_planes *dst, int tile_w, int tile_h, int font_w, int font_h, int type)
+{
+    resample_axis ax, ay;
+    resample_job job[RESAMPLE_MAX_THREADS];
+    pthread_t thread[RESAMPLE_MAX_THREADS];
+    bool started[RESAMPLE_MAX_THREADS];
+    int threads = resize_threads, tile_rows, band, i;
+
+    resample_axis_init(&ax, src->width, tile_w, font_w, type);
+    resample_axis_init(&ay, src->height, tile_h, font_h, type);
+    if (!ax.index || !ax.weight || !ay.index || !ay.weight || rgb_planes_alloc(dst, ax.size, ay.size)) {
+        resample_axis_free(&ax);
+        resample_axis_free(&ay);
+        return -1;
+    }
+
+    /* Split the tile rows into one band per thread */
+    if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads > RESAMPLE_MAX_THREADS) threads = RESAMPLE_MAX_THREADS;
+    tile_rows = (ay.size + font_h - 1) / font_h;
+    if (threads > tile_rows) threads = tile_rows;
+    if (threads < 1) threads = 1;
+    band = ((tile_rows + threads - 1) / threads) * font_h;
+
+    for (i = 0; i < threads; i++) {
+        job[i].src = src;
+        job[i].dst = dst;
+        job[i].ax = &ax;
+        job[i].ay = &ay;
+        job[i].y_from = MIN(i * band, ay.size);
+        job[i].y_to = MIN((i + 1) * band, ay.size);
+        started[i] = FALSE;
+    }
+
+    /* The first band is done by us, a band whose thread can't be started too */
+    for (i = 1; i < threads; i++)
+        started[i] = !pthread_create(&thread[i], NULL, resample_worker, &job[i]);
+    resample_worker(&job[0]);
+    for (i = 1; i < threads; i++) {
+        if (started[i]) pthread_join(thread[i], NULL);
+        else resample_worker(&job[i]);
+    }
+
+    resample_axis_free(&ax);
+    resample_axis_free(&ay);
+    return 0;
+}
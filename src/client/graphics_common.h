@@ -53,4 +53,32 @@ color_rgb pixelBilinearInterpolation(float fractionOfX, float fractionOfY, color
 
 double lanczosKernel(double x, int lanczos_a);
 
+/* Fixed-point resampling of whole tilesets on planar buffers, see resize_tileset() */
+#define RESAMPLE_BITS 7
+#define RESAMPLE_MAX_TAPS (2 * LANCZOS_A + 1)
+#define RESAMPLE_MAX_THREADS 8
+
+typedef struct {
+    int width;
+    int height;
+    unsigned char *plane[3]; /* red, green, blue; width * height bytes each */
+} rgb_planes;
+
+typedef struct {
+    int size;               /* resized pixels along this axis */
+    int taps;               /* source pixels contributing to each of them */
+    int *index;             /* size * taps source positions */
+    unsigned short *weight; /* size * taps weights, each group summing to (1 << RESAMPLE_BITS) */
+} resample_axis;
+
+extern int resize_threads;
+
+int rgb_planes_alloc(rgb_planes *planes, int width, int height);
+void rgb_planes_free(rgb_planes *planes);
+
+void resample_axis_init(resample_axis *axis, int src_size, int tile_src, int tile_dst, int type);
+void resample_axis_free(resample_axis *axis);
+void resample_rows(const rgb_planes *src, rgb_planes *dst, const resample_axis *ax, const resample_axis *ay, int y_from, int y_to);
+int resize_tileset(const rgb_planes *src, rgb_planes *dst, int tile_w, int tile_h, int font_w, int font_h, int type);
+
 #endif //SRC_GRAPHICS_COMMON_H
@@ -176,6 +176,16 @@ struct infowin {
 	uint		flag2:1;
 	uint		flag3:1;
 	uint		flag4:1;
+
+	Pixell		bg;
+
+#ifdef X11_FRAMEBUFFER
+	Pixmap		fb;		/* Off-screen copy of the window contents, or None */
+	s16b		fb_w, fb_h;
+	int		fb_bands;
+	s16b		*fb_x1, *fb_x2;	/* Dirty columns [x1, x2) of each band since the last present */
+	struct timeval	fb_start;	/* When the first change of the current frame was drawn */
+#endif
 };
 
 
@@ -301,6 +311,17 @@ static unsigned long create_pixel(Display *dpy, byte red, byte green, byte blue)
 	(Infowin = (I))
 
 
+/* Where drawing to an infowin has to go */
+#ifdef X11_FRAMEBUFFER
+ #define Infowin_drawable(I) \
+	((I)->fb ? (Drawable)(I)->fb : (Drawable)(I)->win)
+#else
+ #define Infowin_drawable(I) \
+	((Drawable)(I)->win)
+ #define Infowin_dirty(I, X, Y, W, H)
+#endif
+
+
 
 /* SHUT: x-infowin.h */
 
@@ -619,6 +640,7 @@ static errr Infowin_init_data(Window dad, int x, int y, int w, int h, unsigned i
 	Infowin->w = w;
 	Infowin->h = h;
 	Infowin->b = b;
+	Infowin->bg = bg_color;
 
 	/* Apply the above info */
 	Infowin->mask = 0L;
@@ -974,6 +996,154 @@ static errr Infowin_set_focus(void) {
 	return(0);
 }
 
+#ifdef X11_FRAMEBUFFER
+/* Height in pixels of the horizontal bands that changes are tracked in */
+#define FB_BAND_HGT 8
+/* Copying up to this many unchanged pixels along is cheaper than another XCopyArea request */
+#define FB_BLIT_SLACK 4096
+
+/* 'x11Framebuffer' in .tomenetrc; the frame time overlay is toggled by '/frametime overlay' */
+bool x11_framebuffer = TRUE, x11_frametime = FALSE;
+
+/* Copies between pixmap and window must not generate (No)Expose events */
+static GC fb_gc = (GC)NULL;
+
+/* Statistics for '/frametime' */
+static u32b fb_frames, fb_blits, fb_frame_max, fb_frame_last, fb_blits_last;
+static u64b fb_frame_total, fb_pixels;
+
+/*
+ * (Re)create the off-screen pixmap of an infowin after it was created or
+ * resized, keeping as much of the old contents as still fits.
+ */
+static void Infowin_fb_create(infowin *iwin) {
+	Pixmap fb;
+	int b;
+
+	if (!x11_framebuffer) return;
+
+	if (!fb_gc) {
+		XGCValues gcv;
+
+		gcv.graphics_exposures = False;
+		fb_gc = XCreateGC(Metadpy->dpy, iwin->win, GCGraphicsExposures, &gcv);
+	}
+
+	fb = XCreatePixmap(Metadpy->dpy, iwin->win, iwin->w, iwin->h, Metadpy->depth);
+	XSetForeground(Metadpy->dpy, fb_gc, iwin->bg);
+	XFillRectangle(Metadpy->dpy, fb, fb_gc, 0, 0, iwin->w, iwin->h);
+	if (iwin->fb) {
+		XCopyArea(Metadpy->dpy, iwin->fb, fb, fb_gc, 0, 0,
+		    MIN(iwin->fb_w, iwin->w), MIN(iwin->fb_h, iwin->h), 0, 0);
+		XFreePixmap(Metadpy->dpy, iwin->fb);
+		C_KILL(iwin->fb_x1, iwin->fb_bands, s16b);
+		C_KILL(iwin->fb_x2, iwin->fb_bands, s16b);
+	}
+
+	iwin->fb = fb;
+	iwin->fb_w = iwin->w;
+	iwin->fb_h = iwin->h;
+	iwin->fb_bands = (iwin->h + FB_BAND_HGT - 1) / FB_BAND_HGT;
+	C_MAKE(iwin->fb_x1, iwin->fb_bands, s16b);
+	C_MAKE(iwin->fb_x2, iwin->fb_bands, s16b);
+	for (b = 0; b < iwin->fb_bands; b++) iwin->fb_x1[b] = iwin->fb_w;
+	iwin->fb_start.tv_sec = 0;
+
+	/* The window itself is brought up to date by the Expose events of the resize */
+}
+
+/* Free the off-screen pixmap of an infowin */
+static void Infowin_fb_free(infowin *iwin) {
+	if (!iwin->fb) return;
+
+	XFreePixmap(Metadpy->dpy, iwin->fb);
+	iwin->fb = None;
+	C_KILL(iwin->fb_x1, iwin->fb_bands, s16b);
+	C_KILL(iwin->fb_x2, iwin->fb_bands, s16b);
+	iwin->fb_bands = 0;
+}
+
+/* Remember that a rectangle of the off-screen pixmap changed and has to be copied to the window */
+static void Infowin_dirty(infowin *iwin, int x, int y, int w, int h) {
+	int b, b2;
+
+	if (!iwin->fb) return;
+
+	if (x < 0) {
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		h += y;
+		y = 0;
+	}
+	if (x + w > iwin->fb_w) w = iwin->fb_w - x;
+	if (y + h > iwin->fb_h) h = iwin->fb_h - y;
+	if (w <= 0 || h <= 0) return;
+
+	if (!iwin->fb_start.tv_sec) gettimeofday(&iwin->fb_start, NULL);
+
+	b2 = (y + h - 1) / FB_BAND_HGT;
+	for (b = y / FB_BAND_HGT; b <= b2; b++) {
+		if (x < iwin->fb_x1[b]) iwin->fb_x1[b] = x;
+		if (x + w > iwin->fb_x2[b]) iwin->fb_x2[b] = x + w;
+	}
+}
+
+/*
+ * Copy everything that changed since the last call from the off-screen pixmap
+ * to the window. Adjacent dirty bands are merged into one rectangle as long as
+ * that doesn't drag too many unchanged pixels along, so a full map redraw
+ * usually costs a single request. Returns the number of requests sent.
+ */
+static int Infowin_present(infowin *iwin) {
+	int b, x1 = 0, x2 = 0, y1 = -1, area = 0, n = 0;
+	int u1, u2, a, y, h;
+	bool dirty;
+
+	for (b = 0; b <= iwin->fb_bands; b++) {
+		dirty = (b < iwin->fb_bands && iwin->fb_x1[b] < iwin->fb_x2[b]);
+
+		if (y1 != -1) {
+			/* Try to extend the pending rectangle by this band */
+			if (dirty) {
+				u1 = MIN(x1, iwin->fb_x1[b]);
+				u2 = MAX(x2, iwin->fb_x2[b]);
+				a = area + (iwin->fb_x2[b] - iwin->fb_x1[b]) * FB_BAND_HGT;
+				if ((u2 - u1) * (b - y1 + 1) * FB_BAND_HGT <= a + FB_BLIT_SLACK) {
+					x1 = u1;
+					x2 = u2;
+					area = a;
+					iwin->fb_x1[b] = iwin->fb_w;
+					iwin->fb_x2[b] = 0;
+					continue;
+				}
+			}
+
+			/* Send it */
+			y = y1 * FB_BAND_HGT;
+			h = MIN(b * FB_BAND_HGT, iwin->fb_h) - y;
+			XCopyArea(Metadpy->dpy, iwin->fb, iwin->win, fb_gc, x1, y, x2 - x1, h, x1, y);
+			fb_pixels += (x2 - x1) * h;
+			n++;
+			y1 = -1;
+		}
+
+		/* Start a new rectangle */
+		if (dirty) {
+			y1 = b;
+			x1 = iwin->fb_x1[b];
+			x2 = iwin->fb_x2[b];
+			area = (x2 - x1) * FB_BAND_HGT;
+			iwin->fb_x1[b] = iwin->fb_w;
+			iwin->fb_x2[b] = 0;
+		}
+	}
+
+	return(n);
+}
+#endif
+
 /*
  * Move an infowin.
  */
@@ -995,6 +1165,9 @@ static errr Infowin_resize(int w, int h) {
 	Infowin->w = w;
 	Infowin->h = h;
 	XResizeWindow(Metadpy->dpy, Infowin->win, w, h);
+#ifdef X11_FRAMEBUFFER
+	if (Infowin->fb) Infowin_fb_create(Infowin);
+#endif
 
 	/* Success */
 	return(0);
@@ -1004,6 +1177,15 @@ static errr Infowin_resize(int w, int h) {
  * Visually clear Infowin
  */
 static errr Infowin_wipe(void) {
+#ifdef X11_FRAMEBUFFER
+	if (Infowin->fb) {
+		XSetForeground(Metadpy->dpy, fb_gc, Infowin->bg);
+		XFillRectangle(Metadpy->dpy, Infowin->fb, fb_gc, 0, 0, Infowin->fb_w, Infowin->fb_h);
+		Infowin_dirty(Infowin, 0, 0, Infowin->fb_w, Infowin->fb_h);
+		return(0);
+	}
+#endif
+
 	/* Execute the request */
 	XClearWindow(Metadpy->dpy, Infowin->win);
 
@@ -1052,16 +1234,18 @@ static errr Infofnt_text_std(int x, int y, cptr str, int len) {
 		/* Do each character */
 		for (i = 0; i < len; ++i)
 			/* Note that the Infoclr is set up to contain the Infofnt */
-			XDrawImageString(Metadpy->dpy, Infowin->win, Infoclr->gc,
+			XDrawImageString(Metadpy->dpy, Infowin_drawable(Infowin), Infoclr->gc,
 			                 x + i * Infofnt->wid + Infofnt->off, y, str + i, 1);
 	}
 
 	/* Assume monospaced font */
 	else
 		/* Note that the Infoclr is set up to contain the Infofnt */
-		XDrawImageString(Metadpy->dpy, Infowin->win, Infoclr->gc,
+		XDrawImageString(Metadpy->dpy, Infowin_drawable(Infowin), Infoclr->gc,
 		                 x, y, str, len);
 
+	Infowin_dirty(Infowin, x, y - Infofnt->asc, len * Infofnt->wid, Infofnt->hgt);
+
 	/* Success */
 	return(0);
 }
@@ -1101,7 +1285,8 @@ static errr Infofnt_text_non(int x, int y, cptr str, int len) {
 	/*** Actually 'paint' the area ***/
 
 	/* Just do a Fill Rectangle */
-	XFillRectangle(Metadpy->dpy, Infowin->win, Infoclr->gc, x, y, w, h);
+	XFillRectangle(Metadpy->dpy, Infowin_drawable(Infowin), Infoclr->gc, x, y, w, h);
+	Infowin_dirty(Infowin, x, y, w, h);
 
 	/* Success */
 	return(0);
@@ -1186,6 +1371,8 @@ static term_data* term_idx_to_term_data(int term_idx);
                  However, it overflows instantly in just 1 sector of housing area around Bree, on admin who can see all objects.
     Size 256*3:  Cache manages to more or less capture a whole housing area sector fine. This seems a good minimum cache size.
     Size 256*4:  Default choice now, for reserves.
+   This is the default, 'gfxCacheSize' in .tomenetrc overrides it (tile_cache_size).
+   Entries are found via a hash of (c, a, c_back, a_back) and the least recently used one is replaced.
 */
 #define TILE_CACHE_SIZE (256*4)
 
@@ -1205,6 +1392,16 @@ static term_data* term_idx_to_term_data(int term_idx);
 #ifdef TILE_CACHE_SIZE
 extern bool disable_tile_cache;
 bool disable_tile_cache = FALSE;
+extern int tile_cache_size;
+int tile_cache_size = TILE_CACHE_SIZE;
+
+/* Attributes an entry is indexed by for invalidate_graphics_cache_x11(): a, and a_back */
+ #ifdef GRAPHICS_BG_MASK
+  #define TILE_CACHE_ATTRS 2
+ #else
+  #define TILE_CACHE_ATTRS 1
+ #endif
+
 struct tile_cache_entry {
     Pixmap tilePreparation;
     char32_t c;
@@ -1218,6 +1415,9 @@ struct tile_cache_entry {
  #ifdef TILE_CACHE_FGBG
     s32b fg, bg; /* Optional palette_animation handling */
  #endif
+    int hash_next; /* Next valid entry in the same hash bucket, -1 for none */
+    int lru_prev, lru_next; /* Towards the most/least recently used entry */
+    int attr_prev[TILE_CACHE_ATTRS], attr_next[TILE_CACHE_ATTRS]; /* Other valid entries of the same a (a_back) */
 };
 #endif
 #ifdef USE_GRAPHICS
@@ -1250,8 +1450,11 @@ struct term_data {
 	Pixmap tilePreparation;
 
  #ifdef TILE_CACHE_SIZE
-	int cache_position;
-	struct tile_cache_entry tile_cache[TILE_CACHE_SIZE];
+	struct tile_cache_entry *tile_cache; /* tile_cache_size entries */
+	int *tile_cache_hash, tile_cache_buckets; /* Heads of the hash chains; a power of 2 */
+	int tile_cache_mru, tile_cache_lru;
+	int tile_cache_attr[256][TILE_CACHE_ATTRS]; /* Heads of the per-attribute lists */
+	u32b tile_cache_hits, tile_cache_misses, tile_cache_evictions, tile_cache_invalidations;
  #endif
 
 	XImage *tiles_sub[MAX_SUBFONTS];
@@ -1767,6 +1970,14 @@ static errr CheckEvent(bool wait) {
 		/* An Expose Event */
 		case Expose:
 			/* Redraw (if allowed) */
+#ifdef X11_FRAMEBUFFER
+			/* Restore it from the off-screen copy */
+			if (iwin == td->inner && iwin->fb)
+				XCopyArea(Metadpy->dpy, iwin->fb, iwin->win, fb_gc,
+				    xev->xexpose.x, xev->xexpose.y, xev->xexpose.width, xev->xexpose.height,
+				    xev->xexpose.x, xev->xexpose.y);
+			else
+#endif
 			if (iwin == td->inner) {
 				/* Get the area that should be updated */
 				int x1 = xev->xexpose.x / td->fnt->wid;
@@ -1847,6 +2058,190 @@ static errr CheckEvent(bool wait) {
 }
 
 #ifdef USE_GRAPHICS
+ #ifdef TILE_CACHE_SIZE
+  #ifdef GRAPHICS_BG_MASK
+   #define TILE_CACHE_C_BACK(e) ((e)->c_back)
+   #define TILE_CACHE_A_BACK(e) ((e)->a_back)
+  #else
+   #define TILE_CACHE_C_BACK(e) 0
+   #define TILE_CACHE_A_BACK(e) 0
+  #endif
+
+static int tile_cache_bucket(term_data *td, char32_t c, byte a, char32_t c_back, byte a_back) {
+	u32b h = ((u32b)c * 0x9E3779B1U) ^ ((u32b)c_back * 0x85EBCA6BU) ^ ((u32b)a << 8 | a_back);
+
+	h ^= h >> 15;
+	h *= 0x2C1B3C6DU;
+	h ^= h >> 12;
+	return(h & (td->tile_cache_buckets - 1));
+}
+
+/* Make entry i the most recently used one */
+static void tile_cache_touch(term_data *td, int i) {
+	struct tile_cache_entry *e = &td->tile_cache[i];
+
+	if (td->tile_cache_mru == i) return;
+
+	td->tile_cache[e->lru_prev].lru_next = e->lru_next;
+	if (e->lru_next != -1) td->tile_cache[e->lru_next].lru_prev = e->lru_prev;
+	else td->tile_cache_lru = e->lru_prev;
+
+	e->lru_prev = -1;
+	e->lru_next = td->tile_cache_mru;
+	td->tile_cache[td->tile_cache_mru].lru_prev = i;
+	td->tile_cache_mru = i;
+}
+
+/* Make entry i the next one to be replaced */
+static void tile_cache_retire(term_data *td, int i) {
+	struct tile_cache_entry *e = &td->tile_cache[i];
+
+	if (td->tile_cache_lru == i) return;
+
+	td->tile_cache[e->lru_next].lru_prev = e->lru_prev;
+	if (e->lru_prev != -1) td->tile_cache[e->lru_prev].lru_next = e->lru_next;
+	else td->tile_cache_mru = e->lru_next;
+
+	e->lru_next = -1;
+	e->lru_prev = td->tile_cache_lru;
+	td->tile_cache[td->tile_cache_lru].lru_next = i;
+	td->tile_cache_lru = i;
+}
+
+/* Remove entry i from its hash chain and attribute lists, it stays in the LRU list */
+static void tile_cache_unlink(term_data *td, int i) {
+	struct tile_cache_entry *e = &td->tile_cache[i];
+	int *p, k, attr;
+
+	if (!e->is_valid) return;
+
+	for (p = &td->tile_cache_hash[tile_cache_bucket(td, e->c, e->a, TILE_CACHE_C_BACK(e), TILE_CACHE_A_BACK(e))]; *p != i; p = &td->tile_cache[*p].hash_next);
+	*p = e->hash_next;
+
+	for (k = 0; k < TILE_CACHE_ATTRS; k++) {
+		attr = k ? TILE_CACHE_A_BACK(e) : e->a;
+		if (e->attr_prev[k] != -1) td->tile_cache[e->attr_prev[k]].attr_next[k] = e->attr_next[k];
+		else td->tile_cache_attr[attr][k] = e->attr_next[k];
+		if (e->attr_next[k] != -1) td->tile_cache[e->attr_next[k]].attr_prev[k] = e->attr_prev[k];
+	}
+	e->is_valid = FALSE;
+}
+
+/* Forget all cached tiles, keeping their pixmaps */
+static void tile_cache_reset(term_data *td) {
+	int i, k;
+
+	for (i = 0; i < td->tile_cache_buckets; i++) td->tile_cache_hash[i] = -1;
+	for (i = 0; i < 256; i++)
+		for (k = 0; k < TILE_CACHE_ATTRS; k++) td->tile_cache_attr[i][k] = -1;
+	for (i = 0; i < tile_cache_size; i++) {
+		td->tile_cache[i].is_valid = FALSE;
+		td->tile_cache[i].lru_prev = i - 1;
+		td->tile_cache[i].lru_next = (i + 1 < tile_cache_size) ? i + 1 : -1;
+	}
+	td->tile_cache_mru = 0;
+	td->tile_cache_lru = tile_cache_size - 1;
+}
+
+/* Allocate the cache of a term; the caller creates the pixmaps */
+static void tile_cache_alloc(term_data *td) {
+	if (td->tile_cache) return;
+
+	for (td->tile_cache_buckets = 1; td->tile_cache_buckets < tile_cache_size; td->tile_cache_buckets <<= 1);
+	C_MAKE(td->tile_cache, tile_cache_size, struct tile_cache_entry);
+	C_MAKE(td->tile_cache_hash, td->tile_cache_buckets, int);
+	tile_cache_reset(td);
+}
+
+/* Get the index of the cached tile, or -1 */
+static int tile_cache_find(term_data *td, char32_t c, byte a, char32_t c_back, byte a_back) {
+	struct tile_cache_entry *e;
+	int i;
+
+	for (i = td->tile_cache_hash[tile_cache_bucket(td, c, a, c_back, a_back)]; i != -1; i = e->hash_next) {
+		e = &td->tile_cache[i];
+		if (e->c == c && e->a == a && TILE_CACHE_C_BACK(e) == c_back && TILE_CACHE_A_BACK(e) == a_back
+  #ifdef TILE_CACHE_FGBG /* Instead of this, invalidate_graphics_cache_...() will specifically invalidate affected entries */
+		    /* Extra: Verify that palette is identical - allows palette_animation to work w/o invalidating the whole cache each time: */
+		    && Infoclr->fg == e->fg && Infoclr->bg == e->bg
+  #endif
+		    ) {
+			tile_cache_touch(td, i);
+			td->tile_cache_hits++;
+			return(i);
+		}
+	}
+	td->tile_cache_misses++;
+	return(-1);
+}
+
+/* Get the least recently used entry for a new tile; the caller draws it into the entry's pixmap */
+static struct tile_cache_entry *tile_cache_take(term_data *td, char32_t c, byte a, char32_t c_back, byte a_back) {
+	int i = td->tile_cache_lru, b, k, attr;
+	struct tile_cache_entry *e = &td->tile_cache[i];
+
+  #ifdef TILE_CACHE_LOG
+	c_msg_format("Tile cache pos (%s): %d / %d", e->is_valid ? "LRU" : "hole", i, tile_cache_size);
+  #endif
+	if (e->is_valid) {
+		tile_cache_unlink(td, i);
+		td->tile_cache_evictions++;
+	}
+
+	e->c = c;
+	e->a = a;
+  #ifdef GRAPHICS_BG_MASK
+	e->c_back = c_back;
+	e->a_back = a_back;
+  #endif
+	e->is_valid = TRUE;
+  #ifdef TILE_CACHE_FGBG
+	e->fg = Infoclr->fg;
+	e->bg = Infoclr->bg;
+  #endif
+
+	b = tile_cache_bucket(td, c, a, c_back, a_back);
+	e->hash_next = td->tile_cache_hash[b];
+	td->tile_cache_hash[b] = i;
+
+	for (k = 0; k < TILE_CACHE_ATTRS; k++) {
+		attr = k ? a_back : a;
+		e->attr_prev[k] = -1;
+		e->attr_next[k] = td->tile_cache_attr[attr][k];
+		if (e->attr_next[k] != -1) td->tile_cache[e->attr_next[k]].attr_prev[k] = i;
+		td->tile_cache_attr[attr][k] = i;
+	}
+
+	tile_cache_touch(td, i);
+	return(e);
+}
+
+/* Show the cache statistics of all terms in the message window, optionally clearing them */
+void tile_cache_report(bool reset) {
+	term_data *td;
+	int i, j, used;
+	u32b total;
+
+	if (disable_tile_cache) {
+		c_msg_print("The graphics tiles cache is disabled.");
+		return;
+	}
+	c_msg_format("Graphics tiles cache: %d entries per window.", tile_cache_size);
+	for (i = 0; i < ANGBAND_TERM_MAX; i++) {
+		td = term_idx_to_term_data(i);
+		if (!td->tile_cache && !td->tile_cache_hits && !td->tile_cache_misses) continue;
+
+		for (used = 0, j = 0; td->tile_cache && j < tile_cache_size; j++)
+			if (td->tile_cache[j].is_valid) used++;
+		total = td->tile_cache_hits + td->tile_cache_misses;
+		c_msg_format(" Window %d: %d used, %u hits, %u misses (%d%% hits), %u evicted, %u invalidated.", i, used,
+		    td->tile_cache_hits, td->tile_cache_misses, total ? (int)(((u64b)td->tile_cache_hits * 100) / total) : 0,
+		    td->tile_cache_evictions, td->tile_cache_invalidations);
+		if (reset) td->tile_cache_hits = td->tile_cache_misses = td->tile_cache_evictions = td->tile_cache_invalidations = 0;
+	}
+}
+ #endif
+
 /* Frees all graphics structures in provided term_data and sets them to zero values. */
 static void free_graphics(term_data *td) {
 	int i;
@@ -1892,8 +2287,8 @@ static void free_graphics(term_data *td) {
 	}
 
  #ifdef TILE_CACHE_SIZE
-	if (!disable_tile_cache)
-	for (int i = 0; i < TILE_CACHE_SIZE; i++) {
+	if (!disable_tile_cache && td->tile_cache)
+	for (int i = 0; i < tile_cache_size; i++) {
 		if (td->tile_cache[i].tilePreparation) {
 			XFreePixmap(Metadpy->dpy, td->tile_cache[i].tilePreparation);
 			td->tile_cache[i].tilePreparation = None;
@@ -1909,6 +2304,10 @@ static void free_graphics(term_data *td) {
 			/* Optional 'bg' and 'fg' need no intialization */
 		}
 	}
+	if (td->tile_cache) {
+		C_KILL(td->tile_cache, tile_cache_size, struct tile_cache_entry);
+		C_KILL(td->tile_cache_hash, td->tile_cache_buckets, int);
+	}
  #endif
 }
 #endif
@@ -1928,6 +2327,9 @@ static errr term_data_nuke(term_data *td) {
 	// Unmap & free inner window.
 	if (td->inner && td->inner->nuke) {
 		if (Infowin == td->inner) Infowin_set(NULL);
+#ifdef X11_FRAMEBUFFER
+		Infowin_fb_free(td->inner);
+#endif
 		if (td->inner->win) {
 			XSelectInput(Metadpy->dpy, td->inner->win, 0L);
 			XUnmapWindow(Metadpy->dpy, td->inner->win);
@@ -2041,6 +2443,88 @@ static errr Term_xtra_x11_level(int v) {
 }
 
 
+#ifdef X11_FRAMEBUFFER
+/* Draw a line of diagnostics right-aligned into the given row of a term's window */
+static void Term_overlay_x11(term_data *td, int row, byte attr, cptr buf, int n) {
+	infowin *iwin = td->inner;
+
+	XSetFont(Metadpy->dpy, clr[attr]->gc, td->fnt->info->fid);
+	XDrawImageString(Metadpy->dpy, iwin->win, clr[attr]->gc,
+	    iwin->w - n * td->fnt->wid, row * td->fnt->hgt + td->fnt->asc, buf, n);
+	Infowin_dirty(iwin, iwin->w - n * td->fnt->wid, row * td->fnt->hgt, n * td->fnt->wid, td->fnt->hgt);
+}
+
+/*
+ * Finish a frame of a term: copy what changed to its window and account for
+ * the time since the first change was drawn. With an overlay enabled we wait
+ * for the X server to catch up, so the time includes its share of the work.
+ */
+static void Term_present_x11(term_data *td) {
+	infowin *iwin = td->inner;
+	struct timeval now;
+#ifdef CLIENT_LATENCY
+	struct timeval start;
+#endif
+	char buf[80];
+	int n, row = 0;
+
+	if (!iwin || !iwin->fb || !iwin->fb_start.tv_sec) return;
+
+#ifdef CLIENT_LATENCY
+	gettimeofday(&start, NULL);
+#endif
+	n = Infowin_present(iwin);
+	if (x11_frametime
+#ifdef CLIENT_LATENCY
+	    || latency_overlay
+#endif
+	    ) XSync(Metadpy->dpy, False);
+
+	gettimeofday(&now, NULL);
+	fb_frame_last = (now.tv_sec - iwin->fb_start.tv_sec) * 1000000 + now.tv_usec - iwin->fb_start.tv_usec;
+	fb_blits_last = n;
+	iwin->fb_start.tv_sec = 0;
+	fb_frames++;
+	fb_blits += n;
+	fb_frame_total += fb_frame_last;
+	if (fb_frame_last > fb_frame_max) fb_frame_max = fb_frame_last;
+
+	if (td != &term_main) return;
+#ifdef CLIENT_LATENCY
+	latency_present((now.tv_sec - start.tv_sec) * 1000000 + now.tv_usec - start.tv_usec);
+#endif
+
+	/* Draw the overlays straight onto the window, top right, and mark that
+	   area dirty so the next frame restores what is underneath */
+	if (x11_frametime) {
+		n = sprintf(buf, " %lu.%02lums %d blit%s ", (unsigned long)(fb_frame_last / 1000),
+		    (unsigned long)((fb_frame_last % 1000) / 10), fb_blits_last, fb_blits_last == 1 ? "" : "s");
+		Term_overlay_x11(td, row++, TERM_YELLOW, buf, n);
+	}
+#ifdef CLIENT_LATENCY
+	if (latency_overlay) {
+		latency_overlay_text(buf);
+		Term_overlay_x11(td, row, TERM_L_GREEN, buf, strlen(buf));
+	}
+#endif
+	iwin->fb_start.tv_sec = 0;
+}
+
+/* Show the frame statistics in the message window, optionally clearing them */
+void frametime_report(bool reset) {
+	if (!x11_framebuffer) {
+		c_msg_print("The off-screen framebuffer is disabled ('x11Framebuffer' in .tomenetrc).");
+		return;
+	}
+	c_msg_format("Frames: %u, avg %lu us, max %u us, last %u us. Blits: %u (%u.%02u per frame), last frame %u.",
+	    fb_frames, fb_frames ? (unsigned long)(fb_frame_total / fb_frames) : 0UL, fb_frame_max, fb_frame_last,
+	    fb_blits, fb_frames ? fb_blits / fb_frames : 0, fb_frames ? ((fb_blits * 100) / fb_frames) % 100 : 0, fb_blits_last);
+	c_msg_format("Pixels copied to the screen: %lu (%lu per frame). Overlay is %s.",
+	    (unsigned long)fb_pixels, fb_frames ? (unsigned long)(fb_pixels / fb_frames) : 0UL, x11_frametime ? "on" : "off");
+	if (reset) fb_frames = fb_blits = fb_frame_max = fb_frame_last = fb_blits_last = 0, fb_frame_total = fb_pixels = 0;
+}
+#endif
+
 /*
  * Handle a "special request"
  */
@@ -2051,7 +2535,12 @@ static errr Term_xtra_x11(int n, int v) {
 		case TERM_XTRA_NOISE: Metadpy_do_beep(); return(0);
 
 		/* Flush the output XXX XXX XXX */
-		case TERM_XTRA_FRESH: Metadpy_update(1, 0, 0); return(0);
+		case TERM_XTRA_FRESH:
+#ifdef X11_FRAMEBUFFER
+			Term_present_x11((term_data*)(Term->data));
+#endif
+			Metadpy_update(1, 0, 0);
+			return(0);
 
 		/* Process random events XXX XXX XXX */
 		case TERM_XTRA_BORED: return(CheckEvent(0));
@@ -2356,7 +2845,7 @@ static errr Term_pict_x11(int x, int y, byte a, char32_t c) {
 	Pixmap tilePreparation;
  #ifdef TILE_CACHE_SIZE
 	struct tile_cache_entry *entry;
-	int i, hole = -1;
+	int i;
  #endif
 	XImage *tiles, *fgmask;
 
@@ -2397,62 +2886,33 @@ static errr Term_pict_x11(int x, int y, byte a, char32_t c) {
 
  #ifdef TILE_CACHE_SIZE
 	if (!disable_tile_cache) {
-		entry = NULL;
-		for (i = 0; i < TILE_CACHE_SIZE; i++) {
-			entry = &td->tile_cache[i];
-			if (!entry->is_valid) hole = i;
-			else if (entry->c == c && entry->a == a
   #ifdef GRAPHICS_BG_MASK
-			    && entry->c_back == 32 && entry->a_back == TERM_DARK
-  #endif
-  #ifdef TILE_CACHE_FGBG /* Instead of this, invalidate_graphics_cache_...() will specifically invalidate affected entries */
-			    /* Extra: Verify that palette is identical - allows palette_animation to work w/o invalidating the whole cache each time: */
-			    && Infoclr->fg == entry->fg && Infoclr->bg == entry->bg
+		i = tile_cache_find(td, c, a, 32, TERM_DARK);
+  #else
+		i = tile_cache_find(td, c, a, 0, 0);
   #endif
-			    ) {
-				/* Copy cached tile to window. */
-				XCopyArea(Metadpy->dpy, entry->tilePreparation, td->inner->win, Infoclr->gc,
-					0, 0,
-					td->fnt->wid, td->fnt->hgt,
-					x, y);
-
-				/* Success */
-				return(0);
-			}
-		}
+		if (i != -1) {
+			/* Copy cached tile to window. */
+			XCopyArea(Metadpy->dpy, td->tile_cache[i].tilePreparation, Infowin_drawable(td->inner), Infoclr->gc,
+				0, 0,
+				td->fnt->wid, td->fnt->hgt,
+				x, y);
+			Infowin_dirty(td->inner, x, y, td->fnt->wid, td->fnt->hgt);
 
-		// Replace invalid cache entries right away in-place, so we don't kick other still valid entries out via FIFO'ing
-		if (hole != -1) {
-  #ifdef TILE_CACHE_LOG
-			c_msg_format("Tile cache pos (hole): %d / %d", hole, TILE_CACHE_SIZE);
-  #endif
-			entry = &td->tile_cache[hole];
-		} else {
-  #ifdef TILE_CACHE_LOG
-			c_msg_format("Tile cache pos (FIFO): %d / %d", td->cache_position, TILE_CACHE_SIZE);
-  #endif
-			// Replace valid cache entries in FIFO order
-			entry = &td->tile_cache[td->cache_position++];
-			if (td->cache_position >= TILE_CACHE_SIZE) td->cache_position = 0;
+			/* Success */
+			return(0);
 		}
 
-		tilePreparation = entry->tilePreparation;
-		entry->c = c;
-		entry->a = a;
   #ifdef GRAPHICS_BG_MASK
    #if 0
-		entry->c_back = 32;
+		entry = tile_cache_take(td, c, a, 32, TERM_DARK);
    #else
-		if (use_graphics != UG_2MASK) entry->c_back = 32;
-		else entry->c_back = Client_setup.f_char[FEAT_SOLID];
+		entry = tile_cache_take(td, c, a, use_graphics != UG_2MASK ? 32 : Client_setup.f_char[FEAT_SOLID], TERM_DARK);
    #endif
-		entry->a_back = TERM_DARK;
-  #endif
-		entry->is_valid = TRUE;
-  #ifdef TILE_CACHE_FGBG
-		entry->fg = Infoclr->fg;
-		entry->bg = Infoclr->bg;
+  #else
+		entry = tile_cache_take(td, c, a, 0, 0);
   #endif
+		tilePreparation = entry->tilePreparation;
 	} else tilePreparation = td->tilePreparation;
  #else /* (TILE_CACHE_SIZE) No caching: */
 	tilePreparation = td->tilePreparation;
@@ -2478,10 +2938,11 @@ static errr Term_pict_x11(int x, int y, byte a, char32_t c) {
 	XSetClipMask(Metadpy->dpy, Infoclr->gc, None);
 
 	/* Copy prepared tile to window. */
-	XCopyArea(Metadpy->dpy, tilePreparation, td->inner->win, Infoclr->gc,
+	XCopyArea(Metadpy->dpy, tilePreparation, Infowin_drawable(td->inner), Infoclr->gc,
 		  0, 0,
 		  td->fnt->wid, td->fnt->hgt,
 		  x, y);
+	Infowin_dirty(td->inner, x, y, td->fnt->wid, td->fnt->hgt);
 
 	/* Success */
 	return(0);
@@ -2495,8 +2956,8 @@ static errr Term_pict_x11_2mask(int x, int y, byte a, char32_t c, byte a_back, c
 	Pixmap tilePreparation2;
    #ifdef TILE_CACHE_SIZE
 	struct tile_cache_entry *entry;
-	int i, j, hole = -1;
-#endif
+	int i;
+   #endif
 	XImage *tiles, *fgmask, *bgmask;
 	XImage *back_tiles, *back_fgmask, *back_bgmask;
 
@@ -2551,54 +3012,20 @@ static errr Term_pict_x11_2mask(int x, int y, byte a, char32_t c, byte a_back, c
 
    #ifdef TILE_CACHE_SIZE
     if (!disable_tile_cache) {
-	entry = NULL;
-	for (i = 0; i < TILE_CACHE_SIZE; i++) {
-		entry = &td->tile_cache[i];
-		if (!entry->is_valid) hole = i;
-		else if (entry->c == c && entry->a == a && entry->c_back == c_back && entry->a_back == a_back
-    #ifdef TILE_CACHE_FGBG /* Instead of this, invalidate_graphics_cache_...() will specifically invalidate affected entries */
-		    /* Extra: Verify that palette is identical - allows palette_animation to work w/o invalidating the whole cache each time: */
-		    && Infoclr->fg == entry->fg && Infoclr->bg == entry->bg
-    #endif
-		    ) {
-			/* Copy cached tile to window. */
-			XCopyArea(Metadpy->dpy, entry->tilePreparation2, td->inner->win, Infoclr->gc, // NOTE that tilePreparation2 holds the final tile, NOT tilePreparation!
-				0, 0,
-				td->fnt->wid, td->fnt->hgt,
-				x, y);
-
-			/* Success */
-			return(0);
-		}
-	}
-
-	// Replace invalid cache entries right away in-place, so we don't kick other still valid entries out via FIFO'ing
-	if (hole != -1) {
-    #ifdef TILE_CACHE_LOG
-		c_msg_format("Tile cache pos (hole): %d / %d", hole, TILE_CACHE_SIZE);
-    #endif
-		entry = &td->tile_cache[hole];
-	} else {
-    #ifdef TILE_CACHE_LOG
-		c_msg_format("Tile cache pos (FIFO): %d / %d", td->cache_position, TILE_CACHE_SIZE);
-    #endif
-		// Replace valid cache entries in FIFO order
-		entry = &td->tile_cache[td->cache_position++];
-		if (td->cache_position >= TILE_CACHE_SIZE) td->cache_position = 0;
+	if ((i = tile_cache_find(td, c, a, c_back, a_back)) != -1) {
+		/* Copy cached tile to window. */
+		XCopyArea(Metadpy->dpy, td->tile_cache[i].tilePreparation2, Infowin_drawable(td->inner), Infoclr->gc, // NOTE that tilePreparation2 holds the final tile, NOT tilePreparation!
+			0, 0,
+			td->fnt->wid, td->fnt->hgt,
+			x, y);
+		Infowin_dirty(td->inner, x, y, td->fnt->wid, td->fnt->hgt);
+
+		/* Success */
+		return(0);
 	}
 
+	entry = tile_cache_take(td, c, a, c_back, a_back);
 	tilePreparation2 = entry->tilePreparation2;
-	entry->c = c;
-	entry->a = a;
-    #ifdef GRAPHICS_BG_MASK
-	entry->c_back = c_back;
-	entry->a_back = a_back;
-    #endif
-	entry->is_valid = TRUE;
-    #ifdef TILE_CACHE_FGBG
-	entry->fg = Infoclr->fg;
-	entry->bg = Infoclr->bg;
-    #endif
     } else {
 	tilePreparation2 = td->tilePreparation2;
     }
@@ -2689,10 +3116,11 @@ static errr Term_pict_x11_2mask(int x, int y, byte a, char32_t c, byte a_back, c
 #endif
 
 	/* Copy prepared combo-tile to window. */
-	XCopyArea(Metadpy->dpy, tilePreparation2, td->inner->win, Infoclr->gc,
+	XCopyArea(Metadpy->dpy, tilePreparation2, Infowin_drawable(td->inner), Infoclr->gc,
 		  0, 0,
 		  td->fnt->wid, td->fnt->hgt,
 		  x, y);
+	Infowin_dirty(td->inner, x, y, td->fnt->wid, td->fnt->hgt);
 
 	/* Success */
 	return(0);
@@ -2702,21 +3130,25 @@ static errr Term_pict_x11_2mask(int x, int y, byte a, char32_t c, byte a_back, c
  #ifdef TILE_CACHE_SIZE
 /* c_idx: -1 = invalidate all; otherwise only tiles that use this colour are invalidated. */
 static void invalidate_graphics_cache_x11(term_data *td, int c_idx) {
-	int i;
+	int i, k;
 
-	if (disable_tile_cache) return;
+	if (disable_tile_cache || !td->tile_cache) return;
 
-	if (c_idx == -1)
-		for (i = 0; i < TILE_CACHE_SIZE; i++)
-			td->tile_cache[i].is_valid = FALSE;
-	else
-		for (i = 0; i < TILE_CACHE_SIZE; i++)
-			if (td->tile_cache[i].a == c_idx
-  #ifdef GRAPHICS_BG_MASK
-			    || td->tile_cache[i].a_back == c_idx
-  #endif
-			    )
-				td->tile_cache[i].is_valid = FALSE;
+	if (c_idx == -1) {
+		for (i = 0; i < tile_cache_size; i++)
+			if (td->tile_cache[i].is_valid) td->tile_cache_invalidations++;
+		tile_cache_reset(td);
+		return;
+	}
+	if (c_idx < 0 || c_idx > 255) return;
+
+	/* Invalidated entries get reused first */
+	for (k = 0; k < TILE_CACHE_ATTRS; k++)
+		while ((i = td->tile_cache_attr[c_idx][k]) != -1) {
+			tile_cache_unlink(td, i);
+			tile_cache_retire(td, i);
+			td->tile_cache_invalidations++;
+		}
 }
  #endif
 
@@ -2795,10 +3227,11 @@ static errr Term_rawpict_x11(int x, int y, int c) {
   #endif
 			    ) {
 				/* Copy cached tile to window. */
-				XCopyArea(Metadpy->dpy, entry->tilePreparation, td->inner->win, Infoclr->gc,
+				XCopyArea(Metadpy->dpy, entry->tilePreparation, Infowin_drawable(td->inner), Infoclr->gc,
 					0, 0,
 					td->fnt->wid, td->fnt->hgt,
 					x, y);
+				Infowin_dirty(td->inner, x, y, td->fnt->wid, td->fnt->hgt);
 
 				/* Success */
 				return(0);
@@ -2856,9 +3289,10 @@ static errr Term_rawpict_x11(int x, int y, int c) {
 	x1 = trp.x;
 	y1 = trp.y;
 
-	XPutImage(Metadpy->dpy, td->inner->win, Infoclr->gc,
+	XPutImage(Metadpy->dpy, Infowin_drawable(td->inner), Infoclr->gc,
 	    tiles, x1, y1,
 	    x, y, trp.w, trp.h);
+	Infowin_dirty(td->inner, x, y, trp.w, trp.h);
 
 	/* Success */
 	return(0);
@@ -2989,10 +3423,77 @@ static errr ReadBMPData(char *Name, char **data_return,  int *width_return, int
 	return(0);
 }
 
+/* Is the image laid out the way the direct pixel accesses below expect: 32 bit, least significant byte blue? */
+static bool image_is_bgrx(XImage *image) {
+	return(image->format == ZPixmap && image->bits_per_pixel == 32 && image->byte_order == LSBFirst);
+}
+
+/* Split a (bgrx) image into planes for the resampler */
+static int image_to_planes(XImage *image, rgb_planes *planes) {
+	int x, y;
+
+	if (rgb_planes_alloc(planes, image->width, image->height)) return(-1);
+	for (y = 0; y < image->height; y++) {
+		unsigned char *in = (unsigned char *)image->data + y * image->bytes_per_line;
+		int i = y * image->width;
+
+		for (x = 0; x < image->width; x++, in += 4, i++) {
+			planes->plane[0][i] = in[2];
+			planes->plane[1][i] = in[1];
+			planes->plane[2][i] = in[0];
+		}
+	}
+	return(0);
+}
+
+/* Put planes back into a (bgrx) image of the same size */
+static void planes_to_image(rgb_planes *planes, XImage *image) {
+	int x, y;
+
+	for (y = 0; y < image->height; y++) {
+		unsigned char *out = (unsigned char *)image->data + y * image->bytes_per_line;
+		int i = y * image->width;
+
+		for (x = 0; x < image->width; x++, out += 4, i++) {
+			out[0] = planes->plane[2][i];
+			out[1] = planes->plane[1][i];
+			out[2] = planes->plane[0][i];
+			out[3] = 0;
+		}
+	}
+}
+
+/* Apply a colour filter to (a bgrx) image, writing the result to 'dest' which may be the same image */
+static void filterImageBgrx(XImage *image, XImage *dest, color_rgb (*color_filter_function)(color_rgb)) {
+	int x, y;
+	color_rgb rgb;
+
+	for (y = 0; y < image->height; y++) {
+		unsigned char *in = (unsigned char *)image->data + y * image->bytes_per_line;
+		unsigned char *out = (unsigned char *)dest->data + y * dest->bytes_per_line;
+
+		for (x = 0; x < image->width; x++, in += 4, out += 4) {
+			rgb.red = in[2];
+			rgb.green = in[1];
+			rgb.blue = in[0];
+			rgb = color_filter_function(rgb);
+			out[0] = rgb.blue;
+			out[1] = rgb.green;
+			out[2] = rgb.red;
+			out[3] = 0;
+		}
+	}
+}
+
 void filterImagePixels(XImage *image, color_rgb (*color_filter_function)(color_rgb))
 {
 	Pixell pixel = 0;
 
+	if (image_is_bgrx(image)) {
+		filterImageBgrx(image, image, color_filter_function);
+		return;
+	}
+
 	for (int y = 0; y < image->height; y++)
 	{
 		for (int x = 0; x < image->width; x++)
@@ -3017,6 +3518,11 @@ static XImage *createMaskFromImage(Display *display, XImage *image, int width, i
 		display, DefaultVisual(display, DefaultScreen(display)), image->depth, ZPixmap, 0,
 		maskData, width, height, image->bits_per_pixel, 0);
 
+	if (image_is_bgrx(image) && image_is_bgrx(mask) && width == image->width && height == image->height) {
+		filterImageBgrx(image, mask, color_filter_function);
+		return mask;
+	}
+
 	// this is almost the same as filterImagePixels, but i need to read from one XImage and put into another
 	for (int y = 0; y < height; y++)
 	{
@@ -3189,6 +3695,7 @@ void rescaleRawpict(XImage *originalImage, int tileWidth, int tileHeight, int fo
 
 /*
  * Resize an image. XXX XXX XXX
+ * Each tile is resized on its own, samples never cross into neighbouring tiles.
  *
  * It's your responsibility to free returned XImage after usage.
  */
@@ -3211,6 +3718,22 @@ static XImage *ResizeImage(Display *display, XImage *originalImage,	int tileWidt
 			display, DefaultVisual(display, DefaultScreen(display)), originalImage->depth, ZPixmap, 0,
 			resizedImageData, resizedWidth, resizedHeight, originalImage->bits_per_pixel, 0);
 
+	/* Common case: hand the whole tileset to the fixed-point resampler */
+	if (image_is_bgrx(originalImage) && image_is_bgrx(resizedImage)) {
+		rgb_planes src, dst;
+
+		if (!image_to_planes(originalImage, &src)) {
+			if (!resize_tileset(&src, &dst, tileWidth, tileHeight, fontWidth, fontHeight, gfx_resize_type)) {
+				planes_to_image(&dst, resizedImage);
+				rgb_planes_free(&dst);
+				rgb_planes_free(&src);
+				return(resizedImage);
+			}
+			rgb_planes_free(&src);
+		}
+	}
+
+	/* Otherwise go pixel by pixel */
 	float widthRatio = ((float)originalImageWidth) / ((float)resizedWidth);
 	float heightRatio = ((float)originalImageHeight) / ((float)resizedHeight);
 
@@ -3436,6 +3959,9 @@ static errr term_data_init(int index, term_data *td, bool fixed, cptr name, cptr
 	Infowin_set(td->inner);
 	Infowin_init_std(td->outer, 0, 0, wid, hgt, DEFAULT_X11_INNER_BORDER_WIDTH);
 	Infowin_set_mask(ExposureMask);
+#ifdef X11_FRAMEBUFFER
+	Infowin_fb_create(Infowin);
+#endif
 	Infowin_map();
 
 #ifdef USE_GRAPHICS
@@ -3526,7 +4052,8 @@ static errr term_data_init(int index, term_data *td, bool fixed, cptr name, cptr
 		   Memory cost could become "large" quickly though (eg 5MB bitmap -> 80MB). Not a real issue probably. */
  #ifdef TILE_CACHE_SIZE
 		if (!disable_tile_cache) {
-			for (int i = 0; i < TILE_CACHE_SIZE; i++) {
+			tile_cache_alloc(td);
+			for (int i = 0; i < tile_cache_size; i++) {
 				td->tile_cache[i].tilePreparation = XCreatePixmap(
 					Metadpy->dpy, Metadpy->root,
 					td->fnt->wid, td->fnt->hgt, td->tiles->depth);
@@ -4264,16 +4791,18 @@ void resize_term_gfx(int term_idx)
 #endif
 
 #ifdef TILE_CACHE_SIZE
-	if (!disable_tile_cache)
-	for (i = 0; i < TILE_CACHE_SIZE; i++) {
-		td->tile_cache[i].tilePreparation = XCreatePixmap(
-			Metadpy->dpy, Metadpy->root,
-			td->fnt->wid, td->fnt->hgt, td->tiles->depth);
+	if (!disable_tile_cache) {
+		tile_cache_alloc(td);
+		for (i = 0; i < tile_cache_size; i++) {
+			td->tile_cache[i].tilePreparation = XCreatePixmap(
+				Metadpy->dpy, Metadpy->root,
+				td->fnt->wid, td->fnt->hgt, td->tiles->depth);
 #ifdef GRAPHICS_BG_MASK
-		td->tile_cache[i].tilePreparation2 = XCreatePixmap(
-			Metadpy->dpy, Metadpy->root,
-			td->fnt->wid, td->fnt->hgt, td->tiles->depth);
+			td->tile_cache[i].tilePreparation2 = XCreatePixmap(
+				Metadpy->dpy, Metadpy->root,
+				td->fnt->wid, td->fnt->hgt, td->tiles->depth);
 #endif
+		}
 	}
 #endif
 
@@ -83,6 +83,43 @@ static int		last_send_anything;
 static int		prev_type;
 static char		cl_initialized = 0;
 
+#ifdef CLIENT_LATENCY
+/*
+ * Latency tracing for '/latency', to tell network, server and client lag apart.
+ * We take timestamps at keypress, when the resulting command is flushed to the
+ * socket, when the first server data after that arrives and when the main
+ * window has been drawn (and presented) after it. Each stage keeps a rolling
+ * window of its last LAT_SAMPLES samples, in microseconds.
+ * The server doesn't tag its replies, so the 'reply' to a command is simply
+ * the first data received after it went out, pongs to our pings excepted.
+ */
+#define LAT_KEY_SEND	0	/* keypress -> command flushed */
+#define LAT_SEND_REPLY	1	/* command flushed -> first data received */
+#define LAT_PACKET_DRAW	2	/* data received -> main window drawn */
+#define LAT_KEY_PHOTON	3	/* keypress -> reply drawn */
+#define LAT_FRESH	4	/* Term_fresh() of the main window, if it drew anything */
+#define LAT_PRESENT	5	/* copying the main window to the screen, if the front-end tells us */
+#define LAT_PING	6	/* ping round trip time */
+#define LAT_MAX		7
+
+#define LAT_SAMPLES	512
+/* A keypress that didn't lead to a command within this time (us) was probably for a menu or prompt */
+#define LAT_KEY_STALE	1000000
+/* Buckets of the dumped histograms, doubling from 128 us to ~4 s */
+#define LAT_BUCKETS	16
+
+static cptr lat_name[LAT_MAX] = { "key>send", "send>reply", "packet>draw", "key>photon", "fresh", "present", "ping" };
+static u32b lat_sample[LAT_MAX][LAT_SAMPLES], lat_count[LAT_MAX];
+/* Pending timestamps: last keypress, last command sent and its keypress, reply to be drawn and its keypress, data to be drawn */
+static u64b lat_key, lat_sent, lat_sent_key, lat_reply_key, lat_packet;
+
+bool latency_overlay = FALSE;
+
+static void latency_add(int stage, u64b us);
+static void latency_send(void);
+static void latency_receive(int type);
+#endif
+
 
 /* Based on Virus' MP bar mod */
 char *marker1 = "#######";
@@ -1543,6 +1580,9 @@ int Net_flush(void) {
 		wbuf.ptr = wbuf.buf;
 		return(0);
 	}
+#ifdef CLIENT_LATENCY
+	latency_send();
+#endif
 	if (Sockbuf_flush(&wbuf) == -1)
 		return(-1);
 	Sockbuf_clear(&wbuf);
@@ -1888,6 +1928,10 @@ int Net_input(void) {
 
 	/* Keep reading as long as we have something on the socket */
 	while (SocketReadable(netfd)) {
+#ifdef CLIENT_LATENCY
+		int old_len = rbuf.len;
+#endif
+
 		n = Sockbuf_read(&rbuf);
 
 		if (n == 0) {
@@ -1899,6 +1943,9 @@ int Net_input(void) {
 #endif
 			return(n);
 		} else {
+#ifdef CLIENT_LATENCY
+			latency_receive(rbuf.buf[old_len] & 0xFF);
+#endif
 			n = Net_packet();
 
 			/* Make room for more packets */
@@ -6379,6 +6426,9 @@ int Receive_ping(void) {
 		index = ping_id - id;
 		if (index >= 0 && index < 60) {
 			ping_times[index] = rtt;
+#ifdef CLIENT_LATENCY
+			latency_add(LAT_PING, ((tim_now - tim) * 1000000 + utim_now - utim));
+#endif
 
 			/* Also determine our average ping over the last 10 minutes or so */
 
@@ -8204,6 +8254,184 @@ int Send_unknownpacket(int type, int prev_type) {
 
 
 
+#ifdef CLIENT_LATENCY
+/* Current time in microseconds */
+u64b latency_now(void) {
+	struct timeval tv;
+
+ #ifdef WINDOWS
+	/* Use the multimedia timer function */
+	DWORD systime_ms = timeGetTime();
+	tv.tv_sec = systime_ms / 1000;
+	tv.tv_usec = (systime_ms % 1000) * 1000;
+ #else
+	gettimeofday(&tv, NULL);
+ #endif
+	return((u64b)tv.tv_sec * 1000000 + tv.tv_usec);
+}
+
+static void latency_add(int stage, u64b us) {
+	lat_sample[stage][lat_count[stage]++ % LAT_SAMPLES] = us > 0xFFFFFFFF ? 0xFFFFFFFF : (u32b)us;
+}
+
+/* A key was pressed (Term_keypress) */
+void latency_key(void) {
+	lat_key = latency_now();
+}
+
+/* The output buffer is about to be flushed: does it carry a command for the last keypress? */
+static void latency_send(void) {
+	int type = wbuf.buf[0] & 0xFF;
+	u64b now;
+
+	if (!lat_key || type == PKT_PING || type == PKT_KEEPALIVE) return;
+
+	now = latency_now();
+	if (now - lat_key < LAT_KEY_STALE) {
+		latency_add(LAT_KEY_SEND, now - lat_key);
+		lat_sent = now;
+		lat_sent_key = lat_key;
+	}
+	lat_key = 0;
+}
+
+/* Data arrived, starting with a packet of the given type */
+static void latency_receive(int type) {
+	u64b now = latency_now();
+
+	if (!lat_packet) lat_packet = now;
+	if (!lat_sent || type == PKT_PING) return;
+
+	latency_add(LAT_SEND_REPLY, now - lat_sent);
+	lat_reply_key = lat_sent_key;
+	lat_sent = 0;
+}
+
+/* Term_fresh() of term 't' finished; it started at 'start' and 'drew' tells whether there was anything to draw */
+void latency_fresh(term *t, u64b start, bool drew) {
+	u64b now;
+
+	if (t != term_term_main) return;
+
+	now = latency_now();
+	if (drew) latency_add(LAT_FRESH, now - start);
+	if (lat_packet) {
+		latency_add(LAT_PACKET_DRAW, now - lat_packet);
+		lat_packet = 0;
+	}
+	if (lat_reply_key) {
+		latency_add(LAT_KEY_PHOTON, now - lat_reply_key);
+		lat_reply_key = 0;
+	}
+}
+
+/* The front-end copied the main window to the screen, which took 'us' */
+void latency_present(u32b us) {
+	latency_add(LAT_PRESENT, us);
+}
+
+static int latency_cmp(const void *a, const void *b) {
+	u32b x = *(const u32b*)a, y = *(const u32b*)b;
+
+	return(x < y ? -1 : (x > y ? 1 : 0));
+}
+
+/* Copy the samples of a stage in ascending order, returns their number */
+static int latency_sorted(int stage, u32b *buf) {
+	int n = lat_count[stage] < LAT_SAMPLES ? lat_count[stage] : LAT_SAMPLES;
+
+	memcpy(buf, lat_sample[stage], n * sizeof(u32b));
+	qsort(buf, n, sizeof(u32b), latency_cmp);
+	return(n);
+}
+
+/* Percentile 'p' of 'n' sorted samples */
+#define LAT_PCT(buf, n, p) ((buf)[((n) - 1) * (p) / 100])
+
+/* Short summary for the front-end's overlay: median/95th percentile of the main stages, in ms */
+void latency_overlay_text(char *out) {
+	u32b buf[LAT_SAMPLES];
+	int stage[3] = { LAT_KEY_PHOTON, LAT_SEND_REPLY, LAT_PACKET_DRAW }, i, n;
+	char *label[3] = { "in>ph", "net", "draw" };
+
+	out[0] = 0;
+	for (i = 0; i < 3; i++) {
+		if (!(n = latency_sorted(stage[i], buf))) strcat(out, format(" %s -", label[i]));
+		else strcat(out, format(" %s %u/%ums", label[i], LAT_PCT(buf, n, 50) / 1000, LAT_PCT(buf, n, 95) / 1000));
+	}
+	strcat(out, " ");
+}
+
+/* Show the statistics in the message window, optionally clearing them */
+void latency_report(bool reset) {
+	u32b buf[LAT_SAMPLES];
+	int i, n;
+
+	for (i = 0; i < LAT_MAX; i++) {
+		if (!(n = latency_sorted(i, buf))) {
+			c_msg_format("\377w%-11s \377sno samples", lat_name[i]);
+			continue;
+		}
+		c_msg_format("\377w%-11s \377s%4d, median %u.%02u, 90%% %u.%02u, 99%% %u.%02u, max %u.%02u ms", lat_name[i], n,
+		    LAT_PCT(buf, n, 50) / 1000, (LAT_PCT(buf, n, 50) % 1000) / 10, LAT_PCT(buf, n, 90) / 1000, (LAT_PCT(buf, n, 90) % 1000) / 10,
+		    LAT_PCT(buf, n, 99) / 1000, (LAT_PCT(buf, n, 99) % 1000) / 10, buf[n - 1] / 1000, (buf[n - 1] % 1000) / 10);
+	}
+	if (reset) {
+		memset(lat_count, 0, sizeof(lat_count));
+		lat_key = lat_sent = lat_sent_key = lat_reply_key = lat_packet = 0;
+		c_msg_print("Latency statistics cleared.");
+	}
+}
+
+/* Write the statistics, a histogram and the raw samples of each stage to a file in the user folder */
+void latency_dump(cptr fname) {
+	u32b buf[LAT_SAMPLES];
+	int i, j, b, n, hist[LAT_BUCKETS + 1];
+	char path[1024];
+	FILE *fp;
+	time_t now = time(NULL);
+
+	path_build(path, 1024, ANGBAND_DIR_USER, fname);
+	if (!(fp = my_fopen(path, "w"))) {
+		c_msg_format("\377yCannot write to %s.", path);
+		return;
+	}
+
+	fprintf(fp, "# TomeNET %s latency dump, %s", longVersion, ctime(&now));
+	fprintf(fp, "# All times in microseconds, last %d samples per stage. Average ping %d ms.\n", LAT_SAMPLES, ping_avg);
+	for (i = 0; i < LAT_MAX; i++) {
+		n = latency_sorted(i, buf);
+		fprintf(fp, "\n[%s] %d samples", lat_name[i], n);
+		if (!n) {
+			fprintf(fp, "\n");
+			continue;
+		}
+		fprintf(fp, ", min %u, median %u, 90%% %u, 99%% %u, max %u\n",
+		    buf[0], LAT_PCT(buf, n, 50), LAT_PCT(buf, n, 90), LAT_PCT(buf, n, 99), buf[n - 1]);
+
+		memset(hist, 0, sizeof(hist));
+		for (j = 0; j < n; j++) {
+			for (b = 0; b < LAT_BUCKETS && buf[j] >= (128U << b); b++);
+			hist[b]++;
+		}
+		for (b = 0; b <= LAT_BUCKETS; b++) {
+			if (!hist[b]) continue;
+			if (b == LAT_BUCKETS) fprintf(fp, "  >= %7u: %d\n", 128U << (b - 1), hist[b]);
+			else fprintf(fp, "  <  %7u: %d\n", 128U << b, hist[b]);
+		}
+
+		/* Raw samples, oldest first */
+		fprintf(fp, "  samples:");
+		for (j = lat_count[i] - n; j < (int)lat_count[i]; j++)
+			fprintf(fp, "%s%u", (j - (int)lat_count[i] + n) % 16 ? " " : "\n   ", lat_sample[i][(u32b)j % LAT_SAMPLES]);
+		fprintf(fp, "\n");
+	}
+	my_fclose(fp);
+	c_msg_format("Latency statistics written to %s.", path);
+}
+#endif
+
+
 /* ------------------------------------------------------------------------- */
 
 
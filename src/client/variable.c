@@ -719,6 +719,10 @@ char guide_chapter[256][MAX_CHARS], guide_chapter_no[256][8];
 int guide_chapters, guide_endofcontents;
 #ifdef BUFFER_GUIDE
 char *guide_data, **guide_line;
+char *guide_lower;		/* Lower-case copy of guide_data, for guide_find_line() */
+int *guide_line_chapter;	/* Line of the chapter heading each line is under, or -1 */
+time_t guide_mtime;		/* When the file we buffered was last modified, and its size */
+long guide_size;
 #endif
 #ifdef BUFFER_LOCAL_FILE
 char *local_file_data, **local_file_line; //one extra char per line for newline char '\n'
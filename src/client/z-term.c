@@ -2715,6 +2715,10 @@ void Term_repaint(int xstart, int ystart, int wid, int hgt) {
  */
 errr Term_fresh(void) {
 	int y;
+#ifdef CLIENT_LATENCY
+	u64b lat_start;
+	bool lat_drew;
+#endif
 
 	int w = Term->wid;
 	int h = Term->hgt;
@@ -2730,6 +2734,9 @@ errr Term_fresh(void) {
 	/* Do nothing unless "mapped" */
 	if (!Term->mapped_flag) return(1);
 
+#ifdef CLIENT_LATENCY
+	lat_start = latency_now();
+#endif
 
 	/* Paranoia -- enforce "fake" hooks if needed */
 	if (!Term->curs_hook) Term->curs_hook = Term_curs_hack;
@@ -2883,6 +2890,10 @@ errr Term_fresh(void) {
 	}
 
 
+#ifdef CLIENT_LATENCY
+	lat_drew = (Term->y1 <= Term->y2);
+#endif
+
 	/* Something to update */
 	if (Term->y1 <= Term->y2) {
 		/* Handle "icky corner" */
@@ -3044,6 +3055,10 @@ errr Term_fresh(void) {
 	/* Actually flush the output */
 	Term_xtra(TERM_XTRA_FRESH, 0);
 
+#ifdef CLIENT_LATENCY
+	latency_fresh(Term, lat_start, lat_drew);
+#endif
+
 
 	/* Success */
 	return(0);
@@ -3872,6 +3887,10 @@ errr Term_keypress(int k) {
 	         early (which can happen easily on very slow PCs). - C. Blue */
 	if (!Term) return(0);
 
+#ifdef CLIENT_LATENCY
+	latency_key();
+#endif
+
 	/* Add it to the queue */
 	return Term_keypress_aux(Term->keys, k);
 }
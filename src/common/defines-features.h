@@ -125,6 +125,19 @@
 
 #define ANTI_SEVEN_EXPLOIT	/* prevent ball-spell/explosion casters from exploiting monster movement by using a 7-shaped corridor */
 #define DOUBLE_LOS_SAFETY	/* prevent exploit of diagonal LoS that may result in stationary monsters unable to retaliate */
+#define LOS_CACHE		/* remember los()/projectable() results per floor until a grid feature on that floor changes */
+#define MON_NUM_CACHE		/* cache get_mon_num() distributions per hook/dungeon type/level band and draw by binary search */
+#define OBJ_NUM_CACHE		/* cache get_obj_num() distributions per hook/restrictions and draw by binary search, cache ego candidates per kind */
+#define BONI_SLOT_CACHE		/* calc_boni(): remember each equipment slot's flags until the item in it changes */
+#define OBJECT_DESC_CACHE	/* memoize object_desc() results per object state and player knowledge */
+#define HOUSE_INDEX		/* index houses by door grid and by wilderness sector instead of scanning houses[] */
+#define TIMED_OBJECT_LIST	/* process_objects() only visits objects that have a timeout/recharge/melting going on */
+#define PLAYER_VIS_ROSTER	/* update_players(): check player-vs-player visibility per floor and skip off-panel pairs */
+#define STORE_ITEM_POOL		/* stores take new items from a pool of ready-made ones that is filled in idle time, so restocking on entry doesn't stall */
+#define PACKET_CAPTURE		/* admins can /capture the traffic of a connection into a file, see tomenet.loadgen -D and -R */
+#define SERVER_BENCHMARK	/* tomenet.server -B<turns>: run dungeon() back to back with a fixed RNG seed, then report turns/s and per-phase costs */
+#define MEM_ACCOUNTING		/* account live heap memory per subsystem and call site via mem_set_hooks(), see /memacct, the GW port's MEMORY request and tomenet-memory.log */
+#define CMD_QUEUE		/* hand read buffers to the command queue without copying, skip queue passes that can't afford the next command, throttle/kick floods, see /cmdq */
 #define STEAL_CHEEZEREDUCTION	/* reduce cheeziness of stealing by giving more expensive items a chance to turn level 0 */
 
 #define PLAYER_STORES		/* Enable player-run shops - C. Blue */
@@ -862,6 +875,15 @@
  /* Enable bookmarking feature? */
  #define GUIDE_BOOKMARKS 20
 
+ /* X11: Draw into an off-screen pixmap per window and copy only the parts that changed to
+    the screen once per Term_fresh(), instead of sending every text run and tile straight
+    to the window. 'x11Framebuffer 0' in .tomenetrc turns it off, '/frametime' shows timings. */
+ #define X11_FRAMEBUFFER
+
+ /* Keep rolling latency statistics of keypress -> command sent -> server reply -> drawn,
+    so players can tell network, server and client lag apart: '/latency' in-game. */
+ #define CLIENT_LATENCY
+
  /* Disable c_cfg.big_map option and make it a client-global setting instead that spans over any login choice. */
  #define GLOBAL_BIG_MAP
 
@@ -105,7 +105,7 @@
 /* For savefile purpose only */
 #define SF_VERSION_MAJOR	4
 #define SF_VERSION_MINOR	9
-#define SF_VERSION_PATCH	24
+#define SF_VERSION_PATCH	26
 #define SF_VERSION_EXTRA	0 /* <- not used in version checks! */
 
 /* For quests savefile purpose only */
@@ -405,6 +405,9 @@
  */
 #define MAX_WID		198
 
+/* Most entries a spatial query on a floor can return (see floor_query_begin()) */
+#define FLOOR_QUERY_MAX	(MAX_HGT * MAX_WID)
+
 /* Used only in object3.c / trap effects (ToME) */
 #if ((MAX_HGT / SCREEN_HGT) < (MAX_WID / SCREEN_WID))
  #define RATIO (MAX_WID / SCREEN_WID)
@@ -3142,7 +3145,7 @@
 /*
  * Number of effects
  */
-#define MAX_EFFECTS		256	/* 256, 128 */
+#define MAX_EFFECTS		1024	/* 1024, 256, 128 */
 #define MAX_EFFECTS_PLAYER	256	/* 128, 32 */
 
 #define EFF_WAVE		0x00000001U	/* A circle whose radius increase */
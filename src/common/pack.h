@@ -311,3 +311,20 @@
  */
 #define ENTER_GAME_pack	0x00
 #define CONTACT_pack	0x31
+
+
+/*
+ * Packet capture files, written by the server for connections that an admin
+ * chose to /capture, and read by tomenet.loadgen -D (decode) and -R (replay).
+ * A file starts with CAPTURE_MAGIC, followed by records of a 1 byte kind,
+ * 4 bytes usec since the previous record and 4 bytes data length, followed
+ * by the data. All numbers are little-endian.
+ * Apart from CAP_HEAD nothing is recorded before CAP_PLAY, so the login with
+ * its account password never ends up in a file, and neither do password changes.
+ */
+#define CAPTURE_MAGIC	"TNCAP01\n"	/* 8 bytes */
+#define CAP_HEAD	0	/* Account name, host and client version, as one line of text */
+#define CAP_IN		1	/* A client packet, once it was processed (not deferred) */
+#define CAP_OUT		2	/* Bytes sent to the client, one record per flush, starting on a packet boundary */
+#define CAP_CMD		3	/* A client packet was processed: 1 byte type, 4 bytes length, 1 byte result (0: deferred, will come again) */
+#define CAP_PLAY	4	/* The character entered the game, data is its name; the client's input after this can be replayed */
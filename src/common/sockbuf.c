@@ -58,6 +58,7 @@
 #include "version.h"
 #include "const.h"
 /*#include "error.h"*/
+#include "z-virt.h"
 #include "sockbuf.h"
 #include "pack.h"
 #include "bit.h"
@@ -75,7 +76,7 @@
 char net_version[] = VERSION;
 
 int Sockbuf_init(sockbuf_t *sbuf, int sock, int size, int state) {
-    if ((sbuf->buf = sbuf->ptr = (char *) malloc(size)) == NULL) return(-1);
+    if ((sbuf->buf = sbuf->ptr = (char *) mem_alloc(size)) == NULL) return(-1);
     sbuf->sock = sock;
     sbuf->state = state;
     sbuf->len = 0;
@@ -86,7 +87,7 @@ int Sockbuf_init(sockbuf_t *sbuf, int sock, int size, int state) {
 }
 
 int Sockbuf_cleanup(sockbuf_t *sbuf) {
-    if (sbuf->buf != NULL) free(sbuf->buf);
+    if (sbuf->buf != NULL) mem_free(sbuf->buf);
     sbuf->buf = sbuf->ptr = NULL;
     sbuf->size = sbuf->len = 0;
     sbuf->state = 0;
@@ -2483,6 +2483,12 @@ struct store_type {
 	
 	s16b tim_watch;			/* store owner watching out for thieves? */
 	s32b last_theft;		/* Turn of the last occurred theft that was noticed by the owner */
+
+#ifdef STORE_ITEM_POOL
+	object_type *pool;		/* Ready-made items for the next restock (allocated on first restock) */
+	s16b pool_num;			/* Number of items waiting in the pool */
+	s16b pool_lev;			/* Town level the pooled items were made for */
+#endif
 };
 
 /*
@@ -2561,6 +2567,17 @@ struct dun_level {
 
 	/* for obtaining statistical IDDC information: */
 	int monsters_generated, monsters_spawned, monsters_killed;
+
+	int lru_idx;		/* Entry in the resident floor LRU, 0 if not tracked (see floor_lru_update()) */
+	bool dirty;		/* Changed since it was last written to its floor file (see new_wr_floors()) */
+	u32b file_stamp;	/* Stamp of its floor file on disk (see wr_floor_ref()) */
+	u64b file_hash;		/* floor_content_hash() of what its floor file holds */
+
+#ifdef LOS_CACHE
+	/* Bumped on every feature change on this floor, invalidating los_cache entries */
+	u32b feat_epoch;
+	struct los_cache_entry *los_cache;
+#endif
 };
 
 /* dungeon_type structure
@@ -3193,6 +3210,18 @@ struct u32b_char_dict_t {
 	char value;
 };
 
+#ifdef BONI_SLOT_CACHE
+/* An equipped item's flags as calc_boni() needs them, see calc_boni_slot() */
+typedef struct boni_slot boni_slot;
+struct boni_slot {
+	object_type obj;		/* Copy of the item the flags were extracted from */
+	u32b serial;			/* boni_slot_serial at that time, 0 if unused */
+	u32b f1, f2, f3, f4, f5, f6, esp;	/* object_flags() */
+	u32b ego_f1, ego_f5;		/* flags1/flags5 of ego_make(), to clear base item pval flags */
+	u32b art_f1, art_f5;		/* flags1/flags5 of randart_make(), likewise */
+};
+#endif
+
 /*
  * Most of the "player" information goes here.
  *
@@ -4531,6 +4560,10 @@ struct player_type {
 	bool notify_notes, notify_sale;
 	bool ts_sleeping;
 	int custom_timer, custom_timer_notification_interval, custom_timer_notification_timer;
+
+#ifdef BONI_SLOT_CACHE
+	boni_slot boni_slots[INVEN_EQ];	/* Not saved, rebuilt as needed by calc_boni() */
+#endif
 };
 
 /* For Monk martial arts */
@@ -4758,6 +4791,8 @@ struct server_opts {
 	s16b item_awareness;	/* How easily the player becomes aware of unknown items (id scroll/shop/..)-C. Blue */
 	bool worldd_pubchat, worldd_privchat, worldd_broadcast, worldd_lvlup, worldd_unideath, worldd_pwin, worldd_pdeath, worldd_pjoin, worldd_pleave, worldd_plist, worldd_events;//worldd_ircchat;
 	byte leak_info;
+	int cmdq_rate_limit;	/* bytes per second a connection may send before it isn't read from for the rest of the second, 0 = off */
+	int cmdq_max_depth;	/* bytes in the command queue that get a connection kicked, 0 = off */
 };
 
 /* Client option struct */
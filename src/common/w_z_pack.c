@@ -0,0 +1,255 @@
+/*
+** Lua binding: z_pack
+** Generated automatically by tolua 4.0a - angband on Mon Oct 19 05:16:26 2026.
+*/
+
+#include "lua/tolua.h"
+
+/* Exported function */
+int tolua_z_pack_open (lua_State* tolua_S);
+void tolua_z_pack_close (lua_State* tolua_S);
+
+#include "angband.h"
+#include "z-rand.h"
+static s32b lua_rand_int(s32b m) {return rand_int(m);}
+static s32b lua_rand_range(s32b A, s32b B) {return ((A) + (rand_int(1+(B)-(A))));}
+static s32b lua_rand_spread(s32b A, s32b D) {return ((A) + (rand_int(1+(D)+(D))) - (D));}
+static s32b lua_randint(s32b m) {return rand_int(m) + 1;}
+static bool lua_magik(s32b P) {return (rand_int(100) < (P));}
+
+/* function to register type */
+static void toluaI_reg_types (lua_State* tolua_S)
+{
+}
+
+/* error messages */
+#define TOLUA_ERR_SELF tolua_error(tolua_S,"invalid 'self'")
+#define TOLUA_ERR_ASSIGN tolua_error(tolua_S,"#vinvalid type in variable assignment.")
+
+/* function: lua_rand_int */
+static int toluaI_z_pack_rand_int00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  s32b m = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ {
+  s32b toluaI_ret = (s32b)  lua_rand_int(m);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'rand_int'.");
+ return 0;
+}
+
+/* function: lua_rand_range */
+static int toluaI_z_pack_rand_range00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  s32b A = ((s32b)  tolua_getnumber(tolua_S,1,0));
+  s32b B = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ {
+  s32b toluaI_ret = (s32b)  lua_rand_range(A,B);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'rand_range'.");
+ return 0;
+}
+
+/* function: lua_rand_spread */
+static int toluaI_z_pack_rand_spread00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  s32b A = ((s32b)  tolua_getnumber(tolua_S,1,0));
+  s32b D = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ {
+  s32b toluaI_ret = (s32b)  lua_rand_spread(A,D);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'rand_spread'.");
+ return 0;
+}
+
+/* function: lua_randint */
+static int toluaI_z_pack_randint00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  s32b m = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ {
+  s32b toluaI_ret = (s32b)  lua_randint(m);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'randint'.");
+ return 0;
+}
+
+/* function: lua_magik */
+static int toluaI_z_pack_magik00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  s32b P = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  lua_magik(P);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'magik'.");
+ return 0;
+}
+
+/* get function: Rand_quick */
+static int toluaI_get_z_pack_Rand_quick(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)Rand_quick);
+ return 1;
+}
+
+/* set function: Rand_quick */
+static int toluaI_set_z_pack_Rand_quick(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  Rand_quick = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: Rand_value */
+static int toluaI_get_z_pack_Rand_value(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)Rand_value);
+ return 1;
+}
+
+/* set function: Rand_value */
+static int toluaI_set_z_pack_Rand_value(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  Rand_value = ((u32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* function: damroll */
+static int toluaI_z_pack_damroll00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int num = ((int)  tolua_getnumber(tolua_S,1,0));
+  int sides = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  s32b toluaI_ret = (s32b)  damroll(num,sides);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'damroll'.");
+ return 0;
+}
+
+/* function: maxroll */
+static int toluaI_z_pack_maxroll00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int num = ((int)  tolua_getnumber(tolua_S,1,0));
+  int sides = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  s32b toluaI_ret = (s32b)  maxroll(num,sides);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'maxroll'.");
+ return 0;
+}
+
+/* Open function */
+int tolua_z_pack_open (lua_State* tolua_S)
+{
+ tolua_open(tolua_S);
+ toluaI_reg_types(tolua_S);
+ tolua_function(tolua_S,NULL,"rand_int",toluaI_z_pack_rand_int00);
+ tolua_function(tolua_S,NULL,"rand_range",toluaI_z_pack_rand_range00);
+ tolua_function(tolua_S,NULL,"rand_spread",toluaI_z_pack_rand_spread00);
+ tolua_function(tolua_S,NULL,"randint",toluaI_z_pack_randint00);
+ tolua_function(tolua_S,NULL,"magik",toluaI_z_pack_magik00);
+ tolua_globalvar(tolua_S,"Rand_quick",toluaI_get_z_pack_Rand_quick,toluaI_set_z_pack_Rand_quick);
+ tolua_globalvar(tolua_S,"Rand_value",toluaI_get_z_pack_Rand_value,toluaI_set_z_pack_Rand_value);
+ tolua_function(tolua_S,NULL,"damroll",toluaI_z_pack_damroll00);
+ tolua_function(tolua_S,NULL,"maxroll",toluaI_z_pack_maxroll00);
+ return 1;
+}
+/* Close function */
+void tolua_z_pack_close (lua_State* tolua_S)
+{
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"rand_int");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"rand_range");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"rand_spread");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"randint");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"magik");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"Rand_quick"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"Rand_value"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"damroll");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"maxroll");
+}
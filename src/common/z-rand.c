@@ -127,6 +127,18 @@ void Rand_state_init(u32b seed) {
 #endif
 }
 
+/*
+ * Initialize the "complex" RNG from the seed alone, without mixing in
+ * /dev/urandom, so the same seed always gives the same sequence.
+ */
+void Rand_state_seed(u32b seed) {
+#ifdef USE_SFMT
+	init_gen_rand(seed);
+#else
+	Rand_state_init(seed);
+#endif
+}
+
 
 /*
  * Extract a "random" number from 0 to m-1, via "modulus"
@@ -82,6 +82,7 @@ extern u32b Rand_state[RAND_DEG];
 
 
 extern void Rand_state_init(u32b seed);
+extern void Rand_state_seed(u32b seed);
 extern s32b Rand_mod(s32b m);
 extern s32b Rand_div(s32b m);
 extern s16b randnor(int mean, int stand);
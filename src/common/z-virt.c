@@ -25,6 +25,17 @@ static mem_alloc_hook ralloc_aux;
 static mem_free_hook rnfree_aux;
 static mem_realloc_hook realloc_aux;
 
+/*
+ * Call site of the allocation in progress (see the macros in z-virt.h).
+ */
+cptr mem_site_file = NULL;
+int mem_site_line = 0;
+bool mem_site_string = FALSE;
+
+#undef mem_alloc
+#undef mem_realloc
+#undef string_make
+
 
 /*
  * Set the hooks for the memory system.
@@ -124,7 +135,9 @@ char *string_make(const char *str) {
 
 	/* Allocate space for the string (including terminator) */
 	siz = strlen(str) + 1;
+	mem_site_string = TRUE;
 	res = mem_alloc(siz);
+	mem_site_string = FALSE;
 
 	/* Copy the string (with terminator) */
 	memcpy(res, str, siz);
@@ -128,6 +128,12 @@ typedef void *(*mem_realloc_hook)(void *, size_t);
 /* Set up memory allocation hooks */
 bool mem_set_hooks(mem_alloc_hook alloc, mem_free_hook free, mem_realloc_hook realloc);
 
+/* Call site of the allocation in progress, for hooks that want to account
+   memory; 'mem_site_string' is set while string_make() allocates */
+extern cptr mem_site_file;
+extern int mem_site_line;
+extern bool mem_site_string;
+
 
 /**** Normal bits ***/
 
@@ -148,4 +154,9 @@ char *string_make(const char *str);
 char *string_free(char *str);
 #define string_free(X) mem_free((char *) X)
 
+/* Note the caller of each allocation */
+#define mem_alloc(L)		(mem_site_file = __FILE__, mem_site_line = __LINE__, (mem_alloc)(L))
+#define mem_realloc(P, L)	(mem_site_file = __FILE__, mem_site_line = __LINE__, (mem_realloc)(P, L))
+#define string_make(S)		(mem_site_file = __FILE__, mem_site_line = __LINE__, (string_make)(S))
+
 #endif /* INCLUDED_Z_VIRT_H */
@@ -0,0 +1,250 @@
+/* $Id$ */
+/* TomeNET tileset resize benchmark */
+
+/*
+ * Resizes tileset bitmaps (by default the ones shipped in lib/xtra/graphics)
+ * to a couple of font sizes with every interpolation type the X11 client
+ * offers ('graphic_resize_type' in .tomenetrc), and compares:
+ *
+ *  - the per-pixel floating point algorithm of main-x11.c's ResizeImage()
+ *    (without the XGetPixel()/XPutPixel() overhead, so it's a lower bound),
+ *  - resize_tileset() from graphics_common.c on one thread,
+ *  - resize_tileset() on all threads.
+ *
+ * It also reports how far the fixed-point result strays from the floating
+ * point one, which should never be more than a level or two per channel.
+ *
+ * Usage: tomenet.gfxbench [-n<runs>] [-t<threads>] [-f<wid>x<hgt>] [tileset.bmp ...]
+ * The tile size is taken from the file name like the client does ("16x24sv.bmp").
+ */
+
+#include <sys/time.h>
+#include <dirent.h>
+#include <strings.h>
+#include <math.h>
+
+#include "../common/h-basic.h"
+#include "../client/graphics_common.h"
+
+
+#define MAX_FONT_SIZES 8
+
+static int cfg_runs = 3, cfg_threads = 0;
+static int font_wid[MAX_FONT_SIZES] = { 8, 9, 12, 16, 20 }, font_hgt[MAX_FONT_SIZES] = { 13, 15, 24, 24, 30 }, font_sizes = 5;
+static bool font_sizes_given = FALSE;
+
+
+static double now_ms(void) {
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
+/* Read an uncompressed 24 or 32 bit BMP into planes */
+static int load_bmp(const char *name, rgb_planes *img) {
+	unsigned char head[54], *row;
+	int offset, width, height, bpp, stride, x, y, top_down;
+	FILE *fp;
+
+	if (!(fp = fopen(name, "rb"))) return(-1);
+	if (fread(head, 1, 54, fp) != 54 || head[0] != 'B' || head[1] != 'M') {
+		fclose(fp);
+		return(-1);
+	}
+	offset = head[10] | head[11] << 8 | head[12] << 16 | head[13] << 24;
+	width = head[18] | head[19] << 8 | head[20] << 16 | head[21] << 24;
+	height = head[22] | head[23] << 8 | head[24] << 16 | head[25] << 24;
+	bpp = head[28] | head[29] << 8;
+	top_down = (height < 0);
+	if (top_down) height = -height;
+	if ((bpp != 24 && bpp != 32) || width <= 0 || !height || rgb_planes_alloc(img, width, height)) {
+		fclose(fp);
+		return(-1);
+	}
+
+	stride = ((width * (bpp / 8)) + 3) & ~3;
+	row = malloc(stride);
+	fseek(fp, offset, SEEK_SET);
+	for (y = 0; y < height; y++) {
+		int ty = top_down ? y : height - 1 - y;
+
+		if (fread(row, 1, stride, fp) != (size_t)stride) break;
+		for (x = 0; x < width; x++) {
+			img->plane[0][ty * width + x] = row[x * (bpp / 8) + 2];
+			img->plane[1][ty * width + x] = row[x * (bpp / 8) + 1];
+			img->plane[2][ty * width + x] = row[x * (bpp / 8)];
+		}
+	}
+	free(row);
+	fclose(fp);
+	return(y == height ? 0 : -1);
+}
+
+static color_rgb plane_pixel(const rgb_planes *img, coordinates c) {
+	color_rgb rgb;
+	int i = c.y * img->width + c.x;
+
+	rgb.red = img->plane[0][i];
+	rgb.green = img->plane[1][i];
+	rgb.blue = img->plane[2][i];
+	return(rgb);
+}
+
+/* The per-pixel algorithm of main-x11.c (xInterpolationNear/Bilinear/Lanczos), on planes */
+static void resize_reference(const rgb_planes *src, rgb_planes *dst, int tile_w, int tile_h, int font_w, int font_h, int type) {
+	int w = font_w * src->width / tile_w, h = font_h * src->height / tile_h, x, y, sx, sy;
+	float widthRatio = (float)src->width / (float)w, heightRatio = (float)src->height / (float)h;
+	rectangle tile;
+	color_rgb rgb;
+
+	rgb_planes_alloc(dst, w, h);
+	for (y = 0; y < h; y++) {
+		float oy = (float)y * heightRatio;
+
+		for (x = 0; x < w; x++) {
+			float ox = (float)x * widthRatio;
+
+			tile.top_left.x = (x / font_w) * tile_w;
+			tile.top_left.y = (y / font_h) * tile_h;
+			tile.bottom_right.x = tile.top_left.x + tile_w - 1;
+			tile.bottom_right.y = tile.top_left.y + tile_h - 1;
+
+			if (type == INTERPOLATION_LINEAR) {
+				rgb = pixelBilinearInterpolation(ox - floor(ox), oy - floor(oy),
+				    plane_pixel(src, confineCoordinatesToRectangle(floor(ox), floor(oy), tile)),
+				    plane_pixel(src, confineCoordinatesToRectangle(ceil(ox), floor(oy), tile)),
+				    plane_pixel(src, confineCoordinatesToRectangle(floor(ox), ceil(oy), tile)),
+				    plane_pixel(src, confineCoordinatesToRectangle(ceil(ox), ceil(oy), tile)));
+			} else if (type == INTERPOLATION_LANCZOS) {
+				double r = 0.0, g = 0.0, b = 0.0, ws = 0.0, wt;
+
+				for (sy = (int)round(oy) - LANCZOS_A; sy <= (int)round(oy) + LANCZOS_A; sy++)
+					for (sx = (int)round(ox) - LANCZOS_A; sx <= (int)round(ox) + LANCZOS_A; sx++) {
+						color_rgb s = plane_pixel(src, confineCoordinatesToRectangle(sx, sy, tile));
+
+						wt = lanczosKernel(ox - sx, LANCZOS_A) * lanczosKernel(oy - sy, LANCZOS_A);
+						r += wt * s.red;
+						g += wt * s.green;
+						b += wt * s.blue;
+						ws += wt;
+					}
+				rgb.red = (int)fmin(r / ws, 255);
+				rgb.green = (int)fmin(g / ws, 255);
+				rgb.blue = (int)fmin(b / ws, 255);
+			} else rgb = plane_pixel(src, confineCoordinatesToRectangle(round(ox), round(oy), tile));
+
+			dst->plane[0][y * w + x] = rgb.red;
+			dst->plane[1][y * w + x] = rgb.green;
+			dst->plane[2][y * w + x] = rgb.blue;
+		}
+	}
+}
+
+static void bench_file(const char *name) {
+	rgb_planes src, ref, out;
+	int tile_w, tile_h, f, type, run, c, i, d, maxdiff;
+	double t, t_ref, t_one, t_all;
+	u64b sumdiff;
+	const char *base = strrchr(name, '/') ? strrchr(name, '/') + 1 : name;
+
+	if (sscanf(base, "%dx%d", &tile_w, &tile_h) != 2 || tile_w <= 0 || tile_h <= 0) {
+		printf("%s: can't tell the tile size from the file name\n", name);
+		return;
+	}
+	if (load_bmp(name, &src)) {
+		printf("%s: not a readable 24/32 bit BMP\n", name);
+		return;
+	}
+	printf("%s: %dx%d pixels, %dx%d tiles\n", base, src.width, src.height, src.width / tile_w, src.height / tile_h);
+	printf("  %-9s %-7s %10s %10s %10s %8s %8s\n", "type", "font", "reference", "1 thread", "threads", "maxdiff", "avgdiff");
+
+	for (f = 0; f < font_sizes; f++) {
+		for (type = 0; type < INTERPOLATION_TYPES_COUNT; type++) {
+			t = now_ms();
+			resize_reference(&src, &ref, tile_w, tile_h, font_wid[f], font_hgt[f], type);
+			t_ref = now_ms() - t;
+
+			resize_threads = 1;
+			t = now_ms();
+			for (run = 0; run < cfg_runs; run++) {
+				if (run) rgb_planes_free(&out);
+				resize_tileset(&src, &out, tile_w, tile_h, font_wid[f], font_hgt[f], type);
+			}
+			t_one = (now_ms() - t) / cfg_runs;
+			rgb_planes_free(&out);
+
+			resize_threads = cfg_threads;
+			t = now_ms();
+			for (run = 0; run < cfg_runs; run++) {
+				if (run) rgb_planes_free(&out);
+				resize_tileset(&src, &out, tile_w, tile_h, font_wid[f], font_hgt[f], type);
+			}
+			t_all = (now_ms() - t) / cfg_runs;
+
+			for (maxdiff = 0, sumdiff = 0, c = 0; c < 3; c++)
+				for (i = 0; i < out.width * out.height; i++) {
+					d = abs(out.plane[c][i] - ref.plane[c][i]);
+					if (d > maxdiff) maxdiff = d;
+					sumdiff += d;
+				}
+
+			printf("  %-9s %3dx%-3d %8.1fms %8.1fms %8.1fms %8d %8.3f\n", interpolation_list[type].name,
+			    font_wid[f], font_hgt[f], t_ref, t_one, t_all, maxdiff, (double)sumdiff / (3.0 * out.width * out.height));
+
+			rgb_planes_free(&out);
+			rgb_planes_free(&ref);
+		}
+	}
+	rgb_planes_free(&src);
+}
+
+int main(int argc, char **argv) {
+	char path[1024];
+	const char *dir_name = "lib/xtra/graphics";
+	struct dirent *de;
+	DIR *dir;
+	int i, files = 0;
+
+	for (i = 1; i < argc; i++) {
+		if (argv[i][0] != '-') continue;
+		switch (argv[i][1]) {
+		case 'n': cfg_runs = MAX(1, atoi(argv[i] + 2)); break;
+		case 't': cfg_threads = atoi(argv[i] + 2); break;
+		case 'f':
+			if (!font_sizes_given) font_sizes = 0;
+			font_sizes_given = TRUE;
+			if (font_sizes < MAX_FONT_SIZES && sscanf(argv[i] + 2, "%dx%d", &font_wid[font_sizes], &font_hgt[font_sizes]) == 2
+			    && font_wid[font_sizes] > 0 && font_hgt[font_sizes] > 0)
+				font_sizes++;
+			break;
+		default:
+			printf("Usage: %s [-n<runs>] [-t<threads>] [-f<wid>x<hgt>] [tileset.bmp ...]\n", argv[0]);
+			printf("  -n<runs>      Average the fixed-point timings over this many runs (3)\n");
+			printf("  -t<threads>   Threads for the multi-threaded run, 0 = one per CPU (0)\n");
+			printf("  -f<wid>x<hgt> Font size to resize to, can be given up to %d times\n", MAX_FONT_SIZES);
+			printf("Without files, all tilesets in lib/xtra/graphics are used.\n");
+			return(1);
+		}
+	}
+
+	for (i = 1; i < argc; i++) {
+		if (argv[i][0] == '-') continue;
+		bench_file(argv[i]);
+		files++;
+	}
+	if (files) return(0);
+
+	/* Run from the top level directory like the client, or from src/ */
+	if (!(dir = opendir(dir_name)) && !(dir = opendir(dir_name = "../lib/xtra/graphics"))) {
+		printf("No tileset files given and lib/xtra/graphics not found.\n");
+		return(1);
+	}
+	while ((de = readdir(dir))) {
+		if (strlen(de->d_name) < 5 || strcasecmp(de->d_name + strlen(de->d_name) - 4, ".bmp")) continue;
+		snprintf(path, sizeof(path), "%s/%s", dir_name, de->d_name);
+		bench_file(path);
+	}
+	closedir(dir);
+	return(0);
+}
@@ -0,0 +1,1615 @@
+/* $Id$ */
+/* TomeNET load generator */
+
+/*
+ * Runs many scripted player sessions from a single process against a
+ * (local) server, so server changes can be benchmarked without waiting
+ * for a busy night on a live server.
+ *
+ * Every bot is a complete, if blind, client: it performs the normal
+ * contact/verify/setup/login/play handshake (creating its character on
+ * the first run and reusing it afterwards), then walks, fights, chats
+ * or takes stairs according to its behaviour while pinging the server.
+ *
+ * The client's nclient.c keeps all connection state in globals and
+ * drags in the whole terminal/sound front-end, so it can't drive more
+ * than one session.  Instead this file mirrors the packet formats of
+ * the client's Receive_*() handlers in a table that is only used to
+ * step over packets we don't care about.  Keep it in sync when the
+ * protocol changes -- an unknown packet type is reported as a desync.
+ *
+ * The same table decodes the capture files the server writes for
+ * connections an admin is capturing (/capture): -D breaks a capture's
+ * traffic down by packet type, -R has every bot send the captured
+ * client input (from entering the game on) at its original pace.
+ */
+
+#include <sys/time.h>
+#include <poll.h>
+#include <signal.h>
+#include <time.h>
+#include <ctype.h>
+
+#include "../common/h-basic.h"
+#include "../common/z-util.h"
+#include "../common/z-virt.h"
+#include "../common/z-form.h"
+#include "../config.h"
+#include "../common/defines.h"
+#include "../common/pack.h"
+#include "../common/sockbuf.h"
+#include "../common/net-unix.h"
+
+
+/* Required by the common code */
+bool is_client_side = TRUE;
+bool rl_connection_destructible = FALSE, rl_connection_destroyed = FALSE, rl_connection_state = FALSE;
+
+
+#define LOADGEN_RECV_SIZE	65536
+#define LOADGEN_SEND_SIZE	32768
+
+#define MAX_BOTS		1000
+#define MAX_SCR_HGT		64	/* Map rows we keep track of */
+#define MAX_SCR_WID		80
+
+#define HANDSHAKE_TIMEOUT	15	/* Seconds until a login attempt is given up */
+#define RECONNECT_DELAY		2	/* Seconds before a disconnected bot logs in again */
+
+/* RTT histogram: 100us buckets up to 10s */
+#define RTT_BUCKET_US		100
+#define RTT_BUCKETS		100000
+
+#define MAX_DISC_REASONS	16
+
+
+/* Bot connection states */
+#define BOT_OFF			0	/* Not connected, waiting for next_connect */
+#define BOT_CONTACT		1	/* Sent contact info, waiting for reply */
+#define BOT_VERIFY		2	/* Sent PKT_VERIFY, waiting for reply and magic */
+#define BOT_SETUP		3	/* Waiting for the setup data */
+#define BOT_CHARLIST		4	/* Sent first PKT_LOGIN, waiting for the character list */
+#define BOT_LOGIN		5	/* Sent PKT_LOGIN with our name, waiting for the status code */
+#define BOT_START		6	/* Sent PKT_PLAY, waiting for the reply */
+#define BOT_PLAYING		7
+
+/* Bot behaviours */
+#define BEH_WALK		0	/* Wander around, sometimes running */
+#define BEH_FIGHT		1	/* Walk into the nearest monster */
+#define BEH_CHAT		2	/* Wander around and talk every now and then */
+#define BEH_STAIRS		3	/* Head for the nearest staircase and take it */
+#define BEH_MAX			4
+
+static cptr beh_name[BEH_MAX] = { "walk", "fight", "chat", "stairs" };
+
+/* Keypad direction of a step by (dx, dy), indexed [dy + 1][dx + 1] */
+static const char step_dir[3][3] = {
+	{ 7, 8, 9 },
+	{ 4, 5, 6 },
+	{ 1, 2, 3 },
+};
+
+
+typedef struct bot_type bot_type;
+struct bot_type {
+	int id;
+	int state;
+	int behaviour;
+	char name[MAX_CHARS];
+
+	sockbuf_t r, w;			/* fd is r.sock; w.sock is the same */
+
+	u64b next_connect;		/* When we try to (re)connect */
+	u64b login_start;		/* When we started the current handshake */
+	u64b next_action;
+	u64b next_ping;
+
+	byte last_type;			/* Last packet type read, for desync reports */
+	int ping_id;
+	int actions;			/* Actions since login */
+	int heading;			/* Current wandering direction */
+	int heading_left;		/* Steps until we pick a new heading */
+	bool created;			/* Character was created on this login */
+
+	s16b wx, wy, wz;		/* Last known world position */
+	bool got_depth;
+
+	int tx, ty;			/* Staircase we are heading for, or -1 */
+	byte tc;			/* ..and its symbol */
+
+	byte scr_c[MAX_SCR_HGT][MAX_SCR_WID];
+	byte scr_a[MAX_SCR_HGT][MAX_SCR_WID];
+
+	int replay_next;		/* Next capture chunk to send (-R) */
+	u64b replay_start;		/* When we started (or looped) the replay */
+};
+
+/* Counters of one reporting interval, and of the whole run */
+typedef struct lg_stats lg_stats;
+struct lg_stats {
+	u64b rx, tx;			/* Bytes */
+	u32b logins, creates, reuses;
+	u32b disconnects, desyncs;
+	u32b level_changes, actions;
+	u32b pings, pongs;
+	u32b rtt[RTT_BUCKETS];
+	u32b rtt_max;			/* In microseconds */
+};
+
+
+/* Options */
+static char server_name[MAX_CHARS] = "127.0.0.1";
+static int cfg_port = 18348;
+static int cfg_bots = 10;
+static int cfg_duration = 60;		/* Seconds, 0 for no limit */
+static int cfg_ramp = 100;		/* Milliseconds between initial logins */
+static int cfg_action = 250;		/* Milliseconds between actions */
+static int cfg_ping = 1000;		/* Milliseconds between pings */
+static int cfg_report = 5;		/* Seconds between report lines */
+static int cfg_chat = 20;		/* Chat bots talk every this many actions */
+static bool cfg_reconnect = TRUE;
+static char cfg_name[2] = "B";
+static char cfg_pass[MAX_CHARS] = "loadgen";
+static int cfg_mix[BEH_MAX] = { 40, 30, 10, 20 };
+static char cfg_replay[1024];
+
+static bot_type *bots;
+static lg_stats st_int, st_all;
+
+static char disc_reason[MAX_DISC_REASONS][MAX_CHARS];
+static u32b disc_count[MAX_DISC_REASONS];
+
+/* Client -> server format of the various stream packets, by type */
+static cptr pkt_fmt[256];
+static cptr pkt_name[256];
+
+/* A capture file (-D, -R) */
+typedef struct cap_chunk cap_chunk;
+struct cap_chunk {
+	u64b when;			/* usec after the character entered the game */
+	char *data;
+	int len;
+};
+static char *cap_buf;
+static long cap_size;
+static cap_chunk *replay;		/* Client input to replay */
+static int replay_chunks;
+
+static volatile sig_atomic_t stop = 0;
+static u64b lg_start;			/* When we started */
+
+
+static u64b now_usec(void) {
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return((u64b)tv.tv_sec * 1000000 + tv.tv_usec);
+}
+
+static void handle_signal(int sig) {
+	(void)sig;
+	stop = 1;
+}
+
+
+/*
+ * Statistics
+ */
+
+static void stats_rtt(u32b us) {
+	u32b b = us / RTT_BUCKET_US;
+
+	if (b >= RTT_BUCKETS) b = RTT_BUCKETS - 1;
+	st_int.rtt[b]++;
+	st_all.rtt[b]++;
+	st_int.pongs++;
+	st_all.pongs++;
+	if (us > st_int.rtt_max) st_int.rtt_max = us;
+	if (us > st_all.rtt_max) st_all.rtt_max = us;
+}
+
+/* RTT percentile in milliseconds (upper edge of the bucket) */
+static double stats_pct(lg_stats *s, int pct) {
+	u32b want, seen = 0;
+	int b;
+
+	if (!s->pongs) return(0.0);
+	want = (u32b)(((u64b)s->pongs * pct + 99) / 100);
+	for (b = 0; b < RTT_BUCKETS; b++) {
+		seen += s->rtt[b];
+		if (seen >= want) break;
+	}
+	return((b + 1) * RTT_BUCKET_US / 1000.0);
+}
+
+#define STAT_LOGIN	0
+#define STAT_CREATE	1
+#define STAT_REUSE	2
+#define STAT_LEVEL	3
+#define STAT_ACTION	4
+#define STAT_PING	5
+#define STAT_DESYNC	6
+
+static void stats_add(int what, u32b n) {
+	switch (what) {
+	case STAT_LOGIN: st_int.logins += n; st_all.logins += n; break;
+	case STAT_CREATE: st_int.creates += n; st_all.creates += n; break;
+	case STAT_REUSE: st_int.reuses += n; st_all.reuses += n; break;
+	case STAT_LEVEL: st_int.level_changes += n; st_all.level_changes += n; break;
+	case STAT_ACTION: st_int.actions += n; st_all.actions += n; break;
+	case STAT_PING: st_int.pings += n; st_all.pings += n; break;
+	case STAT_DESYNC: st_int.desyncs += n; st_all.desyncs += n; break;
+	}
+}
+
+static void stats_line(cptr prefix, lg_stats *s, double secs) {
+	int i, playing = 0;
+
+	for (i = 0; i < cfg_bots; i++)
+		if (bots[i].state == BOT_PLAYING) playing++;
+
+	if (secs <= 0.0) secs = 1.0;
+	printf("%s %3d/%d playing  rtt p50 %.1f p90 %.1f p99 %.1f max %.1f ms (%u/%u)  rx %.1f tx %.2f kB/s  act %.0f/s  lvl %u  login %u  disc %u  desync %u\n",
+	    prefix, playing, cfg_bots,
+	    stats_pct(s, 50), stats_pct(s, 90), stats_pct(s, 99), s->rtt_max / 1000.0, s->pongs, s->pings,
+	    s->rx / 1024.0 / secs, s->tx / 1024.0 / secs, s->actions / secs,
+	    s->level_changes, s->logins, s->disconnects, s->desyncs);
+	fflush(stdout);
+}
+
+static void stats_summary(double secs) {
+	int i;
+
+	printf("\n--- %d bots, %.0f seconds against %s:%d ---\n", cfg_bots, secs, server_name, cfg_port);
+	stats_line("total", &st_all, secs);
+	printf("logins %u (%u characters created, %u reused), actions %u, level changes %u\n",
+	    st_all.logins, st_all.creates, st_all.reuses, st_all.actions, st_all.level_changes);
+	printf("rx %llu bytes, tx %llu bytes\n", (unsigned long long)st_all.rx, (unsigned long long)st_all.tx);
+	if (!st_all.disconnects) return;
+	printf("disconnects %u:\n", st_all.disconnects);
+	for (i = 0; i < MAX_DISC_REASONS && disc_count[i]; i++)
+		printf("  %6u  %s\n", disc_count[i], disc_reason[i]);
+}
+
+
+/*
+ * Connection handling
+ */
+
+static void bot_disconnect(bot_type *b, cptr reason) {
+	char why[MAX_CHARS];
+	int i;
+
+	if (b->state == BOT_OFF) return;
+
+	/* Count distinct reasons; the last slot collects the rest */
+	strnfmt(why, MAX_CHARS, "%s", reason);
+	for (i = 0; i < MAX_DISC_REASONS - 1 && disc_count[i]; i++)
+		if (streq(disc_reason[i], why)) break;
+	if (!disc_count[i]) strcpy(disc_reason[i], i == MAX_DISC_REASONS - 1 ? "(other)" : why);
+	disc_count[i]++;
+	st_int.disconnects++;
+	st_all.disconnects++;
+
+	if (b->r.sock != -1) close(b->r.sock);
+	b->r.sock = b->w.sock = -1;
+	Sockbuf_clear(&b->r);
+	Sockbuf_clear(&b->w);
+	b->state = BOT_OFF;
+	b->next_connect = cfg_reconnect ? now_usec() + RECONNECT_DELAY * 1000000ULL : (u64b)-1;
+}
+
+static int bot_flush(bot_type *b) {
+	int n;
+
+	if (b->w.len <= 0) return(0);
+	if ((n = Sockbuf_flush(&b->w)) == -1) {
+		bot_disconnect(b, "write error");
+		return(-1);
+	}
+	st_int.tx += n;
+	st_all.tx += n;
+	return(0);
+}
+
+static void bot_connect(bot_type *b) {
+	int fd;
+
+	b->next_connect = (u64b)-1;
+	if ((fd = CreateClientSocket(server_name, cfg_port)) == -1) {
+		/* Pretend we were connected, for the statistics */
+		b->state = BOT_CONTACT;
+		b->r.sock = -1;
+		bot_disconnect(b, "can't connect");
+		return;
+	}
+	SetSocketNoDelay(fd, 1);
+	SetSocketNonBlocking(fd, 1);
+
+	b->r.sock = b->w.sock = fd;
+	Sockbuf_clear(&b->r);
+	Sockbuf_clear(&b->w);
+	b->state = BOT_CONTACT;
+	b->login_start = now_usec();
+	b->got_depth = FALSE;
+	b->actions = 0;
+	b->heading = 0;
+	b->heading_left = 0;
+	b->tx = b->ty = -1;
+	memset(b->scr_c, 0, sizeof(b->scr_c));
+	memset(b->scr_a, 0, sizeof(b->scr_a));
+
+	/* Contact info, as sent by the client in c-init.c */
+	Packet_printf(&b->w, "%u", 12345);
+	Packet_printf(&b->w, "%s%hu%c", "loadgen", GetPortNum(fd), 0xFF);
+	Packet_printf(&b->w, "%s%s%hu", b->name, "localhost", 0xFFFF);
+	Packet_printf(&b->w, "%d%d%d%d%d%d", VERSION_MAJOR, VERSION_MINOR, VERSION_PATCH, VERSION_EXTRA, VERSION_BRANCH,
+	    VERSION_BUILD + (VERSION_OS + VERSION_OS_SUB * 100) * 1000000);
+	bot_flush(b);
+}
+
+/* Send PKT_PLAY with a fixed human warrior and no custom visuals */
+static void bot_send_play(bot_type *b) {
+	static const s16b stat_val[6] = { 17, 10, 10, 14, 14, 10 };
+	int i;
+
+	Packet_printf(&b->w, "%c", PKT_PLAY);
+	Packet_printf(&b->w, "%hd%hd%hd%hd%hd%hd%hd%s%s", MODE_MALE, 0, 0, 0, 0, 0, 0, "NO_GRAPHICS", "");
+	/* Point-based stats, within the 30 points player_birth() allows */
+	for (i = 0; i < 6; i++) Packet_printf(&b->w, "%hd", stat_val[i]);
+
+	/* Options: only hilite_player (45), which lets us find ourselves on the map */
+	for (i = 0; i < OPT_MAX; i++) Packet_printf(&b->w, "%c", i == 45 ? 1 : 0);
+
+	Packet_printf(&b->w, "%d%d", SCREEN_WID, SCREEN_HGT);
+
+	/* No visual redefinitions, so the server sends 1-byte characters */
+	for (i = 0; i < TV_MAX + MAX_F_IDX + MAX_K_IDX + MAX_R_IDX; i++)
+		Packet_printf(&b->w, "%c%u", 0, 0);
+	bot_flush(b);
+}
+
+
+/*
+ * Handshake; each returns 1 when done, 0 when more data is needed
+ * and -1 when the bot got disconnected.
+ */
+
+static int recv_contact(bot_type *b) {
+	char *start = b->r.ptr, reply_to, status;
+	int login_port, flags, ver[6];
+
+	if (Packet_scanf(&b->r, "%c%c%d%d", &reply_to, &status, &login_port, &flags) <= 0) return(0);
+	if ((flags & 0x02) && Packet_scanf(&b->r, "%d%d%d%d%d%d", &ver[0], &ver[1], &ver[2], &ver[3], &ver[4], &ver[5]) <= 0) {
+		b->r.ptr = start;
+		return(0);
+	}
+	if (status && status != E_NEED_INFO) {
+		bot_disconnect(b, format("contact refused (error %d)", status));
+		return(-1);
+	}
+
+	/* The password is sent obfuscated, see my_memfrob() */
+	{
+		char pass[MAX_CHARS];
+		int i;
+
+		strcpy(pass, cfg_pass);
+		for (i = 0; pass[i]; i++) pass[i] ^= 42;
+		Packet_printf(&b->w, "%c%s%s%s", PKT_VERIFY, "loadgen", b->name, pass);
+	}
+	b->state = BOT_VERIFY;
+	bot_flush(b);
+	return(1);
+}
+
+/* Refused by the server?  The reason is a plain string after PKT_QUIT */
+static int recv_refused(bot_type *b) {
+	if (b->r.ptr[0] != PKT_QUIT && b->r.ptr[0] != (char)PKT_RELOGIN) return(0);
+	if (!memchr(b->r.ptr, '\0', b->r.buf + b->r.len - b->r.ptr)) return(1);
+	bot_disconnect(b, b->r.ptr + 1);
+	return(-1);
+}
+
+static int recv_verify(bot_type *b) {
+	char *start = b->r.ptr, ch, type, result;
+	unsigned magic;
+	int n;
+
+	if ((n = recv_refused(b))) return(n < 0 ? -1 : 0);
+	if (Packet_scanf(&b->r, "%c%c%c", &ch, &type, &result) <= 0) return(0);
+	if (Packet_scanf(&b->r, "%c%u", &ch, &magic) <= 0) {
+		b->r.ptr = start;
+		return(0);
+	}
+	if (type != PKT_VERIFY || result != PKT_SUCCESS) {
+		bot_disconnect(b, format("verify failed (%d)", result));
+		return(-1);
+	}
+	b->state = BOT_SETUP;
+	return(1);
+}
+
+/* The setup data is only skipped, it is one block so we parse it in one go */
+static int recv_setup(bot_type *b) {
+	char *start = b->r.ptr, str[MAX_CHARS], c[6], max_race, max_class, max_trait;
+	int motd_len, setup_size, choice, i;
+	s16b fps;
+
+	if (Packet_scanf(&b->r, "%d%hd%c%c%c%d", &motd_len, &fps, &max_race, &max_class, &max_trait, &setup_size) <= 0) goto incomplete;
+	for (i = 0; i < (byte)max_race; i++)
+		if (Packet_scanf(&b->r, "%c%c%c%c%c%c%s%d", &c[0], &c[1], &c[2], &c[3], &c[4], &c[5], str, &choice) <= 0) goto incomplete;
+	for (i = 0; i < (byte)max_class; i++)
+		if (Packet_scanf(&b->r, "%c%c%c%c%c%c%s", &c[0], &c[1], &c[2], &c[3], &c[4], &c[5], str) <= 0 ||
+		    Packet_scanf(&b->r, "%c%c%c%c%c%c", &c[0], &c[1], &c[2], &c[3], &c[4], &c[5]) <= 0) goto incomplete;
+	for (i = 0; i < (byte)max_trait; i++)
+		if (Packet_scanf(&b->r, "%s%d", str, &choice) <= 0) goto incomplete;
+	if (b->r.buf + b->r.len - b->r.ptr < motd_len) goto incomplete;
+	b->r.ptr += motd_len;
+
+	/* Ask for the character list */
+	Packet_printf(&b->w, "%c%s", PKT_LOGIN, "");
+	Packet_printf(&b->w, "%c%c%c%c%c%c", 0, 0, 0, 0, 0, 0);
+	b->state = BOT_CHARLIST;
+	bot_flush(b);
+	return(1);
+
+	incomplete:
+	b->r.ptr = start;
+	return(0);
+}
+
+static int recv_charlist(bot_type *b) {
+	char *start = b->r.ptr, ch, colour[MAX_CHARS], c_name[MAX_CHARS], loc[MAX_CHARS];
+	int sflags[4];
+	s16b mode, level, c_race, c_class;
+
+	int n;
+
+	if ((n = recv_refused(b))) return(n < 0 ? -1 : 0);
+	if (Packet_scanf(&b->r, "%c%d%d%d%d", &ch, &sflags[3], &sflags[2], &sflags[1], &sflags[0]) <= 0) goto incomplete;
+	for (;;) {
+		if (Packet_scanf(&b->r, "%c%hd%s%s%hd%hd%hd%s", &ch, &mode, colour, c_name, &level, &c_race, &c_class, loc) <= 0) goto incomplete;
+		if (!c_name[0]) break;
+	}
+
+	Packet_printf(&b->w, "%c%s", PKT_LOGIN, b->name);
+	b->state = BOT_LOGIN;
+	bot_flush(b);
+	return(1);
+
+	incomplete:
+	b->r.ptr = start;
+	return(0);
+}
+
+static int recv_login(bot_type *b) {
+	char status;
+
+	int n;
+
+	if ((n = recv_refused(b))) return(n < 0 ? -1 : 0);
+	if (Packet_scanf(&b->r, "%c", &status) <= 0) return(0);
+	if (status && status != E_NEED_INFO) {
+		bot_disconnect(b, format("login refused (error %d)", status));
+		return(-1);
+	}
+	b->created = (status == E_NEED_INFO);
+	bot_send_play(b);
+	b->state = BOT_START;
+	return(1);
+}
+
+static int recv_start(bot_type *b) {
+	char ch, type, result;
+
+	int n;
+
+	if ((n = recv_refused(b))) return(n < 0 ? -1 : 0);
+	if (Packet_scanf(&b->r, "%c%c%c", &ch, &type, &result) <= 0) return(0);
+	if (ch != PKT_REPLY || type != PKT_PLAY || result != PKT_SUCCESS) {
+		bot_disconnect(b, format("play refused (%d,%d,%d)", ch, type, result));
+		return(-1);
+	}
+
+	b->state = BOT_PLAYING;
+	b->next_action = now_usec() + cfg_action * 1000ULL;
+	b->next_ping = now_usec();
+	b->replay_next = 0;
+	b->replay_start = now_usec();
+	stats_add(STAT_LOGIN, 1);
+	stats_add(b->created ? STAT_CREATE : STAT_REUSE, 1);
+	return(1);
+}
+
+
+/*
+ * Play stream.  Packets that need more than a fixed format have their
+ * own handler; all others are stepped over using pkt_fmt[].
+ * Handlers return 1 if a packet was consumed, 0 if it is incomplete
+ * (leaving the read pointer where it was) and -1 on disconnection.
+ */
+
+static int pkt_skip(sockbuf_t *rb, cptr fmt) {
+	char *p = rb->ptr, *end = rb->buf + rb->len;
+	int max, k;
+
+	for (; *fmt; fmt++) {
+		if (*fmt != '%') continue;
+		switch (*++fmt) {
+		case 'c': p += 1; break;
+		case 'h': fmt++; p += 2; break;
+		case 'd':
+		case 'u': p += 4; break;
+		case 's':
+		case 'S':
+		case 'I':
+			max = (*fmt == 'S') ? MSG_LEN : ((*fmt == 'I') ? ONAME_LEN : MAX_CHARS);
+			for (k = 1; ; k++) {
+				if (p >= end) return(0);
+				if (*p++ == '\0' || k >= max) break;
+			}
+			break;
+		}
+		if (p > end) return(0);
+	}
+	rb->ptr = p;
+	return(1);
+}
+
+/* Map rows are remembered by the bot 'b', if there is one */
+static int recv_line_info(sockbuf_t *rb, bot_type *b) {
+	char *start = rb->ptr, ch;
+	byte c, a, rep;
+	s16b y;
+	int x, i, n;
+
+	if ((n = Packet_scanf(rb, "%c%hd", &ch, &y)) <= 0) return(n);
+
+	/* End of the mini-map */
+	if (ch == PKT_MINI_MAP && y == -1) return(1);
+
+	for (x = 0; x < MAX_SCR_WID; x++) {
+		if ((n = Packet_scanf(rb, "%c%c", &c, &a)) <= 0) goto rollback;
+		if (a == TERM_RESERVED_RLE) {
+			if ((n = Packet_scanf(rb, "%c%c", &a, &rep)) <= 0) goto rollback;
+		} else rep = 1;
+
+		if (b && ch == PKT_LINE_INFO && y >= 0 && y < MAX_SCR_HGT)
+			for (i = 0; i < rep && x + i < MAX_SCR_WID; i++) {
+				b->scr_c[y][x + i] = c;
+				b->scr_a[y][x + i] = a;
+			}
+		x += rep - 1;
+	}
+	return(1);
+
+	rollback:
+	rb->ptr = start;
+	return(n);
+}
+
+static int recv_char(bot_type *b) {
+	char ch;
+	byte x, y, a, c;
+	int n;
+
+	if ((n = Packet_scanf(&b->r, "%c%c%c%c%c", &ch, &x, &y, &a, &c)) <= 0) return(n);
+	if (y < MAX_SCR_HGT && x < MAX_SCR_WID) {
+		b->scr_c[y][x] = c;
+		b->scr_a[y][x] = a;
+	}
+	return(1);
+}
+
+static int recv_depth(bot_type *b) {
+	char ch, town, colour, colour_sector, name[MAX_CHARS], name2[MAX_CHARS], pre[MAX_CHARS];
+	u16b x, y, z;
+	int n;
+
+	if ((n = Packet_scanf(&b->r, "%c%hu%hu%hu%c%c%c%s%s%s", &ch, &x, &y, &z, &town, &colour, &colour_sector, name, name2, pre)) <= 0) return(n);
+	if (b->got_depth && (b->wx != (s16b)x || b->wy != (s16b)y || b->wz != (s16b)z)) {
+		stats_add(STAT_LEVEL, 1);
+
+		/* New map; whatever we remember is stale */
+		memset(b->scr_c, 0, sizeof(b->scr_c));
+		b->tx = b->ty = -1;
+	}
+	b->wx = x;
+	b->wy = y;
+	b->wz = z;
+	b->got_depth = TRUE;
+	return(1);
+}
+
+static int recv_ping(bot_type *b) {
+	char ch, pong, buf[MSG_LEN];
+	int n, id, tim, utim;
+	u64b sent;
+
+	if ((n = Packet_scanf(&b->r, "%c%c%d%d%d%S", &ch, &pong, &id, &tim, &utim, buf)) <= 0) return(n);
+	if (pong) {
+		sent = (u64b)(u32b)tim * 1000000 + (u32b)utim;
+
+		/* Pings replayed from a capture (-R) are answered too, but are older than us */
+		if (sent < lg_start) return(1);
+		stats_rtt((u32b)(now_usec() - sent));
+	} else {
+		/* Server wants to hear back */
+		Packet_printf(&b->w, "%c%c%d%d%d%S", PKT_PING, 1, id, tim, utim, buf);
+	}
+	return(1);
+}
+
+static int recv_quit(bot_type *b) {
+	char ch, reason[MAX_CHARS], s[MAX_CHARS];
+	int n;
+
+	if (b->r.ptr[0] == (char)PKT_RELOGIN) {
+		if ((n = Packet_scanf(&b->r, "%c%s%s%s%s%s%c", &ch, reason, s, s, s, s, &ch)) <= 0) return(n);
+	} else if ((n = Packet_scanf(&b->r, "%c%s", &ch, reason)) <= 0) return(n);
+	bot_disconnect(b, reason);
+	return(-1);
+}
+
+static int skip_file(sockbuf_t *rb, char *command, s16b *fnum) {
+	char *start = rb->ptr, ch, str[MAX_CHARS];
+	s16b len;
+	unsigned sum[4];
+	int n = 1;
+
+	if ((n = Packet_scanf(rb, "%c%c%hd", &ch, command, fnum)) <= 0) return(n);
+	switch (*command) {
+	case PKT_FILE_INIT:
+	case PKT_FILE_CHECK:
+		n = Packet_scanf(rb, "%s", str);
+		break;
+	case PKT_FILE_DATA:
+		if ((n = Packet_scanf(rb, "%hd", &len)) <= 0) break;
+		if (rb->buf + rb->len - rb->ptr < len) n = 0;
+		else rb->ptr += len;
+		break;
+	case PKT_FILE_SUM:
+		n = Packet_scanf(rb, "%u%u%u%u", &sum[0], &sum[1], &sum[2], &sum[3]);
+		break;
+	}
+	if (n <= 0) rb->ptr = start;
+	return(n);
+}
+
+static int recv_file(bot_type *b) {
+	char command;
+	s16b fnum;
+	int n;
+
+	if ((n = skip_file(&b->r, &command, &fnum)) <= 0) return(n);
+
+	/* We don't want any files, thank you */
+	if (command == PKT_FILE_INIT || command == PKT_FILE_DATA || command == PKT_FILE_END)
+		Packet_printf(&b->w, "%c%c%hd", PKT_FILE, PKT_FILE_ERR, fnum);
+	return(1);
+}
+
+static int skip_weather(sockbuf_t *rb) {
+	char *start = rb->ptr, ch;
+	int w[8], i, n, clouds;
+
+	if ((n = Packet_scanf(rb, "%c%d%d%d%d%d%d%d%d", &ch, &w[0], &w[1], &w[2], &w[3], &w[4], &w[5], &w[6], &w[7])) <= 0) return(n);
+	clouds = (w[7] >= 0) ? w[7] : (w[7] == -1 ? 0 : 10);
+	for (i = 0; i < clouds; i++)
+		if (!pkt_skip(rb, "%d%d%d%d%d%d%d%d")) {
+			rb->ptr = start;
+			return(0);
+		}
+	return(1);
+}
+
+static int skip_guild_cfg(sockbuf_t *rb) {
+	char *start = rb->ptr, ch;
+	int master, flags, minlev, adders, hx, hy, ghp, i, n;
+
+	if ((n = Packet_scanf(rb, "%c%d%d%d%d%d%d%d", &ch, &master, &flags, &minlev, &adders, &hx, &hy, &ghp)) <= 0) return(n);
+	for (i = 0; i < adders; i++)
+		if (!pkt_skip(rb, "%s")) {
+			rb->ptr = start;
+			return(0);
+		}
+	return(1);
+}
+
+static int skip_playerlist(sockbuf_t *rb) {
+	char *start = rb->ptr, ch, name[MAX_CHARS], line[ONAME_LEN];
+	int mode, n;
+
+	if ((n = Packet_scanf(rb, "%c%d", &ch, &mode)) <= 0) return(n);
+	switch (mode) {
+	case 1:
+		do {
+			if ((n = Packet_scanf(rb, "%s%I", name, line)) <= 0) break;
+		} while (name[0]);
+		break;
+	case 2:
+		n = Packet_scanf(rb, "%s%I", name, line);
+		break;
+	case 3:
+		n = Packet_scanf(rb, "%s", name);
+		break;
+	}
+	if (n <= 0) {
+		rb->ptr = start;
+		return(n);
+	}
+	return(1);
+}
+
+/* Packets that pkt_step() doesn't step over by format */
+static bool pkt_special(byte type) {
+	switch (type) {
+	case PKT_LINE_INFO:
+	case PKT_MINI_MAP:
+	case PKT_FILE:
+	case PKT_WEATHER:
+	case PKT_GUILD_CFG:
+	case PKT_PLAYERLIST:	return(TRUE);
+	}
+	return(FALSE);
+}
+
+/* Step over one packet without acting on it (-D), -1 for an unknown type */
+static int pkt_step(sockbuf_t *rb) {
+	byte type = (byte)rb->ptr[0];
+	char command;
+	s16b fnum;
+
+	switch (type) {
+	case PKT_LINE_INFO:
+	case PKT_MINI_MAP:	return(recv_line_info(rb, NULL));
+	case PKT_FILE:		return(skip_file(rb, &command, &fnum));
+	case PKT_WEATHER:	return(skip_weather(rb));
+	case PKT_GUILD_CFG:	return(skip_guild_cfg(rb));
+	case PKT_PLAYERLIST:	return(skip_playerlist(rb));
+	}
+	if (!pkt_fmt[type]) return(-1);
+	return(pkt_skip(rb, pkt_fmt[type]));
+}
+
+static int recv_play_aux(bot_type *b, byte type) {
+	int n;
+
+	switch (type) {
+	case PKT_LINE_INFO:
+	case PKT_MINI_MAP:	return(recv_line_info(&b->r, b));
+	case PKT_CHAR:
+	case PKT_CHAR_DIRECT:	return(recv_char(b));
+	case PKT_DEPTH:		return(recv_depth(b));
+	case PKT_PING:		return(recv_ping(b));
+	case PKT_QUIT:
+	case PKT_RELOGIN:	return(recv_quit(b));
+	case PKT_FILE:		return(recv_file(b));
+	}
+	if ((n = pkt_step(&b->r)) == -1) {
+		stats_add(STAT_DESYNC, 1);
+		printf("%s: desync at unknown packet type %d after type %d (%d bytes pending)\n",
+		    b->name, type, b->last_type, (int)(b->r.buf + b->r.len - b->r.ptr));
+		bot_disconnect(b, "desync");
+	}
+	return(n);
+}
+
+static int recv_play(bot_type *b) {
+	byte type = (byte)b->r.ptr[0];
+	int n;
+
+	if ((n = recv_play_aux(b, type)) > 0) b->last_type = type;
+	return(n);
+}
+
+static void bot_read(bot_type *b) {
+	int n;
+
+	/* Make room and read whatever is there */
+	if (b->r.ptr != b->r.buf) Sockbuf_advance(&b->r, b->r.ptr - b->r.buf);
+	n = recv(b->r.sock, b->r.buf + b->r.len, b->r.size - b->r.len, 0);
+	if (n == 0) {
+		bot_disconnect(b, "connection closed");
+		return;
+	}
+	if (n < 0) {
+		if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return;
+		bot_disconnect(b, "read error");
+		return;
+	}
+	b->r.len += n;
+	st_int.rx += n;
+	st_all.rx += n;
+
+	while (b->r.ptr < b->r.buf + b->r.len) {
+		switch (b->state) {
+		case BOT_CONTACT:	n = recv_contact(b); break;
+		case BOT_VERIFY:	n = recv_verify(b); break;
+		case BOT_SETUP:		n = recv_setup(b); break;
+		case BOT_CHARLIST:	n = recv_charlist(b); break;
+		case BOT_LOGIN:		n = recv_login(b); break;
+		case BOT_START:		n = recv_start(b); break;
+		case BOT_PLAYING:	n = recv_play(b); break;
+		default:		n = -1;
+		}
+		if (n <= 0) break;
+	}
+	if (b->state == BOT_OFF) return;
+
+	/* A packet that can never fit would stall us forever */
+	if (b->r.ptr == b->r.buf && b->r.len == b->r.size) {
+		bot_disconnect(b, "receive buffer overflow");
+		return;
+	}
+	bot_flush(b);
+}
+
+
+/*
+ * Behaviour
+ */
+
+/* Find our own '@', which hilite_player marks with bit 0x80 */
+static bool bot_locate(bot_type *b, int *px, int *py) {
+	int x, y;
+
+	for (y = 0; y < MAX_SCR_HGT; y++)
+		for (x = 0; x < MAX_SCR_WID; x++)
+			if (b->scr_c[y][x] == '@' && (b->scr_a[y][x] & 0x80)) {
+				*px = x;
+				*py = y;
+				return(TRUE);
+			}
+	return(FALSE);
+}
+
+/* Nearest grid showing one of the symbols in 'what', within 'range' */
+static bool bot_nearest(bot_type *b, int px, int py, cptr what, int range, int *tx, int *ty) {
+	int x, y, d, best = range + 1;
+
+	for (y = MAX(0, py - range); y <= MIN(MAX_SCR_HGT - 1, py + range); y++)
+		for (x = MAX(0, px - range); x <= MIN(MAX_SCR_WID - 1, px + range); x++) {
+			if (!b->scr_c[y][x] || (x == px && y == py)) continue;
+			if (!strchr(what, b->scr_c[y][x])) continue;
+			d = MAX(ABS(x - px), ABS(y - py));
+			if (d < best) {
+				best = d;
+				*tx = x;
+				*ty = y;
+			}
+		}
+	return(best <= range);
+}
+
+static int step_towards(int px, int py, int tx, int ty) {
+	int dx = (tx > px) - (tx < px), dy = (ty > py) - (ty < py);
+
+	return(step_dir[dy + 1][dx + 1]);
+}
+
+static void bot_wander(bot_type *b) {
+	if (b->heading_left-- <= 0 || b->heading == 5) {
+		do b->heading = 1 + rand() % 9; while (b->heading == 5);
+		b->heading_left = 3 + rand() % 10;
+
+		/* Sometimes run instead of walking */
+		if (!(rand() % 8)) {
+			Packet_printf(&b->w, "%c%c", PKT_RUN, b->heading);
+			return;
+		}
+	}
+	Packet_printf(&b->w, "%c%c", PKT_WALK, b->heading);
+}
+
+static void bot_act(bot_type *b) {
+	static cptr monsters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ&";
+	int px, py, tx, ty;
+
+	b->actions++;
+	stats_add(STAT_ACTION, 1);
+
+	if (!bot_locate(b, &px, &py)) {
+		/* Don't know where we are yet (or the map was cleared) */
+		bot_wander(b);
+		return;
+	}
+
+	switch (b->behaviour) {
+	case BEH_FIGHT:
+		if (bot_nearest(b, px, py, monsters, 10, &tx, &ty)) {
+			/* Moving into a monster attacks it */
+			Packet_printf(&b->w, "%c%c", PKT_WALK, step_towards(px, py, tx, ty));
+			return;
+		}
+		break;
+	case BEH_STAIRS:
+		/* Standing on the staircase we were heading for? */
+		if (b->tx == px && b->ty == py) {
+			Packet_printf(&b->w, "%c", b->tc == '>' ? PKT_GO_DOWN : PKT_GO_UP);
+			b->tx = b->ty = -1;
+			return;
+		}
+		if (bot_nearest(b, px, py, "<>", MAX_SCR_WID, &tx, &ty)) {
+			b->tx = tx;
+			b->ty = ty;
+			b->tc = b->scr_c[ty][tx];
+			Packet_printf(&b->w, "%c%c", PKT_WALK, step_towards(px, py, tx, ty));
+
+			/* Walls are in the way now and then */
+			if (!(rand() % 4)) b->heading_left = 0;
+			return;
+		}
+		break;
+	case BEH_CHAT:
+		if (!(b->actions % cfg_chat)) {
+			Packet_printf(&b->w, "%c%S", PKT_MESSAGE, format("load test message %d from bot %d", b->actions / cfg_chat, b->id));
+			return;
+		}
+		break;
+	}
+	bot_wander(b);
+}
+
+static void bot_send_ping(bot_type *b) {
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	Packet_printf(&b->w, "%c%c%d%d%d%S", PKT_PING, 0, ++b->ping_id, (int)tv.tv_sec, (int)tv.tv_usec, "");
+	stats_add(STAT_PING, 1);
+}
+
+
+/*
+ * Packet captures, see CAPTURE_MAGIC in pack.h
+ */
+
+static u32b cap_u32(cptr p) {
+	return((u32b)(byte)p[0] | ((u32b)(byte)p[1] << 8) | ((u32b)(byte)p[2] << 16) | ((u32b)(byte)p[3] << 24));
+}
+
+/* Read a whole capture file into cap_buf */
+static bool cap_load(cptr file) {
+	FILE *fp;
+
+	if (!(fp = fopen(file, "rb"))) {
+		printf("Cannot open %s.\n", file);
+		return(FALSE);
+	}
+	fseek(fp, 0, SEEK_END);
+	cap_size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	if (cap_size < 8) cap_size = 8;
+	C_MAKE(cap_buf, cap_size, char);
+	if (fread(cap_buf, 1, cap_size, fp) != (size_t)cap_size || memcmp(cap_buf, CAPTURE_MAGIC, 8)) {
+		printf("%s is not a capture file.\n", file);
+		fclose(fp);
+		return(FALSE);
+	}
+	fclose(fp);
+	return(TRUE);
+}
+
+/* Get the record at *pos and advance it; a truncated last record ends the file */
+static bool cap_record(long *pos, byte *kind, u32b *delta, char **data, int *len) {
+	char *p = cap_buf + *pos;
+
+	if (*pos + 9 > cap_size) return(FALSE);
+	*kind = p[0];
+	*delta = cap_u32(p + 1);
+	*len = (int)cap_u32(p + 5);
+	if (*len < 0 || *pos + 9 + *len > cap_size) return(FALSE);
+	*data = p + 9;
+	*pos += 9 + *len;
+	return(TRUE);
+}
+
+/* Per packet type traffic, [256] is what couldn't be decoded */
+typedef struct cap_stat cap_stat;
+struct cap_stat {
+	int type;
+	u32b count;
+	u64b bytes;
+};
+
+static int cap_stat_cmp(const void *a, const void *b) {
+	const cap_stat *x = (const cap_stat *)a, *y = (const cap_stat *)b;
+
+	if (x->bytes != y->bytes) return(x->bytes < y->bytes ? 1 : -1);
+	return(x->type - y->type);
+}
+
+static cptr cap_type_name(int type) {
+	if (type == 256) return("(undecoded)");
+	if (pkt_name[type]) return(pkt_name[type]);
+	return(format("type %d", type));
+}
+
+static void cap_print(cptr title, cap_stat *stat, u64b total, int rows) {
+	int i;
+
+	printf("\n%s\n  %-24s %9s %12s %6s %8s\n", title, "packet", "count", "bytes", "share", "avg");
+	qsort(stat, 257, sizeof(cap_stat), cap_stat_cmp);
+	for (i = 0; i < 257 && i < rows && stat[i].count; i++)
+		printf("  %-24s %9u %12llu %5.1f%% %8.1f\n", cap_type_name(stat[i].type), stat[i].count, (unsigned long long)stat[i].bytes,
+		    total ? stat[i].bytes * 100.0 / total : 0.0, (double)stat[i].bytes / stat[i].count);
+}
+
+/* Split the server's output into packets and count them by type */
+static void cap_decode_out(char *data, int len, cap_stat *stat, cap_stat *sec) {
+	sockbuf_t rb;
+	char *start;
+	int type, n;
+
+	rb.sock = -1;
+	rb.buf = rb.ptr = data;
+	rb.size = rb.len = len;
+	rb.state = SOCKBUF_READ | SOCKBUF_LOCK;
+
+	while (rb.ptr < rb.buf + rb.len) {
+		start = rb.ptr;
+		type = (byte)*start;
+		if ((n = pkt_step(&rb)) <= 0) {
+			/* Lost track: the rest of this flush is unaccounted for */
+			type = 256;
+			rb.ptr = rb.buf + rb.len;
+		}
+		stat[type].count++;
+		stat[type].bytes += rb.ptr - start;
+		sec[type].count++;
+		sec[type].bytes += rb.ptr - start;
+	}
+}
+
+/* -D: Show what a capture's traffic consists of */
+static int cap_decode(cptr file) {
+	static cap_stat out[257], in[257], sec[257], peak[257];
+	long pos = 8;
+	byte kind;
+	u32b delta;
+	char *data, head[MAX_CHARS] = "", play[MAX_CHARS] = "";
+	int len, i, t;
+	u64b now = 0, sec_start = 0, sec_bytes = 0, peak_bytes = 0, peak_at = 0, play_at = 0;
+	u64b login_out = 0, login_in = 0, total_out = 0, total_in = 0;
+	bool playing = FALSE;
+
+	if (!cap_load(file)) return(-1);
+	for (i = 0; i < 257; i++) out[i].type = in[i].type = sec[i].type = i;
+
+	while (cap_record(&pos, &kind, &delta, &data, &len)) {
+		now += delta;
+
+		/* Keep the busiest second */
+		if (now >= sec_start + 1000000) {
+			if (sec_bytes > peak_bytes) {
+				peak_bytes = sec_bytes;
+				peak_at = sec_start;
+				memcpy(peak, sec, sizeof(peak));
+			}
+			memset(sec, 0, sizeof(sec));
+			for (i = 0; i < 257; i++) sec[i].type = i;
+			sec_start = now - (now - sec_start) % 1000000;
+			sec_bytes = 0;
+		}
+
+		switch (kind) {
+		case CAP_HEAD:
+			strnfmt(head, sizeof(head), "%.*s", len, data);
+			break;
+		case CAP_PLAY:
+			strnfmt(play, sizeof(play), "%.*s", len, data);
+			playing = TRUE;
+			play_at = now;
+			break;
+		case CAP_IN:
+			total_in += len;
+			if (!playing) login_in += len;
+			break;
+		case CAP_OUT:
+			total_out += len;
+			if (!playing) {
+				/* Handshake replies don't use the stream formats */
+				login_out += len;
+				break;
+			}
+			sec_bytes += len;
+			cap_decode_out(data, len, out, sec);
+			break;
+		case CAP_CMD:
+			/* Deferred commands are processed again later */
+			if (len < 6 || !data[5]) break;
+			t = (byte)data[0];
+			in[t].count++;
+			in[t].bytes += cap_u32(data + 1);
+			break;
+		}
+	}
+	if (sec_bytes > peak_bytes) {
+		peak_bytes = sec_bytes;
+		peak_at = sec_start;
+		memcpy(peak, sec, sizeof(peak));
+	}
+	if (pos != cap_size) printf("Warning: capture is truncated after %ld of %ld bytes.\n", pos, cap_size);
+
+	printf("Capture %s: %s\n", file, head);
+	printf("Character %s, %.1f seconds, %.1f of them playing\n", play[0] ? play : "(never entered the game)",
+	    now / 1000000.0, playing ? (now - play_at) / 1000000.0 : 0.0);
+	printf("Server to client: %llu bytes (%llu during login, %llu undecoded)\n",
+	    (unsigned long long)total_out, (unsigned long long)login_out, (unsigned long long)out[256].bytes);
+	printf("Client to server: %llu bytes (%llu during login)\n", (unsigned long long)total_in, (unsigned long long)login_in);
+
+	cap_print("Server to client, by packet type:", out, total_out - login_out, 257);
+	cap_print("Client to server, by command:", in, total_in - login_in, 257);
+	if (peak_bytes) cap_print(format("Busiest second, %.0f s into the capture: %llu bytes", peak_at / 1000000.0,
+	    (unsigned long long)peak_bytes), peak, peak_bytes, 15);
+
+	C_KILL(cap_buf, cap_size, char);
+	return(0);
+}
+
+/* -R: Collect the client input that followed CAP_PLAY */
+static bool cap_replay_load(cptr file) {
+	long pos = 8;
+	byte kind;
+	u32b delta;
+	char *data;
+	int len;
+	u64b now = 0, play_at = 0;
+	bool playing = FALSE;
+
+	if (!cap_load(file)) return(FALSE);
+
+	/* Count first, then fill in */
+	while (cap_record(&pos, &kind, &delta, &data, &len))
+		if (kind == CAP_PLAY) playing = TRUE;
+		else if (playing && kind == CAP_IN && len) replay_chunks++;
+	if (!replay_chunks) {
+		printf("%s has no client input to replay.\n", file);
+		return(FALSE);
+	}
+	C_MAKE(replay, replay_chunks, cap_chunk);
+
+	pos = 8;
+	playing = FALSE;
+	replay_chunks = 0;
+	while (cap_record(&pos, &kind, &delta, &data, &len)) {
+		now += delta;
+		if (kind == CAP_PLAY && !playing) {
+			playing = TRUE;
+			play_at = now;
+		} else if (playing && kind == CAP_IN && len) {
+			replay[replay_chunks].when = now - play_at;
+			replay[replay_chunks].data = data;
+			replay[replay_chunks].len = len;
+			replay_chunks++;
+		}
+	}
+	printf("Replaying %d chunks (%.1f seconds) of client input from %s\n", replay_chunks,
+	    replay[replay_chunks - 1].when / 1000000.0, file);
+	return(TRUE);
+}
+
+/* Send the captured input that is due, looping at the end of the capture */
+static void bot_replay(bot_type *b, u64b now) {
+	cap_chunk *c;
+
+	while (now >= b->replay_start + (c = &replay[b->replay_next])->when) {
+		if (b->w.size - b->w.len < c->len) break;
+		Sockbuf_write(&b->w, c->data, c->len);
+		stats_add(STAT_ACTION, 1);
+		if (++b->replay_next == replay_chunks) {
+			b->replay_next = 0;
+			b->replay_start = now;
+			break;
+		}
+	}
+}
+
+
+/*
+ * Setup
+ */
+
+/* The packet types the client has a Receive_*() handler for, made from client/nclient.c by the makefile */
+static const byte pkt_recv[] = {
+#define PKT_RECV(x) PKT_##x,
+#include "pkt_recv.h"
+#undef PKT_RECV
+};
+static cptr pkt_recv_name[] = {
+#define PKT_RECV(x) #x,
+#include "pkt_recv.h"
+#undef PKT_RECV
+};
+
+/* Stream packet formats, as read by the client's Receive_*() handlers */
+static void init_formats(void) {
+	int i;
+	bool bad = FALSE;
+
+	/* Status and character */
+	pkt_fmt[PKT_STAT]		= "%c%c%hd%hd%hd%hd%hd";
+	pkt_fmt[PKT_HP]			= "%c%hd%hd%c";
+	pkt_fmt[PKT_STAMINA]		= "%c%hd%hd";
+	pkt_fmt[PKT_AC]			= "%c%hd%hd";
+	pkt_fmt[PKT_MP]			= "%c%hd%hd";
+	pkt_fmt[PKT_SANITY]		= "%c%c%s%c%hd%hd";
+	pkt_fmt[PKT_AUTOINSCRIBE]	= "%c%hd";
+	pkt_fmt[PKT_CHAR_INFO]		= "%c%hd%hd%hd%hd%d%hd%s";
+	pkt_fmt[PKT_VARIOUS]		= "%c%hu%hu%hu%hu%s";
+	pkt_fmt[PKT_PLUSSES]		= "%c%hd%hd%hd%hd%hd%hd";
+	pkt_fmt[PKT_EXPERIENCE]		= "%c%hu%hu%hu%d%d%d%d";
+	pkt_fmt[PKT_SKILL_INIT]		= "%c%hd%hd%hd%hd%d%c%S%S%S";
+	pkt_fmt[PKT_SKILL_PTS]		= "%c%d";
+	pkt_fmt[PKT_SKILL_MOD]		= "%c%d%d%d%d%c%d";
+	pkt_fmt[PKT_GOLD]		= "%c%d%d";
+	pkt_fmt[PKT_HISTORY]		= "%c%hu%s";
+	pkt_fmt[PKT_STATE]		= "%c%hu%hu%hu";
+	pkt_fmt[PKT_TITLE]		= "%c%s";
+	pkt_fmt[PKT_CONFUSED]		= "%c%c";
+	pkt_fmt[PKT_POISON]		= "%c%c";
+	pkt_fmt[PKT_STUDY]		= "%c%c";
+	pkt_fmt[PKT_FEAR]		= "%c%c";
+	pkt_fmt[PKT_BLIND]		= "%c%c";
+	pkt_fmt[PKT_BPR]		= "%c%c%c%s";
+	pkt_fmt[PKT_FOOD]		= "%c%hu";
+	pkt_fmt[PKT_SPEED]		= "%c%hd";
+	pkt_fmt[PKT_CUT]		= "%c%hd";
+	pkt_fmt[PKT_STUN]		= "%c%hd";
+	pkt_fmt[PKT_SKILLS]		= "%c%hd%hd%hd%hd%hd%hd%hd%hd%hd%hd%hd%hd";
+	pkt_fmt[PKT_ENCUMBERMENT]	= "%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c";
+	pkt_fmt[PKT_EXTRA_STATUS]	= "%c%s";
+	pkt_fmt[PKT_BONI_COL]		= "%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%c%u";
+
+	/* Items */
+	pkt_fmt[PKT_INVEN]		= "%c%c%c%hu%hd%c%c%hd%hd%c%I";
+	pkt_fmt[PKT_EQUIP]		= "%c%c%c%hu%hd%c%c%hd%hd%c%I";
+	pkt_fmt[PKT_SI_MOVE]		= "%c%c%c%c%hu%hd%c%c%hd%hd%c%I";
+	pkt_fmt[PKT_INVEN_WIDE]		= "%c%c%c%hu%hd%c%c%hd%hd%hd%hd%hd%hd%hd%hd%hd%hd%hd%I%c";
+	pkt_fmt[PKT_EQUIP_WIDE]		= "%c%c%c%hu%hd%c%c%hd%hd%c%I%hd%hd%hd%hd%hd%hd%hd%hd%hd";
+	pkt_fmt[PKT_ITEM]		= "%c%c";
+	pkt_fmt[PKT_ITEM_NEWEST]	= "%c%d";
+	pkt_fmt[PKT_ITEM_NEWEST_2ND]	= "%c%d";
+	pkt_fmt[PKT_INVENTORY_REV]	= "%c%d";
+	pkt_fmt[PKT_FLOOR]		= "%c%c";
+	pkt_fmt[PKT_PICKUP_CHECK]	= "%c%s";
+	pkt_fmt[PKT_WHATS_UNDER_YOUR_FEET] = "%c%c%c%c%I";
+
+	/* Map (the bots read these themselves, see recv_play_aux()) */
+	pkt_fmt[PKT_CHAR]		= "%c%c%c%c%c";
+	pkt_fmt[PKT_CHAR_DIRECT]	= "%c%c%c%c%c";
+	pkt_fmt[PKT_DEPTH]		= "%c%hu%hu%hu%c%c%c%s%s%s";
+	pkt_fmt[PKT_MINI_MAP_POS]	= "%c%hd%hd%hd%c%u";
+	pkt_fmt[PKT_TARGET_INFO]	= "%c%c%c%S";
+	pkt_fmt[PKT_MONSTER_HEALTH]	= "%c%c%c";
+
+	/* Spells and requests */
+	pkt_fmt[PKT_SPELL]		= "%c%d";
+	pkt_fmt[PKT_SPELL_INFO]		= "%c%d%d%d%hu%hu%hu%s";
+	pkt_fmt[PKT_POWERS_INFO]	= "%c%d%d%d%d";
+	pkt_fmt[PKT_TECHNIQUE_INFO]	= "%c%d%d";
+	pkt_fmt[PKT_REQUEST_KEY]	= "%c%d%s";
+	pkt_fmt[PKT_REQUEST_AMT]	= "%c%d%s%d";
+	pkt_fmt[PKT_REQUEST_NUM]	= "%c%d%s%d%d%d";
+	pkt_fmt[PKT_REQUEST_STR]	= "%c%d%s%s";
+	pkt_fmt[PKT_REQUEST_CFR]	= "%c%d%s%c";
+	pkt_fmt[PKT_CONFIRM]		= "%c%c";
+
+	/* Stores */
+	pkt_fmt[PKT_BACT]		= "%c%c%hd%hd%s%c%c%d%u";
+	pkt_fmt[PKT_STORE]		= "%c%c%c%hd%hd%d%S%c%c%d%s";
+	pkt_fmt[PKT_STORE_WIDE]		= "%c%c%c%hd%hd%d%S%c%c%d%hd%hd%hd%hd%hd%hd%hd%hd%hd";
+	pkt_fmt[PKT_STORE_SPECIAL_STR]	= "%c%c%c%c%s";
+	pkt_fmt[PKT_STORE_SPECIAL_CHAR]	= "%c%c%c%c%c";
+	pkt_fmt[PKT_STORE_SPECIAL_CLR]	= "%c%c%c";
+	pkt_fmt[PKT_STORE_SPECIAL_ANIM]	= "%c%hd%hd%hd%hd";
+	pkt_fmt[PKT_STORE_INFO]		= "%c%hd%s%s%hd%d%c%c%c";
+	pkt_fmt[PKT_SELL]		= "%c%d";
+
+	/* Audio and visuals */
+	pkt_fmt[PKT_SOUND]		= "%c%d%d%d%d%d%d%d";
+	pkt_fmt[PKT_MUSIC]		= "%c%d%d%d";
+	pkt_fmt[PKT_MUSIC_VOL]		= "%c%d%d%d%c";
+	pkt_fmt[PKT_SFX_AMBIENT]	= "%c%d";
+	pkt_fmt[PKT_SFX_VOLUME]		= "%c%c%c";
+	pkt_fmt[PKT_PALETTE]		= "%c%c%c%c%c";
+	pkt_fmt[PKT_WEATHERCOL]		= "%c%c%c%c%c";
+
+	/* Text, social and the rest */
+	pkt_fmt[PKT_PING]		= "%c%c%d%d%d%S";
+	pkt_fmt[PKT_QUIT]		= "%c%s";
+	pkt_fmt[PKT_RELOGIN]		= "%c%s%s%s%s%s%c";
+	pkt_fmt[PKT_MESSAGE]		= "%c%S";
+	pkt_fmt[PKT_SPECIAL_LINE]	= "%c%d%d%c%I";
+	pkt_fmt[PKT_SPECIAL_LINE_POS]	= "%c%d";
+	pkt_fmt[PKT_PARTY_STATS]	= "%c%d%d%s%d%d%d%d%d";
+	pkt_fmt[PKT_PARTY]		= "%c%s%s%s";
+	pkt_fmt[PKT_GUILD]		= "%c%s%s%s";
+	pkt_fmt[PKT_CHARDUMP]		= "%c%s";
+	pkt_fmt[PKT_AFK]		= "%c%c";
+	pkt_fmt[PKT_MARTYR]		= "%c%c";
+	pkt_fmt[PKT_IDLE]		= "%c%c";
+	pkt_fmt[PKT_ACCOUNT_INFO]	= "%c%hd";
+	pkt_fmt[PKT_UNIQUE_MONSTER]	= "%c%d%d%s";
+	pkt_fmt[PKT_GUIDE]		= "%c%c%d%s";
+	pkt_fmt[PKT_INDICATORS]		= "%c%d";
+	pkt_fmt[PKT_SFLAGS]		= "%c%d%d%d%d";
+	pkt_fmt[PKT_MAGIC]		= "%c%u";
+
+	/* Just the type */
+	pkt_fmt[PKT_DIRECTION] = pkt_fmt[PKT_FLUSH] = pkt_fmt[PKT_SPECIAL_OTHER] =
+	pkt_fmt[PKT_STORE_LEAVE] = pkt_fmt[PKT_SCREENFLASH] = pkt_fmt[PKT_PAUSE] =
+	pkt_fmt[PKT_BEEP] = pkt_fmt[PKT_WARNING_BEEP] = pkt_fmt[PKT_KEEPALIVE] =
+	pkt_fmt[PKT_REQUEST_ABORT] = pkt_fmt[PKT_KEYPRESS] = pkt_fmt[PKT_VERSION] =
+	pkt_fmt[PKT_MACRO_FAILURE] = pkt_fmt[PKT_END] = "%c";
+
+	/* Paranoia -- every format starts with the type byte */
+	for (i = 0; i < 256; i++)
+		if (pkt_fmt[i] && strncmp(pkt_fmt[i], "%c", 2)) quit(format("Bad format for packet type %d", i));
+
+	/* Everything the server may send has to be known here, or the bots would desync on it */
+	for (i = 0; i < (int)(sizeof(pkt_recv) / sizeof(byte)); i++) {
+		if (pkt_fmt[pkt_recv[i]] || pkt_special(pkt_recv[i])) continue;
+		fprintf(stderr, "No format for packet type %s (%d), the client has a handler for it.\n", pkt_recv_name[i], pkt_recv[i]);
+		bad = TRUE;
+	}
+	if (bad) quit("Packet formats are out of date, see init_formats()");
+}
+
+/* Packet type names for -D */
+static void init_names(void) {
+#define PKT_NAME(x) pkt_name[PKT_##x] = #x
+	PKT_NAME(UNDEFINED); PKT_NAME(VERIFY); PKT_NAME(REPLY); PKT_NAME(PLAY); PKT_NAME(QUIT);
+	PKT_NAME(LEAVE); PKT_NAME(MAGIC); PKT_NAME(RELIABLE); PKT_NAME(ACK); PKT_NAME(TALK); PKT_NAME(START);
+	PKT_NAME(END); PKT_NAME(LOGIN); PKT_NAME(KEEPALIVE); PKT_NAME(FILE); PKT_NAME(PLUSSES); PKT_NAME(AC);
+	PKT_NAME(EXPERIENCE); PKT_NAME(GOLD); PKT_NAME(HP); PKT_NAME(MP); PKT_NAME(CHAR_INFO);
+	PKT_NAME(VARIOUS); PKT_NAME(STAT); PKT_NAME(HISTORY); PKT_NAME(INVEN); PKT_NAME(EQUIP);
+	PKT_NAME(TITLE); PKT_NAME(LEVEL); PKT_NAME(DEPTH); PKT_NAME(FOOD); PKT_NAME(BLIND);
+	PKT_NAME(CONFUSED); PKT_NAME(FEAR); PKT_NAME(POISON); PKT_NAME(STATE); PKT_NAME(LINE_INFO);
+	PKT_NAME(SPEED); PKT_NAME(STUDY); PKT_NAME(CUT); PKT_NAME(STUN); PKT_NAME(MESSAGE); PKT_NAME(CHAR);
+	PKT_NAME(SPELL_INFO); PKT_NAME(FLOOR); PKT_NAME(SPECIAL_OTHER); PKT_NAME(STORE);
+	PKT_NAME(STORE_INFO); PKT_NAME(TARGET_INFO); PKT_NAME(SOUND); PKT_NAME(MINI_MAP);
+	PKT_NAME(PICKUP_CHECK); PKT_NAME(SKILLS); PKT_NAME(PAUSE); PKT_NAME(MONSTER_HEALTH);
+	PKT_NAME(DIRECTION); PKT_NAME(ITEM); PKT_NAME(SELL); PKT_NAME(PARTY); PKT_NAME(SPECIAL_LINE);
+	PKT_NAME(SKILL_MOD); PKT_NAME(TAKE_OFF_AMT); PKT_NAME(MIND); PKT_NAME(STORE_EXAMINE); PKT_NAME(KING);
+	PKT_NAME(WALK); PKT_NAME(RUN); PKT_NAME(TUNNEL); PKT_NAME(AIM_WAND); PKT_NAME(DROP); PKT_NAME(FIRE);
+	PKT_NAME(STAND); PKT_NAME(DESTROY); PKT_NAME(LOOK); PKT_NAME(SPELL); PKT_NAME(OPEN); PKT_NAME(PRAY);
+	PKT_NAME(QUAFF); PKT_NAME(READ); PKT_NAME(SEARCH); PKT_NAME(TAKE_OFF); PKT_NAME(USE);
+	PKT_NAME(THROW); PKT_NAME(WIELD); PKT_NAME(ZAP); PKT_NAME(TARGET); PKT_NAME(INSCRIBE);
+	PKT_NAME(UNINSCRIBE); PKT_NAME(ACTIVATE); PKT_NAME(BASH); PKT_NAME(DISARM); PKT_NAME(EAT);
+	PKT_NAME(FILL); PKT_NAME(LOCATE); PKT_NAME(MAP); PKT_NAME(SEARCH_MODE); PKT_NAME(FIGHT);
+	PKT_NAME(CLOSE); PKT_NAME(GAIN); PKT_NAME(GO_UP); PKT_NAME(GO_DOWN); PKT_NAME(PURCHASE);
+	PKT_NAME(STORE_LEAVE); PKT_NAME(STORE_CONFIRM); PKT_NAME(DROP_GOLD); PKT_NAME(REDRAW);
+	PKT_NAME(REST); PKT_NAME(GHOST); PKT_NAME(SUICIDE); PKT_NAME(STEAL); PKT_NAME(OPTIONS);
+	PKT_NAME(TARGET_FRIENDLY); PKT_NAME(MASTER); PKT_NAME(AUTOPHASE); PKT_NAME(HOUSE); PKT_NAME(FAILURE);
+	PKT_NAME(SUCCESS); PKT_NAME(CLEAR_BUFFER); PKT_NAME(SCRIPT); PKT_NAME(CLEAR_ACTIONS);
+	PKT_NAME(ZAP_DIR); PKT_NAME(ACTIVATE_DIR); PKT_NAME(SKILL_DEV); PKT_NAME(BPR); PKT_NAME(SANITY);
+	PKT_NAME(SCREEN_DIM); PKT_NAME(GUILD_CFG); PKT_NAME(BONI_COL); PKT_NAME(MINI_MAP_POS);
+	PKT_NAME(AUTOINSCRIBE); PKT_NAME(MARTYR); PKT_NAME(PALETTE); PKT_NAME(IDLE); PKT_NAME(POWERS_INFO);
+	PKT_NAME(CLIENT_SETUP_U); PKT_NAME(CLIENT_SETUP_F); PKT_NAME(CLIENT_SETUP_K);
+	PKT_NAME(CLIENT_SETUP_R); PKT_NAME(CLIENT_SETUP); PKT_NAME(ITEM_NEWEST); PKT_NAME(CONFIRM);
+	PKT_NAME(KEYPRESS); PKT_NAME(SFX_VOLUME); PKT_NAME(SFX_AMBIENT); PKT_NAME(FLUSH); PKT_NAME(OBSERVE);
+	PKT_NAME(SPIKE); PKT_NAME(GUILD); PKT_NAME(SKILL_INIT); PKT_NAME(ACTIVATE_SKILL); PKT_NAME(RAW_KEY);
+	PKT_NAME(CHARDUMP); PKT_NAME(BACT); PKT_NAME(STORE_CMD); PKT_NAME(SKILL_PTS); PKT_NAME(BEEP);
+	PKT_NAME(SERVERDETAILS); PKT_NAME(AFK); PKT_NAME(ENCUMBERMENT); PKT_NAME(PARTY_STATS);
+	PKT_NAME(PING); PKT_NAME(SIP); PKT_NAME(TELEKINESIS); PKT_NAME(BBS); PKT_NAME(WIELD2);
+	PKT_NAME(CLOAK); PKT_NAME(STAMINA); PKT_NAME(TECHNIQUE_INFO); PKT_NAME(EXTRA_STATUS);
+	PKT_NAME(INVEN_WIDE); PKT_NAME(UNIQUE_MONSTER); PKT_NAME(WEATHER); PKT_NAME(INVENTORY_REV);
+	PKT_NAME(ACCOUNT_INFO); PKT_NAME(CHANGE_PASSWORD); PKT_NAME(STORE_WIDE); PKT_NAME(FORCE_STACK);
+	PKT_NAME(MUSIC); PKT_NAME(REQUEST_KEY); PKT_NAME(REQUEST_AMT); PKT_NAME(REQUEST_STR);
+	PKT_NAME(REQUEST_CFR); PKT_NAME(REQUEST_ABORT); PKT_NAME(STORE_SPECIAL_STR);
+	PKT_NAME(STORE_SPECIAL_CHAR); PKT_NAME(STORE_SPECIAL_CLR); PKT_NAME(WARNING_BEEP);
+	PKT_NAME(STAND_ONE); PKT_NAME(WIELD3); PKT_NAME(AUDIO); PKT_NAME(GUIDE); PKT_NAME(INDICATORS);
+	PKT_NAME(PLAYERLIST); PKT_NAME(WEATHERCOL); PKT_NAME(MUSIC_VOL); PKT_NAME(WHATS_UNDER_YOUR_FEET);
+	PKT_NAME(STAND_AUTO); PKT_NAME(SCREENFLASH); PKT_NAME(SPECIAL_LINE_POS); PKT_NAME(VERSION);
+	PKT_NAME(FONT); PKT_NAME(EQUIP_WIDE); PKT_NAME(PLISTW_NOTIFY); PKT_NAME(UNKNOWNPACKET);
+	PKT_NAME(ITEM_NEWEST_2ND); PKT_NAME(SFLAGS); PKT_NAME(CHAR_DIRECT); PKT_NAME(SPLIT_STACK);
+	PKT_NAME(STORE_SPECIAL_ANIM); PKT_NAME(REQUEST_NUM); PKT_NAME(MACRO_FAILURE);
+#undef PKT_NAME
+}
+
+/* Parse "walk=40,fight=30,chat=10,stairs=20" */
+static bool parse_mix(char *arg) {
+	char *tok, *eq;
+	int i, total = 0;
+
+	for (i = 0; i < BEH_MAX; i++) cfg_mix[i] = 0;
+	for (tok = strtok(arg, ","); tok; tok = strtok(NULL, ",")) {
+		if (!(eq = strchr(tok, '='))) return(FALSE);
+		*eq = '\0';
+		for (i = 0; i < BEH_MAX; i++)
+			if (streq(tok, beh_name[i])) break;
+		if (i == BEH_MAX || atoi(eq + 1) < 0) return(FALSE);
+		cfg_mix[i] = atoi(eq + 1);
+	}
+	for (i = 0; i < BEH_MAX; i++) total += cfg_mix[i];
+	return(total > 0);
+}
+
+/*
+ * Account and character name of a bot.  Names shorter than five letters
+ * escape the server's similar_names() check, and since no letter repeats
+ * they also condense to distinct normalised names (see condense_name()).
+ */
+static void bot_name(char *buf, int id) {
+	int i, prev = cfg_name[0] - 'A';
+
+	buf[0] = cfg_name[0];
+	for (i = 1; i < 4; i++) {
+		/* Any letter but the previous one */
+		prev = (prev + 1 + id % 25) % 26;
+		buf[i] = 'a' + prev;
+		id /= 25;
+	}
+	buf[4] = '\0';
+}
+
+static void usage(void) {
+	printf("Usage: tomenet.loadgen [options] [server]\n");
+	printf("  -n<bots>      Number of bots (default %d, max %d)\n", cfg_bots, MAX_BOTS);
+	printf("  -p<port>      Game port (default %d)\n", cfg_port);
+	printf("  -t<seconds>   Run time, 0 to run until interrupted (default %d)\n", cfg_duration);
+	printf("  -d<ms>        Delay between initial logins (default %d)\n", cfg_ramp);
+	printf("  -a<ms>        Delay between bot actions (default %d)\n", cfg_action);
+	printf("  -i<ms>        Delay between pings (default %d)\n", cfg_ping);
+	printf("  -r<seconds>   Report interval (default %d)\n", cfg_report);
+	printf("  -c<actions>   Chat bots talk every this many actions (default %d)\n", cfg_chat);
+	printf("  -m<mix>       Behaviour mix (default walk=%d,fight=%d,chat=%d,stairs=%d)\n", cfg_mix[0], cfg_mix[1], cfg_mix[2], cfg_mix[3]);
+	printf("  -l<letter>    First letter of the bots' account/character names (default %s)\n", cfg_name);
+	printf("  -P<password>  Account password (default %s)\n", cfg_pass);
+	printf("  -x            Don't reconnect bots that got disconnected\n");
+	printf("  -R<file>      Have the bots replay the client input of a capture file instead of acting\n");
+	printf("  -D<file>      Decode a capture file (see /capture on the server) and exit\n");
+}
+
+int main(int argc, char **argv) {
+	struct pollfd *pfd;
+	bot_type **pbot;
+	u64b start, now, next_report, last_report;
+	int i, j, n, total, cum;
+
+	/* Process the command line arguments */
+	for (i = 1; argv && (i < argc); i++) {
+		/* Require proper options */
+		if (argv[i][0] != '-') {
+			strnfmt(server_name, MAX_CHARS, "%s", argv[i]);
+			continue;
+		}
+
+		/* Analyze option */
+		switch (argv[i][1]) {
+		case 'n': cfg_bots = atoi(&argv[i][2]); break;
+		case 'p': cfg_port = atoi(&argv[i][2]); break;
+		case 't': cfg_duration = atoi(&argv[i][2]); break;
+		case 'd': cfg_ramp = atoi(&argv[i][2]); break;
+		case 'a': cfg_action = atoi(&argv[i][2]); break;
+		case 'i': cfg_ping = atoi(&argv[i][2]); break;
+		case 'r': cfg_report = atoi(&argv[i][2]); break;
+		case 'c': cfg_chat = atoi(&argv[i][2]); break;
+		case 'l': cfg_name[0] = toupper(argv[i][2]); break;
+		case 'P': strnfmt(cfg_pass, MAX_CHARS, "%s", &argv[i][2]); break;
+		case 'x': cfg_reconnect = FALSE; break;
+		case 'R': strnfmt(cfg_replay, sizeof(cfg_replay), "%s", &argv[i][2]); break;
+		case 'D':
+			init_formats();
+			init_names();
+			return(cap_decode(&argv[i][2]));
+		case 'm':
+			if (!parse_mix(&argv[i][2])) {
+				printf("Bad behaviour mix '%s'.\n", &argv[i][2]);
+				return(-1);
+			}
+			break;
+		default:
+			usage();
+			return(-1);
+		}
+	}
+	if (cfg_bots < 1 || cfg_bots > MAX_BOTS || cfg_action < 10 || cfg_ping < 10 || cfg_report < 1 || cfg_chat < 1 ||
+	    cfg_name[0] < 'A' || cfg_name[0] > 'Z' || strlen(cfg_pass) < 6) {
+		usage();
+		return(-1);
+	}
+
+	init_formats();
+	if (cfg_replay[0] && !cap_replay_load(cfg_replay)) return(-1);
+	signal(SIGPIPE, SIG_IGN);
+	signal(SIGINT, handle_signal);
+	signal(SIGTERM, handle_signal);
+	srand(time(NULL));
+
+	C_MAKE(bots, cfg_bots, bot_type);
+	C_MAKE(pfd, cfg_bots, struct pollfd);
+	C_MAKE(pbot, cfg_bots, bot_type *);
+
+	/* Spread the behaviours over the bots according to the mix */
+	for (total = 0, i = 0; i < BEH_MAX; i++) total += cfg_mix[i];
+	start = lg_start = now_usec();
+	for (i = 0; i < cfg_bots; i++) {
+		bot_type *b = &bots[i];
+
+		b->id = i;
+		bot_name(b->name, i);
+		n = ((i * 2 + 1) * total) / (cfg_bots * 2);
+		for (cum = 0, j = 0; j < BEH_MAX - 1; j++) {
+			cum += cfg_mix[j];
+			if (n < cum) break;
+		}
+		b->behaviour = j;
+		if (Sockbuf_init(&b->r, -1, LOADGEN_RECV_SIZE, SOCKBUF_READ | SOCKBUF_WRITE | SOCKBUF_LOCK) == -1 ||
+		    Sockbuf_init(&b->w, -1, LOADGEN_SEND_SIZE, SOCKBUF_WRITE) == -1)
+			quit("No memory for socket buffers");
+		b->state = BOT_OFF;
+		b->next_connect = start + (u64b)i * cfg_ramp * 1000;
+	}
+
+	printf("Starting %d bots against %s:%d (walk %d, fight %d, chat %d, stairs %d)\n", cfg_bots, server_name, cfg_port,
+	    cfg_mix[BEH_WALK], cfg_mix[BEH_FIGHT], cfg_mix[BEH_CHAT], cfg_mix[BEH_STAIRS]);
+
+	last_report = start;
+	next_report = start + cfg_report * 1000000ULL;
+	while (!stop) {
+		now = now_usec();
+		if (cfg_duration && now >= start + cfg_duration * 1000000ULL) break;
+
+		for (n = 0, i = 0; i < cfg_bots; i++) {
+			bot_type *b = &bots[i];
+
+			if (b->state == BOT_OFF) {
+				if (now >= b->next_connect) bot_connect(b);
+				if (b->state == BOT_OFF) continue;
+			} else if (b->state != BOT_PLAYING) {
+				if (now >= b->login_start + HANDSHAKE_TIMEOUT * 1000000ULL) {
+					bot_disconnect(b, format("login timeout (state %d)", b->state));
+					continue;
+				}
+			} else {
+				if (now >= b->next_ping) {
+					bot_send_ping(b);
+					b->next_ping = now + cfg_ping * 1000ULL;
+				}
+				if (replay) bot_replay(b, now);
+				else if (now >= b->next_action) {
+					bot_act(b);
+
+					/* Jitter by +-25% so the bots don't act in lockstep */
+					b->next_action = now + (cfg_action * (75 + rand() % 51)) * 10ULL;
+				}
+				if (bot_flush(b) == -1) continue;
+			}
+
+			pfd[n].fd = b->r.sock;
+			pfd[n].events = POLLIN | (b->w.len > 0 ? POLLOUT : 0);
+			pfd[n].revents = 0;
+			pbot[n++] = b;
+		}
+
+		if (poll(pfd, n, 5) > 0)
+			for (i = 0; i < n; i++) {
+				if (pbot[i]->state == BOT_OFF) continue;
+				if (pfd[i].revents & (POLLIN | POLLHUP | POLLERR)) bot_read(pbot[i]);
+				if (pbot[i]->state != BOT_OFF && (pfd[i].revents & POLLOUT)) bot_flush(pbot[i]);
+			}
+
+		now = now_usec();
+		if (now >= next_report) {
+			stats_line(format("%5ds", (int)((now - start) / 1000000)), &st_int, (now - last_report) / 1000000.0);
+			memset(&st_int, 0, sizeof(st_int));
+			last_report = now;
+			next_report = now + cfg_report * 1000000ULL;
+		}
+	}
+
+	stats_summary((now_usec() - start) / 1000000.0);
+
+	for (i = 0; i < cfg_bots; i++) {
+		if (bots[i].r.sock != -1) close(bots[i].r.sock);
+		Sockbuf_cleanup(&bots[i].r);
+		Sockbuf_cleanup(&bots[i].w);
+	}
+	C_KILL(pbot, cfg_bots, bot_type *);
+	C_KILL(pfd, cfg_bots, struct pollfd);
+	C_KILL(bots, cfg_bots, bot_type);
+	return(0);
+}
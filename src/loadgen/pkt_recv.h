@@ -0,0 +1,114 @@
+PKT_RECV(QUIT)
+PKT_RECV(RELOGIN)
+PKT_RECV(END)
+PKT_RECV(FILE)
+PKT_RECV(STAT)
+PKT_RECV(HP)
+PKT_RECV(AC)
+PKT_RECV(INVEN)
+PKT_RECV(EQUIP)
+PKT_RECV(CHAR_INFO)
+PKT_RECV(VARIOUS)
+PKT_RECV(PLUSSES)
+PKT_RECV(EXPERIENCE)
+PKT_RECV(GOLD)
+PKT_RECV(MP)
+PKT_RECV(HISTORY)
+PKT_RECV(CHAR)
+PKT_RECV(MESSAGE)
+PKT_RECV(STATE)
+PKT_RECV(TITLE)
+PKT_RECV(DEPTH)
+PKT_RECV(CONFUSED)
+PKT_RECV(POISON)
+PKT_RECV(STUDY)
+PKT_RECV(BPR)
+PKT_RECV(FOOD)
+PKT_RECV(FEAR)
+PKT_RECV(SPEED)
+PKT_RECV(CUT)
+PKT_RECV(BLIND)
+PKT_RECV(STUN)
+PKT_RECV(ITEM)
+PKT_RECV(SPELL)
+PKT_RECV(SPELL_INFO)
+PKT_RECV(DIRECTION)
+PKT_RECV(FLUSH)
+PKT_RECV(LINE_INFO)
+PKT_RECV(SPECIAL_OTHER)
+PKT_RECV(STORE)
+PKT_RECV(STORE_INFO)
+PKT_RECV(SELL)
+PKT_RECV(TARGET_INFO)
+PKT_RECV(SOUND)
+PKT_RECV(MINI_MAP)
+PKT_RECV(SPECIAL_LINE)
+PKT_RECV(FLOOR)
+PKT_RECV(PICKUP_CHECK)
+PKT_RECV(PARTY)
+PKT_RECV(GUILD)
+PKT_RECV(GUILD_CFG)
+PKT_RECV(PARTY_STATS)
+PKT_RECV(SKILLS)
+PKT_RECV(PAUSE)
+PKT_RECV(MONSTER_HEALTH)
+PKT_RECV(SANITY)
+PKT_RECV(SKILL_INIT)
+PKT_RECV(SKILL_MOD)
+PKT_RECV(SKILL_PTS)
+PKT_RECV(STORE_LEAVE)
+PKT_RECV(CHARDUMP)
+PKT_RECV(BACT)
+PKT_RECV(BEEP)
+PKT_RECV(WARNING_BEEP)
+PKT_RECV(AFK)
+PKT_RECV(ENCUMBERMENT)
+PKT_RECV(KEEPALIVE)
+PKT_RECV(PING)
+PKT_RECV(STAMINA)
+PKT_RECV(TECHNIQUE_INFO)
+PKT_RECV(EXTRA_STATUS)
+PKT_RECV(INVEN_WIDE)
+PKT_RECV(UNIQUE_MONSTER)
+PKT_RECV(WEATHER)
+PKT_RECV(INVENTORY_REV)
+PKT_RECV(ACCOUNT_INFO)
+PKT_RECV(STORE_WIDE)
+PKT_RECV(MUSIC)
+PKT_RECV(BONI_COL)
+PKT_RECV(AUTOINSCRIBE)
+PKT_RECV(ITEM_NEWEST)
+PKT_RECV(ITEM_NEWEST_2ND)
+PKT_RECV(CONFIRM)
+PKT_RECV(KEYPRESS)
+PKT_RECV(SFX_VOLUME)
+PKT_RECV(SFX_AMBIENT)
+PKT_RECV(MINI_MAP_POS)
+PKT_RECV(REQUEST_KEY)
+PKT_RECV(REQUEST_AMT)
+PKT_RECV(REQUEST_NUM)
+PKT_RECV(REQUEST_STR)
+PKT_RECV(REQUEST_CFR)
+PKT_RECV(REQUEST_ABORT)
+PKT_RECV(STORE_SPECIAL_STR)
+PKT_RECV(STORE_SPECIAL_CHAR)
+PKT_RECV(STORE_SPECIAL_CLR)
+PKT_RECV(STORE_SPECIAL_ANIM)
+PKT_RECV(MARTYR)
+PKT_RECV(PALETTE)
+PKT_RECV(IDLE)
+PKT_RECV(POWERS_INFO)
+PKT_RECV(GUIDE)
+PKT_RECV(INDICATORS)
+PKT_RECV(PLAYERLIST)
+PKT_RECV(WEATHERCOL)
+PKT_RECV(MUSIC_VOL)
+PKT_RECV(WHATS_UNDER_YOUR_FEET)
+PKT_RECV(SCREENFLASH)
+PKT_RECV(SI_MOVE)
+PKT_RECV(SPECIAL_LINE_POS)
+PKT_RECV(VERSION)
+PKT_RECV(EQUIP_WIDE)
+PKT_RECV(SFLAGS)
+PKT_RECV(CHAR_DIRECT)
+PKT_RECV(MACRO_FAILURE)
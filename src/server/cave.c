@@ -7,6 +7,9 @@
 
 #include "angband.h"
 
+/* For gettimeofday() */
+#include <sys/time.h>
+
 /*
  * monsters with 'RF1_ATTR_MULTI' uses colour according to their
  * breath if it is on. (possible bottleneck, tho)
@@ -571,11 +574,15 @@ void new_players_on_depth(struct worldpos *wpos, int value, bool inc) {
 
 		if (!l_ptr->ondepth) l_ptr->lastused = 0;
 		if (value > 0) l_ptr->lastused = now;
+		l_ptr->dirty = TRUE;
+		floor_lru_update(wpos, value > 0);
 	} else {
 		w_ptr->surface.ondepth = (inc ? w_ptr->surface.ondepth + value : value);
 		if (w_ptr->surface.ondepth < 0) w_ptr->surface.ondepth = 0;
 		if (!w_ptr->surface.ondepth) w_ptr->surface.lastused = 0;
 		if (value > 0) w_ptr->surface.lastused = now;
+		w_ptr->surface.dirty = TRUE;
+		floor_lru_update(wpos, value > 0);
 		/* remove 'deposited' true artefacts if last player leaves a level,
 		   and if true artefacts aren't allowed to be stored (in houses for example) */
 		if (!w_ptr->surface.ondepth && cfg.anti_arts_wild) {
@@ -940,6 +947,122 @@ int players_on_depth(struct worldpos *wpos) {
 	return(d_ptr->level[ABS(wpos->wz) - 1].ondepth);
 }
 
+/*
+ * Resident floor LRU: All floors that are allocated or still static (ondepth) are kept in
+ * a circular list, least recently used first, so purge_old() only has to walk these
+ * instead of every sector and dungeon floor of the world map.
+ * Entry 0 is the list head, which is also why l_ptr->lru_idx == 0 means 'not tracked'.
+ */
+typedef struct floor_lru_entry floor_lru_entry;
+struct floor_lru_entry {
+	struct worldpos wpos;
+	int prev, next;		/* for free entries, 'next' links the free list */
+};
+static floor_lru_entry *floor_lru = NULL;
+static int floor_lru_size = 0, floor_lru_free = 0, floor_lru_cursor = 0;
+int floor_lru_num = 0, floors_allocated = 0;
+
+static void floor_lru_unlink(int i) {
+	/* Don't let a running walk lose its place */
+	if (floor_lru_cursor == i) floor_lru_cursor = floor_lru[i].next;
+
+	floor_lru[floor_lru[i].prev].next = floor_lru[i].next;
+	floor_lru[floor_lru[i].next].prev = floor_lru[i].prev;
+}
+
+/* Append to the most recently used end */
+static void floor_lru_link(int i) {
+	floor_lru[i].prev = floor_lru[0].prev;
+	floor_lru[i].next = 0;
+	floor_lru[floor_lru[0].prev].next = i;
+	floor_lru[0].prev = i;
+}
+
+static void floor_lru_drop(int i) {
+	floor_lru_unlink(i);
+	floor_lru[i].next = floor_lru_free;
+	floor_lru_free = i;
+	floor_lru_num--;
+}
+
+/* Start tracking/stop tracking a floor depending on whether it is allocated or static.
+   'touch' marks it as just used, moving it to the end of the list. */
+void floor_lru_update(struct worldpos *wpos, bool touch) {
+	dun_level *l_ptr = getfloor(wpos);
+	int i;
+
+	if (!l_ptr) return;
+
+	if (!l_ptr->cave && !l_ptr->ondepth) {
+		if (l_ptr->lru_idx) floor_lru_drop(l_ptr->lru_idx);
+		l_ptr->lru_idx = 0;
+		return;
+	}
+
+	if ((i = l_ptr->lru_idx)) {
+		if (touch) {
+			floor_lru_unlink(i);
+			floor_lru_link(i);
+		}
+		return;
+	}
+
+	/* Not tracked yet */
+	if (!floor_lru_size) {
+		floor_lru_size = 256;
+		C_MAKE(floor_lru, floor_lru_size, floor_lru_entry);
+		floor_lru[0].prev = floor_lru[0].next = 0;
+	}
+	if (floor_lru_free) {
+		i = floor_lru_free;
+		floor_lru_free = floor_lru[i].next;
+	} else {
+		if (floor_lru_num + 1 >= floor_lru_size) {
+			GROW(floor_lru, floor_lru_size, floor_lru_size * 2, floor_lru_entry);
+			floor_lru_size *= 2;
+		}
+		i = floor_lru_num + 1;
+	}
+	wpcopy(&floor_lru[i].wpos, wpos);
+	floor_lru_link(i);
+	floor_lru_num++;
+	l_ptr->lru_idx = i;
+}
+
+/* Forget a floor for good, eg when its dungeon gets removed */
+void floor_lru_remove(struct worldpos *wpos) {
+	dun_level *l_ptr = getfloor(wpos);
+
+	if (!l_ptr || !l_ptr->lru_idx) return;
+	floor_lru_drop(l_ptr->lru_idx);
+	l_ptr->lru_idx = 0;
+}
+
+/* Walk all tracked floors, least recently used first. Floors that get dropped or touched
+   meanwhile are handled gracefully (touched ones just come up again at the end). */
+void floor_lru_walk_start(void) {
+	floor_lru_cursor = floor_lru_size ? floor_lru[0].next : 0;
+}
+bool floor_lru_walk_next(struct worldpos *wpos) {
+	dun_level *l_ptr;
+	int i;
+
+	while ((i = floor_lru_cursor)) {
+		floor_lru_cursor = floor_lru[i].next;
+
+		/* Paranoia: Entry went stale, eg the floor struct was wiped or its dungeon removed without telling us */
+		if (!(l_ptr = getfloor(&floor_lru[i].wpos)) || l_ptr->lru_idx != i) {
+			s_printf("FLOOR_LRU: dropping stale entry %s.\n", wpos_format(0, &floor_lru[i].wpos));
+			floor_lru_drop(i);
+			continue;
+		}
+
+		wpcopy(wpos, &floor_lru[i].wpos);
+		return(TRUE);
+	}
+	return(FALSE);
+}
+
 /* Don't determine wilderness level just from town radius, but also from the
    level of that town? */
 #define WILD_LEVEL_DEPENDS_ON_TOWN
@@ -1114,12 +1237,12 @@ static bool is_wall(cave_type *c_ptr) {
  */
 #ifdef DOUBLE_LOS_SAFETY
 static bool los_DLS(struct worldpos *wpos, int y1, int x1, int y2, int x2);
-bool los(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
+static bool los_nocache(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
 	return(los_DLS(wpos, y1, x1, y2, x2) || los_DLS(wpos, y2, x2, y1, x1));
 }
 static bool los_DLS(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
 #else
-bool los(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
+static bool los_nocache(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
 #endif
 	/* Delta */
 	int dx, dy;
@@ -1297,12 +1420,12 @@ bool los(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
 /* Same as los, just ignores non-perma-wall grids - for monster targetting - C. Blue */
 #ifdef DOUBLE_LOS_SAFETY
 static bool los_wall_DLS(struct worldpos *wpos, int y1, int x1, int y2, int x2);
-bool los_wall(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
+static bool los_wall_nocache(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
 	return(los_wall_DLS(wpos, y1, x1, y2, x2) || los_wall_DLS(wpos, y2, x2, y1, x1));
 }
 static bool los_wall_DLS(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
 #else
-bool los_wall(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
+static bool los_wall_nocache(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
 #endif
 	/* Delta */
 	int dx, dy;
@@ -8747,6 +8870,7 @@ int cave_set_feat(worldpos *wpos, int y, int x, int feat) {
 
 	/* Change the feature */
 	c_ptr->feat = feat;
+	bump_feat_epoch(wpos);
 	if (f_info[feat].flags2 & FF2_GLOW) c_ptr->info |= CAVE_GLOW;
 	if (f_info[feat].flags2 & FF2_SHINE) rad++;
 	if (f_info[feat].flags2 & FF2_SHINE2) rad += 2;
@@ -9051,6 +9175,7 @@ bool cave_set_feat_live(worldpos *wpos, int y, int x, int feat) {
 	if (c_ptr->feat != feat) c_ptr->info &= ~(CAVE_NEST_PIT | CAVE_ENCASED); /* clear teleport protection for nest grid if it gets changed; clear treasure vein remote-flag too */
 	old_feat = c_ptr->feat;
 	c_ptr->feat = feat;
+	bump_feat_epoch(wpos);
 	if (f_info[feat].flags2 & FF2_GLOW) c_ptr->info |= CAVE_GLOW;
 	if (f_info[feat].flags2 & FF2_SHINE) rad++;
 	if (f_info[feat].flags2 & FF2_SHINE2) rad += 2;
@@ -9133,6 +9258,7 @@ bool cave_force_feat_live(worldpos *wpos, int y, int x, int feat) {
 	if (c_ptr->feat != feat) c_ptr->info &= ~(CAVE_NEST_PIT | CAVE_ENCASED); /* clear teleport protection for nest grid if it gets changed; clear treasure vein remote-flag too */
 	old_feat = c_ptr->feat;
 	c_ptr->feat = feat;
+	bump_feat_epoch(wpos);
 	if (f_info[feat].flags2 & FF2_GLOW) c_ptr->info |= CAVE_GLOW;
 	if (f_info[feat].flags2 & FF2_SHINE) rad++;
 	if (f_info[feat].flags2 & FF2_SHINE2) rad += 2;
@@ -9344,12 +9470,12 @@ void mmove2(int *y, int *x, int y1, int x1, int y2, int x2) {
 
 #ifdef DOUBLE_LOS_SAFETY
 static bool projectable_DLS(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range);
-bool projectable(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
+static bool projectable_nocache(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
 	return(projectable_DLS(wpos, y1, x1, y2, x2, range) || projectable_DLS(wpos, y2, x2, y1, x1, range));
 }
 static bool projectable_DLS(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
 #else
-bool projectable(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
+static bool projectable_nocache(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
 #endif
 	int dist, y, x;
 	cave_type **zcave;
@@ -9392,12 +9518,12 @@ bool projectable(struct worldpos *wpos, int y1, int x1, int y2, int x2, int rang
 /* Same as projectable(), but allows targetting the first grid in a wall */
 #ifdef DOUBLE_LOS_SAFETY
 static bool projectable_wall_DLS(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range);
-bool projectable_wall(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
+static bool projectable_wall_nocache(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
 	return(projectable_wall_DLS(wpos, y1, x1, y2, x2, range) || projectable_wall_DLS(wpos, y2, x2, y1, x1, range));
 }
 static bool projectable_wall_DLS(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
 #else
-bool projectable_wall(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
+static bool projectable_wall_nocache(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
 #endif
 	int dist, y, x;
 	cave_type **zcave;
@@ -9437,6 +9563,157 @@ bool projectable_wall(struct worldpos *wpos, int y1, int x1, int y2, int x2, int
 	return(FALSE);
 }
 
+/*
+ * Cache for the purely terrain-dependant los()/projectable() checks.
+ * Monster AI asks the same (monster, player) questions over and over while
+ * the terrain of a floor hardly ever changes, so remember the answers per
+ * floor. Each entry is tagged with the floor's feat_epoch, which gets bumped
+ * by bump_feat_epoch() whenever a grid feature on that floor is changed,
+ * invalidating all entries at once.
+ */
+#ifdef LOS_CACHE
+ #define LOS_CACHE_BITS		11	/* 2048 entries per floor */
+ #define LOS_CACHE_SIZE		(1 << LOS_CACHE_BITS)
+
+ #define LOSC_LOS		0
+ #define LOSC_LOS_WALL		1
+ #define LOSC_PROJ		2
+ #define LOSC_PROJ_WALL		3
+
+struct los_cache_entry {
+	u32b key;	/* query type and both endpoints, packed */
+	u32b epoch;	/* feat_epoch of the floor at the time the result was stored */
+	byte range;
+	bool result;
+};
+
+bool los_cache_enabled = TRUE;
+bool los_cache_verify = FALSE; /* Always compute uncached too and complain about any difference */
+u32b los_cache_hits = 0, los_cache_misses = 0, los_cache_mismatches = 0;
+
+static bool los_by_type(int type, struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
+	switch (type) {
+	case LOSC_LOS: return(los_nocache(wpos, y1, x1, y2, x2));
+	case LOSC_LOS_WALL: return(los_wall_nocache(wpos, y1, x1, y2, x2));
+	case LOSC_PROJ: return(projectable_nocache(wpos, y1, x1, y2, x2, range));
+	}
+	return(projectable_wall_nocache(wpos, y1, x1, y2, x2, range));
+}
+
+static bool los_cached(int type, struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
+	dun_level *l_ptr;
+	struct los_cache_entry *e;
+	u32b key, h;
+	bool res;
+
+	/* Out-of-bounds endpoints (eg ball spells in project()) and unusual ranges aren't worth caching */
+	if (!los_cache_enabled || !in_bounds_array(y1, x1) || !in_bounds_array(y2, x2) || range < 0 || range > 255
+	    || !getcave(wpos) || !(l_ptr = getfloor(wpos)))
+		return(los_by_type(type, wpos, y1, x1, y2, x2, range));
+
+	if (!l_ptr->los_cache) {
+		C_MAKE(l_ptr->los_cache, LOS_CACHE_SIZE, struct los_cache_entry);
+		/* Epoch 0 is reserved for unused entries */
+		if (!l_ptr->feat_epoch) l_ptr->feat_epoch = 1;
+	}
+
+	/* y < 128 and x < 256 (MAX_HGT, MAX_WID) */
+	key = ((u32b)type << 30) | ((u32b)y1 << 23) | ((u32b)x1 << 15) | ((u32b)y2 << 8) | (u32b)x2;
+	h = ((key ^ ((u32b)range * 0x9E3779B1U)) * 2654435761U) >> (32 - LOS_CACHE_BITS);
+	e = &l_ptr->los_cache[h];
+
+	if (e->epoch == l_ptr->feat_epoch && e->key == key && e->range == range) {
+		los_cache_hits++;
+		if (los_cache_verify) {
+			res = los_by_type(type, wpos, y1, x1, y2, x2, range);
+			if (res != e->result) {
+				los_cache_mismatches++;
+				s_printf("LOS_CACHE: mismatch type %d (%d,%d)->(%d,%d) r%d at %s: cached %d, real %d\n",
+				    type, x1, y1, x2, y2, range, wpos_format(0, wpos), e->result, res);
+				/* Trust the real thing and repair the entry */
+				e->result = res;
+			}
+		}
+		return(e->result);
+	}
+
+	los_cache_misses++;
+	res = los_by_type(type, wpos, y1, x1, y2, x2, range);
+
+	/* Note: projectable() recurses into los(), which may have reused this very slot meanwhile */
+	e->key = key;
+	e->epoch = l_ptr->feat_epoch;
+	e->range = range;
+	e->result = res;
+	return(res);
+}
+
+/* Called when a floor gets deallocated */
+void free_los_cache(dun_level *l_ptr) {
+	if (!l_ptr->los_cache) return;
+	C_KILL(l_ptr->los_cache, LOS_CACHE_SIZE, struct los_cache_entry);
+	l_ptr->feat_epoch = 0;
+}
+
+/* Memory currently used by all los caches, for /loscache */
+int los_cache_count(void) {
+	int x, y, z, n = 0;
+	wilderness_type *w_ptr;
+
+	for (y = 0; y < MAX_WILD_Y; y++)
+	for (x = 0; x < MAX_WILD_X; x++) {
+		w_ptr = &wild_info[y][x];
+		if (w_ptr->surface.los_cache) n++;
+		if (w_ptr->tower) for (z = 0; z < w_ptr->tower->maxdepth; z++)
+			if (w_ptr->tower->level[z].los_cache) n++;
+		if (w_ptr->dungeon) for (z = 0; z < w_ptr->dungeon->maxdepth; z++)
+			if (w_ptr->dungeon->level[z].los_cache) n++;
+	}
+	return(n);
+}
+#endif
+
+/* Called on any feature change: invalidate all cached los results of the floor
+   and have the floor file rewritten on the next server save */
+void bump_feat_epoch(struct worldpos *wpos) {
+	dun_level *l_ptr;
+
+	if (!getcave(wpos) || !(l_ptr = getfloor(wpos))) return;
+	l_ptr->dirty = TRUE;
+#ifdef LOS_CACHE
+	if (!++l_ptr->feat_epoch) l_ptr->feat_epoch = 1;
+#endif
+}
+
+bool los(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
+#ifdef LOS_CACHE
+	return(los_cached(LOSC_LOS, wpos, y1, x1, y2, x2, 0));
+#else
+	return(los_nocache(wpos, y1, x1, y2, x2));
+#endif
+}
+bool los_wall(struct worldpos *wpos, int y1, int x1, int y2, int x2) {
+#ifdef LOS_CACHE
+	return(los_cached(LOSC_LOS_WALL, wpos, y1, x1, y2, x2, 0));
+#else
+	return(los_wall_nocache(wpos, y1, x1, y2, x2));
+#endif
+}
+bool projectable(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
+#ifdef LOS_CACHE
+	return(los_cached(LOSC_PROJ, wpos, y1, x1, y2, x2, range));
+#else
+	return(projectable_nocache(wpos, y1, x1, y2, x2, range));
+#endif
+}
+bool projectable_wall(struct worldpos *wpos, int y1, int x1, int y2, int x2, int range) {
+#ifdef LOS_CACHE
+	return(los_cached(LOSC_PROJ_WALL, wpos, y1, x1, y2, x2, range));
+#else
+	return(projectable_wall_nocache(wpos, y1, x1, y2, x2, range));
+#endif
+}
+
 /* like projectable_wall(), but assumes that only _permanent walls_ are really obstacles to us
    (for movement strategies of PASS_WALL/KILL_WALL monsters) - C. Blue */
 #ifdef DOUBLE_LOS_SAFETY
@@ -9483,7 +9760,7 @@ bool projectable_wall_perm(struct worldpos *wpos, int y1, int x1, int y2, int x2
 #ifdef DOUBLE_LOS_SAFETY
 static bool projectable_real_DLS(int Ind, int y1, int x1, int y2, int x2, int range);
 bool projectable_real(int Ind, int y1, int x1, int y2, int x2, int range) {
-	return((projectable_DLS(&Players[Ind]->wpos, y1, x1, y2, x2, range) || projectable_DLS(&Players[Ind]->wpos, y2, x2, y1, x1, range))
+	return(projectable(&Players[Ind]->wpos, y1, x1, y2, x2, range)
 	    /* important: make sure we really don't hit an awake monster from our direction of shooting :-p  : */
 	    && projectable_real_DLS(Ind, y1, x1, y2, x2, range));
 }
@@ -9557,7 +9834,7 @@ bool projectable_real(int Ind, int y1, int x1, int y2, int x2, int range) {
 #ifdef DOUBLE_LOS_SAFETY
 static bool projectable_wall_real_DLS(int Ind, int y1, int x1, int y2, int x2, int range);
 bool projectable_wall_real(int Ind, int y1, int x1, int y2, int x2, int range) {
-	return((projectable_wall_DLS(&Players[Ind]->wpos, y1, x1, y2, x2, range) || projectable_wall_DLS(&Players[Ind]->wpos, y2, x2, y1, x1, range))
+	return(projectable_wall(&Players[Ind]->wpos, y1, x1, y2, x2, range)
 	    /* important: make sure we really don't hit an awake monster from our direction of shooting :-p  : */
 	    && projectable_wall_real_DLS(Ind, y1, x1, y2, x2, range));
 }
@@ -9880,15 +10157,220 @@ bool is_xorder(struct worldpos *wpos) {
 /*
  * handle spell effects
  */
+
+/* Live effects are kept in a dense list (effects_active[]) with a stack of
+   free slots, so neither allocation nor processing has to scan all MAX_EFFECTS
+   slots. In addition each live effect is hooked into a timing wheel keyed by
+   the turn it is due to fire next, so process_effects() only touches effects
+   that actually tick in the current turn. - effects[0] is never used. */
+#define EFFECT_WHEEL_SIZE	64	/* must be a power of 2 */
+#define EFFECT_WHEEL_DUE	EFFECT_WHEEL_SIZE /* extra list: effects popped for the current turn */
+
+int effects_active[MAX_EFFECTS], effects_active_num = 0;
+static int effect_active_pos[MAX_EFFECTS];
+static int effects_free[MAX_EFFECTS], effects_free_num = 0;
+static bool effects_initialized = FALSE;
+
+static int effect_wheel[EFFECT_WHEEL_SIZE + 1];
+static int effect_wheel_slot[MAX_EFFECTS], effect_wheel_prev[MAX_EFFECTS], effect_wheel_next[MAX_EFFECTS];
+static s32b effect_fire_turn[MAX_EFFECTS];
+static s32b effects_wheel_turn = -1; /* last turn that the wheel was advanced to */
+
+/* Spatial index: live effects are also chained into buckets hashed by their
+   floor, so per-floor and per-grid lookups only look at effects on that floor
+   (plus the occasional hash collision) instead of at all active effects. */
+#define EFFECT_FLOOR_HASH	256	/* must be a power of 2 */
+static int effect_floor[EFFECT_FLOOR_HASH];
+static int effect_floor_prev[MAX_EFFECTS], effect_floor_next[MAX_EFFECTS];
+
+/* Effects that move, grow or get redrawn every tick re-imprint their grids themselves.
+   All others (clouds, fire walls..) are only imprinted once, when they are created. */
+#define EFF_CHANGING	(EFF_WAVE | EFF_THINWAVE | EFF_STORM | EFF_VORTEX | EFF_SEEKER | EFF_METEOR | \
+			EFF_CROSSHAIR_A | EFF_CROSSHAIR_B | EFF_CROSSHAIR_C | EFF_FALLING_STAR | \
+			EFF_LIGHTNING1 | EFF_LIGHTNING2 | EFF_LIGHTNING3 | EFF_RAINING | EFF_SNOWING | \
+			EFF_FIREWORKS1 | EFF_FIREWORKS2 | EFF_FIREWORKS3)
+
+static void effects_init(void) {
+	int i;
+
+	for (i = 0; i < MAX_EFFECTS; i++) {
+		effect_active_pos[i] = -1;
+		effect_wheel_slot[i] = -1;
+	}
+	for (i = 0; i <= EFFECT_WHEEL_SIZE; i++) effect_wheel[i] = -1;
+	for (i = 0; i < EFFECT_FLOOR_HASH; i++) effect_floor[i] = -1;
+
+	/* Push in reverse order, so low indices get handed out first, as before */
+	effects_free_num = 0;
+	for (i = MAX_EFFECTS - 1; i >= 1; i--) effects_free[effects_free_num++] = i;
+	effects_active_num = 0;
+
+	effects_initialized = TRUE;
+}
+
+static void effect_wheel_unlink(int k) {
+	int slot = effect_wheel_slot[k];
+
+	if (slot == -1) return;
+
+	if (effect_wheel_prev[k] != -1) effect_wheel_next[effect_wheel_prev[k]] = effect_wheel_next[k];
+	else effect_wheel[slot] = effect_wheel_next[k];
+	if (effect_wheel_next[k] != -1) effect_wheel_prev[effect_wheel_next[k]] = effect_wheel_prev[k];
+
+	effect_wheel_slot[k] = -1;
+}
+
+static void effect_wheel_link(int k, int slot) {
+	effect_wheel_slot[k] = slot;
+	effect_wheel_prev[k] = -1;
+	effect_wheel_next[k] = effect_wheel[slot];
+	if (effect_wheel[slot] != -1) effect_wheel_prev[effect_wheel[slot]] = k;
+	effect_wheel[slot] = k;
+}
+
+static int effect_floor_hash(struct worldpos *wpos) {
+	return((wpos->wx + wpos->wy * MAX_WILD_X + (wpos->wz + 128) * 97) & (EFFECT_FLOOR_HASH - 1));
+}
+
+static void effect_floor_link(int k) {
+	int h = effect_floor_hash(&effects[k].wpos);
+
+	effect_floor_prev[k] = -1;
+	effect_floor_next[k] = effect_floor[h];
+	if (effect_floor[h] != -1) effect_floor_prev[effect_floor[h]] = k;
+	effect_floor[h] = k;
+}
+
+static void effect_floor_unlink(int k) {
+	if (effect_floor_prev[k] != -1) effect_floor_next[effect_floor_prev[k]] = effect_floor_next[k];
+	else effect_floor[effect_floor_hash(&effects[k].wpos)] = effect_floor_next[k];
+	if (effect_floor_next[k] != -1) effect_floor_prev[effect_floor_next[k]] = effect_floor_prev[k];
+}
+
+/* Find a live unchanging effect other than 'except' that covers a grid, or 0 if there is none.
+   Used when an effect leaves a grid, so an older cloud that got painted over by it takes the
+   grid back instead of leaving a hole in itself for the rest of its duration. */
+int effect_grid_cover(struct worldpos *wpos, int y, int x, int except) {
+	effect_type *e_ptr;
+	int k;
+
+	if (!effects_initialized) return(0);
+
+	for (k = effect_floor[effect_floor_hash(wpos)]; k != -1; k = effect_floor_next[k]) {
+		e_ptr = &effects[k];
+		if (k == except || e_ptr->time <= 0 || (e_ptr->flags & EFF_CHANGING)) continue;
+		if (!inarea(&e_ptr->wpos, wpos)) continue;
+		if (distance(e_ptr->cy, e_ptr->cx, y, x) > e_ptr->rad) continue;
+		if (e_ptr->rad && !projectable(wpos, e_ptr->cy, e_ptr->cx, y, x, MAX_RANGE)) continue;
+		return(k);
+	}
+	return(0);
+}
+
+/* (Re)schedule an effect for the next turn that satisfies its interval, which
+   depends on the floor's level_speed(). This is the same turn at which the old
+   'turn % period' check used to let it pass. */
+void effect_schedule(int k) {
+	effect_type *e_ptr = &effects[k];
+	s32b period = e_ptr->interval * level_speed(&e_ptr->wpos) / (level_speeds[0] * 5), t;
+
+	if (period < 1) period = 1;
+	t = turn - (turn % period);
+	/* Don't schedule for a turn that process_effects() already handled */
+	if (t <= effects_wheel_turn) t += period * ((effects_wheel_turn - t) / period + 1);
+
+	effect_wheel_unlink(k);
+	effect_fire_turn[k] = t;
+	effect_wheel_link(k, t & (EFFECT_WHEEL_SIZE - 1));
+}
+
+/* The turn counter was reset: fire turns and the wheel position are from the old count */
+void effects_reschedule(void) {
+	int i;
+
+	if (!effects_initialized) return;
+	effects_wheel_turn = turn - 1;
+	for (i = 0; i < effects_active_num; i++) effect_schedule(effects_active[i]);
+}
+
+/* Advance the wheel to the current turn: Move the current bucket to the 'due' list. */
+void effects_collect_due(void) {
+	int k, slot = turn & (EFFECT_WHEEL_SIZE - 1);
+
+	if (!effects_initialized) effects_init();
+	effects_wheel_turn = turn;
+
+	while ((k = effect_wheel[slot]) != -1) {
+		effect_wheel_unlink(k);
+		effect_wheel_link(k, EFFECT_WHEEL_DUE);
+	}
+}
+
+/* Get the next effect that is due to fire this turn, or -1 if none is left.
+   Effects that are merely a full wheel revolution (or more) ahead go back into their bucket.
+   Popping one at a time is safe against erase_effects() being called on any other effect meanwhile. */
+int effect_next_due(void) {
+	int k;
+
+	while ((k = effect_wheel[EFFECT_WHEEL_DUE]) != -1) {
+		effect_wheel_unlink(k);
+		if (effect_fire_turn[k] > turn) {
+			effect_wheel_link(k, effect_fire_turn[k] & (EFFECT_WHEEL_SIZE - 1));
+			continue;
+		}
+		return(k);
+	}
+	return(-1);
+}
+
+/* Give an effect slot back. Does not touch the grids, that's up to erase_effects(). */
+void effect_release(int k) {
+	int pos = effect_active_pos[k];
+
+	if (!effects_initialized || pos == -1) return;
+
+	effect_wheel_unlink(k);
+	effect_floor_unlink(k);
+
+	effects_active_num--;
+	effects_active[pos] = effects_active[effects_active_num];
+	effect_active_pos[effects_active[pos]] = pos;
+	effect_active_pos[k] = -1;
+
+	effects_free[effects_free_num++] = k;
+}
+
+/* Erase all effects on a floor, eg when it gets deallocated */
+void erase_floor_effects(struct worldpos *wpos) {
+	int k, next;
+
+	if (!effects_initialized) return;
+
+	for (k = effect_floor[effect_floor_hash(wpos)]; k != -1; k = next) {
+		/* Erasing unhooks it */
+		next = effect_floor_next[k];
+		if (inarea(&effects[k].wpos, wpos)) erase_effects(k);
+	}
+}
+
 static int effect_pop(int who_id) {
 	int i, cnt = 0;
 
-	for (i = 1; i < MAX_EFFECTS; i++) { /* effects[0] is not used */
-		if (!effects[i].time) return(i);
-		if (effects[i].who_id != who_id) continue;
-		if (++cnt > MAX_EFFECTS_PLAYER) return(-1);
+	if (!effects_initialized) effects_init();
+	if (!effects_free_num) return(-1);
+
+	/* Only players are limited, and only if they could actually have hit the limit */
+	if (who_id && effects_active_num >= MAX_EFFECTS_PLAYER) {
+		for (i = 0; i < effects_active_num; i++) {
+			if (effects[effects_active[i]].who_id != who_id) continue;
+			if (++cnt >= MAX_EFFECTS_PLAYER) return(-1);
+		}
 	}
-	return(-1);
+
+	i = effects_free[--effects_free_num];
+	effect_active_pos[i] = effects_active_num;
+	effects_active[effects_active_num++] = i;
+	return(i);
 }
 
 int new_effect(int who, int type, int dam, int time, int interval, worldpos *wpos, int cy, int cx, int rad, s32b flags) {
@@ -9941,6 +10423,9 @@ int new_effect(int who, int type, int dam, int time, int interval, worldpos *wpo
 	effects[i].who_id = who_id;
 	wpcopy(&effects[i].wpos, wpos);
 
+	effect_floor_link(i);
+	effect_schedule(i);
+
 #ifdef ARCADE_SERVER
 	if (type == 209) {
 		msg_broadcast(0, "mh");
@@ -10376,3 +10861,221 @@ void slippery_floor(int oily, struct worldpos *wpos, int x, int y) {
 			msg_print(Ind, "The floor is already completely covered in oil.");
 	}
 }
+
+
+/*
+ * Spatial queries on a floor.
+ *
+ * The grid of a floor already knows which monster (m_idx > 0) and which object
+ * pile (o_idx) occupies each grid, and everything that places, moves or removes
+ * them keeps it up to date. So instead of scanning the whole m_list (monsters of
+ * all floors) and discarding those on other floors or out of range, these walk
+ * the grids of the requested area, which costs O(area) no matter how many
+ * monsters exist on the server.
+ *
+ * All of them write up to 'max' indices into 'list' and return the number
+ * written. An optional 'hook' may reject entries.
+ *
+ * Whole-floor effects should keep walking m_list instead: a floor has far
+ * fewer monsters than grids.
+ */
+
+/* Lists for the results of the queries below. Callers usually run arbitrary
+   code (messages, Lua hooks) for each entry, which may start another query,
+   so each caller takes a list with floor_query_begin() and hands it back to
+   floor_query_end() once done. Only unusually deep nesting needs the heap. */
+#define FLOOR_QUERY_DEPTH	2
+static s16b floor_query_lists[FLOOR_QUERY_DEPTH][FLOOR_QUERY_MAX];
+static int floor_query_depth = 0;
+
+s16b *floor_query_begin(void) {
+	s16b *list;
+
+	if (floor_query_depth < FLOOR_QUERY_DEPTH) return(floor_query_lists[floor_query_depth++]);
+	C_MAKE(list, FLOOR_QUERY_MAX, s16b);
+	return(list);
+}
+
+void floor_query_end(s16b *list) {
+	if (floor_query_depth && list == floor_query_lists[floor_query_depth - 1]) floor_query_depth--;
+	else C_KILL(list, FLOOR_QUERY_MAX, s16b);
+}
+
+/* Monsters within the rectangle y1,x1 - y2,x2 (inclusive) */
+int floor_monsters_rect(cave_type **zcave, int y1, int x1, int y2, int x2, bool (*hook)(int m_idx), s16b *list, int max) {
+	int y, x, m_idx, n = 0;
+
+	if (y1 < 0) y1 = 0;
+	if (x1 < 0) x1 = 0;
+	if (y2 > MAX_HGT - 1) y2 = MAX_HGT - 1;
+	if (x2 > MAX_WID - 1) x2 = MAX_WID - 1;
+
+	for (y = y1; y <= y2; y++) {
+		cave_type *c_ptr = &zcave[y][x1];
+
+		for (x = x1; x <= x2; x++, c_ptr++) {
+			if ((m_idx = c_ptr->m_idx) <= 0) continue;
+			if (hook && !hook(m_idx)) continue;
+			list[n++] = m_idx;
+			if (n == max) return(n);
+		}
+	}
+	return(n);
+}
+
+/* Monsters within distance() 'rad' of y,x */
+int floor_monsters_radius(cave_type **zcave, int y, int x, int rad, bool (*hook)(int m_idx), s16b *list, int max) {
+	int y1 = y - rad, x1 = x - rad, y2 = y + rad, x2 = x + rad, ty, tx, m_idx, n = 0;
+
+	if (y1 < 0) y1 = 0;
+	if (x1 < 0) x1 = 0;
+	if (y2 > MAX_HGT - 1) y2 = MAX_HGT - 1;
+	if (x2 > MAX_WID - 1) x2 = MAX_WID - 1;
+
+	for (ty = y1; ty <= y2; ty++) {
+		cave_type *c_ptr = &zcave[ty][x1];
+
+		for (tx = x1; tx <= x2; tx++, c_ptr++) {
+			if ((m_idx = c_ptr->m_idx) <= 0) continue;
+			if (distance(y, x, ty, tx) > rad) continue;
+			if (hook && !hook(m_idx)) continue;
+			list[n++] = m_idx;
+			if (n == max) return(n);
+		}
+	}
+	return(n);
+}
+
+/* The (up to) k monsters closest to y,x within distance() 'rad', closest first.
+   Equally distant monsters are ordered by index, like a scan of m_list finds them.
+   Searches in square rings outwards, as distance() is never smaller than the
+   ring number it can stop once a ring lies beyond the k-th best distance. */
+int floor_monsters_nearest(cave_type **zcave, int y, int x, int rad, bool (*hook)(int m_idx), s16b *list, int k) {
+	int d, i, ty, tx, step, m_idx, dis, n = 0;
+	monster_type *m_ptr;
+
+	if (k <= 0) return(0);
+
+	for (d = 0; d <= rad; d++) {
+		/* The remaining rings can't hold anything closer */
+		if (n == k && (m_ptr = &m_list[list[k - 1]]) && d > distance(y, x, m_ptr->fy, m_ptr->fx)) break;
+		/* The ring lies completely outside of the floor, and so will the following ones */
+		if (y - d < 0 && y + d >= MAX_HGT && x - d < 0 && x + d >= MAX_WID) break;
+
+		for (ty = (y - d < 0 ? 0 : y - d); ty <= y + d && ty < MAX_HGT; ty++) {
+
+			/* Whole top and bottom row of the ring, only its two ends in between */
+			step = (ty == y - d || ty == y + d) ? 1 : 2 * d;
+			for (tx = x - d; tx <= x + d; tx += step) {
+				if (tx < 0 || tx >= MAX_WID) continue;
+				if ((m_idx = zcave[ty][tx].m_idx) <= 0) continue;
+				if ((dis = distance(y, x, ty, tx)) > rad) continue;
+				if (hook && !hook(m_idx)) continue;
+
+				/* Insert sorted by distance, then by index */
+				for (i = n; i > 0; i--) {
+					m_ptr = &m_list[list[i - 1]];
+					if (distance(y, x, m_ptr->fy, m_ptr->fx) < dis ||
+					    (distance(y, x, m_ptr->fy, m_ptr->fx) == dis && list[i - 1] < m_idx))
+						break;
+					if (i < k) list[i] = list[i - 1];
+				}
+				if (i >= k) continue;
+				list[i] = m_idx;
+				if (n < k) n++;
+			}
+		}
+	}
+	return(n);
+}
+
+/* Objects (every item of each pile) within distance() 'rad' of y,x */
+int floor_objects_radius(cave_type **zcave, int y, int x, int rad, s16b *list, int max) {
+	int y1 = y - rad, x1 = x - rad, y2 = y + rad, x2 = x + rad, ty, tx, o_idx, n = 0;
+
+	if (y1 < 0) y1 = 0;
+	if (x1 < 0) x1 = 0;
+	if (y2 > MAX_HGT - 1) y2 = MAX_HGT - 1;
+	if (x2 > MAX_WID - 1) x2 = MAX_WID - 1;
+
+	for (ty = y1; ty <= y2; ty++) {
+		cave_type *c_ptr = &zcave[ty][x1];
+
+		for (tx = x1; tx <= x2; tx++, c_ptr++) {
+			if (!c_ptr->o_idx) continue;
+			if (distance(y, x, ty, tx) > rad) continue;
+			for (o_idx = c_ptr->o_idx; o_idx; o_idx = o_list[o_idx].next_o_idx) {
+				list[n++] = o_idx;
+				if (n == max) return(n);
+			}
+		}
+	}
+	return(n);
+}
+
+/* Compare the spatial queries against the m_list scans they replace, on the admin's floor */
+void spatial_bench(int Ind, int count) {
+	player_type *p_ptr = Players[Ind];
+	cave_type **zcave = getcave(&p_ptr->wpos);
+	struct timeval tv0, tv1;
+	long t_scan, t_grid;
+	int n, i, found_scan = 0, found_grid = 0, rad = MAX_SIGHT * 2 - 1, best = 0, d;
+	s16b *list;
+
+	if (!zcave) return;
+	list = floor_query_begin();
+
+	/* Whole floor */
+	gettimeofday(&tv0, NULL);
+	for (n = 0; n < count; n++)
+		for (found_scan = 0, i = 1; i < m_max; i++)
+			if (m_list[i].r_idx && inarea(&m_list[i].wpos, &p_ptr->wpos)) found_scan++;
+	gettimeofday(&tv1, NULL);
+	t_scan = (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+	gettimeofday(&tv0, NULL);
+	for (n = 0; n < count; n++)
+		found_grid = floor_monsters_rect(zcave, 0, 0, MAX_HGT - 1, MAX_WID - 1, NULL, list, FLOOR_QUERY_MAX);
+	gettimeofday(&tv1, NULL);
+	t_grid = (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+	msg_format(Ind, "Floor (%d of %d monsters): m_list %ld us, grid %ld us%s", found_grid, m_max - 1,
+	    t_scan / count, t_grid / count, found_scan == found_grid ? "" : format(" \377rMISMATCH (%d)", found_scan));
+
+	/* Radius around us */
+	gettimeofday(&tv0, NULL);
+	for (n = 0; n < count; n++)
+		for (found_scan = 0, i = 1; i < m_max; i++)
+			if (m_list[i].r_idx && inarea(&m_list[i].wpos, &p_ptr->wpos) &&
+			    distance(p_ptr->py, p_ptr->px, m_list[i].fy, m_list[i].fx) <= rad) found_scan++;
+	gettimeofday(&tv1, NULL);
+	t_scan = (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+	gettimeofday(&tv0, NULL);
+	for (n = 0; n < count; n++)
+		found_grid = floor_monsters_radius(zcave, p_ptr->py, p_ptr->px, rad, NULL, list, FLOOR_QUERY_MAX);
+	gettimeofday(&tv1, NULL);
+	t_grid = (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+	msg_format(Ind, "Radius %d (%d monsters): m_list %ld us, grid %ld us%s", rad, found_grid,
+	    t_scan / count, t_grid / count, found_scan == found_grid ? "" : format(" \377rMISMATCH (%d)", found_scan));
+
+	/* Closest monster */
+	gettimeofday(&tv0, NULL);
+	for (n = 0; n < count; n++)
+		for (found_scan = 0, d = 999, i = 1; i < m_max; i++)
+			if (m_list[i].r_idx && inarea(&m_list[i].wpos, &p_ptr->wpos) &&
+			    distance(p_ptr->py, p_ptr->px, m_list[i].fy, m_list[i].fx) < d) {
+				d = distance(p_ptr->py, p_ptr->px, m_list[i].fy, m_list[i].fx);
+				best = i;
+				found_scan = 1;
+			}
+	gettimeofday(&tv1, NULL);
+	t_scan = (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+	gettimeofday(&tv0, NULL);
+	for (n = 0; n < count; n++)
+		found_grid = floor_monsters_nearest(zcave, p_ptr->py, p_ptr->px, 999, NULL, list, 1);
+	gettimeofday(&tv1, NULL);
+	t_grid = (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+	msg_format(Ind, "Closest: m_list %ld us, grid %ld us%s",
+	    t_scan / count, t_grid / count,
+	    found_scan == found_grid && (!found_grid || list[0] == best) ? "" : " \377rMISMATCH");
+
+	floor_query_end(list);
+}
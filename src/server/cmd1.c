@@ -7376,7 +7376,11 @@ bool wraith_access(int Ind) {
 	bool house = FALSE;
 	cave_type **zcave = getcave(&p_ptr->wpos);
 
+#ifdef HOUSE_INDEX
+	for (i = house_first_at(&p_ptr->wpos); i != -1; i = house_next_at(i)) {
+#else
 	for (i = 0; i < num_houses; i++) {
+#endif
 		if (inarea(&houses[i].wpos, &p_ptr->wpos)) {
 			if (fill_house(&houses[i], FILL_PLAYER, p_ptr)) {
 				house = TRUE;
@@ -15,6 +15,11 @@
 
 #include "angband.h"
 
+#ifdef HOUSE_INDEX
+/* For gettimeofday() */
+#include <sys/time.h>
+#endif
+
 
 /* Amount of experience a player gets for disarming a trap. - C. Blue
    (It's personal, not distributed over the party)
@@ -1976,12 +1981,121 @@ static bool chest_trap(int Ind, int y, int x, int o_idx) {
 }
 
 
+#ifdef HOUSE_INDEX
+/*
+ * House index: houses[] only ever grows (deleted houses just get HF_DELETED)
+ * and a house never changes its wpos or door grid, so we keep two sets of
+ * singly linked chains over the house indices, both in ascending index order
+ * so lookups return the same house a scan over houses[] would:
+ *  - door chains, hashed by wpos and door grid, for pick_house(),
+ *  - sector chains, one per world surface sector plus one for everything
+ *    else, for inside_which_house() and other 'houses on this wpos' loops.
+ * Houses are added by house_index_add() when they're created and the whole
+ * index is rebuilt by house_index_rebuild() after houses[] got (re)loaded.
+ */
+#define HOUSE_DOOR_HASH		4096
+
+static s32b house_door_head[HOUSE_DOOR_HASH], house_door_tail[HOUSE_DOOR_HASH];
+static s32b house_sector_head[MAX_WILD_Y][MAX_WILD_X], house_sector_tail[MAX_WILD_Y][MAX_WILD_X];
+static s32b house_other_head = -1, house_other_tail = -1;
+static s32b *house_door_link = NULL, *house_sector_link = NULL;
+static int house_index_alloc = 0, house_index_num = 0;
+static bool house_index_ok = FALSE;
+
+static int house_door_hash(struct worldpos *wpos, int y, int x) {
+	u32b h = ((u32b)wpos->wx * 73856093U) ^ ((u32b)wpos->wy * 19349663U) ^ ((u32b)(wpos->wz + 128) * 83492791U);
+
+	h ^= ((u32b)y * 2654435761U) + (u32b)x * 40503U;
+	return((h ^ (h >> 16)) & (HOUSE_DOOR_HASH - 1));
+}
+
+void house_index_add(int h_idx) {
+	house_type *h_ptr = &houses[h_idx];
+	int b, i;
+
+	if (!house_index_ok || h_idx != house_index_num) {
+		/* Out of step (houses[] was changed behind our back), just start over */
+		house_index_rebuild();
+		return;
+	}
+
+	if (h_idx >= house_index_alloc) {
+		i = house_index_alloc;
+		while (house_index_alloc <= h_idx) house_index_alloc += 1024;
+		if (house_door_link) {
+			GROW(house_door_link, i, house_index_alloc, s32b);
+			GROW(house_sector_link, i, house_index_alloc, s32b);
+		} else {
+			C_MAKE(house_door_link, house_index_alloc, s32b);
+			C_MAKE(house_sector_link, house_index_alloc, s32b);
+		}
+	}
+
+	house_door_link[h_idx] = -1;
+	b = house_door_hash(&h_ptr->wpos, h_ptr->dy, h_ptr->dx);
+	if (house_door_tail[b] == -1) house_door_head[b] = h_idx;
+	else house_door_link[house_door_tail[b]] = h_idx;
+	house_door_tail[b] = h_idx;
+
+	house_sector_link[h_idx] = -1;
+	if (!h_ptr->wpos.wz && in_bounds_wild(h_ptr->wpos.wy, h_ptr->wpos.wx)) {
+		if (house_sector_tail[h_ptr->wpos.wy][h_ptr->wpos.wx] == -1) house_sector_head[h_ptr->wpos.wy][h_ptr->wpos.wx] = h_idx;
+		else house_sector_link[house_sector_tail[h_ptr->wpos.wy][h_ptr->wpos.wx]] = h_idx;
+		house_sector_tail[h_ptr->wpos.wy][h_ptr->wpos.wx] = h_idx;
+	} else {
+		if (house_other_tail == -1) house_other_head = h_idx;
+		else house_sector_link[house_other_tail] = h_idx;
+		house_other_tail = h_idx;
+	}
+
+	house_index_num++;
+}
+
+void house_index_rebuild(void) {
+	int i, x, y;
+
+	for (i = 0; i < HOUSE_DOOR_HASH; i++) house_door_head[i] = house_door_tail[i] = -1;
+	for (y = 0; y < MAX_WILD_Y; y++)
+		for (x = 0; x < MAX_WILD_X; x++)
+			house_sector_head[y][x] = house_sector_tail[y][x] = -1;
+	house_other_head = house_other_tail = -1;
+	house_index_num = 0;
+	house_index_ok = TRUE;
+
+	for (i = 0; i < num_houses; i++) house_index_add(i);
+}
+
+/* Catch houses that were added without house_index_add() */
+static void house_index_sync(void) {
+	if (!house_index_ok || house_index_num > num_houses) house_index_rebuild();
+	else while (house_index_num < num_houses) house_index_add(house_index_num);
+}
+
+/* First house that might be on this wpos, -1 if none. Callers must still
+   check inarea(), the chain for non-surface houses is shared. */
+int house_first_at(struct worldpos *wpos) {
+	house_index_sync();
+	if (!wpos->wz && in_bounds_wild(wpos->wy, wpos->wx)) return(house_sector_head[wpos->wy][wpos->wx]);
+	return(house_other_head);
+}
+
+/* Next house in the same chain as h_idx, -1 at the end */
+int house_next_at(int h_idx) {
+	return(house_sector_link[h_idx]);
+}
+#endif
+
 /*
  * Return the index of a house given an coordinate pair
  */
 int pick_house(struct worldpos *wpos, int y, int x) {
 	int i;
 
+#ifdef HOUSE_INDEX
+	house_index_sync();
+	for (i = house_door_head[house_door_hash(wpos, y, x)]; i != -1; i = house_door_link[i])
+		if (houses[i].dx == x && houses[i].dy == y && inarea(&houses[i].wpos, wpos)) return(i);
+#else
 	/* Check each house */
 	for (i = 0; i < num_houses; i++) {
 		/* Check this one */
@@ -1989,6 +2103,7 @@ int pick_house(struct worldpos *wpos, int y, int x) {
 			/* Return */
 			return(i);
 	}
+#endif
 
 	/* Failure */
 	return(-1);
@@ -1996,6 +2111,15 @@ int pick_house(struct worldpos *wpos, int y, int x) {
 /* Reverse function of pick_house() */
 int pick_player(house_type *h_ptr) {
 	int i;
+#ifdef HOUSE_INDEX
+	cave_type **zcave = getcave(&h_ptr->wpos);
+
+	/* Players are on the cave grid too, no need to check all of them */
+	if (!zcave || !in_bounds_array(h_ptr->dy, h_ptr->dx)) return(0);
+	i = -zcave[h_ptr->dy][h_ptr->dx].m_idx;
+	if (i > 0 && i <= NumPlayers && Players[i]->px == h_ptr->dx && Players[i]->py == h_ptr->dy && inarea(&Players[i]->wpos, &h_ptr->wpos))
+		return(i);
+#else
 
 	/* Check each house */
 	for (i = 1; i <= NumPlayers; i++) {
@@ -2004,6 +2128,7 @@ int pick_player(house_type *h_ptr) {
 			/* Return */
 			return(i);
 	}
+#endif
 
 	/* Failure */
 	return(0);
@@ -2056,7 +2181,11 @@ int inside_which_house(struct worldpos *wpos, int x, int y) {
 	int i;
 	house_type *h_ptr;
 
+#ifdef HOUSE_INDEX
+	for (i = house_first_at(wpos); i != -1; i = house_next_at(i)) {
+#else
 	for (i = 0; i < num_houses; i++) {
+#endif
 		h_ptr = &houses[i];
 
 		/* skip unowned houses */
@@ -2078,6 +2207,67 @@ int inside_which_house(struct worldpos *wpos, int x, int y) {
 	return(-1);
 }
 
+#ifdef HOUSE_INDEX
+/* Check pick_house() and inside_which_house() against plain scans over houses[],
+   for every house's door grid and top-left corner, and time both ways. */
+void house_index_bench(int Ind, int count) {
+	struct timeval tv0, tv1;
+	long t_scan, t_index;
+	int i, j, n, r_scan, bad = 0, chk = 0;
+	house_type *h_ptr;
+
+	if (!num_houses) {
+		msg_print(Ind, "There are no houses.");
+		return;
+	}
+	if (count > num_houses) count = num_houses;
+
+	/* Correctness, all houses */
+	for (i = 0; i < num_houses; i++) {
+		h_ptr = &houses[i];
+
+		for (r_scan = -1, j = 0; j < num_houses; j++)
+			if (houses[j].dx == h_ptr->dx && houses[j].dy == h_ptr->dy && inarea(&houses[j].wpos, &h_ptr->wpos)) {
+				r_scan = j;
+				break;
+			}
+		if (pick_house(&h_ptr->wpos, h_ptr->dy, h_ptr->dx) != r_scan) bad++;
+
+		if (!(h_ptr->flags & HF_RECT)) continue;
+		for (r_scan = -1, j = 0; j < num_houses; j++) {
+			if (!houses[j].dna->owner || !inarea(&houses[j].wpos, &h_ptr->wpos) || !(houses[j].flags & HF_RECT)) continue;
+			if (houses[j].x <= h_ptr->x && houses[j].x + houses[j].coords.rect.width - 1 >= h_ptr->x &&
+			    houses[j].y <= h_ptr->y && houses[j].y + houses[j].coords.rect.height - 1 >= h_ptr->y) {
+				r_scan = j + 1;
+				break;
+			}
+		}
+		if (inside_which_house(&h_ptr->wpos, h_ptr->x, h_ptr->y) != r_scan) bad++;
+		chk++;
+	}
+
+	/* Speed, door lookups of the first 'count' houses */
+	gettimeofday(&tv0, NULL);
+	for (n = 0, i = 0; i < count; i++) {
+		h_ptr = &houses[i];
+		for (j = 0; j < num_houses; j++)
+			if (houses[j].dx == h_ptr->dx && houses[j].dy == h_ptr->dy && inarea(&houses[j].wpos, &h_ptr->wpos)) {
+				n += j;
+				break;
+			}
+	}
+	gettimeofday(&tv1, NULL);
+	t_scan = (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+	gettimeofday(&tv0, NULL);
+	for (i = 0; i < count; i++) n -= pick_house(&houses[i].wpos, houses[i].dy, houses[i].dx);
+	gettimeofday(&tv1, NULL);
+	t_index = (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+
+	msg_format(Ind, "%d houses (%d rectangular checked): %s", num_houses, chk, bad ? format("\377r%d MISMATCHES", bad) : "no mismatches");
+	msg_format(Ind, "%d door lookups: scan %ld us, index %ld us%s", count, t_scan, t_index, n ? " \377r(sum differs)" : "");
+}
+#endif
+
 bool inside_inn(player_type *p_ptr, cave_type *c_ptr) {
 	int shop = -1;
 
@@ -356,6 +356,26 @@ void SGWHit(int read_fd, int arg) {
 			C_KILL(buf2, alloc, char);
 		}
 
+		/* Live heap memory per subsystem, "<tag>=<bytes> <blocks>" */
+		else if (!strcmp(buf, "MEMORY")) {
+  #ifdef MEM_ACCOUNTING
+			cptr name;
+			u64b bytes, total = 0;
+			u32b blocks;
+
+			Packet_println(&gw_conn->w, "MEMORY REPLY");
+			for (i = 0; mem_acct_tag(i, &name, &bytes, &blocks); i++) {
+				Packet_println(&gw_conn->w, "%s=%lu %u", name, (unsigned long)bytes, blocks);
+				total += bytes;
+			}
+			Packet_println(&gw_conn->w, "total=%lu", (unsigned long)total);
+			Packet_println(&gw_conn->w, "peak=%lu", (unsigned long)mem_acct_peak());
+			Packet_println(&gw_conn->w, "MEMORY REPLY END");
+  #else
+			Packet_println(&gw_conn->w, "ERROR UNKNOWN REQUEST");
+  #endif
+		}
+
 		/* Player stores list */
 		else if (!strcmp(buf, "PSTORES")) {
 			//MAX_HOUSES (65536), STORE_INVEN_MAX (120)
@@ -14,6 +14,9 @@
 #include "angband.h"
 #include "externs.h"
 
+/* For gettimeofday() */
+#include <sys/time.h>
+
 /* chance of townie respawning like other monsters, rand_int(chance)==0 means respawn */
  /* Default */
 #define TOWNIE_RESPAWN_CHANCE	350
@@ -82,6 +85,32 @@ static void process_weather_control(void);
  #endif
 #endif
 
+/* Recurring world maintenance that is driven by process_world_jobs() instead of a 'turn % x' check of its own.
+   A job gets called once per frame while a round of it is running, and each call (slice) should only do
+   about 'budget' units of work, so big loops over all players/sectors/objects get spread over several frames. */
+typedef struct world_job world_job;
+struct world_job {
+	cptr name;
+	s32b period;		/* How often a round is due: > 0 in seconds, < 0 in turns */
+	int budget;		/* Work units (job-specific) a single slice may process */
+	bool (*func)(world_job *job);	/* Processes one slice, returns TRUE if the round is complete */
+	bool at_startup;	/* Also start a round right on server startup */
+
+	s32b due;		/* Turn the current/next round is due */
+	int cursor;		/* Job-specific progress within the current round, 0 at the start of each round */
+	byte state;		/* WJ_IDLE, WJ_PENDING or WJ_RUNNING */
+	int next;		/* Link to the next job in the same wheel bucket/queue */
+	s32b started;		/* Turn the current round actually started */
+
+	/* Statistics, see '/jobs' */
+	u32b rounds, slices;
+	long cost, cost_max;	/* usec spent in slices, total and worst single slice */
+	s32b late, late_max;	/* turns between a round being due and it getting started, total and worst */
+	s32b frames_max;	/* most frames a single round was spread over */
+};
+static bool purge_old(world_job *job);
+static bool scan_objs(world_job *job);
+
 /* To make up for this, players get an IDDC_freepass ;) */
 #define SHUTDOWN_IGNORE_IDDC(p_ptr) \
     ((in_irondeepdive(&(p_ptr)->wpos) || in_hallsofmandos(&(p_ptr)->wpos)) \
@@ -895,6 +924,9 @@ void erase_effects(int effect) {
 	int cy = e_ptr->cy;
 	int cx = e_ptr->cx;
 
+	/* Give the slot back to the pool of free effects */
+	effect_release(effect);
+
 	e_ptr->time = 0;
 
 	e_ptr->interval = 0;
@@ -918,7 +950,8 @@ void erase_effects(int effect) {
 
 		c_ptr = &zcave[j][i];
 		if (c_ptr->effect == effect) {
-			c_ptr->effect = 0;
+			/* Hand the grid back to any cloud that we were painted over */
+			c_ptr->effect = effect_grid_cover(wpos, j, i, effect);
 			everyone_lite_spot(wpos, j, i);
 		}
 		if (c_ptr->effect_past == effect) c_ptr->effect_past = 0;
@@ -971,7 +1004,6 @@ static void apply_effect(int k, int *who, struct worldpos *wpos, int x, int y, c
  */
 /*
  * TODO:
- * - excise dead effect for efficiency
  * - allow players/monsters to 'cancel' the effect
  * - implement EFF_LAST eraser (for now, no spell has this flag)
  * - reduce the use of everyone_lite_spot (one call, one packet)
@@ -1001,15 +1033,37 @@ static void process_effects(void) {
 	bool skip;
 	bool is_player;
 
-	for (k = 0; k < MAX_EFFECTS; k++) {
+#ifndef EXTENDED_TERM_COLOURS
+ #ifdef ANIMATE_EFFECTS
+  #ifdef FREQUENT_EFFECT_ANIMATION
+	/* hack: animate the effect! Note that this is independant of the effect interval,
+	   as opposed to the other animation code below. - C. Blue */
+	if (!(turn % (cfg.fps / 5)))
+		for (k = 0; k < effects_active_num; k++) {
+			e_ptr = &effects[effects_active[k]];
+			if (!e_ptr->time || !spell_color_animation(e_ptr->type)) continue;
+			wpos = &e_ptr->wpos;
+			if (!getcave(wpos)) continue;
+			for (l = 0; l < tdi[e_ptr->rad]; l++) {
+				j = e_ptr->cy + tdy[l];
+				i = e_ptr->cx + tdx[l];
+				if (!in_bounds(j, i)) continue;
+				everyone_lite_spot(wpos, j, i);
+			}
+		}
+  #endif
+ #endif
+#endif
+
+	/* Only process the effects whose interval (depending on level_speed) is up in this turn */
+	effects_collect_due();
+	while ((k = effect_next_due()) != -1) {
 		e_ptr = &effects[k];
-		/* Skip empty slots */
-		if (e_ptr->time == 0) continue;
 
 		wpos = &e_ptr->wpos;
 		if (!(zcave = getcave(wpos))) {
-			e_ptr->time = 0;
-			/* TODO - excise it - see right below! */
+			/* Floor is gone, excise it */
+			erase_effects(k);
 			continue;
 		}
 		/* See above - It ends and for some reason getcave() was fine again? Excise it.
@@ -1057,24 +1111,8 @@ static void process_effects(void) {
  #endif
 #endif
 
-#ifndef EXTENDED_TERM_COLOURS
- #ifdef ANIMATE_EFFECTS
-  #ifdef FREQUENT_EFFECT_ANIMATION
-		/* hack: animate the effect! Note that this is independant of the effect interval,
-		   as opposed to the other animation code below. - C. Blue */
-		if (!(turn % (cfg.fps / 5)) && e_ptr->time && spell_color_animation(e_ptr->type))
-			for (l = 0; l < tdi[e_ptr->rad]; l++) {
-				j = e_ptr->cy + tdy[l];
-				i = e_ptr->cx + tdx[l];
-				if (!in_bounds(j, i)) continue;
-				everyone_lite_spot(wpos, j, i);
-			}
-  #endif
- #endif
-#endif
-
-		/* check if it's time to process this effect now (depends on level_speed) */
-		if ((turn % (e_ptr->interval * level_speed(wpos) / (level_speeds[0] * 5))) != 0) continue;
+		/* Queue up its next tick already (erasing it below will unhook it again) */
+		effect_schedule(k);
 
 		/* Reduce duration */
 		e_ptr->time--;
@@ -1183,42 +1221,43 @@ static void process_effects(void) {
 			}
 #endif
 
-			/* If it's a changing effect, remove it from currently affected grid to prepare for next iteration */
+			/* If it's a changing effect, remove it from currently affected grid to prepare for next iteration
+			   (handing the grid back to any cloud that it was painted over) */
 			if (!(e_ptr->flags & EFF_LAST)
 			    && c_ptr->effect == k) {
 				if ((e_ptr->flags & EFF_WAVE)) {
 					if (distance(e_ptr->cy, e_ptr->cx, j, i) < e_ptr->rad - 2) { //wave has thickness 3: each taget gets hit 3 times
-						c_ptr->effect = 0;
+						c_ptr->effect = effect_grid_cover(wpos, j, i, k);
 						everyone_lite_spot(wpos, j, i);
 					}
 				} else if ((e_ptr->flags & EFF_THINWAVE)) {
 					if (distance(e_ptr->cy, e_ptr->cx, j, i) < e_ptr->rad) { // thin wave has thickness 1: each target gets hit 1 time
 						if (c_ptr->effect == k) c_ptr->effect_past = k; /* Don't allow a monster to 'jump' the effect */
-						c_ptr->effect = 0;
+						c_ptr->effect = effect_grid_cover(wpos, j, i, k);
 						everyone_lite_spot(wpos, j, i);
 					}
 				} else if ((e_ptr->flags & EFF_STORM) || (e_ptr->flags & EFF_VORTEX)) {
-					c_ptr->effect = 0;
+					c_ptr->effect = effect_grid_cover(wpos, j, i, k);
 					everyone_lite_spot(wpos, j, i);
 				} else if ((e_ptr->flags & EFF_SNOWING)) {
-					c_ptr->effect = 0;
+					c_ptr->effect = effect_grid_cover(wpos, j, i, k);
 					everyone_lite_spot(wpos, j, i);
 				} else if ((e_ptr->flags & EFF_RAINING)) {
-					c_ptr->effect = 0;
+					c_ptr->effect = effect_grid_cover(wpos, j, i, k);
 					everyone_lite_spot(wpos, j, i);
 				} else if (e_ptr->flags & (EFF_FIREWORKS1 | EFF_FIREWORKS2 | EFF_FIREWORKS3)) {
-					c_ptr->effect = 0;
+					c_ptr->effect = effect_grid_cover(wpos, j, i, k);
 					everyone_lite_spot(wpos, j, i);
 #if 0 /* no need to erase inbetween, while effect is still expanding - at the same time this fixes ugly tile flickering from redrawing (lava!) */
 				} else if (e_ptr->flags & (EFF_LIGHTNING1 | EFF_LIGHTNING2 | EFF_LIGHTNING3)) {
-					c_ptr->effect = 0;
+					c_ptr->effect = effect_grid_cover(wpos, j, i, k);
 					everyone_lite_spot(wpos, j, i);
 #endif
 				} else if ((e_ptr->flags & EFF_FALLING_STAR)) {
-					c_ptr->effect = 0;
+					c_ptr->effect = effect_grid_cover(wpos, j, i, k);
 					everyone_lite_spot(wpos, j, i);
 				} else if ((e_ptr->flags & EFF_SEEKER)) {
-					c_ptr->effect = 0;
+					c_ptr->effect = effect_grid_cover(wpos, j, i, k);
 					everyone_lite_spot(wpos, j, i);
 				}
 			}
@@ -4085,6 +4124,7 @@ static void process_player_begin(int Ind) {
 		for (x = 0; x <= 65; x++) zcave[21][x].feat = FEAT_GLIT_WATER;
 		zcave[20][0].feat = FEAT_GLIT_WATER;
 		zcave[20][65].feat = FEAT_GLIT_WATER;
+		bump_feat_epoch(&p_ptr->wpos);
 		/* Some lil hacks */
 		msg_format(Ind, "\377%cYou enter the shores of Valinor..", COLOUR_DUNGEON);
 		wiz_lite_extra(Ind);
@@ -7777,67 +7817,92 @@ static void scan_houses() {
 /*
  * Deallocate all non static levels. (evileye)
  */
-static void purge_old() {
-	int x, y, i;
+/* Statistics of purge_old(), see '/floors' */
+static u32b purge_evictions = 0, purge_evictions_min[2] = { 0, 0 }, purge_unstatics = 0;
+static s32b purge_evictions_stamp = 0;
+static u64b purge_reclaimed = 0;
+
+static void purge_count_eviction(void) {
+	s32b minute = turn / (cfg.fps * 60);
+
+	if (minute != purge_evictions_stamp) {
+		purge_evictions_min[1] = (minute == purge_evictions_stamp + 1) ? purge_evictions_min[0] : 0;
+		purge_evictions_min[0] = 0;
+		purge_evictions_stamp = minute;
+	}
+	purge_evictions_min[0]++;
+	purge_evictions++;
+	/* Only the grid array is accounted for, not monsters/objects/special grid info */
+	purge_reclaimed += MAX_HGT * (sizeof(cave_type *) + MAX_WID * sizeof(cave_type));
+}
+
+/* A round walks all resident floors (allocated or static ones, see floor_lru_update()),
+   least recently used first, each slice processing 'budget' floors. */
+static bool purge_old(world_job *job) {
+	int n;
 	struct wilderness_type *w_ptr;
 	struct dungeon_type *d_ptr;
+	struct worldpos twpos;
 
-	//if (cfg.level_unstatic_chance > 0)
-	{
-		struct worldpos twpos;
+	if (!job->cursor) {
+		floor_lru_walk_start();
+		job->cursor = 1;
+	}
 
-		twpos.wz = 0;
-#if 0 /* we get called every second or even less often? */
-		for (y = 0; y < MAX_WILD_Y; y++) {
-#else /* we get called every frame, to distribute the workload? */
-		y = turn % MAX_WILD_Y;
-		{
-#endif
-			twpos.wy = y;
-			for (x = 0; x < MAX_WILD_X; x++) {
-				twpos.wx = x;
-				w_ptr = &wild_info[twpos.wy][twpos.wx];
-
-				if (cfg.level_unstatic_chance > 0 &&
-				    players_on_depth(&twpos))
-					do_unstat(&twpos, FALSE);
-
-				if (!players_on_depth(&twpos) &&
-				    !istown(&twpos) &&
-				    !isdungeontown(&twpos) &&
-				    getcave(&twpos) && stale_level(&twpos, cfg.anti_scum))
-					dealloc_dungeon_level(&twpos);
-
-				if (w_ptr->flags & WILD_F_UP) {
-					d_ptr = w_ptr->tower;
-					for (i = 1; i <= d_ptr->maxdepth; i++) {
-						twpos.wz = i;
-						if (cfg.level_unstatic_chance > 0 &&
-						    players_on_depth(&twpos))
-							do_unstat(&twpos, d_ptr->type == DI_DEATH_FATE ? 2 : ((d_ptr->type == DI_MT_DOOM && i == d_ptr->maxdepth) ? 1 : 0));
-
-						if (!players_on_depth(&twpos) && getcave(&twpos) &&
-						    stale_level(&twpos, cfg.anti_scum))
-							dealloc_dungeon_level(&twpos);
-					}
-				}
-				if (w_ptr->flags & WILD_F_DOWN) {
-					d_ptr = w_ptr->dungeon;
-					for (i = 1; i <= d_ptr->maxdepth; i++) {
-						twpos.wz = -i;
-						if (cfg.level_unstatic_chance > 0 &&
-						    players_on_depth(&twpos))
-							do_unstat(&twpos, d_ptr->type == DI_DEATH_FATE ? 2 : ((d_ptr->type == DI_MT_DOOM && i == d_ptr->maxdepth) ? 1 : 0));
-
-						if (!players_on_depth(&twpos) && getcave(&twpos) &&
-						    stale_level(&twpos, cfg.anti_scum))
-							dealloc_dungeon_level(&twpos);
-					}
-				}
-				twpos.wz = 0;
+	for (n = 0; n < job->budget; n++) {
+		if (!floor_lru_walk_next(&twpos)) return(TRUE);
+		w_ptr = &wild_info[twpos.wy][twpos.wx];
+
+		if (!twpos.wz) {
+			if (cfg.level_unstatic_chance > 0 &&
+			    players_on_depth(&twpos)) {
+				do_unstat(&twpos, FALSE);
+				if (!players_on_depth(&twpos)) purge_unstatics++;
+			}
+
+			if (!players_on_depth(&twpos) &&
+			    !istown(&twpos) &&
+			    !isdungeontown(&twpos) &&
+			    getcave(&twpos) && stale_level(&twpos, cfg.anti_scum)) {
+				dealloc_dungeon_level(&twpos);
+				purge_count_eviction();
 			}
+			continue;
+		}
+
+		/* Dungeon/tower that is currently being removed? */
+		if (!(w_ptr->flags & (twpos.wz > 0 ? WILD_F_UP : WILD_F_DOWN))) continue;
+		d_ptr = (twpos.wz > 0 ? w_ptr->tower : w_ptr->dungeon);
+
+		if (cfg.level_unstatic_chance > 0 &&
+		    players_on_depth(&twpos)) {
+			do_unstat(&twpos, d_ptr->type == DI_DEATH_FATE ? 2 : ((d_ptr->type == DI_MT_DOOM && ABS(twpos.wz) == d_ptr->maxdepth) ? 1 : 0));
+			if (!players_on_depth(&twpos)) purge_unstatics++;
+		}
+
+		if (!players_on_depth(&twpos) && getcave(&twpos) &&
+		    stale_level(&twpos, cfg.anti_scum)) {
+			dealloc_dungeon_level(&twpos);
+			purge_count_eviction();
 		}
 	}
+
+	return(FALSE);
+}
+
+/* Display resident floor statistics to an admin */
+void purge_old_report(int Ind) {
+	s32b minute = turn / (cfg.fps * 60);
+
+	msg_format(Ind, "Resident floors: %d allocated, %d tracked (allocated or static).", floors_allocated, floor_lru_num);
+	msg_format(Ind, "Evictions: %u total, %u this minute, %u last minute; %u floors unstaticed.",
+	    purge_evictions,
+	    minute == purge_evictions_stamp ? purge_evictions_min[0] : 0,
+	    minute == purge_evictions_stamp ? purge_evictions_min[1] : (minute == purge_evictions_stamp + 1 ? purge_evictions_min[0] : 0),
+	    purge_unstatics);
+	msg_format(Ind, "Memory reclaimed: %lu KB (grid arrays only), currently held: %lu KB.",
+	    (unsigned long)(purge_reclaimed / 1024), (unsigned long)(((u64b)floors_allocated * MAX_HGT * (sizeof(cave_type *) + MAX_WID * sizeof(cave_type))) / 1024));
+	msg_format(Ind, "Last server save: %d floor files rewritten, %d unchanged.", floor_files_written, floor_files_kept);
 }
 
 /*
@@ -8009,18 +8074,20 @@ void tradhouse_contents_chmod() {
  * drop something just at the wrong time, but it should get
  * rid of some town junk.
  *
- * We're called once per minute, from process_various().
+ * We're a world job due once per minute, each slice scanning 'budget' entries of o_list.
  */
-//TODO: Do some work distribution over frames, this function seems CPU-hungry, looping through all items when it's called. */
-static void scan_objs() {
-	int i, cnt = 0, dcnt = 0;
+static bool scan_objs(world_job *job) {
+	static int cnt, dcnt;
+	int i;
 	object_type *o_ptr;
 	cave_type **zcave;
 
 	/* objects time-outing disabled? */
-	if (!cfg.surface_item_removal && !cfg.dungeon_item_removal) return;
+	if (!cfg.surface_item_removal && !cfg.dungeon_item_removal) return(TRUE);
+
+	if (!job->cursor) cnt = dcnt = 0;
 
-	for (i = 0; i < o_max; i++) {
+	for (i = job->cursor; i < o_max && i < job->cursor + job->budget; i++) {
 		o_ptr = &o_list[i];
 		if (!o_ptr->k_idx) continue;
 
@@ -8082,7 +8149,7 @@ static void scan_objs() {
 			else
   #if CHEEZELOG_LEVEL < 4
 			/* ..only once an hour. (logs would fill the hd otherwise ;( */
-			if (!(turn % (cfg.fps * 3600)))
+			if (!(job->due % (cfg.fps * 3600)))
   #endif	/* CHEEZELOG_LEVEL (4) */
 				cheeze(o_ptr);
  #endif	/* CHEEZELOG_LEVEL (1) */
@@ -8110,7 +8177,7 @@ static void scan_objs() {
 			else
   #if CHEEZELOG_LEVEL < 4
 			/* ..only once an hour. (logs would fill the hd otherwise ;( */
-			if (!(turn % (cfg.fps * 3600)))
+			if (!(job->due % (cfg.fps * 3600)))
   #endif	/* CHEEZELOG_LEVEL (4) */
 				cheeze(o_ptr);
  #endif	/* CHEEZELOG_LEVEL (1) */
@@ -8119,6 +8186,10 @@ static void scan_objs() {
 			cnt++;
 		}
 	}
+	job->cursor = i;
+
+	/* Continue in the next frame? */
+	if (i < o_max) return(FALSE);
 
 	/* log result */
 	if (dcnt) s_printf("Scanned %d objects. Removed %d.\n", cnt, dcnt);
@@ -8127,12 +8198,13 @@ static void scan_objs() {
 	/* Additional cheeze check for all those items inside of mangband-style houses */
  #if CHEEZELOG_LEVEL > 1
   #if CHEEZELOG_LEVEL < 4
-	if (!(turn % (cfg.fps * 3600)))
+	if (!(job->due % (cfg.fps * 3600)))
   #endif	/* CHEEZELOG_LEVEL (4) */
 		cheeze_trad_house();
  #endif	/* CHEEZELOG_LEVEL (1) */
 #endif	/* USE_MANG_HOUSE_ONLY */
 
+	return(TRUE);
 }
 
 
@@ -8171,12 +8243,296 @@ void store_turnover() {
 */
 /* called only every cfg.fps/6 turns
 */
+/* Save the server state and all players.
+   This is never sliced: server info and the player files must be a snapshot of the same frame,
+   or an item/gold/house handed over between two slices could end up duplicated or lost on a crash. */
+static bool save_world(world_job *job) {
+	int i;
+
+	/* Without players around, only save very occasionally */
+	if (!NumPlayers && (job->due % (1000L * SERVER_SAVE))) return(TRUE);
+
+	save_server_info();
+
+	/* Save each player */
+	for (i = 1; i <= NumPlayers; i++)
+		save_player(i);
+
+	return(TRUE);
+}
+
+/* Daily maintenance, spread over a few slices.
+   The character, account and house scans all edit ownership records that refer to each other,
+   so they stay together in the first slice. */
+static bool daily_maintenance(world_job *job) {
+	int i;
+	int h = 0, m = 0, s = 0, dwd = 0, dd = 0, dm = 0, dy = 0;
+#ifndef ARCADE_SERVER
+	time_t now;
+	struct tm *tmp;
+#endif
+
+	switch (job->cursor++) {
+	case 0:
+		s_printf("24 hours maintenance cycle\n");
+		scan_characters();
+		scan_accounts();
+		scan_houses();
+		return(FALSE);
+	case 1:
+#ifdef IRONDEEPDIVE_MIXED_TYPES
+		(void)scan_iddc();
+#endif
+
+#ifdef FIREWORK_DUNGEON
+		init_firework_dungeon();
+#endif
+		return(FALSE);
+	}
+
+	if (cfg.auto_purge) {
+		s_printf("previous server status: m_max(%d) o_max(%d)\n",
+				m_max, o_max);
+		compact_monsters(0, TRUE);
+		compact_objects(0, TRUE);
+		//compact_traps(0, TRUE);
+		s_printf("current server status:  m_max(%d) o_max(%d)\n",
+				m_max, o_max);
+	}
+#if DEBUG_LEVEL > 1
+	else s_printf("Current server status:  m_max(%d) o_max(%d)\n",
+			m_max, o_max);
+#endif
+	s_printf("Finished maintenance\n");
+#ifndef ARCADE_SERVER
+	time(&now);
+	tmp = localtime(&now);
+	h = tmp->tm_hour;
+	m = tmp->tm_min;
+	s = tmp->tm_sec;
+#endif
+	get_date(&dwd, &dd, &dm, &dy);
+	exec_lua(0, format("cron_24h(\"%s\", %d, %d, %d, %d, %d, %d, %d)", showtime(), h, m, s, dwd, dd, dm, dy));
+
+	/* bbs_add_line("--- new day line ---"); */
+
+	/* notify admins? */
+	for (i = 1; i <= NumPlayers; i++) {
+		if (!is_admin(Players[i])) continue;
+		msg_format(i, "\374\377y[24-h maintenance/cron finished - %s]", showtime());
+	}
+	return(TRUE);
+}
+
+#ifdef PLAYER_STORES
+ #ifdef EXPORT_PLAYER_STORE_OFFERS
+  #if EXPORT_PLAYER_STORE_OFFERS > 0
+/* Export player store items. export_player_store_offers() spreads its work over frames on its own. */
+static bool export_store_offers(world_job *job) {
+	static int export_turns = 0;
+
+	export_player_store_offers(&export_turns);
+	return(!export_turns);
+}
+  #endif
+ #endif
+#endif
+
+#ifdef STORE_ITEM_POOL
+/* Make some items for the pools that store_restock() takes new store items from. */
+static bool store_pools(world_job *job) {
+	return(store_pool_refill(&job->cursor, job->budget));
+}
+#endif
+
+/* Most rounds that may get started in the same frame. Jobs that are due at the same time
+   (eg on every full hour lots of them are) get staggered over consecutive frames instead. */
+#define WORLD_JOB_STARTS	1
+/* Buckets of the timing wheel, must be a power of 2 */
+#define WORLD_JOB_WHEEL		256
+
+#define WJ_IDLE		0	/* waiting in the wheel for its next round */
+#define WJ_PENDING	1	/* due, waiting for its turn to start */
+#define WJ_RUNNING	2	/* round in progress */
+
+static world_job world_jobs[] = {
+	/* name, period (> 0: seconds, < 0: turns), budget, function, run at startup */
+	{ "purge_old", -MAX_WILD_Y, 16, purge_old, FALSE },
+	{ "save", -10L * SERVER_SAVE, 0, save_world, FALSE },
+	{ "scan_objs", 60, 2048, scan_objs, FALSE },
+	{ "daily", 86400, 0, daily_maintenance, FALSE },
+#ifdef STORE_ITEM_POOL
+	{ "store_pool", 1, 4, store_pools, FALSE },
+#endif
+#ifdef PLAYER_STORES
+ #ifdef EXPORT_PLAYER_STORE_OFFERS
+  #if EXPORT_PLAYER_STORE_OFFERS > 0
+	{ "store_export", 60 * EXPORT_PLAYER_STORE_OFFERS, 0, export_store_offers, TRUE },
+  #endif
+ #endif
+#endif
+	{ NULL, 0, 0, NULL, FALSE },
+};
+
+static int world_job_wheel[WORLD_JOB_WHEEL];
+static int world_job_queue = -1; /* pending jobs, in order of becoming due */
+static bool world_jobs_initialized = FALSE;
+
+static s32b world_job_period(world_job *job) {
+	s32b period = job->period > 0 ? job->period * cfg.fps : -job->period;
+
+	return(period < 1 ? 1 : period);
+}
+
+static void world_job_link(int j, s32b due) {
+	world_job *job = &world_jobs[j];
+
+	job->due = due;
+	job->state = WJ_IDLE;
+	job->next = world_job_wheel[due & (WORLD_JOB_WHEEL - 1)];
+	world_job_wheel[due & (WORLD_JOB_WHEEL - 1)] = j;
+}
+
+/* Hook a job into the wheel for its next round: the first multiple of its period after 'after'. */
+static void world_job_schedule(int j, s32b after) {
+	s32b period = world_job_period(&world_jobs[j]);
+
+	world_job_link(j, after - (after % period) + period);
+}
+
+/* (Re)build the wheel, eg after the turn counter got reset.
+   Rounds that are already due or running are left alone, just their due turn is fixed. */
+void world_jobs_reschedule(void) {
+	int j;
+
+	for (j = 0; j < WORLD_JOB_WHEEL; j++) world_job_wheel[j] = -1;
+
+	for (j = 0; world_jobs[j].name; j++) {
+		if (world_jobs[j].state != WJ_IDLE) {
+			if (world_jobs[j].due > turn) world_jobs[j].due = world_jobs[j].started = turn;
+			continue;
+		}
+
+		/* Start it in this very frame? */
+		if (!world_jobs_initialized && world_jobs[j].at_startup) world_job_link(j, turn);
+		else world_job_schedule(j, turn);
+	}
+	world_jobs_initialized = TRUE;
+}
+
+/* Run one slice of a job and account for it */
+static bool world_job_slice(world_job *job) {
+	struct timeval time_begin, time_end;
+	long cost;
+	bool done;
+
+	gettimeofday(&time_begin, NULL);
+	done = job->func(job);
+	gettimeofday(&time_end, NULL);
+
+	cost = (time_end.tv_sec - time_begin.tv_sec) * 1000000L + (time_end.tv_usec - time_begin.tv_usec);
+	job->cost += cost;
+	if (cost > job->cost_max) job->cost_max = cost;
+	job->slices++;
+
+	if (done) {
+		job->rounds++;
+		if (turn - job->started + 1 > job->frames_max) job->frames_max = turn - job->started + 1;
+	}
+	return(done);
+}
+
+/* Called once per frame from dungeon(): Collects the jobs that became due, runs one slice
+   of each running job and starts up to WORLD_JOB_STARTS new rounds. */
+static void process_world_jobs(void) {
+	int j, next, starts = 0, *tail;
+	world_job *job;
+
+	if (!world_jobs_initialized) world_jobs_reschedule();
+
+	/* Move everything that is due from the current bucket to the end of the queue
+	   (jobs with a period longer than the wheel just stay for another revolution) */
+	for (tail = &world_job_queue; *tail != -1; tail = &world_jobs[*tail].next);
+	j = world_job_wheel[turn & (WORLD_JOB_WHEEL - 1)];
+	world_job_wheel[turn & (WORLD_JOB_WHEEL - 1)] = -1;
+	for (; j != -1; j = next) {
+		job = &world_jobs[j];
+		next = job->next;
+		if (job->due > turn) {
+			job->next = world_job_wheel[turn & (WORLD_JOB_WHEEL - 1)];
+			world_job_wheel[turn & (WORLD_JOB_WHEEL - 1)] = j;
+			continue;
+		}
+		job->state = WJ_PENDING;
+		job->next = -1;
+		*tail = j;
+		tail = &job->next;
+	}
+
+	/* Continue running rounds */
+	for (j = 0; world_jobs[j].name; j++) {
+		job = &world_jobs[j];
+		if (job->state != WJ_RUNNING || job->started == turn) continue;
+		if (world_job_slice(job)) world_job_schedule(j, MAX(job->due, turn));
+	}
+
+	/* Start new rounds */
+	while ((j = world_job_queue) != -1 && starts < WORLD_JOB_STARTS) {
+		job = &world_jobs[j];
+		world_job_queue = job->next;
+		starts++;
+
+		job->state = WJ_RUNNING;
+		job->cursor = 0;
+		job->started = turn;
+		job->late += turn - job->due;
+		if (turn - job->due > job->late_max) job->late_max = turn - job->due;
+
+		if (world_job_slice(job)) world_job_schedule(j, MAX(job->due, turn));
+	}
+}
+
+/* Display the world job statistics to an admin, and optionally reset them */
+void world_jobs_report(int Ind, bool reset) {
+	int j;
+	world_job *job;
+
+	msg_print(Ind, "\377yJob          period  budget  rounds   slices  avg/max us per slice  avg/max turns late  max frames");
+	for (j = 0; world_jobs[j].name; j++) {
+		job = &world_jobs[j];
+		msg_format(Ind, "%-12s %7d %7d %7u %8u %10ld/%-10ld %9d/%-9d %6d%s",
+		    job->name, world_job_period(job), job->budget, job->rounds, job->slices,
+		    job->slices ? job->cost / (long)job->slices : 0L, job->cost_max,
+		    job->rounds ? job->late / (s32b)job->rounds : 0, job->late_max,
+		    job->frames_max, job->state == WJ_RUNNING ? " (running)" : (job->state == WJ_PENDING ? " (pending)" : ""));
+
+		if (!reset) continue;
+		job->rounds = job->slices = 0;
+		job->cost = job->cost_max = 0;
+		job->late = job->late_max = 0;
+		job->frames_max = 0;
+	}
+	if (reset) msg_print(Ind, "Job statistics have been reset.");
+}
+
+/* Change the work budget of a job, eg to make purge_old() process more floors per frame */
+bool world_jobs_set_budget(cptr name, int budget) {
+	int j;
+
+	for (j = 0; world_jobs[j].name; j++) {
+		if (strcmp(world_jobs[j].name, name)) continue;
+		world_jobs[j].budget = budget;
+		return(TRUE);
+	}
+	return(FALSE);
+}
+
 /* WARNING: Every if-check in here should test at a resolution compatible to 'turn % (cfg.fps/6)'
    accordingly, otherwise depending on cfg.fps it might be skipped sometimes, which may or
    may not be critical depending on what it does! - C. Blue */
 static void process_various(void) {
 	int i, j, k;
-	int h = 0, m = 0, s = 0, dwd = 0, dd = 0, dm = 0, dy = 0;
+	int h = 0, m = 0, s = 0;
 #ifndef ARCADE_SERVER
 	time_t now;
 	struct tm *tmp;
@@ -8191,16 +8547,7 @@ static void process_various(void) {
 
 	do_xfers(); /* handle filetransfers per second */
 
-	/* Save the server state occasionally */
-	if (!(turn % ((NumPlayers ? 10L : 1000L) * SERVER_SAVE))) {
-		save_server_info();
-
-		/* Save each player */
-		for (i = 1; i <= NumPlayers; i++) {
-			/* Save this player */
-			save_player(i);
-		}
-	}
+	/* Note: Saving the server state and the daily maintenance are world jobs now, see world_jobs[] */
 
 #if 0 /* might skip an hour if transition is unprecise, ie 1:59 -> 3:00 */
 	/* Extra LUA function in custom.lua */
@@ -8229,45 +8576,6 @@ static void process_various(void) {
  #endif
 #endif
 
-	/* daily maintenance */
-	if (!(turn % (cfg.fps * 86400))) {
-		s_printf("24 hours maintenance cycle\n");
-		scan_characters();
-		scan_accounts();
-		scan_houses();
-#ifdef IRONDEEPDIVE_MIXED_TYPES
-		(void)scan_iddc();
-#endif
-
-#ifdef FIREWORK_DUNGEON
-		init_firework_dungeon();
-#endif
-
-		if (cfg.auto_purge) {
-			s_printf("previous server status: m_max(%d) o_max(%d)\n",
-					m_max, o_max);
-			compact_monsters(0, TRUE);
-			compact_objects(0, TRUE);
-			//compact_traps(0, TRUE);
-			s_printf("current server status:  m_max(%d) o_max(%d)\n",
-					m_max, o_max);
-		}
-#if DEBUG_LEVEL > 1
-		else s_printf("Current server status:  m_max(%d) o_max(%d)\n",
-				m_max, o_max);
-#endif
-		s_printf("Finished maintenance\n");
-		get_date(&dwd, &dd, &dm, &dy);
-		exec_lua(0, format("cron_24h(\"%s\", %d, %d, %d, %d, %d, %d, %d)", showtime(), h, m, s, dwd, dd, dm, dy));
-
-		/* bbs_add_line("--- new day line ---"); */
-
-		/* notify admins? */
-		for (i = 1; i <= NumPlayers; i++) {
-			if (!is_admin(Players[i])) continue;
-			msg_format(i, "\374\377y[24-h maintenance/cron finished - %s]", showtime());
-		}
-	}
 	/* Every 6 hours */
 	if (!(turn % (cfg.fps * 21600))) {
 		/* In case season_halloween is up - allow re-farming the pumpkin, especially important if there isn't much traffic on the server */
@@ -8298,7 +8606,6 @@ static void process_various(void) {
 
 		check_xorders();	/* check for expiry of extermination orders */
 		check_banlist();	/* unban some players */
-		scan_objs();		/* scan objects and houses */
 
 		if (dungeon_store_timer) dungeon_store_timer--; /* Timeout */
 		if (dungeon_store2_timer) dungeon_store2_timer--; /* Timeout */
@@ -10494,6 +10801,61 @@ void steamblast_trigger(int idx) {
 
 
 
+#ifdef SERVER_BENCHMARK
+/* Benchmark mode (-B): sched() calls dungeon() back to back and the time between two
+   marks is added to the phase named at the second mark. BP_SCHED is the time spent
+   outside of dungeon(), ie reading the sockets in sched(). */
+enum { BP_SCHED, BP_WPOS, BP_NET_INPUT, BP_PLAYER_END, BP_TIMED, BP_PLAYER_BEGIN, BP_EFFECTS,
+    BP_MONSTERS, BP_OBJECTS, BP_WORLD, BP_REDRAW, BP_NET_OUTPUT, BP_MAX };
+static cptr bench_phase_name[BP_MAX] = { "sched/io", "death/wpos", "net input", "player end", "timed events", "player begin",
+    "effects", "monsters", "objects", "world/jobs", "redraw", "net output" };
+static long bench_phase_cost[BP_MAX];	/* usec */
+static struct timeval bench_begin, bench_mark;
+static s32b bench_turns_done = 0;
+
+static void bench_phase(int phase) {
+	struct timeval now;
+
+	gettimeofday(&now, NULL);
+	bench_phase_cost[phase] += (now.tv_sec - bench_mark.tv_sec) * 1000000L + (now.tv_usec - bench_mark.tv_usec);
+	bench_mark = now;
+}
+ #define BENCH_PHASE(phase)	if (bench_turns) bench_phase(phase)
+
+/* Log the benchmark results (s_printf() also echoes them to stdout), then exit without saving,
+   so the next run starts from the very same savefiles */
+static void bench_finish(void) {
+	long total = (bench_mark.tv_sec - bench_begin.tv_sec) * 1000000L + (bench_mark.tv_usec - bench_begin.tv_usec);
+	char buf[MAX_CHARS_WIDE];
+	int i;
+
+	if (total <= 0) total = 1;
+	for (i = -3; i < BP_MAX; i++) {
+		switch (i) {
+		case -3:
+			snprintf(buf, sizeof(buf), "Benchmark: %d turns (seed %u) in %.3fs = %.1f turns/s, %d players, %d monsters, %d objects",
+			    bench_turns_done, bench_seed, total / 1000000.0, bench_turns_done * 1000000.0 / total, NumPlayers, m_max, o_max);
+			break;
+		case -2:
+			/* Same RNG state at the end means the runs did the same things */
+			snprintf(buf, sizeof(buf), "Benchmark: final turn %d, RNG check %08x", turn, (unsigned int)rand_int(0x10000000));
+			break;
+		case -1:
+			snprintf(buf, sizeof(buf), "Phase          total ms    us/turn   share");
+			break;
+		default:
+			snprintf(buf, sizeof(buf), "%-12s %10.1f %10.2f %6.1f%%", bench_phase_name[i], bench_phase_cost[i] / 1000.0,
+			    (double)bench_phase_cost[i] / bench_turns_done, (bench_phase_cost[i] * 100.0) / total);
+		}
+		s_printf("%s\n", buf);
+	}
+
+	quit(NULL);
+}
+#else
+ #define BENCH_PHASE(phase)
+#endif
+
 /*
  * Main loop --KLJ--
  *
@@ -10506,12 +10868,20 @@ void steamblast_trigger(int idx) {
 
 void dungeon(void) {
 	int i, k;
-	static int export_turns = 1; // Setting this to '1' makes it run on server startup
 	player_type *p_ptr;
 
 	/* Return if no one is playing */
 	/* if (!NumPlayers) return; */
 
+#ifdef SERVER_BENCHMARK
+	if (bench_turns) {
+		if (!bench_turns_done) {
+			gettimeofday(&bench_begin, NULL);
+			bench_mark = bench_begin;
+		} else bench_phase(BP_SCHED);
+	}
+#endif
+
 	/* Check for death.  Go backwards (very important!) */
 	for (i = NumPlayers; i > 0; i--) {
 		/* Check connection first */
@@ -10538,12 +10908,14 @@ void dungeon(void) {
 		/* Process any wpos-change of player */
 		process_player_change_wpos(i);
 	}
+	BENCH_PHASE(BP_WPOS);
 
 	/* New meta client implementation */
 	meta_tick();
 
 	/* Handle any network stuff */
 	Net_input();
+	BENCH_PHASE(BP_NET_INPUT);
 
 
 	/* Note -- this is the END of the last turn */
@@ -10568,6 +10940,7 @@ void dungeon(void) {
 		if (Players[i]->death)
 			player_death(i);
 	}
+	BENCH_PHASE(BP_PLAYER_END);
 
 
 
@@ -10624,21 +10997,15 @@ void dungeon(void) {
 		for (i = 1; i < MAX_PARTIES; i++) {
 			if (parties[i].members == 0) parties[i].created = 0;
 		}
+
+		/* World jobs and effects are scheduled by absolute turn */
+		world_jobs_reschedule();
+		effects_reschedule();
 	}
 
 	/* Do some queued drawing */
 	process_lite_later();
 
-#ifdef PLAYER_STORES
- #ifdef EXPORT_PLAYER_STORE_OFFERS
-  #if EXPORT_PLAYER_STORE_OFFERS > 0
-	/* Export player store items every n hours */
-	if (!(turn % (cfg.fps * 60 * EXPORT_PLAYER_STORE_OFFERS))) export_player_store_offers(&export_turns);
-	else if (export_turns) export_player_store_offers(&export_turns);
-  #endif
- #endif
-#endif
-
 	/* Process solo-reking timers (if enabled) and quest (de)activations, once a minute. */
 	if (!(turn % (cfg.fps * 60))) {
 #ifdef SOLO_REKING
@@ -10839,6 +11206,7 @@ void dungeon(void) {
 	/* Process server-side visual special fx */
 	if (season_newyearseve && fireworks && !(turn % (cfg.fps / 4)))
 		process_firework_creation();
+	BENCH_PHASE(BP_TIMED);
 
 
 
@@ -10940,12 +11308,13 @@ void dungeon(void) {
 		/* Process the world of that player */
 		process_world_player(i);
 	}
+	BENCH_PHASE(BP_PLAYER_BEGIN);
 
 	/* Process spell effects */
 	process_effects();
 
 	/* Process projections' teleportation effects on monsters */
-	if (scan_do_dist) { /* Optimization: Only check all monsters when needed */
+	if (scan_do_dist) { /* Only check all monsters if we lost track of them */
 		for (i = 0; i < m_top; i++) {
 			if (m_list[m_fast[i]].do_dist) {
 				teleport_away(m_fast[i], m_list[m_fast[i]].do_dist);
@@ -10953,7 +11322,15 @@ void dungeon(void) {
 			}
 		}
 		scan_do_dist = FALSE;
+	} else {
+		/* Entries may be stale if the monster died meanwhile and its slot got reused */
+		for (i = 0; i < do_dist_num; i++) {
+			if (!m_list[do_dist_list[i]].r_idx || !m_list[do_dist_list[i]].do_dist) continue;
+			teleport_away(do_dist_list[i], m_list[do_dist_list[i]].do_dist);
+			m_list[do_dist_list[i]].do_dist = FALSE;
+		}
 	}
+	do_dist_num = 0;
 
 #ifdef FLUENT_ARTIFACT_RESETS
 	process_artifacts();
@@ -10962,6 +11339,7 @@ void dungeon(void) {
 #ifdef ENABLE_MERCHANT_MAIL
 	process_merchant_mail();
 #endif
+	BENCH_PHASE(BP_EFFECTS);
 
 	/* Process all of the monsters */
 #ifdef ASTAR_DISTRIBUTE
@@ -10975,6 +11353,7 @@ void dungeon(void) {
 
 	/* Process programmable NPCs */
 	if (!(turn % NPC_TURNS)) process_npcs();
+	BENCH_PHASE(BP_MONSTERS);
 
 	/* Process all of the objects */
 	/* Currently, process_objects() only recharges rods on the floor and in trap kits.
@@ -10982,6 +11361,7 @@ void dungeon(void) {
 	   so they're both recharging at the same rate.
 	   Note: the exact timing for each object is measured inside the function. */
 	process_objects();
+	BENCH_PHASE(BP_OBJECTS);
 
 	/* Process the world */
 	if (!(turn % 50)) process_world();
@@ -11016,8 +11396,8 @@ void dungeon(void) {
 	/* Clean up Bree regularly to prevent too dangerous towns in which weaker characters cant move around */
 	thin_surface_spawns(); //distributes workload now
 
-	/* Used to be in process_various(), but changed it to distribute workload over all frames now. */
-	purge_old();
+	/* Recurring maintenance (purging old floors, saving, object scans, ...) that distributes its workload over frames */
+	process_world_jobs();
 
 	/* Process everything else */
 	if (!(turn % (cfg.fps / 6))) {
@@ -11287,6 +11667,7 @@ void dungeon(void) {
 #else /* call it once every palette-animation-step time interval */
 	if (!(turn % (HOUR / PALANIM_HOUR_DIV))) process_day_and_night();
 #endif
+	BENCH_PHASE(BP_WORLD);
 
 	/* Refresh everybody's displays */
 	for (i = 1; i <= NumPlayers; i++) {
@@ -11335,9 +11716,17 @@ void dungeon(void) {
 	/* Process Go AI engine communication (its replies) */
 	if (go_engine_processing && !(turn % (cfg.fps / 10))) go_engine_process();
 #endif
+	BENCH_PHASE(BP_REDRAW);
 
 	/* Send any information over the network */
 	Net_output();
+
+#ifdef SERVER_BENCHMARK
+	if (bench_turns) {
+		bench_phase(BP_NET_OUTPUT);
+		if (++bench_turns_done >= bench_turns) bench_finish();
+	}
+#endif
 }
 
 void set_runlevel(int val) {
@@ -11444,6 +11833,13 @@ redo_world:
 		Rand_quick = FALSE;
 
 		/* Seed the "complex" RNG */
+#ifdef SERVER_BENCHMARK
+		/* Benchmark runs must be reproducible */
+		if (bench_turns) {
+			Rand_state_seed(bench_seed);
+			srand(bench_seed);
+		} else
+#endif
 		Rand_state_init(seed);
 	}
 
@@ -11539,6 +11935,9 @@ redo_world:
 			o_max = 1;
 			o_nxt = 1;
 			o_top = 0;
+#ifdef TIMED_OBJECT_LIST
+			object_timed_flush();
+#endif
 
 			/* free old monsters */
 			C_KILL(m_list, MAX_M_IDX, monster_type);
@@ -11562,6 +11961,9 @@ redo_world:
 			C_MAKE(houses, house_alloc, house_type);
 			C_MAKE(houses_bak, house_alloc, house_type);
 			num_houses = 0;
+#ifdef HOUSE_INDEX
+			house_index_rebuild();
+#endif
 
 			/* free old town[] and town[]->store info */
 			if (town) {
@@ -11642,6 +12044,9 @@ redo_world:
 			C_MAKE(houses, house_alloc, house_type);
 			C_MAKE(houses_bak, house_alloc, house_type);
 			num_houses = 0;
+#ifdef HOUSE_INDEX
+			house_index_rebuild();
+#endif
 		}
 	}
 
@@ -11817,6 +12222,11 @@ void shutdown_server(void) {
 	go_engine_terminate();
 #endif
 
+#ifdef MEM_ACCOUNTING
+	/* Whatever is still allocated now, for finding leaks */
+	mem_acct_dump("Shutdown");
+#endif
+
 	if (cfg.runlevel == -1) quit("Terminating");
 	else quit("Server state saved");
 
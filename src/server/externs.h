@@ -93,6 +93,16 @@ extern bool get_conn_state_ok(int Ind);
 extern void do_quit(int ind, bool tellclient);
 extern int check_multi_exploit(char *acc, char *nick);
 extern int max_connections;
+#ifdef PACKET_CAPTURE
+extern bool capture_new_connections;
+extern bool capture_start(int ind);
+extern void capture_stop(int ind);
+extern void capture_report(int Ind);
+#endif
+#ifdef CMD_QUEUE
+extern void cmdq_report(int Ind);
+extern void cmdq_reset(void);
+#endif
 
 /* randart.c */
 extern artifact_type *ego_make(object_type *o_ptr);
@@ -244,6 +254,10 @@ extern void new_level_rand_y(struct worldpos *wpos, int y);
 extern s32b turn, session_turn, turn_overflow;
 extern int turn_plus;
 extern int turn_plus_extra;
+#ifdef SERVER_BENCHMARK
+extern s32b bench_turns;
+extern u32b bench_seed;
+#endif
 
 #ifdef ARCADE_SERVER
 //extern char tron_speed;
@@ -265,6 +279,8 @@ extern s32b opening_chest;
 extern bool scan_monsters;
 extern bool scan_objects;
 extern bool scan_do_dist;
+extern s16b do_dist_list[MAX_M_IDX];
+extern int do_dist_num;
 extern s32b o_nxt;
 extern s32b o_max;
 extern s32b o_top;
@@ -553,6 +569,13 @@ extern dun_level *getfloor(struct worldpos *wpos);
 extern int cave_set_feat(worldpos *wpos, int y, int x, int feat);
 extern bool cave_set_feat_live(worldpos *wpos, int y, int x, int feat);
 extern bool cave_set_feat_live_ok(worldpos *wpos, int y, int x, int feat);
+extern s16b *floor_query_begin(void);
+extern void floor_query_end(s16b *list);
+extern int floor_monsters_rect(cave_type **zcave, int y1, int x1, int y2, int x2, bool (*hook)(int m_idx), s16b *list, int max);
+extern int floor_monsters_radius(cave_type **zcave, int y, int x, int rad, bool (*hook)(int m_idx), s16b *list, int max);
+extern int floor_monsters_nearest(cave_type **zcave, int y, int x, int rad, bool (*hook)(int m_idx), s16b *list, int k);
+extern int floor_objects_radius(cave_type **zcave, int y, int x, int rad, s16b *list, int max);
+extern void spatial_bench(int Ind, int count);
 #ifdef DM_MODULES
 extern void custom_cave_set_feat(worldpos *wpos, int y, int x, int feat,
     s16b custom_lua_tunnel_hand, s16b custom_lua_tunnel, s16b custom_lua_search, byte custom_lua_search_diff_minus, byte custom_lua_search_diff_chance,
@@ -562,6 +585,13 @@ extern bool custom_cave_set_feat_live(worldpos *wpos, int y, int x, int feat,
     s16b custom_lua_newlivefeat, s16b custom_lua_way, s16b custom_lua_spawned);
 #endif
 extern bool cave_force_feat_live(worldpos *wpos, int y, int x, int feat);
+extern void bump_feat_epoch(struct worldpos *wpos);
+#ifdef LOS_CACHE
+extern bool los_cache_enabled, los_cache_verify;
+extern u32b los_cache_hits, los_cache_misses, los_cache_mismatches;
+extern void free_los_cache(dun_level *l_ptr);
+extern int los_cache_count(void);
+#endif
 #if defined(ARCADE_SERVER) || defined(DM_MODULES)
 extern int check_feat(worldpos *wpos, int y, int x);
 #endif
@@ -600,6 +630,11 @@ extern void print_rel(char c, byte a, int y, int x);
 extern void note_spot(int Ind, int y, int x);
 extern void new_players_on_depth(struct worldpos *wpos, int value, bool inc);
 extern int players_on_depth(struct worldpos *wpos);
+extern int floor_lru_num, floors_allocated;
+extern void floor_lru_update(struct worldpos *wpos, bool touch);
+extern void floor_lru_remove(struct worldpos *wpos);
+extern void floor_lru_walk_start(void);
+extern bool floor_lru_walk_next(struct worldpos *wpos);
 extern void check_Pumpkin(void);
 extern void check_Morgoth(int Ind);
 extern bool los(struct worldpos *wpos, int y1, int x1, int y2, int x2);
@@ -651,6 +686,14 @@ extern void disturb(int Ind, int stop_search, int keep_resting);
 extern void update_players(void);
 
 extern int new_effect(int who, int type, int dam, int time, int interval, worldpos *wpos, int cy, int cx, int rad, s32b flags);
+extern int effects_active[MAX_EFFECTS], effects_active_num;
+extern void effect_schedule(int k);
+extern void effects_reschedule(void);
+extern void effects_collect_due(void);
+extern int effect_next_due(void);
+extern void effect_release(int k);
+extern void erase_floor_effects(struct worldpos *wpos);
+extern int effect_grid_cover(struct worldpos *wpos, int y, int x, int except);
 extern bool allow_terraforming(struct worldpos *wpos, u16b feat);
 extern void everyone_lite_later_spot(struct worldpos *wpos, int y, int x);
 extern bool outdoor_affects(struct worldpos *wpos);
@@ -738,6 +781,13 @@ extern int pick_house(struct worldpos *wpos, int y, int x);
 extern int pick_player(house_type *h_ptr);
 extern bool inside_house(struct worldpos *wpos, int x, int y);
 extern int inside_which_house(struct worldpos *wpos, int x, int y);
+#ifdef HOUSE_INDEX
+extern void house_index_add(int h_idx);
+extern void house_index_rebuild(void);
+extern int house_first_at(struct worldpos *wpos);
+extern int house_next_at(int h_idx);
+extern void house_index_bench(int Ind, int count);
+#endif
 extern bool inside_inn(player_type *p_ptr, cave_type *c_ptr);
 extern void house_admin(int Ind, int dir, char *args);
 extern void do_cmd_cloak(int Ind);
@@ -910,6 +960,10 @@ extern void dungeon(void);
 extern void pack_overflow(int Ind);
 extern void set_runlevel(int val);
 extern void store_turnover(void);
+extern void world_jobs_reschedule(void);
+extern void world_jobs_report(int Ind, bool reset);
+extern bool world_jobs_set_budget(cptr name, int budget);
+extern void purge_old_report(int Ind);
 int has_ball (player_type *p_ptr);
 
 extern void cheeze(object_type *o_ptr);
@@ -1044,6 +1098,7 @@ extern void deltown(int Ind);
 extern int determine_wilderness_type(struct worldpos *wpos);
 extern void wilderness_gen(struct worldpos *wpos);
 extern void set_mon_num_hook_wild(struct worldpos *wpos);
+extern int wild_monst_hook_id(bool (*hook)(int r_idx));
 extern void wild_add_monster(struct worldpos *wpos);
 extern bool fill_house(house_type *h_ptr, int func, void *data);
 extern void wild_add_uhouse(house_type *h_ptr);
@@ -1175,6 +1230,14 @@ extern int restrict_monster_to_dungeon(int r_idx, int dun_type);
 extern errr get_mon_num_prep(int dun_type, char *reject_monsters);
 extern errr get_mon_num_prep_wild(int town_distance, char *reject_monsters);
 extern s16b get_mon_num(int level, int dlevel);
+#ifdef MON_NUM_CACHE
+extern bool mon_num_cache_enabled;
+extern u32b mon_num_hits, mon_num_misses, mon_num_uncached, mon_num_redraws, mon_num_fallbacks;
+extern void mon_num_cache_flush(void);
+extern void mon_num_report(int Ind);
+extern void mon_num_check(int Ind, int level, int dlevel, int dun_type, int samples);
+extern void mon_num_bench(int Ind, int level, int count);
+#endif
 extern void set_mon_num2_hook(int feat);
 extern void set_mon_num_hook(struct worldpos *wpos);
 extern void monster_desc(int Ind, char *desc, int m_idx, int mode);
@@ -1187,6 +1250,10 @@ extern void update_monsters(bool dist);
 extern void update_player(int Ind);
 extern void update_player_flicker(int Ind);
 extern void update_players(void);
+#ifdef PLAYER_VIS_ROSTER
+extern void player_vis_report(int Ind);
+extern void player_vis_reset(void);
+#endif
 extern int place_monster_aux(struct worldpos *wpos, int y, int x, int r_idx, bool slp, bool grp, int clo, int clone_summoning);
 extern int place_monster_one(struct worldpos *wpos, int y, int x, int r_idx, int ego, int randuni, bool slp, int clo, int clone_summoning);
 extern bool place_monster(struct worldpos *wpos, int y, int x, bool slp, bool grp);
@@ -1439,6 +1506,13 @@ extern void reset_visuals(void);
 extern bool object_similar_tval(int Ind, object_type *o_ptr, object_type *j_ptr, s16b tolerance, bool unknown);
 extern void object_flags(object_type *o_ptr, u32b *f1, u32b *f2, u32b *f3, u32b *f4, u32b *f5, u32b *f6, u32b *esp);
 extern void object_desc(int Ind, char *buf, object_type *o_ptr, int pref, int mode);
+#ifdef OBJECT_DESC_CACHE
+extern bool object_desc_cache_enabled, object_desc_check;
+extern u32b object_desc_hits, object_desc_misses, object_desc_mismatches;
+extern void object_desc_cache_flush(void);
+extern void object_desc_report(int Ind);
+extern void object_desc_bench(int Ind, int count);
+#endif
 extern void object_desc_store(int Ind, char *buf, object_type *o_ptr, int pref, int mode);
 #ifndef NEW_ID_SCREEN
 extern bool identify_fully_aux(int Ind, object_type *o_ptr, bool assume_aware);
@@ -1505,6 +1579,14 @@ extern int o_pop(void);
 extern errr get_obj_num_prep(u64b resf);
 extern errr get_obj_num_prep_tval(int tval, u64b resf); /* was written for create_reward(..) */
 extern s16b get_obj_num(int max_level, u64b resf);
+#ifdef OBJ_NUM_CACHE
+extern bool obj_num_cache_enabled;
+extern u32b obj_num_hits, obj_num_misses, obj_num_uncached, obj_num_fallbacks;
+extern void obj_num_cache_flush(void);
+extern void obj_num_report(int Ind);
+extern void obj_num_check(int Ind, int count);
+extern void obj_num_bench(int Ind, int count);
+#endif
 extern void object_known(object_type *o_ptr);
 extern bool object_aware(int Ind, object_type *o_ptr);
 extern bool object_aware_k_idx(int Ind, int k_idx);
@@ -1517,6 +1599,12 @@ extern s16b lookup_kind(int tval, int sval);
 extern void invwipe(object_type *o_ptr);
 extern void invcopy(object_type *o_ptr, int k_idx);
 extern void process_objects(void);
+#ifdef TIMED_OBJECT_LIST
+extern void object_timed_check(int o_idx);
+extern void object_timed_flush(void);
+extern void object_timed_report(int Ind);
+extern void object_timed_reset(void);
+#endif
 extern cptr item_activation(object_type *o_ptr);
 extern void combine_pack(int Ind);
 extern void reorder_pack(int Ind);
@@ -1530,6 +1618,7 @@ extern s32b artifact_flag_cost(object_type *o_ptr, int plusses);
 extern void eliminate_common_ego_flags(object_type *o_ptr, u32b *f1, u32b *f2, u32b *f3, u32b *f4, u32b *f5, u32b *f6, u32b *esp);
 
 extern void excise_object_idx(int o_idx);
+extern int kind_is_legal_special;
 extern int kind_is_legal(int k_idx, u64b resf);
 extern void init_match_theme(obj_theme theme);
 
@@ -1732,6 +1821,10 @@ extern bool save_player(int Ind);
 extern bool load_player(int Ind);
 extern bool load_server_info(void);
 extern bool save_server_info(void);
+extern int floor_files_written, floor_files_kept;
+extern void floor_file_name(char *buf, struct worldpos *wpos);
+extern void floor_files_track(struct worldpos *wpos, u32b stamp);
+extern u64b floor_content_hash(struct worldpos *wpos);
 extern void save_banlist(void);
 /* for actually loading/saving dynamic quest information */
 extern void save_quests(void);
@@ -2013,12 +2106,22 @@ extern void store_debug_stock();
 
 extern void alloc_stores(int townval);
 extern void dealloc_stores(int townval);
+#ifdef OBJ_NUM_CACHE
+extern int store_obj_hook_id(int (*hook)(int k_idx, u64b resf), u32b *state);
+#endif
 extern void store_purchase(int Ind, int item, int amt);
 extern void store_sell(int Ind, int item, int amt);
 extern void store_confirm(int Ind);
 extern void do_cmd_store(int Ind);
 extern void store_shuffle(store_type *st_ptr);
 extern void store_maint(store_type *st_ptr);
+#ifdef STORE_ITEM_POOL
+extern void store_restock(store_type *st_ptr, int num);
+extern bool store_pool_refill(int *cursor, int budget);
+extern void store_pool_report(int Ind);
+extern void store_pool_reset(void);
+extern void store_restock_check(int Ind, int st_idx, int num, int runs);
+#endif
 extern void store_init(store_type *st_ptr);
 extern void store_kick(int Ind, bool say);
 extern void store_exit(int Ind);
@@ -2265,6 +2368,14 @@ extern bool may_address_dm(player_type *p_ptr);
 extern char *custom_lua_timer_parmstr_get(int i);
 extern void custom_lua_timer_parmstr_set(int i, char *str);
 extern struct dungeon_type *admin_dun(int Ind, bool *tower);
+#ifdef MEM_ACCOUNTING
+extern void mem_acct_init(void);
+extern bool mem_acct_tag(int tag, cptr *name, u64b *bytes, u32b *blocks);
+extern u64b mem_acct_peak(void);
+extern void mem_acct_report(int Ind, int sites);
+extern void mem_acct_reset(void);
+extern void mem_acct_dump(cptr reason);
+#endif
 
 /* world.c */
 extern struct list *rpmlist;
@@ -2285,6 +2396,14 @@ extern void calc_mana(int Ind);
 
 extern void calc_hitpoints(int Ind);
 extern void calc_boni(int Ind);
+extern u32b boni_calls;
+extern void boni_reset(void);
+extern void boni_report(int Ind);
+#ifdef BONI_SLOT_CACHE
+extern bool boni_slot_cache_enabled, boni_slot_check;
+extern void boni_slot_flush(void);
+extern void boni_bench(int Ind, int count);
+#endif
 extern void calc_body_spells(int Ind);
 extern void calc_boni_weapon(int Ind, object_type *o_ptr, int *to_hit, int *to_dam);
 extern int get_archery_skill(player_type *p_ptr);
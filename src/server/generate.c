@@ -9129,6 +9129,9 @@ static void cave_gen(struct worldpos *wpos, player_type *p_ptr) {
 				table[i].prob1 = 10000;
 				table[i].prob2 = 10000;
 				table[i].prob3 = 10000;
+#ifdef MON_NUM_CACHE
+				mon_num_cache_flush();
+#endif
 				break;
 			}
 			i++;
@@ -9812,6 +9815,9 @@ static void cave_gen(struct worldpos *wpos, player_type *p_ptr) {
 			table[hack_dun_table_idx].prob1 = hack_dun_table_prob1;
 			table[hack_dun_table_idx].prob2 = hack_dun_table_prob2;
 			table[hack_dun_table_idx].prob3 = hack_dun_table_prob3;
+#ifdef MON_NUM_CACHE
+			mon_num_cache_flush();
+#endif
 		}
 		r_info[hack_monster_idx].rarity = hack_monster_rarity;
 	}
@@ -10570,6 +10576,9 @@ static void build_store(struct worldpos *wpos, int n, int yy, int xx) {
 #endif	/* USE_MANG_HOUSE */
 
 					/* One more house */
+#ifdef HOUSE_INDEX
+					house_index_add(num_houses);
+#endif
 					num_houses++;
 					if ((house_alloc - num_houses) < 32) {
 						GROW(houses, house_alloc, house_alloc + 512, house_type);
@@ -10665,6 +10674,9 @@ static void build_store(struct worldpos *wpos, int n, int yy, int xx) {
 #endif	/* USE_MANG_HOUSE_ONLY */
 
 			/* One more house */
+#ifdef HOUSE_INDEX
+			house_index_add(num_houses);
+#endif
 			num_houses++;
 			if ((house_alloc - num_houses) < 32) {
 				GROW(houses, house_alloc, house_alloc + 512, house_type);
@@ -11333,8 +11345,10 @@ void alloc_dungeon_level(struct worldpos *wpos) {
 		dlp = &d_ptr->level[ABS(wpos->wz) - 1];
 		dlp->cave = zcave;
 		dlp->creationtime = time(NULL);
+		dlp->dirty = TRUE;
 	} else {
 		w_ptr->surface.cave = zcave;
+		w_ptr->surface.dirty = TRUE;
 
 		/* Unlike dungeon floors, worldmap surface sectors are always max sized. */
 		w_ptr->surface.wid = MAX_WID;
@@ -11368,6 +11382,10 @@ void alloc_dungeon_level(struct worldpos *wpos) {
 			break;
 		}
 	}
+
+	/* Resident now, purge_old() will keep an eye on it */
+	floors_allocated++;
+	floor_lru_update(wpos, TRUE);
 }
 
 /*
@@ -11451,6 +11469,9 @@ void dealloc_dungeon_level(struct worldpos *wpos) {
 	}
 	/* Deallocate the array of rows */
 	C_FREE(zcave, MAX_HGT, cave_type *);
+#ifdef LOS_CACHE
+	if (l_ptr) free_los_cache(l_ptr);
+#endif
 	if (wpos->wz) {
 		struct dun_level *dlp;
 		struct dungeon_type *d_ptr;
@@ -11459,6 +11480,13 @@ void dealloc_dungeon_level(struct worldpos *wpos) {
 		dlp = &d_ptr->level[ABS(wpos->wz) - 1];
 		dlp->cave = NULL;
 	} else w_ptr->surface.cave = NULL;
+
+	/* Free the slots of any lasting effects that were still running there */
+	erase_floor_effects(wpos);
+
+	/* Stays tracked only if it's still static */
+	floors_allocated--;
+	floor_lru_update(wpos, FALSE);
 }
 
 /* added 'force' to delete it even if someone is still inside,
@@ -11549,6 +11577,7 @@ static bool del_dungeon(struct worldpos *wpos, bool tower, bool force) {
 				d_ptr->level[i].ondepth = 0;//obsolete?
 			}
 			if (d_ptr->level[i].cave) dealloc_dungeon_level(&twpos);
+			floor_lru_remove(&twpos);
 #ifndef UNIQUES_KILLED_ARRAY
 			C_KILL(d_ptr->level[i].uniques_killed, MAX_R_IDX, char);
 #endif
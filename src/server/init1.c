@@ -10369,6 +10369,9 @@ errr process_dungeon_file(cptr name, worldpos *wpos, int *yval, int *xval, int y
 	/* Close the file */
 	my_fclose(fp);
 
+	/* The layout of an already allocated floor may have been changed live */
+	bump_feat_epoch(wpos);
+
 	/* update player maps */
 	for (i = 1; i <= NumPlayers; i++) {
 		/* Only for players on the level */
@@ -3413,6 +3413,10 @@ static void set_server_option(char * option, char * value) {
 		cfg.worldd_events = str_to_boolean(value);
 	else if (!strcmp(option, "LEAK_INFO"))
 		cfg.leak_info = atoi(value);
+	else if (!strcmp(option, "CMDQ_RATE_LIMIT"))
+		cfg.cmdq_rate_limit = atoi(value);
+	else if (!strcmp(option, "CMDQ_MAX_DEPTH"))
+		cfg.cmdq_max_depth = atoi(value);
 
 	else s_printf("Error : unrecognized tomenet.cfg option %s\n", option);
 }
@@ -4059,6 +4063,19 @@ void reinit_some_arrays(void) {
 	if (reinit_e_info()) quit("Cannot reinitialize ego-items");
 #endif
 
+#ifdef OBJ_NUM_CACHE
+	obj_num_cache_flush();
+#endif
+#ifdef MON_NUM_CACHE
+	mon_num_cache_flush();
+#endif
+#ifdef BONI_SLOT_CACHE
+	boni_slot_flush();
+#endif
+#ifdef OBJECT_DESC_CACHE
+	object_desc_cache_flush();
+#endif
+
 	s_printf("[Reinitializing arrays... done]\n");
 }
 
@@ -3951,6 +3951,9 @@ errr rd_server_savefile() {
 		if (!(houses[i].flags & HF_STOCK))
 			wild_add_uhouse(&houses[i]);
 	}
+#ifdef HOUSE_INDEX
+	house_index_rebuild();
+#endif
 
 	/* Read the player name database if new enough */
 	{
@@ -4424,8 +4427,141 @@ void new_rd_wild() {
 #endif
 }
 
+/* Read the header of a floor file: savefile version, then the floor and stamp it belongs to */
+static void rd_floor_file_header(struct worldpos *wpos, u32b *stamp) {
+	xor_byte = 0;
+	rd_byte(&ssf_major);
+	xor_byte = 0;
+	rd_byte(&ssf_minor);
+	xor_byte = 0;
+	rd_byte(&ssf_patch);
+	xor_byte = 0;
+	rd_byte(&ssf_extra);
+	v_check = 0L;
+	x_check = 0L;
+
+	rd_s16b(&wpos->wx);
+	rd_s16b(&wpos->wy);
+	rd_s16b(&wpos->wz);
+	rd_u32b(stamp);
+}
+
+/* Open a floor file and verify all of it before anything gets loaded: its header must name the
+   floor and stamp that the server savefile refers to, and the checksum over the whole file must match.
+   On success the file is left open right behind the header, ready for rd_floor(). */
+static bool floor_file_open(cptr name, struct worldpos *wpos, u32b stamp) {
+	struct worldpos fwpos;
+	u32b fstamp, check;
+	long size, pos;
+	cptr err = NULL;
+
+	if (!(fff = my_fopen(name, "rb"))) return(FALSE);
+
+	/* header + end marker of an empty floor + checksum */
+	if (fseek(fff, 0L, SEEK_END) || (size = ftell(fff)) < 4 + 10 + 6 + 4 || fseek(fff, 0L, SEEK_SET)) err = "truncated";
+	else {
+		fff_buf_pos = MAX_BUF_SIZE;
+		rd_floor_file_header(&fwpos, &fstamp);
+		if (!inarea(&fwpos, wpos)) err = "holds a different floor";
+		else if (fstamp != stamp) err = "is from another save";
+		else {
+			for (pos = 4 + 10; pos < size - 4; pos++) (void)sf_get();
+			check = v_check;
+			rd_u32b(&fstamp);
+			if (fstamp != check) err = "has a checksum mismatch";
+		}
+	}
+	if (!err) {
+		/* Rewind for the real thing */
+		if (fseek(fff, 0L, SEEK_SET)) err = "can't be rewound";
+		else {
+			fff_buf_pos = MAX_BUF_SIZE;
+			rd_floor_file_header(&fwpos, &fstamp);
+			return(TRUE);
+		}
+	}
+
+	s_printf("rd_floor_file(): %s %s.\n", name, err);
+	my_fclose(fff);
+	fff = NULL;
+	return(FALSE);
+}
+
+/* Load a floor from its own floor file (see wr_floor_file()) */
+static void rd_floor_file(struct worldpos *wpos, u32b stamp) {
+	FILE *fff_old = fff;
+	byte *fff_buf_old = fff_buf, xor_byte_old = xor_byte;
+	byte ssf_major_old = ssf_major, ssf_minor_old = ssf_minor, ssf_patch_old = ssf_patch, ssf_extra_old = ssf_extra;
+	int fff_buf_pos_old = fff_buf_pos;
+	u32b v_check_old = v_check, x_check_old = x_check;
+	char name[MAX_PATH_LENGTH], name_new[MAX_PATH_LENGTH];
+	dun_level *l_ptr;
+	bool ok, from_new = FALSE;
+
+	floor_file_name(name, wpos);
+	strcpy(name_new, name);
+	strcat(name_new, ".new");
+
+	fff_buf = C_NEW(MAX_BUF_SIZE, byte);
+
+	/* The server crashed right after writing the server savefile, before its floor files were moved into place? */
+	ok = floor_file_open(name, wpos, stamp);
+	if (!ok && (ok = from_new = floor_file_open(name_new, wpos, stamp))) s_printf("rd_floor_file(): Using %s.\n", name_new);
+
+	if (!ok) s_printf("rd_floor_file(): No valid floor file for %s, it will be regenerated.\n", wpos_format(0, wpos));
+	else {
+		(void)rd_floor();
+		my_fclose(fff);
+
+		/* Finish what floor_files_commit() didn't get to, or at least have the floor rewritten next time */
+		if (from_new && rename(name_new, name)) s_printf("rd_floor_file(): Failed to rename %s.\n", name_new);
+		else from_new = FALSE;
+
+		/* Up to date with its floor file */
+		if ((l_ptr = getfloor(wpos))) {
+			l_ptr->dirty = from_new;
+			l_ptr->file_stamp = stamp;
+			l_ptr->file_hash = floor_content_hash(wpos);
+			floor_files_track(wpos, stamp);
+		}
+	}
+
+	C_FREE(fff_buf, MAX_BUF_SIZE, byte);
+
+	fff = fff_old;
+	fff_buf = fff_buf_old;
+	fff_buf_pos = fff_buf_pos_old;
+	xor_byte = xor_byte_old;
+	v_check = v_check_old;
+	x_check = x_check_old;
+	ssf_major = ssf_major_old;
+	ssf_minor = ssf_minor_old;
+	ssf_patch = ssf_patch_old;
+	ssf_extra = ssf_extra_old;
+}
+
 void new_rd_floors() {
-	while (!rd_floor());
+	struct worldpos wpos;
+	u32b stamp;
+
+	/* Floors used to be stored inside the server savefile itself */
+	if (s_older_than(4, 9, 25)) {
+		while (!rd_floor());
+		return;
+	}
+
+	while (TRUE) {
+		rd_s16b(&wpos.wx);
+		rd_s16b(&wpos.wy);
+		rd_s16b(&wpos.wz);
+		if (wpos.wx == 0x7fff && wpos.wy == 0x7fff && wpos.wz == 0x7fff) break;
+
+		/* 4.9.25 floor files had no header yet and can't be verified, let those floors regenerate */
+		if (s_older_than(4, 9, 26)) continue;
+
+		rd_u32b(&stamp);
+		rd_floor_file(&wpos, stamp);
+	}
 }
 
 void rd_towns() {
@@ -4461,7 +4597,11 @@ void load_guildhalls(struct worldpos *wpos) {
 	char fname[30];
 
 	data.mode = 0;
+#ifdef HOUSE_INDEX
+	for (i = house_first_at(wpos); i != -1; i = house_next_at(i)) {
+#else
 	for (i = 0; i < num_houses; i++) {
+#endif
 		if ((houses[i].dna->owner_type == OT_GUILD) && (inarea(wpos, &houses[i].wpos))) {
 			if (!houses[i].dna->owner) continue;
 #if DEBUG_LEVEL > 2
@@ -4487,7 +4627,11 @@ void save_guildhalls(struct worldpos *wpos) {
 	char fname[30];
 
 	data.mode = 1;
+#ifdef HOUSE_INDEX
+	for (i = house_first_at(wpos); i != -1; i = house_next_at(i)) {
+#else
 	for (i = 0; i < num_houses; i++) {
+#endif
 		if ((houses[i].dna->owner_type == OT_GUILD) && (inarea(wpos, &houses[i].wpos))) {
 			if (!houses[i].dna->owner) continue;
 #if DEBUG_LEVEL > 2
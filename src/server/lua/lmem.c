@@ -128,20 +128,30 @@ void *luaM_growaux (lua_State *L, void *block, size_t nelems,
 }
 
 
+/*
+** TomeNET: lets the server account Lua's heap. Same contract as realloc(),
+** a size of 0 frees the block.
+*/
+void *(*luaM_realloc_hook) (void *block, size_t size) = NULL;
+
+#define lua_realloc(b, s)	(luaM_realloc_hook ? (*luaM_realloc_hook)(b, s) : realloc(b, s))
+#define lua_free(b)		(luaM_realloc_hook ? (void)(*luaM_realloc_hook)(b, 0) : free(b))
+
+
 /*
 ** generic allocation routine.
 */
 void *luaM_realloc (lua_State *L, void *block, lint32 size) {
     void *bak;
   if (size == 0) {
-    free(block);  /* block may be NULL; that is OK for free */
+    lua_free(block);  /* block may be NULL; that is OK for free */
     return NULL;
   }
   else if (size >= MAX_SIZET)
     lua_error(L, "memory allocation error: block too big");
-  bak = realloc(block, size);
+  bak = lua_realloc(block, size);
   if (bak == NULL) {
-    free(block);
+    lua_free(block);
     if (L)
       luaD_breakrun(L, LUA_ERRMEM);  /* break run without error message */
     else return NULL;  /* error before creating state! */
@@ -233,6 +233,11 @@ int main(int argc, char *argv[]) {
 	/* Save the "program name" */
 	argv0 = argv[0];
 
+#ifdef MEM_ACCOUNTING
+	/* Account all allocations from here on */
+	mem_acct_init();
+#endif
+
 
 #ifdef USE_286
 	/* Attempt to use XMS (or EMS) memory for swap space */
@@ -362,6 +367,13 @@ int main(int argc, char *argv[]) {
 			config_specified = TRUE;
 			break;
 
+#ifdef SERVER_BENCHMARK
+		case 'B':
+			bench_turns = atoi(&argv[0][2]);
+			if (bench_turns <= 0) goto usage;
+			if (strchr(argv[0], ':')) bench_seed = (u32b)strtoul(strchr(argv[0], ':') + 1, NULL, 10);
+			break;
+#endif
 
 		default:
 			usage:
@@ -381,6 +393,10 @@ int main(int argc, char *argv[]) {
 			puts("  -s<path>  Look for save files in the directory <path>");
 			puts("  -t<path>  Look for text files in the directory <path>");
 			puts("  -m<file>  Specify configuration <file>");
+#ifdef SERVER_BENCHMARK
+			puts("  -B<n>     Benchmark: Run <n> turns unthrottled with a fixed RNG seed (-B<n>:<seed>, default 1),");
+			puts("            then report turns/s and per-phase costs and exit without saving");
+#endif
 
 			/* Actually abort the process */
 			quit(NULL);
@@ -9860,6 +9860,7 @@ static void process_monster(int Ind, int m_idx, bool force_random_movement) {
 			} else if (m_ptr->extra < 35) { //open door ^^
 				if (m_ptr->extra == 33) {
 					zcave[2][55].feat = FEAT_UNSEALED_DOOR;
+					bump_feat_epoch(wpos);
 					everyone_lite_spot(wpos, 2, 55);
 				}
 			} else if (m_ptr->extra < 46) { //move right
@@ -10713,6 +10714,7 @@ static void process_monster(int Ind, int m_idx, bool force_random_movement) {
 					if (rand_int(m_ptr->hp / 10) > k) {
 						/* Unlock the door */
 						c_ptr->feat = FEAT_DOOR_HEAD + 0x00;
+						bump_feat_epoch(wpos);
 #ifdef USE_SOUND_2010
 						sound_near_site(ny, nx, wpos, 0, "open_pick", NULL, SFX_TYPE_COMMAND, FALSE);
 #endif
@@ -11679,6 +11681,7 @@ static void process_monster_pet(int Ind, int m_idx) {
 					if (rand_int(m_ptr->hp / 10) > k) {
 						/* Unlock the door */
 						c_ptr->feat = FEAT_DOOR_HEAD + 0x00;
+						bump_feat_epoch(wpos);
 
 #ifdef USE_SOUND_2010
 						sound_near_site(ny, nx, wpos, 0, "open_pick", NULL, SFX_TYPE_COMMAND, FALSE);
@@ -12136,6 +12139,7 @@ static void process_monster_golem(int Ind, int m_idx) {
 					if (rand_int(m_ptr->hp / 10) > k) {
 						/* Unlock the door */
 						c_ptr->feat = FEAT_DOOR_HEAD + 0x00;
+						bump_feat_epoch(wpos);
 
 #ifdef USE_SOUND_2010
 						sound_near_site(ny, nx, wpos, 0, "open_pick", NULL, SFX_TYPE_COMMAND, FALSE);
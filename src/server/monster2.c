@@ -16,6 +16,9 @@
 
 #include "angband.h"
 
+/* For gettimeofday() */
+#include <sys/time.h>
+
 /*
  * Chance of cloned ego monster being the same ego type, in percent. [50]
  */
@@ -642,6 +645,9 @@ void compact_monsters(int size, bool purge) {
 			/* Structure copy */
 			m_list[i] = m_list[m_max];
 
+			/* Its pending teleport is listed under the old index */
+			if (m_list[i].do_dist) scan_do_dist = TRUE;
+
 			/* Quests: keep questor_m_idx information consistent */
 			if (m_list[i].questor) {
 				q_ptr = &q_info[m_list[i].quest];
@@ -1113,19 +1119,78 @@ int restrict_monster_to_dungeon(int r_idx, int dun_type) {
 
 
 /*
- * Apply a "monster restriction function" to the "monster allocation table"
+ * Everything that get_mon_num_prep() and get_mon_num_prep_wild() derive the
+ * "prob2" field of the monster allocation table from, except for the
+ * 'reject_monsters' array.
  */
-errr get_mon_num_prep(int dun_type, char *reject_monsters) {
-	alloc_entry	*restrict table = alloc_race_table_dun[dun_type];
-	long		i, n, r_idx;
+typedef struct mon_num_prep_type mon_num_prep_type;
+struct mon_num_prep_type {
+	int dun_type;
+	bool (*hook)(int r_idx);
+	bool (*hook2)(int r_idx);
+	bool no_bloodletter;
+	int town_distance;	/* 0 if not prepared for the wilderness */
+	int people_perc, humanoids_perc, animals_perc;
+};
+
+static void mon_num_prep_params(mon_num_prep_type *prep, int dun_type, int town_distance) {
+	prep->dun_type = dun_type;
+	prep->hook = get_mon_num_hook;
+	prep->hook2 = get_mon_num2_hook;
+#ifdef BLOODLETTER_SUMMON_NERF
+	prep->no_bloodletter = !level_generation_time && summon_override_checks != SO_ALL;
+#else
+	prep->no_bloodletter = FALSE;
+#endif
+
+	prep->town_distance = town_distance;
+	prep->people_perc = prep->humanoids_perc = prep->animals_perc = 100;
+	if (!town_distance) return;
+
+	prep->people_perc = (100 * 2) / (town_distance + 1);
+	if (prep->people_perc < 25) prep->people_perc = 25;
+
+	prep->humanoids_perc = (100 * 4) / (town_distance + 3);
+	if (prep->humanoids_perc < 50) prep->humanoids_perc = 50;
+
+	prep->animals_perc = 150 + town_distance * 10; /* This actually also boosts rarer animals as it flattens the chance differences against the cap of 10000 */
+	if (prep->animals_perc > 300) prep->animals_perc = 300;
+}
+
+/* The "prob2" of an allocation entry that isn't rejected */
+static s16b mon_num_prob2(mon_num_prep_type *prep, alloc_entry *entry) {
+	long r_idx = entry->index;
+	s16b p;
+
+	if (prep->no_bloodletter && r_idx == RI_BLOODLETTER) return(0);
+
+	/* Accept monsters which pass the restriction, if any */
+	if ((prep->hook && !(*prep->hook)(r_idx)) || (prep->hook2 && !(*prep->hook2)(r_idx))) return(0);
+	p = entry->prob1;
+	if (!prep->town_distance) return(p);
+
+	/* Modify in favour of animals or against humanoids */
+	if (r_info[r_idx].flags3 & RF3_ANIMAL) {
+		p = (p * prep->animals_perc) / 100;
+		if (p > 10000) p = 10000;
+	} else if (r_info[r_idx].flags8 & RF8_DUNGEON) { // ie not for WILD_ONLY flag monsters such as Woodsman
+		if (r_info[r_idx].d_char == 'p') // 'h' too? or leave them to 'humanoids' below
+			p = (p * prep->people_perc) / 100;
+		else
+			p = (p * prep->humanoids_perc) / 100;
+		if (!p) p = 1;
+	}
+	return(p);
+}
+
+/* Apply a "monster restriction function" to the whole "monster allocation table" */
+static void mon_num_prep_table(mon_num_prep_type *prep, char *reject_monsters) {
+	alloc_entry	*restrict table = alloc_race_table_dun[prep->dun_type];
+	long		i, n;
 
 	/* Select the table based on dungeon type */
 	alloc_race_table = table;
 
-	/* Local copies of the hooks for speed */
-	bool (*hook)(int r_idx) = get_mon_num_hook;
-	bool (*hook2)(int r_idx) = get_mon_num2_hook;
-
 	/* Scan the allocation table */
 	for (i = 0, n = alloc_race_size; i < n; i++) {
 		/* Get the entry */
@@ -1134,105 +1199,270 @@ errr get_mon_num_prep(int dun_type, char *reject_monsters) {
 		/* Default probability for this pass */
 		entry->prob2 = 0;
 
-		/* Access the "r_idx" of the chosen monster */
-		r_idx = entry->index;
-
 		/* Check the monster rejection array provided */
 		if (reject_monsters && reject_monsters[entry->index]) continue;
 
-#ifdef BLOODLETTER_SUMMON_NERF
-		if (r_idx == RI_BLOODLETTER && !level_generation_time && summon_override_checks != SO_ALL) continue;
-#endif
+		entry->prob2 = mon_num_prob2(prep, entry);
+	}
+}
 
-		/* Accept monsters which pass the restriction, if any */
-		if ((!hook || (*hook)(r_idx)) && (!hook2 || (*hook2)(r_idx))) {
-			/* Accept this monster */
-			entry->prob2 = entry->prob1;
-		}
+/* Whether a monster may be picked at all by get_mon_num() for a given depth ("prob3" pass) */
+static bool mon_num_depth_ok(alloc_entry *entry, int dlevel, bool force_depth) {
+	monster_race *r_ptr = &r_info[entry->index];
 
-		/* Do not use this monster */
-		else {
-			/* Decline this monster */
-			continue;
+	/* Depth Monsters never appear out of their depth */
+	/* level = base_depth + depth, be careful(esp.wilderness)
+	 * Appearently only used for Moldoux atm. */
+	if (r_ptr->flags9 & (RF9_ONLY_DEPTH)) {
+		if (entry->level != dlevel) return(FALSE);
+	} else {
+		/* Depth Monsters never appear out of depth */
+		/* This is currently only effectively used by Tik (other than dungeon bosses, which are already floor-locked anyway). */
+		if ((r_ptr->flags1 & RF1_FORCE_DEPTH) || force_depth) {
+			if (entry->level > dlevel) return(FALSE);
+		} else {
+			/* Prevent certain monsters from being generated too much OoD */
+			if ((r_ptr->flags7 & RF7_OOD_10) && (entry->level > dlevel + 10)) return(FALSE);
+			if ((r_ptr->flags7 & RF7_OOD_15) && (entry->level > dlevel + 15)) return(FALSE);
+			if ((r_ptr->flags7 & RF7_OOD_20) && (entry->level > dlevel + 20)) return(FALSE);
 		}
 	}
+	return(TRUE);
+}
 
-	/* Success */
-	return(0);
+#ifdef MON_NUM_CACHE
+/*
+ * Cached distributions for get_mon_num().
+ *
+ * Most preparations use hooks that only look at the monster race (see
+ * mon_num_hook_id()). For those, get_mon_num_prep() doesn't scan the whole
+ * allocation table but just remembers its parameters, and get_mon_num() looks
+ * up the distribution for the requested level band in a small cache instead:
+ * the eligible entries with their cumulative probabilities, from which it
+ * draws by binary search. The 'reject_monsters' array changes all the time
+ * (uniques being killed), so instead of being part of the distribution it is
+ * applied by redrawing, which results in exactly the same probabilities.
+ * Other hooks may depend on global state and take the old way.
+ */
+ #define MON_NUM_CACHE_SIZE	128	/* Cached distributions, power of 2 */
+ #define MON_NUM_REDRAWS	16	/* Give up on the cache if that many draws in a row were rejected */
+
+typedef struct mon_num_dist mon_num_dist;
+struct mon_num_dist {
+	/* Key */
+	u32b serial;		/* mon_num_serial when it was built, 0 for unused */
+	mon_num_prep_type prep;
+	int hook_id, hook2_id;
+	int begin, end, dlevel;
+	bool force_depth;
+
+	/* Eligible entries and their cumulative "prob3" */
+	int num;
+	s16b *entry;
+	s32b *cum;
+};
+
+static mon_num_dist mon_num_cache[MON_NUM_CACHE_SIZE];
+static u32b mon_num_serial = 1;
+
+/* The deferred preparation, if mon_num_lazy */
+static bool mon_num_lazy = FALSE;
+static mon_num_prep_type mon_num_prepped;
+static int mon_num_prepped_hook_id, mon_num_prepped_hook2_id;
+static char *mon_num_reject;
+
+bool mon_num_cache_enabled = TRUE;
+u32b mon_num_hits = 0, mon_num_misses = 0, mon_num_uncached = 0, mon_num_redraws = 0, mon_num_fallbacks = 0;
+
+static bool monster_deep_water(int r_idx);
+static bool monster_shallow_water(int r_idx);
+static bool monster_lava(int r_idx);
+static bool monster_ground(int r_idx);
+
+/* Identify hooks that depend on nothing but the monster race, -1 for any others */
+static int mon_num_hook_id(bool (*hook)(int r_idx)) {
+	int id;
+
+	if (!hook) return(0);
+	if (hook == dungeon_aux) return(1);
+	if (hook == monster_ground) return(2);
+	if (hook == monster_shallow_water) return(3);
+	if (hook == monster_deep_water) return(4);
+	if (hook == monster_lava) return(5);
+	if ((id = wild_monst_hook_id(hook))) return(10 + id);
+	return(-1);
 }
-/* Same as get_mon_num_prep() (for dungeon 0 aka default 'wilderness'/no settings modifications),
-   but additionally consider town distance to reduce amount of humanoids if farther away from town. */
-errr get_mon_num_prep_wild(int town_distance, char *reject_monsters) {
-	alloc_entry	*restrict table = alloc_race_table_dun[0]; //dun_type is zero, no dungeon/default wilderness template
-	long		i, n, r_idx;
-	int people_perc, humanoids_perc, animals_perc;
 
-	if (!town_distance) town_distance = 1;
+/* Invalidate all cached distributions, when allocation entries got modified */
+void mon_num_cache_flush(void) {
+	if (!++mon_num_serial) mon_num_serial = 1;
+}
 
-	people_perc = (100 * 2) / (town_distance + 1);
-	if (people_perc < 25) people_perc = 25;
+/* Try to defer the table preparation to get_mon_num() */
+static bool mon_num_defer(mon_num_prep_type *prep, char *reject_monsters) {
+	mon_num_lazy = FALSE;
+	if (!mon_num_cache_enabled) return(FALSE);
 
-	humanoids_perc = (100 * 4) / (town_distance + 3);
-	if (humanoids_perc < 50) humanoids_perc = 50;
+	mon_num_prepped_hook_id = mon_num_hook_id(prep->hook);
+	mon_num_prepped_hook2_id = mon_num_hook_id(prep->hook2);
+	if (mon_num_prepped_hook_id == -1 || mon_num_prepped_hook2_id == -1) {
+		mon_num_uncached++;
+		return(FALSE);
+	}
 
-	animals_perc = 150 + town_distance * 10; /* This actually also boosts rarer animals as it flattens the chance differences against the cap of 10000 */
-	if (animals_perc > 300) animals_perc = 300;
+	alloc_race_table = alloc_race_table_dun[prep->dun_type];
+	mon_num_prepped = *prep;
+	mon_num_reject = reject_monsters;
+	mon_num_lazy = TRUE;
+	return(TRUE);
+}
 
+/* Find or build the distribution of the deferred preparation for a level band */
+static mon_num_dist *mon_num_lookup(int begin, int end, int dlevel, bool force_depth) {
+	mon_num_prep_type *prep = &mon_num_prepped;
+	mon_num_dist *d;
+	alloc_entry *entry;
+	u32b h;
+	s32b total = 0;
+	s16b p;
+	int i;
 
-	/* Select the table based on dungeon type */
-	alloc_race_table = table;
+	h = (u32b)prep->dun_type;
+	h = h * 31 + (u32b)prep->town_distance;
+	h = h * 31 + (u32b)mon_num_prepped_hook_id;
+	h = h * 31 + (u32b)mon_num_prepped_hook2_id;
+	h = h * 31 + (u32b)begin;
+	h = h * 31 + (u32b)end;
+	h = h * 31 + (u32b)dlevel;
+	h = (h * 2 + (force_depth ? 1 : 0)) * 2 + (prep->no_bloodletter ? 1 : 0);
+	d = &mon_num_cache[(h * 2654435761U) >> 25 & (MON_NUM_CACHE_SIZE - 1)];
+
+	if (d->serial == mon_num_serial && d->prep.dun_type == prep->dun_type && d->prep.town_distance == prep->town_distance
+	    && d->hook_id == mon_num_prepped_hook_id && d->hook2_id == mon_num_prepped_hook2_id
+	    && d->prep.no_bloodletter == prep->no_bloodletter && d->begin == begin && d->end == end
+	    && d->dlevel == dlevel && d->force_depth == force_depth) {
+		mon_num_hits++;
+		return(d);
+	}
+	mon_num_misses++;
+
+	if (!d->entry) {
+		C_MAKE(d->entry, alloc_race_size, s16b);
+		C_MAKE(d->cum, alloc_race_size, s32b);
+	}
+	d->serial = mon_num_serial;
+	d->prep = *prep;
+	d->hook_id = mon_num_prepped_hook_id;
+	d->hook2_id = mon_num_prepped_hook2_id;
+	d->begin = begin;
+	d->end = end;
+	d->dlevel = dlevel;
+	d->force_depth = force_depth;
+
+	d->num = 0;
+	for (i = begin; i < end; i++) {
+		entry = &alloc_race_table[i];
+		if (!(p = mon_num_prob2(prep, entry))) continue;
+		if (!mon_num_depth_ok(entry, dlevel, force_depth)) continue;
+		total += p;
+		d->entry[d->num] = i;
+		d->cum[d->num] = total;
+		d->num++;
+	}
+	return(d);
+}
 
-	/* Local copies of the hooks for speed */
-	bool (*hook)(int r_idx) = get_mon_num_hook;
-	bool (*hook2)(int r_idx) = get_mon_num2_hook;
+/* Draw from a distribution, honouring the rejection array: Returns the position in it, or -1 if that doesn't work out */
+static int mon_num_sample(mon_num_dist *d) {
+	int tries, lo, hi, mid;
+	s32b value;
 
-	/* Scan the allocation table */
-	for (i = 0, n = alloc_race_size; i < n; i++) {
-		/* Get the entry */
-		alloc_entry *entry = &table[i];
+	for (tries = 0; tries < MON_NUM_REDRAWS; tries++) {
+		value = rand_int(d->cum[d->num - 1]);
 
-		/* Default probability for this pass */
-		entry->prob2 = 0;
+		/* Find the first entry whose cumulative probability exceeds the value */
+		lo = 0;
+		hi = d->num - 1;
+		while (lo < hi) {
+			mid = (lo + hi) / 2;
+			if (d->cum[mid] > value) hi = mid;
+			else lo = mid + 1;
+		}
 
-		/* Access the "r_idx" of the chosen monster */
-		r_idx = entry->index;
+		if (!mon_num_reject || !mon_num_reject[alloc_race_table[d->entry[lo]].index]) return(lo);
+		mon_num_redraws++;
+	}
+	return(-1);
+}
 
-		/* Check the monster rejection array provided */
-		if (reject_monsters && reject_monsters[entry->index]) continue;
+/* get_mon_num() for a deferred preparation: Returns the r_idx, 0 for no legal monster or -1 to fall back to the table */
+static int mon_num_pick(int begin, int end, int dlevel, bool force_depth) {
+	mon_num_dist *d = mon_num_lookup(begin, end, dlevel, force_depth);
+	int i, j, p;
 
-#ifdef BLOODLETTER_SUMMON_NERF
-		if (r_idx == RI_BLOODLETTER && !level_generation_time && summon_override_checks != SO_ALL) continue;
-#endif
+	/* No legal monsters */
+	if (!d->num) return(0);
 
-		/* Accept monsters which pass the restriction, if any */
-		if ((!hook || (*hook)(r_idx)) && (!hook2 || (*hook2)(r_idx))) {
-			/* Accept this monster */
-			entry->prob2 = entry->prob1;
+	/* Pick a monster */
+	if ((i = mon_num_sample(d)) == -1) return(-1);
+	i = d->entry[i];
 
-			/* Modify in favour of animals or against humanoids */
-			if (r_info[r_idx].flags3 & RF3_ANIMAL) {
-				entry->prob2 = (entry->prob2 * animals_perc) / 100;
-				if (entry->prob2 > 10000) entry->prob2 = 10000;
-			} else if (r_info[r_idx].flags8 & RF8_DUNGEON) { // ie not for WILD_ONLY flag monsters such as Woodsman
-				if (r_info[r_idx].d_char == 'p') // 'h' too? or leave them to 'humanoids' below
-					entry->prob2 = (entry->prob2 * people_perc) / 100;
-				else
-					entry->prob2 = (entry->prob2 * humanoids_perc) / 100;
-				if (!entry->prob2) entry->prob2 = 1;
-			}
-		}
+	/* Power boost */
+	p = rand_int(100);
 
-		/* Do not use this monster */
-		else {
-			/* Decline this monster */
-			continue;
-		}
+	/* Try for a "harder" monster once (50%) or twice (10%) */
+	if (p < 60) {
+		j = i;
+		if ((i = mon_num_sample(d)) == -1) return(-1);
+		i = d->entry[i];
+		/* Keep the "best" one */
+		if (abs(alloc_race_table[i].level) < abs(alloc_race_table[j].level)) i = j;
 	}
 
+	/* Try for a "harder" monster twice (10%) */
+	if (p < 10) {
+		j = i;
+		if ((i = mon_num_sample(d)) == -1) return(-1);
+		i = d->entry[i];
+		/* Keep the "best" one */
+		if (abs(alloc_race_table[i].level) < abs(alloc_race_table[j].level)) i = j;
+	}
+
+	return(alloc_race_table[i].index);
+}
+#endif
+
+/*
+ * Apply a "monster restriction function" to the "monster allocation table"
+ */
+errr get_mon_num_prep(int dun_type, char *reject_monsters) {
+	mon_num_prep_type prep;
+
+	mon_num_prep_params(&prep, dun_type, 0);
+#ifdef MON_NUM_CACHE
+	if (mon_num_defer(&prep, reject_monsters)) return(0);
+#endif
+	mon_num_prep_table(&prep, reject_monsters);
+
 	/* Success */
 	return(0);
 }
+/* Same as get_mon_num_prep() (for dungeon 0 aka default 'wilderness'/no settings modifications),
+   but additionally consider town distance to reduce amount of humanoids if farther away from town. */
+errr get_mon_num_prep_wild(int town_distance, char *reject_monsters) {
+	mon_num_prep_type prep;
+
+	if (!town_distance) town_distance = 1;
+
+	mon_num_prep_params(&prep, 0, town_distance); //dun_type is zero, no dungeon/default wilderness template
+#ifdef MON_NUM_CACHE
+	if (mon_num_defer(&prep, reject_monsters)) return(0);
+#endif
+	mon_num_prep_table(&prep, reject_monsters);
 
+	/* Success */
+	return(0);
+}
 
 /* TODO: do this job when creating allocation table, for efficiency */
 /* XXX: this function can act strange when used for non-generation checks */
@@ -1373,9 +1603,8 @@ bool mon_allowed_view(monster_race *r_ptr) {
 //s16b get_mon_num(int level)
 s16b get_mon_num(int level, int dlevel) {
 	long		begin, i, j, n, p; //, d1 = 0, d2 = 0;
-	long		r_idx, monster_level_min_int = 0;
+	long		monster_level_min_int = 0;
 	long		value, total;
-	monster_race	*r_ptr;
 	alloc_entry	*restrict table = alloc_race_table;
 	bool		force_depth = FALSE;
 
@@ -1440,6 +1669,19 @@ s16b get_mon_num(int level, int dlevel) {
 #ifdef TEST_SERVER
 //s_printf("depth %d:", dlevel);
 #endif
+#ifdef MON_NUM_CACHE
+	if (mon_num_lazy) {
+		i = mon_num_pick(begin, n, dlevel, force_depth);
+		if (i != -1) return(i);
+
+		/* Mostly rejected monsters in this band, prepare the table the old way after all */
+		mon_num_fallbacks++;
+		mon_num_prep_table(&mon_num_prepped, mon_num_reject);
+		mon_num_lazy = FALSE;
+		table = alloc_race_table;
+	}
+#endif
+
 	/* Process probabilities */
 	for (i = begin; i < n; i++) {
 		/* Get the entry */
@@ -1454,29 +1696,8 @@ s16b get_mon_num(int level, int dlevel) {
 		/* Skip monsters with zero probability */
 		if (!p) continue;
 
-		/* Access the "r_idx" of the chosen monster */
-		r_idx = entry->index;
-
-		/* Access the actual race */
-		r_ptr = &r_info[r_idx];
-
-		/* Depth Monsters never appear out of their depth */
-		/* level = base_depth + depth, be careful(esp.wilderness)
-		 * Appearently only used for Moldoux atm. */
-		if (r_ptr->flags9 & (RF9_ONLY_DEPTH)) {
-			if (entry->level != dlevel) continue;
-		} else {
-			/* Depth Monsters never appear out of depth */
-			/* This is currently only effectively used by Tik (other than dungeon bosses, which are already floor-locked anyway). */
-			if ((r_ptr->flags1 & RF1_FORCE_DEPTH) || force_depth) {
-				if (entry->level > dlevel) continue;
-			} else {
-				/* Prevent certain monsters from being generated too much OoD */
-				if ((r_ptr->flags7 & RF7_OOD_10) && (entry->level > dlevel + 10)) continue;
-				if ((r_ptr->flags7 & RF7_OOD_15) && (entry->level > dlevel + 15)) continue;
-				if ((r_ptr->flags7 & RF7_OOD_20) && (entry->level > dlevel + 20)) continue;
-			}
-		}
+		/* Monsters that are too far out of depth */
+		if (!mon_num_depth_ok(entry, dlevel, force_depth)) continue;
 
 		/* Accept */
 		entry->prob3 = p;
@@ -1485,7 +1706,7 @@ s16b get_mon_num(int level, int dlevel) {
 		total += p;
 
 #ifdef TEST_SERVER
-//s_printf(" %d(%d)", entry->level, r_idx);
+//s_printf(" %d(%d)", entry->level, entry->index);
 #endif
 	}
 #ifdef TEST_SERVER
@@ -1557,6 +1778,146 @@ s16b get_mon_num(int level, int dlevel) {
 	return(table[i].index);
 }
 
+#ifdef MON_NUM_CACHE
+/* Cache statistics for /cachemon */
+void mon_num_report(int Ind) {
+	u32b total = mon_num_hits + mon_num_misses;
+
+	msg_format(Ind, "Monster selection cache is %s\377w.", mon_num_cache_enabled ? "\377Genabled" : "\377rdisabled");
+	msg_format(Ind, "Hits: %u, misses: %u (hit rate %d%%), uncached preparations: %u, redraws: %u, fallbacks: %u.",
+	    mon_num_hits, mon_num_misses, total ? (int)(((u64b)mon_num_hits * 100) / total) : 0,
+	    mon_num_uncached, mon_num_redraws, mon_num_fallbacks);
+}
+
+/*
+ * Verify that the cached distribution for a level band is the same as the one
+ * the allocation table yields the old way: Compare them entry by entry, then
+ * draw 'samples' monsters from the cache and do a chi-square test of the
+ * observed frequencies against the table probabilities.
+ */
+void mon_num_check(int Ind, int level, int dlevel, int dun_type, int samples) {
+	bool (*old_hook)(int r_idx) = get_mon_num_hook, (*old_hook2)(int r_idx) = get_mon_num2_hook;
+	mon_num_prep_type prep;
+	mon_num_dist *d;
+	alloc_entry *table;
+	int i, k, p, lmin, begin, end, mismatches = 0, bins = 0, df, crit, *hits;
+	s32b total = 0;
+	double chi = 0.0, e, pool_e = 0.0, pool_o = 0.0;
+
+	if (dun_type < 0 || dun_type >= MAX_D_IDX || !alloc_race_table_dun[dun_type]) {
+		msg_format(Ind, "Invalid dungeon type %d.", dun_type);
+		return;
+	}
+	if (level < 0) level = 0;
+	if (level > 254) level = 254;
+	if (samples < 1) samples = 100000;
+
+	/* Same band as get_mon_num() uses for an automatic minimum level */
+	if (level >= 98) lmin = 69;
+	else lmin = (level * 2) / 3;
+	if (lmin < 1 && level) lmin = 1;
+	begin = alloc_race_index_level[lmin];
+	end = alloc_race_index_level[level + 1];
+
+	get_mon_num_hook = dungeon_aux;
+	get_mon_num2_hook = NULL;
+
+	/* The old way */
+	mon_num_prep_params(&prep, dun_type, 0);
+	mon_num_prep_table(&prep, NULL);
+	table = alloc_race_table;
+
+	/* The cached way */
+	mon_num_prepped = prep;
+	mon_num_prepped_hook_id = mon_num_hook_id(prep.hook);
+	mon_num_prepped_hook2_id = mon_num_hook_id(prep.hook2);
+	mon_num_reject = NULL;
+	d = mon_num_lookup(begin, end, dlevel, FALSE);
+
+	/* Both must agree on every entry */
+	for (i = begin, k = 0; i < end; i++) {
+		if (!(p = table[i].prob2) || !mon_num_depth_ok(&table[i], dlevel, FALSE)) continue;
+		total += p;
+		if (k >= d->num || d->entry[k] != i || d->cum[k] != total) mismatches++;
+		k++;
+	}
+	if (k != d->num) mismatches++;
+
+	msg_format(Ind, "Dungeon type %d, level %d (band %d..%d), dlevel %d: %d eligible monsters, %d mismatches.",
+	    dun_type, level, lmin, level, dlevel, d->num, mismatches);
+	if (!d->num || mismatches) {
+		get_mon_num_hook = old_hook;
+		get_mon_num2_hook = old_hook2;
+		mon_num_lazy = FALSE;
+		return;
+	}
+
+	C_MAKE(hits, d->num, int);
+	for (i = 0; i < samples; i++) hits[mon_num_sample(d)]++;
+
+	/* Pool rare monsters so every bin expects at least 5 hits */
+	for (k = 0; k < d->num; k++) {
+		e = ((double)samples * (d->cum[k] - (k ? d->cum[k - 1] : 0))) / d->cum[d->num - 1];
+		if (e < 5.0) {
+			pool_e += e;
+			pool_o += hits[k];
+			continue;
+		}
+		chi += (hits[k] - e) * (hits[k] - e) / e;
+		bins++;
+	}
+	if (pool_e > 0.0) {
+		chi += (pool_o - pool_e) * (pool_o - pool_e) / pool_e;
+		bins++;
+	}
+	C_KILL(hits, d->num, int);
+
+	/* Rough critical value, far out in the upper tail: df + 4 * sqrt(2 * df) */
+	df = bins > 1 ? bins - 1 : 1;
+	for (k = 1; k * k <= 2 * df; k++);
+	crit = df + 4 * (k - 1);
+	msg_format(Ind, "%d samples: chi-square %d with %d degrees of freedom, %s\377w (critical value ~%d).",
+	    samples, (int)chi, df, chi < crit ? "\377Gpassed" : "\377rFAILED", crit);
+
+	get_mon_num_hook = old_hook;
+	get_mon_num2_hook = old_hook2;
+	mon_num_lazy = FALSE;
+}
+
+/* Measure get_mon_num_prep() + get_mon_num() throughput as done by place_monster(), without and with the cache */
+void mon_num_bench(int Ind, int level, int count) {
+	bool (*old_hook)(int r_idx) = get_mon_num_hook, (*old_hook2)(int r_idx) = get_mon_num2_hook;
+	bool old_enabled = mon_num_cache_enabled;
+	struct timeval tv0, tv1;
+	long us[2];
+	int pass, i;
+
+	if (count < 1) count = 100000;
+
+	for (pass = 0; pass < 2; pass++) {
+		mon_num_cache_enabled = pass;
+		gettimeofday(&tv0, NULL);
+		for (i = 0; i < count; i++) {
+			get_mon_num_hook = dungeon_aux;
+			get_mon_num2_hook = monster_ground;
+			get_mon_num_prep(0, reject_uniques);
+			(void)get_mon_num(level, level);
+		}
+		gettimeofday(&tv1, NULL);
+		us[pass] = (tv1.tv_sec - tv0.tv_sec) * 1000000L + (tv1.tv_usec - tv0.tv_usec);
+		if (us[pass] < 1) us[pass] = 1;
+	}
+
+	mon_num_cache_enabled = old_enabled;
+	get_mon_num_hook = old_hook;
+	get_mon_num2_hook = old_hook2;
+	mon_num_lazy = FALSE;
+
+	msg_format(Ind, "%d picks at level %d: uncached %ld spawns/s, cached %ld spawns/s.",
+	    count, level, (long)(((u64b)count * 1000000) / us[0]), (long)(((u64b)count * 1000000) / us[1]));
+}
+#endif
+
 /* Return a completely random monster name and r_idx, for hallucinations.
    Only restriction is that the monster must be allowed to be normally generated in the game. */
 static cptr r_name_garbled_get(int *r_idx) {
@@ -2697,15 +3058,93 @@ void update_monsters(bool dist) {
 }
 
 
+#ifdef PLAYER_VIS_ROSTER
+ #define PVIS_HOSTILE	pvis_hostile(&hostile, i, Ind)
+#else
+ #define PVIS_HOSTILE	hostile
+#endif
+
+#ifdef PLAYER_VIS_ROSTER
+/*
+ * Player visibility only ever involves players on the same floor, and
+ * everything beyond the panel check only matters for viewers whose panel
+ * contains the target. So update_players() groups the players by floor
+ * once and each target is checked against its own floor's roster only;
+ * viewers whose panel doesn't contain the target and who don't currently
+ * see it are skipped right away, since there's nothing that could change.
+ */
+
+/* statistics for /pvis */
+static s32b pvis_turn = -1;
+static u32b pvis_pairs_now = 0, pvis_full_now = 0, pvis_old_now = 0;
+static u32b pvis_pairs_last = 0, pvis_full_last = 0, pvis_old_last = 0;
+static u64b pvis_pairs = 0, pvis_full = 0, pvis_old = 0, pvis_frames = 0;
+
+static void pvis_count(int pairs, int full, int old) {
+	if (pvis_turn != turn) {
+		if (pvis_turn != -1) {
+			pvis_pairs_last = pvis_pairs_now;
+			pvis_full_last = pvis_full_now;
+			pvis_old_last = pvis_old_now;
+			pvis_frames++;
+		}
+		pvis_turn = turn;
+		pvis_pairs_now = pvis_full_now = pvis_old_now = 0;
+	}
+	pvis_pairs_now += pairs;
+	pvis_full_now += full;
+	pvis_old_now += old;
+	pvis_pairs += pairs;
+	pvis_full += full;
+	pvis_old += old;
+}
+
+void player_vis_report(int Ind) {
+	msg_format(Ind, "Player visibility, last frame that had any: %u pairs looked at, %u fully checked (a scan over all players: %u).",
+	    pvis_pairs_last, pvis_full_last, pvis_old_last);
+	if (pvis_frames)
+		msg_format(Ind, "Average over %llu such frames: %llu looked at, %llu fully checked (a scan over all players: %llu).",
+		    (unsigned long long)pvis_frames, (unsigned long long)(pvis_pairs / pvis_frames),
+		    (unsigned long long)(pvis_full / pvis_frames), (unsigned long long)(pvis_old / pvis_frames));
+}
+
+void player_vis_reset(void) {
+	pvis_turn = -1;
+	pvis_pairs_now = pvis_full_now = pvis_old_now = 0;
+	pvis_pairs_last = pvis_full_last = pvis_old_last = 0;
+	pvis_pairs = pvis_full = pvis_old = pvis_frames = 0;
+}
+
+/* 'hostile' below is only needed when the target is on the viewer's panel or
+   for the disturb() on a change, so don't call check_hostile() for every pair */
+static bool pvis_hostile(int *hostile, int i, int Ind) {
+	if (*hostile < 0)
+		*hostile = (in_pvparena(&Players[i]->wpos) ||
+		    ((Players[i]->mode & MODE_PVP) && (Players[Ind]->mode & MODE_PVP)) ||
+		    check_hostile(i, Ind));
+	return(*hostile);
+}
+#endif
+
 /*
  * This function updates the visiblity flags for everyone who may see
  * this player.
  */
+#ifdef PLAYER_VIS_ROSTER
+/* Update Players[Ind]'s visibility to the 'num' players in 'roster',
+   which must all be connected and on the same floor as Players[Ind]. */
+static void update_player_roster(int Ind, int *roster, int num) {
+	player_type *p_ptr, *q_ptr = Players[Ind];
+
+	int i, k, n_pairs = 0, n_full = 0;
+	cave_type **zcave = getcave(&q_ptr->wpos);
+#else
 void update_player(int Ind) {
 	player_type *p_ptr, *q_ptr = Players[Ind];
 
 	int i;
 	cave_type **zcave;
+#endif
 
 	/* Current player location */
 	int py = q_ptr->py;
@@ -2724,9 +3163,35 @@ void update_player(int Ind) {
 	bool hard = FALSE;
 
 	/* Toned down invisibility for PvP */
+#ifdef PLAYER_VIS_ROSTER
+	int hostile;
+#else
 	bool hostile, c_hostile;
+#endif
+
+
+#ifdef PLAYER_VIS_ROSTER
+	/* Check for every other player on this floor */
+	for (k = 0; k < num; k++) {
+		i = roster[k];
+		p_ptr = Players[i];
+
+		/* Player can always see himself */
+		if (Ind == i) continue;
+		n_pairs++;
+
+		/* Off-panel and not seen before? Then nothing changes */
+		if (!panel_contains(py, px) && !p_ptr->play_vis[Ind] && !p_ptr->play_los[Ind]) continue;
+
+		/* Reset the flags */
+		flag = easy = hard = FALSE;
 
+		/* Compute distance */
+		dis = distance(py, px, p_ptr->py, p_ptr->px);
 
+		hostile = -1;
+		n_full++;
+#else
 	/* Check for every other player */
 	for (i = 1; i <= NumPlayers; i++) {
 		p_ptr = Players[i];
@@ -2751,6 +3216,7 @@ void update_player(int Ind) {
 		hostile = (in_pvparena(&p_ptr->wpos) ||
 		    ((p_ptr->mode & MODE_PVP) && (q_ptr->mode & MODE_PVP)) ||
 		    c_hostile);
+#endif
 
 		/* Process players on current panel */
 		if (panel_contains(py, px) && zcave) {
@@ -2852,6 +3318,9 @@ void update_player(int Ind) {
 			    (q_ptr->inventory[INVEN_OUTER].sval == SV_SHADOW_CLOAK)))
 			    && !(q_ptr->temp_misc_1 & 0x08)) { //snowed by a snowball? =p
 				/* in PvP, invis shouldn't help too greatly probably */
+#ifdef PLAYER_VIS_ROSTER
+				pvis_hostile(&hostile, i, Ind);
+#endif
 				if ((q_ptr->lev > p_ptr->lev && !hostile) ||
 				    q_ptr->invis_phase >= (hostile ? 85 : 20))
 					flag = FALSE;
@@ -2894,7 +3363,7 @@ void update_player(int Ind) {
 
 #ifdef HOSTILITY_ABORTS_RUNNING
 				/* Disturb on appearance */
-				if (p_ptr->disturb_move && hostile) {
+				if (p_ptr->disturb_move && PVIS_HOSTILE) {
 					/* Disturb */
 					disturb(i, 1, 0);
 				}
@@ -2914,7 +3383,7 @@ void update_player(int Ind) {
 
 #ifdef HOSTILITY_ABORTS_RUNNING
 				/* Disturb on disappearance */
-				if (p_ptr->disturb_move && hostile) {
+				if (p_ptr->disturb_move && PVIS_HOSTILE) {
 					/* Disturb */
 					disturb(i, 1, 0);
 				}
@@ -2931,7 +3400,7 @@ void update_player(int Ind) {
 
 #ifdef HOSTILITY_ABORTS_RUNNING
 				/* Disturb on appearance */
-				if ((p_ptr->disturb_near || p_ptr->disturb_see) && hostile) {
+				if ((p_ptr->disturb_near || p_ptr->disturb_see) && PVIS_HOSTILE) {
 					/* Disturb */
 					disturb(i, 1, 0);
 				}
@@ -2948,7 +3417,7 @@ void update_player(int Ind) {
 
 #ifdef HOSTILITY_ABORTS_RUNNING
 				/* Disturb on disappearance */
-				if ((p_ptr->disturb_near || p_ptr->disturb_see) && hostile) {
+				if ((p_ptr->disturb_near || p_ptr->disturb_see) && PVIS_HOSTILE) {
 					/* Disturb */
 					disturb(i, 1, 0);
 				}
@@ -2956,7 +3425,25 @@ void update_player(int Ind) {
 			}
 		}
 	}
+#ifdef PLAYER_VIS_ROSTER
+	pvis_count(n_pairs, n_full, NumPlayers - 1);
+#endif
 }
+#undef PVIS_HOSTILE
+
+#ifdef PLAYER_VIS_ROSTER
+void update_player(int Ind) {
+	int roster[MAX_PLAYERS], num = 0, i;
+	struct worldpos *wpos = &Players[Ind]->wpos;
+
+	for (i = 1; i <= NumPlayers; i++) {
+		if (Players[i]->conn == NOT_CONNECTED) continue;
+		if (!inarea(&Players[i]->wpos, wpos)) continue;
+		roster[num++] = i;
+	}
+	update_player_roster(Ind, roster, num);
+}
+#endif
 
 /* only takes care of updating player's invisibility flickering.
    Note: we assume (just for efficiency reasons) that we're only called
@@ -2985,6 +3472,31 @@ void update_player_flicker(int Ind) {
  */
 void update_players(void) {
 	int i;
+#ifdef PLAYER_VIS_ROSTER
+	int roster[MAX_PLAYERS], num, j, k;
+	bool done[MAX_PLAYERS + 1];
+
+	for (i = 1; i <= NumPlayers; i++) done[i] = FALSE;
+
+	/* Update the players floor by floor */
+	for (i = 1; i <= NumPlayers; i++) {
+		player_type *p_ptr = Players[i];
+
+		/* Skip disconnected players */
+		if (done[i] || p_ptr->conn == NOT_CONNECTED) continue;
+
+		/* Everyone else on this floor */
+		for (num = 0, j = i; j <= NumPlayers; j++) {
+			if (done[j] || Players[j]->conn == NOT_CONNECTED) continue;
+			if (!inarea(&Players[j]->wpos, &p_ptr->wpos)) continue;
+			done[j] = TRUE;
+			roster[num++] = j;
+		}
+
+		/* Update the players */
+		for (k = 0; k < num; k++) update_player_roster(roster[k], roster, num);
+	}
+#else
 
 	/* Update each player */
 	for (i = 1; i <= NumPlayers; i++) {
@@ -2996,6 +3508,7 @@ void update_players(void) {
 		/* Update the player */
 		update_player(i);
 	}
+#endif
 }
 
 
@@ -6002,6 +6515,9 @@ void monster_carry(monster_type *m_ptr, int m_idx, object_type *q_ptr) {
 		o_ptr->iy = 0;
 
 		m_ptr->hold_o_idx = o_idx;
+#ifdef TIMED_OBJECT_LIST
+		object_timed_check(o_idx);
+#endif
 	} else {
 		/* Hack -- Preserve artifacts */
 		if (true_artifact_p(q_ptr)) handle_art_d(q_ptr->name1);
@@ -55,6 +55,22 @@ typedef struct {
 					 Optional addition: GRAPHICS_BG_MASK - Client has use_graphics, and additionally wants dual-grid info
 									       that includes the background (f_info.txt) info (to merge both foreground and background visually). */
 	char graphic_tiles[512], fname[512];
+
+#ifdef PACKET_CAPTURE
+	FILE		*capture;	/* see /capture */
+	u64b		capture_last;	/* usec timestamp of the last record */
+#endif
+
+#ifdef CMD_QUEUE
+	int		cmdq_wait_len;	/* q.len when the last pass stalled on an energy command, 0 if it didn't */
+	s32b		cmdq_wait_turn;	/* turn of that stall */
+	s32b		cmdq_rate_turn;	/* start of the current intake rate window */
+	int		cmdq_rate_bytes;	/* bytes read within that window */
+	bool		cmdq_throttled;	/* socket is out of the input mask until the window ends */
+	int		cmdq_peak;	/* deepest queue seen, in bytes */
+	u32b		cmdq_in, cmdq_copied;	/* bytes read, bytes that had to be copied into the queue */
+	u32b		cmdq_passes, cmdq_skipped, cmdq_throttles;
+#endif
 } connection_t;
 
 #endif
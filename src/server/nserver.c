@@ -1413,6 +1413,118 @@ static int Enter_player(char *real, char *nick, char *addr, char *host,
 }
 
 
+#ifdef PACKET_CAPTURE
+/*
+ * Packet capture (see CAPTURE_MAGIC in pack.h): an admin can have the traffic
+ * of a connection written to lib/data/capture-<account>-<date>.cap, to find
+ * out what makes up a bandwidth spike or to replay the client's input later.
+ */
+bool capture_new_connections = FALSE;	/* Capture every new connection */
+
+static void capture_u32(byte *p, u32b v) {
+	p[0] = v & 0xFF;
+	p[1] = (v >> 8) & 0xFF;
+	p[2] = (v >> 16) & 0xFF;
+	p[3] = (v >> 24) & 0xFF;
+}
+
+static void capture_record(connection_t *connp, byte kind, cptr data, int len) {
+	struct timeval tv;
+	u64b now;
+	byte head[9];
+
+	if (!connp->capture || len < 0) return;
+
+	/* Nothing from before the character entered the game, the login carries the account password */
+	if (kind != CAP_HEAD && connp->state != CONN_PLAYING) return;
+
+	gettimeofday(&tv, NULL);
+	now = (u64b)tv.tv_sec * 1000000 + tv.tv_usec;
+	head[0] = kind;
+	capture_u32(head + 1, now - connp->capture_last > 0xFFFFFFFFUL ? 0xFFFFFFFFUL : (u32b)(now - connp->capture_last));
+	capture_u32(head + 5, (u32b)len);
+	connp->capture_last = now;
+
+	if (fwrite(head, 9, 1, connp->capture) != 1 || (len && fwrite(data, len, 1, connp->capture) != 1)) {
+		s_printf("CAPTURE: Write error, stopping capture of %s.\n", connp->nick ? connp->nick : "?");
+		fclose(connp->capture);
+		connp->capture = NULL;
+	}
+}
+
+/*
+ * Record a command processed from connp->r: type, bytes it took and the Receive_*() result,
+ * and the bytes themselves once it didn't get deferred, except for password changes.
+ */
+static void capture_cmd(connection_t *connp, int type, cptr data, int len, int result) {
+	byte buf[6];
+
+	if (result != 0 && type != PKT_CHANGE_PASSWORD) capture_record(connp, CAP_IN, data, len);
+
+	buf[0] = type;
+	capture_u32(buf + 1, (u32b)len);
+	buf[5] = (result == 0) ? 0 : 1;
+	capture_record(connp, CAP_CMD, (cptr)buf, 6);
+}
+
+bool capture_start(int ind) {
+	connection_t *connp = Conn[ind];
+	char buf[MAX_PATH_LENGTH], name[NAME_LEN], stamp[20], *c;
+	time_t now = time(NULL);
+	struct timeval tv;
+
+	if (!connp || connp->capture) return(FALSE);
+
+	/* Keep the account name file-system friendly */
+	strncpy(name, connp->nick ? connp->nick : "unknown", NAME_LEN - 1);
+	name[NAME_LEN - 1] = 0;
+	for (c = name; *c; c++) if (!isalnum((unsigned char)*c)) *c = '_';
+	strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", localtime(&now));
+	path_build(buf, MAX_PATH_LENGTH, ANGBAND_DIR_DATA, format("capture-%s-%s-%d.cap", name, stamp, ind));
+
+	if (!(connp->capture = fopen(buf, "wb"))) {
+		s_printf("CAPTURE: Cannot open %s.\n", buf);
+		return(FALSE);
+	}
+	s_printf("CAPTURE: Started for %s into %s.\n", connp->nick ? connp->nick : "?", buf);
+
+	gettimeofday(&tv, NULL);
+	connp->capture_last = (u64b)tv.tv_sec * 1000000 + tv.tv_usec;
+	fwrite(CAPTURE_MAGIC, 8, 1, connp->capture);
+	strnfmt(buf, sizeof(buf), "%s %s %d.%d.%d.%d.%d.%d", connp->nick ? connp->nick : "-", connp->host ? connp->host : "-",
+	    connp->version.major, connp->version.minor, connp->version.patch, connp->version.extra, connp->version.branch, connp->version.build);
+	capture_record(connp, CAP_HEAD, buf, strlen(buf));
+
+	/* Replaying starts here then */
+	if (connp->state == CONN_PLAYING) capture_record(connp, CAP_PLAY, connp->c_name ? connp->c_name : "", connp->c_name ? strlen(connp->c_name) : 0);
+	return(TRUE);
+}
+
+void capture_stop(int ind) {
+	connection_t *connp = Conn[ind];
+
+	if (!connp || !connp->capture) return;
+	s_printf("CAPTURE: Stopped for %s (%ld bytes).\n", connp->nick ? connp->nick : "?", ftell(connp->capture));
+	fclose(connp->capture);
+	connp->capture = NULL;
+}
+
+/* List the connections being captured */
+void capture_report(int Ind) {
+	connection_t *connp;
+	int i, n = 0;
+
+	msg_format(Ind, "New connections are %scaptured.", capture_new_connections ? "" : "not ");
+	for (i = 0; i < max_connections; i++) {
+		connp = Conn[i];
+		if (!connp || !connp->capture) continue;
+		msg_format(Ind, "  %s (%s): %ld bytes", connp->nick ? connp->nick : "?", connp->c_name ? connp->c_name : "-", ftell(connp->capture));
+		n++;
+	}
+	if (!n) msg_print(Ind, "No connection is being captured.");
+}
+#endif
+
 static void Conn_set_state(connection_t *connp, int state, int drain_state) {
 	static int num_conn_busy;
 	static int num_conn_playing;
@@ -1429,6 +1541,9 @@ static void Conn_set_state(connection_t *connp, int state, int drain_state) {
 	if (connp->state == CONN_PLAYING) {
 		num_conn_playing++;
 		connp->timeout = IDLE_TIMEOUT;
+#ifdef PACKET_CAPTURE
+		capture_record(connp, CAP_PLAY, connp->c_name ? connp->c_name : "", connp->c_name ? strlen(connp->c_name) : 0);
+#endif
 	}
 	else if (connp->state == CONN_READY) {
 		num_conn_playing++;
@@ -1619,6 +1734,7 @@ static void Delete_player(int Ind) {
 				time_t now = time(&now);
 
 				l_ptr->lastused = now;
+				floor_lru_update(&p_ptr->wpos, TRUE);
 			}
 		}
 	}
@@ -1826,6 +1942,9 @@ bool Destroy_connection(int ind, char *reason_orig) {
 	if (connp->host != NULL) free(connp->host);
 	if (connp->c_name != NULL) free(connp->c_name);
 	if (connp->pass != NULL) free(connp->pass);
+#ifdef PACKET_CAPTURE
+	capture_stop(ind);
+#endif
 	Sockbuf_cleanup(&connp->w);
 	Sockbuf_cleanup(&connp->r);
 	Sockbuf_cleanup(&connp->c);
@@ -2012,6 +2131,9 @@ bool Relogin_connection(int ind, char *relogin_host, char *relogin_accname, char
 	if (connp->host != NULL) free(connp->host);
 	if (connp->c_name != NULL) free(connp->c_name);
 	if (connp->pass != NULL) free(connp->pass);
+#ifdef PACKET_CAPTURE
+	capture_stop(ind);
+#endif
 	Sockbuf_cleanup(&connp->w);
 	Sockbuf_cleanup(&connp->r);
 	Sockbuf_cleanup(&connp->c);
@@ -2167,6 +2289,10 @@ int Setup_connection(char *real, char *nick, char *addr, char *host, version_typ
 	// Install the game input handler
 	install_input(Handle_input, sock, free_conn_index);
 
+#ifdef PACKET_CAPTURE
+	if (capture_new_connections) capture_start(free_conn_index);
+#endif
+
 	return(my_port);
 }
 
@@ -4147,6 +4273,170 @@ int is_inactive(int Ind) {
 		return(Conn[Players[Ind]->conn]->inactive_ping / 2);
 }
 
+#ifdef CMD_QUEUE
+/*
+ * Command intake: connp->r and connp->q have the same size, so whenever the
+ * queue is empty the buffer that was just read (or the queue, when it's the
+ * game tick's turn) is handed over by swapping the two buffers instead of
+ * copying it.  A pass that stalled on a command the player couldn't afford
+ * leaves only such commands queued; until new data arrives or the player has
+ * the energy for the first of them, running the queue again is pointless.
+ * If enabled in tomenet.cfg, connections that send more than CMDQ_RATE_LIMIT
+ * bytes in a second aren't read from for the rest of that second, and a queue
+ * deeper than CMDQ_MAX_DEPTH gets them kicked. - see /cmdq
+ */
+
+static u32b cmdq_in = 0, cmdq_swapped = 0, cmdq_copied = 0, cmdq_passes = 0, cmdq_skipped = 0, cmdq_throttles = 0, cmdq_floods = 0;
+
+static void cmdq_swap(sockbuf_t *a, sockbuf_t *b) {
+	char *buf = a->buf;
+	int len = a->len, ofs = a->ptr - a->buf;
+
+	a->buf = b->buf;
+	a->len = b->len;
+	a->ptr = a->buf + (b->ptr - b->buf);
+	b->buf = buf;
+	b->len = len;
+	b->ptr = buf + ofs;
+}
+
+/* Move what Handle_input() just read into connp->r over to the command queue */
+static bool cmdq_intake(int ind) {
+	connection_t *connp = Conn[ind];
+	int len = connp->r.len;
+
+	if (!connp->q.len && connp->r.ptr == connp->r.buf && connp->r.size == connp->q.size) {
+		cmdq_swap(&connp->r, &connp->q);
+		cmdq_swapped++;
+	} else {
+		if (Sockbuf_write(&connp->q, connp->r.ptr, connp->r.len) != connp->r.len) {
+			errno = 0;
+			Destroy_connection(ind, "Can't copy queued data to buffer");
+			return(FALSE);
+		}
+		connp->cmdq_copied += len;
+		cmdq_copied += len;
+	}
+	connp->cmdq_in += len;
+	cmdq_in += len;
+	if (connp->q.len > connp->cmdq_peak) connp->cmdq_peak = connp->q.len;
+
+	if (cfg.cmdq_max_depth && connp->q.len > cfg.cmdq_max_depth) {
+		s_printf("CMDQ: %s flooded the command queue (%d bytes).\n", connp->nick ? connp->nick : "?", connp->q.len);
+		cmdq_floods++;
+		Destroy_connection(ind, "Command queue flood");
+		return(FALSE);
+	}
+
+	if (turn - connp->cmdq_rate_turn >= cfg.fps) {
+		connp->cmdq_rate_turn = turn;
+		connp->cmdq_rate_bytes = 0;
+	}
+	connp->cmdq_rate_bytes += len;
+	if (cfg.cmdq_rate_limit && connp->cmdq_rate_bytes > cfg.cmdq_rate_limit && !connp->cmdq_throttled) {
+		remove_input(connp->r.sock);
+		connp->cmdq_throttled = TRUE;
+		connp->cmdq_throttles++;
+		cmdq_throttles++;
+	}
+	return(TRUE);
+}
+
+/* Read from a throttled connection again once its rate window is over, called each turn by Net_input() */
+static void cmdq_unthrottle(int ind) {
+	connection_t *connp = Conn[ind];
+
+	if (!connp->cmdq_throttled || turn - connp->cmdq_rate_turn < cfg.fps) return;
+	install_input(Handle_input, connp->r.sock, ind);
+	connp->cmdq_throttled = FALSE;
+}
+
+/* Is the queue still blocked by the command its last pass stalled on? */
+static bool cmdq_blocked(connection_t *connp, player_type *p_ptr) {
+	int energy = p_ptr->energy;
+
+	if (!connp->cmdq_wait_len) return(FALSE);
+
+	/* These may be added in by the pass or by Receive_walk() */
+ #ifdef NEW_AUTORET_2_ENERGY
+	energy += p_ptr->reserve_energy;
+ #endif
+ #ifdef RESTRICT_DOUBLE_ENERGY_1
+	energy += p_ptr->double_energy;
+ #endif
+
+	/* Anything new, a long wait or energy that might do: run it */
+	if (connp->q.len != connp->cmdq_wait_len || turn - connp->cmdq_wait_turn >= cfg.fps
+	    || (p_ptr->esp_link_type && p_ptr->esp_link) /* the commands use someone else's energy */
+	    || energy >= level_speed(&p_ptr->wpos)) {
+		connp->cmdq_wait_len = 0;
+		return(FALSE);
+	}
+	return(TRUE);
+}
+
+/* Remember a stalled pass if the queue starts with a command that needs a full turn of energy */
+static void cmdq_stall(connection_t *connp) {
+	connp->cmdq_wait_len = 0;
+	if (!connp->q.len) return;
+
+	switch (connp->q.buf[0] & 0xFF) {
+	case PKT_WALK:
+	case PKT_TUNNEL:
+	case PKT_AIM_WAND:
+	case PKT_OPEN:
+	case PKT_CLOSE:
+	case PKT_QUAFF:
+	case PKT_READ:
+	case PKT_USE:
+	case PKT_THROW:
+	case PKT_ZAP:
+	case PKT_ZAP_DIR:
+	case PKT_ACTIVATE:
+	case PKT_ACTIVATE_DIR:
+	case PKT_BASH:
+	case PKT_DISARM:
+	case PKT_EAT:
+	case PKT_FILL:
+	case PKT_GO_UP:
+	case PKT_GO_DOWN:
+	case PKT_STEAL:
+	case PKT_SPIKE:
+	case PKT_SIP:
+		connp->cmdq_wait_len = connp->q.len;
+		connp->cmdq_wait_turn = turn;
+	}
+}
+
+/* Show intake statistics and the queues of the playing connections */
+void cmdq_report(int Ind) {
+	connection_t *connp;
+	int i;
+
+	msg_format(Ind, "Command queue: %u bytes in, %u reads handed over, %u bytes copied.", cmdq_in, cmdq_swapped, cmdq_copied);
+	msg_format(Ind, "  %u passes, %u skipped while stalled, %u throttles, %u kicked for flooding.", cmdq_passes, cmdq_skipped, cmdq_throttles, cmdq_floods);
+	for (i = 0; i < max_connections; i++) {
+		connp = Conn[i];
+		if (!connp || connp->state != CONN_PLAYING) continue;
+		msg_format(Ind, "  %s: queued %d (peak %d), in %u, copied %u, passes %u, skipped %u, throttled %u%s",
+		    connp->c_name ? connp->c_name : "?", connp->q.len, connp->cmdq_peak, connp->cmdq_in, connp->cmdq_copied,
+		    connp->cmdq_passes, connp->cmdq_skipped, connp->cmdq_throttles, connp->cmdq_wait_len ? " (stalled)" : "");
+	}
+}
+
+void cmdq_reset(void) {
+	connection_t *connp;
+	int i;
+
+	cmdq_in = cmdq_swapped = cmdq_copied = cmdq_passes = cmdq_skipped = cmdq_throttles = cmdq_floods = 0;
+	for (i = 0; i < max_connections; i++) {
+		if (!(connp = Conn[i])) continue;
+		connp->cmdq_peak = 0;
+		connp->cmdq_in = connp->cmdq_copied = connp->cmdq_passes = connp->cmdq_skipped = connp->cmdq_throttles = 0;
+	}
+}
+#endif
+
 /* Actually execute commands from the client command queue */
 void process_pending_commands(int ind) {
 	connection_t *connp = Conn[ind];
@@ -4157,11 +4447,31 @@ void process_pending_commands(int ind) {
 	s16b total_energy;
 	bool eligible;
 #endif
+#ifdef CMD_QUEUE
+	bool stalled = FALSE;
+
+	/* Nothing new and still can't afford what's queued? */
+	if (connp->id != -1 && cmdq_blocked(connp, Players[GetInd[connp->id]])) {
+		connp->cmdq_skipped++;
+		cmdq_skipped++;
+		return;
+	}
+#endif
 
 	// Hack -- take any pending commands from the command que connp->q
 	// and move them to connp->r, where the Receive functions get their
 	// data from.
 	Sockbuf_clear(&connp->r);
+#ifdef CMD_QUEUE
+	if (connp->q.len > 0) {
+		connp->cmdq_passes++;
+		cmdq_passes++;
+	}
+	if (connp->q.len > 0 && connp->q.ptr == connp->q.buf && connp->r.size == connp->q.size) {
+		cmdq_swap(&connp->r, &connp->q);
+		Sockbuf_clear(&connp->q);
+	} else
+#endif
 	if (connp->q.len > 0) {
 		if (Sockbuf_write(&connp->r, connp->q.ptr, connp->q.len) != connp->q.len) {
 			errno = 0;
@@ -4291,6 +4601,10 @@ void process_pending_commands(int ind) {
 
 		connp->r.state &= ~SOCKBUF_LOCK;
 
+#ifdef PACKET_CAPTURE
+		if (connp->capture && connp->r.ptr > foo) capture_cmd(connp, type, foo, connp->r.ptr - foo, result);
+#endif
+
 #ifdef NEW_AUTORET_2_ENERGY
 		if (p_ptr != NULL && p_ptr->conn != NOT_CONNECTED && eligible) {
  #ifdef NEW_AUTORET_2_DEEPCHECK
@@ -4397,6 +4711,9 @@ void process_pending_commands(int ind) {
 				old_energy = p_ptr->energy;
 				p_ptr->energy = 0;
 			}
+#ifdef CMD_QUEUE
+			stalled = TRUE;
+#endif
 		}
 
 		/* Queue all remaining packets now */
@@ -4421,6 +4738,9 @@ void process_pending_commands(int ind) {
 	 * a BAD thing to do if we ever went multithreaded.
 	 */
 	if (NumPlayers == num_players_start && !p_ptr->energy) p_ptr->energy = old_energy;
+#ifdef CMD_QUEUE
+	if (NumPlayers == num_players_start && stalled) cmdq_stall(connp);
+#endif
 }
 
 /*
@@ -4514,11 +4834,15 @@ void Handle_input(int fd, int arg) {
 	}
 
 	// Add this new data to the command queue
+#ifdef CMD_QUEUE
+	if (!cmdq_intake(ind)) return;
+#else
 	if (Sockbuf_write(&connp->q, connp->r.ptr, connp->r.len) != connp->r.len) {
 		errno = 0;
 		Destroy_connection(ind, "Can't copy queued data to buffer");
 		return;
 	}
+#endif
 
 	// Execute any new commands immediately if possible
 	// Don't process commands when marked for death - mikaelh
@@ -4578,7 +4902,12 @@ int Net_input(void) {
 		connp = Conn[i];
 
 		if (!connp || connp->state == CONN_FREE) continue;
-		if (connp->timeout && (connp->start + connp->timeout * cfg.fps < turn)) {
+		if (connp->timeout && (connp->start + connp->timeout * cfg.fps < turn)
+#ifdef SERVER_BENCHMARK
+		    /* Turns fly by in benchmark mode, don't time out clients that act in real time */
+		    && !bench_turns
+#endif
+		    ) {
 			if (connp->state & (CONN_PLAYING | CONN_READY)) {
 /*				sprintf(msg, "%s mysteriously disappeared!",
 					connp->nick);
@@ -4592,6 +4921,10 @@ int Net_input(void) {
 if (!(turn % (cfg.fps / 2))) s_printf("connp %d: start %ld\n", i, connp->start);
 #endif
 
+#ifdef CMD_QUEUE
+		cmdq_unthrottle(i);
+#endif
+
 		// Make sure that the player we are looking at is not already in the
 		// game.  If he is already in the game then we will send him data
 		// in the function Net_input.
@@ -6128,6 +6461,9 @@ int Send_reliable(int ind) {
 	 */
 	if (connp->w.sock == -1) return(0);
 
+#ifdef PACKET_CAPTURE
+	if (connp->capture && connp->c.len) capture_record(connp, CAP_OUT, connp->c.buf, connp->c.len);
+#endif
 	if (Sockbuf_write(&connp->w, connp->c.buf, connp->c.len) != connp->c.len) {
 		plog("Cannot write reliable data");
 		Destroy_connection(ind, "write error (5)");
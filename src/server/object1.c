@@ -15,6 +15,9 @@
 
 #include "angband.h"
 
+/* For gettimeofday() */
+#include <sys/time.h>
+
 #ifdef BACKTRACE_TV_PSEUDO_OBJ
 /* Track TV_PSEUDO_OBJ in object_desc() */
  #include <execinfo.h>
@@ -965,6 +968,10 @@ void flavor_init(void) {
 		/* Check for "easily known" */
 		k_ptr->easy_know = object_easy_know(i);
 	}
+
+#ifdef OBJECT_DESC_CACHE
+	object_desc_cache_flush();
+#endif
 }
 /* Hack certain flavours for objects that have immutable colour. - C. Blue
    This means INSTA_ARTs in the ring and amulet department,
@@ -2108,6 +2115,151 @@ static char *object_desc_lnum(char *t, uint n) {
 #endif
 
 
+static void object_desc_aux(int Ind, char *buf, object_type *o_ptr, int pref, int mode);
+
+#ifdef OBJECT_DESC_CACHE
+/*
+ * Cache of object_desc() results.
+ *
+ * The key is the whole object, so anything that changes it (identifying,
+ * inscribing, charges, stack size...) yields a new key, plus the bits of the
+ * player's knowledge object_desc() looks at. Everything else it reads is global
+ * and changes only rarely, those places call object_desc_cache_flush().
+ * Two-way set-associative, least recently used entry gets replaced.
+ */
+#define OBJECT_DESC_CACHE_SIZE	4096	/* must be a power of 2 */
+
+typedef struct object_desc_key object_desc_key;
+struct object_desc_key {
+	object_type obj;
+	s32b id;		/* player id, 0 for Ind 0 */
+	int pref, mode;
+	byte know;		/* aware, tried, trap known, short names, client version */
+};
+
+typedef struct object_desc_entry object_desc_entry;
+struct object_desc_entry {
+	object_desc_key key;
+	u32b hash, serial, used;
+	char name[ONAME_LEN];
+};
+
+static object_desc_entry *object_desc_cache = NULL;
+static u32b object_desc_serial = 1, object_desc_used = 0;
+bool object_desc_cache_enabled = TRUE;
+bool object_desc_check = FALSE;	/* Debug: verify every cache hit against a fresh description */
+u32b object_desc_hits = 0, object_desc_misses = 0, object_desc_mismatches = 0;
+
+/* Forget all cached descriptions, eg after flavours, the info arrays or a player name changed */
+void object_desc_cache_flush(void) {
+	if (!++object_desc_serial) object_desc_serial = 1;
+}
+
+/* Only hashes the fields that usually tell items apart, the whole key gets compared anyway */
+static u32b object_desc_hash(object_desc_key *key) {
+	object_type *o_ptr = &key->obj;
+	u32b h;
+
+	h = o_ptr->k_idx;
+	h = h * 0x9E3779B1U + o_ptr->number;
+	h = h * 0x9E3779B1U + (u32b)o_ptr->pval;
+	h = h * 0x9E3779B1U + o_ptr->name1 + (o_ptr->name2 << 16);
+	h = h * 0x9E3779B1U + o_ptr->name2b;
+	h = h * 0x9E3779B1U + o_ptr->name3;
+	h = h * 0x9E3779B1U + (u16b)o_ptr->to_h + ((u32b)(u16b)o_ptr->to_d << 16);
+	h = h * 0x9E3779B1U + (u16b)o_ptr->to_a;
+	h = h * 0x9E3779B1U + o_ptr->ident;
+	h = h * 0x9E3779B1U + o_ptr->note;
+	h = h * 0x9E3779B1U + (u32b)o_ptr->owner;
+	h = h * 0x9E3779B1U + (u32b)o_ptr->timeout;
+	h = h * 0x9E3779B1U + (u32b)key->id;
+	h = h * 0x9E3779B1U + (key->mode << 8) + (key->pref << 7) + key->know;
+
+	/* final mix, the set index is taken from the low bits */
+	h ^= h >> 16;
+	h *= 0x85EBCA6BU;
+	h ^= h >> 13;
+	return(h);
+}
+
+static void object_desc_make_key(int Ind, object_type *o_ptr, int pref, int mode, object_desc_key *key) {
+	player_type *p_ptr;
+
+	WIPE(key, object_desc_key);
+	memcpy(&key->obj, o_ptr, sizeof(object_type));
+	key->pref = pref;
+	key->mode = mode;
+	if (!Ind) return;
+
+	p_ptr = Players[Ind];
+	key->id = p_ptr->id;
+	if (object_aware_p(Ind, o_ptr)) key->know |= 0x01;
+	if (object_tried_p(Ind, o_ptr)) key->know |= 0x02;
+	if (o_ptr->tval == TV_CHEST && o_ptr->pval > 0 && p_ptr->trap_ident[o_ptr->pval]) key->know |= 0x04;
+	if (p_ptr->short_item_names) key->know |= 0x08;
+	if (is_newer_than(&p_ptr->version, 4, 6, 1, 2, 0, 0)) key->know |= 0x10;
+}
+#endif
+
+/* Memoizing front-end of object_desc_aux(), see there for the parameters */
+void object_desc(int Ind, char *buf, object_type *o_ptr, int pref, int mode) {
+#ifdef OBJECT_DESC_CACHE
+	object_desc_key key;
+	object_desc_entry *e;
+	u32b h;
+	int i, slot;
+	char fresh[ONAME_LEN];
+
+	/* Keep the TV_PSEUDO_OBJ diagnostics intact */
+	if (!object_desc_cache_enabled || o_ptr->tval == TV_PSEUDO_OBJ) {
+		object_desc_aux(Ind, buf, o_ptr, pref, mode);
+		return;
+	}
+	if (!object_desc_cache) C_MAKE(object_desc_cache, OBJECT_DESC_CACHE_SIZE, object_desc_entry);
+
+	object_desc_make_key(Ind, o_ptr, pref, mode, &key);
+	h = object_desc_hash(&key);
+	slot = h & (OBJECT_DESC_CACHE_SIZE - 2);
+
+	for (i = slot; i < slot + 2; i++) {
+		e = &object_desc_cache[i];
+		if (e->serial != object_desc_serial || e->hash != h || memcmp(&e->key, &key, sizeof(object_desc_key))) continue;
+
+		object_desc_hits++;
+		e->used = ++object_desc_used;
+		strcpy(buf, e->name);
+		if (object_desc_check) {
+			object_desc_aux(Ind, fresh, o_ptr, pref, mode);
+			if (strcmp(fresh, e->name)) {
+				object_desc_mismatches++;
+				s_printf("OBJECT_DESC_MISMATCH: '%s' / '%s' (mode %d)\n", e->name, fresh, mode);
+				strcpy(e->name, fresh);
+				strcpy(buf, fresh);
+			}
+		}
+		return;
+	}
+
+	object_desc_misses++;
+	object_desc_aux(Ind, buf, o_ptr, pref, mode);
+
+	/* Replace the stale or least recently used entry of the set */
+	e = &object_desc_cache[slot];
+	if (object_desc_cache[slot + 1].serial != object_desc_serial ||
+	    (e->serial == object_desc_serial && object_desc_cache[slot + 1].used < e->used))
+		e = &object_desc_cache[slot + 1];
+	e->key = key;
+	e->hash = h;
+	e->serial = object_desc_serial;
+	e->used = ++object_desc_used;
+	strncpy(e->name, buf, ONAME_LEN - 1);
+	e->name[ONAME_LEN - 1] = 0;
+#else
+	object_desc_aux(Ind, buf, o_ptr, pref, mode);
+#endif
+}
+
+
 /*
  * Creates a description of the item "o_ptr", and stores it in "out_val".
  *
@@ -2174,7 +2326,7 @@ static char *object_desc_lnum(char *t, uint n) {
  * If the strings created with mode 0-3 are too long, this function is called
  * again with 8 added to 'mode' and attempt to 'abbreviate' the strings. -Jir-
  */
-void object_desc(int Ind, char *buf, object_type *o_ptr, int pref, int mode) {
+static void object_desc_aux(int Ind, char *buf, object_type *o_ptr, int pref, int mode) {
 	player_type     *p_ptr = NULL;
 	cptr		basenm, modstr;
 	int		power, indexx;
@@ -3578,6 +3730,51 @@ void object_desc_store(int Ind, char *buf, object_type *o_ptr, int pref, int mod
 	if (!hack_known) o_ptr->ident &= ~ID_KNOWN;
 }
 
+#ifdef OBJECT_DESC_CACHE
+void object_desc_report(int Ind) {
+	u32b total = object_desc_hits + object_desc_misses;
+
+	msg_format(Ind, "Object description cache %s%s: %u hits, %u misses (%u%%), %u mismatches.",
+	    object_desc_cache_enabled ? "on" : "off", object_desc_check ? " (checking)" : "",
+	    object_desc_hits, object_desc_misses, total ? (object_desc_hits * 100) / total : 0,
+	    object_desc_mismatches);
+}
+
+/* Describe the admin's inventory and equipment 'count' times, uncached vs cached */
+void object_desc_bench(int Ind, int count) {
+	player_type *p_ptr = Players[Ind];
+	struct timeval tv0, tv1;
+	bool old_enabled = object_desc_cache_enabled;
+	u32b hits = object_desc_hits, misses = object_desc_misses;
+	long t[2];
+	int n, i, c, items = 0;
+	char buf[ONAME_LEN];
+
+	for (i = 0; i < INVEN_TOTAL; i++)
+		if (p_ptr->inventory[i].k_idx) items++;
+	if (!items) {
+		msg_print(Ind, "You have no items.");
+		return;
+	}
+
+	for (c = 0; c < 2; c++) {
+		object_desc_cache_enabled = c;
+		gettimeofday(&tv0, NULL);
+		for (n = 0; n < count; n++)
+			for (i = 0; i < INVEN_TOTAL; i++)
+				if (p_ptr->inventory[i].k_idx) object_desc(Ind, buf, &p_ptr->inventory[i], TRUE, 3);
+		gettimeofday(&tv1, NULL);
+		t[c] = (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+	}
+	object_desc_cache_enabled = old_enabled;
+	object_desc_hits = hits;
+	object_desc_misses = misses;
+
+	msg_format(Ind, "%d x %d items: uncached %ld us (%ld ns/item), cached %ld us (%ld ns/item).",
+	    count, items, t[0], (t[0] * 1000) / (count * items), t[1], (t[1] * 1000) / (count * items));
+}
+#endif
+
 
 
 
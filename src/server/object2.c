@@ -15,6 +15,9 @@
 
 #include "angband.h"
 
+/* For gettimeofday() */
+#include <sys/time.h>
+
 
 /* At 50% there were too many cursed jewelry in general in my opinion, using a macro now - C. Blue */
 #define CURSED_JEWELRY_CHANCE	25
@@ -224,6 +227,33 @@ void excise_object_idx(int o_idx) {
 
 
 
+/*
+ * Where each object index sits in o_fast[]. An entry is only valid while
+ * o_fast[o_fast_pos[i]] == i, so nothing has to be cleared when o_top drops.
+ */
+static s32b o_fast_pos[MAX_O_IDX];
+
+static void o_fast_add(int o_idx) {
+	o_fast_pos[o_idx] = o_top;
+	o_fast[o_top++] = o_idx;
+}
+
+static bool o_fast_listed(int o_idx) {
+	s32b k = o_fast_pos[o_idx];
+
+	return(k < o_top && o_fast[k] == o_idx);
+}
+
+/* Swap-remove an object index from o_fast[] */
+static void o_fast_excise(int o_idx) {
+	s32b k;
+
+	if (!o_fast_listed(o_idx)) return;
+	k = o_fast_pos[o_idx];
+	o_fast[k] = o_fast[--o_top];
+	o_fast_pos[o_fast[k]] = k;
+}
+
 /*
  * Delete a dungeon object
  * unfound_art: TRUE -> set artifact to 'not found' aka findable again. This is the normal use.
@@ -345,6 +375,9 @@ void delete_object_idx(int o_idx, bool unfound_art, bool log) {
 
 	/* Wipe the object */
 	WIPE(o_ptr, object_type);
+
+	/* Free the index for o_pop() right away */
+	o_fast_excise(o_idx);
 }
 
 /*
@@ -679,8 +712,13 @@ void compact_objects(int size, bool purge) {
 	/* Collect "live" objects */
 	for (i = 0; i < o_max; i++) {
 		/* Collect indexes */
-		o_fast[o_top++] = i;
+		o_fast_add(i);
 	}
+
+#ifdef TIMED_OBJECT_LIST
+	/* Indices may have moved */
+	object_timed_flush();
+#endif
 }
 
 
@@ -987,7 +1025,7 @@ void wipe_o_list_nonarts(struct worldpos *wpos) {
  * array of pointers to "live" objects.
  */
 int o_pop(void) {
-	int i, n, k;
+	int i, n;
 
 	/* Initial allocation */
 	if (o_max < MAX_O_IDX) {
@@ -998,7 +1036,7 @@ int o_pop(void) {
 		o_max++;
 
 		/* Update "o_fast" */
-		o_fast[o_top++] = i;
+		o_fast_add(i);
 
 		/* Use this object */
 		return(i);
@@ -1020,16 +1058,10 @@ int o_pop(void) {
 		if (o_top >= MAX_O_IDX) continue;
 
 		/* Verify not allocated */
-		for (k = 0; k < o_top; k++) {
-			/* Hack -- Prevent errors */
-			if (o_fast[k] == i) i = 0;
-		}
-
-		/* Oops XXX XXX */
-		if (!i) continue;
+		if (o_fast_listed(i)) continue;
 
 		/* Update "o_fast" */
-		o_fast[o_top++] = i;
+		o_fast_add(i);
 
 		/* Use this object */
 		return(i);
@@ -1046,253 +1078,474 @@ int o_pop(void) {
 
 
 /*
- * Apply a "object restriction function" to the "object allocation table"
+ * The "prob2" of one allocation table entry, see get_obj_num_prep()
  */
-errr get_obj_num_prep(u64b resf) {
-	long	i, n, p, adj;
-	long	k_idx;
+static long obj_num_prob2(alloc_entry *entry, int (*hook)(int k_idx, u64b resf), u64b resf) {
+	long p, adj;
+	long k_idx;
 #if FORCED_DROPS != 0 /* either, way 1 or 2 */
 	int tval, sval;
 #endif
 
-	/* Get the entry */
-	alloc_entry *restrict table = alloc_kind_table;
+	/* Obtain the base probability */
+	p = entry->prob1;
 
-	/* Copy the hook into a local variable for speed */
-	int (*hook)(int k_idx, u64b resf) = get_obj_num_hook;
+	/* Access the index */
+	k_idx = entry->index;
 
+	if (!(resf & RESF_WINNER) && (k_info[k_idx].flags5 & TR5_WINNERS_ONLY)) return(0);
+	if ((resf & RESF_FORCERANDART) && !randart_eligible(k_info[k_idx].tval)) return(0);
 
-	/* Scan the allocation table */
-	for (i = 0, n = alloc_kind_size; i < n; i++) {
-		/* Get the entry */
-		alloc_entry *entry = &table[i];
+	/* Call the hook and adjust the probability */
+	if (hook) {
+		adj = (*hook)(k_idx, resf);
+		p = (adj * p) / 1000;
+	}
 
-		/* Obtain the base probability */
-		p = entry->prob1;
+#if FORCED_DROPS == 1 /* way 1/2 */
+	/* Check for special item types */
+	tval = k_info[k_idx].tval;
+	sval = k_info[k_idx].sval;
+
+	//SOFT-force generation of an aquatic weapon (polearm), if generating a combat at all
+	if ((resf & RESF_COND_AQUAPOLEARM) && is_melee_weapon(tval) && (tval != TV_POLEARM || !is_aquatic_polearm(sval))) p = 0;
+	//SOFT-force generation of an axe, if generating a combat at all
+	if ((resf & RESF_COND_AXE) && is_melee_weapon(tval) && tval != TV_AXE) p = 0;
+	//force generation of a sword, if generating a combat item at all
+	if ((resf & RESF_COND_SWORD) && which_theme(tval) == TC_COMBAT) {
+		if (tval != TV_SWORD) p = 0;
+		else if (sval == SV_DARK_SWORD) p >>= 2; //don't overdo it..
+	}
+	//force generation of a dark sword, if generating a combat item at all
+	if ((resf & RESF_COND_DARKSWORD) && which_theme(tval) == TC_COMBAT && (tval != TV_SWORD || sval != SV_DARK_SWORD)) p = 0;
+	//force generation of a blunt, if generating a combat at all
+	if ((resf & RESF_COND_BLUNT) && which_theme(tval) == TC_COMBAT && tval != TV_BLUNT) p = 0;
+	//force generation of a non-sword weapon, if generating a _weapon_ at all
+	if ((resf & RESF_CONDF_NOSWORD) && is_melee_weapon(tval) && tval == TV_SWORD) p = 0;
+	//prevent generation of a mage staff -- Saruman specialty
+	if ((resf & RESF_CONDF_NOMSTAFF) && tval == TV_MSTAFF) p = 0;
+	//force generation of a mage staff:
+	if ((resf & RESF_CONDF_MSTAFF) && tval != TV_MSTAFF) p = 0;
+	//force generation of a sling or sling-ammo, if generating a combat item at all
+	if ((resf & RESF_COND_SLING) && which_theme(tval) == TC_COMBAT && (tval != TV_BOW || sval != SV_SLING) && tval != TV_SHOT) p = 0;
+	//force generation of a ranged weapon or ammo, if generating a combat item at all
+	if ((resf & RESF_COND_RANGED) && which_theme(tval) == TC_COMBAT && !is_ranged_weapon(tval) && !is_ammo(tval)) p = 0;
+	//force generation of a rune, if generating a magic item at all
+	if ((resf & RESF_CONDF_RUNE) && which_theme(tval) == TC_MAGIC && tval != TV_RUNE) p = 0;
+#endif
+#if FORCED_DROPS == 2 /* way 2/2 */
+	/* Check for special item types. - C. Blue
+	   Note: The 'p = 10000' lines are for enabling this item for monsters
+	   who usually don't have it in their theme table. This is needed for
+	   drops we expect from certain ego monster types. Eg ogres don't have
+	   magic items in their loot table, but an ogre mage could drop a mage staff! */
+	tval = k_info[k_idx].tval;
+	sval = k_info[k_idx].sval;
+
+	if (resf & RESF_COND_FORCE) {
+		if ((resf & RESF_COND_AQUAPOLEARM) && is_melee_weapon(tval)) { //SOFT-force generation (same as in FORCED_DROPS == 1) of an aquatic weapon (polearm)
+			if (tval != TV_POLEARM || !is_aquatic_polearm(sval)) p = 0;
+			else p = 10000;
+		}
+		if ((resf & RESF_COND_AXE) && is_melee_weapon(tval)) { //SOFT-force generation (same as in FORCED_DROPS == 1) of an axe
+			if (tval != TV_AXE) p = 0;
+			else p = 10000;
+		}
+		if (resf & RESF_COND_SWORD) { //force generation of a sword
+			if (tval != TV_SWORD) p = 0;
+			else p = 10000;
+		}
+		if (resf & RESF_COND_LSWORD) { //force generation of a light sword
+			if (tval != TV_SWORD || (k_info[k_idx].flags4 & (TR4_MUST2H | TR4_SHOULD2H))) p = 0;
+			else p = 10000;
+		}
+		if (resf & RESF_COND_DARKSWORD) { //force generation of a dark sword
+			if (tval != TV_SWORD || sval != SV_DARK_SWORD) p = 0;
+			else p = 10000;
+		}
+		if (resf & RESF_COND_BLUNT) { //force generation of a blunt weapon
+			if (tval != TV_BLUNT) p = 0;
+			else p = 10000;
+		}
+		if ((resf & RESF_CONDF_NOSWORD) && tval == TV_SWORD) p = 0; //force generation of a non-sword if 'generating' a weapon
+		if (resf & RESF_CONDF_MSTAFF) { //force generation of a mage staff
+			if (tval != TV_MSTAFF) p = 0;
+			else p = 10000;
+		}
+		if (resf & RESF_COND_SLING) { //force generation of a sling (or ammo)
+			if (tval != TV_BOW || sval != SV_SLING) p = 0;
+			else if (tval == TV_SHOT) p = 3000;
+			else p = 10000; //sling
+		}
+		if (resf & RESF_COND_RANGED) { //force generation of a ranged weapon (or ammo)
+			if (!is_ranged_weapon(tval) && !is_ammo(tval)) p = 0;
+			else if (is_ammo(tval)) p = 10000; //was 3000 - but we need moar ammo in IDDC!
+			else if (tval == TV_BOOMERANG) p = 3000;
+			else p = 10000; //sling/bow/crossbow
+		}
+		if (resf & RESF_CONDF_RUNE) { //force generation of a rune
+			if (tval != TV_RUNE) p = 0;
+			else p = 10000;
+		}
+	} else {
+		//SOFT-force generation (same as in FORCED_DROPS == 1) of an aquatic weapon (polearm)
+		if ((resf & RESF_COND_AQUAPOLEARM) && is_melee_weapon(tval)) {
+			if (tval != TV_POLEARM || !is_aquatic_polearm(sval)) p = 0;
+			else p = 10000;
+		}
+		//SOFT-force generation (same as in FORCED_DROPS == 1) of an axe
+		if ((resf & RESF_COND_AXE) && is_melee_weapon(tval)) {
+			if (tval != TV_AXE) p = 0;
+			else p = 10000;
+		}
+		//force generation of a sword, if generating a weapon
+		if ((resf & RESF_COND_SWORD) && is_weapon(tval)) {
+			if (tval != TV_SWORD) p = 0;
+			else if (sval == SV_DARK_SWORD) p >>= 2; //don't overdo it..
+			else p = 10000;
+		}
+		//force generation of a light sword, if generating a weapon
+		if ((resf & RESF_COND_LSWORD) && is_weapon(tval)) {
+			if (tval != TV_SWORD || (k_info[k_idx].flags4 & (TR4_MUST2H | TR4_SHOULD2H))) p = 0;
+			else p = 10000;
+		}
+		//force generation of a dark sword, if generating a weapon
+		if ((resf & RESF_COND_DARKSWORD) && is_weapon(tval)) {
+			if (tval != TV_SWORD || sval != SV_DARK_SWORD) p = 0;
+			else p = 10000;
+		}
+		//force generation of a blunt, if generating a weapon
+		if ((resf & RESF_COND_BLUNT) && is_weapon(tval)) {
+			if (tval != TV_BLUNT) p = 0;
+			else p = 10000;
+		}
+		//force generation of a non-sword, if generating a weapon (note: focusses on melee weapons when clearing)
+		if ((resf & RESF_CONDF_NOSWORD) && tval == TV_SWORD) p = 0;
+		//force generation of a mage staff, absolutely:
+		if (resf & RESF_CONDF_MSTAFF) {
+			if (tval != TV_MSTAFF) p = 0;
+			else p = 10000;
+		}
+		//force generation of a sling or sling-ammo, if generating any weapon or ammo (note: focusses on ranged weapons when clearing)
+		if ((resf & RESF_COND_SLING) && (is_weapon(tval) || is_ammo(tval))) {
+			if ((tval != TV_BOW || sval != SV_SLING) && tval != TV_SHOT) p = 0;
+			else if (tval == TV_SHOT) p = 10000;
+			else p = 10000; //sling
+		}
+		//force generation of a ranged weapon or ammo
+		if ((resf & RESF_COND_RANGED) && (is_weapon(tval) || is_ammo(tval))) {
+			if (!is_ranged_weapon(tval) && !is_ammo(tval)) p = 0;
+			else if (is_ammo(tval)) p = 10000;
+			else if (tval == TV_BOOMERANG) p = 3000;
+			else p = 10000; //sling/bow/crossbow
+		}
+		//force generation of a rune, absolutely
+		if (resf & RESF_CONDF_RUNE) {
+			if (tval != TV_RUNE) p = 0;
+			else p = 10000;
+		}
+	}
+	//mostly avoid heavy armour
+	if ((resf & RESF_COND2_LARMOUR) && is_tough_armour(tval, sval)) p >>= 2;
+	//mostly avoid light armour
+	if ((resf & RESF_COND2_HARMOUR) && is_flexible_armour(tval, sval)) p >>= 2;
+#endif
+
+	/* Dungeon town stores: Even rarer items have same probability of appearing */
+	if (p && (resf & RESF_STOREFLAT)) p = 100;
 
-		/* Default probability for this pass */
-		entry->prob2 = 0;
+	return(p);
+}
 
-		/* Access the index */
-		k_idx = entry->index;
+/*
+ * The "prob2" of one allocation table entry, see get_obj_num_prep_tval()
+ */
+static long obj_num_prob2_tval(alloc_entry *entry, int (*hook)(int k_idx, u64b resf), int tval, u64b resf) {
+	long p, adj;
+	long k_idx;
 
-		if (!(resf & RESF_WINNER) && (k_info[k_idx].flags5 & TR5_WINNERS_ONLY)) continue;
-		if ((resf & RESF_FORCERANDART) && !randart_eligible(k_info[k_idx].tval)) continue;
+	/* Obtain the base probability */
+	p = entry->prob1;
 
-		/* Call the hook and adjust the probability */
-		if (hook) {
-			adj = (*hook)(k_idx, resf);
-			p = (adj * p) / 1000;
-		}
+	/* Access the index */
+	k_idx = entry->index;
 
-#if FORCED_DROPS == 1 /* way 1/2 */
-		/* Check for special item types */
-		tval = k_info[k_idx].tval;
-		sval = k_info[k_idx].sval;
-
-		//SOFT-force generation of an aquatic weapon (polearm), if generating a combat at all
-		if ((resf & RESF_COND_AQUAPOLEARM) && is_melee_weapon(tval) && (tval != TV_POLEARM || !is_aquatic_polearm(sval))) p = 0;
-		//SOFT-force generation of an axe, if generating a combat at all
-		if ((resf & RESF_COND_AXE) && is_melee_weapon(tval) && tval != TV_AXE) p = 0;
-		//force generation of a sword, if generating a combat item at all
-		if ((resf & RESF_COND_SWORD) && which_theme(tval) == TC_COMBAT) {
-			if (tval != TV_SWORD) p = 0;
-			else if (sval == SV_DARK_SWORD) p >>= 2; //don't overdo it..
-		}
-		//force generation of a dark sword, if generating a combat item at all
-		if ((resf & RESF_COND_DARKSWORD) && which_theme(tval) == TC_COMBAT && (tval != TV_SWORD || sval != SV_DARK_SWORD)) p = 0;
-		//force generation of a blunt, if generating a combat at all
-		if ((resf & RESF_COND_BLUNT) && which_theme(tval) == TC_COMBAT && tval != TV_BLUNT) p = 0;
-		//force generation of a non-sword weapon, if generating a _weapon_ at all
-		if ((resf & RESF_CONDF_NOSWORD) && is_melee_weapon(tval) && tval == TV_SWORD) p = 0;
-		//prevent generation of a mage staff -- Saruman specialty
-		if ((resf & RESF_CONDF_NOMSTAFF) && tval == TV_MSTAFF) p = 0;
-		//force generation of a mage staff:
-		if ((resf & RESF_CONDF_MSTAFF) && tval != TV_MSTAFF) p = 0;
-		//force generation of a sling or sling-ammo, if generating a combat item at all
-		if ((resf & RESF_COND_SLING) && which_theme(tval) == TC_COMBAT && (tval != TV_BOW || sval != SV_SLING) && tval != TV_SHOT) p = 0;
-		//force generation of a ranged weapon or ammo, if generating a combat item at all
-		if ((resf & RESF_COND_RANGED) && which_theme(tval) == TC_COMBAT && !is_ranged_weapon(tval) && !is_ammo(tval)) p = 0;
-		//force generation of a rune, if generating a magic item at all
-		if ((resf & RESF_CONDF_RUNE) && which_theme(tval) == TC_MAGIC && tval != TV_RUNE) p = 0;
-#endif
-#if FORCED_DROPS == 2 /* way 2/2 */
-		/* Check for special item types. - C. Blue
-		   Note: The 'p = 10000' lines are for enabling this item for monsters
-		   who usually don't have it in their theme table. This is needed for
-		   drops we expect from certain ego monster types. Eg ogres don't have
-		   magic items in their loot table, but an ogre mage could drop a mage staff! */
-		tval = k_info[k_idx].tval;
-		sval = k_info[k_idx].sval;
-
-		if (resf & RESF_COND_FORCE) {
-			if ((resf & RESF_COND_AQUAPOLEARM) && is_melee_weapon(tval)) { //SOFT-force generation (same as in FORCED_DROPS == 1) of an aquatic weapon (polearm)
-				if (tval != TV_POLEARM || !is_aquatic_polearm(sval)) p = 0;
-				else p = 10000;
-			}
-			if ((resf & RESF_COND_AXE) && is_melee_weapon(tval)) { //SOFT-force generation (same as in FORCED_DROPS == 1) of an axe
-				if (tval != TV_AXE) p = 0;
-				else p = 10000;
-			}
-			if (resf & RESF_COND_SWORD) { //force generation of a sword
-				if (tval != TV_SWORD) p = 0;
-				else p = 10000;
-			}
-			if (resf & RESF_COND_LSWORD) { //force generation of a light sword
-				if (tval != TV_SWORD || (k_info[k_idx].flags4 & (TR4_MUST2H | TR4_SHOULD2H))) p = 0;
-				else p = 10000;
-			}
-			if (resf & RESF_COND_DARKSWORD) { //force generation of a dark sword
-				if (tval != TV_SWORD || sval != SV_DARK_SWORD) p = 0;
-				else p = 10000;
-			}
-			if (resf & RESF_COND_BLUNT) { //force generation of a blunt weapon
-				if (tval != TV_BLUNT) p = 0;
-				else p = 10000;
-			}
-			if ((resf & RESF_CONDF_NOSWORD) && tval == TV_SWORD) p = 0; //force generation of a non-sword if 'generating' a weapon
-			if (resf & RESF_CONDF_MSTAFF) { //force generation of a mage staff
-				if (tval != TV_MSTAFF) p = 0;
-				else p = 10000;
-			}
-			if (resf & RESF_COND_SLING) { //force generation of a sling (or ammo)
-				if (tval != TV_BOW || sval != SV_SLING) p = 0;
-				else if (tval == TV_SHOT) p = 3000;
-				else p = 10000; //sling
-			}
-			if (resf & RESF_COND_RANGED) { //force generation of a ranged weapon (or ammo)
-				if (!is_ranged_weapon(tval) && !is_ammo(tval)) p = 0;
-				else if (is_ammo(tval)) p = 10000; //was 3000 - but we need moar ammo in IDDC!
-				else if (tval == TV_BOOMERANG) p = 3000;
-				else p = 10000; //sling/bow/crossbow
-			}
-			if (resf & RESF_CONDF_RUNE) { //force generation of a rune
-				if (tval != TV_RUNE) p = 0;
-				else p = 10000;
-			}
-		} else {
-			//SOFT-force generation (same as in FORCED_DROPS == 1) of an aquatic weapon (polearm)
-			if ((resf & RESF_COND_AQUAPOLEARM) && is_melee_weapon(tval)) {
-				if (tval != TV_POLEARM || !is_aquatic_polearm(sval)) p = 0;
-				else p = 10000;
-			}
-			//SOFT-force generation (same as in FORCED_DROPS == 1) of an axe
-			if ((resf & RESF_COND_AXE) && is_melee_weapon(tval)) {
-				if (tval != TV_AXE) p = 0;
-				else p = 10000;
-			}
-			//force generation of a sword, if generating a weapon
-			if ((resf & RESF_COND_SWORD) && is_weapon(tval)) {
-				if (tval != TV_SWORD) p = 0;
-				else if (sval == SV_DARK_SWORD) p >>= 2; //don't overdo it..
-				else p = 10000;
-			}
-			//force generation of a light sword, if generating a weapon
-			if ((resf & RESF_COND_LSWORD) && is_weapon(tval)) {
-				if (tval != TV_SWORD || (k_info[k_idx].flags4 & (TR4_MUST2H | TR4_SHOULD2H))) p = 0;
-				else p = 10000;
-			}
-			//force generation of a dark sword, if generating a weapon
-			if ((resf & RESF_COND_DARKSWORD) && is_weapon(tval)) {
-				if (tval != TV_SWORD || sval != SV_DARK_SWORD) p = 0;
-				else p = 10000;
-			}
-			//force generation of a blunt, if generating a weapon
-			if ((resf & RESF_COND_BLUNT) && is_weapon(tval)) {
-				if (tval != TV_BLUNT) p = 0;
-				else p = 10000;
-			}
-			//force generation of a non-sword, if generating a weapon (note: focusses on melee weapons when clearing)
-			if ((resf & RESF_CONDF_NOSWORD) && tval == TV_SWORD) p = 0;
-			//force generation of a mage staff, absolutely:
-			if (resf & RESF_CONDF_MSTAFF) {
-				if (tval != TV_MSTAFF) p = 0;
-				else p = 10000;
-			}
-			//force generation of a sling or sling-ammo, if generating any weapon or ammo (note: focusses on ranged weapons when clearing)
-			if ((resf & RESF_COND_SLING) && (is_weapon(tval) || is_ammo(tval))) {
-				if ((tval != TV_BOW || sval != SV_SLING) && tval != TV_SHOT) p = 0;
-				else if (tval == TV_SHOT) p = 10000;
-				else p = 10000; //sling
-			}
-			//force generation of a ranged weapon or ammo
-			if ((resf & RESF_COND_RANGED) && (is_weapon(tval) || is_ammo(tval))) {
-				if (!is_ranged_weapon(tval) && !is_ammo(tval)) p = 0;
-				else if (is_ammo(tval)) p = 10000;
-				else if (tval == TV_BOOMERANG) p = 3000;
-				else p = 10000; //sling/bow/crossbow
-			}
-			//force generation of a rune, absolutely
-			if (resf & RESF_CONDF_RUNE) {
-				if (tval != TV_RUNE) p = 0;
-				else p = 10000;
-			}
-		}
-		//mostly avoid heavy armour
-		if ((resf & RESF_COND2_LARMOUR) && is_tough_armour(tval, sval)) p >>= 2;
-		//mostly avoid light armour
-		if ((resf & RESF_COND2_HARMOUR) && is_flexible_armour(tval, sval)) p >>= 2;
-#endif
-
-		/* Dungeon town stores: Even rarer items have same probability of appearing */
-		if (p && (resf & RESF_STOREFLAT)) p = 100;
-
-		/* Save the probability */
-		entry->prob2 = p;
+	/* Call the hook and adjust the probability */
+	if (hook) {
+		adj = (*hook)(k_idx, resf);
+		p = (adj * p) / 1000;
 	}
 
-	/* Success */
-	return(0);
-}
+	if (p && (resf & RESF_STOREFLAT)) p = 100;
 
+	/* Only accept a specific tval */
+	if (k_info[k_idx].tval != tval) return(0);
 
+	if (!(resf & RESF_WINNER) && (k_info[k_idx].flags5 & TR5_WINNERS_ONLY)) return(0);
+
+	return(p);
+}
 
+#ifdef OBJ_NUM_CACHE
 /*
- * Apply a "object restriction function" to the "object allocation table"
- * This function only takes objects of a certain TVAL! - C. Blue
- * (note that kind_is_legal_special and this function are somewhat redundant)
- * (this function supports STOREFLAT but isn't called by store.c, what gives)
+ * Cached distributions for get_obj_num().
+ *
+ * Objects are mostly generated with one of a few hooks whose outcome depends
+ * only on the object kind, the restrictions and some known global state such
+ * as the treasure theme (see obj_num_hook_id()). For those, get_obj_num_prep()
+ * doesn't scan the whole allocation table but just remembers its parameters,
+ * and get_obj_num() looks up the matching distribution in a small cache: the
+ * cumulative "prob3" of every table entry. The table is sorted by level, so
+ * the level cap just selects a prefix of it, and objects are drawn from it by
+ * binary search. This consumes the same random numbers and yields the same
+ * objects as the linear scan does.
+ * Other hooks take the old way.
  */
-errr get_obj_num_prep_tval(int tval, u64b resf) {
-	long i, n, p, adj;
-	long k_idx;
+ #define OBJ_NUM_CACHE_SIZE	256	/* Cached distributions, power of 2 */
+
+typedef struct obj_num_key obj_num_key;
+struct obj_num_key {
+	u64b resf;
+	int hook_id;		/* see obj_num_hook_id() */
+	u32b theme, state;	/* global state the hook depends on */
+	int tval;		/* get_obj_num_prep_tval() restriction, -1 for none */
+	int legal_special;	/* kind_is_legal_special */
+	bool no_chests;		/* opening_chest while drawing */
+	bool flat;		/* RESF_STOREFLAT while drawing */
+};
 
-	/* Get the entry */
-	alloc_entry *restrict table = alloc_kind_table;
+typedef struct obj_num_dist obj_num_dist;
+struct obj_num_dist {
+	u32b serial;		/* obj_num_serial when it was built, 0 for unused */
+	u32b used;		/* obj_num_used when it was last used */
+	obj_num_key key;
+	s32b *cum;		/* cumulative "prob3" of each allocation table entry */
+};
 
-	/* Copy the hook into a local variable for speed */
-	int (*hook)(int k_idx, u64b resf) = get_obj_num_hook;
+static obj_num_dist obj_num_cache[OBJ_NUM_CACHE_SIZE];
+static u32b obj_num_serial = 1, obj_num_used = 0;
+
+/* The deferred preparation, if obj_num_lazy */
+static bool obj_num_lazy = FALSE;
+static obj_num_key obj_num_prepped;
+static int (*obj_num_prepped_hook)(int k_idx, u64b resf);
+
+bool obj_num_cache_enabled = TRUE;
+u32b obj_num_hits = 0, obj_num_misses = 0, obj_num_uncached = 0, obj_num_fallbacks = 0;
+
+static int kind_is_normal(int k_idx, u64b resf);
+static int kind_is_good(int k_idx, u64b resf);
+static int kind_is_great(int k_idx, u64b resf);
+static int kind_is_good_reward(int k_idx, u64b resf);
+static u32b match_theme_key(void);
+static int ego_ok_scan(object_type *o_ptr, bool good, int *ok_ego);
+static int ego_ok_get(object_type *o_ptr, bool good, int **ok_ego);
+
+/* Identify hooks that depend on nothing but the object kind and the global state they put into *theme and *state, -1 for any others */
+static int obj_num_hook_id(int (*hook)(int k_idx, u64b resf), u32b *theme, u32b *state) {
+	int id;
+
+	*theme = *state = 0;
+	if (!hook) return(0);
+	if (hook == kind_is_good_reward) return(1);
+
+	/* All others go through kind_is_legal() and thereby depend on the treasure theme */
+	*theme = match_theme_key();
+	if (hook == kind_is_normal) return(2);
+	if (hook == kind_is_good) return(3);
+	if (hook == kind_is_great) return(4);
+	if ((id = store_obj_hook_id(hook, state))) return(10 + id);
+	return(-1);
+}
 
-	/* Scan the allocation table */
-	for (i = 0, n = alloc_kind_size; i < n; i++) {
-		/* Get the entry */
-		alloc_entry *entry = &table[i];
+/* Invalidate all cached distributions and ego candidates, when object kinds got modified */
+void obj_num_cache_flush(void) {
+	if (!++obj_num_serial) obj_num_serial = 1;
+}
+
+/* Try to defer the table preparation to get_obj_num() */
+static bool obj_num_defer(int tval, u64b resf) {
+	obj_num_key *key = &obj_num_prepped;
+
+	obj_num_lazy = FALSE;
+	if (!obj_num_cache_enabled) return(FALSE);
+
+	if ((key->hook_id = obj_num_hook_id(get_obj_num_hook, &key->theme, &key->state)) == -1) {
+		obj_num_uncached++;
+		return(FALSE);
+	}
+	key->resf = resf;
+	key->tval = tval;
+	key->legal_special = kind_is_legal_special;
+	obj_num_prepped_hook = get_obj_num_hook;
+	obj_num_lazy = TRUE;
+	return(TRUE);
+}
+
+static bool obj_num_key_eq(obj_num_key *a, obj_num_key *b) {
+	return(a->resf == b->resf && a->hook_id == b->hook_id && a->theme == b->theme && a->state == b->state
+	    && a->tval == b->tval && a->legal_special == b->legal_special && a->no_chests == b->no_chests && a->flat == b->flat);
+}
 
-		/* Obtain the base probability */
-		p = entry->prob1;
+/* Find or build the distribution of the deferred preparation, or NULL if the hook's global state has changed since */
+static obj_num_dist *obj_num_lookup(bool no_chests, bool flat) {
+	alloc_entry *restrict table = alloc_kind_table;
+	obj_num_key key = obj_num_prepped;
+	obj_num_dist *d;
+	u32b h, theme, state;
+	s32b total = 0;
+	s16b p;
+	long i;
 
-		/* Default probability for this pass */
-		entry->prob2 = 0;
+	key.no_chests = no_chests;
+	key.flat = flat;
 
-		/* Access the index */
-		k_idx = entry->index;
+	h = (u32b)key.resf ^ (u32b)(key.resf >> 32);
+	h = h * 31 + (u32b)key.hook_id;
+	h = h * 31 + key.theme;
+	h = h * 31 + key.state;
+	h = h * 31 + (u32b)key.tval;
+	h = h * 31 + (u32b)key.legal_special;
+	h = (h * 2 + (no_chests ? 1 : 0)) * 2 + (flat ? 1 : 0);
+	h ^= h >> 16;
+	h *= 0x85ebca6bU;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35U;
+	h ^= h >> 16;
+	d = &obj_num_cache[h & (OBJ_NUM_CACHE_SIZE - 2)];
 
-		/* Call the hook and adjust the probability */
-		if (hook) {
-			adj = (*hook)(k_idx, resf);
-			p = (adj * p) / 1000;
+	/* Two ways, so that two distributions used in turn don't keep evicting each other */
+	for (i = 0; i < 2; i++) {
+		if (d[i].serial == obj_num_serial && obj_num_key_eq(&d[i].key, &key)) {
+			obj_num_hits++;
+			d[i].used = ++obj_num_used;
+			return(&d[i]);
 		}
+	}
+	obj_num_misses++;
+	if (d[1].serial != obj_num_serial || (d[0].serial == obj_num_serial && d[1].used < d[0].used)) d++;
+
+	/* The hook is called now instead of in get_obj_num_prep(), so the state it depends on must still be the same */
+	if (obj_num_hook_id(obj_num_prepped_hook, &theme, &state) != key.hook_id || theme != key.theme || state != key.state
+	    || kind_is_legal_special != key.legal_special)
+		return(NULL);
+
+	if (!d->cum) C_MAKE(d->cum, alloc_kind_size, s32b);
+	d->serial = obj_num_serial;
+	d->used = ++obj_num_used;
+	d->key = key;
+
+	/* Same as get_obj_num_prep() followed by the "prob3" pass of get_obj_num() (note that "prob2" is just a s16b) */
+	for (i = 0; i < alloc_kind_size; i++) {
+		if (key.tval == -1) p = obj_num_prob2(&table[i], obj_num_prepped_hook, key.resf);
+		else p = obj_num_prob2_tval(&table[i], obj_num_prepped_hook, key.tval, key.resf);
+
+		if (no_chests && k_info[table[i].index].tval == TV_CHEST) p = 0;
+		else if (p && flat) p = 100;
+
+		total += p;
+		d->cum[i] = total;
+	}
+	return(d);
+}
+
+/* Draw an entry from the first n ones of a distribution */
+static long obj_num_sample(obj_num_dist *d, long n) {
+	s32b value = rand_int(d->cum[n - 1]);
+	long lo = 0, hi = n - 1, mid;
+
+	/* Find the first entry whose cumulative probability exceeds the value */
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (d->cum[mid] > value) hi = mid;
+		else lo = mid + 1;
+	}
+	return(lo);
+}
+
+/* get_obj_num() for a deferred preparation: Returns the k_idx, 0 for no legal object or -1 to fall back to the table */
+static int obj_num_pick(long n, u64b resf) {
+	alloc_entry *restrict table = alloc_kind_table;
+	obj_num_dist *d = obj_num_lookup(opening_chest != 0, !opening_chest && (resf & RESF_STOREFLAT));
+	long i, j;
+	int p;
+
+	if (!d) return(-1);
+
+	/* No legal objects */
+	if (!n || d->cum[n - 1] <= 0) return(0);
+
+	/* Pick an object */
+	i = obj_num_sample(d, n);
+
+	/* don't try for a better object? */
+	if ((resf & RESF_STOREFLAT)) return(table[i].index);
+
+	/* Power boost */
+	p = rand_int(100);
+
+	/* Try for a "better" object once (50%) or twice (10%) */
+	if (p < 60) {
+		j = i;
+		i = obj_num_sample(d, n);
+		/* Keep the "best" one */
+		if (table[i].level < table[j].level) i = j;
+	}
 
-		if (p && (resf & RESF_STOREFLAT)) p = 100;
+	/* Try for a "better" object twice (10%) */
+	if (p < 10) {
+		j = i;
+		i = obj_num_sample(d, n);
+		/* Keep the "best" one */
+		if (table[i].level < table[j].level) i = j;
+	}
 
-		/* Only accept a specific tval */
-		if (k_info[k_idx].tval != tval) continue;
+	return(table[i].index);
+}
+#endif
 
-		if (!(resf & RESF_WINNER) && (k_info[k_idx].flags5 & TR5_WINNERS_ONLY)) continue;
+/*
+ * Apply the restrictions to the whole allocation table, any tval if it is -1
+ */
+static void obj_num_prep_table(int (*hook)(int k_idx, u64b resf), int tval, u64b resf) {
+	alloc_entry *restrict table = alloc_kind_table;
+	long i, n;
 
-		/* Save the probability */
-		entry->prob2 = p;
+	for (i = 0, n = alloc_kind_size; i < n; i++) {
+		if (tval == -1) table[i].prob2 = obj_num_prob2(&table[i], hook, resf);
+		else table[i].prob2 = obj_num_prob2_tval(&table[i], hook, tval, resf);
 	}
+#ifdef OBJ_NUM_CACHE
+	obj_num_lazy = FALSE;
+#endif
+}
+
+/*
+ * Apply a "object restriction function" to the "object allocation table"
+ */
+errr get_obj_num_prep(u64b resf) {
+#ifdef OBJ_NUM_CACHE
+	if (obj_num_defer(-1, resf)) return(0);
+#endif
+	obj_num_prep_table(get_obj_num_hook, -1, resf);
+
+	/* Success */
+	return(0);
+}
+
+
+
+/*
+ * Apply a "object restriction function" to the "object allocation table"
+ * This function only takes objects of a certain TVAL! - C. Blue
+ * (note that kind_is_legal_special and this function are somewhat redundant)
+ * (this function supports STOREFLAT but isn't called by store.c, what gives)
+ */
+errr get_obj_num_prep_tval(int tval, u64b resf) {
+#ifdef OBJ_NUM_CACHE
+	if (obj_num_defer(tval, resf)) return(0);
+#endif
+	obj_num_prep_table(get_obj_num_hook, tval, resf);
 
 	/* Success */
 	return(0);
@@ -1343,6 +1596,16 @@ s16b get_obj_num(int max_level, u64b resf) {
 	/* Calculate loop bounds */
 	n = alloc_kind_index_level[max_level + 1];
 
+#ifdef OBJ_NUM_CACHE
+	if (obj_num_lazy) {
+		if ((i = obj_num_pick(n, resf)) != -1) return(i);
+
+		/* The hook's global state changed since get_obj_num_prep(), prepare the table the old way after all */
+		obj_num_fallbacks++;
+		obj_num_prep_table(obj_num_prepped_hook, obj_num_prepped.tval, obj_num_prepped.resf);
+	}
+#endif
+
 	/* If we're opening a chest, prevent generating another chest from it */
 	if (opening_chest) {
 		/* Process probabilities */
@@ -1452,6 +1715,150 @@ s16b get_obj_num(int max_level, u64b resf) {
 
 
 
+#ifdef OBJ_NUM_CACHE
+/* Cache statistics for /cacheobj */
+void obj_num_report(int Ind) {
+	u32b total = obj_num_hits + obj_num_misses;
+
+	msg_format(Ind, "Object selection cache is %s\377w.", obj_num_cache_enabled ? "\377Genabled" : "\377rdisabled");
+	msg_format(Ind, "Hits: %u, misses: %u (hit rate %d%%), uncached preparations: %u, fallbacks: %u.",
+	    obj_num_hits, obj_num_misses, total ? (int)(((u64b)obj_num_hits * 100) / total) : 0,
+	    obj_num_uncached, obj_num_fallbacks);
+}
+
+/* /cacheobj check and bench run inside a single game frame, keep them short enough not to stall the server */
+#define OBJ_NUM_TEST_DEFAULT	20000
+#define OBJ_NUM_TEST_MAX	50000
+
+/* The item generation that /cacheobj check and bench cycle through: Roughly what place_object() does at varied depths */
+static int obj_num_test_prep(int i, bool *good, bool *great) {
+	static obj_theme themes[4] = { { 20, 20, 20, 20 }, { 10, 60, 10, 10 }, { 10, 10, 60, 10 }, { 50, 15, 15, 15 } };
+	static int tvals[4] = { TV_SWORD, TV_POTION, TV_SCROLL, TV_RING };
+	int level = 1 + (i * 37) % 127;
+	u64b resf = (i % 5) ? RESF_NONE : RESF_WINNER;
+
+	*great = !(i % 50);
+	*good = *great || !(i % 10);
+
+	/* Occasionally just a specific tval, as for rewards */
+	if (!(i % 11)) {
+		get_obj_num_hook = NULL;
+		get_obj_num_prep_tval(tvals[(i / 11) % 4], resf);
+		return(get_obj_num(level, resf));
+	}
+
+	init_match_theme(themes[(i / 7) % 4]);
+	get_obj_num_hook = *great ? kind_is_great : (*good ? kind_is_good : kind_is_normal);
+	get_obj_num_prep(resf);
+	return(get_obj_num(*good ? level + GOOD_OLEV_BONUS : level, resf));
+}
+
+/*
+ * Verify that the cache doesn't change object generation: Pick 'count' object
+ * kinds at varied depths the old way, then again with the cache from the same
+ * random seed. Both must come out the same, pick by pick. Also compare the
+ * cached ego candidates with a fresh scan for every object kind.
+ */
+void obj_num_check(int Ind, int count) {
+	bool old_enabled = obj_num_cache_enabled, old_quick = Rand_quick, good, great;
+	u32b old_value = Rand_value;
+	int pass, i, k, g, n1, n2, *ok1, ok2[MAX_E_IDX * MAX_EGO_BASETYPES], mismatches = 0, kinds = 0, ego_mismatches = 0;
+	s16b *picks;
+	byte *seen;
+	object_type forge;
+
+	if (count < 1) count = OBJ_NUM_TEST_DEFAULT;
+	if (count > OBJ_NUM_TEST_MAX) count = OBJ_NUM_TEST_MAX;
+	C_MAKE(picks, count, s16b);
+	C_MAKE(seen, MAX_K_IDX, byte);
+
+	for (pass = 0; pass < 2; pass++) {
+		obj_num_cache_enabled = pass;
+		Rand_quick = TRUE;
+		Rand_value = 0x6f626a6e;
+		for (i = 0; i < count; i++) {
+			k = obj_num_test_prep(i, &good, &great);
+			if (!pass) {
+				picks[i] = k;
+				if (!seen[k]) kinds++;
+				seen[k] = 1;
+			} else if (picks[i] != k) mismatches++;
+		}
+	}
+	Rand_quick = old_quick;
+	Rand_value = old_value;
+	obj_num_cache_enabled = TRUE;
+
+	for (k = 1; k < max_k_idx; k++) {
+		if (!k_info[k].name) continue;
+		invcopy(&forge, k);
+		for (g = 0; g < 2; g++) {
+			n1 = ego_ok_get(&forge, g, &ok1);
+			n2 = ego_ok_scan(&forge, g, ok2);
+			if (n1 != n2 || (n1 && memcmp(ok1, ok2, n1 * sizeof(int)))) ego_mismatches++;
+		}
+	}
+
+	obj_num_cache_enabled = old_enabled;
+	get_obj_num_hook = NULL;
+	get_obj_num_prep(RESF_NONE);
+	C_KILL(picks, count, s16b);
+	C_KILL(seen, MAX_K_IDX, byte);
+
+	msg_format(Ind, "%d picks of %d different object kinds: %d differ from the old way, %s\377w.",
+	    count, kinds, mismatches, mismatches ? "\377rFAILED" : "\377Gpassed");
+	msg_format(Ind, "Ego candidates: %d object kinds differ from a fresh scan, %s\377w.",
+	    ego_mismatches, ego_mismatches ? "\377rFAILED" : "\377Gpassed");
+}
+
+/* Measure item generation throughput (object kind and apply_magic()) at varied depths, without and with the cache */
+void obj_num_bench(int Ind, int count) {
+	bool old_enabled = obj_num_cache_enabled, old_quick = Rand_quick, good, great;
+	u32b old_value = Rand_value;
+	struct timeval tv0, tv1;
+	long us[2][2];
+	int pass, part, i, k, level;
+	object_type forge;
+
+	if (count < 1) count = OBJ_NUM_TEST_DEFAULT;
+	if (count > OBJ_NUM_TEST_MAX) count = OBJ_NUM_TEST_MAX;
+
+	for (pass = 0; pass < 2; pass++) {
+		obj_num_cache_enabled = pass;
+
+		/* First just the object kinds, then whole items */
+		for (part = 0; part < 2; part++) {
+			Rand_quick = TRUE;
+			Rand_value = 0x6f626a6e;
+			gettimeofday(&tv0, NULL);
+			for (i = 0; i < count; i++) {
+				k = obj_num_test_prep(i, &good, &great);
+				if (!part || !k) continue;
+				invcopy(&forge, k);
+				level = 1 + (i * 37) % 127;
+				apply_magic_depth(level, &forge, level, FALSE, good, great, FALSE, RESF_MASK_NOART);
+			}
+			gettimeofday(&tv1, NULL);
+			us[pass][part] = (tv1.tv_sec - tv0.tv_sec) * 1000000L + (tv1.tv_usec - tv0.tv_usec);
+			if (us[pass][part] < 1) us[pass][part] = 1;
+		}
+	}
+
+	Rand_quick = old_quick;
+	Rand_value = old_value;
+	obj_num_cache_enabled = old_enabled;
+	get_obj_num_hook = NULL;
+	get_obj_num_prep(RESF_NONE);
+
+	msg_format(Ind, "%d object kinds: uncached %ld/s, cached %ld/s.", count,
+	    (long)(((u64b)count * 1000000) / us[0][0]), (long)(((u64b)count * 1000000) / us[1][0]));
+	msg_format(Ind, "%d items incl. apply_magic(): uncached %ld/s, cached %ld/s.", count,
+	    (long)(((u64b)count * 1000000) / us[0][1]), (long)(((u64b)count * 1000000) / us[1][1]));
+}
+#endif
+
+
+
 /*
  * Known is true when the "attributes" of an object are "known".
  * These include tohit, todam, toac, cost, and pval (charges).
@@ -4892,34 +5299,12 @@ static bool make_artifact(struct worldpos *wpos, object_type *o_ptr, u64b resf)
  * (Be careful not to allow randarts ego!)
  */
 /*
- * Attempt to change an object into an ego
- *
- * This routine should only be called by "apply_magic()"
+ * Collect the ego powers that may be applied to an object, for make_ego_item()
  */
-static bool make_ego_item(int level, object_type *o_ptr, bool good, u64b resf) {
-	int i = 0, j, n;
-	int *ok_ego, ok_num = 0;
-	bool ret = FALSE, double_ok = !(resf & RESF_NODOUBLEEGO);
+static int ego_ok_scan(object_type *o_ptr, bool good, int *ok_ego) {
+	int i, j, n, ok_num = 0;
 	byte tval = o_ptr->tval;
 
-	if (artifact_p(o_ptr) || o_ptr->name2) return(FALSE);
-
-#ifdef NO_BROKEN_EGO_RANDART
-	switch (o_ptr->tval) {
-	case TV_SWORD:
-		if (o_ptr->sval == SV_BROKEN_DAGGER || o_ptr->sval == SV_BROKEN_SWORD) return(FALSE);
-		break;
-	case TV_HARD_ARMOR:
-		if (o_ptr->sval == SV_RUSTY_CHAIN_MAIL) return(FALSE);
-		break;
-	case TV_SOFT_ARMOR:
-		if (o_ptr->sval == SV_FILTHY_RAG) return(FALSE);
-		break;
-	}
-#endif
-
-	C_MAKE(ok_ego, e_tval_size[tval], int);
-
 	/* Grab the ok ego */
 	for (i = 0, n = e_tval_size[tval]; i < n; i++) {
 		ego_item_type *e_ptr = &e_info[e_tval[tval][i]];
@@ -4951,12 +5336,67 @@ static bool make_ego_item(int level, object_type *o_ptr, bool good, u64b resf) {
 		ok_ego[ok_num++] = e_tval[tval][i];
 	}
 
-	if (!ok_num) {
-		/* Fix memory leak - mikaelh */
-		C_FREE(ok_ego, e_tval_size[tval], int);
+	return(ok_num);
+}
 
-		return(FALSE);
+/*
+ * Get the ego powers that may be applied to an object. They depend only on its
+ * kind, so with OBJ_NUM_CACHE they are kept per kind until obj_num_cache_flush().
+ */
+static int ego_ok_get(object_type *o_ptr, bool good, int **ok_ego) {
+	static int ok_scratch[MAX_E_IDX * MAX_EGO_BASETYPES];
+#ifdef OBJ_NUM_CACHE
+	static int *ok_cache[2][MAX_K_IDX], ok_cache_num[2][MAX_K_IDX];
+	static u32b ok_cache_serial[2][MAX_K_IDX];
+	int k_idx = o_ptr->k_idx, g = good ? 1 : 0;
+
+	if (obj_num_cache_enabled && k_idx > 0 && k_idx < MAX_K_IDX
+	    && o_ptr->tval == k_info[k_idx].tval && o_ptr->sval == k_info[k_idx].sval) {
+		if (ok_cache_serial[g][k_idx] != obj_num_serial) {
+			if (ok_cache[g][k_idx]) C_KILL(ok_cache[g][k_idx], ok_cache_num[g][k_idx], int);
+			ok_cache_num[g][k_idx] = ego_ok_scan(o_ptr, good, ok_scratch);
+			if (ok_cache_num[g][k_idx]) {
+				C_MAKE(ok_cache[g][k_idx], ok_cache_num[g][k_idx], int);
+				C_COPY(ok_cache[g][k_idx], ok_scratch, ok_cache_num[g][k_idx], int);
+			}
+			ok_cache_serial[g][k_idx] = obj_num_serial;
+		}
+		*ok_ego = ok_cache[g][k_idx];
+		return(ok_cache_num[g][k_idx]);
 	}
+#endif
+	*ok_ego = ok_scratch;
+	return(ego_ok_scan(o_ptr, good, ok_scratch));
+}
+
+/*
+ * Attempt to change an object into an ego
+ *
+ * This routine should only be called by "apply_magic()"
+ */
+static bool make_ego_item(int level, object_type *o_ptr, bool good, u64b resf) {
+	int i = 0, j;
+	int *ok_ego, ok_num;
+	bool ret = FALSE, double_ok = !(resf & RESF_NODOUBLEEGO);
+
+	if (artifact_p(o_ptr) || o_ptr->name2) return(FALSE);
+
+#ifdef NO_BROKEN_EGO_RANDART
+	switch (o_ptr->tval) {
+	case TV_SWORD:
+		if (o_ptr->sval == SV_BROKEN_DAGGER || o_ptr->sval == SV_BROKEN_SWORD) return(FALSE);
+		break;
+	case TV_HARD_ARMOR:
+		if (o_ptr->sval == SV_RUSTY_CHAIN_MAIL) return(FALSE);
+		break;
+	case TV_SOFT_ARMOR:
+		if (o_ptr->sval == SV_FILTHY_RAG) return(FALSE);
+		break;
+	}
+#endif
+
+	ok_num = ego_ok_get(o_ptr, good, &ok_ego);
+	if (!ok_num) return(FALSE);
 
 	/* Instant-ego items don't need to roll, they must be completed. */
 	if (k_info[o_ptr->k_idx].flags6 & TR6_INSTA_EGO) {
@@ -5242,7 +5682,6 @@ static bool make_ego_item(int level, object_type *o_ptr, bool good, u64b resf) {
 			break;
 		}
 	}
-	C_FREE(ok_ego, e_tval_size[tval], int);
 
 	/* Return */
 	return(ret);
@@ -7427,6 +7866,13 @@ void init_match_theme(obj_theme theme) {
 	match_theme = theme;
 }
 
+#ifdef OBJ_NUM_CACHE
+/* The theme as one number, for the get_obj_num() cache */
+static u32b match_theme_key(void) {
+	return(((u32b)match_theme.treasure << 24) | ((u32b)match_theme.combat << 16) | ((u32b)match_theme.magic << 8) | match_theme.tools);
+}
+#endif
+
 #if 0
 /*
  * Ditto XXX XXX XXX
@@ -11140,6 +11586,10 @@ int drop_near(bool handle_d, int Ind, object_type *o_ptr, int chance, struct wor
 	}
 #endif
 
+#ifdef TIMED_OBJECT_LIST
+	if (o_idx > 0) object_timed_check(o_idx);
+#endif
+
 	/* Result */
 	return(o_idx);
 }
@@ -12894,6 +13344,97 @@ void reorder_pack(int Ind) {
 
 
 
+#ifdef TIMED_OBJECT_LIST
+/*
+ * Only objects that have something ticking need a visit from
+ * process_objects(), so we keep those in their own list instead of
+ * walking all of o_fast[] every frame.
+ * Objects enter the list when they are dropped/thrown (drop_near()),
+ * picked up by a monster or armed as a trap charge. Anything that starts
+ * ticking in place (eg a rod zapped from the floor) is picked up by a
+ * slow sweep over o_fast[] that covers all objects once per second and
+ * also excises the few dead objects that delete_object_idx() didn't.
+ * Objects leave the list on their next visit once nothing ticks anymore.
+ */
+static s32b o_timed[MAX_O_IDX];
+static bool o_timed_in[MAX_O_IDX];
+static int o_timed_top = 0, o_sweep = 0;
+static bool o_timed_valid = FALSE;
+
+/* statistics for /activeobj */
+static u32b o_timed_frames = 0, o_timed_last = 0, o_timed_max = 0;
+static u64b o_timed_visits = 0, o_sweep_visits = 0;
+
+static bool object_is_timed(object_type *o_ptr) {
+	if (!o_ptr->k_idx) return(FALSE);
+	if (o_ptr->recharging) return(TRUE);
+	switch (o_ptr->tval) {
+#ifdef ENABLE_DEMOLITIONIST
+	case TV_CHARGE: return(o_ptr->timeout != 0);
+#endif
+	case TV_POTION: return(o_ptr->timeout != 0);
+	case TV_ROD: return(o_ptr->pval != 0);
+	case TV_GAME: return(o_ptr->sval == SV_SNOWBALL);
+	}
+	return(FALSE);
+}
+
+/* Put o_list[o_idx] on the list if something is ticking on it */
+void object_timed_check(int o_idx) {
+	if (!o_timed_valid || o_idx <= 0 || o_timed_in[o_idx]) return;
+	if (!object_is_timed(&o_list[o_idx])) return;
+
+	o_timed_in[o_idx] = TRUE;
+	o_timed[o_timed_top++] = o_idx;
+}
+
+/* o_list[] got rearranged or wiped, rebuild the list from scratch on the next frame */
+void object_timed_flush(void) {
+	o_timed_valid = FALSE;
+}
+
+static void object_timed_rebuild(void) {
+	int i;
+
+	o_timed_top = 0;
+	for (i = 0; i < MAX_O_IDX; i++) o_timed_in[i] = FALSE;
+	o_timed_valid = TRUE;
+	for (i = 1; i < o_max; i++) object_timed_check(i);
+}
+
+/* Cover all of o_fast[] once per second */
+static void object_timed_sweep(void) {
+	int n = o_top / cfg.fps + 1, i;
+
+	while (n-- && o_top) {
+		if (--o_sweep < 0 || o_sweep >= o_top) o_sweep = o_top - 1;
+		i = o_fast[o_sweep];
+		o_sweep_visits++;
+
+		/* Excise objects that were wiped without delete_object_idx() */
+		if (!o_list[i].k_idx) {
+			o_fast_excise(i);
+			continue;
+		}
+		object_timed_check(i);
+	}
+}
+
+void object_timed_report(int Ind) {
+	msg_format(Ind, "Timed objects: %d of %d live objects on the list (peak %u), %u visited last frame.",
+	    o_timed_top, o_top, o_timed_max, o_timed_last);
+	if (o_timed_frames)
+		msg_format(Ind, "Per frame: %d.%02d list visits, %d.%02d sweep visits (without the list: one visit per live object).",
+		    (int)(o_timed_visits / o_timed_frames), (int)((o_timed_visits * 100 / o_timed_frames) % 100),
+		    (int)(o_sweep_visits / o_timed_frames), (int)((o_sweep_visits * 100 / o_timed_frames) % 100));
+}
+
+void object_timed_reset(void) {
+	o_timed_frames = o_timed_last = o_timed_max = 0;
+	o_timed_visits = o_sweep_visits = 0;
+}
+#endif
+
 /*
  * Hack -- process the objects (called every turn)
  */
@@ -12904,6 +13445,31 @@ void process_objects(void) {
 	object_type *o_ptr;
 	house_type *h_ptr;
 
+#ifdef TIMED_OBJECT_LIST
+	if (!o_timed_valid) object_timed_rebuild();
+	object_timed_sweep();
+	o_timed_frames++;
+	o_timed_last = 0;
+	if ((u32b)o_timed_top > o_timed_max) o_timed_max = o_timed_top;
+
+	/* Process objects that have something ticking */
+	for (k = o_timed_top - 1; k >= 0; k--) {
+		/* Access index */
+		i = o_timed[k];
+
+		/* Access object */
+		o_ptr = &o_list[i];
+		o_timed_last++;
+
+		/* Excise dead objects and those that are done ticking */
+		if (!object_is_timed(o_ptr)) {
+			o_timed_in[i] = FALSE;
+			o_timed[k] = o_timed[--o_timed_top];
+
+			/* Skip */
+			continue;
+		}
+#else
 	/* Process objects */
 	for (k = o_top - 1; k >= 0; k--) {
 		/* Access index */
@@ -12915,11 +13481,12 @@ void process_objects(void) {
 		/* Excise dead objects */
 		if (!o_ptr->k_idx) {
 			/* Excise it */
-			o_fast[k] = o_fast[--o_top];
+			o_fast_excise(i);
 
 			/* Skip */
 			continue;
 		}
+#endif
 
 #ifdef ENABLE_DEMOLITIONIST
 		if (o_ptr->tval == TV_CHARGE) {
@@ -13002,6 +13569,10 @@ void process_objects(void) {
 		}
 	}
 
+#ifdef TIMED_OBJECT_LIST
+	o_timed_visits += o_timed_last;
+#endif
+
 #if 1 /* experimental: also process items in list houses */
 
 	/* timing fix - see description in dungeon():
@@ -14572,7 +15143,8 @@ void init_treasure_classes(void) {
 	total_tools = 0;
 	total_junk = 0;
 
-	get_obj_num_prep(RESF_NONE);
+	/* (Not deferred, we read "prob2" right below) */
+	obj_num_prep_table(get_obj_num_hook, -1, RESF_NONE);
 	n = alloc_kind_index_level[level + 1];
 	total = 0;
 	for (i = 0; i < n; i++) {
@@ -14633,7 +15205,7 @@ void init_treasure_classes(void) {
 	total_tools = 0;
 	total_junk = 0;
 
-	get_obj_num_prep(RESF_NONE);
+	obj_num_prep_table(get_obj_num_hook, -1, RESF_NONE);
 	n = alloc_kind_index_level[level + 1];
 	total = 0;
 	for (i = 0; i < n; i++) {
@@ -14694,7 +15266,7 @@ void init_treasure_classes(void) {
 	total_tools = 0;
 	total_junk = 0;
 
-	get_obj_num_prep(RESF_NONE);
+	obj_num_prep_table(get_obj_num_hook, -1, RESF_NONE);
 	n = alloc_kind_index_level[level + 1];
 	total = 0;
 	for (i = 0; i < n; i++) {
@@ -14743,6 +15315,11 @@ void init_treasure_classes(void) {
 	tc_biasr_junk = (100 * total) / (total_junk * 5);
 
 	s_printf("Initialized Treasure Class Biasses (great)  : %4d%%, %4d%%, %4d%%, %4d%%, %4d%%.\n", tc_biasr_treasure, tc_biasr_combat, tc_biasr_magic, tc_biasr_tools, tc_biasr_junk);
+
+#ifdef OBJ_NUM_CACHE
+	/* The biasses are part of the kind_is_normal/good/great() results */
+	obj_num_cache_flush();
+#endif
 }
 
 /* Translates a wand of wonder into one of the svals it can randomly mirror.
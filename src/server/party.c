@@ -5363,6 +5363,10 @@ void rename_character(char *pnames) {
 			}
 			/* change his name in hash table */
 			strcpy((char *) ptr->name, p_ptr->name);
+#ifdef OBJECT_DESC_CACHE
+			/* items owned by him are described with his new name now */
+			object_desc_cache_flush();
+#endif
 			/* save him */
 			save_player(Ind);
 			/* delete old savefile) */
@@ -5733,6 +5737,11 @@ void delete_player_id(int id) {
 	int slot;
 	hash_entry *ptr, *old_ptr;
 
+#ifdef OBJECT_DESC_CACHE
+	/* items owned by him lose their owner's name */
+	object_desc_cache_flush();
+#endif
+
 	/* Get the destination slot */
 	slot = hash_slot(id);
 
@@ -37,6 +37,11 @@ static byte	xor_byte;	/* Simple encryption */
 static u32b	v_stamp = 0L;	/* A simple "checksum" on the actual values */
 static u32b	x_stamp = 0L;	/* A simple "checksum" on the encoded bytes */
 
+static bool	floor_files_failed;	/* A floor file couldn't be written, see new_wr_floors() */
+
+static bool	sf_hashing = FALSE;	/* sf_put() only feeds sf_hash, see floor_content_hash() */
+static u64b	sf_hash;
+
 
 
 /*
@@ -44,6 +49,12 @@ static u32b	x_stamp = 0L;	/* A simple "checksum" on the encoded bytes */
  */
 
 static void sf_put(byte v) {
+	/* FNV-1a */
+	if (sf_hashing) {
+		sf_hash = (sf_hash ^ v) * 0x100000001B3ULL;
+		return;
+	}
+
 	/* Encode the value, write a character */
 	xor_byte ^= v;
 #if 0
@@ -1904,6 +1915,11 @@ bool save_player(int Ind) {
 	int result = FALSE;
 	char safe[1024];
 
+#ifdef SERVER_BENCHMARK
+	/* Leave the savefiles alone, so every benchmark run starts out from the same world */
+	if (bench_turns) return(TRUE);
+#endif
+
 #ifdef SET_UID
 # ifdef SECURE
 	/* Get "games" permissions */
@@ -2654,6 +2670,9 @@ static bool wr_server_savefile() {
 	/* Error in save */
 	if (ferror(fff) || (fflush(fff) == EOF)) return(FALSE);
 
+	/* Referenced floor files are missing */
+	if (floor_files_failed) return(FALSE);
+
 	/* Successful save */
 	return(TRUE);
 }
@@ -2744,14 +2763,237 @@ static void new_wr_wild() {
 	}
 }
 
+/*
+ * Static floors are kept in one file each, "floor_<wx>_<wy>_<wz>.data" in the
+ * save directory, while the server savefile just lists which ones to load.
+ * A floor file only gets rewritten when the floor is flagged dirty, ie it was
+ * (re)generated, had its terrain changed (see bump_feat_epoch()) or has seen
+ * any player coming or going since the last save, or when its grids or
+ * c_special changed in any other way (see floor_content_hash()). Objects and
+ * monsters remain in the server savefile as before.
+ *
+ * Rewritten floor files first go to "<name>.new" and are only renamed into
+ * place once the new server savefile is (see floor_files_commit()). Each one
+ * carries a random stamp that the server savefile lists along with its floor,
+ * so after a crash in between, rd_floor_file() can tell which of the two
+ * versions on disk belongs to the server savefile.
+ */
+typedef struct floor_file_ref floor_file_ref;
+struct floor_file_ref {
+	struct worldpos wpos;
+	u32b stamp;
+	bool fresh;	/* Written by the save in progress, still waiting under its ".new" name */
+};
+static floor_file_ref *floor_files = NULL, *floor_files_new = NULL;
+static int floor_files_num = 0, floor_files_max = 0, floor_files_new_num = 0, floor_files_new_max = 0;
+int floor_files_written = 0, floor_files_kept = 0; /* Statistics of the last server save */
+
+void floor_file_name(char *buf, struct worldpos *wpos) {
+	char fname[40];
+
+	sprintf(fname, "floor_%d_%d_%d.data", wpos->wx, wpos->wy, wpos->wz);
+	path_build(buf, MAX_PATH_LENGTH, ANGBAND_DIR_SAVE, fname);
+}
+
+static void floor_files_add(struct worldpos *wpos, u32b stamp, bool fresh, bool loaded) {
+	floor_file_ref **list = loaded ? &floor_files : &floor_files_new;
+	int *num = loaded ? &floor_files_num : &floor_files_new_num, *max = loaded ? &floor_files_max : &floor_files_new_max;
+
+	if (*num == *max) {
+		if (!*max) C_MAKE(*list, 256, floor_file_ref);
+		else GROW(*list, *max, *max * 2, floor_file_ref);
+		*max = *max ? *max * 2 : 256;
+	}
+	(*list)[*num].wpos = *wpos;
+	(*list)[*num].stamp = stamp;
+	(*list)[*num].fresh = fresh;
+	(*num)++;
+}
+
+/* Remember a floor file as referenced by the server savefile on disk */
+void floor_files_track(struct worldpos *wpos, u32b stamp) {
+	floor_files_add(wpos, stamp, FALSE, TRUE);
+}
+
+/* Sort floors in the order new_wr_floors() visits them: surface, dungeon floors downwards, tower floors upwards */
+static int floor_file_cmp(struct worldpos *a, struct worldpos *b) {
+	int ra = a->wz <= 0 ? -a->wz : 0x8000 + a->wz, rb = b->wz <= 0 ? -b->wz : 0x8000 + b->wz;
+
+	if (a->wy != b->wy) return(a->wy - b->wy);
+	if (a->wx != b->wx) return(a->wx - b->wx);
+	return(ra - rb);
+}
+
+/* The new server savefile is in place: move the floor files it refers to into place too,
+   then delete floor files that are no longer referenced */
+static void floor_files_commit(void) {
+	floor_file_ref *tmp;
+	dun_level *l_ptr;
+	char buf[MAX_PATH_LENGTH], buf_new[MAX_PATH_LENGTH];
+	int i, j, c;
+
+	for (j = 0; j < floor_files_new_num; j++) {
+		if (!floor_files_new[j].fresh) continue;
+		floor_file_name(buf, &floor_files_new[j].wpos);
+		strcpy(buf_new, buf);
+		strcat(buf_new, ".new");
+		/* If this fails the floor stays dirty; rd_floor_file() still finds the ".new" file by its stamp */
+		if (rename(buf_new, buf)) {
+			s_printf("floor_files_commit(): Failed to rename %s.\n", buf_new);
+			continue;
+		}
+		if (!(l_ptr = getfloor(&floor_files_new[j].wpos))) continue;
+		l_ptr->dirty = FALSE;
+		l_ptr->file_stamp = floor_files_new[j].stamp;
+	}
+
+	i = j = 0;
+	while (i < floor_files_num) {
+		c = j < floor_files_new_num ? floor_file_cmp(&floor_files[i].wpos, &floor_files_new[j].wpos) : -1;
+		if (c > 0) {
+			j++;
+			continue;
+		}
+		if (c < 0) {
+			floor_file_name(buf, &floor_files[i].wpos);
+			fd_kill(buf);
+		} else j++;
+		i++;
+	}
+
+	tmp = floor_files;
+	floor_files = floor_files_new;
+	floor_files_new = tmp;
+	c = floor_files_max;
+	floor_files_max = floor_files_new_max;
+	floor_files_new_max = c;
+	floor_files_num = floor_files_new_num;
+	floor_files_new_num = 0;
+}
+
+/*
+ * Hash what wr_floor() would write for a floor, without writing anything.
+ * Cave info and c_special get changed in far too many places to have all of
+ * them mark the floor dirty, so this tells whether its floor file is still
+ * up to date.
+ */
+u64b floor_content_hash(struct worldpos *wpos) {
+	sf_hashing = TRUE;
+	sf_hash = 0xCBF29CE484222325ULL;
+	wr_floor(wpos);
+	sf_hashing = FALSE;
+	return(sf_hash);
+}
+
+/* Write a floor to "<floor file>.new", to be moved into place by floor_files_commit() */
+static bool wr_floor_file(struct worldpos *wpos, u32b stamp) {
+	FILE *fff_old = fff;
+	byte *fff_buf_old = fff_buf, xor_byte_old = xor_byte;
+	int fff_buf_pos_old = fff_buf_pos;
+	u32b v_stamp_old = v_stamp, x_stamp_old = x_stamp;
+	char name[MAX_PATH_LENGTH];
+	bool ok = FALSE;
+
+	floor_file_name(name, wpos);
+	strcat(name, ".new");
+
+	fff = my_fopen(name, "wb");
+	if (fff) {
+		fff_buf = C_NEW(MAX_BUF_SIZE, byte);
+		fff_buf_pos = 0;
+
+		/* Same header as the server savefile, so rd_floor() can do its version checks */
+		xor_byte = 0;
+		wr_byte(SF_VERSION_MAJOR);
+		xor_byte = 0;
+		wr_byte(SF_VERSION_MINOR);
+		xor_byte = 0;
+		wr_byte(SF_VERSION_PATCH);
+		xor_byte = 0;
+		wr_byte(rand_int(256));
+		v_stamp = 0L;
+		x_stamp = 0L;
+
+		/* Which floor and which save this file belongs to, checked before loading anything */
+		wr_s16b(wpos->wx);
+		wr_s16b(wpos->wy);
+		wr_s16b(wpos->wz);
+		wr_u32b(stamp);
+
+		wr_floor(wpos);
+		wr_u32b(v_stamp);
+		write_buffer();
+
+		ok = !ferror(fff) && fflush(fff) != EOF;
+		if (my_fclose(fff)) ok = FALSE;
+		C_FREE(fff_buf, MAX_BUF_SIZE, byte);
+
+		if (!ok) (void)fd_kill(name);
+	}
+	if (!ok) s_printf("wr_floor_file(): Failed to write %s.\n", name);
+
+	fff = fff_old;
+	fff_buf = fff_buf_old;
+	fff_buf_pos = fff_buf_pos_old;
+	xor_byte = xor_byte_old;
+	v_stamp = v_stamp_old;
+	x_stamp = x_stamp_old;
+	return(ok);
+}
+
+/* Reference a floor in the server savefile, rewriting its floor file first if it changed */
+static void wr_floor_ref(struct worldpos *wpos) {
+	dun_level *l_ptr = getfloor(wpos);
+	u32b stamp;
+	u64b hash;
+	bool fresh;
+
+	if (!l_ptr) return;
+	hash = floor_content_hash(wpos);
+	fresh = l_ptr->dirty || hash != l_ptr->file_hash;
+	if (!fresh) {
+		stamp = l_ptr->file_stamp;
+		floor_files_kept++;
+	} else {
+		/* Any value the floor file on disk doesn't already have */
+		do stamp = ((u32b)rand_int(0x10000) << 16) | (u32b)rand_int(0x10000);
+		while (stamp == l_ptr->file_stamp);
+
+		if (!wr_floor_file(wpos, stamp)) {
+			floor_files_failed = TRUE;
+			return;
+		}
+		/* Stays dirty until floor_files_commit() moved the file into place */
+		l_ptr->file_hash = hash;
+		floor_files_written++;
+	}
+
+	wr_s16b(wpos->wx);
+	wr_s16b(wpos->wy);
+	wr_s16b(wpos->wz);
+	wr_u32b(stamp);
+	floor_files_add(wpos, stamp, fresh, FALSE);
+}
+
 /* write the actual dungeons */
 static void new_wr_floors() {
 	struct worldpos cwpos;
 	wilderness_type *w_ptr;
 	struct dungeon_type *d_ptr;
-	int x, y, z;
+	dun_level *l_ptr;
+	int x, y, z, i;
 	bool omit;
 
+	floor_files_new_num = 0;
+	floor_files_written = floor_files_kept = 0;
+	floor_files_failed = FALSE;
+
+	/* Floors with players on them change all the time, don't bother tracking that in detail */
+	for (i = 1; i <= NumPlayers; i++) {
+		if (Players[i]->conn == NOT_CONNECTED) continue;
+		if (getcave(&Players[i]->wpos) && (l_ptr = getfloor(&Players[i]->wpos))) l_ptr->dirty = TRUE;
+	}
+
 	for (y = 0; y < MAX_WILD_Y; y++) {
 		cwpos.wy = y;
 		for (x = 0; x < MAX_WILD_X; x++) {
@@ -2775,21 +3017,21 @@ static void new_wr_floors() {
 				s_printf("wr_floors(): Omitting town (%d,%d).\n", x, y);
 			}
 			if (restart_unstatice_surface) omit = TRUE; /* No log message, too spammy */
-			if (!omit) if (getcave(&cwpos) && players_on_depth(&cwpos)) wr_floor(&cwpos);
+			if (!omit) if (getcave(&cwpos) && players_on_depth(&cwpos)) wr_floor_ref(&cwpos);
 
 			if (!restart_unstatice_dungeons) { /* No log message, too spammy */
 				if (w_ptr->flags & WILD_F_DOWN) {
 					d_ptr = w_ptr->dungeon;
 					for (z = 1; z <= d_ptr->maxdepth; z++) {
 						cwpos.wz = -z;
-						if (d_ptr->level[z - 1].ondepth && d_ptr->level[z - 1].cave) wr_floor(&cwpos);
+						if (d_ptr->level[z - 1].ondepth && d_ptr->level[z - 1].cave) wr_floor_ref(&cwpos);
 					}
 				}
 				if (w_ptr->flags & WILD_F_UP) {
 					d_ptr = w_ptr->tower;
 					for (z = 1; z <= d_ptr->maxdepth; z++) {
 						cwpos.wz = z;
-						if (d_ptr->level[z - 1].ondepth && d_ptr->level[z - 1].cave) wr_floor(&cwpos);
+						if (d_ptr->level[z - 1].ondepth && d_ptr->level[z - 1].cave) wr_floor_ref(&cwpos);
 					}
 				}
 			}
@@ -3067,6 +3309,11 @@ bool save_server_info() {
 	int result = FALSE;
 	char safe[MAX_PATH_LENGTH];
 
+#ifdef SERVER_BENCHMARK
+	/* Benchmark mode, see save_player() */
+	if (bench_turns) return(TRUE);
+#endif
+
 #if DEBUG_LEVEL > 1
 	s_printf("saving server info...\n");
 #endif
@@ -3099,6 +3346,9 @@ bool save_server_info() {
 		/* Remove preserved savefile */
 		fd_kill(temp);
 
+		/* Drop floor files the new savefile no longer refers to */
+		floor_files_commit();
+
 		/* Success */
 		result = TRUE;
 	}
@@ -106,6 +106,10 @@ void setup_timer(void) {
 void install_timer_tick(void (*func)(void), int freq) {
 	timer_handler = func;
 	timer_freq = freq;
+#ifdef SERVER_BENCHMARK
+	/* Benchmark mode doesn't pace dungeon() in real time, see sched() */
+	if (bench_turns) return;
+#endif
 	setup_timer();
 }
 
@@ -265,8 +269,15 @@ void sched(void) {
 	fd_set readmask;
 	fd_set writemask;
 	int n;
+#ifdef SERVER_BENCHMARK
+	struct timeval no_wait;
+#endif
 
 	while (1) {
+#ifdef SERVER_BENCHMARK
+		/* Benchmark mode: Call the timer handler back to back and only poll the sockets in between */
+		if (bench_turns) timers_used = timer_ticks - 1;
+#endif
 		if (timers_used < timer_ticks) {
 			if (timer_handler) {
 				(*timer_handler)();
@@ -282,7 +293,12 @@ void sched(void) {
 		readmask = input_mask;
 		writemask = output_mask;
 
+#ifdef SERVER_BENCHMARK
+		no_wait.tv_sec = no_wait.tv_usec = 0;
+		n = select(max_fd, &readmask, &writemask, NULL, bench_turns ? &no_wait : NULL);
+#else
 		n = select(max_fd, &readmask, &writemask, NULL, NULL);
+#endif
 		if (n < 0) {
 			int errval = errno;
 
@@ -320,6 +320,1194 @@ static int a2slot(int Ind, char slot, char slot2, bool inven, bool equip) {
 	return(-1);
 }
 
+/*
+ * Command table for slash commands. do_slash_cmd() looks every command
+ * line up here first: an entry matches if the line starts with its name or
+ * one of its aliases ('|'-separated). A name starting with '=' only matches
+ * the whole line, one starting with '!' keeps the entry from matching lines
+ * that start with it. If several entries match, the one listed first wins,
+ * so the table keeps the order of the old prefix() chain. Most entries are
+ * handled by do_slash_cmd() itself, in the switch for their SCMD_ id; the
+ * others have a handler that gets the tokenized command line.
+ * Admin entries are invisible to non-admins and privileged entries only
+ * exist for privileged players who aren't admins.
+ */
+enum {
+	/* Handled before the command line is tokenized */
+	SCMD_SCRIPT, SCMD_RFE, SCMD_BUG, SCMD_COUGH, SCMD_SHOUT, SCMD_SCREAM, SCMD_SAYME, SCMD_SAY,
+	SCMD_WHISPER,
+	SCMD_TOKENIZED,
+
+	SCMD_IGNORE, SCMD_IGNCHAT, SCMD_AFK, SCMD_PAGE, SCMD_PPAGE, SCMD_GPAGE, SCMD_DISPOSE,
+	SCMD_TAG, SCMD_UNTAG, SCMD_CAST, SCMD_BED, SCMD_DRESS, SCMD_EXTRA, SCMD_TIME, SCMD_REFRESH,
+	SCMD_TARGET, SCMD_RECALL, SCMD_LESS, SCMD_NEWS, SCMD_VERSION, SCMD_GUIDE_RACE,
+	SCMD_GUIDE_CLASS, SCMD_GUIDE_TRAIT, SCMD_HELP, SCMD_GUIDE, SCMD_PKILL, SCMD_XORDER,
+	SCMD_FEELING, SCMD_MONSTERS, SCMD_AUTOTAG, SCMD_HOUSES, SCMD_UNIQUES, SCMD_OBJECT,
+	SCMD_SIP, SCMD_FILL, SCMD_EMPTY, SCMD_RIP, SCMD_PET, SCMD_UNPET, SCMD_SHUFFLE, SCMD_DEALER,
+	SCMD_DEAL, SCMD_MARTYR, SCMD_SACRIFICE, SCMD_EMBRACE, SCMD_PNOTE, SCMD_GNOTE, SCMD_SNOTES,
+	SCMD_NOTES, SCMD_NOTE, SCMD_PLAY, SCMD_WISH, SCMD_EVINFO, SCMD_EVSIGN, SCMD_EVUNSIGN,
+	SCMD_BBS, SCMD_STIME, SCMD_PVP, SCMD_AUC, SCMD_LIGHT, SCMD_UNDOSKILLS, SCMD_INFO,
+	SCMD_PRAY, SCMD_PBBS, SCMD_GBBS, SCMD_FTKON, SCMD_FTKOFF, SCMD_FTK, SCMD_DWON, SCMD_DWOFF,
+	SCMD_DW, SCMD_PSTORE, SCMD_PAINT, SCMD_KNOCK, SCMD_SLAP, SCMD_PAT, SCMD_HUG, SCMD_POKE,
+	SCMD_APPLAUD, SCMD_WAVE, SCMD_TIP, SCMD_GUILD_ADDER, SCMD_GUILD_CFG, SCMD_XGUILD_ADDERS,
+	SCMD_TESTYOURMIGHT, SCMD_REQUEST_ESTATE, SCMD_SUBCLASS, SCMD_CONVERTEXCLUSIVE, SCMD_PCLOSE,
+	SCMD_PQUIT, SCMD_GQUIT, SCMD_QUIT, SCMD_SUICIDE, SCMD_TRAIT, SCMD_AUTORETM, SCMD_AUTORETR,
+	SCMD_AUTORET, SCMD_FLASH, SCMD_PARTYMEMBERS, SCMD_GUILDMEMBERS, SCMD_SNBAR, SCMD_HPBAR,
+	SCMD_MPBAR, SCMD_STBAR, SCMD_SEEN, SCMD_QUEST, SCMD_QDROP, SCMD_WHO, SCMD_DUN, SCMD_KIFU,
+	SCMD_BETA, SCMD_COL, SCMD_ACOL, SCMD_TESTDISPLAY, SCMD_TESTASCII, SCMD_SETORDER, SCMD_EDMT,
+	SCMD_SETIMM, SCMD_SETELE, SCMD_CHARACTERS, SCMD_ING, SCMD_FORMS, SCMD_TA, SCMD_UPTIME,
+	SCMD_PORTAL, SCMD_SPLIT, SCMD_REST, SCMD_UNSTOW, SCMD_CHEM, SCMD_MIX, SCMD_KDIZ,
+	SCMD_HLORE, SCMD_NEWAR, SCMD_EMAIL, SCMD_TSS, SCMD_TIMER, SCMD_PRIV_VAL, SCMD_PRIV_INVAL,
+	SCMD_PRIV_LINV, SCMD_TMP, SCMD_WORLD, SCMD_UNWORLD, SCMD_SHUTDOWN, SCMD_SHUTEMPTY,
+	SCMD_SHUTLOW, SCMD_SHUTVLOW, SCMD_SHUTNONE, SCMD_SHUTACTIVEVLOW, SCMD_SHUTSURFACE,
+	SCMD_SHUTXLOW, SCMD_SHUTXXLOW, SCMD_SHUTULOW, SCMD_SHUTREC, SCMD_SHUTCANCEL, SCMD_VAL,
+	SCMD_INVAL, SCMD_PRIVILEGE, SCMD_VPRIVILEGE, SCMD_UNPRIVILEGE, SCMD_MAKEADMIN, SCMD_BANIP,
+	SCMD_BAN, SCMD_KICKIP, SCMD_KICK, SCMD_VIEWBANS, SCMD_UNBAN, SCMD_MUTE, SCMD_XMUTE,
+	SCMD_UNMUTE, SCMD_XUNMUTE, SCMD_CLEAR_LEVEL, SCMD_CLEAR_ITEMS, SCMD_CLEAR_EXTRA,
+	SCMD_CLEAR_NARTS, SCMD_CP, SCMD_MDELETE, SCMD_GENO_LEVEL, SCMD_VANITYGENO,
+	SCMD_MKILL_LEVEL, SCMD_UGENO, SCMD_PANDAHI, SCMD_PANDABYE, SCMD_UNTRAP, SCMD_GAME,
+	SCMD_UNSTATIC_LEVEL, SCMD_TRESET, SCMD_STATIC_LEVEL, SCMD_IDENTIFY, SCMD_SARTIFACT,
+	SCMD_AUNIQUES, SCMD_FIXUNIQUES, SCMD_AUNIQUE, SCMD_AUNIDISABLE, SCMD_AUNIUNKILL,
+	SCMD_AUNICHECK, SCMD_AUNIFIX, SCMD_CURNUMCHECK, SCMD_CURNUMFIX, SCMD_RELOAD_CONFIG,
+	SCMD_XWISH, SCMD_NWISH, SCMD_AWISH, SCMD_SWISH, SCMD_TRAP, SCMD_CTRAP, SCMD_ENLIGHT,
+	SCMD_WIZLIGHTX, SCMD_WIZLIGHT, SCMD_WIZDARK, SCMD_LR, SCMD_LA, SCMD_EQUIP, SCMD_UNCURSE,
+	SCMD_PURGEWILD, SCMD_STORE, SCMD_STNEW, SCMD_CHEEZE, SCMD_LOG, SCMD_LINV, SCMD_CLINV,
+	SCMD_DINV, SCMD_VINV, SCMD_RESPAWN, SCMD_LOG_U, SCMD_NOARTS, SCMD_SWAP_TOWNS,
+	SCMD_DEBUG_TOWNS, SCMD_MOVE_STAIR, SCMD_DEBUG_STAIRS, SCMD_DEBUG_DUN, SCMD_UNLISTDUN,
+	SCMD_UPDATE_DUN, SCMD_SWAP_DUN, SCMD_REMDUN, SCMD_DEBUG_POS, SCMD_FORGETDUN, SCMD_KNOWDUN,
+	SCMD_FORGETTOWN, SCMD_KNOWTOWN, SCMD_WLOCFEAT, SCMD_RELOADMOTD, SCMD_ANOTES, SCMD_DANOTE,
+	SCMD_ANOTE, SCMD_MANOTE, SCMD_BROADCAST_MOTD, SCMD_SWARN, SCMD_REART, SCMD_DEBUGART,
+	SCMD_REEGO, SCMD_THREATEN, SCMD_ASLAP, SCMD_APAT, SCMD_AHUG, SCMD_APOKE, SCMD_STRANGLE,
+	SCMD_ACHEER, SCMD_AAPPLAUD, SCMD_PRESENCE, SCMD_SNICKER, SCMD_DELTOWN, SCMD_CHOUSE,
+	SCMD_MBLOWDICE, SCMD_CRASH, SCMD_CITYCHOWN, SCMD_FIXCHOWN, SCMD_LISTHOUSES,
+	SCMD_POLYHOUSES, SCMD_PYHPDBG, SCMD_ROLLCHAR, SCMD_ROLL_CHAR, SCMD_ROLLHISTORY,
+	SCMD_CHECKHISTORY, SCMD_VXP, SCMD_EVERHOUSE, SCMD_BLINK, SCMD_TPORT, SCMD_TPTAR, SCMD_TPTO,
+	SCMD_LOC, SCMD_STRATHASH, SCMD_STRATMAP, SCMD_STRAT, SCMD_WIPEWILD, SCMD_FINDARTS,
+	SCMD_LOCATEART, SCMD_DEBUG_STORE, SCMD_ACCLIST, SCMD_CHARACC, SCMD_CHANGEACC,
+	SCMD_ADDNEWDUN, SCMD_LOADMAP, SCMD_LLOADMAP, SCMD_LQM, SCMD_MINVCHECK, SCMD_RMNOTHING,
+	SCMD_BACKTRACE, SCMD_ERASECHAR, SCMD_RENAMECHAR, SCMD_CHECKEXPIR, SCMD_GESTART,
+	SCMD_GESTOP, SCMD_GEPAUSE, SCMD_GERETIME, SCMD_GEFFORWARD, SCMD_GESIGN, SCMD_CONTBUF,
+	SCMD_PARTYDEBUG, SCMD_GUILDDEBUG, SCMD_PARTYCLEAN, SCMD_PARTYMODEFIX, SCMD_PARTYMEMBERFIX,
+	SCMD_PARTYDELETE, SCMD_GUILDMODEFIX, SCMD_GUILDMEMBERFIX, SCMD_GUILDRENAME, SCMD_META,
+	SCMD_HIGHSCORERESET, SCMD_HIGHSCORERM, SCMD_HIGHSCORECV, SCMD_REM, SCMD_MCARRY,
+	SCMD_MCUSTOMXP, SCMD_UNOWN, SCMD_ERASEHASHTABLEID, SCMD_OLISTCHECK, SCMD_FLOORCHECK,
+	SCMD_FLOORFIX, SCMD_DBBS, SCMD_EBBS, SCMD_REWARD, SCMD_DEBUG1, SCMD_DEBUG2, SCMD_DAYNIGHT,
+	SCMD_SEASON, SCMD_WEATHER, SCMD_CWEATHER, SCMD_JOKEWEATHER, SCMD_FIREWORKS, SCMD_LIGHTNING,
+	SCMD_HOSTILITIES, SCMD_MKHOSTILE, SCMD_MKPEACE, SCMD_DEBUGSTORE, SCMD_KSTORE, SCMD_COSTS,
+	SCMD_UNBREAK, SCMD_DEBUGDATE, SCMD_OCOPY, SCMD_FIXSKILLS, SCMD_DEBUGITEMREMOVALHOUSE,
+	SCMD_PURGEITEMREMOVALNEVER, SCMD_TESTCHAT, SCMD_INITLUA, SCMD_REINITARRAYS, SCMD_BENCH,
+	SCMD_PINGS, SCMD_DMPRIV, SCMD_UN_ID, SCMD_UNKW, SCMD_CURSE, SCMD_UNCURSE2, SCMD_AI,
+	SCMD_HMUS, SCMD_PSFX, SCMD_WTHUNDER, SCMD_PMUS, SCMD_PVMUS, SCMD_PPMUS, SCMD_TOWEA,
+	SCMD_SCREENFLASH, SCMD_MADART, SCMD_MEASUREART, SCMD_DEBUG_GRID, SCMD_SEASONVARS,
+	SCMD_DEBUG_WILD, SCMD_FIX_WILDFLOCK, SCMD_FIX_HOUSE_MODES, SCMD_TESTREQS, SCMD_UPDATE_LEG,
+	SCMD_DEEPDIVESTATS, SCMD_DEEPDIVEFIX, SCMD_DEEPDIVERESET, SCMD_LSL, SCMD_FIXGUILD,
+	SCMD_DEBUGDVB, SCMD_REINDEXDVB, SCMD_DEBUG_HOUSE, SCMD_DEBUGMD, SCMD_FIXMD, SCMD_WIPEMD,
+	SCMD_FIX_MD, SCMD_FIXCONDMD, SCMD_FIXJAILDUN, SCMD_FIXIDDC, SCMD_FIX2IDDC, SCMD_DUNMKEXP,
+	SCMD_TERMINATE, SCMD_BACKUP_ESTATE, SCMD_BACKUP_ONE_ESTATE, SCMD_BACKUP_CHAR_ESTATE,
+	SCMD_BACKUP_ACCLISTS, SCMD_RESTORE_ACCLISTS, SCMD_MKCLOUD, SCMD_RMCLOUD, SCMD_LSCLOUD,
+	SCMD_TOVALINOR, SCMD_RIDDC, SCMD_ALLREC, SCMD_FIXARTOWNERS1, SCMD_FIXARTOWNERS2,
+	SCMD_FIXARTTIMEOUT, SCMD_MTRACK, SCMD_FIXHASH, SCMD_CHARLASTON, SCMD_TESTRANDART,
+	SCMD_MODITEM, SCMD_QINF, SCMD_QSIZE, SCMD_QINV, SCMD_QAQUEST, SCMD_QCCD, SCMD_QPRIV,
+	SCMD_QDIS, SCMD_QENA, SCMD_QSTART, SCMD_QSTOP, SCMD_QSTAGE, SCMD_QFX, SCMD_DEBUGFLOOR,
+	SCMD_RESERVEDNAMES, SCMD_ADDRESERVEDNAME, SCMD_DELRESERVEDNAME, SCMD_PURGEACCOUNTFILE,
+	SCMD_AP, SCMD_APP, SCMD_AHL, SCMD_OPTRHOUSED, SCMD_DESTROYHOUSE, SCMD_UNOWNHOUSE,
+	SCMD_REST1, SCMD_AMBIENT, SCMD_RSASTAR, SCMD_XID, SCMD_FONTMAPR, SCMD_FONTMAPF, SCMD_TP,
+	SCMD_DEBUGVARS, SCMD_MGMAIL, SCMD_RMGMAIL, SCMD_SETPALETTE, SCMD_SET2PAL, SCMD_SETTIME,
+	SCMD_TURNSPEED, SCMD_TURNSEXTRA, SCMD_SETAORDER, SCMD_INITORDER, SCMD_ACCOUNTORDER,
+	SCMD_ZEROORDER, SCMD_SHOWACCOUNTORDER, SCMD_SCORE, SCMD_CHKPUMP, SCMD_PVERSION,
+	SCMD_TESTMISC1, SCMD_TESTMISC2, SCMD_INVFILL, SCMD_GEO, SCMD_PING, SCMD_CLVER, SCMD_CHKSET,
+	SCMD_REORDER, SCMD_EXPORTPSTORES, SCMD_GETTRADHOUSEITEMS, SCMD_TOHOU, SCMD_MUSHROOMFIELDS,
+	SCMD_CYCLEWILD, SCMD_FOOD, SCMD_PSTAT, SCMD_PRMAP, SCMD_SFLAGS, SCMD_MEGO, SCMD_INVCUR,
+	SCMD_REVCUR, SCMD_RSPUMPKIN, SCMD_DBGSI, SCMD_RELOG, SCMD_ONDEPTH, SCMD_RELOCATECHAR,
+	SCMD_DBGMON, SCMD_SETFEAT, SCMD_GOGAMEUP, SCMD_GOGAMEDOWN, SCMD_GOGAMESTATUS,
+	SCMD_PRINTTURNSPEEDS, SCMD_DEBUG_DROPS_FREQ,
+	SCMD_NONE	/* entries with a handler function */
+};
+
+#define SLASH_USER	0
+#define SLASH_PRIV	1
+#define SLASH_ADMIN	2
+
+typedef struct slash_cmd slash_cmd;
+struct slash_cmd {
+	cptr name;
+	cptr aliases;
+	byte access;
+	int id;
+	int minargs;
+	void (*func)(int Ind, int tk, char **token);
+	cptr help;
+};
+
+/* Set by /slashbench to look commands up in do_slash_cmd() without side effects */
+static bool slash_dry_run = FALSE;
+
+static void sc_slashcmds(int Ind, int tk, char **token);
+static void sc_slashbench(int Ind, int tk, char **token);
+
+#ifdef LOS_CACHE
+/* Show los cache statistics, or use 'on', 'off', 'verify' (toggle) or 'reset' */
+static void sc_loscache(int Ind, int tk, char **token) {
+	u32b total;
+
+	if (tk && !strcmp(token[1], "on")) los_cache_enabled = TRUE;
+	else if (tk && !strcmp(token[1], "off")) los_cache_enabled = FALSE;
+	else if (tk && !strcmp(token[1], "verify")) los_cache_verify = !los_cache_verify;
+	else if (tk && !strcmp(token[1], "reset")) los_cache_hits = los_cache_misses = los_cache_mismatches = 0;
+
+	total = los_cache_hits + los_cache_misses;
+	msg_format(Ind, "LOS cache is %s\377w, verification is %s\377w, %d floors have a cache.",
+	    los_cache_enabled ? "\377Genabled" : "\377rdisabled", los_cache_verify ? "\377yon" : "\377woff", los_cache_count());
+	msg_format(Ind, "Hits: %u, misses: %u (hit rate %d%%), mismatches: \377%c%u\377w.",
+	    los_cache_hits, los_cache_misses, total ? (int)(((u64b)los_cache_hits * 100) / total) : 0,
+	    los_cache_mismatches ? 'r' : 'w', los_cache_mismatches);
+}
+#endif
+
+#ifdef MON_NUM_CACHE
+/* Monster selection cache: show statistics, or use 'on', 'off', 'flush', 'reset', 'check <level> <dlevel> [dungeon type] [samples]' or 'bench <level> [count]' */
+static void sc_cachemon(int Ind, int tk, char **token) {
+	if (tk && !strcmp(token[1], "on")) mon_num_cache_enabled = TRUE;
+	else if (tk && !strcmp(token[1], "off")) mon_num_cache_enabled = FALSE;
+	else if (tk && !strcmp(token[1], "flush")) mon_num_cache_flush();
+	else if (tk && !strcmp(token[1], "reset")) mon_num_hits = mon_num_misses = mon_num_uncached = mon_num_redraws = mon_num_fallbacks = 0;
+	else if (tk >= 3 && !strcmp(token[1], "check")) {
+		mon_num_check(Ind, atoi(token[2]), atoi(token[3]), tk >= 4 ? atoi(token[4]) : 0, tk >= 5 ? atoi(token[5]) : 0);
+		return;
+	} else if (tk >= 2 && !strcmp(token[1], "bench")) {
+		mon_num_bench(Ind, atoi(token[2]), tk >= 3 ? atoi(token[3]) : 0);
+		return;
+	} else if (tk) {
+		msg_print(Ind, "Usage: /cachemon [on|off|flush|reset|check <level> <dlevel> [dungeon type] [samples]|bench <level> [count]]");
+		return;
+	}
+	mon_num_report(Ind);
+}
+#endif
+
+#ifdef OBJ_NUM_CACHE
+/* Object selection cache: show statistics, or use 'on', 'off', 'flush', 'reset', 'check [count]' or 'bench [count]' */
+static void sc_cacheobj(int Ind, int tk, char **token) {
+	if (tk && !strcmp(token[1], "on")) obj_num_cache_enabled = TRUE;
+	else if (tk && !strcmp(token[1], "off")) obj_num_cache_enabled = FALSE;
+	else if (tk && !strcmp(token[1], "flush")) obj_num_cache_flush();
+	else if (tk && !strcmp(token[1], "reset")) obj_num_hits = obj_num_misses = obj_num_uncached = obj_num_fallbacks = 0;
+	else if (tk && !strcmp(token[1], "check")) {
+		obj_num_check(Ind, tk >= 2 ? atoi(token[2]) : 0);
+		return;
+	} else if (tk && !strcmp(token[1], "bench")) {
+		obj_num_bench(Ind, tk >= 2 ? atoi(token[2]) : 0);
+		return;
+	} else if (tk) {
+		msg_print(Ind, "Usage: /cacheobj [on|off|flush|reset|check [count]|bench [count]] (count up to 50000)");
+		return;
+	}
+	obj_num_report(Ind);
+}
+#endif
+
+#ifdef OBJECT_DESC_CACHE
+/* Object description cache: show statistics, or use 'on', 'off', 'flush', 'reset', 'check on|off' or 'bench [count]' */
+static void sc_cachedesc(int Ind, int tk, char **token) {
+	if (tk && !strcmp(token[1], "on")) object_desc_cache_enabled = TRUE;
+	else if (tk && !strcmp(token[1], "off")) object_desc_cache_enabled = FALSE;
+	else if (tk && !strcmp(token[1], "flush")) object_desc_cache_flush();
+	else if (tk && !strcmp(token[1], "reset")) object_desc_hits = object_desc_misses = object_desc_mismatches = 0;
+	else if (tk >= 2 && !strcmp(token[1], "check")) object_desc_check = !strcmp(token[2], "on");
+	else if (tk && !strcmp(token[1], "bench")) {
+		object_desc_bench(Ind, tk >= 2 && atoi(token[2]) > 0 ? atoi(token[2]) : 1000);
+		return;
+	} else if (tk) {
+		msg_print(Ind, "Usage: /cachedesc [on|off|flush|reset|check on|off|bench [count]]");
+		return;
+	}
+	object_desc_report(Ind);
+}
+#endif
+
+/* Calc_boni() statistics, 'reset' to clear them; equipment slot cache: 'on', 'off', 'check on|off' or 'bench [count]' */
+static void sc_boni(int Ind, int tk, char **token) {
+	if (tk && !strcmp(token[1], "reset")) boni_reset();
+#ifdef BONI_SLOT_CACHE
+	else if (tk && !strcmp(token[1], "on")) boni_slot_cache_enabled = TRUE;
+	else if (tk && !strcmp(token[1], "off")) boni_slot_cache_enabled = FALSE;
+	else if (tk >= 2 && !strcmp(token[1], "check")) boni_slot_check = !strcmp(token[2], "on");
+	else if (tk && !strcmp(token[1], "bench")) {
+		boni_bench(Ind, tk >= 2 && atoi(token[2]) > 0 ? atoi(token[2]) : 100000);
+		return;
+	}
+#endif
+	else if (tk) {
+		msg_print(Ind, "Usage: /boni [reset|on|off|check on|off|bench [count]]");
+		return;
+	}
+	boni_report(Ind);
+}
+
+/* Show cost and lateness of the recurring world jobs, 'reset' to clear them afterwards, or 'budget <job> <n>' */
+static void sc_jobs(int Ind, int tk, char **token) {
+	if (tk >= 3 && !strcmp(token[1], "budget")) {
+		if (atoi(token[3]) < 1 || !world_jobs_set_budget(token[2], atoi(token[3]))) {
+			msg_print(Ind, "Usage: /jobs budget <job name> <work units per frame, at least 1>");
+			return;
+		}
+		msg_format(Ind, "Budget of job '%s' set to %d.", token[2], atoi(token[3]));
+		return;
+	}
+	world_jobs_report(Ind, tk && !strcmp(token[1], "reset"));
+}
+
+/* Show resident floor statistics (see purge_old) */
+static void sc_floors(int Ind, int tk, char **token) {
+	purge_old_report(Ind);
+}
+
+#ifdef PLAYER_VIS_ROSTER
+/* Show how many player pairs update_player() checks per frame, 'reset' to clear the statistics */
+static void sc_pvis(int Ind, int tk, char **token) {
+	if (tk && !strcmp(token[1], "reset")) player_vis_reset();
+	player_vis_report(Ind);
+}
+#endif
+
+#ifdef TIMED_OBJECT_LIST
+/* Show how many objects process_objects() visits per frame, 'reset' to clear the statistics */
+static void sc_activeobj(int Ind, int tk, char **token) {
+	if (tk && !strcmp(token[1], "reset")) object_timed_reset();
+	object_timed_report(Ind);
+}
+#endif
+
+#ifdef STORE_ITEM_POOL
+/* Show store pool/restock statistics, 'reset' to clear them, or 'check <store> [maintenances] [runs]' to compare restocking one store with and without the pool */
+static void sc_stpool(int Ind, int tk, char **token) {
+	if (tk && !strcmp(token[1], "check")) {
+		if (tk < 2) {
+			msg_print(Ind, "Usage: /stpool check <store> [maintenances (up to 10)] [runs (up to 20)]");
+			return;
+		}
+		store_restock_check(Ind, atoi(token[2]),
+		    tk >= 3 && atoi(token[3]) > 0 ? atoi(token[3]) : 10,
+		    tk >= 4 && atoi(token[4]) > 0 ? atoi(token[4]) : 10);
+		return;
+	}
+	if (tk && !strcmp(token[1], "reset")) store_pool_reset();
+	store_pool_report(Ind);
+}
+#endif
+
+#ifdef PACKET_CAPTURE
+/* Toggle capturing the traffic of a player's connection into a file, or of all new connections with 'all' */
+static void sc_capture(int Ind, int tk, char **token) {
+	int p;
+
+	if (tk && !strcmp(token[1], "all")) capture_new_connections = !capture_new_connections;
+	else if (tk) {
+		if (!(p = name_lookup_loose(Ind, token[1], FALSE, FALSE, FALSE))) return;
+		if (Conn[Players[p]->conn]->capture) capture_stop(Players[p]->conn);
+		else if (!capture_start(Players[p]->conn)) {
+			msg_format(Ind, "Couldn't start capturing %s, see the log.", Players[p]->name);
+			return;
+		}
+	}
+	capture_report(Ind);
+}
+#endif
+
+#ifdef MEM_ACCOUNTING
+/* Show live heap memory per subsystem, the top call sites with 'sites [n]', 'reset' the counters or 'dump' everything to tomenet-memory.log */
+static void sc_memacct(int Ind, int tk, char **token) {
+	if (tk && !strcmp(token[1], "sites")) mem_acct_report(Ind, tk >= 2 && atoi(token[2]) > 0 ? atoi(token[2]) : 20);
+	else if (tk && !strcmp(token[1], "dump")) {
+		mem_acct_dump(format("Requested by %s", Players[Ind]->name));
+		msg_print(Ind, "Heap accounting written to tomenet-memory.log.");
+	} else if (tk && !strcmp(token[1], "reset")) {
+		mem_acct_reset();
+		mem_acct_report(Ind, 0);
+	} else if (tk) msg_print(Ind, "Usage: /memacct [sites [n]|dump|reset]");
+	else mem_acct_report(Ind, 0);
+}
+#endif
+
+#ifdef CMD_QUEUE
+/* Show command queue intake and the queues of the playing connections, 'reset' to clear the statistics */
+static void sc_cmdq(int Ind, int tk, char **token) {
+	if (tk && !strcmp(token[1], "reset")) cmdq_reset();
+	cmdq_report(Ind);
+}
+#endif
+
+/* Compare the grid-based monster queries against a full m_list scan on your floor, or 'houses [count]' to check the house index */
+static void sc_spatial(int Ind, int tk, char **token) {
+#ifdef HOUSE_INDEX
+	if (tk && !strcmp(token[1], "houses")) {
+		house_index_bench(Ind, tk >= 2 && atoi(token[2]) > 0 ? atoi(token[2]) : num_houses);
+		return;
+	}
+#endif
+	spatial_bench(Ind, tk && atoi(token[1]) > 0 ? atoi(token[1]) : 1000);
+}
+
+static slash_cmd slash_cmds[] = {
+	{ "/script ", "/ |/lua ", SLASH_ADMIN, SCMD_SCRIPT },
+	{ "/rfe", "/cookie", SLASH_USER, SCMD_RFE },
+	{ "/bug", NULL, SLASH_USER, SCMD_BUG },
+	{ "/cough", NULL, SLASH_USER, SCMD_COUGH },
+	{ "/shout", "/sho|/yell|!/show", SLASH_USER, SCMD_SHOUT },
+	{ "/scream", "/scr|!/screen", SLASH_USER, SCMD_SCREAM },
+	{ "/sayme", "/sme", SLASH_USER, SCMD_SAYME },
+	{ "/say", NULL, SLASH_USER, SCMD_SAY },
+	{ "/whisper", "/wh|!/who", SLASH_USER, SCMD_WHISPER },
+	{ "/ignore", "/ig", SLASH_USER, SCMD_IGNORE },
+	{ "/ignchat", "/ic|/dnd", SLASH_USER, SCMD_IGNCHAT },
+	{ "/afk", NULL, SLASH_USER, SCMD_AFK },
+	{ "/page", NULL, SLASH_USER, SCMD_PAGE },
+	{ "/ppage", NULL, SLASH_USER, SCMD_PPAGE },
+	{ "/gpage", NULL, SLASH_USER, SCMD_GPAGE },
+	{ "/dispose", "/dis |=/dis|/xdis", SLASH_USER, SCMD_DISPOSE },
+	{ "/tag", "/t |=/t", SLASH_USER, SCMD_TAG },
+	{ "/untag", "/ut", SLASH_USER, SCMD_UNTAG },
+#if 0
+	{ "/cast", NULL, SLASH_USER, SCMD_CAST },
+#endif
+	{ "/bed", "/naked", SLASH_USER, SCMD_BED },
+	{ "/dress", "/dr |=/dr", SLASH_USER, SCMD_DRESS },
+	{ "/extra", "/ex |=/ex", SLASH_USER, SCMD_EXTRA },
+	{ "/time", "!/timer", SLASH_USER, SCMD_TIME },
+	{ "/refresh", "/ref", SLASH_USER, SCMD_REFRESH },
+	{ "/target", "/tar", SLASH_USER, SCMD_TARGET },
+	{ "/recall", "/rec", SLASH_USER, SCMD_RECALL },
+	{ "/less", NULL, SLASH_USER, SCMD_LESS },
+	{ "/news", NULL, SLASH_USER, SCMD_NEWS },
+	{ "/version", "/ver", SLASH_USER, SCMD_VERSION },
+	{ "/?r", NULL, SLASH_USER, SCMD_GUIDE_RACE },
+	{ "/?c", NULL, SLASH_USER, SCMD_GUIDE_CLASS },
+	{ "/?t", NULL, SLASH_USER, SCMD_GUIDE_TRAIT },
+	{ "/help", "/he|/?", SLASH_USER, SCMD_HELP },
+	{ "/guide", NULL, SLASH_USER, SCMD_GUIDE },
+	{ "/pkill", "/pk", SLASH_USER, SCMD_PKILL },
+	{ "/xorder", "/xo", SLASH_USER, SCMD_XORDER },
+	{ "/feeling", "=/fe", SLASH_USER, SCMD_FEELING },
+	{ "/monsters", "/mon", SLASH_USER, SCMD_MONSTERS },
+	{ "/autotag", "/at", SLASH_USER, SCMD_AUTOTAG },
+	{ "/houses", "/hou", SLASH_USER, SCMD_HOUSES },
+	{ "/uniques", "/uni", SLASH_USER, SCMD_UNIQUES },
+	{ "/object", "/obj", SLASH_USER, SCMD_OBJECT },
+	{ "/sip", NULL, SLASH_USER, SCMD_SIP },
+	{ "/fill", NULL, SLASH_USER, SCMD_FILL },
+	{ "/empty", "/emp", SLASH_USER, SCMD_EMPTY },
+	{ "/rip", "/tear", SLASH_USER, SCMD_RIP },
+#ifdef RPG_SERVER
+	{ "/pet", NULL, SLASH_USER, SCMD_PET },
+#endif
+	{ "/unpet", NULL, SLASH_USER, SCMD_UNPET },
+	{ "/shuffle", NULL, SLASH_USER, SCMD_SHUFFLE },
+	{ "/dealer", NULL, SLASH_USER, SCMD_DEALER },
+	{ "/deal", "/draw", SLASH_USER, SCMD_DEAL },
+	{ "/martyr", "/mar", SLASH_USER, SCMD_MARTYR },
+#if defined(ENABLE_HELLKNIGHT) || defined(ENABLE_CPRIEST)
+	{ "/sacrifice", "/sac", SLASH_USER, SCMD_SACRIFICE },
+#endif
+	{ "/embrace", "/emb", SLASH_USER, SCMD_EMBRACE },
+	{ "/pnote", NULL, SLASH_USER, SCMD_PNOTE },
+	{ "/gnote", NULL, SLASH_USER, SCMD_GNOTE },
+	{ "/snotes", "/motd", SLASH_USER, SCMD_SNOTES },
+	{ "/notes", NULL, SLASH_USER, SCMD_NOTES },
+	{ "/note", NULL, SLASH_USER, SCMD_NOTE },
+	{ "/play", "!/playgo", SLASH_USER, SCMD_PLAY },
+#ifdef FUN_SERVER
+	{ "/wish", NULL, SLASH_USER, SCMD_WISH },
+#endif
+	{ "/evinfo", NULL, SLASH_USER, SCMD_EVINFO },
+	{ "/evsign", NULL, SLASH_USER, SCMD_EVSIGN },
+	{ "/evunsign", NULL, SLASH_USER, SCMD_EVUNSIGN },
+	{ "/bbs", NULL, SLASH_USER, SCMD_BBS },
+	{ "/stime", NULL, SLASH_USER, SCMD_STIME },
+	{ "/pvp", NULL, SLASH_USER, SCMD_PVP },
+#ifdef AUCTION_SYSTEM
+	{ "/auc", "/auction", SLASH_USER, SCMD_AUC },
+#endif
+	{ "/light", "!/lightning", SLASH_USER, SCMD_LIGHT },
+	{ "/undoskills", "/undos", SLASH_USER, SCMD_UNDOSKILLS },
+	{ "/info", NULL, SLASH_USER, SCMD_INFO },
+#if 0
+	{ "/pray", NULL, SLASH_USER, SCMD_PRAY },
+#endif
+	{ "/pbbs", NULL, SLASH_USER, SCMD_PBBS },
+	{ "/gbbs", NULL, SLASH_USER, SCMD_GBBS },
+	{ "/ftkon", NULL, SLASH_USER, SCMD_FTKON },
+	{ "/ftkoff", NULL, SLASH_USER, SCMD_FTKOFF },
+	{ "/ftk", NULL, SLASH_USER, SCMD_FTK },
+	{ "/dwon", NULL, SLASH_USER, SCMD_DWON },
+	{ "/dwoff", NULL, SLASH_USER, SCMD_DWOFF },
+	{ "/dw", NULL, SLASH_USER, SCMD_DW },
+#ifdef PLAYER_STORES
+	{ "/pstore", NULL, SLASH_USER, SCMD_PSTORE },
+#endif
+#ifdef HOUSE_PAINTING
+	{ "/paint", NULL, SLASH_USER, SCMD_PAINT },
+#endif
+	{ "/knock", NULL, SLASH_USER, SCMD_KNOCK },
+	{ "/slap", NULL, SLASH_USER, SCMD_SLAP },
+	{ "/pat", NULL, SLASH_USER, SCMD_PAT },
+	{ "/hug", NULL, SLASH_USER, SCMD_HUG },
+	{ "/poke", NULL, SLASH_USER, SCMD_POKE },
+	{ "/applaud", NULL, SLASH_USER, SCMD_APPLAUD },
+	{ "/wave", NULL, SLASH_USER, SCMD_WAVE },
+	{ "/tip", NULL, SLASH_USER, SCMD_TIP },
+	{ "/guild_adder", "!/guild_adders", SLASH_USER, SCMD_GUILD_ADDER },
+	{ "/guild_cfg", NULL, SLASH_USER, SCMD_GUILD_CFG },
+	{ "/xguild_adders", "/guild_adders", SLASH_USER, SCMD_XGUILD_ADDERS },
+	{ "/testyourmight", "/tym", SLASH_USER, SCMD_TESTYOURMIGHT },
+	{ "/request_estate", "/request", SLASH_USER, SCMD_REQUEST_ESTATE },
+#ifdef ENABLE_SUBCLASS
+	{ "/subclass", "/sc", SLASH_USER, SCMD_SUBCLASS },
+#endif
+	{ "/convertexclusive", NULL, SLASH_USER, SCMD_CONVERTEXCLUSIVE },
+	{ "/pclose", NULL, SLASH_USER, SCMD_PCLOSE },
+	{ "/pquit", "/pleave", SLASH_USER, SCMD_PQUIT },
+	{ "/gquit", "/gleave", SLASH_USER, SCMD_GQUIT },
+	{ "/quit", "/exit|/leave|/logout|/bye", SLASH_USER, SCMD_QUIT },
+	{ "/suicide", "/sui|/retire|/ret", SLASH_USER, SCMD_SUICIDE },
+#ifdef ENABLE_DRACONIAN_TRAITS
+	{ "/trait", NULL, SLASH_USER, SCMD_TRAIT },
+#endif
+#ifdef AUTO_RET_CMD
+	{ "/autoretm", "/arm", SLASH_USER, SCMD_AUTORETM },
+	{ "/autoretr", "/arr", SLASH_USER, SCMD_AUTORETR },
+	{ "/autoret", "/ar", SLASH_USER, SCMD_AUTORET },
+#endif
+#ifdef ENABLE_SELF_FLASHING
+	{ "/flash", NULL, SLASH_USER, SCMD_FLASH },
+#endif
+	{ "/partymembers", NULL, SLASH_USER, SCMD_PARTYMEMBERS },
+	{ "/guildmembers", NULL, SLASH_USER, SCMD_GUILDMEMBERS },
+	{ "/snbar", NULL, SLASH_USER, SCMD_SNBAR },
+	{ "/hpbar", NULL, SLASH_USER, SCMD_HPBAR },
+	{ "/mpbar", NULL, SLASH_USER, SCMD_MPBAR },
+	{ "/stbar", NULL, SLASH_USER, SCMD_STBAR },
+	{ "/seen", NULL, SLASH_USER, SCMD_SEEN },
+	{ "/quest", "/que", SLASH_USER, SCMD_QUEST },
+	{ "/qdrop", NULL, SLASH_USER, SCMD_QDROP },
+	{ "/who", NULL, SLASH_USER, SCMD_WHO },
+	{ "/dun ", "=/dun", SLASH_USER, SCMD_DUN },
+	{ "/kifu", "/gibo", SLASH_USER, SCMD_KIFU },
+	{ "/beta", NULL, SLASH_USER, SCMD_BETA },
+	{ "/col", "/colours|/colors", SLASH_USER, SCMD_COL },
+	{ "/acol", "/acolours|/acolors", SLASH_USER, SCMD_ACOL },
+	{ "/testdisplay", NULL, SLASH_USER, SCMD_TESTDISPLAY },
+	{ "/testascii", NULL, SLASH_USER, SCMD_TESTASCII },
+	{ "/setorder", NULL, SLASH_USER, SCMD_SETORDER },
+	{ "/edmt", NULL, SLASH_USER, SCMD_EDMT },
+	{ "/setimm", NULL, SLASH_USER, SCMD_SETIMM },
+	{ "/setele", NULL, SLASH_USER, SCMD_SETELE },
+	{ "/characters", "/chars|/charlist", SLASH_USER, SCMD_CHARACTERS },
+	{ "/ing", "/ingredients", SLASH_USER, SCMD_ING },
+	{ "/forms", NULL, SLASH_USER, SCMD_FORMS },
+	{ "=/ta", NULL, SLASH_USER, SCMD_TA },
+	{ "/uptime", NULL, SLASH_USER, SCMD_UPTIME },
+#ifdef SERVER_PORTALS
+	{ "/portal", NULL, SLASH_USER, SCMD_PORTAL },
+#endif
+	{ "/split", NULL, SLASH_USER, SCMD_SPLIT },
+	{ "/rest", NULL, SLASH_USER, SCMD_REST },
+	{ "/unstow", NULL, SLASH_USER, SCMD_UNSTOW },
+	{ "/chem", NULL, SLASH_USER, SCMD_CHEM },
+	{ "/mix", NULL, SLASH_USER, SCMD_MIX },
+	{ "/kdiz", NULL, SLASH_USER, SCMD_KDIZ },
+	{ "/hlore", NULL, SLASH_USER, SCMD_HLORE },
+	{ "/newar", NULL, SLASH_USER, SCMD_NEWAR },
+	{ "/email", NULL, SLASH_USER, SCMD_EMAIL },
+	{ "/tss", NULL, SLASH_USER, SCMD_TSS },
+	{ "/timer", NULL, SLASH_USER, SCMD_TIMER },
+	{ "/val", NULL, SLASH_PRIV, SCMD_PRIV_VAL },
+	{ "/inval", NULL, SLASH_PRIV, SCMD_PRIV_INVAL },
+	{ "/linv", NULL, SLASH_PRIV, SCMD_PRIV_LINV },
+	{ "/tmp", NULL, SLASH_ADMIN, SCMD_TMP },
+#ifdef TOMENET_WORLDS
+	{ "/world", NULL, SLASH_ADMIN, SCMD_WORLD },
+	{ "/unworld", NULL, SLASH_ADMIN, SCMD_UNWORLD },
+#endif
+	{ "/shutdown", NULL, SLASH_ADMIN, SCMD_SHUTDOWN },
+	{ "/shutempty", NULL, SLASH_ADMIN, SCMD_SHUTEMPTY },
+	{ "/shutlow", NULL, SLASH_ADMIN, SCMD_SHUTLOW },
+	{ "/shutvlow", NULL, SLASH_ADMIN, SCMD_SHUTVLOW },
+	{ "/shutnone", NULL, SLASH_ADMIN, SCMD_SHUTNONE },
+	{ "/shutactivevlow", NULL, SLASH_ADMIN, SCMD_SHUTACTIVEVLOW },
+#if 0
+	{ "/shutsurface", NULL, SLASH_ADMIN, SCMD_SHUTSURFACE },
+#endif
+	{ "/shutxlow", NULL, SLASH_ADMIN, SCMD_SHUTXLOW },
+	{ "/shutxxlow", NULL, SLASH_ADMIN, SCMD_SHUTXXLOW },
+	{ "/shutulow", NULL, SLASH_ADMIN, SCMD_SHUTULOW },
+	{ "/shutrec", NULL, SLASH_ADMIN, SCMD_SHUTREC },
+	{ "/shutcancel", NULL, SLASH_ADMIN, SCMD_SHUTCANCEL },
+	{ "/val", NULL, SLASH_ADMIN, SCMD_VAL },
+	{ "/inval", NULL, SLASH_ADMIN, SCMD_INVAL },
+	{ "/privilege", NULL, SLASH_ADMIN, SCMD_PRIVILEGE },
+	{ "/vprivilege", NULL, SLASH_ADMIN, SCMD_VPRIVILEGE },
+	{ "/unprivilege", NULL, SLASH_ADMIN, SCMD_UNPRIVILEGE },
+	{ "/makeadmin", NULL, SLASH_ADMIN, SCMD_MAKEADMIN },
+	{ "/banip", NULL, SLASH_ADMIN, SCMD_BANIP },
+	{ "/ban", "/bancombo", SLASH_ADMIN, SCMD_BAN },
+	{ "/kickip", NULL, SLASH_ADMIN, SCMD_KICKIP },
+	{ "/kick", NULL, SLASH_ADMIN, SCMD_KICK },
+	{ "/viewbans", NULL, SLASH_ADMIN, SCMD_VIEWBANS },
+	{ "/unban", NULL, SLASH_ADMIN, SCMD_UNBAN },
+	{ "/mute", NULL, SLASH_ADMIN, SCMD_MUTE },
+	{ "/xmute", NULL, SLASH_ADMIN, SCMD_XMUTE },
+	{ "/unmute", NULL, SLASH_ADMIN, SCMD_UNMUTE },
+	{ "/xunmute", NULL, SLASH_ADMIN, SCMD_XUNMUTE },
+	{ "/clear-level", "/clv |=/clv|!/clver", SLASH_ADMIN, SCMD_CLEAR_LEVEL },
+	{ "/clear-items", "/cli|!/clinv", SLASH_ADMIN, SCMD_CLEAR_ITEMS },
+	{ "/clear-extra", "/xcli", SLASH_ADMIN, SCMD_CLEAR_EXTRA },
+	{ "/clear-narts", "/nacli", SLASH_ADMIN, SCMD_CLEAR_NARTS },
+	{ "/cp", NULL, SLASH_ADMIN, SCMD_CP },
+	{ "/mdelete", NULL, SLASH_ADMIN, SCMD_MDELETE },
+	{ "/geno-level", "/geno", SLASH_ADMIN, SCMD_GENO_LEVEL },
+	{ "/vanitygeno", "/vgeno", SLASH_ADMIN, SCMD_VANITYGENO },
+	{ "/mkill-level", "/mkill", SLASH_ADMIN, SCMD_MKILL_LEVEL },
+	{ "/ugeno", NULL, SLASH_ADMIN, SCMD_UGENO },
+	{ "/pandahi", NULL, SLASH_ADMIN, SCMD_PANDAHI },
+	{ "/pandabye", NULL, SLASH_ADMIN, SCMD_PANDABYE },
+	{ "/untrap", NULL, SLASH_ADMIN, SCMD_UNTRAP },
+	{ "/game", NULL, SLASH_ADMIN, SCMD_GAME },
+	{ "/unstatic-level", "/unst", SLASH_ADMIN, SCMD_UNSTATIC_LEVEL },
+	{ "/treset", NULL, SLASH_ADMIN, SCMD_TRESET },
+	{ "/static-level", "/stat", SLASH_ADMIN, SCMD_STATIC_LEVEL },
+	{ "/identify", "/id", SLASH_ADMIN, SCMD_IDENTIFY },
+	{ "/sartifact", "/sart", SLASH_ADMIN, SCMD_SARTIFACT },
+	{ "/auniques", NULL, SLASH_ADMIN, SCMD_AUNIQUES },
+	{ "/fixuniques", NULL, SLASH_ADMIN, SCMD_FIXUNIQUES },
+	{ "/aunique", NULL, SLASH_ADMIN, SCMD_AUNIQUE },
+	{ "/aunidisable", NULL, SLASH_ADMIN, SCMD_AUNIDISABLE },
+	{ "/auniunkill", NULL, SLASH_ADMIN, SCMD_AUNIUNKILL },
+	{ "/aunicheck", NULL, SLASH_ADMIN, SCMD_AUNICHECK },
+	{ "/aunifix", NULL, SLASH_ADMIN, SCMD_AUNIFIX },
+	{ "/curnumcheck", NULL, SLASH_ADMIN, SCMD_CURNUMCHECK },
+	{ "/curnumfix", NULL, SLASH_ADMIN, SCMD_CURNUMFIX },
+	{ "/reload-config", "/cfg", SLASH_ADMIN, SCMD_RELOAD_CONFIG },
+	{ "/xwish", NULL, SLASH_ADMIN, SCMD_XWISH },
+	{ "/nwish", NULL, SLASH_ADMIN, SCMD_NWISH },
+	{ "/awish", NULL, SLASH_ADMIN, SCMD_AWISH },
+	{ "/swish", NULL, SLASH_ADMIN, SCMD_SWISH },
+	{ "/trap", NULL, SLASH_ADMIN, SCMD_TRAP },
+	{ "/ctrap", NULL, SLASH_ADMIN, SCMD_CTRAP },
+	{ "/enlight", "/en", SLASH_ADMIN, SCMD_ENLIGHT },
+	{ "/wizlightx", NULL, SLASH_ADMIN, SCMD_WIZLIGHTX },
+	{ "/wizlight", NULL, SLASH_ADMIN, SCMD_WIZLIGHT },
+	{ "/wizdark", NULL, SLASH_ADMIN, SCMD_WIZDARK },
+	{ "/lr", NULL, SLASH_ADMIN, SCMD_LR },
+	{ "/la", NULL, SLASH_ADMIN, SCMD_LA },
+	{ "/equip", "/eq", SLASH_ADMIN, SCMD_EQUIP },
+	{ "/uncurse", "/unc", SLASH_ADMIN, SCMD_UNCURSE },
+	{ "/purgewild", NULL, SLASH_ADMIN, SCMD_PURGEWILD },
+	{ "/store", NULL, SLASH_ADMIN, SCMD_STORE },
+	{ "/stnew", NULL, SLASH_ADMIN, SCMD_STNEW },
+#if 0
+	{ "/cheeze", NULL, SLASH_ADMIN, SCMD_CHEEZE },
+#endif
+	{ "/log", "!/log_u", SLASH_ADMIN, SCMD_LOG },
+	{ "/linv", NULL, SLASH_ADMIN, SCMD_LINV },
+	{ "/clinv", NULL, SLASH_ADMIN, SCMD_CLINV },
+	{ "/dinv", NULL, SLASH_ADMIN, SCMD_DINV },
+	{ "/vinv", NULL, SLASH_ADMIN, SCMD_VINV },
+	{ "/respawn", NULL, SLASH_ADMIN, SCMD_RESPAWN },
+	{ "/log_u", NULL, SLASH_ADMIN, SCMD_LOG_U },
+	{ "/noarts", NULL, SLASH_ADMIN, SCMD_NOARTS },
+#if 0
+	{ "/swap-towns", NULL, SLASH_ADMIN, SCMD_SWAP_TOWNS },
+#endif
+	{ "/debug-towns", NULL, SLASH_ADMIN, SCMD_DEBUG_TOWNS },
+	{ "/move-stair", NULL, SLASH_ADMIN, SCMD_MOVE_STAIR },
+	{ "/debug-stairs", NULL, SLASH_ADMIN, SCMD_DEBUG_STAIRS },
+	{ "/debug-dun", NULL, SLASH_ADMIN, SCMD_DEBUG_DUN },
+	{ "/unlistdun", NULL, SLASH_ADMIN, SCMD_UNLISTDUN },
+	{ "/update-dun", NULL, SLASH_ADMIN, SCMD_UPDATE_DUN },
+	{ "/swap-dun", NULL, SLASH_ADMIN, SCMD_SWAP_DUN },
+	{ "/remdun", NULL, SLASH_ADMIN, SCMD_REMDUN },
+	{ "/debug-pos", NULL, SLASH_ADMIN, SCMD_DEBUG_POS },
+	{ "/forgetdun", NULL, SLASH_ADMIN, SCMD_FORGETDUN },
+	{ "/knowdun", NULL, SLASH_ADMIN, SCMD_KNOWDUN },
+	{ "/forgettown", NULL, SLASH_ADMIN, SCMD_FORGETTOWN },
+	{ "/knowtown", NULL, SLASH_ADMIN, SCMD_KNOWTOWN },
+	{ "/wlocfeat", NULL, SLASH_ADMIN, SCMD_WLOCFEAT },
+	{ "/reloadmotd", NULL, SLASH_ADMIN, SCMD_RELOADMOTD },
+	{ "/anotes", NULL, SLASH_ADMIN, SCMD_ANOTES },
+	{ "/danote", NULL, SLASH_ADMIN, SCMD_DANOTE },
+	{ "/anote", NULL, SLASH_ADMIN, SCMD_ANOTE },
+	{ "/manote", NULL, SLASH_ADMIN, SCMD_MANOTE },
+	{ "/broadcast-motd", NULL, SLASH_ADMIN, SCMD_BROADCAST_MOTD },
+	{ "/swarn", NULL, SLASH_ADMIN, SCMD_SWARN },
+	{ "/reart", NULL, SLASH_ADMIN, SCMD_REART },
+	{ "/debugart", NULL, SLASH_ADMIN, SCMD_DEBUGART },
+	{ "/reego", NULL, SLASH_ADMIN, SCMD_REEGO },
+	{ "/threaten", "/thr", SLASH_ADMIN, SCMD_THREATEN },
+	{ "/aslap", NULL, SLASH_ADMIN, SCMD_ASLAP },
+	{ "/apat", NULL, SLASH_ADMIN, SCMD_APAT },
+	{ "/ahug", NULL, SLASH_ADMIN, SCMD_AHUG },
+	{ "/apoke", NULL, SLASH_ADMIN, SCMD_APOKE },
+	{ "/strangle", NULL, SLASH_ADMIN, SCMD_STRANGLE },
+	{ "/acheer", NULL, SLASH_ADMIN, SCMD_ACHEER },
+	{ "/aapplaud", NULL, SLASH_ADMIN, SCMD_AAPPLAUD },
+	{ "/presence", NULL, SLASH_ADMIN, SCMD_PRESENCE },
+	{ "/snicker", NULL, SLASH_ADMIN, SCMD_SNICKER },
+	{ "/deltown", NULL, SLASH_ADMIN, SCMD_DELTOWN },
+	{ "/chouse", NULL, SLASH_ADMIN, SCMD_CHOUSE },
+	{ "/mblowdice", "/mbd", SLASH_ADMIN, SCMD_MBLOWDICE },
+	{ "/crash", NULL, SLASH_ADMIN, SCMD_CRASH },
+	{ "/citychown", NULL, SLASH_ADMIN, SCMD_CITYCHOWN },
+	{ "/fixchown", NULL, SLASH_ADMIN, SCMD_FIXCHOWN },
+	{ "/listhouses", NULL, SLASH_ADMIN, SCMD_LISTHOUSES },
+	{ "/polyhouses", NULL, SLASH_ADMIN, SCMD_POLYHOUSES },
+	{ "/pyhpdbg", NULL, SLASH_ADMIN, SCMD_PYHPDBG },
+	{ "/rollchar", NULL, SLASH_ADMIN, SCMD_ROLLCHAR },
+	{ "/roll!char", NULL, SLASH_ADMIN, SCMD_ROLL_CHAR },
+	{ "/rollhistory", NULL, SLASH_ADMIN, SCMD_ROLLHISTORY },
+	{ "/checkhistory", NULL, SLASH_ADMIN, SCMD_CHECKHISTORY },
+	{ "/vxp", NULL, SLASH_ADMIN, SCMD_VXP },
+	{ "/everhouse", NULL, SLASH_ADMIN, SCMD_EVERHOUSE },
+	{ "/blink", NULL, SLASH_ADMIN, SCMD_BLINK },
+	{ "/tport", NULL, SLASH_ADMIN, SCMD_TPORT },
+	{ "/tptar", NULL, SLASH_ADMIN, SCMD_TPTAR },
+	{ "/tpto", "/tpat", SLASH_ADMIN, SCMD_TPTO },
+	{ "/loc", "/locate|!/locateart", SLASH_ADMIN, SCMD_LOC },
+	{ "/strathash", NULL, SLASH_ADMIN, SCMD_STRATHASH },
+	{ "/stratmap", NULL, SLASH_ADMIN, SCMD_STRATMAP },
+	{ "/strat", NULL, SLASH_ADMIN, SCMD_STRAT },
+	{ "/wipewild", NULL, SLASH_ADMIN, SCMD_WIPEWILD },
+	{ "/findarts", NULL, SLASH_ADMIN, SCMD_FINDARTS },
+	{ "/locateart", "/eraseart", SLASH_ADMIN, SCMD_LOCATEART },
+	{ "/debug-store", NULL, SLASH_ADMIN, SCMD_DEBUG_STORE },
+	{ "/acclist", NULL, SLASH_ADMIN, SCMD_ACCLIST },
+	{ "/characc", NULL, SLASH_ADMIN, SCMD_CHARACC },
+	{ "/changeacc", NULL, SLASH_ADMIN, SCMD_CHANGEACC },
+	{ "/addnewdun", NULL, SLASH_ADMIN, SCMD_ADDNEWDUN },
+	{ "/loadmap", NULL, SLASH_ADMIN, SCMD_LOADMAP },
+	{ "/lloadmap", NULL, SLASH_ADMIN, SCMD_LLOADMAP },
+	{ "/lqm", NULL, SLASH_ADMIN, SCMD_LQM },
+	{ "/minvcheck", NULL, SLASH_ADMIN, SCMD_MINVCHECK },
+	{ "/rmnothing", NULL, SLASH_ADMIN, SCMD_RMNOTHING },
+#ifdef BACKTRACE_NOTHINGS
+	{ "/backtrace", NULL, SLASH_ADMIN, SCMD_BACKTRACE },
+#endif
+	{ "/erasechar", NULL, SLASH_ADMIN, SCMD_ERASECHAR },
+	{ "/renamechar", NULL, SLASH_ADMIN, SCMD_RENAMECHAR },
+	{ "/checkexpir", NULL, SLASH_ADMIN, SCMD_CHECKEXPIR },
+	{ "/gestart", NULL, SLASH_ADMIN, SCMD_GESTART },
+	{ "/gestop", NULL, SLASH_ADMIN, SCMD_GESTOP },
+	{ "/gepause", NULL, SLASH_ADMIN, SCMD_GEPAUSE },
+	{ "/geretime", NULL, SLASH_ADMIN, SCMD_GERETIME },
+	{ "/gefforward", NULL, SLASH_ADMIN, SCMD_GEFFORWARD },
+	{ "/gesign", NULL, SLASH_ADMIN, SCMD_GESIGN },
+	{ "/contbuf", NULL, SLASH_ADMIN, SCMD_CONTBUF },
+	{ "/partydebug", NULL, SLASH_ADMIN, SCMD_PARTYDEBUG },
+	{ "/guilddebug", NULL, SLASH_ADMIN, SCMD_GUILDDEBUG },
+	{ "/partyclean", NULL, SLASH_ADMIN, SCMD_PARTYCLEAN },
+	{ "/partymodefix", NULL, SLASH_ADMIN, SCMD_PARTYMODEFIX },
+	{ "/partymemberfix", NULL, SLASH_ADMIN, SCMD_PARTYMEMBERFIX },
+	{ "/partydelete", NULL, SLASH_ADMIN, SCMD_PARTYDELETE },
+	{ "/guildmodefix", NULL, SLASH_ADMIN, SCMD_GUILDMODEFIX },
+	{ "/guildmemberfix", NULL, SLASH_ADMIN, SCMD_GUILDMEMBERFIX },
+	{ "/guildrename", NULL, SLASH_ADMIN, SCMD_GUILDRENAME },
+	{ "/meta", NULL, SLASH_ADMIN, SCMD_META },
+	{ "/highscorereset", NULL, SLASH_ADMIN, SCMD_HIGHSCORERESET },
+	{ "/highscorerm", NULL, SLASH_ADMIN, SCMD_HIGHSCORERM },
+	{ "/highscorecv", NULL, SLASH_ADMIN, SCMD_HIGHSCORECV },
+	{ "/rem", NULL, SLASH_ADMIN, SCMD_REM },
+	{ "/mcarry", NULL, SLASH_ADMIN, SCMD_MCARRY },
+	{ "/mcustomxp", NULL, SLASH_ADMIN, SCMD_MCUSTOMXP },
+	{ "/unown", "!/unownhou", SLASH_ADMIN, SCMD_UNOWN },
+	{ "/erasehashtableid", NULL, SLASH_ADMIN, SCMD_ERASEHASHTABLEID },
+	{ "/olistcheck", NULL, SLASH_ADMIN, SCMD_OLISTCHECK },
+	{ "/floorcheck", NULL, SLASH_ADMIN, SCMD_FLOORCHECK },
+	{ "/floorfix", NULL, SLASH_ADMIN, SCMD_FLOORFIX },
+	{ "/dbbs", NULL, SLASH_ADMIN, SCMD_DBBS },
+	{ "/ebbs", NULL, SLASH_ADMIN, SCMD_EBBS },
+	{ "/reward", NULL, SLASH_ADMIN, SCMD_REWARD },
+	{ "/debug1", NULL, SLASH_ADMIN, SCMD_DEBUG1 },
+	{ "/debug2", NULL, SLASH_ADMIN, SCMD_DEBUG2 },
+	{ "/daynight", NULL, SLASH_ADMIN, SCMD_DAYNIGHT },
+	{ "/season", NULL, SLASH_ADMIN, SCMD_SEASON },
+	{ "/weather", NULL, SLASH_ADMIN, SCMD_WEATHER },
+	{ "/cweather", "/cw", SLASH_ADMIN, SCMD_CWEATHER },
+	{ "/jokeweather", NULL, SLASH_ADMIN, SCMD_JOKEWEATHER },
+	{ "/fireworks", NULL, SLASH_ADMIN, SCMD_FIREWORKS },
+	{ "/lightning", NULL, SLASH_ADMIN, SCMD_LIGHTNING },
+	{ "/hostilities", NULL, SLASH_ADMIN, SCMD_HOSTILITIES },
+	{ "/mkhostile", NULL, SLASH_ADMIN, SCMD_MKHOSTILE },
+	{ "/mkpeace", NULL, SLASH_ADMIN, SCMD_MKPEACE },
+	{ "/debugstore", NULL, SLASH_ADMIN, SCMD_DEBUGSTORE },
+	{ "/kstore", NULL, SLASH_ADMIN, SCMD_KSTORE },
+	{ "/costs", NULL, SLASH_ADMIN, SCMD_COSTS },
+#if 0
+	{ "/unbreak", NULL, SLASH_ADMIN, SCMD_UNBREAK },
+#endif
+	{ "/debugdate", NULL, SLASH_ADMIN, SCMD_DEBUGDATE },
+	{ "/ocopy", NULL, SLASH_ADMIN, SCMD_OCOPY },
+	{ "/fixskills", NULL, SLASH_ADMIN, SCMD_FIXSKILLS },
+	{ "/debugitemremovalhouse", NULL, SLASH_ADMIN, SCMD_DEBUGITEMREMOVALHOUSE },
+	{ "/purgeitemremovalnever", NULL, SLASH_ADMIN, SCMD_PURGEITEMREMOVALNEVER },
+	{ "/testchat", NULL, SLASH_ADMIN, SCMD_TESTCHAT },
+	{ "/initlua", NULL, SLASH_ADMIN, SCMD_INITLUA },
+	{ "/reinitarrays", NULL, SLASH_ADMIN, SCMD_REINITARRAYS },
+	{ "/bench", NULL, SLASH_ADMIN, SCMD_BENCH },
+	{ "/pings", NULL, SLASH_ADMIN, SCMD_PINGS },
+	{ "/dmpriv", NULL, SLASH_ADMIN, SCMD_DMPRIV },
+	{ "/un-id", NULL, SLASH_ADMIN, SCMD_UN_ID },
+	{ "/unkw", NULL, SLASH_ADMIN, SCMD_UNKW },
+	{ "/curse", NULL, SLASH_ADMIN, SCMD_CURSE },
+	{ "/uncurse", NULL, SLASH_ADMIN, SCMD_UNCURSE2 },
+	{ "/ai", NULL, SLASH_ADMIN, SCMD_AI },
+#ifdef USE_SOUND_2010
+	{ "/hmus", NULL, SLASH_ADMIN, SCMD_HMUS },
+	{ "/psfx", NULL, SLASH_ADMIN, SCMD_PSFX },
+	{ "/wthunder", NULL, SLASH_ADMIN, SCMD_WTHUNDER },
+	{ "/pmus", NULL, SLASH_ADMIN, SCMD_PMUS },
+	{ "/pvmus", NULL, SLASH_ADMIN, SCMD_PVMUS },
+	{ "/ppmus", NULL, SLASH_ADMIN, SCMD_PPMUS },
+#endif
+#if defined(CLIENT_SIDE_WEATHER) && !defined(CLIENT_WEATHER_GLOBAL)
+	{ "/towea", NULL, SLASH_ADMIN, SCMD_TOWEA },
+#endif
+	{ "/screenflash", NULL, SLASH_ADMIN, SCMD_SCREENFLASH },
+	{ "/madart", NULL, SLASH_ADMIN, SCMD_MADART },
+	{ "/measureart", NULL, SLASH_ADMIN, SCMD_MEASUREART },
+	{ "/debug-grid", NULL, SLASH_ADMIN, SCMD_DEBUG_GRID },
+	{ "/seasonvars", NULL, SLASH_ADMIN, SCMD_SEASONVARS },
+	{ "/debug-wild", NULL, SLASH_ADMIN, SCMD_DEBUG_WILD },
+	{ "/fix-wildflock", NULL, SLASH_ADMIN, SCMD_FIX_WILDFLOCK },
+	{ "/fix-house-modes", NULL, SLASH_ADMIN, SCMD_FIX_HOUSE_MODES },
+#ifdef TEST_SERVER
+	{ "/testreqs", NULL, SLASH_ADMIN, SCMD_TESTREQS },
+#endif
+	{ "/update-leg", NULL, SLASH_ADMIN, SCMD_UPDATE_LEG },
+	{ "/deepdivestats", NULL, SLASH_ADMIN, SCMD_DEEPDIVESTATS },
+	{ "/deepdivefix", NULL, SLASH_ADMIN, SCMD_DEEPDIVEFIX },
+	{ "/deepdivereset", NULL, SLASH_ADMIN, SCMD_DEEPDIVERESET },
+	{ "/lsl", "/lsls|/lslsu", SLASH_ADMIN, SCMD_LSL },
+	{ "/fixguild", NULL, SLASH_ADMIN, SCMD_FIXGUILD },
+#ifdef DUNGEON_VISIT_BONUS
+	{ "/debugdvb", NULL, SLASH_ADMIN, SCMD_DEBUGDVB },
+	{ "/reindexdvb", NULL, SLASH_ADMIN, SCMD_REINDEXDVB },
+#endif
+	{ "/debug-house", NULL, SLASH_ADMIN, SCMD_DEBUG_HOUSE },
+	{ "/debugmd", NULL, SLASH_ADMIN, SCMD_DEBUGMD },
+	{ "/fixmd", NULL, SLASH_ADMIN, SCMD_FIXMD },
+	{ "/wipemd", NULL, SLASH_ADMIN, SCMD_WIPEMD },
+	{ "/fix!md", NULL, SLASH_ADMIN, SCMD_FIX_MD },
+	{ "/fixcondmd", NULL, SLASH_ADMIN, SCMD_FIXCONDMD },
+	{ "/fixjaildun", NULL, SLASH_ADMIN, SCMD_FIXJAILDUN },
+	{ "/fixiddc", NULL, SLASH_ADMIN, SCMD_FIXIDDC },
+	{ "/fix2iddc", NULL, SLASH_ADMIN, SCMD_FIX2IDDC },
+	{ "/dunmkexp", NULL, SLASH_ADMIN, SCMD_DUNMKEXP },
+	{ "/terminate", NULL, SLASH_ADMIN, SCMD_TERMINATE },
+	{ "/backup_estate", NULL, SLASH_ADMIN, SCMD_BACKUP_ESTATE },
+	{ "/backup_one_estate", NULL, SLASH_ADMIN, SCMD_BACKUP_ONE_ESTATE },
+	{ "/backup_char_estate", NULL, SLASH_ADMIN, SCMD_BACKUP_CHAR_ESTATE },
+	{ "/backup_acclists", NULL, SLASH_ADMIN, SCMD_BACKUP_ACCLISTS },
+	{ "/restore_acclists", NULL, SLASH_ADMIN, SCMD_RESTORE_ACCLISTS },
+#ifdef CLIENT_SIDE_WEATHER
+ #ifndef CLIENT_WEATHER_GLOBAL
+	{ "/mkcloud", NULL, SLASH_ADMIN, SCMD_MKCLOUD },
+	{ "/rmcloud", NULL, SLASH_ADMIN, SCMD_RMCLOUD },
+	{ "/lscloud", NULL, SLASH_ADMIN, SCMD_LSCLOUD },
+ #endif
+#endif
+	{ "/tovalinor", NULL, SLASH_ADMIN, SCMD_TOVALINOR },
+#ifdef IRONDEEPDIVE_MIXED_TYPES
+	{ "/riddc", "/liddc", SLASH_ADMIN, SCMD_RIDDC },
+#endif
+	{ "/allrec", NULL, SLASH_ADMIN, SCMD_ALLREC },
+	{ "/fixartowners1", NULL, SLASH_ADMIN, SCMD_FIXARTOWNERS1 },
+	{ "/fixartowners2", NULL, SLASH_ADMIN, SCMD_FIXARTOWNERS2 },
+	{ "/fixarttimeout", NULL, SLASH_ADMIN, SCMD_FIXARTTIMEOUT },
+	{ "/mtrack", NULL, SLASH_ADMIN, SCMD_MTRACK },
+	{ "/fixhash", NULL, SLASH_ADMIN, SCMD_FIXHASH },
+	{ "/charlaston", NULL, SLASH_ADMIN, SCMD_CHARLASTON },
+	{ "/testrandart", NULL, SLASH_ADMIN, SCMD_TESTRANDART },
+	{ "/moditem", NULL, SLASH_ADMIN, SCMD_MODITEM },
+	{ "/qinf", NULL, SLASH_ADMIN, SCMD_QINF },
+	{ "/qsize", NULL, SLASH_ADMIN, SCMD_QSIZE },
+	{ "/qinv", NULL, SLASH_ADMIN, SCMD_QINV },
+	{ "/qaquest", "/qaq", SLASH_ADMIN, SCMD_QAQUEST },
+	{ "/qccd", NULL, SLASH_ADMIN, SCMD_QCCD },
+	{ "/qpriv", NULL, SLASH_ADMIN, SCMD_QPRIV },
+	{ "/qdis", NULL, SLASH_ADMIN, SCMD_QDIS },
+	{ "/qena", NULL, SLASH_ADMIN, SCMD_QENA },
+	{ "/qstart", NULL, SLASH_ADMIN, SCMD_QSTART },
+	{ "/qstop", NULL, SLASH_ADMIN, SCMD_QSTOP },
+	{ "/qstage", NULL, SLASH_ADMIN, SCMD_QSTAGE },
+	{ "/qfx", NULL, SLASH_ADMIN, SCMD_QFX },
+	{ "/debugfloor", NULL, SLASH_ADMIN, SCMD_DEBUGFLOOR },
+	{ "/reservednames", NULL, SLASH_ADMIN, SCMD_RESERVEDNAMES },
+	{ "/addreservedname", NULL, SLASH_ADMIN, SCMD_ADDRESERVEDNAME },
+	{ "/delreservedname", NULL, SLASH_ADMIN, SCMD_DELRESERVEDNAME },
+	{ "/purgeaccountfile", NULL, SLASH_ADMIN, SCMD_PURGEACCOUNTFILE },
+	{ "/ap", "!/apat|!/app", SLASH_ADMIN, SCMD_AP },
+	{ "/app", "!/appla", SLASH_ADMIN, SCMD_APP },
+	{ "/ahl", NULL, SLASH_ADMIN, SCMD_AHL },
+	{ "/optrhoused", NULL, SLASH_ADMIN, SCMD_OPTRHOUSED },
+	{ "/destroyhouse", NULL, SLASH_ADMIN, SCMD_DESTROYHOUSE },
+	{ "/unownhouse", NULL, SLASH_ADMIN, SCMD_UNOWNHOUSE },
+	{ "/rest1", NULL, SLASH_ADMIN, SCMD_REST1 },
+	{ "/ambient", NULL, SLASH_ADMIN, SCMD_AMBIENT },
+#ifdef MONSTER_ASTAR
+	{ "/rsastar", NULL, SLASH_ADMIN, SCMD_RSASTAR },
+#endif
+	{ "/xid", NULL, SLASH_ADMIN, SCMD_XID },
+	{ "/fontmapr", NULL, SLASH_ADMIN, SCMD_FONTMAPR },
+	{ "/fontmapf", NULL, SLASH_ADMIN, SCMD_FONTMAPF },
+	{ "/tp", NULL, SLASH_ADMIN, SCMD_TP },
+	{ "/debugvars", NULL, SLASH_ADMIN, SCMD_DEBUGVARS },
+#ifdef ENABLE_MERCHANT_MAIL
+	{ "/mgmail", NULL, SLASH_ADMIN, SCMD_MGMAIL },
+	{ "/rmgmail", NULL, SLASH_ADMIN, SCMD_RMGMAIL },
+#endif
+#ifdef EXTENDED_COLOURS_PALANIM
+	{ "/setpalette", NULL, SLASH_ADMIN, SCMD_SETPALETTE },
+	{ "/set2pal", NULL, SLASH_ADMIN, SCMD_SET2PAL },
+#endif
+	{ "/settime", NULL, SLASH_ADMIN, SCMD_SETTIME },
+	{ "/turnspeed", NULL, SLASH_ADMIN, SCMD_TURNSPEED },
+	{ "/turnsextra", NULL, SLASH_ADMIN, SCMD_TURNSEXTRA },
+	{ "/setaorder", NULL, SLASH_ADMIN, SCMD_SETAORDER },
+	{ "/initorder", NULL, SLASH_ADMIN, SCMD_INITORDER },
+	{ "/accountorder", NULL, SLASH_ADMIN, SCMD_ACCOUNTORDER },
+	{ "/zeroorder", NULL, SLASH_ADMIN, SCMD_ZEROORDER },
+	{ "/showaccountorder", NULL, SLASH_ADMIN, SCMD_SHOWACCOUNTORDER },
+	{ "/score", NULL, SLASH_ADMIN, SCMD_SCORE },
+	{ "/chkpump", NULL, SLASH_ADMIN, SCMD_CHKPUMP },
+	{ "/pversion", "/pver", SLASH_ADMIN, SCMD_PVERSION },
+	{ "/testmisc1", NULL, SLASH_ADMIN, SCMD_TESTMISC1 },
+	{ "/testmisc2", NULL, SLASH_ADMIN, SCMD_TESTMISC2 },
+	{ "/invfill", NULL, SLASH_ADMIN, SCMD_INVFILL },
+	{ "/geo", NULL, SLASH_ADMIN, SCMD_GEO },
+	{ "/ping", NULL, SLASH_ADMIN, SCMD_PING },
+	{ "/clver", NULL, SLASH_ADMIN, SCMD_CLVER },
+#ifdef EQUIPMENT_SET_BONUS
+	{ "/chkset", NULL, SLASH_ADMIN, SCMD_CHKSET },
+#endif
+	{ "/reorder", NULL, SLASH_ADMIN, SCMD_REORDER },
+	{ "/exportpstores", NULL, SLASH_ADMIN, SCMD_EXPORTPSTORES },
+	{ "/gettradhouseitems", NULL, SLASH_ADMIN, SCMD_GETTRADHOUSEITEMS },
+	{ "/tohou", NULL, SLASH_ADMIN, SCMD_TOHOU },
+	{ "/mushroomfields", NULL, SLASH_ADMIN, SCMD_MUSHROOMFIELDS },
+	{ "/cyclewild", NULL, SLASH_ADMIN, SCMD_CYCLEWILD },
+	{ "/food", NULL, SLASH_ADMIN, SCMD_FOOD },
+	{ "/pstat", NULL, SLASH_ADMIN, SCMD_PSTAT },
+	{ "/prmap", NULL, SLASH_ADMIN, SCMD_PRMAP },
+	{ "/sflags", NULL, SLASH_ADMIN, SCMD_SFLAGS },
+	{ "/mego", NULL, SLASH_ADMIN, SCMD_MEGO },
+	{ "/invcur", NULL, SLASH_ADMIN, SCMD_INVCUR },
+	{ "/revcur", NULL, SLASH_ADMIN, SCMD_REVCUR },
+	{ "/rspumpkin", NULL, SLASH_ADMIN, SCMD_RSPUMPKIN },
+#ifdef ENABLE_SUBINVEN
+	{ "/dbgsi", NULL, SLASH_ADMIN, SCMD_DBGSI },
+#endif
+#ifdef SERVER_PORTALS
+	{ "/relog", NULL, SLASH_ADMIN, SCMD_RELOG },
+#endif
+	{ "/ondepth", NULL, SLASH_ADMIN, SCMD_ONDEPTH },
+	{ "/relocatechar", "/relocchar|/relchar", SLASH_ADMIN, SCMD_RELOCATECHAR },
+	{ "/dbgmon", NULL, SLASH_ADMIN, SCMD_DBGMON },
+	{ "/setfeat", NULL, SLASH_ADMIN, SCMD_SETFEAT },
+#ifdef ENABLE_GO_GAME
+	{ "/gogameup", NULL, SLASH_ADMIN, SCMD_GOGAMEUP },
+	{ "/gogamedown", NULL, SLASH_ADMIN, SCMD_GOGAMEDOWN },
+	{ "/gogamestatus", NULL, SLASH_ADMIN, SCMD_GOGAMESTATUS },
+#endif
+	{ "/printturnspeeds", NULL, SLASH_ADMIN, SCMD_PRINTTURNSPEEDS },
+	{ "/debug-drops-freq", NULL, SLASH_ADMIN, SCMD_DEBUG_DROPS_FREQ },
+	{ "/slashcmds", "/slashhelp", SLASH_ADMIN, SCMD_NONE, 0, sc_slashcmds, "List the commands in the slash command table" },
+	{ "/slashbench", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_slashbench, "Time command lookups, optionally for [count] iterations" },
+#ifdef LOS_CACHE
+	{ "/loscache", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_loscache, "[on|off|verify|reset] LOS cache statistics" },
+#endif
+#ifdef MON_NUM_CACHE
+	{ "/cachemon", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_cachemon, "[on|off|flush|reset|check <level> <dlevel> [dungeon type] [samples]|bench <level> [count]] Monster selection cache" },
+#endif
+#ifdef OBJ_NUM_CACHE
+	{ "/cacheobj", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_cacheobj, "[on|off|flush|reset|check [count]|bench [count]] Object selection cache" },
+#endif
+#ifdef OBJECT_DESC_CACHE
+	{ "/cachedesc", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_cachedesc, "[on|off|flush|reset|check on|off|bench [count]] Object description cache" },
+#endif
+	{ "/boni", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_boni, "[reset|on|off|check on|off|bench [count]] calc_boni() statistics and equipment slot cache" },
+	{ "/jobs", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_jobs, "[reset|budget <job> <n>] Cost and lateness of the world jobs" },
+	{ "/floors", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_floors, "Resident floor statistics" },
+#ifdef PLAYER_VIS_ROSTER
+	{ "/pvis", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_pvis, "[reset] Player pairs checked by update_player()" },
+#endif
+#ifdef TIMED_OBJECT_LIST
+	{ "/activeobj", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_activeobj, "[reset] Objects visited by process_objects()" },
+#endif
+#ifdef STORE_ITEM_POOL
+	{ "/stpool", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_stpool, "[reset|check <store> [maintenances] [runs]] Store item pools" },
+#endif
+#ifdef PACKET_CAPTURE
+	{ "/capture", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_capture, "[<character>|all] Toggle capturing a connection's traffic (see tomenet.loadgen -D)" },
+#endif
+#ifdef MEM_ACCOUNTING
+	{ "/memacct", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_memacct, "[sites [n]|dump|reset] Live heap memory per subsystem or call site" },
+#endif
+#ifdef CMD_QUEUE
+	{ "/cmdq", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_cmdq, "[reset] Command queue intake, stalls and floods" },
+#endif
+	{ "/spatial", NULL, SLASH_ADMIN, SCMD_NONE, 0, sc_spatial, "[count|houses [count]] Check the grid-based monster queries and the house index" },
+};
+#define SLASH_CMDS	((int)(sizeof(slash_cmds) / sizeof(slash_cmd)))
+
+static bool slash_cmd_visible(slash_cmd *sc, bool admin, bool privileged) {
+	switch (sc->access) {
+	case SLASH_PRIV: return(!admin && privileged);
+	case SLASH_ADMIN: return(admin);
+	}
+	return(TRUE);
+}
+
+/* Character trie over all names and aliases (without the '/'), node 0 is the root, 0 also means 'none' for links */
+typedef struct slash_node slash_node;
+struct slash_node {
+	char c;
+	s16b child, sibling;
+	s16b key;
+};
+/* A name ending at a trie node: table entry, '=', '!' or 0, next name ending there or -1 */
+typedef struct slash_key slash_key;
+struct slash_key {
+	s16b cmd;
+	char mode;
+	s16b next;
+};
+static slash_node *slash_trie = NULL;
+static slash_key *slash_keys = NULL;
+static int slash_trie_num = 0, slash_keys_num = 0;
+
+static void slash_trie_add(cptr name, int idx) {
+	int n = 0, m, k;
+	char mode = 0;
+
+	if (*name == '=' || *name == '!') mode = *name++;
+	for (name++; *name; name++) {
+		for (m = slash_trie[n].child; m && slash_trie[m].c != *name; m = slash_trie[m].sibling);
+		if (!m) {
+			m = slash_trie_num++;
+			slash_trie[m].c = *name;
+			slash_trie[m].child = 0;
+			slash_trie[m].sibling = slash_trie[n].child;
+			slash_trie[m].key = -1;
+			slash_trie[n].child = m;
+		}
+		n = m;
+	}
+
+	k = slash_keys_num++;
+	slash_keys[k].cmd = idx;
+	slash_keys[k].mode = mode;
+	slash_keys[k].next = slash_trie[n].key;
+	slash_trie[n].key = k;
+}
+
+static void slash_trie_build(void) {
+	char buf[MAX_CHARS];
+	int i, len = 1, num = 0;
+	cptr a;
+	char *b;
+
+	for (i = 0; i < SLASH_CMDS; i++) {
+		len += strlen(slash_cmds[i].name);
+		num++;
+		if (!(a = slash_cmds[i].aliases)) continue;
+		len += strlen(a);
+		while (*a) if (*a++ == '|') num++;
+		num++;
+	}
+	C_MAKE(slash_trie, len, slash_node);
+	C_MAKE(slash_keys, num, slash_key);
+	slash_trie_num = 1;
+	slash_trie[0].key = -1;
+
+	for (i = 0; i < SLASH_CMDS; i++) {
+		slash_trie_add(slash_cmds[i].name, i);
+		if (!(a = slash_cmds[i].aliases)) continue;
+		while (*a) {
+			for (b = buf; *a && *a != '|'; ) *b++ = *a++;
+			*b = 0;
+			if (*a) a++;
+			slash_trie_add(buf, i);
+		}
+	}
+}
+
+/* Find the table entry for a lower-cased command line, or NULL */
+#define SLASH_MATCH_MAX	64
+static slash_cmd *slash_cmd_find(cptr msg, bool admin, bool privileged) {
+	s16b cand[SLASH_MATCH_MAX], excl[SLASH_MATCH_MAX];
+	int n = 0, k, i, c, best = -1, ncand = 0, nexcl = 0;
+
+	if (!slash_trie) slash_trie_build();
+
+	/* Collect the entries with a name that the line starts with, and the ones it rules out */
+	for (msg++; *msg; msg++) {
+		for (n = slash_trie[n].child; n && slash_trie[n].c != *msg; n = slash_trie[n].sibling);
+		if (!n) break;
+		for (k = slash_trie[n].key; k != -1; k = slash_keys[k].next) {
+			if (slash_keys[k].mode == '!') {
+				if (nexcl < SLASH_MATCH_MAX) excl[nexcl++] = slash_keys[k].cmd;
+			} else if (slash_keys[k].mode != '=' || !msg[1]) {
+				if (ncand < SLASH_MATCH_MAX) cand[ncand++] = slash_keys[k].cmd;
+			}
+		}
+	}
+
+	for (i = 0; i < ncand; i++) {
+		c = cand[i];
+		if (best != -1 && c >= best) continue;
+		if (!slash_cmd_visible(&slash_cmds[c], admin, privileged)) continue;
+		for (k = 0; k < nexcl && excl[k] != c; k++);
+		if (k == nexcl) best = c;
+	}
+	return(best == -1 ? NULL : &slash_cmds[best]);
+}
+
+/* 1 if the line matches one of the '|'-separated names, -1 if one of them rules it out */
+static int slash_names_match(cptr a, cptr msg) {
+	char buf[MAX_CHARS];
+	char *b;
+	int hit = 0;
+
+	while (a && *a) {
+		for (b = buf; *a && *a != '|'; ) *b++ = *a++;
+		*b = 0;
+		if (*a) a++;
+		switch (buf[0]) {
+		case '!': if (prefix(msg, buf + 1)) return(-1);
+			break;
+		case '=': if (!strcmp(msg, buf + 1)) hit = 1;
+			break;
+		default: if (prefix(msg, buf)) hit = 1;
+		}
+	}
+	return(hit);
+}
+
+/* The same lookup done the way the old prefix() chain did it, entry by entry */
+static slash_cmd *slash_cmd_scan(cptr msg, bool admin, bool privileged) {
+	int i, a, b;
+
+	for (i = 0; i < SLASH_CMDS; i++) {
+		if (!slash_cmd_visible(&slash_cmds[i], admin, privileged)) continue;
+		a = slash_names_match(slash_cmds[i].name, msg);
+		b = slash_names_match(slash_cmds[i].aliases, msg);
+		if (a != -1 && b != -1 && (a || b)) return(&slash_cmds[i]);
+	}
+	return(NULL);
+}
+
+static void sc_slashcmds(int Ind, int tk, char **token) {
+	int i, n = 0;
+
+	for (i = 0; i < SLASH_CMDS; i++) {
+		if (tk && !strstr(slash_cmds[i].name, token[1])) continue;
+		msg_format(Ind, "  \377%c%s\377w%s%s%s %s",
+		    slash_cmds[i].access == SLASH_ADMIN ? 'y' : (slash_cmds[i].access == SLASH_PRIV ? 'B' : 'w'), slash_cmds[i].name,
+		    slash_cmds[i].aliases ? " (" : "", slash_cmds[i].aliases ? slash_cmds[i].aliases : "", slash_cmds[i].aliases ? ")" : "",
+		    slash_cmds[i].help ? slash_cmds[i].help : "");
+		n++;
+	}
+	msg_format(Ind, "\377w%d of %d commands in the slash command table.", n, SLASH_CMDS);
+}
+
+static long slash_usec(struct timeval *tv0) {
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return((tv.tv_sec - tv0->tv_sec) * 1000000L + (tv.tv_usec - tv0->tv_usec));
+}
+
+/* A line that finds table entry i, or NULL if other entries always win */
+static cptr slash_bench_line(int i) {
+	cptr name = slash_cmds[i].name;
+
+	if (*name == '=') name++;
+	if (*name == '!' || slash_cmd_find(name, slash_cmds[i].access == SLASH_ADMIN, slash_cmds[i].access == SLASH_PRIV) != &slash_cmds[i]) return(NULL);
+	return(name);
+}
+
+static void sc_slashbench(int Ind, int tk, char **token) {
+	int count = tk && atoi(token[1]) > 0 ? atoi(token[1]) : 100000, i, e, pick[3], num = 0, bad = 0, lines = 0, v;
+	cptr what[3] = { "first", "middle", "last" }, name;
+	char msg[MAX_SLASH_LINE_LEN], msg_u[MAX_SLASH_LINE_LEN];
+	struct timeval tv0;
+	long t_trie, t_scan, t_chain;
+	u32b found = 0, tried = 0;
+	bool admin, priv;
+
+	/* Check the trie against the entry by entry scan for every name, alone and with an argument */
+	for (i = 0; i < SLASH_CMDS; i++) {
+		for (e = 0; e < 2; e++) {
+			cptr a = e ? slash_cmds[i].aliases : slash_cmds[i].name;
+			char *b;
+
+			while (a && *a) {
+				for (b = msg; *a && *a != '|'; ) *b++ = *a++;
+				*b = 0;
+				if (*a) a++;
+				if (*msg == '=' || *msg == '!') memmove(msg, msg + 1, strlen(msg));
+				for (v = 0; v < 6; v++) {
+					admin = v & 1;
+					priv = (v & 2) != 0;
+					if (v & 4) strcat(msg, " 1");
+					lines++;
+					if (slash_cmd_find(msg, admin, priv) != slash_cmd_scan(msg, admin, priv)) bad++;
+					if (v & 4) msg[strlen(msg) - 2] = 0;
+				}
+			}
+		}
+	}
+	msg_format(Ind, "Checked %d lines: %s%d lookups differ from the prefix() scan.", lines, bad ? "\377r" : "\377G", bad);
+
+	/* The first, middle and last commands of the old prefix() chain */
+	for (i = 0; i < SLASH_CMDS; i++) if (slash_cmds[i].id != SCMD_NONE) num = i + 1;
+	for (pick[0] = 0; pick[0] < num - 1 && !slash_bench_line(pick[0]); pick[0]++);
+	for (pick[1] = num / 2; pick[1] < num - 1 && !slash_bench_line(pick[1]); pick[1]++);
+	for (pick[2] = num - 1; pick[2] > 0 && !slash_bench_line(pick[2]); pick[2]--);
+
+	msg_format(Ind, "Slash command lookup, %d lookups each (ns per lookup):", count);
+	for (e = 0; e < 3; e++) {
+		if (!(name = slash_bench_line(pick[e]))) continue;
+		admin = slash_cmds[pick[e]].access == SLASH_ADMIN;
+		priv = slash_cmds[pick[e]].access == SLASH_PRIV;
+
+		gettimeofday(&tv0, NULL);
+		for (i = 0; i < count; i++) if (slash_cmd_find(name, admin, priv)) found++;
+		t_trie = slash_usec(&tv0);
+
+		gettimeofday(&tv0, NULL);
+		for (i = 0; i < count; i++) if (slash_cmd_scan(name, admin, priv)) found++;
+		t_scan = slash_usec(&tv0);
+		tried += count * 2;
+
+		msg_format(Ind, "  %-6s %3d %-18s trie %5ld, prefix() scan %6ld",
+		    what[e], pick[e], name, (t_trie * 1000) / count, (t_scan * 1000) / count);
+		s_printf("SLASHBENCH: %s #%d %s: trie %ld ns, scan %ld ns\n", what[e], pick[e], name, (t_trie * 1000) / count, (t_scan * 1000) / count);
+	}
+	if (found != tried) msg_format(Ind, "\377rLookups failed: %u of %u found.", found, tried);
+
+	/* What an unknown command costs in do_slash_cmd() */
+	slash_dry_run = TRUE;
+	gettimeofday(&tv0, NULL);
+	for (i = 0; i < count / 10 + 1; i++) {
+		strcpy(msg, "/~bench");
+		strcpy(msg_u, msg);
+		do_slash_cmd(Ind, msg, msg_u);
+	}
+	t_chain = slash_usec(&tv0);
+	slash_dry_run = FALSE;
+	msg_format(Ind, "  unknown command through do_slash_cmd(): %ld ns", (t_chain * 1000) / (count / 10 + 1));
+}
+
 /*
  * Slash commands - huge hack function for command expansion.
  *
@@ -336,6 +1524,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 	char *colon, *token[9];
 	char message2[MAX_SLASH_LINE_LEN], message3[MAX_SLASH_LINE_LEN], message4[MAX_SLASH_LINE_LEN];
 	char messagelc[MAX_SLASH_LINE_LEN];
+	slash_cmd *sc;
 
 	worldpos wp;
 	bool admin = is_admin(p_ptr);
@@ -384,11 +1573,11 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 	i = 0;
 	while (messagelc[++i]) messagelc[i] = tolower(messagelc[i]);
 
+	sc = slash_cmd_find(messagelc, admin, p_ptr->privileged);
 
 	/* hack -- non-token ones first */
-	if ((prefix(messagelc, "/script ") ||
-	    prefix(messagelc, "/ ") ||	// use with care! ("//" is client-side equivalent)
-	    prefix(messagelc, "/lua ")) && admin) {
+	if (sc && sc->id < SCMD_TOKENIZED) switch (sc->id) {
+	case SCMD_SCRIPT: { // use with care! ("//" is client-side equivalent)
 		if (colon)
 			master_script_exec(Ind, colon);
 		else
@@ -396,14 +1585,14 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 
 		return;
 	}
-	else if ((prefix(messagelc, "/rfe")) || prefix(messagelc, "/cookie")) {
+	case SCMD_RFE: {
 		if (colon) {
 			rfe_printf("RFE %s [%s]%s\n", compacttime(), p_ptr->accountname, colon_u); //'>_>
 			msg_print(Ind, "\377GThank you for sending us a message!");
 		} else msg_print(Ind, "\377oUsage: /rfe <message>");
 		return;
 	}
-	else if (prefix(messagelc, "/bug")) {
+	case SCMD_BUG: {
 		if (colon) {
 			rfe_printf("BUG %s [%s]%s\n", compacttime(), p_ptr->accountname, colon_u);
 			msg_print(Ind, "\377GThank you for sending us a message!");
@@ -411,7 +1600,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		return;
 	}
 	/* Oops conflict; took 'never duplicate' principal */
-	else if (prefix(messagelc, "/cough")) {
+	case SCMD_COUGH: {
 	    /// count || prefix(messagelc, "/cou"))
 		if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
 			msg_print(Ind, "\377yYou cannot cough while you cannot move.");
@@ -424,7 +1613,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		wakeup_monsters_somewhat(Ind, -1);
 		return;
 	}
-	else if (prefix(messagelc, "/shout") || (prefix(messagelc, "/sho") && !prefix(messagelc, "/show")) || prefix(messagelc, "/yell")) {
+	case SCMD_SHOUT: {
 		if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
 			msg_print(Ind, "\377yYou cannot shout while you cannot move.");
 			return;
@@ -452,7 +1641,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		wakeup_monsters(Ind, -1);
 		return;
 	}
-	else if (prefix(messagelc, "/scream") || (prefix(messagelc, "/scr") && !prefix(messagelc, "/screen"))) {
+	case SCMD_SCREAM: {
 		if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
 			msg_print(Ind, "\377yYou cannot scream while you cannot move.");
 			return;
@@ -471,7 +1660,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		return;
 	}
 	/* RPG-style talking to people who are nearby, instead of global chat. - C. Blue */
-	else if (prefix(messagelc, "/sayme") || prefix(messagelc, "/sme")) {
+	case SCMD_SAYME: {
 		if (!colon++) {
 			//msg_format_near(Ind, "\374\377%c%s clears %s throat.", COLOUR_CHAT, p_ptr->name, p_ptr->male ? "his" : "her");
 			//msg_format(Ind, "\374\377%cYou clear your throat.", COLOUR_CHAT);
@@ -490,7 +1679,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		return;
 // :)		break_cloaking(Ind, 3);
 	}
-	else if (prefix(messagelc, "/say")) { // || (prefix(messagelc, "/s ") || !strcmp(message, "/s"))) { -- changed short form to stow-command
+	case SCMD_SAY: { // || (prefix(messagelc, "/s ") || !strcmp(message, "/s"))) { -- changed short form to stow-command
 		if (colon++) {
 			colon_u++;
 			msg_print_near2(Ind, format("\374\377%c%^s says: %s", COLOUR_CHAT, p_ptr->name, colon), format("\374\377%c%^s says: %s", COLOUR_CHAT, p_ptr->name, colon_u));
@@ -502,7 +1691,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		return;
 // :)		break_cloaking(Ind, 3);
 	}
-	else if (prefix(messagelc, "/whisper") || (prefix(messagelc, "/wh") && !prefix(messagelc, "/who"))) {
+	case SCMD_WHISPER: {
 		if (colon++) {
 			colon_u++;
 			msg_print_verynear2(Ind, format("\374\377%c%^s whispers: %s", COLOUR_CHAT, p_ptr->name, colon), format("\374\377%c%^s whispers: %s", COLOUR_CHAT, p_ptr->name, colon_u));
@@ -512,8 +1701,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		return;
 // :)		break_cloaking(Ind, 3);
 	}
-
-	else {
+	} else {
 		/* cut tokens off (thx Asclep(DEG)) */
 		if ((token[0] = strtok(message, " "))) {
 //			s_printf("%d : %s", tk, token[0]);
@@ -525,18 +1713,233 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 		}
 
-		/* Default to no search string */
-		//strcpy(search, "");
-
-		/* Form a search string if we found a colon */
-		if (tk) k = atoi(token[1]);
+		/* Default to no search string */
+		//strcpy(search, "");
+
+		/* Form a search string if we found a colon */
+		if (tk) k = atoi(token[1]);
+
+		/* These test the case-sensitive line or a digit, so they can't be table entries */
+		if ((prefix(messagelc, "/dice") ||
+		    !strcmp(messagelc, "/d") || (prefix(messagelc, "/d") && isdigit(messagelc[2])) ||
+		    prefix(messagelc, "/roll") || !strcmp(message, "/r") ||
+		    prefix(messagelc, "/die"))
+		    && !prefix(messagelc, "/rollchar")) {
+			int rn = 0, first_digit, s = 6;
+			char *d;
+
+			if (p_ptr->body_monster) {
+				monster_race *r_ptr = &r_info[p_ptr->body_monster];
+				/* be nice to bats: they only have arms */
+				if (!(r_ptr->body_parts[BODY_WEAPON] || r_ptr->body_parts[BODY_FINGER] || r_ptr->body_parts[BODY_ARMS])) {
+					msg_print(Ind, "You cannot roll dice in your current form.");
+					return;
+				}
+			}
+
+			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
+				msg_print(Ind, "\377yYou cannot roll dice while you cannot move.");
+				return;
+			}
+
+			if (!strcmp(message, "/d") || !strcmp(message, "/r")) k = 2;
+			else if (!strcmp(message, "/die")) {
+				if (tk) {
+					token[1][0] = tolower(token[1][0]);
+					if (token[1][0]) token[1][1] = tolower(token[1][1]);
+
+					if (token[1][0] == 'd') s = atoi(&token[1][1]);
+					else s = k;
+					if ((s < 1) || (s > 100)) {
+						msg_print(Ind, "\377oNumber of sides must be between 1 and 100!");
+						return;
+					}
+				}
+				k = 1;
+			} else if (prefix(messagelc, "/d") && isdigit(messagelc[2])) {
+				k = 1;
+				s = atoi(messagelc + 2);
+				if ((s < 1) || (s > 100)) {
+					msg_print(Ind, "\377oNumber of sides must be between 1 and 100!");
+					return;
+				}
+			} else {
+				if (tk < 1) {
+					msg_print(Ind, "\377oUsage:     /dice <number of dice>");
+					msg_print(Ind, "\377oUsage #2:  /dice <number of dice>d<number of sides>");
+					msg_print(Ind, "\377oUsage #3:  /dice d<number of sides>");
+					msg_print(Ind, "\377oVariant to throw a single die:     /die");
+					msg_print(Ind, "\377oVariant to throw a single die #2:  /die <number of sides>");
+					msg_print(Ind, "\377oShortcut to throw 2 6-sided dice:  /d");
+					return;
+				}
+
+				token[1][0] = tolower(token[1][0]);
+				if (token[1][0]) token[1][1] = tolower(token[1][1]);
+
+				if (token[1][0] == 'd') {
+					k = 1;
+					s = atoi(&token[1][1]);
+				} else if ((d = strchr(token[1], 'd'))) s = atoi(d + 1);
+
+				if ((k < 1) || (k > 100)) {
+					msg_print(Ind, "\377oNumber of dice must be between 1 and 100!");
+					return;
+				}
+				if ((s < 1) || (s > 100)) {
+					msg_print(Ind, "\377oNumber of sides must be between 1 and 100!");
+					return;
+				}
+			}
+
+			p_ptr->energy -= level_speed(&p_ptr->wpos);
+
+			for (i = 0; i < k; i++) rn += randint(s);
+			first_digit = rn;
+			while (first_digit >= 10) first_digit /= 10;
+
+			if (s == 6) {
+				if (k == 1) {
+					msg_format(Ind, "\374\377%cYou cast a die and get a%s \377%c%d", COLOUR_GAMBLE, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
+					msg_format_near(Ind, "\374\377%c%s casts a die and gets a%s \377%c%d", COLOUR_GAMBLE, p_ptr->name, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
+				} else {
+					msg_format(Ind, "\374\377%cYou cast \377%c%d\377- dice and get a%s \377%c%d", COLOUR_GAMBLE, COLOUR_GAMBLE_RESULT, k, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
+					msg_format_near(Ind, "\374\377%c%s casts \377%c%d\377- dice and gets a%s \377%c%d", COLOUR_GAMBLE, p_ptr->name, COLOUR_GAMBLE_RESULT, k, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
+				}
+			} else {
+				if (k == 1) {
+					msg_format(Ind, "\374\377%cYou cast a \377%cD%d\377- and get a%s \377%c%d", COLOUR_GAMBLE, COLOUR_GAMBLE_RESULT, s, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
+					msg_format_near(Ind, "\374\377%c%s casts a \377%cD%d\377- and gets a%s \377%c%d", COLOUR_GAMBLE, p_ptr->name, COLOUR_GAMBLE_RESULT, s, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
+				} else {
+					msg_format(Ind, "\374\377%cYou cast \377%c%dD%d\377- and get a%s \377%c%d", COLOUR_GAMBLE, COLOUR_GAMBLE_RESULT, k, s, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
+					msg_format_near(Ind, "\374\377%c%s casts \377%c%dD%d\377- and gets a%s \377%c%d", COLOUR_GAMBLE, p_ptr->name, COLOUR_GAMBLE_RESULT, k, s, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
+				}
+			}
+			s_printf("Game: Dice - %s rolls %dd%d -> %d.\n", p_ptr->name, k, s, rn);
+#ifdef USE_SOUND_2010
+			sound(Ind, "dice_roll", NULL, SFX_TYPE_MISC, TRUE);
+#endif
+			return;
+		}
+		else if (prefix(messagelc, "/coin") || prefix(messagelc, "/flip") || !strcmp(message, "/f")) {
+			bool coin;
+
+			if (!p_ptr->au) {
+				msg_print(Ind, "You don't have any coins.");
+				return;
+			}
+			if (p_ptr->body_monster) {
+				monster_race *r_ptr = &r_info[p_ptr->body_monster];
+				/* be nice to bats: they only have arms */
+				if (!(r_ptr->body_parts[BODY_WEAPON] || r_ptr->body_parts[BODY_FINGER] || r_ptr->body_parts[BODY_ARMS])) {
+					msg_print(Ind, "You cannot catch coins in your current form.");
+					return;
+				}
+			}
+
+			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
+				msg_print(Ind, "\377yYou cannot flip coins while you cannot move.");
+				return;
+			}
+			p_ptr->energy -= level_speed(&p_ptr->wpos);
+
+			coin = (rand_int(2) == 0);
+
+			msg_format(Ind, "\374\377%cYou flip a coin and get %s", COLOUR_GAMBLE, coin ? "heads" : "tails");
+			msg_format_near(Ind, "\374\377%c%s flips a coin and gets %s", COLOUR_GAMBLE, p_ptr->name, coin ? "heads" : "tails");
+			s_printf("Game: Flip - %s gets %s.\n", p_ptr->name, coin ? "heads" : "tails");
+#ifdef USE_SOUND_2010
+			sound(Ind, "coin_flip", NULL, SFX_TYPE_MISC, TRUE);
+#endif
+			return;
+		}
+		else if (prefix(messagelc, "/stow") || (prefix(messagelc, "/s ") || !strcmp(message, "/s"))) { // (short form used to be for /say)
+			/* Stow all items from inventory that can be stowed into bags that are available, optionally only into a specific bag. */
+			#define STOW_QUIET FALSE
+			object_type *o_ptr;
+			int start, stop, bags = 0;
+			bool any = FALSE, free_space = FALSE;
+#ifdef SUBINVEN_LIMIT_GROUP
+			int prev_type = -1, t;
+#endif
+
+			/* need to specify one parm: the potion used for colouring */
+			if (strstr(message3, "help") || message3[0] == '?') {
+				msg_print(Ind, "\377oUsage:     /stow [<inventory slot>]");
+				msg_print(Ind, "\377oExample 1: /stow");
+				msg_print(Ind, "\377oExample 2: /stow a");
+				return;
+			}
+
+			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
+				msg_print(Ind, "\377yYou cannot stow items while you cannot move.");
+				return;
+			}
+
+			if (tk) {
+				if (message3[0] == '+') {
+					if (p_ptr->item_newest >= 0) k = p_ptr->item_newest;
+					else return;
+				} else if ((k = a2slot(Ind, token[1][0], 0, TRUE, FALSE)) == -1) return;
+
+				o_ptr = &p_ptr->inventory[k];
+				if (!o_ptr->tval || o_ptr->tval != TV_SUBINVEN) {
+					msg_format(Ind, "Inventory item '%c)' is not a valid container.", token[1][0]);
+					return;
+				}
+
+				if (p_ptr->subinventory[k][o_ptr->bpval - 1].tval) { /* uh, ensure maybe that all tval are nulled, not just the one of the first empty bag slot... */
+					msg_format(Ind, "It is already full!");
+					return;
+				}
+
+				start = stop = k;
+			} else {
+				start = 0;
+				stop = INVEN_PACK - 1;
+			}
+
+			for (i = start; i <= stop; i++) {
+				o_ptr = &p_ptr->inventory[i];
+				if (o_ptr->tval != TV_SUBINVEN) break;
+				bags++;
+
+				t = get_subinven_group(o_ptr->sval);
+#ifdef SUBINVEN_LIMIT_GROUP
+				if (t == prev_type) continue; /* This assumes that subinvens are sorted by svals, which is true for all inventory items actually. */
+				prev_type = t;
+#endif
+
+				if (!p_ptr->subinventory[i][o_ptr->bpval - 1].tval) free_space = TRUE;
+				any = do_cmd_subinven_fill(Ind, i, STOW_QUIET) || any; /* FALSE for "You have..." item messages, TRUE for quiet op */
+			}
+			if (!bags) msg_print(Ind, "You possess no container items.");
+			else if (!free_space) {
+				if (start == stop || bags == 1) msg_print(Ind, "Your container has no free space.");
+				else msg_print(Ind, "Your containers have no free space.");
+			} else if (!any) {
+				if (start == stop) msg_print(Ind, "No eligible item found to stow into that container.");
+				else msg_print(Ind, "No items could be stowed into your containers.");
+			} else if (STOW_QUIET)
+				msg_print(Ind, "You stowed something.");
+			return;
+		}
+
+		/* Table commands that have a handler function */
+		if (sc && sc->func) {
+			if (slash_dry_run) return;
+			if (tk < sc->minargs) msg_format(Ind, "\377oUsage: %s %s", sc->name, sc->help);
+			else sc->func(Ind, tk, token);
+			return;
+		}
 
 		/* User commands */
-		if (prefix(messagelc, "/ignore") || prefix(messagelc, "/ig")) {
+		if (sc && sc->access == SLASH_USER) switch (sc->id) {
+		case SCMD_IGNORE: {
 			add_ignore(Ind, token[1]);
 			return;
 		}
-		if (prefix(messagelc, "/ignchat") || prefix(messagelc, "/ic") || prefix(messagelc, "/dnd")) {
+		case SCMD_IGNCHAT: {
 			bool dnd = prefix(messagelc, "/dnd");
 			bool prv = (tk && token[1][0] == '*') || dnd;
 
@@ -557,7 +1960,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/afk")) {
+		case SCMD_AFK: {
 			if (strlen(message2 + 4) > 0)
 			    toggle_afk(Ind, message2 + 5);
 			else
@@ -565,7 +1968,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 
-		else if (prefix(messagelc, "/page")) {
+		case SCMD_PAGE: {
 			int p;
 
 //spam?			s_printf("(%s) SLASH_PAGE: %s:%s.\n", showtime(), p_ptr->name, message3);
@@ -604,7 +2007,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 
-		else if (prefix(messagelc, "/ppage")) {
+		case SCMD_PPAGE: {
 			if (!p_ptr->party) {
 				msg_print(Ind, "You must be in a party to use this command.");
 				return;
@@ -614,7 +2017,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			else msg_print(Ind, "\377WYou will no longer be paged when a party member logs on.");
 			return;
 		}
-		else if (prefix(messagelc, "/gpage")) {
+		case SCMD_GPAGE: {
 			if (!p_ptr->guild) {
 				msg_print(Ind, "You must be in a guild to use this command.");
 				return;
@@ -626,7 +2029,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 
 		/* Semi-auto item destroyer */
-		else if ((prefix(messagelc, "/dispose")) || (prefix(messagelc, "/dis") && (messagelc[4] == ' ' || !messagelc[4])) || prefix(messagelc, "/xdis")) {
+		case SCMD_DISPOSE: {
 			/* Note: '/xdis' is just for future backward compatibility of auto_pickup. */
 			object_type *o_ptr;
 			u32b f1, f2, f3, f4, f5, f6, esp;
@@ -930,8 +2333,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 
 		/* add inscription to everything */
-		else if (prefix(messagelc, "/tag") ||
-		    prefix(messagelc, "/t ") || (prefix(messagelc, "/t") && !message[2])) {
+		case SCMD_TAG: {
 			object_type *o_ptr;
 
 			char powins[POW_INSCR_LEN];
@@ -1071,7 +2473,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		/* remove specific inscription.
 		   If '*' is given, all pseudo-id tags are removed,
 		   if no parameter is given, '!k' is the default. */
-		else if (prefix(messagelc, "/untag") || prefix(messagelc, "/ut")) {
+		case SCMD_UNTAG: {
 			object_type *o_ptr;
 			//cptr ax = token[1] ? token[1] : "!k";
 			cptr ax = tk ? message3 : "!k";
@@ -1176,7 +2578,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 #if 0 /* new '/cast' version below this one - C. Blue (also would need a proper energy+packetrequeue check!) */
 		/* '/cast' code is written by Asclep(DEG). thx! */
-		else if (prefix(messagelc, "/cast")) {
+		case SCMD_CAST: {
 			msg_print(Ind, "\377oSorry, /cast is not available for the time being.");
  #if 0 // TODO: make that work without dependance on CLASS_
 			int book, whichplayer, whichspell;
@@ -1289,7 +2691,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 #if 0
 		/* cast a spell by name, instead of book/position (todo: needs a proper energy+packetrequeue check!) */
-		else if (prefix(messagelc, "/cast")) {
+		case SCMD_CAST: {
 			/* Paralyzed/k.o.? */
 			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
 				msg_print(Ind, "\377yYou cannot cast while you cannot move.");
@@ -1306,7 +2708,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 #endif
 		/* Take everything off */
-		else if ((prefix(messagelc, "/bed")) || prefix(messagelc, "/naked")) {
+		case SCMD_BED: {
 			byte start = INVEN_WIELD, end = INVEN_TOTAL;
 			object_type *o_ptr;
 
@@ -1345,7 +2747,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 
 		/* Try to wield everything */
-		else if (prefix(messagelc, "/dress") || prefix(messagelc, "/dr ") || !strcmp(messagelc, "/dr")) {
+		case SCMD_DRESS: {
 		    //&& !prefix(messagelc, "/draw") && !prefix(messagelc, "/dri"))) { /* there is no /drink command, but anyway, it might confuse people if they try to /drink! */
 			object_type *o_ptr;
 			bool gauche = FALSE;
@@ -1475,20 +2877,20 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 		/* Display extra information */
-		else if (prefix(messagelc, "/extra") || (prefix(messagelc, "/ex") && (messagelc[3] == ' ' || !messagelc[3]))) {
+		case SCMD_EXTRA: {
 			do_cmd_check_extra_info(Ind, (admin && !tk));
 			return;
 		}
-		else if (prefix(messagelc, "/time") && !prefix(messagelc, "/timer")) {
+		case SCMD_TIME: {
 			do_cmd_time(Ind);
 			return;
 		}
 		/* Please add here anything you think is needed.  */
-		else if ((prefix(messagelc, "/refresh")) || prefix(messagelc, "/ref")) {
+		case SCMD_REFRESH: {
 			do_cmd_refresh(Ind);
 			return;
 		}
-		else if ((prefix(messagelc, "/target")) || prefix(messagelc, "/tar")) {
+		case SCMD_TARGET: {
 			int tx, ty;
 
 			/* Clear the target */
@@ -1518,7 +2920,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 		/* Now this command is opened for everyone */
-		else if (prefix(messagelc, "/recall") || prefix(messagelc, "/rec")) {
+		case SCMD_RECALL: {
 //#define R_REQUIRES_AWARE /* Item can only be used for '@R' inscription if we're aware of its flavour? */
 			int good_match_found = 0;
 			char const *candidate_destination;
@@ -1912,7 +3314,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 		/* TODO: remove &7 viewer commands */
 		/* view RFE file or any other files in lib/data. */
-		else if (prefix(messagelc, "/less"))  {
+		case SCMD_LESS: {
 			char path[MAX_PATH_LENGTH];
 
 			if (tk && is_admin(p_ptr)) {
@@ -1934,27 +3336,27 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			else msg_print(Ind, "\377o/less is not opened for use...");
 			return;
 		}
-		else if (prefix(messagelc, "/news"))  {
+		case SCMD_NEWS: {
 			char path[MAX_PATH_LENGTH];
 
 			path_build(path, MAX_PATH_LENGTH, ANGBAND_DIR_TEXT, "news.txt");
 			do_cmd_check_other_prepare(Ind, path, "News");
 			return;
 		}
-		else if (prefix(messagelc, "/version") || prefix(messagelc, "/ver")) {
+		case SCMD_VERSION: {
 			if (tk) do_cmd_check_server_settings(Ind);
 			else msg_print(Ind, longVersion);
 			return;
 		}
-		else if (prefix(messagelc, "/?r")) { /* guide chapter search for our race */
+		case SCMD_GUIDE_RACE: { /* guide chapter search for our race */
 			Send_Guide(Ind, 3, 0, race_info[p_ptr->prace].title);
 			return;
 		}
-		else if (prefix(messagelc, "/?c")) { /* guide chapter search for our class */
+		case SCMD_GUIDE_CLASS: { /* guide chapter search for our class */
 			Send_Guide(Ind, 3, 0, class_info[p_ptr->pclass].title);
 			return;
 		}
-		else if (prefix(messagelc, "/?t")) { /* guide chapter search for our trait */
+		case SCMD_GUIDE_TRAIT: { /* guide chapter search for our trait */
 			if (!p_ptr->ptrait) {
 				msg_print(Ind, "You don't have a specific trait.");
 				return;
@@ -1968,7 +3370,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			else msg_print(Ind, "There is no specific information about your trait."); //paranoia
 			return;
 		}
-		else if (prefix(messagelc, "/help") || prefix(messagelc, "/he") || prefix(messagelc, "/?")) {
+		case SCMD_HELP: {
 			char path[MAX_PATH_LENGTH];
 
 #if 0 /* done client-side instead */
@@ -2053,7 +3455,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 			return;
 		}
-		else if (prefix(messagelc, "/guide")) {
+		case SCMD_GUIDE: {
 			msg_print(Ind, "\374--------------------------------------------------------------------------------");
 			msg_print(Ind, "\374\377s The TomeNET guide is available in three places:");
 			msg_print(Ind, "\374 1) On the TomeNET website where you can search it online or download it.");
@@ -2064,12 +3466,13 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			msg_print(Ind, "\374\377s TomeNET folder, or run the TomeNET-updater to do this for you automatically.");
 			msg_print(Ind, "\374--------------------------------------------------------------------------------");
 			return;
-		} else if (prefix(messagelc, "/pkill") || prefix(messagelc, "/pk")) {
+		}
+		case SCMD_PKILL: {
 			set_pkill(Ind, admin ? 10 : 200);
 			return;
 		}
 		/* TODO: move it to the Mayor's house */
-		else if (prefix(messagelc, "/xorder") || prefix(messagelc, "/xo")) {
+		case SCMD_XORDER: {
 			j = Ind; //k=0;
 			u16b r, num;
 			int lev;
@@ -2133,7 +3536,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				add_xorder(Ind, j, r, num, flags);
 			return;
 		}
-		else if (prefix(messagelc, "/feeling") || !strcmp(messagelc, "/fe")) {
+		case SCMD_FEELING: {
 			cave_type **zcave = getcave(&p_ptr->wpos);
 			bool no_tele = FALSE;
 
@@ -2142,8 +3545,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			if (no_tele) msg_print(Ind, "\377DThe air in here feels very still.");
 			return;
 		}
-		else if (prefix(messagelc, "/monsters") ||	/* syntax: /mon [<char>] [+minlev] */
-		    prefix(messagelc, "/mon")) {
+		case SCMD_MONSTERS: { /* syntax: /mon [<char>] [+minlev] */
 			int r_idx, num, numf;
 			monster_race *r_ptr;
 
@@ -2206,7 +3608,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 		/* add inscription to books */
-		else if (prefix(messagelc, "/autotag") || prefix(messagelc, "/at")) {
+		case SCMD_AUTOTAG: {
 			object_type *o_ptr;
 
 			for (i = 0; i < INVEN_PACK; i++) {
@@ -2217,7 +3619,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			p_ptr->window |= (PW_INVEN);// | PW_EQUIP);
 			return;
 		}
-		else if (prefix(messagelc, "/houses") || prefix(messagelc, "/hou")) {
+		case SCMD_HOUSES: {
 			/* /hou [o][l] to only show the houses we actually own/that are actually here/both */
 			bool local = FALSE, own = FALSE;
 			char *c = NULL;
@@ -2252,7 +3654,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			do_cmd_show_houses(Ind, local, own, id);
 			return;
 		}
-		else if (prefix(messagelc, "/uniques") || prefix(messagelc, "/uni")) {
+		case SCMD_UNIQUES: {
 			char *c = NULL;
 			int tInd = 0, choice = 0;
 
@@ -2285,7 +3687,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			else do_cmd_check_uniques(tInd, 0, "", choice, Ind);
 			return;
 		}
-		else if (prefix(messagelc, "/object") || prefix(messagelc, "/obj")) {
+		case SCMD_OBJECT: {
 			if (!tk) {
 				do_cmd_show_known_item_letter(Ind, NULL);
 				return;
@@ -2296,7 +3698,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/sip")) {
+		case SCMD_SIP: {
 			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
 				msg_print(Ind, "\377yYou cannot drink from a fountain while you cannot move.");
 				return;
@@ -2305,7 +3707,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			do_cmd_drink_fountain(Ind);
 			return;
 		}
-		else if (prefix(messagelc, "/fill")) {
+		case SCMD_FILL: {
 			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
 				msg_print(Ind, "\377yYou cannot fill bottles while you cannot move.");
 				return;
@@ -2314,7 +3716,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			do_cmd_fill_bottle(Ind, -1);
 			return;
 		}
-		else if (prefix(messagelc, "/empty") || prefix(messagelc, "/emp")) {
+		case SCMD_EMPTY: {
 			if (!tk) {
 				msg_print(Ind, "\377oUsage: /empty <inventory slot letter|+>");
 				return;
@@ -2333,7 +3735,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			do_cmd_empty_potion(Ind, k);
 			return;
 		}
-		else if (prefix(messagelc, "/rip") || prefix(messagelc, "/tear")) { //tear cloth into bandages
+		case SCMD_RIP: { //tear cloth into bandages
 			if (!tk) {
 				msg_print(Ind, "\377oUsage: /rip <inventory slot letter|+>");
 				return;
@@ -2352,143 +3754,10 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			do_cmd_rip_cloth(Ind, k);
 			return;
 		}
-		else if ((prefix(messagelc, "/dice") ||
-		    !strcmp(messagelc, "/d") || (prefix(messagelc, "/d") && isdigit(messagelc[2])) ||
-		    prefix(messagelc, "/roll") || !strcmp(message, "/r") ||
-		    prefix(messagelc, "/die"))
-		    && !prefix(messagelc, "/rollchar")) {
-			int rn = 0, first_digit, s = 6;
-			char *d;
-
-			if (p_ptr->body_monster) {
-				monster_race *r_ptr = &r_info[p_ptr->body_monster];
-				/* be nice to bats: they only have arms */
-				if (!(r_ptr->body_parts[BODY_WEAPON] || r_ptr->body_parts[BODY_FINGER] || r_ptr->body_parts[BODY_ARMS])) {
-					msg_print(Ind, "You cannot roll dice in your current form.");
-					return;
-				}
-			}
-
-			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
-				msg_print(Ind, "\377yYou cannot roll dice while you cannot move.");
-				return;
-			}
-
-			if (!strcmp(message, "/d") || !strcmp(message, "/r")) k = 2;
-			else if (!strcmp(message, "/die")) {
-				if (tk) {
-					token[1][0] = tolower(token[1][0]);
-					if (token[1][0]) token[1][1] = tolower(token[1][1]);
-
-					if (token[1][0] == 'd') s = atoi(&token[1][1]);
-					else s = k;
-					if ((s < 1) || (s > 100)) {
-						msg_print(Ind, "\377oNumber of sides must be between 1 and 100!");
-						return;
-					}
-				}
-				k = 1;
-			} else if (prefix(messagelc, "/d") && isdigit(messagelc[2])) {
-				k = 1;
-				s = atoi(messagelc + 2);
-				if ((s < 1) || (s > 100)) {
-					msg_print(Ind, "\377oNumber of sides must be between 1 and 100!");
-					return;
-				}
-			} else {
-				if (tk < 1) {
-					msg_print(Ind, "\377oUsage:     /dice <number of dice>");
-					msg_print(Ind, "\377oUsage #2:  /dice <number of dice>d<number of sides>");
-					msg_print(Ind, "\377oUsage #3:  /dice d<number of sides>");
-					msg_print(Ind, "\377oVariant to throw a single die:     /die");
-					msg_print(Ind, "\377oVariant to throw a single die #2:  /die <number of sides>");
-					msg_print(Ind, "\377oShortcut to throw 2 6-sided dice:  /d");
-					return;
-				}
-
-				token[1][0] = tolower(token[1][0]);
-				if (token[1][0]) token[1][1] = tolower(token[1][1]);
-
-				if (token[1][0] == 'd') {
-					k = 1;
-					s = atoi(&token[1][1]);
-				} else if ((d = strchr(token[1], 'd'))) s = atoi(d + 1);
-
-				if ((k < 1) || (k > 100)) {
-					msg_print(Ind, "\377oNumber of dice must be between 1 and 100!");
-					return;
-				}
-				if ((s < 1) || (s > 100)) {
-					msg_print(Ind, "\377oNumber of sides must be between 1 and 100!");
-					return;
-				}
-			}
-
-			p_ptr->energy -= level_speed(&p_ptr->wpos);
-
-			for (i = 0; i < k; i++) rn += randint(s);
-			first_digit = rn;
-			while (first_digit >= 10) first_digit /= 10;
-
-			if (s == 6) {
-				if (k == 1) {
-					msg_format(Ind, "\374\377%cYou cast a die and get a%s \377%c%d", COLOUR_GAMBLE, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
-					msg_format_near(Ind, "\374\377%c%s casts a die and gets a%s \377%c%d", COLOUR_GAMBLE, p_ptr->name, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
-				} else {
-					msg_format(Ind, "\374\377%cYou cast \377%c%d\377- dice and get a%s \377%c%d", COLOUR_GAMBLE, COLOUR_GAMBLE_RESULT, k, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
-					msg_format_near(Ind, "\374\377%c%s casts \377%c%d\377- dice and gets a%s \377%c%d", COLOUR_GAMBLE, p_ptr->name, COLOUR_GAMBLE_RESULT, k, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
-				}
-			} else {
-				if (k == 1) {
-					msg_format(Ind, "\374\377%cYou cast a \377%cD%d\377- and get a%s \377%c%d", COLOUR_GAMBLE, COLOUR_GAMBLE_RESULT, s, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
-					msg_format_near(Ind, "\374\377%c%s casts a \377%cD%d\377- and gets a%s \377%c%d", COLOUR_GAMBLE, p_ptr->name, COLOUR_GAMBLE_RESULT, s, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
-				} else {
-					msg_format(Ind, "\374\377%cYou cast \377%c%dD%d\377- and get a%s \377%c%d", COLOUR_GAMBLE, COLOUR_GAMBLE_RESULT, k, s, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
-					msg_format_near(Ind, "\374\377%c%s casts \377%c%dD%d\377- and gets a%s \377%c%d", COLOUR_GAMBLE, p_ptr->name, COLOUR_GAMBLE_RESULT, k, s, (first_digit == 8 || rn == 11 || rn == 18) ? "n" : "", COLOUR_GAMBLE_RESULT, rn);
-				}
-			}
-			s_printf("Game: Dice - %s rolls %dd%d -> %d.\n", p_ptr->name, k, s, rn);
-#ifdef USE_SOUND_2010
-			sound(Ind, "dice_roll", NULL, SFX_TYPE_MISC, TRUE);
-#endif
-			return;
-		}
-		else if (prefix(messagelc, "/coin") || prefix(messagelc, "/flip") || !strcmp(message, "/f")) {
-			bool coin;
-
-			if (!p_ptr->au) {
-				msg_print(Ind, "You don't have any coins.");
-				return;
-			}
-			if (p_ptr->body_monster) {
-				monster_race *r_ptr = &r_info[p_ptr->body_monster];
-				/* be nice to bats: they only have arms */
-				if (!(r_ptr->body_parts[BODY_WEAPON] || r_ptr->body_parts[BODY_FINGER] || r_ptr->body_parts[BODY_ARMS])) {
-					msg_print(Ind, "You cannot catch coins in your current form.");
-					return;
-				}
-			}
-
-			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
-				msg_print(Ind, "\377yYou cannot flip coins while you cannot move.");
-				return;
-			}
-			p_ptr->energy -= level_speed(&p_ptr->wpos);
-
-			coin = (rand_int(2) == 0);
-
-			msg_format(Ind, "\374\377%cYou flip a coin and get %s", COLOUR_GAMBLE, coin ? "heads" : "tails");
-			msg_format_near(Ind, "\374\377%c%s flips a coin and gets %s", COLOUR_GAMBLE, p_ptr->name, coin ? "heads" : "tails");
-			s_printf("Game: Flip - %s gets %s.\n", p_ptr->name, coin ? "heads" : "tails");
-#ifdef USE_SOUND_2010
-			sound(Ind, "coin_flip", NULL, SFX_TYPE_MISC, TRUE);
-#endif
-			return;
-		}
 #ifdef RPG_SERVER /* too dangerous on the pm server right now - mikaelh */
 /* Oops, meant to be on RPG only for now. forgot to add it. thanks - the_sandman */
  #if 0 //moved the old code here.
-		else if (prefix(messagelc, "/pet")) {
+		case SCMD_PET: {
 			if (tk && prefix(token[1], "force")) {
 				summon_pet(Ind, 1);
 				msg_print(Ind, "You summon a pet");
@@ -2499,7 +3768,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
  #endif
-		else if (prefix(messagelc, "/pet")) {
+		case SCMD_PET: {
 			if (strcmp(Players[Ind]->accountname, "The_sandman") || !p_ptr->privileged) {
 				msg_print(Ind, "\377rPet system is disabled.");
 				return;
@@ -2522,7 +3791,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 #endif
-		else if (prefix(messagelc, "/unpet")) {
+		case SCMD_UNPET: {
 #ifdef RPG_SERVER
 			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
 				msg_print(Ind, "\377yYou cannot dismiss your pet while you cannot move.");
@@ -2551,7 +3820,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 		/* added shuffling >_> - C. Blue */
-		else if (prefix(messagelc, "/shuffle")) { /* usage: /shuffle [<32|52> [# of jokers]] */
+		case SCMD_SHUFFLE: { /* usage: /shuffle [<32|52> [# of jokers]] */
 			/* Notes:
 			   0x1FFF = 13 bits = 13 cards (Ace,2..10,J/Q/K)
 			   All further bits (bit 14, 15 and 16) would add a joker each.
@@ -2656,7 +3925,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 			return;
 		}
-		else if (prefix(messagelc, "/dealer")) { /* hand own card stack to someone else, making him the "dealer" */
+		case SCMD_DEALER: { /* hand own card stack to someone else, making him the "dealer" */
 			player_type *q_ptr;
 
 			if (!tk) {
@@ -2705,9 +3974,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 		/* An alternative to dicing :) -the_sandman */
-		else if (prefix(messagelc, "/deal")
+		case SCMD_DEAL: {
 #if 0 /* no support for shuffling? */
-		    ) {
 			int value, flower;
 			char* temp;
 
@@ -2757,7 +4025,6 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			free(temp);
 #else /* support shuffling */
-		    || prefix(messagelc, "/draw")) {
 			cptr value = "Naught", flower = "Void"; //compiler warnings
 			int p = 0;
 			bool draw = FALSE;
@@ -2931,7 +4198,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 			return;
 		}
-		else if (prefix(messagelc, "/martyr") || prefix(messagelc, "/mar")) {
+		case SCMD_MARTYR: {
 			struct dun_level *l_ptr;
 			u32b lflags2 = 0x0;
 
@@ -2958,7 +4225,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 #if defined(ENABLE_HELLKNIGHT) || defined(ENABLE_CPRIEST)
-		else if (prefix(messagelc, "/sacrifice") || prefix(messagelc, "/sac")) {
+		case SCMD_SACRIFICE: {
 			struct dun_level *l_ptr;
 			u32b lflags2 = 0x0;
 
@@ -2992,7 +4259,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 #endif
-		else if (prefix(messagelc, "/embrace") || prefix(messagelc, "/emb")) { //..and the Unlife version
+		case SCMD_EMBRACE: { //..and the Unlife version
 			struct dun_level *l_ptr;
 			u32b lflags2 = 0x0;
 
@@ -3017,7 +4284,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "The underworld's shadow is drawing close, waiting for you to embrace death!");
 			return;
 		}
-		else if (prefix(messagelc, "/pnote")) {
+		case SCMD_PNOTE: {
 			j = 0;
 			if (!p_ptr->party) {
 				msg_print(Ind, "\377oYou are not in a party.");
@@ -3116,8 +4383,9 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				    format("\377b%s set party note to: \377%c%s", p_ptr->name, COLOUR_CHAT_PARTY, party_note_u[i]));
 				return;
 			}
+			break;
 		}
-		else if (prefix(messagelc, "/gnote")) {
+		case SCMD_GNOTE: {
 			j = 0;
 			if (!p_ptr->guild) {
 				msg_print(Ind, "\377oYou are not in a guild.");
@@ -3212,9 +4480,9 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				    format("\377b%s set the guild note to: \377%c%s", p_ptr->name, COLOUR_CHAT_GUILD, guild_note_u[i]));
 				return;
 			}
+			break;
 		}
-		else if (prefix(messagelc, "/snotes") ||
-		    prefix(messagelc, "/motd")) { /* same as /anotes for admins basically */
+		case SCMD_SNOTES: { /* same as /anotes for admins basically */
 			bool first = TRUE;
 
 			for (i = 0; i < MAX_ADMINNOTES; i++) {
@@ -3228,7 +4496,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			if (server_warning[0]) msg_format(Ind, "\377R*** Note: %s ***", server_warning);
 			return;
 		}
-		else if (prefix(messagelc, "/notes")) {
+		case SCMD_NOTES: {
 			int notes = 0;
 
 			for (i = 0; i < MAX_NOTES; i++) {
@@ -3256,7 +4524,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/note")) {
+		case SCMD_NOTE: {
 			int notes = 0, found_note = MAX_NOTES;
 			s32b p_id;
 			struct account acc;
@@ -3405,8 +4673,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 			return;
 		}
-		else if (prefix(messagelc, "/play") /* for joining games - mikaelh */
-		    && !prefix(messagelc, "/playgo")) {
+		case SCMD_PLAY: { /* for joining games - mikaelh */
 			if (p_ptr->team != 0 && gametype == EEGAME_RUGBY) {
 				teams[p_ptr->team - 1]--;
 				p_ptr->team = 0;
@@ -3430,7 +4697,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 
 #ifdef FUN_SERVER /* make wishing available to players for fun, until rollback happens - C. Blue */
-		else if (prefix(messagelc, "/wish")) {
+		case SCMD_WISH: {
 			int tval, sval, bpval = 0, pval = 0, name1 = 0, name2 = 0, name2b = 0, number = 1;
 			object_type pseudo_forge;
 
@@ -3528,7 +4795,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 #endif
-		else if (prefix(messagelc, "/evinfo")) { /* get info on a global event */
+		case SCMD_EVINFO: { /* get info on a global event */
 			int n = 0;
 			char ppl[75];
 			bool found = FALSE;
@@ -3639,7 +4906,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/evsign")) { /* sign up for a global event */
+		case SCMD_EVSIGN: { /* sign up for a global event */
 			int k0 = k - 1;
 
 			/* get some 'real' event index number for our example ;) */
@@ -3667,7 +4934,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/evunsign")) {
+		case SCMD_EVUNSIGN: {
 #ifdef DM_MODULES
 			int n = 0;
 #endif
@@ -3726,7 +4993,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/bbs")) { /* write a short text line to the server's in-game message board,
+		case SCMD_BBS: { /* write a short text line to the server's in-game message board,
 						    readable by all players via '!' key. For example to warn about
 						    static (deadly) levels - C. Blue */
 			byte a;
@@ -3765,7 +5032,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			bbs_add_line(format("\377s%s \377%c%s\377s:\377W %s", showdate(), a, p_ptr->name, message3), format("\377s%s \377%c%s\377s:\377W %s",showdate(), a, p_ptr->name, message3_u));
 			return;
 		}
-		else if (prefix(messagelc, "/stime")) { /* show time / date */
+		case SCMD_STIME: { /* show time / date */
 #if 1 /* Also print year, and use same format as client */
 			time_t ct = time(NULL);
 			struct tm* ctl = localtime(&ct);
@@ -3777,7 +5044,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 			return;
 		}
-		else if (prefix(messagelc, "/pvp")) { /* enter pvp-arena (for MODE_PVP) */
+		case SCMD_PVP: { /* enter pvp-arena (for MODE_PVP) */
 			struct worldpos apos;
 			int ystart = 0, xstart = 0;
 			bool fresh_arena = FALSE;
@@ -3863,7 +5130,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 #ifdef AUCTION_SYSTEM
-		else if (prefix(messagelc, "/auc") || prefix(messagelc, "/auction")) {
+		case SCMD_AUC: {
 			if (p_ptr->inval) {
 				msg_print(Ind, "\377oYou must be validated to use the auction system.");
 				return;
@@ -4040,7 +5307,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 #endif
 		/* workaround - refill ligth source (outdated clients cannot use 'F' due to INVEN_ order change */
-		else if (prefix(messagelc, "/light") && !prefix(messagelc, "/lightning")) {
+		case SCMD_LIGHT: {
 			if (tk != 1) {
 				msg_print(Ind, "Usage: /light a...w|+");
 				return;
@@ -4067,7 +5334,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 
 		/* Allow players to undo some of their skills - mikaelh */
-		else if (prefix(messagelc, "/undoskills") || prefix(messagelc, "/undos")) {
+		case SCMD_UNDOSKILLS: {
 			/* Skill points gained */
 			int gain = p_ptr->skill_points_old - p_ptr->skill_points;
 
@@ -4128,7 +5395,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 #if 1
-		else if (prefix(messagelc, "/info")) { /* set a personal info message - C. Blue */
+		case SCMD_INFO: { /* set a personal info message - C. Blue */
 			char to_strip[80];
 
 			if (strlen(message2) > 6) {
@@ -4149,12 +5416,12 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 #endif
 #if 0
-		else if (prefix(messagelc, "/pray")) { /* hidden broadcast to all admins :) */
+		case SCMD_PRAY: { /* hidden broadcast to all admins :) */
 			msg_admin("\377b[\377U%s\377b]\377D %s", p_ptr->name, 'w', message3);
 			return;
 		}
 #endif
-		else if (prefix(messagelc, "/pbbs")) {
+		case SCMD_PBBS: {
 			/* Look at or write to in-game party bbs, as suggested by Caine/Goober - C. Blue */
 			bool bbs_empty = TRUE;
 
@@ -4181,7 +5448,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			if (bbs_empty) msg_format(Ind, "\377%c <nothing has been written on the party board so far>", COLOUR_CHAT_PARTY);
 			return;
 		}
-		else if (prefix(messagelc, "/gbbs")) {
+		case SCMD_GBBS: {
 			/* Look at or write to in-game guild bbs - C. Blue */
 			bool bbs_empty = TRUE;
 
@@ -4208,43 +5475,48 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			if (bbs_empty) msg_format(Ind, "\377%c <nothing has been written on the guild board so far>", COLOUR_CHAT_GUILD);
 			return;
 		}
-		else if (prefix(messagelc, "/ftkon")) {
+		case SCMD_FTKON: {
 			if (p_ptr->shoot_till_kill) {
 				msg_print(Ind, "\377wFire-till-kill mode already on.");
 				return;
 			}
 			toggle_shoot_till_kill(Ind);
 			return;
-		} else if (prefix(messagelc, "/ftkoff")) {
+		}
+		case SCMD_FTKOFF: {
 			if (!p_ptr->shoot_till_kill) {
 				msg_print(Ind, "\377wFire-till-kill mode already off.");
 				return;
 			}
 			toggle_shoot_till_kill(Ind);
 			return;
-		} else if (prefix(messagelc, "/ftk")) {
+		}
+		case SCMD_FTK: {
 			toggle_shoot_till_kill(Ind);
 			return;
-		} else if (prefix(messagelc, "/dwon")) {
+		}
+		case SCMD_DWON: {
 			if (p_ptr->dual_mode) {
 				msg_print(Ind, "\377wDual-wield mode: Dual-hand already set.");
 				return;
 			}
 			toggle_dual_mode(Ind);
 			return;
-		} else if (prefix(messagelc, "/dwoff")) {
+		}
+		case SCMD_DWOFF: {
 			if (!p_ptr->dual_mode) {
 				msg_print(Ind, "\377wDual-wield mode: Main-hand already set.");
 				return;
 			}
 			toggle_dual_mode(Ind);
 			return;
-		} else if (prefix(messagelc, "/dw")) {
+		}
+		case SCMD_DW: {
 			toggle_dual_mode(Ind);
 			return;
 		}
 #ifdef PLAYER_STORES
-		else if (prefix(messagelc, "/pstore")) {
+		case SCMD_PSTORE: {
 			int x, y;
 			cave_type **zcave = getcave(&p_ptr->wpos);
 
@@ -4269,7 +5541,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 #endif
 #ifdef HOUSE_PAINTING /* goes hand in hand with player stores.. */
-		else if (prefix(messagelc, "/paint")) { /* paint a house that we own */
+		case SCMD_PAINT: { /* paint a house that we own */
 			int x, y;
 			bool found = FALSE;
 			cave_type **zcave = getcave(&p_ptr->wpos);
@@ -4316,7 +5588,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 #endif
-		else if (prefix(messagelc, "/knock")) { /* knock on a house door */
+		case SCMD_KNOCK: { /* knock on a house door */
 			int x, y, wx, wy;
 			bool found = FALSE, found_window = FALSE;
 			cave_type **zcave = getcave(&p_ptr->wpos);
@@ -4362,7 +5634,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			else knock_window(Ind, wx, wy); /* knock on the window */
 			return;
 		}
-		else if (prefix(messagelc, "/slap")) { /* Slap someone around :-o */
+		case SCMD_SLAP: { /* Slap someone around :-o */
 			cave_type **zcave = getcave(&p_ptr->wpos);
 
 			if (!tk) {
@@ -4414,7 +5686,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 
 			return;
 		}
-		else if (prefix(messagelc, "/pat")) { /* Counterpart to /slap :-p */
+		case SCMD_PAT: { /* Counterpart to /slap :-p */
 			cave_type **zcave = getcave(&p_ptr->wpos);
 
 			if (!tk) {
@@ -4473,7 +5745,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/hug")) { /* Counterpart to /slap :-p */
+		case SCMD_HUG: { /* Counterpart to /slap :-p */
 			cave_type **zcave = getcave(&p_ptr->wpos);
 
 			if (!tk) {
@@ -4513,7 +5785,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/poke")) {
+		case SCMD_POKE: {
 			cave_type **zcave = getcave(&p_ptr->wpos);
 
 			if (!tk) {
@@ -4553,7 +5825,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/applaud")) {
+		case SCMD_APPLAUD: {
 			/* Paralyzed/k.o.? */
 			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended || p_ptr->energy <= 0) {
 				msg_print(Ind, "\377yYou cannot applaud someone while you cannot move.");
@@ -4590,7 +5862,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 			return;
 		}
-		else if (prefix(messagelc, "/wave")) {
+		case SCMD_WAVE: {
 			/* Paralyzed/k.o.? */
 			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended || p_ptr->energy <= 0) {
 				msg_print(Ind, "\377yYou cannot wave while you cannot move.");
@@ -4627,7 +5899,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 			return;
 		}
-		else if (prefix(messagelc, "/tip")) { /* put some cash (level ^ 2) in player's waistcoat pocket~ */
+		case SCMD_TIP: { /* put some cash (level ^ 2) in player's waistcoat pocket~ */
 			cave_type **zcave = getcave(&p_ptr->wpos);
 			u32b tip;
 			player_type *q_ptr;
@@ -4750,7 +6022,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 
 			return;
 		}
-		else if (prefix(messagelc, "/guild_adder") && !prefix(messagelc, "/guild_adders")) {
+		case SCMD_GUILD_ADDER: {
 			u32b *flags;
 			guild_type *guild;
 			player_type *q_ptr;
@@ -4839,7 +6111,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/guild_cfg")) {
+		case SCMD_GUILD_CFG: {
 			u32b *flags;
 			guild_type *guild;
 			bool master;
@@ -4915,7 +6187,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			} else msg_print(Ind, "Unknown guild flag specified.");
 			return;
 		}
-		else if (prefix(messagelc, "/xguild_adders") || prefix(messagelc, "/guild_adders")) { //careful not to collide with /guild_adder; also, we're called by client's party menu only
+		case SCMD_XGUILD_ADDERS: { //careful not to collide with /guild_adder; also, we're called by client's party menu only
 #ifdef GUILD_ADDERS_LIST
 			//u32b *flags;
 			guild_type *guild;
@@ -4945,8 +6217,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 			return;
 		}
-		else if (prefix(messagelc, "/testyourmight")  ||
-		    prefix(messagelc, "/tym")) {
+		case SCMD_TESTYOURMIGHT: {
 			if (tk != 1 || (tk == 1 && strcmp(token[1], "rs") && tk == 1 && strcmp(token[1], "rsw") && strcmp(token[1], "rsx") && strcmp(token[1], "show"))) {
 				msg_print(Ind, "Usage: /testyourmight <show|rs[w]>");
 				msg_print(Ind, "       '/testyourmight show' will display your current damage/heal stats,");
@@ -4993,7 +6264,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			return;
 		}
 		/* request back real estate that was previously backed up via /backup_estate */
-		else if (prefix(messagelc, "/request_estate") || prefix(messagelc, "/request")) {
+		case SCMD_REQUEST_ESTATE: {
 			/* Specialty: Allow a single player to restore her estate */
 			if (p_ptr->admin_parm[0] == 'E' && !p_ptr->admin_parm[1]) {
 				restore_estate(Ind);
@@ -5010,7 +6281,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 #ifdef ENABLE_SUBCLASS
 		/* kurzel.dev EXPERIMENTAL #1 - Subclassing! (Weight skill modifiers.) */
-		else if (prefix(messagelc, "/subclass") || prefix(messagelc, "/sc")) {
+		case SCMD_SUBCLASS: {
 			int class; // p_ptr->pclass;
 
 			if (!tk) {
@@ -5083,7 +6354,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 #endif
 		/* Specialty: Convert current character into a 'slot-exclusive' character if possible */
-		else if (prefix(messagelc, "/convertexclusive")) {
+		case SCMD_CONVERTEXCLUSIVE: {
 			int ok, err_Ind;
 
 #if 0 /* was because of Destroy_connection().. */
@@ -5206,35 +6477,40 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			return;
-		} else if (prefix(messagelc, "/pclose")) { /* Hack for older clients/testing */
+		}
+		case SCMD_PCLOSE: { /* Hack for older clients/testing */
 			party_close(Ind);
 			return;
-		} else if (prefix(messagelc, "/pquit") || prefix(messagelc, "/pleave")) {
+		}
+		case SCMD_PQUIT: {
 			if (!p_ptr->party) {
 				msg_print(Ind, "You are not in a party.");
 				return;
 			}
 			party_leave(Ind, TRUE);
 			return;
-		} else if (prefix(messagelc, "/gquit") || prefix(messagelc, "/gleave")) {
+		}
+		case SCMD_GQUIT: {
 			if (!p_ptr->guild) {
 				msg_print(Ind, "You are not in a guild.");
 				return;
 			}
 			guild_leave(Ind, TRUE);
 			return;
-		} else if (prefix(messagelc, "/quit") || prefix(messagelc, "/exit") || prefix(messagelc, "/leave") || prefix(messagelc, "/logout") || prefix(messagelc, "/bye")) {
+		}
+		case SCMD_QUIT: {
 			/* If used with any parameter, it will perma-close the connection, making the client terminate, requiring us to start the client anew to log in again. */
 			if (tk) do_quit(Players[Ind]->conn, FALSE); //FALSE: will actually result in perma-dropping the connection
 			else do_quit(Players[Ind]->conn, TRUE); //TRUE: allows RETRY_LOGIN to work.
 			return;
-		} else if (prefix(messagelc, "/suicide") || prefix(messagelc, "/sui") ||
-		    prefix(messagelc, "/retire") || prefix(messagelc, "/ret")) {
+		}
+		case SCMD_SUICIDE: {
 			// same for p_ptr->rogue_like_commands true+false: Q
 			msg_print(Ind, "\377yPlease press \377RSHIFT+Q\377y to commit suicide or retire.");
 			return;
 #ifdef ENABLE_DRACONIAN_TRAITS
-		} else if (prefix(messagelc, "/trait")) {
+		}
+		case SCMD_TRAIT: {
 			if (!(p_ptr->prace == RACE_MAIA && (p_ptr->mode & MODE_PVP) && MIN_PVP_LEVEL >= 20)
 			    && p_ptr->prace != RACE_DRACONIAN) {
 				msg_print(Ind, "This command is not available for your character.");
@@ -5328,7 +6604,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 
 #ifdef AUTO_RET_CMD
-		} else if (prefix(messagelc, "/autoretm") || prefix(messagelc, "/arm")) {
+		}
+		case SCMD_AUTORETM: {
 			char *p = token[1];
 			//bool nosleep = FALSE;
 			bool town = FALSE, fallback = FALSE;
@@ -5389,7 +6666,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			show_autoret(Ind, 0x2, TRUE);
 
 			return;
-		} else if (prefix(messagelc, "/autoretr") || prefix(messagelc, "/arr")) {
+		}
+		case SCMD_AUTORETR: {
 			char *p = token[1];
 			//bool nosleep = FALSE;
 			bool town = FALSE, fallback = FALSE;
@@ -5493,7 +6771,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 
 			show_autoret(Ind, 0x4, TRUE);
 			return;
-		} else if (prefix(messagelc, "/autoret") || prefix(messagelc, "/ar")) { /* Set basic auto-retaliation for melee */
+		}
+		case SCMD_AUTORET: { /* Set basic auto-retaliation for melee */
 			char *p = token[1];
 			//bool nosleep = FALSE;
 			bool town = FALSE;
@@ -5545,7 +6824,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 
 #ifdef ENABLE_SELF_FLASHING
-		} else if (prefix(messagelc, "/flash")) { //for before next client release, to make this already accessible
+		}
+		case SCMD_FLASH: { //for before next client release, to make this already accessible
 			if (p_ptr->flash_self2 == FALSE) {
 				p_ptr->flash_self2 = TRUE;
 				msg_print(Ind, "Self-flashing on short-range teleportation is now ENABLED.");
@@ -5555,7 +6835,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 #endif
-		} else if (prefix(messagelc, "/partymembers")) {
+		}
+		case SCMD_PARTYMEMBERS: {
 			int slot, p = p_ptr->party, members = 0;
 			hash_entry *ptr;
 
@@ -5583,7 +6864,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			msg_format(Ind, "  %d member%s total.", members, members == 1 ? "" : "s");
 			return;
-		} else if (prefix(messagelc, "/guildmembers")) {
+		}
+		case SCMD_GUILDMEMBERS: {
 			int slot, g = p_ptr->guild, members = 0;
 			hash_entry *ptr;
 
@@ -5612,7 +6894,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			msg_format(Ind, "  %d member%s total.", members, members == 1 ? "" : "s");
 			return;
 		}
-		else if (prefix(messagelc, "/snbar")) {
+		case SCMD_SNBAR: {
 			if (p_ptr->sanity_bars_allowed == 1) {
 				msg_print(Ind, "Your sanity can only be displayed in the current label form.");
 				if (p_ptr->pclass == CLASS_MINDCRAFTER) {
@@ -5631,7 +6913,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			p_ptr->redraw |= PR_SANITY;
 			return;
 		}
-		else if (prefix(messagelc, "/hpbar")) {
+		case SCMD_HPBAR: {
 			if (p_ptr->health_bar) p_ptr->health_bar = FALSE;
 			else p_ptr->health_bar = TRUE;
 			if (p_ptr->health_bar) msg_print(Ind, "Hit points are now displayed as bar.");
@@ -5639,7 +6921,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			p_ptr->redraw |= PR_HP;
 			return;
 		}
-		else if (prefix(messagelc, "/mpbar")) {
+		case SCMD_MPBAR: {
 			if (p_ptr->mana_bar) p_ptr->mana_bar = FALSE;
 			else p_ptr->mana_bar = TRUE;
 			if (p_ptr->mana_bar) msg_print(Ind, "Mana is now displayed as bar.");
@@ -5647,7 +6929,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			p_ptr->redraw |= PR_MANA;
 			return;
 		}
-		else if (prefix(messagelc, "/stbar")) {
+		case SCMD_STBAR: {
 			if (p_ptr->stamina_bar) p_ptr->stamina_bar = FALSE;
 			else p_ptr->stamina_bar = TRUE;
 			if (p_ptr->stamina_bar) msg_print(Ind, "Stamina is now displayed as bar.");
@@ -5655,14 +6937,14 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			p_ptr->redraw |= PR_STAMINA;
 			return;
 		}
-		else if (prefix(messagelc, "/seen")) {
+		case SCMD_SEEN: {
 			char response[MAX_CHARS_WIDE];
 
 			get_laston(message3, response, admin_p(Ind), TRUE);
 			msg_print(Ind, response);
 			return;
 		}
-		else if (prefix(messagelc, "/quest") || prefix(messagelc, "/que")/*quIt*/) { /* display our quests or drop a quest we're on */
+		case SCMD_QUEST: { /*quIt*/ /* display our quests or drop a quest we're on */
 			if (tk != 1) {
 				int qa = 0;
 
@@ -5695,7 +6977,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			quest_log(Ind, k - 1);
 			return;
 		}
-		else if (prefix(messagelc, "/qdrop")) { /* drop a quest we're on */
+		case SCMD_QDROP: { /* drop a quest we're on */
 			int qa = 0, k0 = k - 1;
 
 			if (tk != 1) {
@@ -5728,7 +7010,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			quest_abandon(Ind, k0);
 			return;
 		}
-		else if (prefix(messagelc, "/who")) { /* returns account name to which the given character name belongs -- user version of /characc[l] */
+		case SCMD_WHO: { /* returns account name to which the given character name belongs -- user version of /characc[l] */
 			s32b p_id;
 			cptr acc;
 			bool online = FALSE;
@@ -5879,7 +7161,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/dun") && (!messagelc[4] || messagelc[4] == ' ')) { //Display our current dungeon name
+		case SCMD_DUN: { //Display our current dungeon name
 			dungeon_type *d_ptr = NULL;
 
 			if (!p_ptr->wpos.wz) {
@@ -5893,7 +7175,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			msg_format(Ind, "\377uYou are currently in %s.", get_dun_name(p_ptr->wpos.wx, p_ptr->wpos.wy, (p_ptr->wpos.wz > 0), d_ptr, 0, TRUE));
 			return;
 		}
-		else if (prefix(messagelc, "/kifu") || prefix(messagelc, "/gibo")) {
+		case SCMD_KIFU: {
 #ifdef ENABLE_GO_GAME
 			char *c, *email;
 			bool c_at = FALSE;
@@ -5966,7 +7248,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 		/* Hack for experimentally enabling beta-test features, that usually would require a client update first.
 		   Usage: "/beta0"..."/beta9". */
-		else if (prefix(messagelc, "/beta")) {
+		case SCMD_BETA: {
 			i = message2[5] - 48;
 			if (i < 0 || i > 9) {
 				msg_print(Ind, "\377yUsage: /beta0 ... /beta9");
@@ -5975,7 +7257,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			exec_lua(0, format("beta(%d,%d)", Ind, i));
 			return;
 		}
-		else if (prefix(messagelc, "/col") || prefix(messagelc, "/colours") || prefix(messagelc, "/colors")) {
+		case SCMD_COL: {
 			msg_print(Ind, "\377wColour table:");
 			msg_print(Ind, "  (0/d) black:       \377dblack\377w   (1/w) white:        \377wwhite\377w   (2/s) gray:      \377sslate");
 			msg_print(Ind, "  (3/o) orange:      \377oorange\377w  (4/r) red:          \377rred\377w     (5/g) green:     \377ggreen");
@@ -5985,7 +7267,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			msg_print(Ind, " (15/U) light brown: \377Ulumber");
 			return;
 		}
-		else if (prefix(messagelc, "/acol") || prefix(messagelc, "/acolours") || prefix(messagelc, "/acolors")) {
+		case SCMD_ACOL: {
 			msg_print(Ind, "\377wAnimated-colour table:");
 			msg_print(Ind, " (a) \377aacid\377w   (c) \377ccold\377w   (e) \377eelectricity\377w  (f) \377ffire\377w   (p) \377ppoison\377w     (h) \377hhalf-multi");
 			msg_print(Ind, " (m) \377mmulti\377w  (L) \377Llight\377w  (A) \377Adarkness\377w     (S) \377Ssound\377w  (C) \377Cconfusion\377w  (H) \377Hshards");
@@ -6000,7 +7282,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		}
 		/* fire up all available status tags in the display to see
 		   which space is actually occupied and which is free */
-		else if (prefix(messagelc, "/testdisplay")) {
+		case SCMD_TESTDISPLAY: {
 			struct worldpos wpos;
 
 			Send_extra_status(Ind, "ABCDEFGHIJKL");
@@ -6025,7 +7307,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			if (is_atleast(&p_ptr->version, 4, 7, 3, 1, 0, 0)) Send_indicators(Ind, 0xFFFFFFFF);
 			return;
 		}
-		else if (prefix(messagelc, "/testascii")) {
+		case SCMD_TESTASCII: {
 			char line[MAX_CHARS + 1];
 			int cstart = 1, cend = 0372, amt = 50; //MAX_CHARS - 7;
 
@@ -6038,7 +7320,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
-		else if (prefix(messagelc, "/setorder")) { /* Non-admin version - Set custom list position for this character in the account overview screen on login */
+		case SCMD_SETORDER: { /* Non-admin version - Set custom list position for this character in the account overview screen on login */
 			int max_cpa = MAX_CHARS_PER_ACCOUNT;
 			int *id_list, ids, cur_order, order, max_order = 0;
 
@@ -6099,11 +7381,13 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			msg_format(Ind, "This character's ordering weight has been set to %d.", k);
 			C_KILL(id_list, ids, int);
 			return;
-		} else if (prefix(messagelc, "/edmt")) { /* manual c_cfg.easy_disarm_montraps */
+		}
+		case SCMD_EDMT: { /* manual c_cfg.easy_disarm_montraps */
 			p_ptr->easy_disarm_montraps = !p_ptr->easy_disarm_montraps;
 			msg_format(Ind, "Walking into a monster trap will %sdisarm it.", p_ptr->easy_disarm_montraps ? "" : "not ");
 			return;
-		} else if (prefix(messagelc, "/setimm")) { //quick and dirty for outdated clients, pfft
+		}
+		case SCMD_SETIMM: { //quick and dirty for outdated clients, pfft
 			k = message3[0] - 'a';
 			if (!tk || k < 1 || k > 7) {
 				msg_print(Ind, "\377yUsage:  /setimm <b..h>");
@@ -6113,7 +7397,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			msg_print(Ind, "Preferred immunity set.");
 			p_ptr->mimic_immunity = k;
 			return;
-		} else if (prefix(messagelc, "/setele")) { //quick and dirty for outdated clients, pfft
+		}
+		case SCMD_SETELE: { //quick and dirty for outdated clients, pfft
 			if (p_ptr->prace != RACE_DRACONIAN || p_ptr->ptrait != TRAIT_MULTI) {
 				msg_print(Ind, "This command is not available for your character.");
 				return;
@@ -6127,7 +7412,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			msg_print(Ind, "Breath element set.");
 			p_ptr->breath_element = k;
 			return;
-		} else if (prefix(messagelc, "/characters") || prefix(messagelc, "/chars") || prefix(messagelc, "/charlist") ) { /* list all characters of the player's account (user-version of /acclist) */
+		}
+		case SCMD_CHARACTERS: { /* list all characters of the player's account (user-version of /acclist) */
 			int *id_list, i, n;
 			struct account acc;
 			u32b tmpm;
@@ -6165,7 +7451,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			if (n) C_KILL(id_list, n, int);
 			WIPE(&acc, struct account);
 			return;
-		} else if (prefix(messagelc, "/ing") || prefix(messagelc, "/ingredients")) { /* toggle item-finding part of the Demolitionist perk/Apply Poison users */
+		}
+		case SCMD_ING: { /* toggle item-finding part of the Demolitionist perk/Apply Poison users */
 			bool pois = (p_ptr->melee_techniques & MT_POISON);
 #ifdef ENABLE_DEMOLITIONIST
 			bool demo = get_skill(p_ptr, SKILL_DIG) >= ENABLE_DEMOLITIONIST;
@@ -6203,7 +7490,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "You will find ingredients for the 'Apply Poison' technique.");
 			}
 			return;
-		} else if (prefix(messagelc, "/forms")) { /* [minlev] -- shortcut for mimics for ~ 2 @ ESC */
+		}
+		case SCMD_FORMS: { /* [minlev] -- shortcut for mimics for ~ 2 @ ESC */
 			char learnt = '@';
 
 			if (!get_skill(p_ptr, SKILL_MIMIC)) {
@@ -6216,7 +7504,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			do_cmd_show_monster_killed_letter(Ind, &learnt, tk ? k : 0, FALSE);
 			return;
-		} else if (!strcmp(messagelc, "/ta")) { /* non-lua equivalent to ta() that toggles admin state irreversibly (as non-admins cannot invoke lua) */
+		}
+		case SCMD_TA: { /* non-lua equivalent to ta() that toggles admin state irreversibly (as non-admins cannot invoke lua) */
 			if (p_ptr->admin_dm) {
 				p_ptr->privileged = 4;
 				msg_print(Ind, "Relinquished admin (DM) status till next login or /ta usage.");
@@ -6245,17 +7534,20 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				} else msg_print(Ind, "No valid admin state remembered.");
 			}
 			return;
-		} else if (prefix(messagelc, "/uptime")) { /* same as LUA uptime (It/Moltor) */
+		}
+		case SCMD_UPTIME: { /* same as LUA uptime (It/Moltor) */
 			u32b elapsed = (turn - session_turn) / cfg.fps;
 			int days = (int)(elapsed / 86400), hours = (int)((elapsed % 86400) / 3600), minutes = (int)((elapsed % 3600) / 60), seconds = (int)((elapsed % 60));
 
 			msg_format(Ind, "\377sUptime: %d days %d hours %d minutes %d seconds", days, hours, minutes, seconds);
 			return;
 #ifdef SERVER_PORTALS
-		} else if (prefix(messagelc, "/portal")) { /* initialize/use inter-server portal */
+		}
+		case SCMD_PORTAL: { /* initialize/use inter-server portal */
 			return;
 #endif
-		} else if (prefix(messagelc, "/split")) { /* split up an item stack, auto-append-inscribing the split up part !G */
+		}
+		case SCMD_SPLIT: { /* split up an item stack, auto-append-inscribing the split up part !G */
 			int amt;
 
 			/* need to specify one parm: the potion used for colouring */
@@ -6280,7 +7572,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 
 			do_cmd_split_stack(Ind, k, amt);
 			return;
-		} else if (prefix(messagelc, "/rest")) { /* Rest [for n turns] */
+		}
+		case SCMD_REST: { /* Rest [for n turns] */
 			if (tk && (k <= 0 || k >= 10000)) {
 				msg_print(Ind, "\377yUsage: /rest [1..10000 turns]");
 				return;
@@ -6288,77 +7581,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			if (k > 10000) k = 10000;
 			(void)toggle_rest(Ind, k);
 			return;
-		} else if (prefix(messagelc, "/stow") || (prefix(messagelc, "/s ") || !strcmp(message, "/s"))) { // (short form used to be for /say)
-			/* Stow all items from inventory that can be stowed into bags that are available, optionally only into a specific bag. */
-			#define STOW_QUIET FALSE
-			object_type *o_ptr;
-			int start, stop, bags = 0;
-			bool any = FALSE, free_space = FALSE;
-#ifdef SUBINVEN_LIMIT_GROUP
-			int prev_type = -1, t;
-#endif
-
-			/* need to specify one parm: the potion used for colouring */
-			if (strstr(message3, "help") || message3[0] == '?') {
-				msg_print(Ind, "\377oUsage:     /stow [<inventory slot>]");
-				msg_print(Ind, "\377oExample 1: /stow");
-				msg_print(Ind, "\377oExample 2: /stow a");
-				return;
-			}
-
-			if (p_ptr->paralyzed || p_ptr->stun > 100 || p_ptr->suspended) {
-				msg_print(Ind, "\377yYou cannot stow items while you cannot move.");
-				return;
-			}
-
-			if (tk) {
-				if (message3[0] == '+') {
-					if (p_ptr->item_newest >= 0) k = p_ptr->item_newest;
-					else return;
-				} else if ((k = a2slot(Ind, token[1][0], 0, TRUE, FALSE)) == -1) return;
-
-				o_ptr = &p_ptr->inventory[k];
-				if (!o_ptr->tval || o_ptr->tval != TV_SUBINVEN) {
-					msg_format(Ind, "Inventory item '%c)' is not a valid container.", token[1][0]);
-					return;
-				}
-
-				if (p_ptr->subinventory[k][o_ptr->bpval - 1].tval) { /* uh, ensure maybe that all tval are nulled, not just the one of the first empty bag slot... */
-					msg_format(Ind, "It is already full!");
-					return;
-				}
-
-				start = stop = k;
-			} else {
-				start = 0;
-				stop = INVEN_PACK - 1;
-			}
-
-			for (i = start; i <= stop; i++) {
-				o_ptr = &p_ptr->inventory[i];
-				if (o_ptr->tval != TV_SUBINVEN) break;
-				bags++;
-
-				t = get_subinven_group(o_ptr->sval);
-#ifdef SUBINVEN_LIMIT_GROUP
-				if (t == prev_type) continue; /* This assumes that subinvens are sorted by svals, which is true for all inventory items actually. */
-				prev_type = t;
-#endif
-
-				if (!p_ptr->subinventory[i][o_ptr->bpval - 1].tval) free_space = TRUE;
-				any = do_cmd_subinven_fill(Ind, i, STOW_QUIET) || any; /* FALSE for "You have..." item messages, TRUE for quiet op */
-			}
-			if (!bags) msg_print(Ind, "You possess no container items.");
-			else if (!free_space) {
-				if (start == stop || bags == 1) msg_print(Ind, "Your container has no free space.");
-				else msg_print(Ind, "Your containers have no free space.");
-			} else if (!any) {
-				if (start == stop) msg_print(Ind, "No eligible item found to stow into that container.");
-				else msg_print(Ind, "No items could be stowed into your containers.");
-			} else if (STOW_QUIET)
-				msg_print(Ind, "You stowed something.");
-			return;
-		} else if (prefix(messagelc, "/unstow")) { /* Unstow all items from specific subinventory, into inventory (drops to floor if out of space); same as 'A'ctivating. */
+		}
+		case SCMD_UNSTOW: { /* Unstow all items from specific subinventory, into inventory (drops to floor if out of space); same as 'A'ctivating. */
 			#define UNSTOW_QUIET FALSE
 			object_type *o_ptr;
 
@@ -6392,7 +7616,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 
 			empty_subinven(Ind, k, FALSE, UNSTOW_QUIET); /* FALSE for "You have..." item messages, TRUE for quiet op */
 			return;
-		} else if (prefix(messagelc, "/chem")) { /* Hack for older clients/testing */
+		}
+		case SCMD_CHEM: { /* Hack for older clients/testing */
 			p_ptr->autopickup_chemicals = !p_ptr->autopickup_chemicals;
 			if (p_ptr->autopickup_chemicals) msg_print(Ind, "Auto-picking up freshly dropped chemicals is now \377GEnabled\377-.");
 			else msg_print(Ind, "Auto-picking up freshly dropped chemicals is now \377sDisabled\377-.");
@@ -6408,7 +7633,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		   TODO maybe - we could allow @CA... hex-like inscriptions to include the non-direct ingredients mentioned above (water etc):
 		        @CA water, @CB salt water, @CC acid (and @CD oil if we don't simply want to use @C9).
 		        However, this would currently collide with the inventory letter usage in mixed-syntax commands :/. */
-		else if (prefix(messagelc, "/mix")) {
+		case SCMD_MIX: {
 			char *tagp, *insc, *tagp_init = message3;
 			object_type *o_ptr;
 			int chem1, result, sub, sub_maxitems, count, repeats = 0;
@@ -6612,7 +7837,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			/* Clean up, playing it safe */
 			p_ptr->current_activation = -1;
 			return;
-		} else if (prefix(messagelc, "/kdiz")) { //for before next client release, to make this already accessible
+		}
+		case SCMD_KDIZ: { //for before next client release, to make this already accessible
 			if (p_ptr->add_kind_diz == FALSE) {
 				p_ptr->add_kind_diz = TRUE;
 				msg_print(Ind, "On pasting an item to chat from inven/equip window you'll see extra info.");
@@ -6621,7 +7847,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "On pasting an item to chat from inven/equip window you'll not see extra info.");
 			}
 			return;
-		} else if (prefix(messagelc, "/hlore")) { //for before next client release, to make this already accessible
+		}
+		case SCMD_HLORE: { //for before next client release, to make this already accessible
 			if (p_ptr->hide_lore_paste == FALSE) {
 				p_ptr->hide_lore_paste = TRUE;
 				msg_print(Ind, "You will no longer see true artifact/monster lore pasted to public chat.");
@@ -6630,7 +7857,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "You will see true artifact/monster lore pasted to public chat.");
 			}
 			return;
-		} else if (prefix(messagelc, "/newar")) { //for before next client release, to make this already accessible
+		}
+		case SCMD_NEWAR: { //for before next client release, to make this already accessible
 			p_ptr->warning_newautoret = 1;
 			if (p_ptr->new_retaliator == TRUE) {
 				p_ptr->new_retaliator = FALSE;
@@ -6648,7 +7876,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 			}
 			return;
-		} else if (prefix(messagelc, "/email")) { //set or check email for notifications
+		}
+		case SCMD_EMAIL: { //set or check email for notifications
 #if defined(EMAIL_NOTIFICATIONS) && (defined(EMAIL_NOTIFICATION_EXPIRY_CHAR) || defined(EMAIL_NOTIFICATION_EXPIRY_ACC) || defined(EMAIL_NOTIFICATION_RELEASE))
 			struct account acc;
 			char *pos;
@@ -6745,7 +7974,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			msg_print(Ind, "This command is not available in the current server configuration.");
 #endif
 			return;
-		} else if (prefix(messagelc, "/tss")) { //Thunderstorm: Hit sleeping monsters too.
+		}
+		case SCMD_TSS: { //Thunderstorm: Hit sleeping monsters too.
 			//if (!p_ptr->s_info[SKILL_NATURE].mod && !p_ptr->s_info[SKILL_AIR].mod)
 			if (exec_lua(Ind, format("return get_level(%d, THUNDERSTORM, 50, -50)", Ind)) < 1) {
 				msg_print(Ind, "\377yThis command can only be used by characters that can cast 'Thunderstorm'.");
@@ -6760,7 +7990,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "Thunderstorm spell will no longer hit sleeping monsters.");
 			}
 			return;
-		} else if (prefix(messagelc, "/timer")) { //set a custom timer w/ sfx/notification
+		}
+		case SCMD_TIMER: { //set a custom timer w/ sfx/notification
 			bool up = (tk >= 1 && token[1][0] == '+');
 			int notification = (tk == 2 ? atoi(token[2]) : 0);
 
@@ -6796,6 +8027,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			return;
 		}
+		}
 
 
 
@@ -6804,7 +8036,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		 *
 		 * (Admins might have different versions of these commands)
 		 */
-		else if (!admin && p_ptr->privileged) {
+		else if (sc && sc->access == SLASH_PRIV) {
 			/*
 			 * Privileged commands, level 2
 			 */
@@ -6816,7 +8048,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			/*
 			 * Privileged commands, level 1
 			 */
-			if (prefix(messagelc, "/val")) {
+			switch (sc->id) {
+			case SCMD_PRIV_VAL: {
 				struct account acc;
 				bool res;
 
@@ -6846,7 +8079,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/inval")) {
+			case SCMD_PRIV_INVAL: {
 				if (!tk) {
 					msg_print(Ind, "Usage: /inval <player name>");
 					return;
@@ -6865,7 +8098,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/linv")) { /* List new invalid account names that tried to log in meanwhile */
+			case SCMD_PRIV_LINV: { /* List new invalid account names that tried to log in meanwhile */
 				for (i = 0; i < MAX_LIST_INVALID; i++) {
 					if (!list_invalid_name[i][0]) break;
 					msg_format(Ind, "  #%d) %s %s@%s (%s)", i, list_invalid_date[i], list_invalid_name[i], list_invalid_host[i], list_invalid_addr[i]);
@@ -6873,6 +8106,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				if (!i) msg_print(Ind, "No invalid accounts recorded.");
 				return;
 			}
+			}
 		}
 
 
@@ -6882,7 +8116,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 		 *
 		 * These commands should be replaced by LUA scripts in the future.
 		 */
-		else if (admin) {
+		else if (sc && sc->access == SLASH_ADMIN) {
 			/* presume worldpos */
 			switch (tk) {
 			case 1:
@@ -6904,24 +8138,25 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				break;
 			}
 
+			switch (sc->id) {
 			/* random temporary test output */
-			if (prefix(messagelc, "/tmp")) {
+			case SCMD_TMP: {
 				if (!tk) return;
 				return;
 			}
 
 #ifdef TOMENET_WORLDS
-			else if (prefix(messagelc, "/world")) {
+			case SCMD_WORLD: {
 				world_connect(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/unworld")) {
+			case SCMD_UNWORLD: {
 				world_disconnect(Ind);
 				return;
 			}
 #endif
 
-			else if (prefix(messagelc, "/shutdown")) { // || prefix(messagelc, "/quit"))
+			case SCMD_SHUTDOWN: { // || prefix(messagelc, "/quit"))
 				bool kick = (cfg.runlevel == 1024);
 
 //no effect			if (tk && k == 0) msg_broadcast(0, "\377o** Server is being restarted and will be back immediately! **");
@@ -6949,67 +8184,67 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Specialty: /shutempty als checks for logged in accounts, without character logged in yet. */
-			else if (prefix(messagelc, "/shutempty")) {
+			case SCMD_SHUTEMPTY: {
 				msg_admins(0, "\377y* Shutting down when dungeons are empty and no accounts being logged in *");
 				cfg.runlevel = 2048;
 				return;
 			}
-			else if (prefix(messagelc, "/shutlow")) {
+			case SCMD_SHUTLOW: {
 				msg_admins(0, "\377y* Shutting down when dungeons are empty and few (5) players are on *");
 				cfg.runlevel = 2047;
 				return;
 			}
-			else if (prefix(messagelc, "/shutvlow")) {
+			case SCMD_SHUTVLOW: {
 				msg_admins(0, "\377y* Shutting down when dungeons are empty and very few (4) players are on *");
 				cfg.runlevel = 2046;
 				return;
 			}
-			else if (prefix(messagelc, "/shutnone")) {
+			case SCMD_SHUTNONE: {
 				msg_admins(0, "\377y* Shutting down when no players are on anymore *");
 				cfg.runlevel = 2045;
 				return;
 			}
-			else if (prefix(messagelc, "/shutactivevlow")) {
+			case SCMD_SHUTACTIVEVLOW: {
 				msg_admins(0, "\377y* Shutting down when dungeons are empty and very few (4) players are active *");
 				cfg.runlevel = 2044;
 				return;
 			}
 #if 0	/* not implemented yet - /shutempty is currently working this way */
-			else if (prefix(messagelc, "/shutsurface")) {
+			case SCMD_SHUTSURFACE: {
 				msg_admins(0, "\377y* Shutting down when noone is inside a dungeon/tower *");
 				cfg.runlevel = 2050;
 				return;
 			}
 #endif
-			else if (prefix(messagelc, "/shutxlow")) {
+			case SCMD_SHUTXLOW: {
 				msg_admins(0, "\377y* Shutting down when dungeons are empty and extremely few (3) players are on *");
 				cfg.runlevel = 2051;
 				return;
 			}
-			else if (prefix(messagelc, "/shutxxlow")) {
+			case SCMD_SHUTXXLOW: {
 				msg_admins(0, "\377y* Shutting down when dungeons are empty and *extremely* few (2) players are on *");
 				cfg.runlevel = 2053;
 				return;
 			}
-			else if (prefix(messagelc, "/shutulow")) {
+			case SCMD_SHUTULOW: {
 				msg_admins(0, "\377y* Shutting down when dungeons are empty and ultra-few (1) players are on *");
 				cfg.runlevel = 2041;
 				return;
 			}
-			else if (prefix(messagelc, "/shutrec")) { /* /shutrec [<minutes>] [T] */
+			case SCMD_SHUTREC: { /* /shutrec [<minutes>] [T] */
 				if (!k) k = 5;
 				if (strchr(message3, 'T')) timed_shutdown(k, TRUE);//terminate server for maintenance
 				else timed_shutdown(k, FALSE);
 				return;
 			}
-			else if (prefix(messagelc, "/shutcancel")) {
+			case SCMD_SHUTCANCEL: {
 				msg_admins(0, "\377w* Shut down cancelled *");
 				if (cfg.runlevel == 2043 || cfg.runlevel == 2042)
 					msg_broadcast_format(0, "\377I*** \377yServer-shutdown cancelled. \377I***");
 				cfg.runlevel = 6;
 				return;
 			}
-			else if (prefix(messagelc, "/val")) {
+			case SCMD_VAL: {
 				if (!tk) {
 					msg_print(Ind, "Usage: /val <player name>");
 					return;
@@ -7024,7 +8259,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/inval")) {
+			case SCMD_INVAL: {
 				if (!tk) {
 					msg_print(Ind, "Usage: /inval <player name>");
 					return;
@@ -7043,7 +8278,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/privilege")) {
+			case SCMD_PRIVILEGE: {
 				if (!tk) return;
 				/* added checking for account existence - mikaelh */
 				switch (privilege(message3, 1)) {
@@ -7055,7 +8290,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/vprivilege")) {
+			case SCMD_VPRIVILEGE: {
 				if (!tk) return;
 				/* added checking for account existence - mikaelh */
 				switch (privilege(message3, 2)) {
@@ -7067,7 +8302,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/unprivilege")) {
+			case SCMD_UNPRIVILEGE: {
 				if (!tk) return;
 				/* added checking for account existence - mikaelh */
 				switch (privilege(message3, 0)) {
@@ -7079,7 +8314,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/makeadmin")) {
+			case SCMD_MAKEADMIN: {
 				if (!tk) return;
 				/* added checking for account existence - mikaelh */
 				if (makeadmin(message3)) {
@@ -7089,7 +8324,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/banip")) { /* note: banip doesn't enter a hostname, use /bancombo for that */
+			case SCMD_BANIP: { /* note: banip doesn't enter a hostname, use /bancombo for that */
 				char *reason = NULL;
 				int time = tk > 1 ? atoi(token[2]) : 5; /* 5 minutes by default */
 				char kickmsg[MAX_SLASH_LINE_LEN];
@@ -7119,7 +8354,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				kick_ip(Ind, token[1], kickmsg, TRUE);
 				return;
 			}
-			else if (prefix(messagelc, "/ban") || prefix(messagelc, "/bancombo")) { /* note: ban and bancombo enter a hostname too */
+			case SCMD_BAN: { /* note: ban and bancombo enter a hostname too */
 				/* ban bans an account name, banip bans an ip address,
 				   bancombo bans an account name and an ip address - if ip address is not specified, it uses the ip address of the
 				   account name, who must be currently online. if the account is offline, bancombo reverts to normal /ban. */
@@ -7308,7 +8543,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/kickip")) {
+			case SCMD_KICKIP: {
 				char *reason = NULL;
 
 				if (!tk) {
@@ -7323,7 +8558,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				kick_ip(Ind, token[1], reason, TRUE);
 				return;
 			}
-			else if (prefix(messagelc, "/kick")) {
+			case SCMD_KICK: {
 				char *reason = NULL;
 				char reasonstr[MAX_CHARS];
 
@@ -7347,7 +8582,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				kick_char(Ind, j, reason);
 				return;
 			}
-			else if (prefix(messagelc, "/viewbans")) {
+			case SCMD_VIEWBANS: {
 				bool found = FALSE;
 				struct combo_ban *ptr;
 				char buf[MAX_CHARS];
@@ -7371,7 +8606,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				if (!found) msg_print(Ind, " \377s<empty>");
 				return;
 			}
-			else if (prefix(messagelc, "/unban")) {
+			case SCMD_UNBAN: {
 				/* unban unbans all entries of matching account name (no matter whether they also have an ip entry),
 				   unbancombo unbans all entries of matching account name or matching ip,
 				   unbanip unbans all entries of matching ip (no matter whether they also have an account name entry).
@@ -7460,7 +8695,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			/* The idea is to reduce the age of the target player because s/he was being
 			 * immature (and deny his/her chatting privilege). - the_sandman
 			 */
-			else if (prefix(messagelc, "/mute")) {
+			case SCMD_MUTE: {
 				if (tk) {
 					j = name_lookup_loose(Ind, message3, FALSE, TRUE, FALSE);
 					if (j) {
@@ -7481,7 +8716,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "\377oUsage: /mute <character name>");
 				return;
 			}
-			else if (prefix(messagelc, "/xmute")) {
+			case SCMD_XMUTE: {
 				if (tk) {
 					j = name_lookup_loose(Ind, message3, FALSE, TRUE, FALSE);
 					if (j) {
@@ -7501,7 +8736,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "\377oUsage: /xmute <character name>");
 				return;
 			}
-			else if (prefix(messagelc, "/unmute")) {   //oh no!
+			case SCMD_UNMUTE: {   //oh no!
 				if (tk) {
 					j = name_lookup_loose(Ind, message3, FALSE, TRUE, FALSE);
 					if (j) {
@@ -7525,7 +8760,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "\377oUsage: /unmute <character name>");
 				return;
 			}
-			else if (prefix(messagelc, "/xunmute")) {   //oh no!
+			case SCMD_XUNMUTE: {   //oh no!
 				if (tk) {
 					j = name_lookup_loose(Ind, message3, FALSE, TRUE, FALSE);
 					if (j) {
@@ -7549,7 +8784,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* erase items and monsters */
-			else if ((prefix(messagelc, "/clear-level") || prefix(messagelc, "/clv ") || !strcmp(messagelc, "/clv")) && !prefix(messagelc, "/clver")) {
+			case SCMD_CLEAR_LEVEL: {
 				bool full = (tk);
 
 				/* Wipe even if town/wilderness */
@@ -7571,7 +8806,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* erase items (prevent loot-mass-freeze) */
-			else if (prefix(messagelc, "/clear-items") || (prefix(messagelc, "/cli") && !prefix(messagelc, "/clinv"))) {
+			case SCMD_CLEAR_ITEMS: {
 				/* Wipe even if town/wilderness */
 				wipe_o_list_safely(&wp);
 
@@ -7579,7 +8814,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* erase ALL items (never use this when houses are on the map sector) */
-			else if (prefix(messagelc, "/clear-extra") || prefix(messagelc, "/xcli")) {
+			case SCMD_CLEAR_EXTRA: {
 				/* Wipe even if town/wilderness */
 				wipe_o_list(&wp);
 
@@ -7587,18 +8822,18 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* erase all non-artifacts on the floor */
-			else if (prefix(messagelc, "/clear-narts") || prefix(messagelc, "/nacli")) {
+			case SCMD_CLEAR_NARTS: {
 				wipe_o_list_nonarts(&wp);
 
 				msg_format(Ind, "\377rNon-artifact items on %s are cleared.", wpos_format(Ind, &wp));
 				return;
 			}
-			else if (prefix(messagelc, "/cp")) {
+			case SCMD_CP: {
 				party_check(Ind);
 				account_check(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/mdelete")) { /* delete the monster currently looked at */
+			case SCMD_MDELETE: { /* delete the monster currently looked at */
 				if (p_ptr->health_who <= 0) {//target_who
 					msg_print(Ind, "No monster looked at.");
 					return; /* no monster targetted */
@@ -7606,7 +8841,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				delete_monster_idx(p_ptr->health_who, TRUE);
 				return;
 			}
-			else if (prefix(messagelc, "/geno-level") || prefix(messagelc, "/geno")) { /* parameter: don't skip pets/golems/questors */
+			case SCMD_GENO_LEVEL: { /* parameter: don't skip pets/golems/questors */
 				bool full = (tk);
 
 				/* Wipe even if town/wilderness */
@@ -7616,7 +8851,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "\377r%sMonsters on %s are cleared.", full ? "ALL " : "", wpos_format(Ind, &wp));
 				return;
 			}
-			else if (prefix(messagelc, "/vanitygeno") || prefix(messagelc, "/vgeno")) { /* removes all no-death monsters */
+			case SCMD_VANITYGENO: { /* removes all no-death monsters */
 				for (i = m_max - 1; i >= 1; i--) {
 					monster_type *m_ptr = &m_list[i];
 
@@ -7630,7 +8865,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "\377rVanity monsters on %s are cleared.", wpos_format(Ind, &wp));
 				return;
 			}
-			else if (prefix(messagelc, "/mkill-level") || prefix(messagelc, "/mkill")) { /* Kill all monsters on the level. Parameter to kill them with obvious damage inflicted, for show. */
+			case SCMD_MKILL_LEVEL: { /* Kill all monsters on the level. Parameter to kill them with obvious damage inflicted, for show. */
 				bool fear, full = (tk);
 
 				for (i = m_max - 1; i >= 1; i--) {
@@ -7645,7 +8880,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "\377r%sMonsters on %s were killed.", full ? "ALL " : "", wpos_format(Ind, &p_ptr->wpos));
 				return;
 			}
-			else if (prefix(messagelc, "/ugeno")) { /* remove all unique monsters from the level. Parameter: Inverse: keep only uniques. */
+			case SCMD_UGENO: { /* remove all unique monsters from the level. Parameter: Inverse: keep only uniques. */
 				/* Delete all the monsters */
 				for (i = m_max - 1; i >= 1; i--) {
 					monster_type *m_ptr = &m_list[i];
@@ -7667,7 +8902,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/pandahi")) { /* tele-to's or summons the panda to you */
+			case SCMD_PANDAHI: { /* tele-to's or summons the panda to you */
 				int m_idx;
 				monster_type *m_ptr;
 				bool found = FALSE;
@@ -7682,7 +8917,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				if (!found) (void)summon_specific_race(&p_ptr->wpos, p_ptr->py, p_ptr->px, RI_PANDA, 0, 1);
 				return;
 			}
-			else if (prefix(messagelc, "/pandabye")) { /* removes the panda from current floor */
+			case SCMD_PANDABYE: { /* removes the panda from current floor */
 				int m_idx;
 				monster_type *m_ptr;
 
@@ -7698,7 +8933,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Deleted %d pandas.", i);
 				return;
 			}
-			else if (prefix(messagelc, "/untrap")) { /* remove all traps from floor */
+			case SCMD_UNTRAP: { /* remove all traps from floor */
 				cave_type **zcave, *c_ptr;
 				struct c_special *cs_ptr;
 				struct worldpos *wpos = &p_ptr->wpos;
@@ -7721,7 +8956,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "%d traps removed.", i);
 				return;
 			}
-			else if (prefix(messagelc, "/game")) {
+			case SCMD_GAME: {
 				if (!tk) {
 					msg_print(Ind, "Usage: /game stop   or   /game rugby");
 					return;
@@ -7759,14 +8994,15 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 					for (k = 1; k <= NumPlayers; k++)
 						Players[k]->team = 0;
 				}
+				break;
 			}
-			else if (prefix(messagelc, "/unstatic-level") || prefix(messagelc, "/unst")) {
+			case SCMD_UNSTATIC_LEVEL: {
 				/* no sanity check, so be warned! */
 				master_level_specific(Ind, &wp, "u");
 				//msg_format(Ind, "\377rItems and monsters on %dft is cleared.", k * 50);
 				return;
 			}
-			else if (prefix(messagelc, "/treset")) {
+			case SCMD_TRESET: {
 				struct worldpos wpos;
 
 				wpcopy(&wpos, &p_ptr->wpos);
@@ -7774,14 +9010,14 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				dealloc_dungeon_level(&wpos);
 				return;
 			}
-			else if (prefix(messagelc, "/static-level") || prefix(messagelc, "/stat")) {
+			case SCMD_STATIC_LEVEL: {
 				/* no sanity check, so be warned! */
 				master_level_specific(Ind, &wp, "s");
 				//msg_format(Ind, "\377rItems and monsters on %dft is cleared.", k * 50);
 				return;
 			}
 			/* TODO: make this player command (using spells, scrolls etc) */
-			else if (prefix(messagelc, "/identify") || prefix(messagelc, "/id")) {
+			case SCMD_IDENTIFY: {
 				identify_pack(Ind);
 
 				/* Combine the pack */
@@ -7792,7 +9028,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 
 				return;
 			}
-			else if (prefix(messagelc, "/sartifact") || prefix(messagelc, "/sart")) {
+			case SCMD_SARTIFACT: {
 				if (k) {
 					if (a_info[k].cur_num) {
 						a_info[k].cur_num = 0;
@@ -7852,7 +9088,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				} else msg_print(Ind, "Usage: /sartifact (No. | (show | fix | reset! | ban!)");
 				return;
 			}
-			else if (prefix(messagelc, "/auniques")) {
+			case SCMD_AUNIQUES: {
 				monster_race *r_ptr;
 				if (!tk) {
 					msg_print(Ind, "Usage: /auniques <seen|unseen|kill|nonkill>");
@@ -7891,7 +9127,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/fixuniques")) {
+			case SCMD_FIXUNIQUES: {
 				monster_race *r_ptr;
 				int fixed = 0;
 
@@ -7906,7 +9142,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "%d uniques were fixed from being 'unseen' despite killed, now 'seen'.", fixed);
 				return;
 			}
-			else if (prefix(messagelc, "/aunique")) {
+			case SCMD_AUNIQUE: {
 				monster_race *r_ptr;
 
 				if (tk < 2) {
@@ -7938,7 +9174,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/aunidisable")) {
+			case SCMD_AUNIDISABLE: {
 				if (k) {
 					if (!(r_info[k].flags1 & RF1_UNIQUE)) return;
 					if (r_info[k].max_num) {
@@ -7953,7 +9189,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/auniunkill")) {
+			case SCMD_AUNIUNKILL: {
 				if (k) {
 					if (!(r_info[k].flags1 & RF1_UNIQUE)) {
 						msg_print(Ind, "That's not a unique monster.");
@@ -7970,7 +9206,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/aunicheck")) {
+			case SCMD_AUNICHECK: {
 				if (!k || !(r_info[k].flags1 & RF1_UNIQUE)) {
 					msg_print(Ind, "Usage: /aunicheck <unique_monster_index>");
 					return;
@@ -7979,7 +9215,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				    k, r_name + r_info[k].name, r_info[k].cur_num, r_info[k].max_num);
 				return;
 			}
-			else if (prefix(messagelc, "/aunifix")) {
+			case SCMD_AUNIFIX: {
 				if (!k || !(r_info[k].flags1 & RF1_UNIQUE)) {
 					msg_print(Ind, "Usage: /aunifix <unique_monster_index>");
 					return;
@@ -8001,7 +9237,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "(%d) %s has been set to zero cur_num.", k, r_name + r_info[k].name);
 				return;
 			}
-			else if (prefix(messagelc, "/curnumcheck")) {
+			case SCMD_CURNUMCHECK: {
 				int i;
 				bool uniques_only = (tk);
 
@@ -8020,7 +9256,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "done.");
 				return;
 			}
-			else if (prefix(messagelc, "/curnumfix")) {
+			case SCMD_CURNUMFIX: {
 				/* Fix r_info[i].cur_num counts */
 				int i;
 				bool uniques_only = (tk);
@@ -8041,7 +9277,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "cur_num fields fixed for all %s.", uniques_only ? "uniques" : "monsters");
 				return;
 			}
-			else if (prefix(messagelc, "/reload-config") || prefix(messagelc, "/cfg")) {
+			case SCMD_RELOAD_CONFIG: {
 				if (tk) {
 					if (MANGBAND_CFG != NULL) string_free(MANGBAND_CFG);
 					MANGBAND_CFG = string_make(token[1]);
@@ -8055,7 +9291,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Admin wishing :) */
-			else if (prefix(messagelc, "/xwish")) {
+			case SCMD_XWISH: {
 				int tval, sval, bpval = 0, pval = 0, name1 = 0, name2 = 0, name2b = 0, number = 1;
 
 				if (tk < 2 || tk > 8) {
@@ -8087,7 +9323,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* actually wish a (basic) item by item name - C. Blue */
-			else if (prefix(messagelc, "/nwish")) {
+			case SCMD_NWISH: {
 				object_kind *k_ptr;
 				object_type forge;
 				object_type *o_ptr = &forge;
@@ -8286,7 +9522,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* wish a true artifact by name */
-			else if (prefix(messagelc, "/awish")) {
+			case SCMD_AWISH: {
 				artifact_type *a_ptr = NULL;
 				object_type forge, *o_ptr = &forge;
 				int kidx;
@@ -8373,7 +9609,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* actually wish a spell scroll/crystal by item name - C. Blue */
-			else if (prefix(messagelc, "/swish")) {
+			case SCMD_SWISH: {
 				object_type forge;
 				object_type *o_ptr = &forge;
 				char *s, *item;
@@ -8558,12 +9794,12 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/trap")) { /* Place a trap in the floor */
+			case SCMD_TRAP: { /* Place a trap in the floor */
 				if (k) wiz_place_trap(Ind, k);
 				else wiz_place_trap(Ind, TRAP_OF_FILLING);
 				return;
 			}
-			else if (prefix(messagelc, "/ctrap")) { /* Place a trap on a chest */
+			case SCMD_CTRAP: { /* Place a trap on a chest */
 				struct worldpos *wpos = &p_ptr->wpos;
 				cave_type **zcave, *c_ptr;
 				int x = p_ptr->px, y = p_ptr->py;
@@ -8579,7 +9815,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				else o_ptr->pval = TRAP_OF_FILLING;
 				return;
 			}
-			else if (prefix(messagelc, "/enlight") || prefix(messagelc, "/en")) {
+			case SCMD_ENLIGHT: {
 				wiz_lite_extra(Ind);
 				//(void)detect_treasure(Ind, DEFAULT_RADIUS * 2);
 				//(void)detect_object(Ind, DEFAULT_RADIUS * 2);
@@ -8600,29 +9836,29 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 
 				return;
 			}
-			else if (prefix(messagelc, "/wizlightx")) {
+			case SCMD_WIZLIGHTX: {
 				wiz_lite_extra(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/wizlight")) {
+			case SCMD_WIZLIGHT: {
 				wiz_lite(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/wizdark")) {
+			case SCMD_WIZDARK: {
 				wiz_dark(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/lr")) { /* lite room, no damage, but can wake up. */
+			case SCMD_LR: { /* lite room, no damage, but can wake up. */
 				msg_print(Ind, "You are surrounded by a globe of light.");
 				lite_room(Ind, &p_ptr->wpos, p_ptr->py, p_ptr->px);
 				return;
 			}
-			else if (prefix(messagelc, "/la")) { /* lite area (globe of light), 0 damage, but can wake up. Parameter = radius [2] */
+			case SCMD_LA: { /* lite area (globe of light), 0 damage, but can wake up. Parameter = radius [2] */
 				if (!tk) lite_area(Ind, 0, 2);
 				lite_area(Ind, 0, k);
 				return;
 			}
-			else if (prefix(messagelc, "/equip") || prefix(messagelc, "/eq")) {
+			case SCMD_EQUIP: {
 				if (tk) admin_outfit(Ind, k);
 				//else admin_outfit(Ind, -1);
 				else {
@@ -8633,12 +9869,12 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				p_ptr->skill_points = 9999;
 				return;
 			}
-			else if (prefix(messagelc, "/uncurse") || prefix(messagelc, "/unc")) {
+			case SCMD_UNCURSE: {
 				remove_all_curse(Ind);
 				return;
 			}
 			/* do a wilderness cleanup */
-			else if (prefix(messagelc, "/purgewild")) {
+			case SCMD_PURGEWILD: {
 				msg_format(Ind, "previous server status: m_max(%d) o_max(%d)",
 						m_max, o_max);
 				compact_monsters(0, TRUE);
@@ -8651,7 +9887,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			/* Refresh stores
 			 * XXX very slow */
-			else if (prefix(messagelc, "/store")) {
+			case SCMD_STORE: {
 				if (tk && token[1][0] == 'f') {
 					int i;
 
@@ -8674,7 +9910,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Empty the store we're currently in */
-			else if (prefix(messagelc, "/stnew")) {
+			case SCMD_STNEW: {
 				int t = gettown(Ind);
 				store_type *st_ptr;
 				object_type *o_ptr;
@@ -8710,7 +9946,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
    and just move the tomenet.log viewing to a new command "/log", named appropriately. - C. Blue */
 			/* take 'cheezelog'
 			 * result is output to the logfile */
-			else if (prefix(messagelc, "/cheeze")) {
+			case SCMD_CHEEZE: {
 				char path[MAX_PATH_LENGTH];
 				object_type *o_ptr;
 
@@ -8725,7 +9961,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #endif
-			else if (prefix(messagelc, "/log") && !prefix(messagelc, "/log_u")) {
+			case SCMD_LOG: {
 				char path[MAX_PATH_LENGTH];
 
 				//(segfaults inspecting an item for example) -- strcpy(p_ptr->infofile, message3); //abuse this as temp storage
@@ -8733,7 +9969,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				do_cmd_check_other_prepare(Ind, path, "Server Log File");
 				return;
 			}
-			else if (prefix(messagelc, "/linv")) { /* List new invalid account names that tried to log in meanwhile */
+			case SCMD_LINV: { /* List new invalid account names that tried to log in meanwhile */
 				for (i = 0; i < MAX_LIST_INVALID; i++) {
 					if (!list_invalid_name[i][0]) break;
 					msg_format(Ind, "  #%d) %s %s@%s (%s)", i, list_invalid_date[i], list_invalid_name[i], list_invalid_host[i], list_invalid_addr[i]);
@@ -8741,13 +9977,13 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				if (!i) msg_print(Ind, "No invalid accounts recorded.");
 				return;
 			}
-			else if (prefix(messagelc, "/clinv")) { /* Clear list of new invalid account names that tried to log in meanwhile */
+			case SCMD_CLINV: { /* Clear list of new invalid account names that tried to log in meanwhile */
 				for (i = 0; i < MAX_LIST_INVALID; i++)
 					list_invalid_name[i][0] = 0;
 				msg_print(Ind, "List of invalid accounts has been cleared.");
 				return;
 			}
-			else if (prefix(messagelc, "/dinv")) { /* Delete one entry from list of new invalid account names that tried to log in meanwhile */
+			case SCMD_DINV: { /* Delete one entry from list of new invalid account names that tried to log in meanwhile */
 				if (!tk || k < 0 || k >= MAX_LIST_INVALID) {
 					msg_format(Ind, "Usage: /dinv <list entry # [0..%d] | '*'>", MAX_LIST_INVALID - 1);
 					return;
@@ -8782,7 +10018,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/vinv")) { /* Validate one entry from list of new invalid account names that tried to log in meanwhile, or '*' for all */
+			case SCMD_VINV: { /* Validate one entry from list of new invalid account names that tried to log in meanwhile, or '*' for all */
 				if (!tk || k < 0 || k >= MAX_LIST_INVALID) {
 					msg_format(Ind, "Usage: /vinv <list entry # [0..%d] | '*'>", MAX_LIST_INVALID - 1);
 					return;
@@ -8823,7 +10059,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			/* Respawn monsters on the floor
 			 * TODO: specify worldpos to respawn */
-			else if (prefix(messagelc, "/respawn")) {
+			case SCMD_RESPAWN: {
 				/* Set the monster generation depth */
 				monster_level = getlevel(&p_ptr->wpos);
 				msg_format(Ind, "Respawning monsters of level %d here.", monster_level);
@@ -8831,7 +10067,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				else wild_add_monster(&p_ptr->wpos);
 				return;
 			}
-			else if (prefix(messagelc, "/log_u")) {
+			case SCMD_LOG_U: {
 				if (tk) {
 					if (!strcmp(token[1], "on")) {
 						msg_print(Ind, "log_u is now on");
@@ -8850,7 +10086,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				else msg_print(Ind, "log_u is off");
 				return;
 			}
-			else if (prefix(messagelc, "/noarts")) {
+			case SCMD_NOARTS: {
 				if (tk) {
 					if (!strcmp(token[1], "on")) {
 						msg_print(Ind, "artifact generation is now supressed");
@@ -8871,7 +10107,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 #if 0 //not implemented
 			/* C. Blue's mad debug code to swap Minas Anor and Khazad-Dum on the worldmap :) */
-			else if (prefix(messagelc, "/swap-towns")) {
+			case SCMD_SWAP_TOWNS: {
 				int a = tk, b = atoi(token[2]);
 				int x, y;
 				struct worldpos wpos1, wpos2;
@@ -8928,7 +10164,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #endif
-			else if (prefix(messagelc, "/debug-towns")) {
+			case SCMD_DEBUG_TOWNS: {
 				msg_format(Ind, "numtowns = %d", numtowns);
 				for (i = 0; i < numtowns; i++) {
 					msg_format(Ind, "%d: type = %d, x = %d, y = %d",
@@ -8937,7 +10173,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* manually reposition dungeon/tower stairs within the current worldmap surface sector - C. Blue */
-			else if (prefix(messagelc, "/move-stair")) {
+			case SCMD_MOVE_STAIR: {
 				int scx, scy;
 				worldpos *tpos = &p_ptr->wpos;
 				cave_type **zcave = getcave(tpos);
@@ -8956,6 +10192,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 								new_level_up_y(tpos, p_ptr->py);
 								new_level_up_x(tpos, p_ptr->px);
 								zcave[p_ptr->py][p_ptr->px].feat = FEAT_MORE;
+								bump_feat_epoch(tpos);
 								return;
 							}
 						}
@@ -8965,6 +10202,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 								new_level_down_y(tpos, p_ptr->py);
 								new_level_down_x(tpos, p_ptr->px);
 								zcave[p_ptr->py][p_ptr->px].feat = FEAT_LESS;
+								bump_feat_epoch(tpos);
 								return;
 							}
 						}
@@ -8974,7 +10212,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* catch problematic stair coords everywhere */
-			else if (prefix(messagelc, "/debug-stairs")) {
+			case SCMD_DEBUG_STAIRS: {
 				int wx, wy, x, y, xo, yo;
 				struct worldpos tpos;
 				bool always_relocate_x = FALSE, always_relocate_y = FALSE, personal_relocate = FALSE;
@@ -9024,7 +10262,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/debug-dun")) {
+			case SCMD_DEBUG_DUN: {
 				bool tower;
 				struct dungeon_type *d_ptr = admin_dun(Ind, &tower);
 
@@ -9036,7 +10274,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Toggles between listing a dungeon as usual, or adding the unlisted flag to hide it, eg if under development and not public yet or just testing stuff */
-			else if (prefix(messagelc, "/unlistdun")) {
+			case SCMD_UNLISTDUN: {
 				bool tower, listed = TRUE;
 				struct dungeon_type *d_ptr = admin_dun(Ind, &tower);
 
@@ -9047,7 +10285,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Dungeon (%s) was so far %s, is now %s.", tower ? "tower" : "dungeon", listed ? "listed" : "unlisted", listed ? "unlisted" : "listed");
 				return;
 			}
-			else if (prefix(messagelc, "/update-dun")) { /* NOTE: Crashes when the dungeon/tower turns into a tower/dungeon. TODO: Fix! */
+			case SCMD_UPDATE_DUN: { /* NOTE: Crashes when the dungeon/tower turns into a tower/dungeon. TODO: Fix! */
 				/* Reloads dungeon flags from d_info.txt, updating existing
 				   dungeons. Note that you have to call this after you made changes
 				   to d_info.txt, since dungeons will NOT update automatically.
@@ -9276,7 +10514,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 				return;
 			}
-			else if (prefix(messagelc, "/swap-dun")) {
+			case SCMD_SWAP_DUN: {
 				/* Move a predefined dungeon (in d_info.txt) to our worldmap sector - C. Blue */
 				int type, x, y;
 				struct dungeon_type *d_ptr, *d_ptr_tmp;
@@ -9323,6 +10561,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 							wild_new->surface.dn_x = p_ptr->px;
 							wild_new->surface.dn_y = p_ptr->py;
 							zcave[p_ptr->py][p_ptr->px].feat = FEAT_LESS;
+							bump_feat_epoch(&p_ptr->wpos);
 
 							if (d_ptr->id != 0) {
 								dungeon_x[d_ptr->id] = x;
@@ -9366,6 +10605,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 							wild_new->surface.up_x = p_ptr->px;
 							wild_new->surface.up_y = p_ptr->py;
 							zcave[p_ptr->py][p_ptr->px].feat = FEAT_MORE;
+							bump_feat_epoch(&p_ptr->wpos);
 
 							if (d_ptr->id != 0) {
 								dungeon_x[d_ptr->id] = x;
@@ -9402,7 +10642,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 				return;
 			}
-			else if (prefix(messagelc, "/remdun")) { /* forcefully removes a dungeon or tower, even if someone is inside (gets recalled), even if there is no staircase. */
+			case SCMD_REMDUN: { /* forcefully removes a dungeon or tower, even if someone is inside (gets recalled), even if there is no staircase. */
 				if (!tk) {
 					msg_print(Ind, "Usage: /remdun (d/t)");
 					return;
@@ -9410,7 +10650,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Dungeon removal %s.", rem_dungeon(&p_ptr->wpos, token[1][0] != 'd') ? "succeeded" : "failed");
 				return;
 			}
-			else if (prefix(messagelc, "/debug-pos")) {
+			case SCMD_DEBUG_POS: {
 				/* C. Blue's mad debug code to change player @
 				   startup positions in Bree (px, py) */
 				new_level_rand_x(&p_ptr->wpos, atoi(token[1]));
@@ -9418,7 +10658,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Set x=%d, y=%d for this wpos.", atoi(token[1]), atoi(token[2]));
 				return;
 			}
-			else if (prefix(messagelc, "/forgetdun")) {
+			case SCMD_FORGETDUN: {
 				bool tower;
 				struct dungeon_type *d_ptr = admin_dun(Ind, &tower);
 
@@ -9428,7 +10668,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "\377rDungeon is know UNKNOWN.");
 				return;
 			}
-			else if (prefix(messagelc, "/knowdun")) { /* (Just for adding IDDC on test server) */
+			case SCMD_KNOWDUN: { /* (Just for adding IDDC on test server) */
 				bool tower;
 				struct dungeon_type *d_ptr = admin_dun(Ind, &tower);
 
@@ -9438,7 +10678,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "\377GDungeon is know FULLY KNOWN.");
 				return;
 			}
-			else if (prefix(messagelc, "/forgettown")) {
+			case SCMD_FORGETTOWN: {
 				if (tk < 1 || k < 0 || k >= numtowns) {
 					msg_print(Ind, "Usage: /forgettown <basic town index [0..4]>");
 					return;
@@ -9447,7 +10687,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "\377GTown '%s' is know unknown.", town_profile[town[k].type].name);
 				return;
 			}
-			else if (prefix(messagelc, "/knowtown")) {
+			case SCMD_KNOWTOWN: {
 				if (tk < 1 || k < 0 || k >= numtowns) {
 					msg_print(Ind, "Usage: /knowtown <basic town index [0..4]>");
 					return;
@@ -9457,7 +10697,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Find a particular feat anywhere on the world surface */
-			else if (prefix(messagelc, "/wlocfeat")) {
+			case SCMD_WLOCFEAT: {
 				int wx, wy, x, y, found = 0;
 				struct worldpos tpos;
 				cave_type **zcave, *c_ptr;
@@ -9509,12 +10749,12 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				else msg_print(Ind, "Done.");
 				return;
 			}
-			else if (prefix(messagelc, "/reloadmotd")) {
+			case SCMD_RELOADMOTD: {
 				/* update MotD changes on the fly */
 				exec_lua(0, format("set_motd()"));
 				return;
 			}
-			else if (prefix(messagelc, "/anotes")) {
+			case SCMD_ANOTES: {
 				int notes = 0;
 
 				for (i = 0; i < MAX_ADMINNOTES; i++) {
@@ -9535,7 +10775,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/danote")) { /* Delete a global admin note to everyone */
+			case SCMD_DANOTE: { /* Delete a global admin note to everyone */
 				int notes = 0;
 
 				if ((tk < 1) || (strlen(message2) < 8)) { /* Explain command usage */
@@ -9559,7 +10799,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/anote")) { /* Send a global admin note to everyone */
+			case SCMD_ANOTE: { /* Send a global admin note to everyone */
 				j = 0;
 				if (tk < 1) { /* Explain command usage */
 					msg_print(Ind, "\377oUsage: /anote <text>");
@@ -9591,7 +10831,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				} else msg_format(Ind, "\377oSorry, the server reached the maximum of %d pending admin notes.", MAX_ADMINNOTES);
 				return;
 			}
-			else if (prefix(messagelc, "/manote")) { /* Modify a global admin note */
+			case SCMD_MANOTE: { /* Modify a global admin note */
 				char *c;
 
 				j = 0;
@@ -9609,11 +10849,11 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "\377yNote has been stored.");
 				return;
 			}
-			else if (prefix(messagelc, "/broadcast-motd")) { /* Display all admin notes aka motd, plus any shutrec-warning, to all players. */
+			case SCMD_BROADCAST_MOTD: { /* Display all admin notes aka motd, plus any shutrec-warning, to all players. */
 				lua_broadcast_motd();
 				return;
 			}
-			else if (prefix(messagelc, "/swarn")) { /* Send a global server warning everyone */
+			case SCMD_SWARN: { /* Send a global server warning everyone */
 				j = 0;
 
 				if (tk < 1) {
@@ -9635,7 +10875,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				if (server_warning[0]) msg_broadcast_format(0, "\374\377R*** Note: %s ***", server_warning);
 				return;
 			}
-			else if (prefix(messagelc, "/reart")) { /* re-roll a random artifact */
+			case SCMD_REART: { /* re-roll a random artifact */
 				object_type *o_ptr;
 				u32b f1, f2, f3, f4, f5, f6, esp;
 				int min_pval = -999, min_ap = -999, tries = 10000, min_todam = -999;
@@ -9761,7 +11001,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				p_ptr->window |= (PW_INVEN | PW_EQUIP | PW_PLAYER);
 				return;
 			}
-			else if (prefix(messagelc, "/debugart")) { /* re-roll a random artifact */
+			case SCMD_DEBUGART: { /* re-roll a random artifact */
 				object_type *o_ptr;
 				int tries = 1;
 
@@ -9813,7 +11053,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				p_ptr->window |= (PW_INVEN | PW_EQUIP | PW_PLAYER);
 				return;
 			}
-			else if (prefix(messagelc, "/reego")) { /* re-roll an ego item */
+			case SCMD_REEGO: { /* re-roll an ego item */
 				object_type *o_ptr;
 
 				if (tk < 1) {
@@ -9846,7 +11086,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* very dangerous if player is poisoned, very weak, or has hp draining */
-			else if (prefix(messagelc, "/threaten") || prefix(messagelc, "/thr")) { /* Nearly kill someone, as threat >:) */
+			case SCMD_THREATEN: { /* Nearly kill someone, as threat >:) */
 				j = name_lookup_loose(Ind, message3, FALSE, TRUE, FALSE);
 				if (!tk) {
 					msg_print(Ind, "Usage: /threaten <player name>");
@@ -9862,7 +11102,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(j, "\377rThat was close huh?!");
 				return;
 			}
-			else if (prefix(messagelc, "/aslap")) { /* Slap someone around, as threat :-o */
+			case SCMD_ASLAP: { /* Slap someone around, as threat :-o */
 				if (!tk) {
 					msg_print(Ind, "Usage: /aslap <player name>");
 					return;
@@ -9888,7 +11128,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/apat")) { /* Counterpart to /slap :-p */
+			case SCMD_APAT: { /* Counterpart to /slap :-p */
 				if (!tk) {
 					msg_print(Ind, "Usage: /apat <player name>");
 					return;
@@ -9900,7 +11140,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format_near(j, "\377y%s is patted by something invisible.", Players[j]->name);
 				return;
 			}
-			else if (prefix(messagelc, "/ahug")) { /* Counterpart to /slap :-p */
+			case SCMD_AHUG: { /* Counterpart to /slap :-p */
 				if (!tk) {
 					msg_print(Ind, "Usage: /ahug <player name>");
 					return;
@@ -9912,7 +11152,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format_near(j, "\377y%s is hugged by something invisible.", Players[j]->name);
 				return;
 			}
-			else if (prefix(messagelc, "/apoke")) {
+			case SCMD_APOKE: {
 				if (!tk) {
 					msg_print(Ind, "Usage: /apoke <player name>");
 					return;
@@ -9924,7 +11164,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format_near(j, "\377y%s is being poked by something invisible.", Players[j]->name);
 				return;
 			}
-			else if (prefix(messagelc, "/strangle")) {/* oO */
+			case SCMD_STRANGLE: {/* oO */
 				if (!tk) {
 					msg_print(Ind, "Usage: /strangle <player name>");
 					return;
@@ -9940,7 +11180,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				bypass_invuln = FALSE;
 				return;
 			}
-			else if (prefix(messagelc, "/acheer")) {
+			case SCMD_ACHEER: {
 				if (!tk) {
 					msg_print(Ind, "Usage: /acheer <player name>");
 					return;
@@ -9953,7 +11193,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				set_blessed(j, randint(5) + 15, TRUE);
 				return;
 			}
-			else if (prefix(messagelc, "/aapplaud")) {
+			case SCMD_AAPPLAUD: {
 				if (!tk) {
 					msg_print(Ind, "Usage: /applaud <player name>");
 					return;
@@ -9969,7 +11209,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				set_hero(j, randint(5) + 15);
 				return;
 			}
-			else if (prefix(messagelc, "/presence")) {
+			case SCMD_PRESENCE: {
 				if (!tk) {
 					msg_print(Ind, "Usage: /presence <player name>");
 					return;
@@ -9980,7 +11220,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format_near(j, "\377yYou feel an invisible presence near %s!", Players[j]->name);
 				return;
 			}
-			else if (prefix(messagelc, "/snicker")) {
+			case SCMD_SNICKER: {
 				if (!tk) {
 					msg_print(Ind, "Usage: /snicker <player name>");
 					return;
@@ -9993,11 +11233,11 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				set_afraid(j, Players[j]->afraid + 6);
 				return;
 			}
-			else if (prefix(messagelc, "/deltown")) {
+			case SCMD_DELTOWN: {
 				deltown(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/chouse")) { /* count houses/castles -- USE THIS TO FIX BUGS LIKE "character cannot own more than 1" but has actually 0 houses */
+			case SCMD_CHOUSE: { /* count houses/castles -- USE THIS TO FIX BUGS LIKE "character cannot own more than 1" but has actually 0 houses */
 				/* However, if a character owns a 'ghost house' that isn't generated in the game world, use /unownhouse to remove it from his list first, then run this.
 				   Use /ahl to fix account-house miscount. */
 				if (!tk) {
@@ -10012,7 +11252,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* fix insane hit dice of a golem manually - gotta solve the bug really */
-			else if (prefix(messagelc, "/mblowdice") || prefix(messagelc, "/mbd")) {
+			case SCMD_MBLOWDICE: {
 				cave_type *c_ptr, **zcave = getcave(&p_ptr->wpos);
 				monster_type *m_ptr;
 				int x, y, i;
@@ -10034,14 +11274,14 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Umm, well I added this for testing purpose =) - C. Blue */
-			else if (prefix(messagelc, "/crash")) {
+			case SCMD_CRASH: {
 				msg_print(Ind, "\377RCRASHING");
 				s_printf("$CRASHING$\n");
 				s_printf("%s", (char *)666);
 				return; /* ^^ */
 			}
 			/* Assign all houses of a <party> or <guild> to a <player> instead (chown) - C. BLue */
-			else if (prefix(messagelc, "/citychown")) {
+			case SCMD_CITYCHOWN: {
 				int c = 0;
 #if 0
 				int p; - after 'return': p = name_lookup_loose(Ind, token[2], FALSE, FALSE, FALSE);
@@ -10088,7 +11328,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* This one is to fix houses which were changed by an outdated version of /citychown =p */
-			else if (prefix(messagelc, "/fixchown")) {
+			case SCMD_FIXCHOWN: {
 				int c = 0;
 				int p;
 
@@ -10113,7 +11353,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Check house number */
-			else if (prefix(messagelc, "/listhouses")) {
+			case SCMD_LISTHOUSES: {
 				int cp = 0, cy = 0, cg = 0;
 
 				if (tk < 1) {
@@ -10140,7 +11380,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* List all specially created houses */
-			else if (prefix(messagelc, "/polyhouses")) {
+			case SCMD_POLYHOUSES: {
 				for (i = 0; i < num_houses; i++) {
 					if (houses[i].flags & HF_RECT) continue;
 					msg_format(Ind, "Poly-house %d at %d,%d,%d.", i, houses[i].wpos.wx, houses[i].wpos.wy, houses[i].wpos.wz);
@@ -10149,7 +11389,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* display a player's hit dice dna */
-			else if (prefix(messagelc, "/pyhpdbg")) {
+			case SCMD_PYHPDBG: {
 				char buf[MSG_LEN];
 				int p;
 
@@ -10171,7 +11411,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Reroll a player's birth hitdice to test major changes - C. Blue */
-			else if (prefix(messagelc, "/rollchar")) {
+			case SCMD_ROLLCHAR: {
 				int p;
 
 				if (tk < 1) {
@@ -10186,7 +11426,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Reroll a player's HP a lot and measure */
-			else if (prefix(messagelc, "/roll!char")) {
+			case SCMD_ROLL_CHAR: {
 				int p, min = 9999, max = 0;
 				long avg = 0;
 
@@ -10209,7 +11449,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Reroll a player's background history text (for d-elves/vampires/draconians, maybe ents) */
-			else if (prefix(messagelc, "/rollhistory")) {
+			case SCMD_ROLLHISTORY: {
 				int p;
 
 				if (tk < 1) {
@@ -10224,7 +11464,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Rerolled history for %s.", Players[p]->name);
 				return;
 			}
-			else if (prefix(messagelc, "/checkhistory")) {
+			case SCMD_CHECKHISTORY: {
 				int p;
 
 				if (tk < 1) {
@@ -10238,7 +11478,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Reset a player's racial/class exp%, updating it in case it got changed ('verify') - C. Blue */
-			else if (prefix(messagelc, "/vxp")) {
+			case SCMD_VXP: {
 				int p;
 
 				if (tk < 1) {
@@ -10252,11 +11492,11 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Turn all non-everlasting items inside a house to everlasting items if the owner is everlasting */
-			else if (prefix(messagelc, "/everhouse")) {
+			case SCMD_EVERHOUSE: {
 				/* house_contents_chmod .. (scan_obj style) */
 			}
 			/* Blink a player */
-			else if (prefix(messagelc, "/blink")) {
+			case SCMD_BLINK: {
 				int p;
 
 				if (tk < 1) {
@@ -10272,7 +11512,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Teleport a player */
-			else if (prefix(messagelc, "/tport")) {
+			case SCMD_TPORT: {
 				int p;
 
 				if (tk < 1) {
@@ -10288,7 +11528,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Teleport a player to a target */
-			else if (prefix(messagelc, "/tptar")) {
+			case SCMD_TPTAR: {
 				int p, x, y, ox, oy;
 				player_type *q_ptr;
 				cave_type **zcave;
@@ -10353,9 +11593,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Teleport a player to us - even if in different world sector */
-			else if (prefix(messagelc, "/tpto") ||
-			/* Teleport us to a player - even if in different world sector */
-			    prefix(messagelc, "/tpat")) {
+			case SCMD_TPTO: { /* Teleport us to a player - even if in different world sector */
 				int p;
 				player_type *q_ptr;
 				cave_type **zcave;
@@ -10410,8 +11648,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Move to a specific floor (x,y) position on the current level */
-			else if ((prefix(messagelc, "/loc") || prefix(messagelc, "/locate"))
-			    && !prefix(messagelc, "/locateart")) {
+			case SCMD_LOC: {
 				int x, y, ox, oy;
 				cave_type **zcave;
 
@@ -10469,19 +11706,19 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* STRIP ALL TRUE ARTIFACTS FROM ALL PLAYERS (!) */
-			else if (prefix(messagelc, "/strathash")) {
+			case SCMD_STRATHASH: {
 				msg_print(Ind, "Stripping all players.");
 				lua_strip_true_arts_from_absent_players();
 				return;
 			}
 			/* STRIP ALL TRUE ARTIFACTS FROM ALL FLOORS */
-			else if (prefix(messagelc, "/stratmap")) {
+			case SCMD_STRATMAP: {
 				msg_print(Ind, "Stripping all floors.");
 				lua_strip_true_arts_from_floors();
 				return;
 			}
 			/* STRIP ALL TRUE ARTIFACTS FROM A PLAYER */
-			else if (prefix(messagelc, "/strat")) {
+			case SCMD_STRAT: {
 				int p = name_lookup_loose(Ind, message3, FALSE, FALSE, FALSE);
 
 				if (!p) return;
@@ -10490,7 +11727,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* wipe wilderness map of tournament players - mikaelh */
-			else if (prefix(messagelc, "/wipewild")) {
+			case SCMD_WIPEWILD: {
 				int p;
 
 				if (!tk) {
@@ -10505,7 +11742,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Find all true arts in o_list an tell where they are - mikaelh */
-			else if (prefix(messagelc, "/findarts")) {
+			case SCMD_FINDARTS: {
 				msg_print(Ind, "finding arts..");
 				object_type *o_ptr;
 				char o_name[ONAME_LEN];
@@ -10523,7 +11760,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Locate or ERASE an artifact ANYWHERE in the game really */
-			else if (prefix(messagelc, "/locateart") || prefix(messagelc, "/eraseart")) {
+			case SCMD_LOCATEART: {
 				bool erase = prefix(messagelc, "/eraseart");
 
 				if (tk < 1) {
@@ -10537,7 +11774,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				else msg_print(Ind, "That artifact is nowhere to be found!");
 				return;
 			}
-			else if (prefix(messagelc, "/debug-store")) {
+			case SCMD_DEBUG_STORE: {
 				/* Debug store size - C. Blue */
 				store_type *st_ptr;
 				store_info_type *sti_ptr;
@@ -10553,7 +11790,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				    i, st_name + sti_ptr->name, st_ptr->stock_size, sti_ptr->max_obj);
 				return;
 			}
-			else if (prefix(messagelc, "/acclist")) { /* list all living characters of a specified account name - C. Blue */
+			case SCMD_ACCLIST: { /* list all living characters of a specified account name - C. Blue */
 				int *id_list, i, n;
 				struct account acc;
 				u32b tmpm;
@@ -10597,7 +11834,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/characc")) { /* and /characcl; returns account name to which the given character name belongs -- extended version of /who */
+			case SCMD_CHARACC: { /* and /characcl; returns account name to which the given character name belongs -- extended version of /who */
 				s32b p_id;
 				cptr accname;
 				struct account acc;
@@ -10647,7 +11884,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				WIPE(&acc, struct account);
 				return;
-			} else if (prefix(messagelc, "/changeacc")) { /* changes the accout a character belongs to! */
+			}
+			case SCMD_CHANGEACC: { /* changes the accout a character belongs to! */
 				struct account acc;
 				int id;
 				char *colon;
@@ -10669,7 +11907,8 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				player_change_account(Ind, id, acc.id);
 				return;
-			} else if (prefix(messagelc, "/addnewdun")) {
+			}
+			case SCMD_ADDNEWDUN: {
 				if (tk != 2) {
 					msg_print(Ind, "Usage: /addnewdon <1|0 use Ind?> <1|0 lowdun_near_Bree?>");
 					return;
@@ -10680,7 +11919,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* for now only loads Valinor */
-			else if (prefix(messagelc, "/loadmap")) {
+			case SCMD_LOADMAP: {
 				int xstart = 0, ystart = 0, x, y;
 				cave_type **zcave = getcave(&p_ptr->wpos);
 
@@ -10700,6 +11939,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 						zcave[y][x].special = 0;
 					}
 				}
+				bump_feat_epoch(&p_ptr->wpos);
 
 				//process_dungeon_file(format("t_%s.txt", message3), &p_ptr->wpos, &ystart, &xstart, 20+1, 32+34, TRUE);
 				i = process_dungeon_file(format("t_%s.txt", message3), &p_ptr->wpos, &ystart, &xstart, MAX_HGT, MAX_WID, TRUE);
@@ -10708,7 +11948,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* local loadmap (at admin position, top left = x,y) */
-			else if (prefix(messagelc, "/lloadmap")) {
+			case SCMD_LLOADMAP: {
 				int xstart = p_ptr->px, ystart = p_ptr->py;
 
 				if (tk < 1) {
@@ -10722,7 +11962,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "done (%d).", i);
 				return;
 			}
-			else if (prefix(messagelc, "/lqm")) { //load quest map
+			case SCMD_LQM: { //load quest map
 				int xstart = p_ptr->px, ystart = p_ptr->py;
 
 				if (tk < 1) {
@@ -10737,7 +11977,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* check monster inventories for (nothing)s - mikaelh */
-			else if (prefix(messagelc, "/minvcheck")) {
+			case SCMD_MINVCHECK: {
 				monster_type *m_ptr;
 				object_type *o_ptr;
 				int this_o_idx, next_o_idx;
@@ -10761,7 +12001,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* remove a (nothing) the admin is standing on - C. Blue */
-			else if (prefix(messagelc, "/rmnothing")) {
+			case SCMD_RMNOTHING: {
 				cave_type **zcave = getcave(&p_ptr->wpos);
 				object_type *o_ptr;
 
@@ -10785,7 +12025,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #ifdef BACKTRACE_NOTHINGS
-			else if (prefix(messagelc, "/backtrace")) { /* backtrace test */
+			case SCMD_BACKTRACE: { /* backtrace test */
 				int size, i;
 				void *buf[1000];
 				char **fnames;
@@ -10802,7 +12042,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 #endif
 			/* erase a certain player character file */
-			else if (prefix(messagelc, "/erasechar")) {
+			case SCMD_ERASECHAR: {
 				if (tk < 1) {
 					msg_print(Ind, "Usage: /erasechar <character name>");
 					return;
@@ -10813,7 +12053,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* rename a certain player character file */
-			else if (prefix(messagelc, "/renamechar")) {
+			case SCMD_RENAMECHAR: {
 				if (tk < 1) {
 					msg_print(Ind, "Usage: /renamechar <character name>:<new name>");
 					return;
@@ -10824,7 +12064,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* list of players about to expire - mikaelh */
-			else if (prefix(messagelc, "/checkexpir")) {
+			case SCMD_CHECKEXPIR: {
 				int days;
 
 				if (tk < 1) {
@@ -10837,7 +12077,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			/* start a predefined global_event (quest, highlander tournament..),
 			   see process_events() in xtra1.c for details - C. Blue */
-			else if (prefix(messagelc, "/gestart")) {
+			case SCMD_GESTART: {
 				int err, msgpos = 0;
 
 				if (tk < 1) {
@@ -10874,7 +12114,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				if (err) msg_print(Ind, "Error: no more global events.");
 				return;
 			}
-			else if (prefix(messagelc, "/gestop")) {
+			case SCMD_GESTOP: {
 				if (tk < 1 || k < 1 || k > MAX_GLOBAL_EVENTS) {
 					msg_format(Ind, "Usage: /gestop 1..%d", MAX_GLOBAL_EVENTS);
 					return;
@@ -10886,7 +12126,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				stop_global_event(Ind, k - 1);
 				return;
 			}
-			else if (prefix(messagelc, "/gepause")) {
+			case SCMD_GEPAUSE: {
 				int k0 = k - 1;
 
 				if (tk < 1 || k < 1 || k > MAX_GLOBAL_EVENTS) {
@@ -10906,7 +12146,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/geretime")) { /* skip the announcements, start NOW */
+			case SCMD_GERETIME: { /* skip the announcements, start NOW */
 				/* (or optionally specfiy new remaining announce time in seconds) */
 				int t = 10, k0 = k - 1;
 
@@ -10926,7 +12166,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/gefforward")) { /* skip some running time - C. Blue */
+			case SCMD_GEFFORWARD: { /* skip some running time - C. Blue */
 				/* (use negative parameter to go back in time) (in seconds) */
 				int t = 60, k0 = k - 1;
 
@@ -10952,7 +12192,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 					global_event[k0].end_turn = global_event[k0].end_turn - cfg.fps * t;
 				return;
 			}
-			else if (prefix(messagelc, "/gesign")) { /* admin debug command - sign up for a global event and start it right the next turn */
+			case SCMD_GESIGN: { /* admin debug command - sign up for a global event and start it right the next turn */
 				global_event_type *ge;
 
 				for (i = 0; i < MAX_GLOBAL_EVENTS; i++) {
@@ -10985,13 +12225,13 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/contbuf")) { /* List GE_CONTENDER_BUFFER queue */
+			case SCMD_CONTBUF: { /* List GE_CONTENDER_BUFFER queue */
 				for (i = 0; i < MAX_CONTENDER_BUFFERS; i++) {
 					if (ge_contender_buffer_ID[i]) msg_format(Ind, "%d) %d '%s'", i, ge_contender_buffer_deed[i], ge_contender_buffer_ID[i]);
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/partydebug")) {
+			case SCMD_PARTYDEBUG: {
 				FILE *fp;
 
 				fp = fopen("tomenet_parties.txt", "wb");
@@ -11007,7 +12247,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "Party data dumped to tomenet_parties.txt");
 				return;
 			}
-			else if (prefix(messagelc, "/guilddebug")) {
+			case SCMD_GUILDDEBUG: {
 				FILE *fp;
 
 				fp = fopen("tomenet_guilds.txt", "wb");
@@ -11023,13 +12263,13 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "Guild data dumped to tomenet_guilds.txt");
 				return;
 			}
-			else if (prefix(messagelc, "/partyclean")) { /* reset the creation times of empty parties - THIS MUST BE RUN WHEN THE TURN COUNTER IS RESET - mikaelh */
+			case SCMD_PARTYCLEAN: { /* reset the creation times of empty parties - THIS MUST BE RUN WHEN THE TURN COUNTER IS RESET - mikaelh */
 				for (i = 1; i < MAX_PARTIES; i++)
 					if (parties[i].members == 0) parties[i].created = 0;
 				msg_print(Ind, "Creation times of empty parties reseted!");
 				return;
 			}
-			else if (prefix(messagelc, "/partymodefix")) {
+			case SCMD_PARTYMODEFIX: {
 				s32b p_id;
 
 				s_printf("Fixing party modes..\n");
@@ -11048,7 +12288,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				s_printf("done.\n");
 				return;
 			}
-			else if (prefix(messagelc, "/partymemberfix")) { //no idea atm why some parties show way higher member # in shift+p than actual members
+			case SCMD_PARTYMEMBERFIX: { //no idea atm why some parties show way higher member # in shift+p than actual members
 				int slot, members, scanned = 0, fixed = 0;
 				hash_entry *ptr;
 
@@ -11076,7 +12316,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Scanned %d parties, fixed %d.", scanned, fixed);
 				return;
 			}
-			else if (prefix(messagelc, "/partydelete")) { //remove all online members of the party and erase the party completely
+			case SCMD_PARTYDELETE: { //remove all online members of the party and erase the party completely
 				if (tk < 1) {
 					msg_print(Ind, "Usage: /partydelete <party-id>");
 					return;
@@ -11087,7 +12327,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				del_party(k);
 				return;
 			}
-			else if (prefix(messagelc, "/guildmodefix")) {
+			case SCMD_GUILDMODEFIX: {
 				cptr name = NULL;
 
 				s_printf("Fixing guild modes..\n");
@@ -11106,7 +12346,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				s_printf("done.\n");
 				return;
 			}
-			else if (prefix(messagelc, "/guildmemberfix")) {
+			case SCMD_GUILDMEMBERFIX: {
 				int slot, members, scanned = 0, fixed = 0;
 				hash_entry *ptr;
 
@@ -11135,7 +12375,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Scanned %d guilds, fixed %d.", scanned, fixed);
 				return;
 			}
-			else if (prefix(messagelc, "/guildrename")) {
+			case SCMD_GUILDRENAME: {
 				int i, g;
 				char old_name[MAX_CHARS], new_name[MAX_CHARS];
 
@@ -11168,7 +12408,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 				return;
 			}
-			else if (prefix(messagelc, "/meta")) {
+			case SCMD_META: {
 				if (!strcmp(message3, "update")) {
 					msg_print(Ind, "Sending updated info to the metaserver");
 					Report_to_meta(META_UPDATE);
@@ -11184,7 +12424,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* delete current highscore completely */
-			else if (prefix(messagelc, "/highscorereset")) {
+			case SCMD_HIGHSCORERESET: {
 				(void)highscore_reset(Ind);
 				return;
 			}
@@ -11192,7 +12432,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			 * remove an entry from the high score file
 			 * required for restored chars that were lost to bugs - C. Blue :/
 			*/
-			else if (prefix(messagelc, "/highscorerm")) {
+			case SCMD_HIGHSCORERM: {
 				if (tk < 1 || k < 1 || k > MAX_HISCORES) {
 					msg_format(Ind, "Usage: /hiscorerm 1..%d", MAX_HISCORES);
 					return;
@@ -11201,18 +12441,18 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* convert current highscore file to new format */
-			else if (prefix(messagelc, "/highscorecv")) {
+			case SCMD_HIGHSCORECV: {
 				(void)highscore_file_convert(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/rem")) {     /* write a remark (comment) to log file, for bookmarking - C. Blue */
+			case SCMD_REM: {     /* write a remark (comment) to log file, for bookmarking - C. Blue */
 				char *rem = "-";
 
 				if (tk) rem = message3;
 				s_printf("%s ADMIN_REMARK by %s: %s\n", showtime(), p_ptr->name, rem);
 				return;
 			}
-			else if (prefix(messagelc, "/mcarry")) { /* give a designated item to the monster currently looked at (NOT the one targetted) - C. Blue */
+			case SCMD_MCARRY: { /* give a designated item to the monster currently looked at (NOT the one targetted) - C. Blue */
 #ifdef MONSTER_INVENTORY
 				int o_idx;
 				s16b m_idx;
@@ -11264,7 +12504,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif  // MONSTER_INVENTORY
 				return;
 			}
-			else if (prefix(messagelc, "/mcustomxp")) { /* make the monster currently looked at (NOT the one targetted) grant custom_xp */
+			case SCMD_MCUSTOMXP: { /* make the monster currently looked at (NOT the one targetted) grant custom_xp */
 				s16b m_idx;
 				monster_type *m_ptr;
 
@@ -11278,7 +12518,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "set custom_xp = %d", m_ptr->custom_xp);
 				return;
 			}
-			else if (prefix(messagelc, "/unown") && !prefix(messagelc, "/unownhou")) { /* clear owner of an item - C. Blue */
+			case SCMD_UNOWN: { /* clear owner of an item - C. Blue */
 				object_type *o_ptr;
 				if (!tk) {
 					msg_print(Ind, "No inventory slot specified.");
@@ -11300,7 +12540,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				p_ptr->window |= PW_INVEN;
 				return;
 			}
-			else if (prefix(messagelc, "/erasehashtableid")) { /* erase a player id in case there's a duplicate entry in the hash table - mikaelh */
+			case SCMD_ERASEHASHTABLEID: { /* erase a player id in case there's a duplicate entry in the hash table - mikaelh */
 				int id;
 
 				if (tk < 1) {
@@ -11324,7 +12564,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* check o_list for invalid items - mikaelh */
-			else if (prefix(messagelc, "/olistcheck")) {
+			case SCMD_OLISTCHECK: {
 				object_type *o_ptr;
 				msg_print(Ind, "Check o_list for invalid items...");
 				for (i = 0; i < o_max; i++) {
@@ -11342,7 +12582,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* check for anomalous items somewhere - mikaelh */
-			else if (prefix(messagelc, "/floorcheck")) {
+			case SCMD_FLOORCHECK: {
 				struct worldpos wpos;
 				cave_type **zcave, *c_ptr;
 				object_type *o_ptr;
@@ -11400,7 +12640,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* attempt to remove problematic items - mikaelh */
-			else if (prefix(messagelc, "/floorfix")) {
+			case SCMD_FLOORFIX: {
 				struct worldpos wpos;
 				cave_type **zcave, *c_ptr;
 				object_type *o_ptr, *prev_o_ptr;
@@ -11467,7 +12707,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* delete a line from bbs */
-			else if (prefix(messagelc, "/dbbs")) {
+			case SCMD_DBBS: {
 				if (tk != 1) {
 					msg_print(Ind, "Usage: /dbbs <line number>");
 					return;
@@ -11476,11 +12716,11 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* erase all bbs lines */
-			else if (prefix(messagelc, "/ebbs")) {
+			case SCMD_EBBS: {
 				bbs_erase();
 				return;
 			}
-			else if (prefix(messagelc, "/reward")) { /* for testing purpose - C. Blue */
+			case SCMD_REWARD: { /* for testing purpose - C. Blue */
 				if (!tk) {
 					msg_print(Ind, "Usage: /reward <player name>");
 					return;
@@ -11493,7 +12733,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				give_reward(j, RESF_MASK_LOW2, NULL, 0, 100);
 				return;
 			}
-			else if (prefix(messagelc, "/debug1")) { /* debug an issue at hand */
+			case SCMD_DEBUG1: { /* debug an issue at hand */
 				for (j = INVEN_TOTAL - 1; j >= 0; j--)
 					if (p_ptr->inventory[j].tval == TV_AMULET && p_ptr->inventory[j].sval == SV_AMULET_HIGHLANDS)
 						invcopy(&p_ptr->inventory[j], lookup_kind(TV_AMULET, SV_AMULET_HIGHLANDS2));
@@ -11502,7 +12742,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "debug1");
 				return;
 			}
-			else if (prefix(messagelc, "/debug2")) { /* debug an issue at hand */
+			case SCMD_DEBUG2: { /* debug an issue at hand */
 				for (j = INVEN_TOTAL - 1; j >= 0; j--)
 					if (p_ptr->inventory[j].tval == TV_AMULET && p_ptr->inventory[j].sval == SV_AMULET_HIGHLANDS) {
 						invcopy(&p_ptr->inventory[j], lookup_kind(TV_AMULET, SV_AMULET_HIGHLANDS2));
@@ -11521,7 +12761,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "debug2");
 				return;
 			}
-			else if (prefix(messagelc, "/daynight")) { /* switch between day and night - use carefully! */
+			case SCMD_DAYNIGHT: { /* switch between day and night - use carefully! */
 				int h = (turn % DAY) / HOUR;
 				u64b turn_old = turn, turn_diff;
 
@@ -11538,7 +12778,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 
 				return;
 			}
-			else if (prefix(messagelc, "/season")) { /* switch through 4 seasons */
+			case SCMD_SEASON: { /* switch through 4 seasons */
 				if (tk >= 1) {
 					if (k < 0 || k > 3) {
 						msg_print(Ind, "Usage: /season [0..3]");
@@ -11549,7 +12789,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				else season_change((season + 1) % 4, FALSE);
 				return;
 			}
-			else if (prefix(messagelc, "/weather")) { /* toggle snowfall during WINTER_SEASON */
+			case SCMD_WEATHER: { /* toggle snowfall during WINTER_SEASON */
 #ifdef CLIENT_SIDE_WEATHER
 				if (tk) {
 					if (k) weather = 0;
@@ -11572,7 +12812,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			   /cweather -1 x x x.
 			   Syntax: Type Wind WEATHER_GEN_TICKS Intensity Speed [:Playername].
 			   To turn on rain: 1 0 3 8 3 :somedood */
-			else if (prefix(messagelc, "/cweather") || prefix(messagelc, "/cw")) {
+			case SCMD_CWEATHER: {
 				char *c;
 				int p = Ind;
 
@@ -11598,7 +12838,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				    FALSE, TRUE);
 				return;
 			}
-			else if (prefix(messagelc, "/jokeweather")) {//unfinished
+			case SCMD_JOKEWEATHER: {//unfinished
 				if (!k || k > NumPlayers) return;
 				if (Players[k]->joke_weather == 0) {
 					/* check clouds from first to last (so it has a good chance of
@@ -11640,17 +12880,17 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/fireworks")) { /* toggle fireworks during NEW_YEARS_EVE */
+			case SCMD_FIREWORKS: { /* toggle fireworks during NEW_YEARS_EVE */
 				if (tk >= 1) fireworks = k;
 				else if (fireworks) fireworks = 0;
 				else fireworks = 1;
 				return;
 			}
-			else if (prefix(messagelc, "/lightning")) {
+			case SCMD_LIGHTNING: {
 				cast_lightning(&p_ptr->wpos, p_ptr->px, p_ptr->py);
 				return;
 			}
-			else if (prefix(messagelc, "/hostilities")) {
+			case SCMD_HOSTILITIES: {
 				player_list_type *ptr;
 
 				for (i = 1; i <= NumPlayers; i++) {
@@ -11668,7 +12908,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "\377sEnd of hostility list.");
 				return;
 			}
-			else if (prefix(messagelc, "/mkhostile")) {
+			case SCMD_MKHOSTILE: {
 				char *pn1 = message3, *pn2 = strchr(message3, ':');
 
 				if (!pn1[0] || !pn2 || !pn2[1]) {
@@ -11692,7 +12932,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				(void)add_hostility(j, pn2, TRUE, TRUE);
 				return;
 			}
-			else if (prefix(messagelc, "/mkpeace")) {
+			case SCMD_MKPEACE: {
 				char *pn1 = message3, *pn2 = strchr(message3, ':');
 
 				if (!pn1[0] || !pn2[0]) {
@@ -11714,7 +12954,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				(void)remove_hostility(j, pn2, TRUE);
 				return;
 			}
-			else if (prefix(messagelc, "/debugstore")) { /* parameter is # of maintenance runs to perform at once (1..10) */
+			case SCMD_DEBUGSTORE: { /* parameter is # of maintenance runs to perform at once (1..10) */
 				if (tk > 0) {
 					if (!store_debug_mode) store_debug_startturn = turn;
 
@@ -11733,7 +12973,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "store_debug_mode: freq %d, time x%d.", store_debug_mode, store_debug_quickmotion);
 				return;
 			}
-			else if (prefix(messagelc, "/kstore")) { /* kick a player out of the store he is in (if any) */
+			case SCMD_KSTORE: { /* kick a player out of the store he is in (if any) */
 				if (!tk) {
 					msg_print(Ind, "\377oUsage: /kstore <character name>]");
 					return;
@@ -11751,7 +12991,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				store_kick(j, FALSE);
 				return;
 			}
-			else if (prefix(messagelc, "/costs")) { /* shows monetary details about an object */
+			case SCMD_COSTS: { /* shows monetary details about an object */
 				object_type *o_ptr;
 				char o_name[ONAME_LEN];
 
@@ -11783,7 +13023,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #if 0
 			/* 'unbreak' all EDSMs in someone's inventory -- added to fix EDSMs after accidental seal-conversion
 			   when seals had 0 value and therefore obtained ID_BROKEN automatically on loading */
-			else if (prefix(messagelc, "/unbreak")) {
+			case SCMD_UNBREAK: {
 				if (!tk) {
 					msg_print(Ind, "Usage: /unbreak <name>");
 					return;
@@ -11804,7 +13044,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 #endif
 			/* just calls cron_24h as if it was time to do so */
-			else if (prefix(messagelc, "/debugdate")) {
+			case SCMD_DEBUGDATE: {
 				int dwd, dd, dm, dy;
 
 				get_date(&dwd, &dd, &dm, &dy);
@@ -11812,7 +13052,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* copy an object from someone's inventory into own inventory */
-			else if (prefix(messagelc, "/ocopy")) {
+			case SCMD_OCOPY: {
 				object_type forge, *o_ptr = &forge;
 				if (tk < 2) {
 					msg_print(Ind, "Usage: /ocopy <1..38> <name>");
@@ -11837,7 +13077,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* re-initialize the skill chart */
-			else if (prefix(messagelc, "/fixskills")) {
+			case SCMD_FIXSKILLS: {
 				if (tk < 1) return;
 				j = name_lookup_loose(Ind, message3, FALSE, FALSE, FALSE);
 				if (j < 1) return;
@@ -11846,7 +13086,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			/* debug-hack: set all items within houses to ITEM_REMOVAL_HOUSE - C. Blue
 			   warning: can cause a pause of serious duration >:) */
-			else if (prefix(messagelc, "/debugitemremovalhouse")) {
+			case SCMD_DEBUGITEMREMOVALHOUSE: {
 				cave_type **zcave;
 				object_type *o_ptr;
 
@@ -11894,7 +13134,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			   warning: can cause a pause of serious duration >:)
 			   note: also un-permas 'game pieces' and generated items such as
 			         cabbage etc. :/ */
-			else if (prefix(messagelc, "/purgeitemremovalnever")) {
+			case SCMD_PURGEITEMREMOVALNEVER: {
 				cave_type **zcave;
 				object_type *o_ptr;
 
@@ -11939,7 +13179,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* test new \376, \375, \374 chat line prefices */
-			else if (prefix(messagelc, "/testchat")) {
+			case SCMD_TESTCHAT: {
 				msg_print(Ind, "No code.");
 				msg_print(Ind, "\376376 code.");
 				msg_print(Ind, "No code.");
@@ -11954,18 +13194,18 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "No code.");
 				return;
 			}
-			else if (prefix(messagelc, "/initlua")) {
+			case SCMD_INITLUA: {
 				msg_print(Ind, "Reinitializing Lua");
 				reinit_lua();
 				return;
 			}
 			/* hazardous/incomplete */
-			else if (prefix(messagelc, "/reinitarrays")) {
+			case SCMD_REINITARRAYS: {
 				msg_print(Ind, "Reinitializing some arrays");
 				reinit_some_arrays();
 				return;
 			}
-			else if (prefix(messagelc, "/bench")) {
+			case SCMD_BENCH: {
 				if (tk < 1) {
 					msg_print(Ind, "Usage: /bench <something>");
 					msg_print(Ind, "Use on an empty server!");
@@ -11974,7 +13214,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				do_benchmark(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/pings")) {
+			case SCMD_PINGS: {
 				struct timeval now;
 				player_type *q_ptr;
 
@@ -12001,7 +13241,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 
 				return;
 			}
-			else if (prefix(messagelc, "/dmpriv")) {
+			case SCMD_DMPRIV: {
 				if (!p_ptr->admin_dm) { // || !cfg.secret_dungeon_master) {
 					msg_print(Ind, "Command only available to hidden dungeon masters.");
 					return;
@@ -12014,7 +13254,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* unidentifies an item */
-			else if (prefix(messagelc, "/un-id")) {//note collision with /unidisable, prevented purely by order
+			case SCMD_UN_ID: {//note collision with /unidisable, prevented purely by order
 				object_type *o_ptr;
 				char note2[80], noteid[10];
 
@@ -12051,7 +13291,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* un-know an item */
-			else if (prefix(messagelc, "/unkw")) {//includes /un-id
+			case SCMD_UNKW: {//includes /un-id
 				object_type *o_ptr;
 				char note2[80], noteid[10];
 
@@ -12118,7 +13358,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* curses an item */
-			else if (prefix(messagelc, "/curse")) {
+			case SCMD_CURSE: {
 				object_type *o_ptr;
 
 				if (!tk) {
@@ -12158,7 +13398,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* uncurses an item */
-			else if (prefix(messagelc, "/uncurse")) {
+			case SCMD_UNCURSE2: {
 				object_type *o_ptr;
 
 				if (!tk) {
@@ -12197,7 +13437,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				p_ptr->window |= PW_INVEN | PW_EQUIP;
 				return;
 			}
-			else if (prefix(messagelc, "/ai")) { /* returns/resets all AI flags and states of monster currently looked at (NOT the one targetted) - C. Blue */
+			case SCMD_AI: { /* returns/resets all AI flags and states of monster currently looked at (NOT the one targetted) - C. Blue */
 				monster_type *m_ptr;
 				int m_idx;
 
@@ -12225,7 +13465,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #ifdef USE_SOUND_2010
-			else if (prefix(messagelc, "/hmus")) { /* set own music according to the location of someone else */
+			case SCMD_HMUS: { /* set own music according to the location of someone else */
 				u32b f;
 
 				if (tk < 1) {
@@ -12242,7 +13482,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				Players[Ind]->esp_link_flags = f;
 				return;
 			}
-			else if (prefix(messagelc, "/psfx")) { /* play specific sound */
+			case SCMD_PSFX: { /* play specific sound */
 				int vol = 100;
 
 				if (!__audio_sfx_max) {
@@ -12263,7 +13503,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/wthunder")) { /* play thunder weather sound */
+			case SCMD_WTHUNDER: { /* play thunder weather sound */
 				/* Usage: /wthunder [volume] [char/accname] */
 				cptr pn = NULL;
 
@@ -12286,7 +13526,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				sound_vol(i, "thunder", NULL, SFX_TYPE_WEATHER, FALSE, k ? k : 100); //weather: screen flashing implied
 				return;
 			}
-			else if (prefix(messagelc, "/pmus")) { /* play specific music */
+			case SCMD_PMUS: { /* play specific music */
 				if (!__audio_mus_max) {
 					msg_print(Ind, "No music available.");
 					return;
@@ -12299,7 +13539,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				Send_music(Ind, k, -4, -4);
 				return;
 			}
-			else if (prefix(messagelc, "/pvmus")) { /* play specific music at specific volume */
+			case SCMD_PVMUS: { /* play specific music at specific volume */
 				if (!__audio_mus_max) {
 					msg_print(Ind, "No music available.");
 					return;
@@ -12313,7 +13553,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				Send_music_vol(Ind, k, -4, -4, atoi(token[2]));
 				return;
 			}
-			else if (prefix(messagelc, "/ppmus")) { /* play specific music for specific player */
+			case SCMD_PPMUS: { /* play specific music for specific player */
 				if (!__audio_mus_max) {
 					msg_print(Ind, "No music available.");
 					return;
@@ -12330,7 +13570,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 #endif
 #if defined(CLIENT_SIDE_WEATHER) && !defined(CLIENT_WEATHER_GLOBAL)
-			else if (prefix(messagelc, "/towea")) { /* teleport player to a sector with weather going */
+			case SCMD_TOWEA: { /* teleport player to a sector with weather going */
 				int x, y;
 				struct worldpos rpos = { 0, 0, 0} ;
 
@@ -12380,7 +13620,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #endif
-			else if (prefix(messagelc, "/screenflash")) { /* testing - send screenflash request */
+			case SCMD_SCREENFLASH: { /* testing - send screenflash request */
 				/* Usage: /screenflash [char/accname] */
 
 				i = name_lookup(Ind, message3, FALSE, TRUE, FALSE);
@@ -12390,7 +13630,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				Send_screenflash(i);
 				return;
 			}
-			else if (prefix(messagelc, "/madart")) { /* try to create a very specific randart - C. Blue */
+			case SCMD_MADART: { /* try to create a very specific randart - C. Blue */
 				/* added this to create a new matching uber bow for Andur, after his old one fell victim to randart code changes. */
 				object_type *o_ptr;
 				artifact_type *a_ptr;
@@ -12493,7 +13733,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				p_ptr->window |= (PW_INVEN | PW_EQUIP | PW_PLAYER);
 				return;
 			}
-			else if (prefix(messagelc, "/measureart")) { /* create a randart over and over, measuring frequency of an ability */
+			case SCMD_MEASUREART: { /* create a randart over and over, measuring frequency of an ability */
 				object_type *o_ptr;
 				artifact_type *a_ptr;
 				int tries = 10000, c = 0;
@@ -12564,7 +13804,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Display all information about the grid an admin-char is currently standing on - C. Blue */
-			else if (prefix(messagelc, "/debug-grid")) {
+			case SCMD_DEBUG_GRID: {
 				worldpos *tpos = &p_ptr->wpos;
 				cave_type **zcave, *c_ptr;
 				struct c_special *cs_ptr;
@@ -12619,7 +13859,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			/* Display various gameplay-related or rather global server status
 			   like seasons and (seasonal) events (for debugging) - C. Blue */
-			else if (prefix(messagelc, "/seasonvars")) {
+			case SCMD_SEASONVARS: {
 				msg_format(Ind, "season (0..3): %d.", season);
 				msg_format(Ind, "season_halloween: %d, season_xmas: %d, season_newyearseve: %d.", season_halloween, season_xmas, season_newyearseve);
 				msg_format(Ind, "sector weather: %d, sector wind: %d, sector w-speed: %d", wild_info[p_ptr->wpos.wy][p_ptr->wpos.wx].weather_type, wild_info[p_ptr->wpos.wy][p_ptr->wpos.wx].weather_wind, wild_info[p_ptr->wpos.wy][p_ptr->wpos.wx].weather_speed);
@@ -12627,7 +13867,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "lua-seen current date: %d-%d-%d", exec_lua(0, "return cur_year"), exec_lua(0, "return cur_month"), exec_lua(0, "return cur_day"));
 				return;
 			}
-			else if (prefix(messagelc, "/debug-wild")) {
+			case SCMD_DEBUG_WILD: {
 				//cptr wf = flags_str(wild_info[p_ptr->wpos.wy][p_ptr->wpos.wx].flags);
 
 				msg_format(Ind, "wild_info[%d][%d]:", p_ptr->wpos.wy, p_ptr->wpos.wx);
@@ -12642,7 +13882,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "  townrad:   %d", wild_info[p_ptr->wpos.wy][p_ptr->wpos.wx].radius);
 				return;
 			}
-			else if (prefix(messagelc, "/fix-wildflock")) {
+			case SCMD_FIX_WILDFLOCK: {
 				/* erase WILD_F_..LOCK flags from when the server crashed during dungeon removal (??) */
 				if (wild_info[p_ptr->wpos.wy][p_ptr->wpos.wx].flags & WILD_F_LOCKDOWN) {
 					wild_info[p_ptr->wpos.wy][p_ptr->wpos.wx].flags &= ~WILD_F_LOCKDOWN;
@@ -12654,7 +13894,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/fix-house-modes")) {
+			case SCMD_FIX_HOUSE_MODES: {
 				/* if house doesn't have its mode set yet, search
 				   hash for player who owns it and set mode to his. */
 				u32b m = 0x00000000U;
@@ -12681,7 +13921,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #ifdef TEST_SERVER
-			else if (prefix(messagelc, "/testreqs")) {
+			case SCMD_TESTREQS: {
 				msg_print(Ind, "Sending request(s)...");
 				switch (k) {
 				case 0: Send_request_key(Ind, 0, "Key: "); break;
@@ -12696,7 +13936,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 #endif
 			/* Update 'noteworthy occurances' aka legends.log display, for debugging purposes */
-			else if (prefix(messagelc, "/update-leg")) {
+			case SCMD_UPDATE_LEG: {
 				char path[MAX_PATH_LENGTH];
 				char path_rev[MAX_PATH_LENGTH];
 
@@ -12709,7 +13949,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Test values of deep_dive..[] deep dive record saving array */
-			else if (prefix(messagelc, "/deepdivestats")) {
+			case SCMD_DEEPDIVESTATS: {
 				for (i = 0; i < IDDC_HIGHSCORE_SIZE; i++) {
 					//msg_format(Ind, "#%2d.  %20s  %3d", i + 1, deep_dive_name[i], deep_dive_level[i]);//NAME_LEN
 					msg_format(Ind, "#%2d.  %65s  %3d", i, deep_dive_name[i], deep_dive_level[i]);//MAX_CHARS - 15 to fit on screen
@@ -12717,7 +13957,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/deepdivefix")) {
+			case SCMD_DEEPDIVEFIX: {
 #if 0
 				/* Fix erroneous colour codes in deep_dive_name[] */
 				char *p, *q, buf[256];
@@ -12832,7 +14072,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Reset Ironman Deep Dive Challenge records */
-			else if (prefix(messagelc, "/deepdivereset")) {
+			case SCMD_DEEPDIVERESET: {
 				char path[MAX_PATH_LENGTH];
 				char path_rev[MAX_PATH_LENGTH];
 
@@ -12852,7 +14092,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* list statics; unstatic all empty, static (not stale) floors if parm is given */
-			else if (prefix(messagelc, "/lsl") || prefix(messagelc, "/lsls") || prefix(messagelc, "/lslsu")) {
+			case SCMD_LSL: {
 				int x, y;
 				struct dungeon_type *d_ptr;
 				dun_level *l_ptr;
@@ -12925,7 +14165,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "done.");
 				return;
 			}
-			else if (prefix(messagelc, "/fixguild")) { /* Set a guild to GFLG_EVERLASTING */
+			case SCMD_FIXGUILD: { /* Set a guild to GFLG_EVERLASTING */
 				if (!tk) {
 					msg_print(Ind, "Usage: /fixguild <guild_id>");
 					return;
@@ -12935,7 +14175,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #ifdef DUNGEON_VISIT_BONUS
-			else if (prefix(messagelc, "/debugdvb")) { /* debug DUNGEON_VISIT_BONUS */
+			case SCMD_DEBUGDVB: { /* debug DUNGEON_VISIT_BONUS */
 				msg_print(Ind, "Experience bonus list for dungeons/towers:");
 				/* pre-process data for colourization */
 				j = VISIT_TIME_CAP - 1;
@@ -12959,14 +14199,14 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/reindexdvb")) { /* debug DUNGEON_VISIT_BONUS */
+			case SCMD_REINDEXDVB: { /* debug DUNGEON_VISIT_BONUS */
 				s_printf("Reindexing dungeons:\n");
 				reindex_dungeons();
 				msg_print(Ind, "dungeons reindexed.");
 				return;
 			}
 #endif
-			else if (prefix(messagelc, "/debug-house")) {
+			case SCMD_DEBUG_HOUSE: {
 				int h_idx;
 				house_type *h_ptr;
 				u32b mode;
@@ -12984,7 +14224,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "house #%d, mode %d, owner-mode %d, colour %d.", h_idx, h_ptr->dna->mode, mode, h_ptr->colour);
 				return;
 			}
-			else if (prefix(messagelc, "/debugmd")) {//debug p_ptr->max_depth[]
+			case SCMD_DEBUGMD: {//debug p_ptr->max_depth[]
 				int p;
 
 				if (tk < 1) {
@@ -13003,7 +14243,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/fixmd")) {//debug p_ptr->max_depth[]
+			case SCMD_FIXMD: {//debug p_ptr->max_depth[]
 				int p;
 
 				if (tk < 1) {
@@ -13018,7 +14258,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "max_depth[] fixed for '%s':", Players[p]->name);
 				return;
 			}
-			else if (prefix(messagelc, "/wipemd")) {
+			case SCMD_WIPEMD: {
 				int p;
 
 				if (tk < 1) {
@@ -13040,7 +14280,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			/* new unfortunately: remove all non-existing dungeons that got added due
 			   to a bug that adds a 'dungeon' everytime on world-surface recall, ew */
-			else if (prefix(messagelc, "/fix!md")) {
+			case SCMD_FIX_MD: {
 				int p;
 
 				if (tk < 1) {
@@ -13055,7 +14295,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "max_depth[] bug-fixed for '%s':", Players[p]->name);
 				return;
 			}
-			else if (prefix(messagelc, "/fixcondmd")) {
+			case SCMD_FIXCONDMD: {
 				int p;
 
 				if (tk < 1) {
@@ -13070,7 +14310,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "max_depth[] condensation-bug-fixed for '%s':", Players[p]->name);
 				return;
 			}
-			else if (prefix(messagelc, "/fixjaildun")) {//sets appropriate flags of a dungeon on a jail grid
+			case SCMD_FIXJAILDUN: {//sets appropriate flags of a dungeon on a jail grid
 				bool tower;
 				struct dungeon_type *d_ptr = admin_dun(Ind, &tower);
 
@@ -13080,7 +14320,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "Jail-specific flags set.");
 				return;
 			}
-			else if (prefix(messagelc, "/fixiddc")) {//adds DF3_NO_DUNGEON_BONUS to ironman deep dive challenge dungeon
+			case SCMD_FIXIDDC: {//adds DF3_NO_DUNGEON_BONUS to ironman deep dive challenge dungeon
 				bool tower;
 				struct dungeon_type *d_ptr = admin_dun(Ind, &tower);
 
@@ -13096,7 +14336,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* adjust iddc flags */
-			else if (prefix(messagelc, "/fix2iddc")) {
+			case SCMD_FIX2IDDC: {
 				struct dungeon_type *d_ptr;
 				wilderness_type *wild = &wild_info[WPOS_IRONDEEPDIVE_Y][WPOS_IRONDEEPDIVE_X];
 
@@ -13119,7 +14359,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			   [Parm]: <none> = NTELE+NSUMM, 0 = +NO_ESP, <other> = +LIMIT_ESP.
 			   Use this command twice to remove all (^these 4) experimental flags again.
 			   Suggestion: Use this on the Halls of Mandos :). */
-			else if (prefix(messagelc, "/dunmkexp")) {
+			case SCMD_DUNMKEXP: {
 				bool tower;
 				struct dungeon_type *d_ptr = admin_dun(Ind, &tower);
 
@@ -13146,7 +14386,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/terminate")) {
+			case SCMD_TERMINATE: {
 				/* same as /shutdown 0, except server will return -2 instead of -1.
 				   can be used by scripts to initiate maintenance downtime etc. */
 				set_runlevel(-1);
@@ -13158,7 +14398,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			/* back up all house prices and items/gold inside houses for all
 			   characters to lib/save/estate/ and invoke /terminate right
 			   afterwards if the parameter "term" is given. - C. Blue */
-			else if (prefix(messagelc, "/backup_estate")) {
+			case SCMD_BACKUP_ESTATE: {
 				msg_print(Ind, "Backing up all real estate...");
 				//specify any parameter for allowing partial backup
 				if (!backup_estate(tk)) {
@@ -13173,7 +14413,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Same as above but only for one specific house! You must be standing on the house door! */
-			else if (prefix(messagelc, "/backup_one_estate")) {
+			case SCMD_BACKUP_ONE_ESTATE: {
 				s32b pid;
 
 				if (!tk) {
@@ -13194,7 +14434,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Backs up contents of all houses owned by a specific character and gives ownership to a specific character. */
-			else if (prefix(messagelc, "/backup_char_estate")) {
+			case SCMD_BACKUP_CHAR_ESTATE: {
 				s32b hid, pid;
 				char *pid_name;
 
@@ -13228,13 +14468,13 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			   so it could be deleted without everyone having to remember their
 			   char names because they get confronted with 'empty' character lists.
 			   -> To be used with /backup_estate mechanism. - C. Blue */
-			else if (prefix(messagelc, "/backup_acclists")) {
+			case SCMD_BACKUP_ACCLISTS: {
 				backup_acclists();
 				msg_print(Ind, "Backed up all account<-character relations.");
 				return;
 			}
 			/* restore all account<-character relations saved by /backup_acclists */
-			else if (prefix(messagelc, "/restore_acclists")) {
+			case SCMD_RESTORE_ACCLISTS: {
 				restore_acclists();
 				msg_print(Ind, "Restored all account<-character relations.");
 				return;
@@ -13242,7 +14482,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #ifdef CLIENT_SIDE_WEATHER
  #ifndef CLIENT_WEATHER_GLOBAL
 			/* weather: generate a cloud at current worldmap sector */
-			else if (prefix(messagelc, "/mkcloud")) {
+			case SCMD_MKCLOUD: {
 				if (clouds == MAX_CLOUDS) {
 					msg_print(Ind, "Error: Cloud number already at maximum.");
 					return;
@@ -13264,7 +14504,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* weather: remove a cloud at current worldmap sector */
-			else if (prefix(messagelc, "/rmcloud")) {
+			case SCMD_RMCLOUD: {
 				wilderness_type *w_ptr = &wild_info[p_ptr->wpos.wy][p_ptr->wpos.wx];
 				for (i = 0; i < 10; i++) {
 					if (w_ptr->cloud_idx[i] == -1) continue;
@@ -13286,7 +14526,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* weather: list all clouds at current worldmap sector */
-			else if (prefix(messagelc, "/lscloud")) {
+			case SCMD_LSCLOUD: {
 				wilderness_type *w_ptr = &wild_info[p_ptr->wpos.wy][p_ptr->wpos.wx];
 				msg_print(Ind, "Local wild_info cloud array:");
 				for (i = 0; i < 10; i++) {
@@ -13299,14 +14539,14 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
  #endif
 #endif
 			/* transport admin to Valinor */
-			else if (prefix(messagelc, "/tovalinor")) {
+			case SCMD_TOVALINOR: {
 				msg_print(Ind, "Initiating passage to Valinor.");
 				p_ptr->auto_transport = AT_VALINOR;
 				return;
 			}
 #ifdef IRONDEEPDIVE_MIXED_TYPES
 			/* Re-roll IDDC */
-			else if (prefix(messagelc, "/riddc") || prefix(messagelc, "/liddc")) {
+			case SCMD_RIDDC: {
 				int ft = -1, last = 1;
 
 				if (prefix(messagelc, "/riddc")) {
@@ -13350,7 +14590,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 #endif
 			/* Recall all players out of the dungeons, kick those who aren't eligible */
-			else if (prefix(messagelc, "/allrec")) {
+			case SCMD_ALLREC: {
 				struct worldpos pwpos;
 				player_type *p_ptr;
 
@@ -13401,7 +14641,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* sets current true artifact holders to players who own them */
-			else if (prefix(messagelc, "/fixartowners1")) {
+			case SCMD_FIXARTOWNERS1: {
 				object_type *o_ptr;
 				int a_idx;
 
@@ -13415,7 +14655,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* sets current true artifact holders to players who own them */
-			else if (prefix(messagelc, "/fixartowners2")) {
+			case SCMD_FIXARTOWNERS2: {
 				object_type *o_ptr;
 				int a_idx;
 
@@ -13431,7 +14671,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/fixarttimeout")) {
+			case SCMD_FIXARTTIMEOUT: {
 				if (!tk) {
 					msg_print(Ind, "No artifact index specified.");
 					return;
@@ -13449,7 +14689,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 
 				return;
 			}
-			else if (prefix(messagelc, "/mtrack")) { /* track monster health of someone's current target */
+			case SCMD_MTRACK: { /* track monster health of someone's current target */
 				char m_name[MNAME_LEN];
 				int p;
 
@@ -13471,7 +14711,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* fix hash table entry in particular aspect(s) */
-			else if (prefix(messagelc, "/fixhash")) {
+			case SCMD_FIXHASH: {
 				int p;
 
 				if (!tk) {
@@ -13483,7 +14723,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				clockin(p, 6);
 				return;
 			}
-			else if (prefix(messagelc, "/charlaston")) {
+			case SCMD_CHARLASTON: {
 				unsigned long int s, sl;
 				time_t now;
 				s32b p_id;
@@ -13510,7 +14750,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				else msg_format(Ind, "Player <%s> was seen %ld seconds ago.", message3, s);
 				return;
 			}
-			else if (prefix(messagelc, "/testrandart")) { /* test how often randarts get AM shell '>_> */
+			case SCMD_TESTRANDART: { /* test how often randarts get AM shell '>_> */
 				object_type *o_ptr;
 				u32b f1, f2, f3, f4, f5, f6, esp;
 				int tries = 100000, found = 0;
@@ -13558,11 +14798,11 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "%d were positive: %d.%d%%", found, 100 * found / 100000, (found % 1000) / 100);//wtb correct rounding >.> o laziness
 				return;
 			}
-			else if (prefix(messagelc, "/moditem")) { /* modify a particular existing item type (added for LL drop sky dsm of imm -> randart sky dsm) */
+			case SCMD_MODITEM: { /* modify a particular existing item type (added for LL drop sky dsm of imm -> randart sky dsm) */
 				hack_particular_item();
 				return;
 			}
-			else if (prefix(messagelc, "/qinf")) { /* debug new quest_info stuff - C. Blue */
+			case SCMD_QINF: { /* debug new quest_info stuff - C. Blue */
 				/* display hard info about a specific quest? */
 				if (tk) {
 					int l;
@@ -13643,7 +14883,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				//pointless.. msg_format(Ind, " \377wSize of quest_info*max_q_idx=total (real): %d*%d=\377U%d (%d)", sizeof(quest_info), max_q_idx, sizeof(quest_info) * max_q_idx, sizeof(quest_info) * MAX_Q_IDX);
 				return;
 			}
-			else if (prefix(messagelc, "/qsize")) { /* try to calc full q_info[] mem usage - C. Blue */
+			case SCMD_QSIZE: { /* try to calc full q_info[] mem usage - C. Blue */
 				int l, q, t, td;
 				quest_info *q_ptr;
 
@@ -13702,7 +14942,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* list quest items we carry */
-			else if (prefix(messagelc, "/qinv")) {
+			case SCMD_QINV: {
 				object_type *o_ptr;
 				char buf[MAX_CHARS];
 
@@ -13721,7 +14961,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/qaquest") || prefix(messagelc, "/qaq")) { /* drop a quest a player is on */
+			case SCMD_QAQUEST: { /* drop a quest a player is on */
 				int q = -1, p, k0 = k - 1;
 
 				if (!tk) {
@@ -13783,7 +15023,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				if (q_info[j].quest_done_credit_stage <= quest_get_stage(Ind, j) && p_ptr->quest_done[j] < 10000) p_ptr->quest_done[j]++;
 				return;
 			}
-			else if (prefix(messagelc, "/qccd")) { /* clear a quest's cooldown */
+			case SCMD_QCCD: { /* clear a quest's cooldown */
 				if (tk < 1) {
 					msg_print(Ind, "Usage: /qccd <q_idx|*> [Ind]");
 					return;
@@ -13807,7 +15047,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				quest_set_cooldown(i, k, 0);
 				return;
 			}
-			else if (prefix(messagelc, "/qpriv")) { /* change a quest's privilege level */
+			case SCMD_QPRIV: { /* change a quest's privilege level */
 				if (tk < 1) {
 					msg_print(Ind, "Usage: /qpriv <q_idx|*> [0..3]");
 					return;
@@ -13827,7 +15067,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Now set to %d.", i);
 				return;
 			}
-			else if (prefix(messagelc, "/qdis")) { /* disable a quest */
+			case SCMD_QDIS: { /* disable a quest */
 				if (tk != 1) {
 					msg_print(Ind, "Usage: /qdis <q_idx|*>");
 					return;
@@ -13851,7 +15091,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				q_info[k].disabled = TRUE;
 				return;
 			}
-			else if (prefix(messagelc, "/qena")) { /* enable a quest */
+			case SCMD_QENA: { /* enable a quest */
 				if (tk != 1) {
 					msg_print(Ind, "Usage: /qena <q_idx|*>");
 					return;
@@ -13873,7 +15113,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				q_info[k].disabled = FALSE;
 				return;
 			}
-			else if (prefix(messagelc, "/qstart")) { /* activate a quest */
+			case SCMD_QSTART: { /* activate a quest */
 				if (tk != 1) {
 					msg_print(Ind, "Usage: /qstart <q_idx|*>");
 					return;
@@ -13896,7 +15136,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				else msg_print(Ind, "\377gOk.");
 				return;
 			}
-			else if (prefix(messagelc, "/qstop")) { /* cancel a quest */
+			case SCMD_QSTOP: { /* cancel a quest */
 				if (tk != 1) {
 					msg_print(Ind, "Usage: /qstop <q_idx|*>");
 					return;
@@ -13918,7 +15158,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				quest_deactivate(k);
 				return;
 			}
-			else if (prefix(messagelc, "/qstage")) { /* change a quest's stage */
+			case SCMD_QSTAGE: { /* change a quest's stage */
 				if (tk != 2) {
 					msg_print(Ind, "Usage: /qstage <q_idx> <stage>");
 					return;
@@ -13927,12 +15167,12 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				quest_set_stage(0, k, atoi(token[2]), FALSE, NULL);
 				return;
 			}
-			else if (prefix(messagelc, "/qfx")) { /* for testing/debugging status effects (for rewards) */
+			case SCMD_QFX: { /* for testing/debugging status effects (for rewards) */
 				quest_statuseffect(Ind, k);
 				msg_print(Ind, "Applied.");
 				return;
 			}
-			else if (prefix(messagelc, "/debugfloor")) {
+			case SCMD_DEBUGFLOOR: {
 				struct dun_level *l_ptr;
 
 				if (!p_ptr->wpos.wz) {
@@ -13948,7 +15188,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "flags2 = %u", l_ptr->flags2);
 				return;
 			}
-			else if (prefix(messagelc, "/reservednames")) { /* specify any parm to not stop at 1st 'nulled' name found */
+			case SCMD_RESERVEDNAMES: { /* specify any parm to not stop at 1st 'nulled' name found */
 				k = 0;
 				for (i = 0; i < MAX_RESERVED_NAMES; i++) {
 					if (reserved_name_character[i][0]) {
@@ -13960,7 +15200,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "%d names reserved (of max %d).", k, MAX_RESERVED_NAMES);
 				return;
 			}
-			else if (prefix(messagelc, "/addreservedname")) { /* admin-hack: manually add a name to the reserved-names list */
+			case SCMD_ADDRESERVEDNAME: { /* admin-hack: manually add a name to the reserved-names list */
 				char name[NAME_LEN], account[ACCNAME_LEN], *ca;
 
 				ca = strchr(message3, ':');
@@ -13987,7 +15227,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/delreservedname")) { /* admin-hack: manually add a name to the reserved-names list for 60 minutes */
+			case SCMD_DELRESERVEDNAME: { /* admin-hack: manually add a name to the reserved-names list for 60 minutes */
 				char name[NAME_LEN], account[ACCNAME_LEN], *ca;
 
 				ca = strchr(message3, ':');
@@ -14010,12 +15250,12 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				if (i == MAX_RESERVED_NAMES) msg_print(Ind, "Entry not found.");
 				return;
 			}
-			else if (prefix(messagelc, "/purgeaccountfile")) {
+			case SCMD_PURGEACCOUNTFILE: {
 				purge_acc_file();
 				msg_print(Ind, "done.");
 				return;
 			}
-			else if (prefix(messagelc, "/ap") && !prefix(messagelc, "/apat") && !prefix(messagelc, "/app")) { /* set optional parameter (too hacky..) */
+			case SCMD_AP: { /* set optional parameter (too hacky..) */
 				if (!tk) {
 					msg_print(Ind, "Admin parm cleared.");
 					p_ptr->admin_parm[0] = 0;
@@ -14026,7 +15266,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "Admin parm set.");
 				return;
 			}
-			else if (prefix(messagelc, "/app") && !prefix(messagelc, "/appla")) { /* set optional parameter (too hacky..) */
+			case SCMD_APP: { /* set optional parameter (too hacky..) */
 				int i;
 				char *tpname;
 
@@ -14057,7 +15297,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Admin parm set to '%s' for Ind %d.", Players[i]->admin_parm, i);
 				return;
 			}
-			else if (prefix(messagelc, "/ahl")) { /* ACC_HOUSE_LIMIT - just in case anything goes wrong.. */
+			case SCMD_AHL: { /* ACC_HOUSE_LIMIT - just in case anything goes wrong.. */
 				/* Instead, USE '/chouse' THIS TO FIX CHAR-SPECIFIC BUGS LIKE "character cannot own more than 1" but has actually 0 houses. */
 				int i, h, ht = 0, ids, *id_list, n;
 				struct account acc;
@@ -14109,7 +15349,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* imprint 'housed' on all objects inside houses */
-			else if (prefix(messagelc, "/optrhoused")) {
+			case SCMD_OPTRHOUSED: {
 				int i, h;
 				house_type *h_ptr;
 				object_type *o_ptr;
@@ -14132,7 +15372,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "%d houses, %d free objects, done.", num_houses, o_max);
 				return;
 			}
-			else if (prefix(messagelc, "/destroyhouse")) { /* Usage: /destroyhouse <x> <y>   (door coordinates from ~9 or /hou) */
+			case SCMD_DESTROYHOUSE: { /* Usage: /destroyhouse <x> <y>   (door coordinates from ~9 or /hou) */
 				house_type *h_ptr;
 				int x, y;
 				char owner[MAX_CHARS], owner_type[20];
@@ -14183,7 +15423,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Done (checked %d houses).", num_houses);
 				return;
 			}
-			else if (prefix(messagelc, "/unownhouse")) { /* Usage: /unownhouse <x> <y>   (door coordinates from ~9 or /hou) */
+			case SCMD_UNOWNHOUSE: { /* Usage: /unownhouse <x> <y>   (door coordinates from ~9 or /hou) */
 				/* Use this command to fix 'ghost' houses that aren't placed in the game world but are still owned by someone.
 				   After running this command, do /chouse <cname> to recount his houses and fix his house count that way. */
 				house_type *h_ptr;
@@ -14257,7 +15497,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* request back real estate of a specific character that was previously backed up via /backup_estate */
-			else if (prefix(messagelc, "/rest1")) {
+			case SCMD_REST1: {
 				int i;
 
 				if (!tk) {
@@ -14268,7 +15508,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				if (i) restore_estate(i);
 				return;
 			}
-			else if (prefix(messagelc, "/ambient")) {
+			case SCMD_AMBIENT: {
 				wilderness_type *w_ptr = &wild_info[p_ptr->wpos.wy][p_ptr->wpos.wx];
 				w_ptr->ambient_sfx_counteddown = FALSE,
 				w_ptr->ambient_sfx = 0;
@@ -14278,7 +15518,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #ifdef MONSTER_ASTAR
 			/* Reset all A* info - to be used when the server is switched to allow A*,
 			   but still has existing monsters that were previously allocated. */
-			else if (prefix(messagelc, "/rsastar")) {
+			case SCMD_RSASTAR: {
 				monster_type *m_ptr;
 				monster_race *r_ptr;
 
@@ -14320,7 +15560,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 #endif
 #if 1
-			else if (prefix(messagelc, "/xid")) { //debugging help
+			case SCMD_XID: { //debugging help
 				//xid <id rod> <item to id>
 				p_ptr->delayed_index = k;
 				p_ptr->delayed_spell = -3;//<-rod : -2; <-staff
@@ -14328,7 +15568,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #endif
-			else if (prefix(messagelc, "/fontmapr")) {
+			case SCMD_FONTMAPR: {
 				char tname[MAX_CHARS], *p, c = 0, oc;
 				unsigned char uc;
 
@@ -14375,7 +15615,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 				return;
 			}
-			else if (prefix(messagelc, "/fontmapf")) {
+			case SCMD_FONTMAPF: {
 				char tname[MAX_CHARS], *p, c = 0, oc;
 				unsigned char uc;
 
@@ -14425,11 +15665,11 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 				return;
 			}
-			else if (prefix(messagelc, "/tp")) { //quick admin teleport-self
+			case SCMD_TP: { //quick admin teleport-self
 				teleport_player_force(Ind, 250);
 				return;
 			}
-			else if (prefix(messagelc, "/debugvars")) { //debugging
+			case SCMD_DEBUGVARS: { //debugging
 #if 0
 				msg_format(Ind, "%d, %d, %d, %d, %d, %d", dbgvar1, dbgvar2, dbgvar3, dbgvar4, dbgvar5, dbgvar6);
 				msg_format(Ind, "%d, %d, %d, %d, %d, %d", dbgvar1a, dbgvar2a, dbgvar3a, dbgvar4a, dbgvar5a, dbgvar6b);
@@ -14447,7 +15687,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #ifdef ENABLE_MERCHANT_MAIL
-			else if (prefix(messagelc, "/mgmail")) { //debug merchants guild mail
+			case SCMD_MGMAIL: { //debug merchants guild mail
 				int i;
 				char cd, cto;
 				char o_name_short[ONAME_LEN];
@@ -14470,7 +15710,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_print(Ind, "End of merchants guild mail list.");
 				return;
 			}
-			else if (prefix(messagelc, "/rmgmail")) { //redirect merchants guild mail
+			case SCMD_RMGMAIL: { //redirect merchants guild mail
 				int idx;
 				s32b p_id;
 				const char *cname, *aname;
@@ -14512,7 +15752,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 #endif
 #ifdef EXTENDED_COLOURS_PALANIM
-			else if (prefix(messagelc, "/setpalette")) { //debug set_palette() etc
+			case SCMD_SETPALETTE: { //debug set_palette() etc
 				int c = (tk ? k : 1); // 1 is TERM_WHITE, but note in mind that these aren't TERM_ values but actually 0..15 + 16..31 real term colour indices!
 				int r = rand_int(256), g = rand_int(256), b = rand_int(256);
 
@@ -14520,7 +15760,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				Send_palette(Ind, c, r, g, b);
 				return;
 			}
-			else if (prefix(messagelc, "/set2pal")) { //debug set_palette() etc
+			case SCMD_SET2PAL: { //debug set_palette() etc
 				if (!tk) k = 0;
 				set_pal_debug(Ind, k);
 				return;
@@ -14528,7 +15768,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 #endif
 //#ifdef TEST_SERVER
 #if 1
-			else if (prefix(messagelc, "/settime")) {
+			case SCMD_SETTIME: {
 				int h, m, hc, mc;
 				u64b turn_old = turn, turn_diff;
 
@@ -14575,7 +15815,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #endif
-			else if (prefix(messagelc, "/turnspeed")) { /* Manipulate turn counter to count up in larger steps than one. Dangerous. */
+			case SCMD_TURNSPEED: { /* Manipulate turn counter to count up in larger steps than one. Dangerous. */
 				/* For values != 1 (normal operation) consider using '3' instead of '2' so 'turn' can become both
 				   even and odd while progressing, which may be important for certain modulo-based checks. */
 				if (!tk) k = 1;
@@ -14586,7 +15826,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				else msg_format(Ind, "Turns are increasing by \377y%d\377w at a time now (\377yPotentially Hazardous\377w).", k);
 				return;
 			}
-			else if (prefix(messagelc, "/turnsextra")) { /* Manipulate scheduler to call main game loop (dungeon()) more than 1 time per timer tick, effectively multiplying passing of time. Dangerous. */
+			case SCMD_TURNSEXTRA: { /* Manipulate scheduler to call main game loop (dungeon()) more than 1 time per timer tick, effectively multiplying passing of time. Dangerous. */
 				if (!tk) k = 0;
 				if (k < 0) k = 0;
 				turn_plus_extra = k;
@@ -14594,15 +15834,15 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				else msg_format(Ind, "Each turn now adds \377y%d\377w extra turn%s aka \377yx%d speed\377w (\377yPotentially Hazardous\377w).", k, k == 1 ? "" : "s", k + 1);
 				return;
 			}
-			else if (prefix(messagelc, "/setaorder")) { /* Set custom list position for this character in the account overview screen on login (see /setorder)*/
+			case SCMD_SETAORDER: { /* Set custom list position for this character in the account overview screen on login (see /setorder)*/
 				set_player_order(p_ptr->id, k);
 				return;
 			}
-			else if (prefix(messagelc, "/initorder")) { /* Initialize character ordering for the whole account database */
+			case SCMD_INITORDER: { /* Initialize character ordering for the whole account database */
 				init_character_ordering(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/accountorder")) { /* Initialize character ordering for the whole account database */
+			case SCMD_ACCOUNTORDER: { /* Initialize character ordering for the whole account database */
 				struct account acc;
 
 				if (!GetAccount(&acc, message3, NULL, FALSE, NULL, NULL)) {
@@ -14612,11 +15852,11 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				init_account_order(Ind, acc.id);
 				return;
 			}
-			else if (prefix(messagelc, "/zeroorder")) { /* Reset character ordering for the whole account database to zero (unordered) */
+			case SCMD_ZEROORDER: { /* Reset character ordering for the whole account database to zero (unordered) */
 				zero_character_ordering(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/showaccountorder")) { /* Initialize character ordering for the whole account database */
+			case SCMD_SHOWACCOUNTORDER: { /* Initialize character ordering for the whole account database */
 				struct account acc;
 
 				if (!GetAccount(&acc, message3, NULL, FALSE, NULL, NULL)) {
@@ -14626,7 +15866,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				show_account_order(Ind, acc.id);
 				return;
 			}
-			else if (prefix(messagelc, "/score")) { /* Initialize character ordering for the whole account database */
+			case SCMD_SCORE: { /* Initialize character ordering for the whole account database */
 				if (!tk) {
 					msg_format(Ind, "Your score = %u", total_points(Ind));
 					return;
@@ -14640,7 +15880,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Player '%s' score = %u", total_points(i));
 				return;
 			}
-			else if (prefix(messagelc, "/chkpump")) { /* check for existance of the Great Pumpkin */
+			case SCMD_CHKPUMP: { /* check for existance of the Great Pumpkin */
 				monster_type *m_ptr;
 
 				for (i = 1; i < m_max; i++) {
@@ -14651,7 +15891,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				msg_format(Ind, "Timer = %d.", great_pumpkin_timer);
 				return;
 			}
-			else if (prefix(messagelc, "/pversion") || prefix(messagelc, "/pver")) {
+			case SCMD_PVERSION: {
 				if (!tk) k = Ind;
 				else k = name_lookup_loose(Ind, message3, FALSE, FALSE, FALSE);
 				if (!k) return;
@@ -14661,7 +15901,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				    p_ptr->version.major, p_ptr->version.minor, p_ptr->version.patch, p_ptr->version.extra, p_ptr->version.branch, p_ptr->version.build, p_ptr->version.os, p_ptr->version.os_sub);
 				return;
 			}
-			else if (prefix(messagelc, "/testmisc1")) {
+			case SCMD_TESTMISC1: {
 				char pattacker[80];
 
 				strcpy(pattacker, "");
@@ -14675,11 +15915,11 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				(void)project(Ind, 0, &p_ptr->wpos, p_ptr->py, p_ptr->px + 10, 0, GF_LITE, flg, pattacker);
 				return;
 			}
-			else if (prefix(messagelc, "/testmisc2")) {
+			case SCMD_TESTMISC2: {
 				//mon_meteor_swarm(Ind, PROJECTOR_UNUSUAL, GF_METEOR, 250, p_ptr->px + 5, p_ptr->py, 2);
 				return;
 			}
-			else if (prefix(messagelc, "/invfill")) { /* fill inventory randomly with trash/consumables */
+			case SCMD_INVFILL: { /* fill inventory randomly with trash/consumables */
 				int l, q = 0;
 				object_type forge;
 				u32b f1, f2, f3, f4, f5, f6, esp;
@@ -14703,7 +15943,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/geo")) { /* (POSIX only, requires curl) lookup country of player's IP -- atm only one request can be pending at a time (aka 1 temporary filename only) */
+			case SCMD_GEO: { /* (POSIX only, requires curl) lookup country of player's IP -- atm only one request can be pending at a time (aka 1 temporary filename only) */
 				/*
 				curl https://ipinfo.io/37.187.75.24
 				{
@@ -14775,7 +16015,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				fake_waitpid_geo = p_ptr->id; /* Poll result to admin */
 				return;
 			}
-			else if (prefix(messagelc, "/ping")) { /* (POSIX only) ping player's IP -- atm only one request can be pending at a time (aka 1 temporary filename only) */
+			case SCMD_PING: { /* (POSIX only) ping player's IP -- atm only one request can be pending at a time (aka 1 temporary filename only) */
 				bool ip = atoi(message3); /* specified an IP? */
 
 				if (!tk) {
@@ -14816,7 +16056,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				fake_waitpid_ping = p_ptr->id; /* Poll result to admin */
 				return;
 			}
-			else if (prefix(messagelc, "/clver")) { /* Request version details (long version) from a client */
+			case SCMD_CLVER: { /* Request version details (long version) from a client */
 				if (!tk) {
 					msg_print(Ind, "\377oUsage: /clver <character name>");
 					return;
@@ -14839,7 +16079,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #ifdef EQUIPMENT_SET_BONUS
-			else if (prefix(messagelc, "/chkset")) { /* check artifact-name-based set bonus to LUCK */
+			case SCMD_CHKSET: { /* check artifact-name-based set bonus to LUCK */
 				player_type *p_ptr;
 
 				if (!tk) {
@@ -14859,11 +16099,11 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #endif
-			else if (prefix(messagelc, "/reorder")) {
+			case SCMD_REORDER: {
 				reorder_pack(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/exportpstores")) {
+			case SCMD_EXPORTPSTORES: {
 #if 0 /* export_turns is local in dungeon() only atm */
 				export_turns = 1;
 #else
@@ -14875,7 +16115,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* retrieve items from a (possibly lost due to changed rng) list house */
-			else if (prefix(messagelc, "/gettradhouseitems")) {
+			case SCMD_GETTRADHOUSEITEMS: {
 				int h_idx;
 				house_type *h_ptr;
 				char *tname;
@@ -14915,7 +16155,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* retrieve items from a (possibly lost due to changed rng) list house */
-			else if (prefix(messagelc, "/tohou")) {
+			case SCMD_TOHOU: {
 				int h_idx;
 				house_type *h_ptr;
 
@@ -14940,7 +16180,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* NOTE: Mushroom fields are currently only reindexed on WILD_F_GARDENS flag, so they would need to be saved to disk or each server restart clears WILD_F_GARDENS */
-			else if (prefix(messagelc, "/mushroomfields")) {
+			case SCMD_MUSHROOMFIELDS: {
 				char buf[MAX_CHARS] = { 0 }, c;
 				struct worldpos tpos;
 
@@ -14967,7 +16207,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Allocates and deallocates every sector of the whole wilderness */
-			else if (prefix(messagelc, "/cyclewild")) {
+			case SCMD_CYCLEWILD: {
 				int wx, wy;
 				struct worldpos tpos;
 				cave_type **zcave;
@@ -14991,7 +16231,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 			/* Check player's food consumption rate */
-			else if (prefix(messagelc, "/food")) {
+			case SCMD_FOOD: {
 				if (!tk) {
 					msg_print(Ind, "\377oUsage: /food <character name>");
 					return;
@@ -15008,7 +16248,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 			/* Toggle perma-staticness of a floor via LF2_STATIC 'perma-static' flag that holds a floor static until the flag is cleared again.
 			   Usage: /pstat [0|1]   - 0 = unstatic, 1 = static, no parm = toggle. */
-			else if (prefix(messagelc, "/pstat")) {
+			case SCMD_PSTAT: {
 				struct dun_level *l_ptr = getfloor(&p_ptr->wpos);
 				u32b *lflags2;
 
@@ -15040,7 +16280,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/prmap")) {
+			case SCMD_PRMAP: {
 				if (!tk) p_ptr->redraw |= PR_MAP;
 				else {
 					j = name_lookup_loose(Ind, message3, FALSE, TRUE, FALSE);
@@ -15052,7 +16292,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/sflags")) { /* Print or modify server info flags */
+			case SCMD_SFLAGS: { /* Print or modify server info flags */
 				u32b f;
 
 				if (messagelc[7] && (messagelc[7] < '0' || messagelc[7] > '3')) {
@@ -15104,7 +16344,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				for (f = 1; f <= NumPlayers; f++) Send_sflags(f);
 				return;
 			}
-			else if (prefix(messagelc, "/mego")) { /* Modify level, rarity, mrarity of an item ego power in memory temporarily (not saved to e_info, so resets on restart) */
+			case SCMD_MEGO: { /* Modify level, rarity, mrarity of an item ego power in memory temporarily (not saved to e_info, so resets on restart) */
 				if (tk != 1 && tk != 4) {
 					msg_print(Ind, "Usage 1 (get): /mego <ego N-index>");
 					msg_print(Ind, "Usage 2 (set): /mego <ego N-index> <new level> <new rarity> <new mrarity>");
@@ -15120,7 +16360,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				e_info[k].mrarity = atoi(token[4]);
 				return;
 			}
-			else if (prefix(messagelc, "/invcur")) { /* heavycurse-inverse-flip an item manually */
+			case SCMD_INVCUR: { /* heavycurse-inverse-flip an item manually */
 				object_type *o_ptr;
 
 				if (tk != 1) {
@@ -15137,7 +16377,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				inverse_cursed(o_ptr);
 				return;
 			}
-			else if (prefix(messagelc, "/revcur")) { /* heavycurse-reverse-flip an item manually */
+			case SCMD_REVCUR: { /* heavycurse-reverse-flip an item manually */
 				object_type *o_ptr;
 
 				if (tk != 1) {
@@ -15154,12 +16394,12 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				reverse_cursed(o_ptr);
 				return;
 			}
-			else if (prefix(messagelc, "/rspumpkin")) {
+			case SCMD_RSPUMPKIN: {
 				great_pumpkin_killer1[0] = great_pumpkin_killer2[0] = 0;
 				return;
 			}
 #ifdef ENABLE_SUBINVEN
-			else if (prefix(messagelc, "/dbgsi")) { //display the first 3 elements of the first n subinventory arrays each
+			case SCMD_DBGSI: { //display the first 3 elements of the first n subinventory arrays each
 				object_type *o_ptr;
 				char o_name[ONAME_LEN];
 
@@ -15174,7 +16414,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 			}
 #endif
 #ifdef SERVER_PORTALS
-			else if (prefix(messagelc, "/relog")) { /* debugging/testing: Send PKT_RELOGIN request to our client */
+			case SCMD_RELOG: { /* debugging/testing: Send PKT_RELOGIN request to our client */
 				if (!message3[0]) {
 					msg_print(Ind, "Usage: /relog <hostname/ip>");
 					return;
@@ -15189,12 +16429,12 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				return;
 			}
 #endif
-			else if (prefix(messagelc, "/ondepth")) {
+			case SCMD_ONDEPTH: {
 				msg_format(Ind, "ondepth: %d", players_on_depth(&p_ptr->wpos));
 				return;
 			}
 			/* Relocates a character that can be online or offline */
-			else if (prefix(messagelc, "/relocatechar") || prefix(messagelc, "/relocchar") || prefix(messagelc, "/relchar")) {
+			case SCMD_RELOCATECHAR: {
 				int p, slot;
 				s32b p_id;
 				struct worldpos tpos;
@@ -15325,7 +16565,7 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				NumPlayers--;
 				return;
 			}
-			else if (prefix(messagelc, "/dbgmon")) {
+			case SCMD_DBGMON: {
 				monster_type *m_ptr;
 
 				for (i = 1; i < m_max; i++) {
@@ -15336,26 +16576,26 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/setfeat")) {
+			case SCMD_SETFEAT: {
 				msg_format(Ind, "Setting feat %d (%s) here.", k, f_name + f_info[k].name);
 				cave_set_feat_live(&p_ptr->wpos, p_ptr->py, p_ptr->px, k);
 				return;
 			}
 #ifdef ENABLE_GO_GAME
-			else if (prefix(messagelc, "/gogameup")) {
+			case SCMD_GOGAMEUP: {
 				go_engine_admin_up(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/gogamedown")) {
+			case SCMD_GOGAMEDOWN: {
 				go_engine_admin_down(Ind);
 				return;
 			}
-			else if (prefix(messagelc, "/gogamestatus")) {
+			case SCMD_GOGAMESTATUS: {
 				go_engine_admin_status(Ind);
 				return;
 			}
 #endif
-			else if (prefix(messagelc, "/printturnspeeds")) {
+			case SCMD_PRINTTURNSPEEDS: {
 				//for non-admins: min speed is 10, max speed 210
 				for (i = 10; i <= 110; i++) {
 				//for (i = 110; i <= 210; i++) {
@@ -15367,14 +16607,15 @@ void do_slash_cmd(int Ind, char *message, char *message_u) {
 				}
 				return;
 			}
-			else if (prefix(messagelc, "/debug-drops-freq")) {
+			case SCMD_DEBUG_DROPS_FREQ: {
 				print_debug_drops_freq(Ind);
 				return;
 			}
+			}
 		}
 	}
 
-	do_slash_brief_help(Ind);
+	if (!slash_dry_run) do_slash_brief_help(Ind);
 	return;
 }
 #endif /* NOTYET */
@@ -5492,8 +5492,10 @@ static bool project_f(int Ind, int who, int r, struct worldpos *wpos, int y, int
 			}
 
 			/* Unlock the door -- really correct like this? oO */
-			if (quiet) c_ptr->feat = FEAT_DOOR_HEAD + 0x00;
-			else cave_force_feat_live(wpos, y, x, FEAT_DOOR_HEAD + 0x00);
+			if (quiet) {
+				c_ptr->feat = FEAT_DOOR_HEAD + 0x00;
+				bump_feat_epoch(wpos);
+			} else cave_force_feat_live(wpos, y, x, FEAT_DOOR_HEAD + 0x00);
 
 			/* Clear mimic feature */
 			if ((cs_ptr = GetCS(c_ptr, CS_MIMIC))) cs_erase(c_ptr, cs_ptr);
@@ -5816,7 +5818,10 @@ static bool project_f(int Ind, int who, int r, struct worldpos *wpos, int y, int
 			cave_set_feat_live(wpos, y, x, FEAT_DOOR_HEAD + 0x00);
 			/* Observe */
 			if (*w_ptr & CAVE_MARK) obvious = TRUE;
-		} else c_ptr->feat = FEAT_DOOR_HEAD + 0x00;
+		} else {
+			c_ptr->feat = FEAT_DOOR_HEAD + 0x00;
+			bump_feat_epoch(wpos);
+		}
 		break;
 
 	/* Make traps */
@@ -10428,8 +10433,11 @@ static bool project_m(int Ind, int who, int y_origin, int x_origin, int r, struc
 		/* TODO: handle failure (eg. st-anchor)	*/
 
 		//teleport_away(c_ptr->m_idx, do_dist);
+		if (!m_ptr->do_dist) {
+			if (do_dist_num < MAX_M_IDX) do_dist_list[do_dist_num++] = c_ptr->m_idx;
+			else scan_do_dist = TRUE;
+		}
 		m_ptr->do_dist = do_dist;
-		scan_do_dist = TRUE;
 
 		/* The rest here is not needed as we didn't call teleport_away() here anymore: */
 
@@ -2153,6 +2153,8 @@ bool detect_creatures_xxx(int Ind, u32b match_flag) {
 	int  i, y, x;
 	bool flag = FALSE;
 	cptr desc_monsters = "weird monsters";
+	int k, n;
+	s16b *list;
 
 	dun_level *l_ptr = getfloor(&p_ptr->wpos);
 	cave_type **zcave = getcave(&p_ptr->wpos);
@@ -2169,7 +2171,10 @@ bool detect_creatures_xxx(int Ind, u32b match_flag) {
 	clear_ovl(Ind);
 
 	/* Scan monsters */
-	for (i = 1; i < m_max; i++) {
+	list = floor_query_begin();
+	n = floor_monsters_rect(zcave, p_ptr->panel_row_min, p_ptr->panel_col_min, p_ptr->panel_row_max, p_ptr->panel_col_max, NULL, list, FLOOR_QUERY_MAX);
+	for (k = 0; k < n; k++) {
+		i = list[k];
 		monster_type *m_ptr = &m_list[i];
 		monster_race *r_ptr = race_inf(m_ptr);
 
@@ -2227,6 +2232,7 @@ bool detect_creatures_xxx(int Ind, u32b match_flag) {
 			flag = TRUE;
 		}
 	}
+	floor_query_end(list);
 
 	/* Scan players */
 	for (i = 1; i <= NumPlayers; i++) {
@@ -2385,6 +2391,8 @@ bool detect_invisible(int Ind) {
 
 	dun_level *l_ptr = getfloor(&p_ptr->wpos);
 	cave_type **zcave = getcave(&p_ptr->wpos);
+	int k, n;
+	s16b *list;
 
 
 	/* anti-exploit */
@@ -2399,7 +2407,10 @@ bool detect_invisible(int Ind) {
 	clear_ovl(Ind);
 
 	/* Detect all invisible monsters */
-	for (i = 1; i < m_max; i++) {
+	list = floor_query_begin();
+	n = floor_monsters_rect(zcave, p_ptr->panel_row_min, p_ptr->panel_col_min, p_ptr->panel_row_max, p_ptr->panel_col_max, NULL, list, FLOOR_QUERY_MAX);
+	for (k = 0; k < n; k++) {
+		i = list[k];
 		monster_type *m_ptr = &m_list[i];
 		monster_race *r_ptr = race_inf(m_ptr);
 
@@ -2454,6 +2465,7 @@ bool detect_invisible(int Ind) {
 			flag = TRUE;
 		}
 	}
+	floor_query_end(list);
 
 	/* Detect all invisible players */
 	for (i = 1; i <= NumPlayers; i++) {
@@ -2548,6 +2560,8 @@ bool detect_creatures(int Ind) {
 
 	dun_level *l_ptr = getfloor(&p_ptr->wpos);
 	cave_type **zcave = getcave(&p_ptr->wpos);
+	int k, n;
+	s16b *list;
 
 
 	/* anti-exploit */
@@ -2562,7 +2576,10 @@ bool detect_creatures(int Ind) {
 	clear_ovl(Ind);
 
 	/* Detect non-invisible monsters */
-	for (i = 1; i < m_max; i++) {
+	list = floor_query_begin();
+	n = floor_monsters_rect(zcave, p_ptr->panel_row_min, p_ptr->panel_col_min, p_ptr->panel_row_max, p_ptr->panel_col_max, NULL, list, FLOOR_QUERY_MAX);
+	for (k = 0; k < n; k++) {
+		i = list[k];
 		monster_type *m_ptr = &m_list[i];
 		monster_race *r_ptr = race_inf(m_ptr);
 
@@ -2612,6 +2629,7 @@ bool detect_creatures(int Ind) {
 			flag = TRUE;
 		}
 	}
+	floor_query_end(list);
 
 	/* Detect non-invisible players */
 	for (i = 1; i <= NumPlayers; i++) {
@@ -2702,6 +2720,8 @@ bool detect_noise(int Ind) {
 	bool	flag = FALSE;
 	dun_level *l_ptr = getfloor(&p_ptr->wpos);
 	cave_type **zcave = getcave(&p_ptr->wpos);
+	int k, n;
+	s16b *list;
 
 	/* anti-exploit */
 	if (!local_panel(Ind)) return(FALSE);
@@ -2715,7 +2735,10 @@ bool detect_noise(int Ind) {
 	clear_ovl(Ind);
 
 	/* Detect non-invisible monsters */
-	for (i = 1; i < m_max; i++) {
+	list = floor_query_begin();
+	n = floor_monsters_rect(zcave, p_ptr->panel_row_min, p_ptr->panel_col_min, p_ptr->panel_row_max, p_ptr->panel_col_max, NULL, list, FLOOR_QUERY_MAX);
+	for (k = 0; k < n; k++) {
+		i = list[k];
 		monster_type *m_ptr = &m_list[i];
 		monster_race *r_ptr = race_inf(m_ptr);
 		int fy = m_ptr->fy;
@@ -2770,6 +2793,7 @@ bool detect_noise(int Ind) {
 			flag = TRUE;
 		}
 	}
+	floor_query_end(list);
 
 	/* Detect non-invisible players */
 	for (i = 1; i <= NumPlayers; i++) {
@@ -2855,6 +2879,8 @@ bool detect_living(int Ind) {
 	bool	flag = FALSE;
 	dun_level *l_ptr = getfloor(&p_ptr->wpos);
 	cave_type **zcave = getcave(&p_ptr->wpos);
+	int k, n;
+	s16b *list;
 
 	/* anti-exploit */
 	if (!local_panel(Ind)) return(FALSE);
@@ -2868,7 +2894,10 @@ bool detect_living(int Ind) {
 	clear_ovl(Ind);
 
 	/* Detect (even invisible) monsters */
-	for (i = 1; i < m_max; i++) {
+	list = floor_query_begin();
+	n = floor_monsters_rect(zcave, p_ptr->panel_row_min, p_ptr->panel_col_min, p_ptr->panel_row_max, p_ptr->panel_col_max, NULL, list, FLOOR_QUERY_MAX);
+	for (k = 0; k < n; k++) {
+		i = list[k];
 		monster_type *m_ptr = &m_list[i];
 		monster_race *r_ptr = race_inf(m_ptr);
 		int fy = m_ptr->fy;
@@ -2918,6 +2947,7 @@ bool detect_living(int Ind) {
 			flag = TRUE;
 		}
 	}
+	floor_query_end(list);
 
 	/* Detect (even invisible) players */
 	for (i = 1; i <= NumPlayers; i++) {
@@ -5351,9 +5381,17 @@ void aggravate_monsters(int Ind, int who) {
 
 	bool sleep = FALSE;
 	bool speed = FALSE;
+	int k, n;
+	s16b *list;
+	cave_type **zcave = getcave(&p_ptr->wpos);
+
+	if (!zcave) return;
 
 	/* Aggravate everyone nearby */
-	for (i = 1; i < m_max; i++) {
+	list = floor_query_begin();
+	n = floor_monsters_radius(zcave, p_ptr->py, p_ptr->px, MAX_SIGHT * 2 - 1, NULL, list, FLOOR_QUERY_MAX);
+	for (k = 0; k < n; k++) {
+		i = list[k];
 		m_ptr = &m_list[i];
 		r_ptr = race_inf(m_ptr);
 
@@ -5394,6 +5432,7 @@ void aggravate_monsters(int Ind, int who) {
 			}
 		}
 	}
+	floor_query_end(list);
 
 	/* Messages */
 	/* the_sandman: added _near so other players can hear too */
@@ -5413,9 +5452,17 @@ void wakeup_monsters(int Ind, int who) {
 	player_type *p_ptr = Players[Ind];
 	int i;
 	bool sleep = FALSE;
+	int k, n;
+	s16b *list;
+	cave_type **zcave = getcave(&p_ptr->wpos);
+
+	if (!zcave) return;
 
 	/* Aggravate everyone nearby */
-	for (i = 1; i < m_max; i++) {
+	list = floor_query_begin();
+	n = floor_monsters_radius(zcave, p_ptr->py, p_ptr->px, MAX_SIGHT * 2 - 1, NULL, list, FLOOR_QUERY_MAX);
+	for (k = 0; k < n; k++) {
+		i = list[k];
 		monster_type	*m_ptr = &m_list[i];
 
 		/* Paranoia -- Skip dead monsters */
@@ -5442,6 +5489,7 @@ void wakeup_monsters(int Ind, int who) {
 			}
 		}
 	}
+	floor_query_end(list);
 
 	/* Messages */
 	/* the_sandman: added _near so other players can hear too */
@@ -5456,9 +5504,17 @@ void wakeup_monsters_somewhat(int Ind, int who) {
 	int i;
 	bool sleep = FALSE;
 	monster_type *m_ptr;
+	int k, n;
+	s16b *list;
+	cave_type **zcave = getcave(&p_ptr->wpos);
+
+	if (!zcave) return;
 
 	/* Aggravate everyone nearby */
-	for (i = 1; i < m_max; i++) {
+	list = floor_query_begin();
+	n = floor_monsters_radius(zcave, p_ptr->py, p_ptr->px, MAX_SIGHT * 2 - 1, NULL, list, FLOOR_QUERY_MAX);
+	for (k = 0; k < n; k++) {
+		i = list[k];
 		m_ptr = &m_list[i];
 
 		/* Paranoia -- Skip dead monsters */
@@ -5488,6 +5544,7 @@ void wakeup_monsters_somewhat(int Ind, int who) {
 			}
 		}
 	}
+	floor_query_end(list);
 
 #if 1 /* better style, not to display a msg maybe? */
 	/* Messages */
@@ -5707,13 +5764,21 @@ void taunt_monsters(int Ind) {
 	monster_race *r_ptr;
 	int i;
 	bool sleep = FALSE, tauntable;
+	int k, n;
+	s16b *list;
+	cave_type **zcave = getcave(&p_ptr->wpos);
+
+	if (!zcave) return;
 
 	msg_print(Ind, "You call out a taunt!");
 	msg_format_near(Ind, "%s calls out a taunt!", p_ptr->name);
 	break_cloaking(Ind, 0);
 	stop_precision(Ind);
 
-	for (i = 1; i < m_max; i++) {
+	list = floor_query_begin();
+	n = floor_monsters_radius(zcave, p_ptr->py, p_ptr->px, MAX_SIGHT, NULL, list, FLOOR_QUERY_MAX);
+	for (k = 0; k < n; k++) {
+		i = list[k];
 		m_ptr = &m_list[i];
 		r_ptr = race_inf(m_ptr);
 
@@ -5788,6 +5853,7 @@ void taunt_monsters(int Ind) {
 		if (ABS(m_ptr->fy - p_ptr->py) <= 1 && ABS(m_ptr->fx - p_ptr->px) <= 1)
 			m_ptr->last_target_melee = Ind;
 	}
+	floor_query_end(list);
 
 	if (sleep) {
 		msg_print(Ind, "You hear a sudden stirring in the distance!");
@@ -5799,9 +5865,17 @@ void taunt_monsters(int Ind) {
 void aggravate_monsters_floorpos(worldpos *wpos, int x, int y) {
 	int i;
 	monster_type *m_ptr;
+	int k, n;
+	s16b *list;
+	cave_type **zcave = getcave(wpos);
+
+	if (!zcave) return;
 
 	/* Aggravate everyone nearby */
-	for (i = 1; i < m_max; i++) {
+	list = floor_query_begin();
+	n = floor_monsters_radius(zcave, y, x, MAX_SIGHT * 2 - 1, NULL, list, FLOOR_QUERY_MAX);
+	for (k = 0; k < n; k++) {
+		i = list[k];
 		m_ptr = &m_list[i];
 
 		/* Paranoia -- Skip dead monsters */
@@ -5824,6 +5898,7 @@ void aggravate_monsters_floorpos(worldpos *wpos, int x, int y) {
 			}
 		}
 	}
+	floor_query_end(list);
 }
 
 
@@ -6030,6 +6105,11 @@ bool genocide_aux(int Ind, worldpos *wpos, char typ) {
 	return(result);
 }
 
+/* Hook for floor_monsters_nearest() */
+static bool monster_not_unique(int m_idx) {
+	return(!(race_inf(&m_list[m_idx])->flags1 & RF1_UNIQUE));
+}
+
 /*
  * Delete all non-unique monsters of a given "type" from the level
  *
@@ -6038,9 +6118,9 @@ bool genocide_aux(int Ind, worldpos *wpos, char typ) {
  */
 bool genocide(int Ind) {
 	player_type *p_ptr = Players[Ind];
-	int	i;
+	s16b	m_idx;
 	char	typ = -1;
-	int	d = 999, tmp;
+	int	d = 999;
 
 	worldpos *wpos = &p_ptr->wpos;
 	dun_level *l_ptr = getfloor(wpos);
@@ -6049,28 +6129,10 @@ bool genocide(int Ind) {
 	if (!(zcave = getcave(wpos))) return(FALSE);
 	if (l_ptr && (l_ptr->flags1 & LF1_NO_GENO)) return(FALSE);	// double check..
 
-	/* Search all monsters and find the closest */
-	for (i = 1; i < m_max; i++) {
-		monster_type *m_ptr = &m_list[i];
-		monster_race *r_ptr = race_inf(m_ptr);
-
-		/* Paranoia -- Skip dead monsters */
-		if (!m_ptr->r_idx) continue;
-
-		/* Hack -- Skip Unique Monsters */
-		if (r_ptr->flags1 & RF1_UNIQUE) continue;
-
-		/* Skip monsters not on this depth */
-		if (!inarea(&p_ptr->wpos, &m_ptr->wpos)) continue;
-
-		/* Check distance */
-		if ((tmp = distance(p_ptr->py, p_ptr->px, m_ptr->fy, m_ptr->fx)) < d) {
-			/* Set closest distance */
-			d = tmp;
-
-			/* Set char */
-			typ = r_ptr->d_char;
-		}
+	/* Find the closest non-unique monster */
+	if (floor_monsters_nearest(zcave, p_ptr->py, p_ptr->px, 999, monster_not_unique, &m_idx, 1)) {
+		d = distance(p_ptr->py, p_ptr->px, m_list[m_idx].fy, m_list[m_idx].fx);
+		typ = race_inf(&m_list[m_idx])->d_char;
 	}
 
 	/* Check to make sure we found a monster */
@@ -6212,9 +6274,17 @@ bool probing(int Ind) {
 	player_type *p_ptr = Players[Ind];
 	struct worldpos *wpos = &p_ptr->wpos;
 	bool probe = FALSE;
+	int k, n;
+	s16b *list;
+	cave_type **zcave = getcave(wpos);
+
+	if (!zcave) return(FALSE);
 
 	/* Probe all (nearby) monsters */
-	for (i = 1; i < m_max; i++) {
+	list = floor_query_begin();
+	n = floor_monsters_radius(zcave, p_ptr->py, p_ptr->px, MAX_SIGHT, NULL, list, FLOOR_QUERY_MAX);
+	for (k = 0; k < n; k++) {
+		i = list[k];
 		m_ptr = &m_list[i];
 		r_ptr = race_inf(m_ptr);
 
@@ -6279,6 +6349,7 @@ bool probing(int Ind) {
 			probe = TRUE;
 		}
 	}
+	floor_query_end(list);
 
 	/* Done */
 	if (probe) msg_print(Ind, "That's all.");
@@ -9058,6 +9129,7 @@ static bool poly_build(int Ind, char *args) {
 			return(FALSE);
 		}
 		zcave[curr->sy][curr->sx].feat = FEAT_HOME_OPEN;
+		bump_feat_epoch(&curr->wpos);
 		/* CS_DNADOOR seems to be added twice (wild_add_uhouse)..
 		 * please correct it, Evileye?	- Jir -
 		 */
@@ -9145,6 +9217,9 @@ static bool poly_build(int Ind, char *args) {
 			curr->dna->price = area * area * 400; //initial_house_price(&houses[num_houses])
 			wild_add_uhouse(&houses[num_houses]);
 			msg_print(Ind, "You have completed your house");
+#ifdef HOUSE_INDEX
+			house_index_add(num_houses);
+#endif
 			num_houses++;
 		} else {
 			msg_print(Ind, "Your house was built unsoundly");
@@ -9160,6 +9235,7 @@ static bool poly_build(int Ind, char *args) {
 	if (inarea(&curr->wpos, &p_ptr->wpos) && !(zcave[curr->dy][curr->dx].info & CAVE_ICKY && zcave[curr->dy][curr->dx].feat == FEAT_DEEP_WATER)) {
 		zcave[curr->dy][curr->dx].feat = FEAT_WALL_EXTRA;
 		//zcave[curr->dy][curr->dx].feat = FEAT_WALL_HOUSE;
+		bump_feat_epoch(&curr->wpos);
 		if (curr->cvert < MAXCOORD && (--curr->moves) > 0) return(TRUE);
 		p_ptr->update |= PU_VIEW;
 	}
@@ -11393,6 +11469,9 @@ void arm_charge(int Ind, int item, int dir) {
 	o2_ptr->marked2 = ITEM_REMOVAL_MONTRAP;
 
 	arm_charge_dir_and_fuse(o2_ptr, dir);
+#ifdef TIMED_OBJECT_LIST
+	object_timed_check(o2_idx);
+#endif
 
 	/* Finally, do place the standalone charge-item into the monster trap feat */
 
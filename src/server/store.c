@@ -29,6 +29,11 @@
    Adjusting it to balance art scroll rarity in EBM - C. Blue (see EBM in st_info.txt for more) */
 #define MAX_MAINTENANCES	10
 
+#ifdef STORE_ITEM_POOL
+/* Number of ready-made items a store may keep in its pool, enough for a restock after MAX_MAINTENANCES */
+ #define STORE_POOL_SIZE(st_ptr)	((st_ptr)->stock_size * 3)
+#endif
+
 /* Prevent items in stores which got a power < 0 in apply_magic() yet didn't turn out CURSED?
    These items will end up with very low boni, below their k_info values, and therefore be somewhat
    useless, since they won't be bought anyway. - C. Blue */
@@ -243,6 +248,9 @@ void dealloc_stores(int townval) {
 
 		/* Free stock */
 		C_KILL(st_ptr->stock, st_ptr->stock_size, object_type);
+#ifdef STORE_ITEM_POOL
+		if (st_ptr->pool) C_KILL(st_ptr->pool, STORE_POOL_SIZE(st_ptr), object_type);
+#endif
 	}
 
 	/* Free stores */
@@ -2110,8 +2118,17 @@ static int kind_is_storeok(int k_idx, u64b resf) {
 	return(p);
 }
 
+#ifdef OBJ_NUM_CACHE
+/* For the get_obj_num() cache: Identify kind_is_storeok() and its global state */
+int store_obj_hook_id(int (*hook)(int k_idx, u64b resf), u32b *state) {
+	if (hook != kind_is_storeok) return(0);
+	*state = ((u32b)store_tval << 16) | (u32b)(store_level / 2);
+	return(1);
+}
+#endif
+
 /*
- * Creates a random item and gives it to a store
+ * Creates a random item for a store, returns FALSE if none came up
  * This algorithm needs to be rethought.  A lot.
  * Currently, "normal" stores use a pre-built array.
  *
@@ -2121,13 +2138,11 @@ static int kind_is_storeok(int k_idx, u64b resf) {
  *
  * Should we check for "permission" to have the given item?
  */
-static void store_create(store_type *st_ptr) {
+static bool store_create_obj(store_type *st_ptr, object_type *o_ptr) {
 	int i = 0, tries, level, chance, item;
 	int floor_level = 0, p;
 	int value, rarity, rarity2; /* for ego power checks */
 
-	object_type tmp_obj;
-	object_type *o_ptr = &tmp_obj;
 	int force_num;
 	object_kind *k_ptr;
 	ego_item_type *e_ptr, *e2_ptr;
@@ -2137,9 +2152,6 @@ static void store_create(store_type *st_ptr) {
 	bool black_market = (st_info[st_ptr->st_idx].flags1 & SF1_ALL_ITEM) != 0;
 	//bool town_bm = (st_ptr->st_idx == STORE_BLACK);
 
-	/* Paranoia -- no room left */
-	if (st_ptr->stock_num >= st_ptr->stock_size) return;
-
 	if (black_market) {
 		resf = RESF_MASK_STOREBM;
 
@@ -2735,12 +2747,83 @@ static void store_create(store_type *st_ptr) {
 
 		if (st_info[st_ptr->st_idx].flags1 & SF1_ZEROLEVEL) o_ptr->level = 0;
 
-		/* Attempt to carry the (known) item */
-		store_carry(st_ptr, o_ptr);
-
 		/* Definitely done */
-		break;
+		return(TRUE);
 	}
+
+	return(FALSE);
+}
+
+#ifdef STORE_ITEM_POOL
+/*
+ * Creating store items is expensive (60 tries for black markets, all of them
+ * going through get_obj_num() and apply_magic()), and a store that wasn't
+ * visited for a while is maintained up to MAX_MAINTENANCES times right when a
+ * player walks in. So each store that got restocked once keeps a pool of items
+ * that were made for it in advance by store_pool_refill(), in idle time, and
+ * store_create() takes its items from there as long as there are any.
+ * The items are made exactly like store_create() would, so the stock ends up
+ * the same, just without the wait. '/stpool check' compares both.
+ */
+
+/* no pool use while '/stpool check' restocks the old way */
+static bool store_pool_off = FALSE;
+
+/* statistics for /stpool */
+static u32b pool_hits = 0, pool_misses = 0, pool_made = 0, pool_crap = 0;
+static u32b restock_num = 0, restock_usec = 0, restock_usec_max = 0;
+
+/* The level basis store_create_obj() uses for this store */
+static int store_pool_level(store_type *st_ptr) {
+	if (st_ptr->st_idx >= STORE_GENERAL_DUN && st_ptr->st_idx <= STORE_RUNE_DUN)
+		return(town[st_ptr->town].dlev_depth);
+	return(town[st_ptr->town].baselevel);
+}
+
+/* Take a ready-made item from the pool of the store */
+static bool store_pool_get(store_type *st_ptr, object_type *o_ptr) {
+	if (!st_ptr->pool || store_pool_off) return(FALSE);
+
+	/* (Dungeon) town level changed since the items were made? */
+	if (st_ptr->pool_num && st_ptr->pool_lev != store_pool_level(st_ptr)) st_ptr->pool_num = 0;
+
+	while (st_ptr->pool_num) {
+		*o_ptr = st_ptr->pool[--st_ptr->pool_num];
+
+		/* Another store might have started to offer it meanwhile */
+		if ((st_info[st_ptr->st_idx].flags1 & SF1_ALL_ITEM) && black_market_crap(o_ptr, st_ptr->st_idx)) {
+			pool_crap++;
+			continue;
+		}
+
+		pool_hits++;
+		return(TRUE);
+	}
+
+	pool_misses++;
+	return(FALSE);
+}
+#endif
+
+/*
+ * Creates a random item and gives it to a store
+ */
+static void store_create(store_type *st_ptr) {
+	object_type forge;
+
+	/* Paranoia -- no room left */
+	if (st_ptr->stock_num >= st_ptr->stock_size) return;
+
+#ifdef STORE_ITEM_POOL
+	/* Take a ready-made one if there is any */
+	if (store_pool_get(st_ptr, &forge)) {
+		store_carry(st_ptr, &forge);
+		return;
+	}
+#endif
+
+	/* Attempt to carry the (known) item */
+	if (store_create_obj(st_ptr, &forge)) store_carry(st_ptr, &forge);
 }
 
 /*
@@ -5303,10 +5386,14 @@ void do_cmd_store(int Ind) {
 
 	if (maintain_num) {
 		/* Maintain the store */
+#ifdef STORE_ITEM_POOL
+		store_restock(st_ptr, maintain_num);
+#else
 		for (i = 0; i < maintain_num; i++) {
 			store_maint(st_ptr);
 			if (retire_owner_p(st_ptr)) store_shuffle(st_ptr);
 		}
+#endif
 
 		/* Save the visit */
 		st_ptr->last_visit = turn;
@@ -5848,6 +5935,226 @@ void store_maint(store_type *st_ptr) {
 	}
 }
 
+#ifdef STORE_ITEM_POOL
+/*
+ * Make a few items for the pools of stores that were restocked before, one slice
+ * of the "store_pool" world job: 'budget' items, returns TRUE when all stores were done.
+ */
+bool store_pool_refill(int *cursor, int budget) {
+	store_type *st_ptr;
+	int lev;
+
+	while (*cursor < numtowns * max_st_idx && budget > 0) {
+		st_ptr = &town[*cursor / max_st_idx].townstore[*cursor % max_st_idx];
+
+		/* No pool yet, or it is full */
+		if (!st_ptr->pool || st_ptr->pool_num >= STORE_POOL_SIZE(st_ptr)) {
+			(*cursor)++;
+			continue;
+		}
+
+		lev = store_pool_level(st_ptr);
+		if (st_ptr->pool_lev != lev) {
+			st_ptr->pool_num = 0;
+			st_ptr->pool_lev = lev;
+		}
+
+		/* Stay on this store unless it didn't come up with anything */
+		budget--;
+		if (store_create_obj(st_ptr, &st_ptr->pool[st_ptr->pool_num])) {
+			st_ptr->pool_num++;
+			pool_made++;
+		} else (*cursor)++;
+	}
+
+	return(*cursor >= numtowns * max_st_idx);
+}
+
+/*
+ * Do the 'num' store maintenances that are due when a player enters a store.
+ */
+void store_restock(store_type *st_ptr, int num) {
+	struct timeval time_begin, time_end;
+	u32b usec;
+	int i;
+
+	gettimeofday(&time_begin, NULL);
+
+	for (i = 0; i < num; i++) {
+		store_maint(st_ptr);
+		if (retire_owner_p(st_ptr)) store_shuffle(st_ptr);
+	}
+
+	/* From now on keep a pool for this store, unless it isn't stocked by us anyway */
+	if (!st_ptr->pool && st_ptr->stock_num && !(st_info[st_ptr->st_idx].flags2 & SF2_MUSEUM)) {
+		C_MAKE(st_ptr->pool, STORE_POOL_SIZE(st_ptr), object_type);
+		st_ptr->pool_num = 0;
+		st_ptr->pool_lev = store_pool_level(st_ptr);
+	}
+
+	gettimeofday(&time_end, NULL);
+	usec = (time_end.tv_sec - time_begin.tv_sec) * 1000000L + (time_end.tv_usec - time_begin.tv_usec);
+	restock_num++;
+	restock_usec += usec;
+	if (usec > restock_usec_max) restock_usec_max = usec;
+}
+
+void store_pool_report(int Ind) {
+	int i, n, stores = 0, items = 0;
+
+	for (i = 0; i < numtowns; i++)
+		for (n = 0; n < max_st_idx; n++) {
+			if (!town[i].townstore[n].pool) continue;
+			stores++;
+			items += town[i].townstore[n].pool_num;
+		}
+
+	msg_format(Ind, "Store pools: %d stores, %d items waiting. %u made, %u taken, %u misses, %u dropped as crap.",
+	    stores, items, pool_made, pool_hits, pool_misses, pool_crap);
+	if (restock_num)
+		msg_format(Ind, "Restocks on entering: %u, %u us on average, %u us worst.",
+		    restock_num, restock_usec / restock_num, restock_usec_max);
+}
+
+void store_pool_reset(void) {
+	pool_hits = pool_misses = pool_made = pool_crap = 0;
+	restock_num = restock_usec = restock_usec_max = 0;
+}
+
+/* What '/stpool check' looks at in the stock after a restock */
+typedef struct restock_tally restock_tally;
+struct restock_tally {
+	u32b slots, items, sale, egos;
+	u32b tval[256];
+	u32b usec;
+};
+
+static void restock_count(store_type *st_ptr, restock_tally *t) {
+	int i;
+
+	t->slots += st_ptr->stock_num;
+	for (i = 0; i < st_ptr->stock_num; i++) {
+		object_type *o_ptr = &st_ptr->stock[i];
+
+		t->items += o_ptr->number;
+		t->tval[o_ptr->tval]++;
+		if (o_ptr->discount) t->sale++;
+		if (o_ptr->name2) t->egos++;
+	}
+}
+
+/* Total variation distance of two item type distributions, in permille */
+static int restock_tval_dist(restock_tally *a, restock_tally *b) {
+	int i;
+	u32b d = 0;
+	u64b x, y;
+
+	if (!a->slots || !b->slots) return(0);
+	for (i = 0; i < 256; i++) {
+		x = (u64b)a->tval[i] * b->slots;
+		y = (u64b)b->tval[i] * a->slots;
+		d += (u32b)(((x > y ? x - y : y - x) * 1000) / ((u64b)a->slots * b->slots));
+	}
+	return(d / 2);
+}
+
+static void restock_run(store_type *st_ptr, store_type *work, object_type *stock, int num, bool pooled, restock_tally *t) {
+	struct timeval time_begin, time_end;
+	int i;
+
+	/* Start from the same store every time */
+	*st_ptr = *work;
+	C_COPY(st_ptr->stock, stock, st_ptr->stock_size, object_type);
+
+	/* Have a full pool, like store_pool_refill() keeps it */
+	if (pooled) {
+		st_ptr->pool_num = 0;
+		st_ptr->pool_lev = store_pool_level(st_ptr);
+		for (i = 0; i < 100 * STORE_POOL_SIZE(st_ptr) && st_ptr->pool_num < STORE_POOL_SIZE(st_ptr); i++)
+			if (store_create_obj(st_ptr, &st_ptr->pool[st_ptr->pool_num])) st_ptr->pool_num++;
+	} else store_pool_off = TRUE;
+
+	gettimeofday(&time_begin, NULL);
+	for (i = 0; i < num; i++) {
+		store_maint(st_ptr);
+		if (retire_owner_p(st_ptr)) store_shuffle(st_ptr);
+	}
+	gettimeofday(&time_end, NULL);
+	store_pool_off = FALSE;
+	t->usec += (time_end.tv_sec - time_begin.tv_sec) * 1000000L + (time_end.tv_usec - time_begin.tv_usec);
+
+	restock_count(st_ptr, t);
+}
+
+/* This all happens within one frame, so keep it short */
+#define RESTOCK_CHECK_NUM_MAX	MAX_MAINTENANCES
+#define RESTOCK_CHECK_RUNS_MAX	20
+
+/*
+ * Restock store 'st_idx' of town 0 'runs' times each, by 'num' maintenances
+ * starting from its current stock: twice without the pool (to see how much the
+ * results vary anyway) and once with a full pool, and compare the stocks.
+ * The store is left as it was.
+ */
+void store_restock_check(int Ind, int st_idx, int num, int runs) {
+	store_type *st_ptr, saved, work;
+	object_type *stock;
+	restock_tally *t;
+	int r, m;
+	u32b hits = pool_hits, misses = pool_misses, made = pool_made, crap = pool_crap;
+
+	if (st_idx < 0 || st_idx >= max_st_idx) {
+		msg_format(Ind, "Store index must be 0 to %d.", max_st_idx - 1);
+		return;
+	}
+	if (num > RESTOCK_CHECK_NUM_MAX) num = RESTOCK_CHECK_NUM_MAX;
+	if (runs > RESTOCK_CHECK_RUNS_MAX) runs = RESTOCK_CHECK_RUNS_MAX;
+	st_ptr = &town[0].townstore[st_idx];
+
+	C_MAKE(t, 3, restock_tally);
+	C_MAKE(stock, st_ptr->stock_size, object_type);
+	C_COPY(stock, st_ptr->stock, st_ptr->stock_size, object_type);
+	saved = work = *st_ptr;
+
+	/* Don't touch the real pool */
+	C_MAKE(work.pool, STORE_POOL_SIZE(st_ptr), object_type);
+
+	for (r = 0; r < runs; r++)
+		for (m = 0; m < 3; m++)
+			restock_run(st_ptr, &work, stock, num, m == 2, &t[m]);
+
+	/* Put everything back */
+	*st_ptr = saved;
+	C_COPY(st_ptr->stock, stock, st_ptr->stock_size, object_type);
+	pool_hits = hits;
+	pool_misses = misses;
+	pool_made = made;
+	pool_crap = crap;
+
+	for (m = 0; m < 3; m++)
+		msg_format(Ind, "%s: %d.%02d slots, %d.%02d items, %d.%02d egos, %d.%02d on sale, %d us per restock",
+		    m == 2 ? "Pooled" : (m ? "Unpooled (2)" : "Unpooled (1)"),
+		    t[m].slots / runs, (t[m].slots * 100 / runs) % 100,
+		    t[m].items / runs, (t[m].items * 100 / runs) % 100,
+		    t[m].egos / runs, (t[m].egos * 100 / runs) % 100,
+		    t[m].sale / runs, (t[m].sale * 100 / runs) % 100,
+		    t[m].usec / runs);
+	msg_format(Ind, "Store %d, %d maintenances, %d runs. Item type distance: unpooled/unpooled %d.%d%%, unpooled/pooled %d.%d%%",
+	    st_idx, num, runs,
+	    restock_tval_dist(&t[0], &t[1]) / 10, restock_tval_dist(&t[0], &t[1]) % 10,
+	    restock_tval_dist(&t[0], &t[2]) / 10, restock_tval_dist(&t[0], &t[2]) % 10);
+	s_printf("STORE_POOL_CHECK: store %d, %d maintenances, %d runs: slots %u/%u/%u, items %u/%u/%u, egos %u/%u/%u, sale %u/%u/%u, dist %d/%d, us %u/%u/%u\n",
+	    st_idx, num, runs, t[0].slots, t[1].slots, t[2].slots, t[0].items, t[1].items, t[2].items,
+	    t[0].egos, t[1].egos, t[2].egos, t[0].sale, t[1].sale, t[2].sale,
+	    restock_tval_dist(&t[0], &t[1]), restock_tval_dist(&t[0], &t[2]),
+	    t[0].usec / runs, t[1].usec / runs, t[2].usec / runs);
+
+	C_KILL(work.pool, STORE_POOL_SIZE(st_ptr), object_type);
+	C_KILL(stock, st_ptr->stock_size, object_type);
+	C_KILL(t, 3, restock_tally);
+}
+#endif
+
 
 /*
  * Initialize the stores
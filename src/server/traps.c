@@ -2362,14 +2362,18 @@ bool player_activate_trap_type(int Ind, s16b y, s16b x, object_type *i_ptr, int
 
 		/* Cleaning Trap */
 		case TRAP_OF_CLEANING: {
-			int ix, iy;
+			int ix, iy, n, j;
 			char o_name[ONAME_LEN];
+			object_type *o_ptr;
+			s16b *list;
 
 			if (istownarea(wpos, MAX_TOWNAREA)) break;
 
-			/* Delete the existing objects */
-			for (k = 1; k < o_max; k++) {
-				object_type *o_ptr = &o_list[k];
+			/* Delete the existing objects within a certain radius */
+			list = floor_query_begin();
+			n = floor_objects_radius(zcave, y, x, dlev / 5 + 5, list, FLOOR_QUERY_MAX);
+			for (j = 0; j < n; j++) {
+				o_ptr = &o_list[k = list[j]];
 
 				/* Skip dead objects */
 				if (!o_ptr->k_idx) continue;
@@ -2377,9 +2381,6 @@ bool player_activate_trap_type(int Ind, s16b y, s16b x, object_type *i_ptr, int
 				/* Skip monster inventory/monster trap items */
 				if (o_ptr->held_m_idx || o_ptr->embed) continue;
 
-				/* Skip objects not on this depth */
-				if (!inarea(&o_ptr->wpos, wpos)) continue;
-
 				/* Skip 'owned' items, so that this won't be too harsh
 				 * in the rescue scene */
 				if (o_ptr->owner) continue;
@@ -2387,9 +2388,6 @@ bool player_activate_trap_type(int Ind, s16b y, s16b x, object_type *i_ptr, int
 				ix = o_ptr->ix;
 				iy = o_ptr->iy;
 
-				/* Only within certain radius */
-				if (distance(y, x, iy, ix) > dlev / 5 + 5) continue;
-
 				/* Mega-Hack -- preserve artifacts */
 				if (true_artifact_p(o_ptr)) { /* && !object_known_p(o_ptr)*/
 					if (a_info[o_ptr->name1].flags4 & TR4_SPECIAL_GENE)
@@ -2412,6 +2410,7 @@ bool player_activate_trap_type(int Ind, s16b y, s16b x, object_type *i_ptr, int
 				/* Wipe the object */
 				//WIPE(o_ptr, object_type);
 			}
+			floor_query_end(list);
 			/* Compact the object list */
 			compact_objects(0, FALSE);
 			ruin_chest(i_ptr);
@@ -3250,13 +3249,17 @@ void generic_activate_trap_type(struct worldpos *wpos, s16b y, s16b x, object_ty
 
 		/* Cleaning Trap */
 		case TRAP_OF_CLEANING: {
-			int ix, iy;
+			int n, j;
+			object_type *o_ptr;
+			s16b *list;
 
 			if (istownarea(wpos, MAX_TOWNAREA)) break;
 
-			/* Delete the existing objects */
-			for (k = 1; k < o_max; k++) {
-				object_type *o_ptr = &o_list[k];
+			/* Delete the existing objects within a certain radius */
+			list = floor_query_begin();
+			n = floor_objects_radius(zcave, y, x, dlev / 5 + 5, list, FLOOR_QUERY_MAX);
+			for (j = 0; j < n; j++) {
+				o_ptr = &o_list[k = list[j]];
 
 				/* Skip dead objects */
 				if (!o_ptr->k_idx) continue;
@@ -3264,19 +3267,10 @@ void generic_activate_trap_type(struct worldpos *wpos, s16b y, s16b x, object_ty
 				/* Skip monster inventory/monster trap items */
 				if (o_ptr->held_m_idx || o_ptr->embed) continue;
 
-				/* Skip objects not on this depth */
-				if (!inarea(&o_ptr->wpos, wpos)) continue;
-
 				/* Skip 'owned' items, so that this won't be too harsh
 				 * in the rescue scene */
 				if (o_ptr->owner) continue;
 
-				ix = o_ptr->ix;
-				iy = o_ptr->iy;
-
-				/* Only within certain radius */
-				if (distance(y, x, iy, ix) > dlev / 5 + 5) continue;
-
 				/* Mega-Hack -- preserve artifacts */
 				if (true_artifact_p(o_ptr)) { /* && !object_known_p(o_ptr)*/
 					if (a_info[o_ptr->name1].flags4 & TR4_SPECIAL_GENE)
@@ -3296,6 +3290,7 @@ void generic_activate_trap_type(struct worldpos *wpos, s16b y, s16b x, object_ty
 				/* Wipe the object */
 				//WIPE(o_ptr, object_type);
 			}
+			floor_query_end(list);
 			/* Compact the object list */
 			compact_objects(0, FALSE);
 			ruin_chest(i_ptr);
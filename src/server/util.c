@@ -11241,3 +11241,301 @@ struct dungeon_type *admin_dun(int Ind, bool *tower) {
 	} else d_ptr = wild->dungeon;
 	return(d_ptr);
 }
+
+#ifdef MEM_ACCOUNTING
+/*
+ * Heap accounting: an allocator backend for mem_set_hooks() that remembers
+ * size and call site of every live block in a hash table keyed by the block's
+ * address, and keeps live bytes/blocks per subsystem. The subsystem ('tag') is
+ * derived from the source file of the call site, see mem_tag_files[].
+ * The blocks are still plain malloc() blocks, so memory that was allocated
+ * before the hooks were installed or that is free()d directly doesn't hurt,
+ * it just isn't accounted (or stays in the table as a phantom leak).
+ */
+#define MEM_TAG_OTHER		0
+#define MEM_TAG_LEVELS		1
+#define MEM_TAG_OBJECTS		2
+#define MEM_TAG_MONSTERS	3
+#define MEM_TAG_PLAYERS		4
+#define MEM_TAG_STARTUP		5
+#define MEM_TAG_STRINGS		6
+#define MEM_TAG_LUA		7
+#define MEM_TAG_SOCKBUFS	8
+#define MEM_TAGS		9
+
+static cptr mem_tag_name[MEM_TAGS] = { "other", "levels", "objects", "monsters", "players", "startup", "strings", "lua", "sockbufs" };
+
+/* Source file name prefixes and the tag of their allocations */
+static struct {
+	cptr prefix;
+	byte tag;
+} mem_tag_files[] = {
+	{ "cave.c", MEM_TAG_LEVELS }, { "generate.c", MEM_TAG_LEVELS }, { "wild.c", MEM_TAG_LEVELS },
+	{ "object", MEM_TAG_OBJECTS }, { "store.c", MEM_TAG_OBJECTS }, { "auction.c", MEM_TAG_OBJECTS },
+	{ "monster", MEM_TAG_MONSTERS }, { "melee", MEM_TAG_MONSTERS },
+	{ "birth.c", MEM_TAG_PLAYERS }, { "party.c", MEM_TAG_PLAYERS }, { "nserver.c", MEM_TAG_PLAYERS }, { "save.c", MEM_TAG_PLAYERS },
+	{ "init", MEM_TAG_STARTUP }, { "load", MEM_TAG_STARTUP }, { "tables.c", MEM_TAG_STARTUP },
+	{ "lua", MEM_TAG_LUA }, { "w_", MEM_TAG_LUA }, { "tolua", MEM_TAG_LUA },
+	{ "sockbuf.c", MEM_TAG_SOCKBUFS },
+	{ NULL, 0 }
+};
+
+typedef struct mem_block mem_block;
+struct mem_block {
+	void *p;
+	cptr file;
+	u32b size;
+	u32b line_tag;		/* source line << 4 | tag */
+};
+
+static mem_block *mem_blocks = NULL;
+static u32b mem_blocks_size = 0, mem_blocks_num = 0;
+
+static u64b mem_tag_bytes[MEM_TAGS], mem_tag_allocs[MEM_TAGS], mem_bytes, mem_bytes_peak;
+static u32b mem_tag_blocks[MEM_TAGS];
+
+/* Tags of recently seen source files, by address of their __FILE__ string */
+#define MEM_SITE_CACHE	128
+static struct {
+	cptr file;
+	byte tag;
+} mem_site_cache[MEM_SITE_CACHE];
+
+#define MEM_HASH(p)	((u32b)((((u64b)(unsigned long)(p) >> 4) * 0x9E3779B97F4A7C15ULL) >> 32) & (mem_blocks_size - 1))
+
+static byte mem_site_tag(cptr file) {
+	int c = ((unsigned long)file >> 3) % MEM_SITE_CACHE, i;
+	cptr name;
+
+	if (!file) return(MEM_TAG_OTHER);
+	if (mem_site_cache[c].file == file) return(mem_site_cache[c].tag);
+
+	/* Strip the path */
+	if ((name = strrchr(file, '/'))) name++;
+	else name = file;
+
+	mem_site_cache[c].file = file;
+	mem_site_cache[c].tag = MEM_TAG_OTHER;
+	for (i = 0; mem_tag_files[i].prefix; i++) {
+		if (strncmp(name, mem_tag_files[i].prefix, strlen(mem_tag_files[i].prefix))) continue;
+		mem_site_cache[c].tag = mem_tag_files[i].tag;
+		break;
+	}
+	return(mem_site_cache[c].tag);
+}
+
+/* Double the size of the hash table (it lives outside of the accounted heap) */
+static void mem_blocks_grow(void) {
+	mem_block *old = mem_blocks;
+	u32b old_size = mem_blocks_size, i, j;
+
+	mem_blocks_size = old_size ? old_size * 2 : 65536;
+	if (!(mem_blocks = calloc(mem_blocks_size, sizeof(mem_block)))) quit("Out of Memory!");
+	for (i = 0; i < old_size; i++) {
+		if (!old[i].p) continue;
+		for (j = MEM_HASH(old[i].p); mem_blocks[j].p; j = (j + 1) & (mem_blocks_size - 1));
+		mem_blocks[j] = old[i];
+	}
+	free(old);
+}
+
+static void mem_block_add(void *p, size_t len) {
+	u32b i, tag;
+
+	if ((mem_blocks_num + 1) * 2 > mem_blocks_size) mem_blocks_grow();
+
+	tag = mem_site_string ? MEM_TAG_STRINGS : mem_site_tag(mem_site_file);
+	for (i = MEM_HASH(p); mem_blocks[i].p; i = (i + 1) & (mem_blocks_size - 1));
+	mem_blocks[i].p = p;
+	mem_blocks[i].file = mem_site_file;
+	mem_blocks[i].size = (u32b)len;
+	mem_blocks[i].line_tag = ((u32b)mem_site_line << 4) | tag;
+	mem_blocks_num++;
+
+	mem_tag_bytes[tag] += len;
+	mem_tag_blocks[tag]++;
+	mem_tag_allocs[tag]++;
+	mem_bytes += len;
+	if (mem_bytes > mem_bytes_peak) mem_bytes_peak = mem_bytes;
+}
+
+/* Forget a block that is about to be freed, if we know it */
+static void mem_block_forget(void *p) {
+	u32b i, j, k, mask = mem_blocks_size - 1;
+	byte tag;
+
+	if (!mem_blocks_num) return;
+	for (i = MEM_HASH(p); mem_blocks[i].p != p; i = (i + 1) & mask)
+		if (!mem_blocks[i].p) return;
+
+	tag = mem_blocks[i].line_tag & 0xF;
+	mem_tag_bytes[tag] -= mem_blocks[i].size;
+	mem_tag_blocks[tag]--;
+	mem_bytes -= mem_blocks[i].size;
+	mem_blocks_num--;
+
+	/* Linear probing: move later entries of the same run back into the gap */
+	for (j = i; ; ) {
+		j = (j + 1) & mask;
+		if (!mem_blocks[j].p) break;
+		k = MEM_HASH(mem_blocks[j].p);
+		if (i <= j ? (i < k && k <= j) : (i < k || k <= j)) continue;
+		mem_blocks[i] = mem_blocks[j];
+		i = j;
+	}
+	mem_blocks[i].p = NULL;
+}
+
+static void *mem_acct_alloc(size_t len) {
+	void *p = malloc(len);
+
+	if (p) mem_block_add(p, len);
+	return(p);
+}
+
+static void *mem_acct_free(void *p) {
+	mem_block_forget(p);
+	free(p);
+	return(NULL);
+}
+
+static void *mem_acct_realloc(void *p, size_t len) {
+	void *q;
+
+	/* If this fails, the old block is no longer accounted; mem_realloc() quits anyway */
+	mem_block_forget(p);
+	if (!(q = realloc(p, len))) return(NULL);
+	mem_block_add(q, len);
+	return(q);
+}
+
+/* Lua's luaM_realloc() uses this instead of realloc()/free() */
+extern void *(*luaM_realloc_hook)(void *block, size_t size);
+static void *mem_acct_lua(void *p, size_t len) {
+	mem_site_file = "lua";
+	mem_site_line = 0;
+	if (!len) return(p ? mem_acct_free(p) : NULL);
+	if (!p) return(mem_acct_alloc(len));
+	return(mem_acct_realloc(p, len));
+}
+
+/* Install the accounting allocator, as early as possible */
+void mem_acct_init(void) {
+	mem_set_hooks(mem_acct_alloc, mem_acct_free, mem_acct_realloc);
+	luaM_realloc_hook = mem_acct_lua;
+}
+
+/* Live bytes and blocks of a tag, for the GW port; FALSE if there's no such tag */
+bool mem_acct_tag(int tag, cptr *name, u64b *bytes, u32b *blocks) {
+	if (tag < 0 || tag >= MEM_TAGS) return(FALSE);
+	*name = mem_tag_name[tag];
+	*bytes = mem_tag_bytes[tag];
+	*blocks = mem_tag_blocks[tag];
+	return(TRUE);
+}
+
+u64b mem_acct_peak(void) {
+	return(mem_bytes_peak);
+}
+
+/* Live memory per call site, summed up from the block table */
+typedef struct mem_site mem_site;
+struct mem_site {
+	cptr file;
+	u32b line_tag;
+	u32b blocks;
+	u64b bytes;
+};
+
+static int mem_site_cmp(const void *a, const void *b) {
+	const mem_site *x = a, *y = b;
+
+	return(x->bytes < y->bytes ? 1 : (x->bytes > y->bytes ? -1 : 0));
+}
+
+/* Returns the number of sites, sorted by live bytes, in a table to be free()d by the caller */
+static int mem_acct_sites(mem_site **sites) {
+	u32b size = 16384, i, j, h;
+	int n = 0;
+	mem_site *s;
+
+	if (!(*sites = s = calloc(size, sizeof(mem_site)))) return(0);
+	for (i = 0; i < mem_blocks_size; i++) {
+		if (!mem_blocks[i].p) continue;
+		h = (((unsigned long)mem_blocks[i].file >> 3) + mem_blocks[i].line_tag * 31) & (size - 1);
+		for (j = h; s[j].blocks && (s[j].file != mem_blocks[i].file || s[j].line_tag != mem_blocks[i].line_tag); j = (j + 1) & (size - 1))
+			if (((j + 1) & (size - 1)) == h) break; /* full, paranoia */
+		if (!s[j].blocks) {
+			s[j].file = mem_blocks[i].file;
+			s[j].line_tag = mem_blocks[i].line_tag;
+			n++;
+		}
+		s[j].blocks++;
+		s[j].bytes += mem_blocks[i].size;
+	}
+	qsort(s, size, sizeof(mem_site), mem_site_cmp);
+	return(n);
+}
+
+/* Admin command: live memory per tag, or the top 'sites' call sites */
+void mem_acct_report(int Ind, int sites) {
+	int i, n;
+	mem_site *s;
+
+	msg_format(Ind, "Heap: \377y%lu\377w KB in %u blocks, peak %lu KB, block table %lu KB.",
+	    (unsigned long)(mem_bytes >> 10), mem_blocks_num, (unsigned long)(mem_bytes_peak >> 10), (unsigned long)((mem_blocks_size * sizeof(mem_block)) >> 10));
+
+	if (!sites) {
+		for (i = 0; i < MEM_TAGS; i++)
+			msg_format(Ind, "  %-9s \377y%8lu\377w KB %7u blocks, %lu allocations", mem_tag_name[i],
+			    (unsigned long)(mem_tag_bytes[i] >> 10), mem_tag_blocks[i], (unsigned long)mem_tag_allocs[i]);
+		return;
+	}
+
+	n = mem_acct_sites(&s);
+	for (i = 0; i < n && i < sites; i++)
+		msg_format(Ind, "  %s:%u (%s) \377y%lu\377w KB %u blocks", s[i].file ? s[i].file : "?", s[i].line_tag >> 4,
+		    mem_tag_name[s[i].line_tag & 0xF], (unsigned long)(s[i].bytes >> 10), s[i].blocks);
+	free(s);
+}
+
+/* Clear the allocation counters (live memory stays accounted of course) */
+void mem_acct_reset(void) {
+	int i;
+
+	for (i = 0; i < MEM_TAGS; i++) mem_tag_allocs[i] = 0;
+	mem_bytes_peak = mem_bytes;
+}
+
+/* Write every call site that still holds memory to tomenet-memory.log, eg at shutdown to look for leaks */
+void mem_acct_dump(cptr reason) {
+	char path[1024];
+	FILE *fp;
+	time_t now = time(NULL);
+	mem_site *s;
+	int i, n;
+
+	path_build(path, 1024, ANGBAND_DIR_DATA, "tomenet-memory.log");
+	if (!(fp = fopen(path, "w"))) {
+		s_printf("MEM_ACCOUNTING: Cannot write %s.\n", path);
+		return;
+	}
+
+	fprintf(fp, "# %s: live heap by call site, %s", reason, ctime(&now));
+	fprintf(fp, "# %lu bytes in %u blocks, peak %lu bytes\n\n", (unsigned long)mem_bytes, mem_blocks_num, (unsigned long)mem_bytes_peak);
+	for (i = 0; i < MEM_TAGS; i++)
+		fprintf(fp, "%-9s %12lu bytes %8u blocks %10lu allocations\n", mem_tag_name[i],
+		    (unsigned long)mem_tag_bytes[i], mem_tag_blocks[i], (unsigned long)mem_tag_allocs[i]);
+	fprintf(fp, "\n");
+
+	n = mem_acct_sites(&s);
+	for (i = 0; i < n; i++)
+		fprintf(fp, "%12lu bytes %8u blocks  %-8s %s:%u\n", (unsigned long)s[i].bytes, s[i].blocks,
+		    mem_tag_name[s[i].line_tag & 0xF], s[i].file ? s[i].file : "?", s[i].line_tag >> 4);
+	free(s);
+
+	fclose(fp);
+	s_printf("MEM_ACCOUNTING: %lu KB live in %u blocks at %d call sites, written to %s.\n",
+	    (unsigned long)(mem_bytes >> 10), mem_blocks_num, n, path);
+}
+#endif
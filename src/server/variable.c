@@ -99,6 +99,10 @@ s16b monster_level_min = 0;	/* Current monster creation minimum level, -1 = auto
 s32b turn, session_turn;	/* Current game turn; session_turn is the turn this server went online, ie start of current session */
 s32b turn_overflow = 2000000000;/* Limit when to reset 'turn' to 1 to prevent overflow symptoms */
 int turn_plus = 1;		/* How fast turns progress. [1 = Normal Operation, anything else is hazardous, undefined behaviour] */
+#ifdef SERVER_BENCHMARK
+s32b bench_turns = 0;		/* Benchmark mode (-B): Do this many dungeon() calls back to back, then report and exit. [0 = Normal operation] */
+u32b bench_seed = 1;		/* Fixed RNG seed used in benchmark mode */
+#endif
 int turn_plus_extra = 0;	/* Extra dungeon() calls done in the scheduler for each normal dungeon() call. [0 = Normal operation, anything else is hazardous, undefined behaviour] */
 
 #ifdef ARCADE_SERVER
@@ -121,7 +125,9 @@ s32b opening_chest;             /* Hack -- prevent chest generation, preown cash
 
 bool scan_monsters;             /* Hack -- optimize multi-hued code, etc */
 bool scan_objects;              /* Hack -- optimize multi-hued code, etc */
-bool scan_do_dist;		/* Hack -- optimize teleport away code */
+bool scan_do_dist;		/* Hack -- optimize teleport away code: lost track of pending teleports, check all monsters */
+s16b do_dist_list[MAX_M_IDX];	/* Monsters with a pending do_dist teleport */
+int do_dist_num;
 
 s32b m_nxt = 1;                 /* Monster free scanner */
 s32b m_max = 1;                 /* Monster heap size */
@@ -223,6 +229,7 @@ server_opts cfg = {
 					    0 = normal, 1 = seeing in standard town shop (1 to 6), 2 = seeing in any shop while carrying it, 3 = seeing in any shop */
 	TRUE,TRUE,TRUE,TRUE,TRUE,TRUE,TRUE,TRUE,TRUE,TRUE,TRUE,	/* types of messages which will be transmitted through the world server (if available). */
 	0,		/* leak_info */
+	0, 0,		/* cmdq_rate_limit, cmdq_max_depth - no throttling or kicking of connections that send a lot */
 };
 
 struct combo_ban *banlist = NULL;
@@ -0,0 +1,16755 @@
+/*
+** Lua binding: player
+** Generated automatically by tolua 4.0a - angband on Mon Oct 19 05:16:56 2026.
+*/
+
+#include "lua/tolua.h"
+
+/* Exported function */
+int tolua_player_open (lua_State* tolua_S);
+void tolua_player_close (lua_State* tolua_S);
+
+#define SERVER
+#include "angband.h"
+
+/* function to register type */
+static void toluaI_reg_types (lua_State* tolua_S)
+{
+ tolua_usertype(tolua_S,"player_trait");
+ tolua_usertype(tolua_S,"inventory_change_type");
+ tolua_usertype(tolua_S,"object_type");
+ tolua_usertype(tolua_S,"worldpos");
+ tolua_usertype(tolua_S,"player_class");
+ tolua_usertype(tolua_S,"time_t");
+ tolua_usertype(tolua_S,"player_type");
+ tolua_usertype(tolua_S,"player_race");
+ tolua_usertype(tolua_S,"s64b");
+ tolua_usertype(tolua_S,"skill_player");
+ tolua_usertype(tolua_S,"version_type");
+ tolua_usertype(tolua_S,"hostile_type");
+ tolua_usertype(tolua_S,"player_list_type");
+}
+
+/* error messages */
+#define TOLUA_ERR_SELF tolua_error(tolua_S,"invalid 'self'")
+#define TOLUA_ERR_ASSIGN tolua_error(tolua_S,"#vinvalid type in variable assignment.")
+
+/* get function: wx of class  worldpos */
+static int toluaI_get_player_worldpos_wx(lua_State* tolua_S)
+{
+  worldpos* self = (worldpos*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->wx);
+ return 1;
+}
+
+/* set function: wx of class  worldpos */
+static int toluaI_set_player_worldpos_wx(lua_State* tolua_S)
+{
+  worldpos* self = (worldpos*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->wx = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: wy of class  worldpos */
+static int toluaI_get_player_worldpos_wy(lua_State* tolua_S)
+{
+  worldpos* self = (worldpos*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->wy);
+ return 1;
+}
+
+/* set function: wy of class  worldpos */
+static int toluaI_set_player_worldpos_wy(lua_State* tolua_S)
+{
+  worldpos* self = (worldpos*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->wy = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: wz of class  worldpos */
+static int toluaI_get_player_worldpos_wz(lua_State* tolua_S)
+{
+  worldpos* self = (worldpos*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->wz);
+ return 1;
+}
+
+/* set function: wz of class  worldpos */
+static int toluaI_set_player_worldpos_wz(lua_State* tolua_S)
+{
+  worldpos* self = (worldpos*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->wz = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mode of class  object_type */
+static int toluaI_get_player_object_type_mode(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mode);
+ return 1;
+}
+
+/* set function: mode of class  object_type */
+static int toluaI_set_player_object_type_mode(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mode = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: owner of class  object_type */
+static int toluaI_get_player_object_type_owner(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->owner);
+ return 1;
+}
+
+/* set function: owner of class  object_type */
+static int toluaI_set_player_object_type_owner(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->owner = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: level of class  object_type */
+static int toluaI_get_player_object_type_level(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->level);
+ return 1;
+}
+
+/* set function: level of class  object_type */
+static int toluaI_set_player_object_type_level(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->level = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: k_idx of class  object_type */
+static int toluaI_get_player_object_type_k_idx(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->k_idx);
+ return 1;
+}
+
+/* set function: k_idx of class  object_type */
+static int toluaI_set_player_object_type_k_idx(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->k_idx = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: iy of class  object_type */
+static int toluaI_get_player_object_type_iy(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->iy);
+ return 1;
+}
+
+/* set function: iy of class  object_type */
+static int toluaI_set_player_object_type_iy(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->iy = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ix of class  object_type */
+static int toluaI_get_player_object_type_ix(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ix);
+ return 1;
+}
+
+/* set function: ix of class  object_type */
+static int toluaI_set_player_object_type_ix(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ix = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: wpos of class  object_type */
+static int toluaI_get_player_object_type_wpos(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->wpos,tolua_tag(tolua_S,"worldpos"));
+ return 1;
+}
+
+/* set function: wpos of class  object_type */
+static int toluaI_set_player_object_type_wpos(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"worldpos"),0))
+ TOLUA_ERR_ASSIGN;
+  self->wpos = *((struct worldpos*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tval of class  object_type */
+static int toluaI_get_player_object_type_tval(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tval);
+ return 1;
+}
+
+/* set function: tval of class  object_type */
+static int toluaI_set_player_object_type_tval(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tval = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: sval of class  object_type */
+static int toluaI_get_player_object_type_sval(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->sval);
+ return 1;
+}
+
+/* set function: sval of class  object_type */
+static int toluaI_set_player_object_type_sval(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->sval = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tval2 of class  object_type */
+static int toluaI_get_player_object_type_tval2(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tval2);
+ return 1;
+}
+
+/* set function: tval2 of class  object_type */
+static int toluaI_set_player_object_type_tval2(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tval2 = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: sval2 of class  object_type */
+static int toluaI_get_player_object_type_sval2(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->sval2);
+ return 1;
+}
+
+/* set function: sval2 of class  object_type */
+static int toluaI_set_player_object_type_sval2(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->sval2 = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: bpval of class  object_type */
+static int toluaI_get_player_object_type_bpval(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->bpval);
+ return 1;
+}
+
+/* set function: bpval of class  object_type */
+static int toluaI_set_player_object_type_bpval(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->bpval = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pval of class  object_type */
+static int toluaI_get_player_object_type_pval(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pval);
+ return 1;
+}
+
+/* set function: pval of class  object_type */
+static int toluaI_set_player_object_type_pval(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pval = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pval2 of class  object_type */
+static int toluaI_get_player_object_type_pval2(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pval2);
+ return 1;
+}
+
+/* set function: pval2 of class  object_type */
+static int toluaI_set_player_object_type_pval2(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pval2 = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pval3 of class  object_type */
+static int toluaI_get_player_object_type_pval3(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pval3);
+ return 1;
+}
+
+/* set function: pval3 of class  object_type */
+static int toluaI_set_player_object_type_pval3(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pval3 = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: discount of class  object_type */
+static int toluaI_get_player_object_type_discount(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->discount);
+ return 1;
+}
+
+/* set function: discount of class  object_type */
+static int toluaI_set_player_object_type_discount(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->discount = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: number of class  object_type */
+static int toluaI_get_player_object_type_number(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->number);
+ return 1;
+}
+
+/* set function: number of class  object_type */
+static int toluaI_set_player_object_type_number(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->number = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: weight of class  object_type */
+static int toluaI_get_player_object_type_weight(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->weight);
+ return 1;
+}
+
+/* set function: weight of class  object_type */
+static int toluaI_set_player_object_type_weight(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->weight = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: name1 of class  object_type */
+static int toluaI_get_player_object_type_name1(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->name1);
+ return 1;
+}
+
+/* set function: name1 of class  object_type */
+static int toluaI_set_player_object_type_name1(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->name1 = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: name2 of class  object_type */
+static int toluaI_get_player_object_type_name2(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->name2);
+ return 1;
+}
+
+/* set function: name2 of class  object_type */
+static int toluaI_set_player_object_type_name2(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->name2 = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: name2b of class  object_type */
+static int toluaI_get_player_object_type_name2b(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->name2b);
+ return 1;
+}
+
+/* set function: name2b of class  object_type */
+static int toluaI_set_player_object_type_name2b(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->name2b = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: name3 of class  object_type */
+static int toluaI_get_player_object_type_name3(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->name3);
+ return 1;
+}
+
+/* set function: name3 of class  object_type */
+static int toluaI_set_player_object_type_name3(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->name3 = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: attr of class  object_type */
+static int toluaI_get_player_object_type_attr(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->attr);
+ return 1;
+}
+
+/* set function: attr of class  object_type */
+static int toluaI_set_player_object_type_attr(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->attr = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtra1 of class  object_type */
+static int toluaI_get_player_object_type_xtra1(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtra1);
+ return 1;
+}
+
+/* set function: xtra1 of class  object_type */
+static int toluaI_set_player_object_type_xtra1(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtra1 = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtra2 of class  object_type */
+static int toluaI_get_player_object_type_xtra2(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtra2);
+ return 1;
+}
+
+/* set function: xtra2 of class  object_type */
+static int toluaI_set_player_object_type_xtra2(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtra2 = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtra3 of class  object_type */
+static int toluaI_get_player_object_type_xtra3(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtra3);
+ return 1;
+}
+
+/* set function: xtra3 of class  object_type */
+static int toluaI_set_player_object_type_xtra3(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtra3 = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtra4 of class  object_type */
+static int toluaI_get_player_object_type_xtra4(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtra4);
+ return 1;
+}
+
+/* set function: xtra4 of class  object_type */
+static int toluaI_set_player_object_type_xtra4(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtra4 = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtra5 of class  object_type */
+static int toluaI_get_player_object_type_xtra5(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtra5);
+ return 1;
+}
+
+/* set function: xtra5 of class  object_type */
+static int toluaI_set_player_object_type_xtra5(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtra5 = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtra6 of class  object_type */
+static int toluaI_get_player_object_type_xtra6(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtra6);
+ return 1;
+}
+
+/* set function: xtra6 of class  object_type */
+static int toluaI_set_player_object_type_xtra6(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtra6 = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtra7 of class  object_type */
+static int toluaI_get_player_object_type_xtra7(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtra7);
+ return 1;
+}
+
+/* set function: xtra7 of class  object_type */
+static int toluaI_set_player_object_type_xtra7(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtra7 = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtra8 of class  object_type */
+static int toluaI_get_player_object_type_xtra8(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtra8);
+ return 1;
+}
+
+/* set function: xtra8 of class  object_type */
+static int toluaI_set_player_object_type_xtra8(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtra8 = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtra9 of class  object_type */
+static int toluaI_get_player_object_type_xtra9(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtra9);
+ return 1;
+}
+
+/* set function: xtra9 of class  object_type */
+static int toluaI_set_player_object_type_xtra9(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtra9 = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_h of class  object_type */
+static int toluaI_get_player_object_type_to_h(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_h);
+ return 1;
+}
+
+/* set function: to_h of class  object_type */
+static int toluaI_set_player_object_type_to_h(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_h = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_d of class  object_type */
+static int toluaI_get_player_object_type_to_d(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_d);
+ return 1;
+}
+
+/* set function: to_d of class  object_type */
+static int toluaI_set_player_object_type_to_d(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_d = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_a of class  object_type */
+static int toluaI_get_player_object_type_to_a(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_a);
+ return 1;
+}
+
+/* set function: to_a of class  object_type */
+static int toluaI_set_player_object_type_to_a(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_a = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ac of class  object_type */
+static int toluaI_get_player_object_type_ac(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ac);
+ return 1;
+}
+
+/* set function: ac of class  object_type */
+static int toluaI_set_player_object_type_ac(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ac = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dd of class  object_type */
+static int toluaI_get_player_object_type_dd(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dd);
+ return 1;
+}
+
+/* set function: dd of class  object_type */
+static int toluaI_set_player_object_type_dd(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dd = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ds of class  object_type */
+static int toluaI_get_player_object_type_ds(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ds);
+ return 1;
+}
+
+/* set function: ds of class  object_type */
+static int toluaI_set_player_object_type_ds(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ds = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: timeout of class  object_type */
+static int toluaI_get_player_object_type_timeout(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->timeout);
+ return 1;
+}
+
+/* set function: timeout of class  object_type */
+static int toluaI_set_player_object_type_timeout(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->timeout = ((long)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: timeout_magic of class  object_type */
+static int toluaI_get_player_object_type_timeout_magic(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->timeout_magic);
+ return 1;
+}
+
+/* set function: timeout_magic of class  object_type */
+static int toluaI_set_player_object_type_timeout_magic(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->timeout_magic = ((long)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: recharging of class  object_type */
+static int toluaI_get_player_object_type_recharging(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->recharging);
+ return 1;
+}
+
+/* set function: recharging of class  object_type */
+static int toluaI_set_player_object_type_recharging(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->recharging = ((long)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ident of class  object_type */
+static int toluaI_get_player_object_type_ident(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ident);
+ return 1;
+}
+
+/* set function: ident of class  object_type */
+static int toluaI_set_player_object_type_ident(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ident = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: note of class  object_type */
+static int toluaI_get_player_object_type_note(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->note);
+ return 1;
+}
+
+/* set function: note of class  object_type */
+static int toluaI_set_player_object_type_note(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->note = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: questor of class  object_type */
+static int toluaI_get_player_object_type_questor(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->questor);
+ return 1;
+}
+
+/* set function: questor of class  object_type */
+static int toluaI_set_player_object_type_questor(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->questor = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: quest of class  object_type */
+static int toluaI_get_player_object_type_quest(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->quest);
+ return 1;
+}
+
+/* set function: quest of class  object_type */
+static int toluaI_set_player_object_type_quest(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->quest = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: quest_stage of class  object_type */
+static int toluaI_get_player_object_type_quest_stage(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->quest_stage);
+ return 1;
+}
+
+/* set function: quest_stage of class  object_type */
+static int toluaI_set_player_object_type_quest_stage(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->quest_stage = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: questor_idx of class  object_type */
+static int toluaI_get_player_object_type_questor_idx(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->questor_idx);
+ return 1;
+}
+
+/* set function: questor_idx of class  object_type */
+static int toluaI_set_player_object_type_questor_idx(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->questor_idx = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: iron_trade of class  object_type */
+static int toluaI_get_player_object_type_iron_trade(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->iron_trade);
+ return 1;
+}
+
+/* set function: iron_trade of class  object_type */
+static int toluaI_set_player_object_type_iron_trade(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->iron_trade = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: iron_turn of class  object_type */
+static int toluaI_get_player_object_type_iron_turn(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->iron_turn);
+ return 1;
+}
+
+/* set function: iron_turn of class  object_type */
+static int toluaI_set_player_object_type_iron_turn(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->iron_turn = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: id of class  object_type */
+static int toluaI_get_player_object_type_id(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->id);
+ return 1;
+}
+
+/* set function: id of class  object_type */
+static int toluaI_set_player_object_type_id(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->id = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: f_id of class  object_type */
+static int toluaI_get_player_object_type_f_id(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->f_id);
+ return 1;
+}
+
+/* set function: f_id of class  object_type */
+static int toluaI_set_player_object_type_f_id(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->f_id = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: f_name of class  object_type */
+static int toluaI_get_player_object_type_f_name(lua_State* tolua_S)
+{
+ int toluaI_index;
+  object_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (object_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=CNAME_LEN)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->f_name[toluaI_index]);
+ return 1;
+}
+
+/* set function: f_name of class  object_type */
+static int toluaI_set_player_object_type_f_name(lua_State* tolua_S)
+{
+ int toluaI_index;
+  object_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (object_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=CNAME_LEN)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->f_name[toluaI_index] = ((char)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: f_turn of class  object_type */
+static int toluaI_get_player_object_type_f_turn(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->f_turn);
+ return 1;
+}
+
+/* set function: f_turn of class  object_type */
+static int toluaI_set_player_object_type_f_turn(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->f_turn = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: f_time of class  object_type */
+static int toluaI_get_player_object_type_f_time(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->f_time,tolua_tag(tolua_S,"time_t"));
+ return 1;
+}
+
+/* set function: f_time of class  object_type */
+static int toluaI_set_player_object_type_f_time(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"time_t"),0))
+ TOLUA_ERR_ASSIGN;
+  self->f_time = *((time_t*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: f_wpos of class  object_type */
+static int toluaI_get_player_object_type_f_wpos(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->f_wpos,tolua_tag(tolua_S,"worldpos"));
+ return 1;
+}
+
+/* set function: f_wpos of class  object_type */
+static int toluaI_set_player_object_type_f_wpos(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"worldpos"),0))
+ TOLUA_ERR_ASSIGN;
+  self->f_wpos = *((struct worldpos*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: f_dun of class  object_type */
+static int toluaI_get_player_object_type_f_dun(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->f_dun);
+ return 1;
+}
+
+/* set function: f_dun of class  object_type */
+static int toluaI_set_player_object_type_f_dun(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->f_dun = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: f_player of class  object_type */
+static int toluaI_get_player_object_type_f_player(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->f_player);
+ return 1;
+}
+
+/* set function: f_player of class  object_type */
+static int toluaI_set_player_object_type_f_player(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->f_player = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: f_player_turn of class  object_type */
+static int toluaI_get_player_object_type_f_player_turn(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->f_player_turn);
+ return 1;
+}
+
+/* set function: f_player_turn of class  object_type */
+static int toluaI_set_player_object_type_f_player_turn(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->f_player_turn = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: f_ridx of class  object_type */
+static int toluaI_get_player_object_type_f_ridx(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->f_ridx);
+ return 1;
+}
+
+/* set function: f_ridx of class  object_type */
+static int toluaI_set_player_object_type_f_ridx(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->f_ridx = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: f_reidx of class  object_type */
+static int toluaI_get_player_object_type_f_reidx(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->f_reidx);
+ return 1;
+}
+
+/* set function: f_reidx of class  object_type */
+static int toluaI_set_player_object_type_f_reidx(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->f_reidx = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: f_special of class  object_type */
+static int toluaI_get_player_object_type_f_special(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->f_special);
+ return 1;
+}
+
+/* set function: f_special of class  object_type */
+static int toluaI_set_player_object_type_f_special(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->f_special = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: f_reward of class  object_type */
+static int toluaI_get_player_object_type_f_reward(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->f_reward);
+ return 1;
+}
+
+/* set function: f_reward of class  object_type */
+static int toluaI_set_player_object_type_f_reward(lua_State* tolua_S)
+{
+  object_type* self = (object_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->f_reward = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: base_value of class  skill_player */
+static int toluaI_get_player_skill_player_base_value(lua_State* tolua_S)
+{
+  skill_player* self = (skill_player*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->base_value);
+ return 1;
+}
+
+/* set function: base_value of class  skill_player */
+static int toluaI_set_player_skill_player_base_value(lua_State* tolua_S)
+{
+  skill_player* self = (skill_player*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->base_value = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: value of class  skill_player */
+static int toluaI_get_player_skill_player_value(lua_State* tolua_S)
+{
+  skill_player* self = (skill_player*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->value);
+ return 1;
+}
+
+/* set function: value of class  skill_player */
+static int toluaI_set_player_skill_player_value(lua_State* tolua_S)
+{
+  skill_player* self = (skill_player*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->value = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mod of class  skill_player */
+static int toluaI_get_player_skill_player_mod(lua_State* tolua_S)
+{
+  skill_player* self = (skill_player*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mod);
+ return 1;
+}
+
+/* set function: mod of class  skill_player */
+static int toluaI_set_player_skill_player_mod(lua_State* tolua_S)
+{
+  skill_player* self = (skill_player*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mod = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dev of class  skill_player */
+static int toluaI_get_player_skill_player_dev(lua_State* tolua_S)
+{
+  skill_player* self = (skill_player*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dev);
+ return 1;
+}
+
+/* set function: dev of class  skill_player */
+static int toluaI_set_player_skill_player_dev(lua_State* tolua_S)
+{
+  skill_player* self = (skill_player*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dev = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: flags1 of class  skill_player */
+static int toluaI_get_player_skill_player_flags1(lua_State* tolua_S)
+{
+  skill_player* self = (skill_player*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->flags1);
+ return 1;
+}
+
+/* set function: flags1 of class  skill_player */
+static int toluaI_set_player_skill_player_flags1(lua_State* tolua_S)
+{
+  skill_player* self = (skill_player*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->flags1 = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: major of class  version_type */
+static int toluaI_get_player_version_type_major(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->major);
+ return 1;
+}
+
+/* set function: major of class  version_type */
+static int toluaI_set_player_version_type_major(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->major = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: minor of class  version_type */
+static int toluaI_get_player_version_type_minor(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->minor);
+ return 1;
+}
+
+/* set function: minor of class  version_type */
+static int toluaI_set_player_version_type_minor(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->minor = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: patch of class  version_type */
+static int toluaI_get_player_version_type_patch(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->patch);
+ return 1;
+}
+
+/* set function: patch of class  version_type */
+static int toluaI_set_player_version_type_patch(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->patch = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: extra of class  version_type */
+static int toluaI_get_player_version_type_extra(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->extra);
+ return 1;
+}
+
+/* set function: extra of class  version_type */
+static int toluaI_set_player_version_type_extra(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->extra = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: branch of class  version_type */
+static int toluaI_get_player_version_type_branch(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->branch);
+ return 1;
+}
+
+/* set function: branch of class  version_type */
+static int toluaI_set_player_version_type_branch(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->branch = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: build of class  version_type */
+static int toluaI_get_player_version_type_build(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->build);
+ return 1;
+}
+
+/* set function: build of class  version_type */
+static int toluaI_set_player_version_type_build(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->build = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: os of class  version_type */
+static int toluaI_get_player_version_type_os(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->os);
+ return 1;
+}
+
+/* set function: os of class  version_type */
+static int toluaI_set_player_version_type_os(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->os = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: os_sub of class  version_type */
+static int toluaI_get_player_version_type_os_sub(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->os_sub);
+ return 1;
+}
+
+/* set function: os_sub of class  version_type */
+static int toluaI_set_player_version_type_os_sub(lua_State* tolua_S)
+{
+  version_type* self = (version_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->os_sub = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: type of class  inventory_change_type */
+static int toluaI_get_player_inventory_change_type_type(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->type);
+ return 1;
+}
+
+/* set function: type of class  inventory_change_type */
+static int toluaI_set_player_inventory_change_type_type(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->type = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: revision of class  inventory_change_type */
+static int toluaI_get_player_inventory_change_type_revision(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->revision);
+ return 1;
+}
+
+/* set function: revision of class  inventory_change_type */
+static int toluaI_set_player_inventory_change_type_revision(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->revision = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: begin of class  inventory_change_type */
+static int toluaI_get_player_inventory_change_type_begin(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->begin);
+ return 1;
+}
+
+/* set function: begin of class  inventory_change_type */
+static int toluaI_set_player_inventory_change_type_begin(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->begin = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: end of class  inventory_change_type */
+static int toluaI_get_player_inventory_change_type_end(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->end);
+ return 1;
+}
+
+/* set function: end of class  inventory_change_type */
+static int toluaI_set_player_inventory_change_type_end(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->end = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mod of class  inventory_change_type */
+static int toluaI_get_player_inventory_change_type_mod(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mod);
+ return 1;
+}
+
+/* set function: mod of class  inventory_change_type */
+static int toluaI_set_player_inventory_change_type_mod(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mod = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: next of class  inventory_change_type */
+static int toluaI_get_player_inventory_change_type_next(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)self->next,tolua_tag(tolua_S,"inventory_change_type"));
+ return 1;
+}
+
+/* set function: next of class  inventory_change_type */
+static int toluaI_set_player_inventory_change_type_next(lua_State* tolua_S)
+{
+  inventory_change_type* self = (inventory_change_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"inventory_change_type"),0))
+ TOLUA_ERR_ASSIGN;
+  self->next = ((inventory_change_type*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: conn of class  player_type */
+static int toluaI_get_player_player_type_conn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->conn);
+ return 1;
+}
+
+/* set function: conn of class  player_type */
+static int toluaI_set_player_player_type_conn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->conn = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: Ind of class  player_type */
+static int toluaI_get_player_player_type_Ind(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->Ind);
+ return 1;
+}
+
+/* set function: Ind of class  player_type */
+static int toluaI_set_player_player_type_Ind(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->Ind = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: name of class  player_type */
+static int toluaI_get_player_player_type_name(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->name);
+ return 1;
+}
+
+/* get function: basename of class  player_type */
+static int toluaI_get_player_player_type_basename(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->basename);
+ return 1;
+}
+
+/* get function: realname of class  player_type */
+static int toluaI_get_player_player_type_realname(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->realname);
+ return 1;
+}
+
+/* get function: accountname of class  player_type */
+static int toluaI_get_player_player_type_accountname(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->accountname);
+ return 1;
+}
+
+/* get function: hostname of class  player_type */
+static int toluaI_get_player_player_type_hostname(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->hostname);
+ return 1;
+}
+
+/* get function: addr of class  player_type */
+static int toluaI_get_player_player_type_addr(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->addr);
+ return 1;
+}
+
+/* get function: version of class  player_type */
+static int toluaI_get_player_player_type_version(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->version,tolua_tag(tolua_S,"version_type"));
+ return 1;
+}
+
+/* set function: version of class  player_type */
+static int toluaI_set_player_player_type_version(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"version_type"),0))
+ TOLUA_ERR_ASSIGN;
+  self->version = *((version_type*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: v_outdated of class  player_type */
+static int toluaI_get_player_player_type_v_outdated(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->v_outdated);
+ return 1;
+}
+
+/* set function: v_outdated of class  player_type */
+static int toluaI_set_player_player_type_v_outdated(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->v_outdated = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: v_latest of class  player_type */
+static int toluaI_get_player_player_type_v_latest(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->v_latest);
+ return 1;
+}
+
+/* set function: v_latest of class  player_type */
+static int toluaI_set_player_player_type_v_latest(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->v_latest = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: v_test of class  player_type */
+static int toluaI_get_player_player_type_v_test(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->v_test);
+ return 1;
+}
+
+/* set function: v_test of class  player_type */
+static int toluaI_set_player_player_type_v_test(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->v_test = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: v_test_latest of class  player_type */
+static int toluaI_get_player_player_type_v_test_latest(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->v_test_latest);
+ return 1;
+}
+
+/* set function: v_test_latest of class  player_type */
+static int toluaI_set_player_player_type_v_test_latest(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->v_test_latest = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: v_unknown of class  player_type */
+static int toluaI_get_player_player_type_v_unknown(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->v_unknown);
+ return 1;
+}
+
+/* set function: v_unknown of class  player_type */
+static int toluaI_set_player_player_type_v_unknown(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->v_unknown = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: rogue_like_commands of class  player_type */
+static int toluaI_get_player_player_type_rogue_like_commands(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->rogue_like_commands);
+ return 1;
+}
+
+/* set function: rogue_like_commands of class  player_type */
+static int toluaI_set_player_player_type_rogue_like_commands(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->rogue_like_commands = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: id of class  player_type */
+static int toluaI_get_player_player_type_id(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->id);
+ return 1;
+}
+
+/* set function: id of class  player_type */
+static int toluaI_set_player_player_type_id(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->id = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: account of class  player_type */
+static int toluaI_get_player_player_type_account(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->account);
+ return 1;
+}
+
+/* set function: account of class  player_type */
+static int toluaI_set_player_player_type_account(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->account = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dna of class  player_type */
+static int toluaI_get_player_player_type_dna(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dna);
+ return 1;
+}
+
+/* set function: dna of class  player_type */
+static int toluaI_set_player_player_type_dna(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dna = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: turn of class  player_type */
+static int toluaI_get_player_player_type_turn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->turn);
+ return 1;
+}
+
+/* set function: turn of class  player_type */
+static int toluaI_set_player_player_type_turn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->turn = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: turns_online of class  player_type */
+static int toluaI_get_player_player_type_turns_online(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->turns_online);
+ return 1;
+}
+
+/* set function: turns_online of class  player_type */
+static int toluaI_set_player_player_type_turns_online(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->turns_online = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: turns_afk of class  player_type */
+static int toluaI_get_player_player_type_turns_afk(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->turns_afk);
+ return 1;
+}
+
+/* set function: turns_afk of class  player_type */
+static int toluaI_set_player_player_type_turns_afk(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->turns_afk = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: turns_idle of class  player_type */
+static int toluaI_get_player_player_type_turns_idle(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->turns_idle);
+ return 1;
+}
+
+/* set function: turns_idle of class  player_type */
+static int toluaI_set_player_player_type_turns_idle(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->turns_idle = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: turns_active of class  player_type */
+static int toluaI_get_player_player_type_turns_active(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->turns_active);
+ return 1;
+}
+
+/* set function: turns_active of class  player_type */
+static int toluaI_set_player_player_type_turns_active(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->turns_active = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: hostile of class  player_type */
+static int toluaI_get_player_player_type_hostile(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)self->hostile,tolua_tag(tolua_S,"hostile_type"));
+ return 1;
+}
+
+/* set function: hostile of class  player_type */
+static int toluaI_set_player_player_type_hostile(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"hostile_type"),0))
+ TOLUA_ERR_ASSIGN;
+  self->hostile = ((hostile_type*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: savefile of class  player_type */
+static int toluaI_get_player_player_type_savefile(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->savefile);
+ return 1;
+}
+
+/* get function: restricted of class  player_type */
+static int toluaI_get_player_player_type_restricted(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->restricted);
+ return 1;
+}
+
+/* set function: restricted of class  player_type */
+static int toluaI_set_player_player_type_restricted(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->restricted = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: privileged of class  player_type */
+static int toluaI_get_player_player_type_privileged(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->privileged);
+ return 1;
+}
+
+/* set function: privileged of class  player_type */
+static int toluaI_set_player_player_type_privileged(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->privileged = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pvpexception of class  player_type */
+static int toluaI_get_player_player_type_pvpexception(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pvpexception);
+ return 1;
+}
+
+/* set function: pvpexception of class  player_type */
+static int toluaI_set_player_player_type_pvpexception(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pvpexception = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mutedchat of class  player_type */
+static int toluaI_get_player_player_type_mutedchat(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mutedchat);
+ return 1;
+}
+
+/* set function: mutedchat of class  player_type */
+static int toluaI_set_player_player_type_mutedchat(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mutedchat = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: inval of class  player_type */
+static int toluaI_get_player_player_type_inval(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->inval);
+ return 1;
+}
+
+/* set function: inval of class  player_type */
+static int toluaI_set_player_player_type_inval(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->inval = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suicided of class  player_type */
+static int toluaI_get_player_player_type_suicided(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suicided);
+ return 1;
+}
+
+/* set function: suicided of class  player_type */
+static int toluaI_set_player_player_type_suicided(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suicided = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: death of class  player_type */
+static int toluaI_get_player_player_type_death(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->death);
+ return 1;
+}
+
+/* set function: death of class  player_type */
+static int toluaI_set_player_player_type_death(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->death = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: deathblow of class  player_type */
+static int toluaI_get_player_player_type_deathblow(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->deathblow);
+ return 1;
+}
+
+/* set function: deathblow of class  player_type */
+static int toluaI_set_player_player_type_deathblow(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->deathblow = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: deaths of class  player_type */
+static int toluaI_get_player_player_type_deaths(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->deaths);
+ return 1;
+}
+
+/* set function: deaths of class  player_type */
+static int toluaI_set_player_player_type_deaths(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->deaths = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: soft_deaths of class  player_type */
+static int toluaI_get_player_player_type_soft_deaths(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->soft_deaths);
+ return 1;
+}
+
+/* set function: soft_deaths of class  player_type */
+static int toluaI_set_player_player_type_soft_deaths(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->soft_deaths = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ghost of class  player_type */
+static int toluaI_get_player_player_type_ghost(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ghost);
+ return 1;
+}
+
+/* set function: ghost of class  player_type */
+static int toluaI_set_player_player_type_ghost(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ghost = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: fruit_bat of class  player_type */
+static int toluaI_get_player_player_type_fruit_bat(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->fruit_bat);
+ return 1;
+}
+
+/* set function: fruit_bat of class  player_type */
+static int toluaI_set_player_player_type_fruit_bat(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->fruit_bat = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: lives of class  player_type */
+static int toluaI_get_player_player_type_lives(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->lives);
+ return 1;
+}
+
+/* set function: lives of class  player_type */
+static int toluaI_set_player_player_type_lives(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->lives = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: houses_owned of class  player_type */
+static int toluaI_get_player_player_type_houses_owned(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->houses_owned);
+ return 1;
+}
+
+/* set function: houses_owned of class  player_type */
+static int toluaI_set_player_player_type_houses_owned(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->houses_owned = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: castles_owned of class  player_type */
+static int toluaI_get_player_player_type_castles_owned(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->castles_owned);
+ return 1;
+}
+
+/* set function: castles_owned of class  player_type */
+static int toluaI_set_player_player_type_castles_owned(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->castles_owned = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: prace of class  player_type */
+static int toluaI_get_player_player_type_prace(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->prace);
+ return 1;
+}
+
+/* set function: prace of class  player_type */
+static int toluaI_set_player_player_type_prace(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->prace = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pclass of class  player_type */
+static int toluaI_get_player_player_type_pclass(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pclass);
+ return 1;
+}
+
+/* set function: pclass of class  player_type */
+static int toluaI_set_player_player_type_pclass(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pclass = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ptrait of class  player_type */
+static int toluaI_get_player_player_type_ptrait(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ptrait);
+ return 1;
+}
+
+/* set function: ptrait of class  player_type */
+static int toluaI_set_player_player_type_ptrait(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ptrait = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: male of class  player_type */
+static int toluaI_get_player_player_type_male(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->male);
+ return 1;
+}
+
+/* set function: male of class  player_type */
+static int toluaI_set_player_player_type_male(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->male = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: s_info of class  player_type */
+static int toluaI_get_player_player_type_s_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_SKILLS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&self->s_info[toluaI_index],tolua_tag(tolua_S,"skill_player"));
+ return 1;
+}
+
+/* set function: s_info of class  player_type */
+static int toluaI_set_player_player_type_s_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_SKILLS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->s_info[toluaI_index] = *((skill_player*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: skill_points of class  player_type */
+static int toluaI_get_player_player_type_skill_points(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_points);
+ return 1;
+}
+
+/* set function: skill_points of class  player_type */
+static int toluaI_set_player_player_type_skill_points(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_points = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: s_info_old of class  player_type */
+static int toluaI_get_player_player_type_s_info_old(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_SKILLS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&self->s_info_old[toluaI_index],tolua_tag(tolua_S,"skill_player"));
+ return 1;
+}
+
+/* set function: s_info_old of class  player_type */
+static int toluaI_set_player_player_type_s_info_old(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_SKILLS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->s_info_old[toluaI_index] = *((skill_player*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: skill_points_old of class  player_type */
+static int toluaI_get_player_player_type_skill_points_old(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_points_old);
+ return 1;
+}
+
+/* set function: skill_points_old of class  player_type */
+static int toluaI_set_player_player_type_skill_points_old(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_points_old = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: reskill_possible of class  player_type */
+static int toluaI_get_player_player_type_reskill_possible(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->reskill_possible);
+ return 1;
+}
+
+/* set function: reskill_possible of class  player_type */
+static int toluaI_set_player_player_type_reskill_possible(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->reskill_possible = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: hitdie of class  player_type */
+static int toluaI_get_player_player_type_hitdie(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->hitdie);
+ return 1;
+}
+
+/* set function: hitdie of class  player_type */
+static int toluaI_set_player_player_type_hitdie(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->hitdie = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: expfact of class  player_type */
+static int toluaI_get_player_player_type_expfact(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->expfact);
+ return 1;
+}
+
+/* set function: expfact of class  player_type */
+static int toluaI_set_player_player_type_expfact(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->expfact = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: au of class  player_type */
+static int toluaI_get_player_player_type_au(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->au);
+ return 1;
+}
+
+/* set function: au of class  player_type */
+static int toluaI_set_player_player_type_au(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->au = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: balance of class  player_type */
+static int toluaI_get_player_player_type_balance(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->balance);
+ return 1;
+}
+
+/* set function: balance of class  player_type */
+static int toluaI_set_player_player_type_balance(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->balance = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: max_exp of class  player_type */
+static int toluaI_get_player_player_type_max_exp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->max_exp);
+ return 1;
+}
+
+/* set function: max_exp of class  player_type */
+static int toluaI_set_player_player_type_max_exp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->max_exp = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: exp of class  player_type */
+static int toluaI_get_player_player_type_exp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->exp);
+ return 1;
+}
+
+/* set function: exp of class  player_type */
+static int toluaI_set_player_player_type_exp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->exp = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: exp_frac of class  player_type */
+static int toluaI_get_player_player_type_exp_frac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->exp_frac);
+ return 1;
+}
+
+/* set function: exp_frac of class  player_type */
+static int toluaI_set_player_player_type_exp_frac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->exp_frac = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: lev of class  player_type */
+static int toluaI_get_player_player_type_lev(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->lev);
+ return 1;
+}
+
+/* set function: lev of class  player_type */
+static int toluaI_set_player_player_type_lev(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->lev = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: max_lev of class  player_type */
+static int toluaI_get_player_player_type_max_lev(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->max_lev);
+ return 1;
+}
+
+/* set function: max_lev of class  player_type */
+static int toluaI_set_player_player_type_max_lev(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->max_lev = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mhp of class  player_type */
+static int toluaI_get_player_player_type_mhp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mhp);
+ return 1;
+}
+
+/* set function: mhp of class  player_type */
+static int toluaI_set_player_player_type_mhp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mhp = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: chp of class  player_type */
+static int toluaI_get_player_player_type_chp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->chp);
+ return 1;
+}
+
+/* set function: chp of class  player_type */
+static int toluaI_set_player_player_type_chp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->chp = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: chp_frac of class  player_type */
+static int toluaI_get_player_player_type_chp_frac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->chp_frac);
+ return 1;
+}
+
+/* set function: chp_frac of class  player_type */
+static int toluaI_set_player_player_type_chp_frac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->chp_frac = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: player_hp of class  player_type */
+static int toluaI_get_player_player_type_player_hp(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=PY_MAX_LEVEL)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->player_hp[toluaI_index]);
+ return 1;
+}
+
+/* set function: player_hp of class  player_type */
+static int toluaI_set_player_player_type_player_hp(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=PY_MAX_LEVEL)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->player_hp[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: mmp of class  player_type */
+static int toluaI_get_player_player_type_mmp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mmp);
+ return 1;
+}
+
+/* set function: mmp of class  player_type */
+static int toluaI_set_player_player_type_mmp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mmp = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cmp of class  player_type */
+static int toluaI_get_player_player_type_cmp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cmp);
+ return 1;
+}
+
+/* set function: cmp of class  player_type */
+static int toluaI_set_player_player_type_cmp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cmp = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cmp_frac of class  player_type */
+static int toluaI_get_player_player_type_cmp_frac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cmp_frac);
+ return 1;
+}
+
+/* set function: cmp_frac of class  player_type */
+static int toluaI_set_player_player_type_cmp_frac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cmp_frac = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mst of class  player_type */
+static int toluaI_get_player_player_type_mst(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mst);
+ return 1;
+}
+
+/* set function: mst of class  player_type */
+static int toluaI_set_player_player_type_mst(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mst = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cst of class  player_type */
+static int toluaI_get_player_player_type_cst(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cst);
+ return 1;
+}
+
+/* set function: cst of class  player_type */
+static int toluaI_set_player_player_type_cst(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cst = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cst_frac of class  player_type */
+static int toluaI_get_player_player_type_cst_frac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cst_frac);
+ return 1;
+}
+
+/* set function: cst_frac of class  player_type */
+static int toluaI_set_player_player_type_cst_frac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cst_frac = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: inventory of class  player_type */
+static int toluaI_get_player_player_type_inventory(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=INVEN_TOTAL)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&self->inventory[toluaI_index],tolua_tag(tolua_S,"object_type"));
+ return 1;
+}
+
+/* set function: inventory of class  player_type */
+static int toluaI_set_player_player_type_inventory(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=INVEN_TOTAL)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->inventory[toluaI_index] = *((object_type*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: inventory_changes of class  player_type */
+static int toluaI_get_player_player_type_inventory_changes(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)self->inventory_changes,tolua_tag(tolua_S,"inventory_change_type"));
+ return 1;
+}
+
+/* set function: inventory_changes of class  player_type */
+static int toluaI_set_player_player_type_inventory_changes(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"inventory_change_type"),0))
+ TOLUA_ERR_ASSIGN;
+  self->inventory_changes = ((inventory_change_type*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: inventory_revision of class  player_type */
+static int toluaI_get_player_player_type_inventory_revision(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->inventory_revision);
+ return 1;
+}
+
+/* set function: inventory_revision of class  player_type */
+static int toluaI_set_player_player_type_inventory_revision(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->inventory_revision = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: inventory_changed of class  player_type */
+static int toluaI_get_player_player_type_inventory_changed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->inventory_changed);
+ return 1;
+}
+
+/* set function: inventory_changed of class  player_type */
+static int toluaI_set_player_player_type_inventory_changed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->inventory_changed = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: total_weight of class  player_type */
+static int toluaI_get_player_player_type_total_weight(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->total_weight);
+ return 1;
+}
+
+/* set function: total_weight of class  player_type */
+static int toluaI_set_player_player_type_total_weight(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->total_weight = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: inven_cnt of class  player_type */
+static int toluaI_get_player_player_type_inven_cnt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->inven_cnt);
+ return 1;
+}
+
+/* set function: inven_cnt of class  player_type */
+static int toluaI_set_player_player_type_inven_cnt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->inven_cnt = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: equip_cnt of class  player_type */
+static int toluaI_get_player_player_type_equip_cnt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->equip_cnt);
+ return 1;
+}
+
+/* set function: equip_cnt of class  player_type */
+static int toluaI_set_player_player_type_equip_cnt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->equip_cnt = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: max_plv of class  player_type */
+static int toluaI_get_player_player_type_max_plv(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->max_plv);
+ return 1;
+}
+
+/* set function: max_plv of class  player_type */
+static int toluaI_set_player_player_type_max_plv(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->max_plv = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: max_dlv of class  player_type */
+static int toluaI_get_player_player_type_max_dlv(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->max_dlv);
+ return 1;
+}
+
+/* set function: max_dlv of class  player_type */
+static int toluaI_set_player_player_type_max_dlv(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->max_dlv = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: recall_pos of class  player_type */
+static int toluaI_get_player_player_type_recall_pos(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->recall_pos,tolua_tag(tolua_S,"worldpos"));
+ return 1;
+}
+
+/* set function: recall_pos of class  player_type */
+static int toluaI_set_player_player_type_recall_pos(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"worldpos"),0))
+ TOLUA_ERR_ASSIGN;
+  self->recall_pos = *((worldpos*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: stat_max of class  player_type */
+static int toluaI_get_player_player_type_stat_max(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->stat_max[toluaI_index]);
+ return 1;
+}
+
+/* set function: stat_max of class  player_type */
+static int toluaI_set_player_player_type_stat_max(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->stat_max[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: stat_cur of class  player_type */
+static int toluaI_get_player_player_type_stat_cur(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->stat_cur[toluaI_index]);
+ return 1;
+}
+
+/* set function: stat_cur of class  player_type */
+static int toluaI_set_player_player_type_stat_cur(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->stat_cur[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: stat_los of class  player_type */
+static int toluaI_get_player_player_type_stat_los(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->stat_los[toluaI_index]);
+ return 1;
+}
+
+/* set function: stat_los of class  player_type */
+static int toluaI_set_player_player_type_stat_los(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->stat_los[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: stat_cnt of class  player_type */
+static int toluaI_get_player_player_type_stat_cnt(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->stat_cnt[toluaI_index]);
+ return 1;
+}
+
+/* set function: stat_cnt of class  player_type */
+static int toluaI_set_player_player_type_stat_cnt(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->stat_cnt[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: wild_map of class  player_type */
+static int toluaI_get_player_player_type_wild_map(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_WILD_8)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->wild_map[toluaI_index]);
+ return 1;
+}
+
+/* set function: wild_map of class  player_type */
+static int toluaI_set_player_player_type_wild_map(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_WILD_8)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->wild_map[toluaI_index] = ((unsigned char)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: py of class  player_type */
+static int toluaI_get_player_player_type_py(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->py);
+ return 1;
+}
+
+/* set function: py of class  player_type */
+static int toluaI_set_player_player_type_py(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->py = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: px of class  player_type */
+static int toluaI_get_player_player_type_px(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->px);
+ return 1;
+}
+
+/* set function: px of class  player_type */
+static int toluaI_set_player_player_type_px(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->px = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: wpos of class  player_type */
+static int toluaI_get_player_player_type_wpos(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->wpos,tolua_tag(tolua_S,"worldpos"));
+ return 1;
+}
+
+/* set function: wpos of class  player_type */
+static int toluaI_set_player_player_type_wpos(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"worldpos"),0))
+ TOLUA_ERR_ASSIGN;
+  self->wpos = *((struct worldpos*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: aura of class  player_type */
+static int toluaI_get_player_player_type_aura(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_AURAS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->aura[toluaI_index]);
+ return 1;
+}
+
+/* set function: aura of class  player_type */
+static int toluaI_set_player_player_type_aura(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_AURAS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->aura[toluaI_index] = ((bool)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: cur_hgt of class  player_type */
+static int toluaI_get_player_player_type_cur_hgt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cur_hgt);
+ return 1;
+}
+
+/* set function: cur_hgt of class  player_type */
+static int toluaI_set_player_player_type_cur_hgt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cur_hgt = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cur_wid of class  player_type */
+static int toluaI_get_player_player_type_cur_wid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cur_wid);
+ return 1;
+}
+
+/* set function: cur_wid of class  player_type */
+static int toluaI_set_player_player_type_cur_wid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cur_wid = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: new_level_flag of class  player_type */
+static int toluaI_get_player_player_type_new_level_flag(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->new_level_flag);
+ return 1;
+}
+
+/* set function: new_level_flag of class  player_type */
+static int toluaI_set_player_player_type_new_level_flag(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->new_level_flag = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: new_level_method of class  player_type */
+static int toluaI_get_player_player_type_new_level_method(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->new_level_method);
+ return 1;
+}
+
+/* set function: new_level_method of class  player_type */
+static int toluaI_set_player_player_type_new_level_method(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->new_level_method = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: party of class  player_type */
+static int toluaI_get_player_player_type_party(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->party);
+ return 1;
+}
+
+/* set function: party of class  player_type */
+static int toluaI_set_player_player_type_party(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->party = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: guild of class  player_type */
+static int toluaI_get_player_player_type_guild(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->guild);
+ return 1;
+}
+
+/* set function: guild of class  player_type */
+static int toluaI_set_player_player_type_guild(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->guild = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: guild_dna of class  player_type */
+static int toluaI_get_player_player_type_guild_dna(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->guild_dna);
+ return 1;
+}
+
+/* set function: guild_dna of class  player_type */
+static int toluaI_set_player_player_type_guild_dna(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->guild_dna = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: target_who of class  player_type */
+static int toluaI_get_player_player_type_target_who(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->target_who);
+ return 1;
+}
+
+/* set function: target_who of class  player_type */
+static int toluaI_set_player_player_type_target_who(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->target_who = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: target_col of class  player_type */
+static int toluaI_get_player_player_type_target_col(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->target_col);
+ return 1;
+}
+
+/* set function: target_col of class  player_type */
+static int toluaI_set_player_player_type_target_col(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->target_col = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: target_row of class  player_type */
+static int toluaI_get_player_player_type_target_row(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->target_row);
+ return 1;
+}
+
+/* set function: target_row of class  player_type */
+static int toluaI_set_player_player_type_target_row(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->target_row = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: health_who of class  player_type */
+static int toluaI_get_player_player_type_health_who(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->health_who);
+ return 1;
+}
+
+/* set function: health_who of class  player_type */
+static int toluaI_set_player_player_type_health_who(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->health_who = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: view_n of class  player_type */
+static int toluaI_get_player_player_type_view_n(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->view_n);
+ return 1;
+}
+
+/* set function: view_n of class  player_type */
+static int toluaI_set_player_player_type_view_n(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->view_n = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: view_y of class  player_type */
+static int toluaI_get_player_player_type_view_y(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=VIEW_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->view_y[toluaI_index]);
+ return 1;
+}
+
+/* set function: view_y of class  player_type */
+static int toluaI_set_player_player_type_view_y(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=VIEW_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->view_y[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: view_x of class  player_type */
+static int toluaI_get_player_player_type_view_x(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=VIEW_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->view_x[toluaI_index]);
+ return 1;
+}
+
+/* set function: view_x of class  player_type */
+static int toluaI_set_player_player_type_view_x(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=VIEW_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->view_x[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: lite_n of class  player_type */
+static int toluaI_get_player_player_type_lite_n(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->lite_n);
+ return 1;
+}
+
+/* set function: lite_n of class  player_type */
+static int toluaI_set_player_player_type_lite_n(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->lite_n = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: lite_y of class  player_type */
+static int toluaI_get_player_player_type_lite_y(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=LITE_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->lite_y[toluaI_index]);
+ return 1;
+}
+
+/* set function: lite_y of class  player_type */
+static int toluaI_set_player_player_type_lite_y(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=LITE_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->lite_y[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: lite_x of class  player_type */
+static int toluaI_get_player_player_type_lite_x(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=LITE_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->lite_x[toluaI_index]);
+ return 1;
+}
+
+/* set function: lite_x of class  player_type */
+static int toluaI_set_player_player_type_lite_x(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=LITE_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->lite_x[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: lite_t of class  player_type */
+static int toluaI_get_player_player_type_lite_t(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=LITE_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->lite_t[toluaI_index]);
+ return 1;
+}
+
+/* set function: lite_t of class  player_type */
+static int toluaI_set_player_player_type_lite_t(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=LITE_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->lite_t[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: temp_n of class  player_type */
+static int toluaI_get_player_player_type_temp_n(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->temp_n);
+ return 1;
+}
+
+/* set function: temp_n of class  player_type */
+static int toluaI_set_player_player_type_temp_n(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->temp_n = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: temp_y of class  player_type */
+static int toluaI_get_player_player_type_temp_y(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=TEMP_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->temp_y[toluaI_index]);
+ return 1;
+}
+
+/* set function: temp_y of class  player_type */
+static int toluaI_set_player_player_type_temp_y(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=TEMP_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->temp_y[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: temp_x of class  player_type */
+static int toluaI_get_player_player_type_temp_x(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=TEMP_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->temp_x[toluaI_index]);
+ return 1;
+}
+
+/* set function: temp_x of class  player_type */
+static int toluaI_set_player_player_type_temp_x(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=TEMP_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->temp_x[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: target_n of class  player_type */
+static int toluaI_get_player_player_type_target_n(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->target_n);
+ return 1;
+}
+
+/* set function: target_n of class  player_type */
+static int toluaI_set_player_player_type_target_n(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->target_n = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: target_y of class  player_type */
+static int toluaI_get_player_player_type_target_y(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=TEMP_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->target_y[toluaI_index]);
+ return 1;
+}
+
+/* set function: target_y of class  player_type */
+static int toluaI_set_player_player_type_target_y(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=TEMP_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->target_y[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: target_x of class  player_type */
+static int toluaI_get_player_player_type_target_x(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=TEMP_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->target_x[toluaI_index]);
+ return 1;
+}
+
+/* set function: target_x of class  player_type */
+static int toluaI_set_player_player_type_target_x(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=TEMP_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->target_x[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: target_idx of class  player_type */
+static int toluaI_get_player_player_type_target_idx(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=TEMP_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->target_idx[toluaI_index]);
+ return 1;
+}
+
+/* set function: target_idx of class  player_type */
+static int toluaI_set_player_player_type_target_idx(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=TEMP_MAX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->target_idx[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: dlev_id of class  player_type */
+static int toluaI_get_player_player_type_dlev_id(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dlev_id);
+ return 1;
+}
+
+/* set function: dlev_id of class  player_type */
+static int toluaI_set_player_player_type_dlev_id(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dlev_id = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: infofile of class  player_type */
+static int toluaI_get_player_player_type_infofile(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->infofile);
+ return 1;
+}
+
+/* get function: special_file_type of class  player_type */
+static int toluaI_get_player_player_type_special_file_type(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->special_file_type);
+ return 1;
+}
+
+/* set function: special_file_type of class  player_type */
+static int toluaI_set_player_player_type_special_file_type(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->special_file_type = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: obj_aware of class  player_type */
+static int toluaI_get_player_player_type_obj_aware(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->obj_aware[toluaI_index]);
+ return 1;
+}
+
+/* set function: obj_aware of class  player_type */
+static int toluaI_set_player_player_type_obj_aware(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->obj_aware[toluaI_index] = ((bool)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: obj_tried of class  player_type */
+static int toluaI_get_player_player_type_obj_tried(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->obj_tried[toluaI_index]);
+ return 1;
+}
+
+/* set function: obj_tried of class  player_type */
+static int toluaI_set_player_player_type_obj_tried(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->obj_tried[toluaI_index] = ((bool)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: trap_ident of class  player_type */
+static int toluaI_get_player_player_type_trap_ident(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_TR_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->trap_ident[toluaI_index]);
+ return 1;
+}
+
+/* set function: trap_ident of class  player_type */
+static int toluaI_set_player_player_type_trap_ident(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_TR_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->trap_ident[toluaI_index] = ((bool)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: d_attr of class  player_type */
+static int toluaI_get_player_player_type_d_attr(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->d_attr[toluaI_index]);
+ return 1;
+}
+
+/* set function: d_attr of class  player_type */
+static int toluaI_set_player_player_type_d_attr(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->d_attr[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: d_char of class  player_type */
+static int toluaI_get_player_player_type_d_char(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->d_char[toluaI_index]);
+ return 1;
+}
+
+/* set function: d_char of class  player_type */
+static int toluaI_set_player_player_type_d_char(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->d_char[toluaI_index] = ((char32_t)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: f_attr of class  player_type */
+static int toluaI_get_player_player_type_f_attr(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_F_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->f_attr[toluaI_index]);
+ return 1;
+}
+
+/* set function: f_attr of class  player_type */
+static int toluaI_set_player_player_type_f_attr(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_F_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->f_attr[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: f_char of class  player_type */
+static int toluaI_get_player_player_type_f_char(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_F_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->f_char[toluaI_index]);
+ return 1;
+}
+
+/* set function: f_char of class  player_type */
+static int toluaI_set_player_player_type_f_char(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_F_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->f_char[toluaI_index] = ((char32_t)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: k_attr of class  player_type */
+static int toluaI_get_player_player_type_k_attr(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->k_attr[toluaI_index]);
+ return 1;
+}
+
+/* set function: k_attr of class  player_type */
+static int toluaI_set_player_player_type_k_attr(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->k_attr[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: k_char of class  player_type */
+static int toluaI_get_player_player_type_k_char(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->k_char[toluaI_index]);
+ return 1;
+}
+
+/* set function: k_char of class  player_type */
+static int toluaI_set_player_player_type_k_char(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_K_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->k_char[toluaI_index] = ((char32_t)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: r_attr of class  player_type */
+static int toluaI_get_player_player_type_r_attr(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_R_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->r_attr[toluaI_index]);
+ return 1;
+}
+
+/* set function: r_attr of class  player_type */
+static int toluaI_set_player_player_type_r_attr(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_R_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->r_attr[toluaI_index] = ((byte)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: r_char of class  player_type */
+static int toluaI_get_player_player_type_r_char(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_R_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->r_char[toluaI_index]);
+ return 1;
+}
+
+/* set function: r_char of class  player_type */
+static int toluaI_set_player_player_type_r_char(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_R_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->r_char[toluaI_index] = ((char32_t)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: carry_query_flag of class  player_type */
+static int toluaI_get_player_player_type_carry_query_flag(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->carry_query_flag);
+ return 1;
+}
+
+/* set function: carry_query_flag of class  player_type */
+static int toluaI_set_player_player_type_carry_query_flag(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->carry_query_flag = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: use_old_target of class  player_type */
+static int toluaI_get_player_player_type_use_old_target(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->use_old_target);
+ return 1;
+}
+
+/* set function: use_old_target of class  player_type */
+static int toluaI_set_player_player_type_use_old_target(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->use_old_target = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: always_pickup of class  player_type */
+static int toluaI_get_player_player_type_always_pickup(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->always_pickup);
+ return 1;
+}
+
+/* set function: always_pickup of class  player_type */
+static int toluaI_set_player_player_type_always_pickup(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->always_pickup = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: stack_force_notes of class  player_type */
+static int toluaI_get_player_player_type_stack_force_notes(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->stack_force_notes);
+ return 1;
+}
+
+/* set function: stack_force_notes of class  player_type */
+static int toluaI_set_player_player_type_stack_force_notes(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->stack_force_notes = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: stack_force_costs of class  player_type */
+static int toluaI_get_player_player_type_stack_force_costs(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->stack_force_costs);
+ return 1;
+}
+
+/* set function: stack_force_costs of class  player_type */
+static int toluaI_set_player_player_type_stack_force_costs(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->stack_force_costs = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: find_ignore_stairs of class  player_type */
+static int toluaI_get_player_player_type_find_ignore_stairs(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->find_ignore_stairs);
+ return 1;
+}
+
+/* set function: find_ignore_stairs of class  player_type */
+static int toluaI_set_player_player_type_find_ignore_stairs(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->find_ignore_stairs = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: find_ignore_doors of class  player_type */
+static int toluaI_get_player_player_type_find_ignore_doors(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->find_ignore_doors);
+ return 1;
+}
+
+/* set function: find_ignore_doors of class  player_type */
+static int toluaI_set_player_player_type_find_ignore_doors(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->find_ignore_doors = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: find_cut of class  player_type */
+static int toluaI_get_player_player_type_find_cut(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->find_cut);
+ return 1;
+}
+
+/* set function: find_cut of class  player_type */
+static int toluaI_set_player_player_type_find_cut(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->find_cut = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: find_examine of class  player_type */
+static int toluaI_get_player_player_type_find_examine(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->find_examine);
+ return 1;
+}
+
+/* set function: find_examine of class  player_type */
+static int toluaI_set_player_player_type_find_examine(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->find_examine = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: find_ignore_montraps of class  player_type */
+static int toluaI_get_player_player_type_find_ignore_montraps(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->find_ignore_montraps);
+ return 1;
+}
+
+/* set function: find_ignore_montraps of class  player_type */
+static int toluaI_set_player_player_type_find_ignore_montraps(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->find_ignore_montraps = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: disturb_move of class  player_type */
+static int toluaI_get_player_player_type_disturb_move(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->disturb_move);
+ return 1;
+}
+
+/* set function: disturb_move of class  player_type */
+static int toluaI_set_player_player_type_disturb_move(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->disturb_move = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: disturb_near of class  player_type */
+static int toluaI_get_player_player_type_disturb_near(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->disturb_near);
+ return 1;
+}
+
+/* set function: disturb_near of class  player_type */
+static int toluaI_set_player_player_type_disturb_near(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->disturb_near = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: disturb_see of class  player_type */
+static int toluaI_get_player_player_type_disturb_see(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->disturb_see);
+ return 1;
+}
+
+/* set function: disturb_see of class  player_type */
+static int toluaI_set_player_player_type_disturb_see(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->disturb_see = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: disturb_panel of class  player_type */
+static int toluaI_get_player_player_type_disturb_panel(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->disturb_panel);
+ return 1;
+}
+
+/* set function: disturb_panel of class  player_type */
+static int toluaI_set_player_player_type_disturb_panel(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->disturb_panel = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: disturb_state of class  player_type */
+static int toluaI_get_player_player_type_disturb_state(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->disturb_state);
+ return 1;
+}
+
+/* set function: disturb_state of class  player_type */
+static int toluaI_set_player_player_type_disturb_state(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->disturb_state = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: disturb_minor of class  player_type */
+static int toluaI_get_player_player_type_disturb_minor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->disturb_minor);
+ return 1;
+}
+
+/* set function: disturb_minor of class  player_type */
+static int toluaI_set_player_player_type_disturb_minor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->disturb_minor = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: disturb_other of class  player_type */
+static int toluaI_get_player_player_type_disturb_other(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->disturb_other);
+ return 1;
+}
+
+/* set function: disturb_other of class  player_type */
+static int toluaI_set_player_player_type_disturb_other(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->disturb_other = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: stack_allow_items of class  player_type */
+static int toluaI_get_player_player_type_stack_allow_items(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->stack_allow_items);
+ return 1;
+}
+
+/* set function: stack_allow_items of class  player_type */
+static int toluaI_set_player_player_type_stack_allow_items(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->stack_allow_items = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: stack_allow_devices of class  player_type */
+static int toluaI_get_player_player_type_stack_allow_devices(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->stack_allow_devices);
+ return 1;
+}
+
+/* set function: stack_allow_devices of class  player_type */
+static int toluaI_set_player_player_type_stack_allow_devices(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->stack_allow_devices = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: view_perma_grids of class  player_type */
+static int toluaI_get_player_player_type_view_perma_grids(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->view_perma_grids);
+ return 1;
+}
+
+/* set function: view_perma_grids of class  player_type */
+static int toluaI_set_player_player_type_view_perma_grids(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->view_perma_grids = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: view_torch_grids of class  player_type */
+static int toluaI_get_player_player_type_view_torch_grids(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->view_torch_grids);
+ return 1;
+}
+
+/* set function: view_torch_grids of class  player_type */
+static int toluaI_set_player_player_type_view_torch_grids(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->view_torch_grids = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: view_reduce_lite of class  player_type */
+static int toluaI_get_player_player_type_view_reduce_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->view_reduce_lite);
+ return 1;
+}
+
+/* set function: view_reduce_lite of class  player_type */
+static int toluaI_set_player_player_type_view_reduce_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->view_reduce_lite = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: view_reduce_view of class  player_type */
+static int toluaI_get_player_player_type_view_reduce_view(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->view_reduce_view);
+ return 1;
+}
+
+/* set function: view_reduce_view of class  player_type */
+static int toluaI_set_player_player_type_view_reduce_view(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->view_reduce_view = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: view_lamp_floor of class  player_type */
+static int toluaI_get_player_player_type_view_lamp_floor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->view_lamp_floor);
+ return 1;
+}
+
+/* set function: view_lamp_floor of class  player_type */
+static int toluaI_set_player_player_type_view_lamp_floor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->view_lamp_floor = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: view_lamp_walls of class  player_type */
+static int toluaI_get_player_player_type_view_lamp_walls(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->view_lamp_walls);
+ return 1;
+}
+
+/* set function: view_lamp_walls of class  player_type */
+static int toluaI_set_player_player_type_view_lamp_walls(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->view_lamp_walls = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: view_shade_floor of class  player_type */
+static int toluaI_get_player_player_type_view_shade_floor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->view_shade_floor);
+ return 1;
+}
+
+/* set function: view_shade_floor of class  player_type */
+static int toluaI_set_player_player_type_view_shade_floor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->view_shade_floor = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: view_shade_walls of class  player_type */
+static int toluaI_get_player_player_type_view_shade_walls(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->view_shade_walls);
+ return 1;
+}
+
+/* set function: view_shade_walls of class  player_type */
+static int toluaI_set_player_player_type_view_shade_walls(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->view_shade_walls = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: wall_lighting of class  player_type */
+static int toluaI_get_player_player_type_wall_lighting(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->wall_lighting);
+ return 1;
+}
+
+/* set function: wall_lighting of class  player_type */
+static int toluaI_set_player_player_type_wall_lighting(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->wall_lighting = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: floor_lighting of class  player_type */
+static int toluaI_get_player_player_type_floor_lighting(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->floor_lighting);
+ return 1;
+}
+
+/* set function: floor_lighting of class  player_type */
+static int toluaI_set_player_player_type_floor_lighting(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->floor_lighting = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: view_animated_lite of class  player_type */
+static int toluaI_get_player_player_type_view_animated_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->view_animated_lite);
+ return 1;
+}
+
+/* set function: view_animated_lite of class  player_type */
+static int toluaI_set_player_player_type_view_animated_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->view_animated_lite = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: permawalls_shade of class  player_type */
+static int toluaI_get_player_player_type_permawalls_shade(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->permawalls_shade);
+ return 1;
+}
+
+/* set function: permawalls_shade of class  player_type */
+static int toluaI_set_player_player_type_permawalls_shade(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->permawalls_shade = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: live_timeouts of class  player_type */
+static int toluaI_get_player_player_type_live_timeouts(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->live_timeouts);
+ return 1;
+}
+
+/* set function: live_timeouts of class  player_type */
+static int toluaI_set_player_player_type_live_timeouts(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->live_timeouts = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: easy_open of class  player_type */
+static int toluaI_get_player_player_type_easy_open(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->easy_open);
+ return 1;
+}
+
+/* set function: easy_open of class  player_type */
+static int toluaI_set_player_player_type_easy_open(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->easy_open = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: easy_disarm of class  player_type */
+static int toluaI_get_player_player_type_easy_disarm(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->easy_disarm);
+ return 1;
+}
+
+/* set function: easy_disarm of class  player_type */
+static int toluaI_set_player_player_type_easy_disarm(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->easy_disarm = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: easy_disarm_montraps of class  player_type */
+static int toluaI_get_player_player_type_easy_disarm_montraps(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->easy_disarm_montraps);
+ return 1;
+}
+
+/* set function: easy_disarm_montraps of class  player_type */
+static int toluaI_set_player_player_type_easy_disarm_montraps(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->easy_disarm_montraps = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: easy_tunnel of class  player_type */
+static int toluaI_get_player_player_type_easy_tunnel(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->easy_tunnel);
+ return 1;
+}
+
+/* set function: easy_tunnel of class  player_type */
+static int toluaI_set_player_player_type_easy_tunnel(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->easy_tunnel = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: clear_inscr of class  player_type */
+static int toluaI_get_player_player_type_clear_inscr(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->clear_inscr);
+ return 1;
+}
+
+/* set function: clear_inscr of class  player_type */
+static int toluaI_set_player_player_type_clear_inscr(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->clear_inscr = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: auto_inscr_server of class  player_type */
+static int toluaI_get_player_player_type_auto_inscr_server(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->auto_inscr_server);
+ return 1;
+}
+
+/* set function: auto_inscr_server of class  player_type */
+static int toluaI_set_player_player_type_auto_inscr_server(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->auto_inscr_server = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: auto_inscr_server_ch of class  player_type */
+static int toluaI_get_player_player_type_auto_inscr_server_ch(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->auto_inscr_server_ch);
+ return 1;
+}
+
+/* set function: auto_inscr_server_ch of class  player_type */
+static int toluaI_set_player_player_type_auto_inscr_server_ch(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->auto_inscr_server_ch = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: autopickup_chemicals of class  player_type */
+static int toluaI_get_player_player_type_autopickup_chemicals(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->autopickup_chemicals);
+ return 1;
+}
+
+/* set function: autopickup_chemicals of class  player_type */
+static int toluaI_set_player_player_type_autopickup_chemicals(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->autopickup_chemicals = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: taciturn_messages of class  player_type */
+static int toluaI_get_player_player_type_taciturn_messages(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->taciturn_messages);
+ return 1;
+}
+
+/* set function: taciturn_messages of class  player_type */
+static int toluaI_set_player_player_type_taciturn_messages(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->taciturn_messages = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: last_words of class  player_type */
+static int toluaI_get_player_player_type_last_words(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->last_words);
+ return 1;
+}
+
+/* set function: last_words of class  player_type */
+static int toluaI_set_player_player_type_last_words(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->last_words = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warn_unique_credit of class  player_type */
+static int toluaI_get_player_player_type_warn_unique_credit(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warn_unique_credit);
+ return 1;
+}
+
+/* set function: warn_unique_credit of class  player_type */
+static int toluaI_set_player_player_type_warn_unique_credit(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warn_unique_credit = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: max_panel_rows of class  player_type */
+static int toluaI_get_player_player_type_max_panel_rows(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->max_panel_rows);
+ return 1;
+}
+
+/* set function: max_panel_rows of class  player_type */
+static int toluaI_set_player_player_type_max_panel_rows(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->max_panel_rows = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: max_panel_cols of class  player_type */
+static int toluaI_get_player_player_type_max_panel_cols(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->max_panel_cols);
+ return 1;
+}
+
+/* set function: max_panel_cols of class  player_type */
+static int toluaI_set_player_player_type_max_panel_cols(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->max_panel_cols = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panel_row of class  player_type */
+static int toluaI_get_player_player_type_panel_row(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panel_row);
+ return 1;
+}
+
+/* set function: panel_row of class  player_type */
+static int toluaI_set_player_player_type_panel_row(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panel_row = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panel_col of class  player_type */
+static int toluaI_get_player_player_type_panel_col(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panel_col);
+ return 1;
+}
+
+/* set function: panel_col of class  player_type */
+static int toluaI_set_player_player_type_panel_col(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panel_col = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panel_row_min of class  player_type */
+static int toluaI_get_player_player_type_panel_row_min(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panel_row_min);
+ return 1;
+}
+
+/* set function: panel_row_min of class  player_type */
+static int toluaI_set_player_player_type_panel_row_min(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panel_row_min = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panel_row_max of class  player_type */
+static int toluaI_get_player_player_type_panel_row_max(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panel_row_max);
+ return 1;
+}
+
+/* set function: panel_row_max of class  player_type */
+static int toluaI_set_player_player_type_panel_row_max(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panel_row_max = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panel_col_min of class  player_type */
+static int toluaI_get_player_player_type_panel_col_min(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panel_col_min);
+ return 1;
+}
+
+/* set function: panel_col_min of class  player_type */
+static int toluaI_set_player_player_type_panel_col_min(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panel_col_min = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panel_col_max of class  player_type */
+static int toluaI_get_player_player_type_panel_col_max(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panel_col_max);
+ return 1;
+}
+
+/* set function: panel_col_max of class  player_type */
+static int toluaI_set_player_player_type_panel_col_max(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panel_col_max = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panel_col_prt of class  player_type */
+static int toluaI_get_player_player_type_panel_col_prt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panel_col_prt);
+ return 1;
+}
+
+/* set function: panel_col_prt of class  player_type */
+static int toluaI_set_player_player_type_panel_col_prt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panel_col_prt = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panel_row_prt of class  player_type */
+static int toluaI_get_player_player_type_panel_row_prt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panel_row_prt);
+ return 1;
+}
+
+/* set function: panel_row_prt of class  player_type */
+static int toluaI_set_player_player_type_panel_row_prt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panel_row_prt = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panel_row_old of class  player_type */
+static int toluaI_get_player_player_type_panel_row_old(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panel_row_old);
+ return 1;
+}
+
+/* set function: panel_row_old of class  player_type */
+static int toluaI_set_player_player_type_panel_row_old(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panel_row_old = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panel_col_old of class  player_type */
+static int toluaI_get_player_player_type_panel_col_old(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panel_col_old);
+ return 1;
+}
+
+/* set function: panel_col_old of class  player_type */
+static int toluaI_set_player_player_type_panel_col_old(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panel_col_old = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: screen_wid of class  player_type */
+static int toluaI_get_player_player_type_screen_wid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->screen_wid);
+ return 1;
+}
+
+/* set function: screen_wid of class  player_type */
+static int toluaI_set_player_player_type_screen_wid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->screen_wid = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: screen_hgt of class  player_type */
+static int toluaI_get_player_player_type_screen_hgt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->screen_hgt);
+ return 1;
+}
+
+/* set function: screen_hgt of class  player_type */
+static int toluaI_set_player_player_type_screen_hgt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->screen_hgt = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: died_from of class  player_type */
+static int toluaI_get_player_player_type_died_from(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->died_from);
+ return 1;
+}
+
+/* get function: really_died_from of class  player_type */
+static int toluaI_get_player_player_type_really_died_from(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->really_died_from);
+ return 1;
+}
+
+/* get function: died_from_list of class  player_type */
+static int toluaI_get_player_player_type_died_from_list(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->died_from_list);
+ return 1;
+}
+
+/* get function: died_from_depth of class  player_type */
+static int toluaI_get_player_player_type_died_from_depth(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->died_from_depth);
+ return 1;
+}
+
+/* set function: died_from_depth of class  player_type */
+static int toluaI_set_player_player_type_died_from_depth(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->died_from_depth = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: total_winner of class  player_type */
+static int toluaI_get_player_player_type_total_winner(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->total_winner);
+ return 1;
+}
+
+/* set function: total_winner of class  player_type */
+static int toluaI_set_player_player_type_total_winner(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->total_winner = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: once_winner of class  player_type */
+static int toluaI_get_player_player_type_once_winner(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->once_winner);
+ return 1;
+}
+
+/* set function: once_winner of class  player_type */
+static int toluaI_set_player_player_type_once_winner(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->once_winner = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: iron_winner of class  player_type */
+static int toluaI_get_player_player_type_iron_winner(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->iron_winner);
+ return 1;
+}
+
+/* set function: iron_winner of class  player_type */
+static int toluaI_set_player_player_type_iron_winner(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->iron_winner = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: iron_winner_ded of class  player_type */
+static int toluaI_get_player_player_type_iron_winner_ded(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->iron_winner_ded);
+ return 1;
+}
+
+/* set function: iron_winner_ded of class  player_type */
+static int toluaI_set_player_player_type_iron_winner_ded(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->iron_winner_ded = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: own1 of class  player_type */
+static int toluaI_get_player_player_type_own1(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->own1,tolua_tag(tolua_S,"worldpos"));
+ return 1;
+}
+
+/* set function: own1 of class  player_type */
+static int toluaI_set_player_player_type_own1(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"worldpos"),0))
+ TOLUA_ERR_ASSIGN;
+  self->own1 = *((struct worldpos*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: own2 of class  player_type */
+static int toluaI_get_player_player_type_own2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->own2,tolua_tag(tolua_S,"worldpos"));
+ return 1;
+}
+
+/* set function: own2 of class  player_type */
+static int toluaI_set_player_player_type_own2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"worldpos"),0))
+ TOLUA_ERR_ASSIGN;
+  self->own2 = *((struct worldpos*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: retire_timer of class  player_type */
+static int toluaI_get_player_player_type_retire_timer(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->retire_timer);
+ return 1;
+}
+
+/* set function: retire_timer of class  player_type */
+static int toluaI_set_player_player_type_retire_timer(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->retire_timer = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: noscore of class  player_type */
+static int toluaI_get_player_player_type_noscore(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->noscore);
+ return 1;
+}
+
+/* set function: noscore of class  player_type */
+static int toluaI_set_player_player_type_noscore(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->noscore = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: command_rep of class  player_type */
+static int toluaI_get_player_player_type_command_rep(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->command_rep);
+ return 1;
+}
+
+/* set function: command_rep of class  player_type */
+static int toluaI_set_player_player_type_command_rep(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->command_rep = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: last_dir of class  player_type */
+static int toluaI_get_player_player_type_last_dir(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->last_dir);
+ return 1;
+}
+
+/* set function: last_dir of class  player_type */
+static int toluaI_set_player_player_type_last_dir(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->last_dir = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: running of class  player_type */
+static int toluaI_get_player_player_type_running(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->running);
+ return 1;
+}
+
+/* set function: running of class  player_type */
+static int toluaI_set_player_player_type_running(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->running = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: find_current of class  player_type */
+static int toluaI_get_player_player_type_find_current(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->find_current);
+ return 1;
+}
+
+/* set function: find_current of class  player_type */
+static int toluaI_set_player_player_type_find_current(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->find_current = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: find_prevdir of class  player_type */
+static int toluaI_get_player_player_type_find_prevdir(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->find_prevdir);
+ return 1;
+}
+
+/* set function: find_prevdir of class  player_type */
+static int toluaI_set_player_player_type_find_prevdir(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->find_prevdir = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: find_openarea of class  player_type */
+static int toluaI_get_player_player_type_find_openarea(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->find_openarea);
+ return 1;
+}
+
+/* set function: find_openarea of class  player_type */
+static int toluaI_set_player_player_type_find_openarea(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->find_openarea = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: find_breakright of class  player_type */
+static int toluaI_get_player_player_type_find_breakright(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->find_breakright);
+ return 1;
+}
+
+/* set function: find_breakright of class  player_type */
+static int toluaI_set_player_player_type_find_breakright(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->find_breakright = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: find_breakleft of class  player_type */
+static int toluaI_get_player_player_type_find_breakleft(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->find_breakleft);
+ return 1;
+}
+
+/* set function: find_breakleft of class  player_type */
+static int toluaI_set_player_player_type_find_breakleft(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->find_breakleft = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resting of class  player_type */
+static int toluaI_get_player_player_type_resting(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resting);
+ return 1;
+}
+
+/* set function: resting of class  player_type */
+static int toluaI_set_player_player_type_resting(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resting = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: energy_use of class  player_type */
+static int toluaI_get_player_player_type_energy_use(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->energy_use);
+ return 1;
+}
+
+/* set function: energy_use of class  player_type */
+static int toluaI_set_player_player_type_energy_use(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->energy_use = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: look_index of class  player_type */
+static int toluaI_get_player_player_type_look_index(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->look_index);
+ return 1;
+}
+
+/* set function: look_index of class  player_type */
+static int toluaI_set_player_player_type_look_index(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->look_index = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_char of class  player_type */
+static int toluaI_get_player_player_type_current_char(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_char);
+ return 1;
+}
+
+/* set function: current_char of class  player_type */
+static int toluaI_set_player_player_type_current_char(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_char = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_spell of class  player_type */
+static int toluaI_get_player_player_type_current_spell(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_spell);
+ return 1;
+}
+
+/* set function: current_spell of class  player_type */
+static int toluaI_set_player_player_type_current_spell(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_spell = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_mind of class  player_type */
+static int toluaI_get_player_player_type_current_mind(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_mind);
+ return 1;
+}
+
+/* set function: current_mind of class  player_type */
+static int toluaI_set_player_player_type_current_mind(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_mind = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_rod of class  player_type */
+static int toluaI_get_player_player_type_current_rod(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_rod);
+ return 1;
+}
+
+/* set function: current_rod of class  player_type */
+static int toluaI_set_player_player_type_current_rod(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_rod = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_activation of class  player_type */
+static int toluaI_get_player_player_type_current_activation(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_activation);
+ return 1;
+}
+
+/* set function: current_activation of class  player_type */
+static int toluaI_set_player_player_type_current_activation(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_activation = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_enchant_h of class  player_type */
+static int toluaI_get_player_player_type_current_enchant_h(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_enchant_h);
+ return 1;
+}
+
+/* set function: current_enchant_h of class  player_type */
+static int toluaI_set_player_player_type_current_enchant_h(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_enchant_h = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_enchant_d of class  player_type */
+static int toluaI_get_player_player_type_current_enchant_d(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_enchant_d);
+ return 1;
+}
+
+/* set function: current_enchant_d of class  player_type */
+static int toluaI_set_player_player_type_current_enchant_d(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_enchant_d = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_enchant_a of class  player_type */
+static int toluaI_get_player_player_type_current_enchant_a(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_enchant_a);
+ return 1;
+}
+
+/* set function: current_enchant_a of class  player_type */
+static int toluaI_set_player_player_type_current_enchant_a(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_enchant_a = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_identify of class  player_type */
+static int toluaI_get_player_player_type_current_identify(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_identify);
+ return 1;
+}
+
+/* set function: current_identify of class  player_type */
+static int toluaI_set_player_player_type_current_identify(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_identify = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_star_identify of class  player_type */
+static int toluaI_get_player_player_type_current_star_identify(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_star_identify);
+ return 1;
+}
+
+/* set function: current_star_identify of class  player_type */
+static int toluaI_set_player_player_type_current_star_identify(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_star_identify = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_recharge of class  player_type */
+static int toluaI_get_player_player_type_current_recharge(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_recharge);
+ return 1;
+}
+
+/* set function: current_recharge of class  player_type */
+static int toluaI_set_player_player_type_current_recharge(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_recharge = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_artifact of class  player_type */
+static int toluaI_get_player_player_type_current_artifact(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_artifact);
+ return 1;
+}
+
+/* set function: current_artifact of class  player_type */
+static int toluaI_set_player_player_type_current_artifact(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_artifact = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_artifact_nolife of class  player_type */
+static int toluaI_get_player_player_type_current_artifact_nolife(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_artifact_nolife);
+ return 1;
+}
+
+/* set function: current_artifact_nolife of class  player_type */
+static int toluaI_set_player_player_type_current_artifact_nolife(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_artifact_nolife = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_telekinesis of class  player_type */
+static int toluaI_get_player_player_type_current_telekinesis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)self->current_telekinesis,tolua_tag(tolua_S,"object_type"));
+ return 1;
+}
+
+/* set function: current_telekinesis of class  player_type */
+static int toluaI_set_player_player_type_current_telekinesis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"object_type"),0))
+ TOLUA_ERR_ASSIGN;
+  self->current_telekinesis = ((object_type*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_telekinesis_mw of class  player_type */
+static int toluaI_get_player_player_type_current_telekinesis_mw(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_telekinesis_mw);
+ return 1;
+}
+
+/* set function: current_telekinesis_mw of class  player_type */
+static int toluaI_set_player_player_type_current_telekinesis_mw(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_telekinesis_mw = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_curse of class  player_type */
+static int toluaI_get_player_player_type_current_curse(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_curse);
+ return 1;
+}
+
+/* set function: current_curse of class  player_type */
+static int toluaI_set_player_player_type_current_curse(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_curse = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suppress_ingredients of class  player_type */
+static int toluaI_get_player_player_type_suppress_ingredients(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suppress_ingredients);
+ return 1;
+}
+
+/* set function: suppress_ingredients of class  player_type */
+static int toluaI_set_player_player_type_suppress_ingredients(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suppress_ingredients = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_selling of class  player_type */
+static int toluaI_get_player_player_type_current_selling(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_selling);
+ return 1;
+}
+
+/* set function: current_selling of class  player_type */
+static int toluaI_set_player_player_type_current_selling(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_selling = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_sell_amt of class  player_type */
+static int toluaI_get_player_player_type_current_sell_amt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_sell_amt);
+ return 1;
+}
+
+/* set function: current_sell_amt of class  player_type */
+static int toluaI_set_player_player_type_current_sell_amt(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_sell_amt = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: current_sell_price of class  player_type */
+static int toluaI_get_player_player_type_current_sell_price(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->current_sell_price);
+ return 1;
+}
+
+/* set function: current_sell_price of class  player_type */
+static int toluaI_set_player_player_type_current_sell_price(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->current_sell_price = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: store_num of class  player_type */
+static int toluaI_get_player_player_type_store_num(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->store_num);
+ return 1;
+}
+
+/* set function: store_num of class  player_type */
+static int toluaI_set_player_player_type_store_num(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->store_num = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: fast of class  player_type */
+static int toluaI_get_player_player_type_fast(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->fast);
+ return 1;
+}
+
+/* set function: fast of class  player_type */
+static int toluaI_set_player_player_type_fast(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->fast = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: fast_mod of class  player_type */
+static int toluaI_get_player_player_type_fast_mod(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->fast_mod);
+ return 1;
+}
+
+/* set function: fast_mod of class  player_type */
+static int toluaI_set_player_player_type_fast_mod(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->fast_mod = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: slow of class  player_type */
+static int toluaI_get_player_player_type_slow(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->slow);
+ return 1;
+}
+
+/* set function: slow of class  player_type */
+static int toluaI_set_player_player_type_slow(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->slow = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: blind of class  player_type */
+static int toluaI_get_player_player_type_blind(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->blind);
+ return 1;
+}
+
+/* set function: blind of class  player_type */
+static int toluaI_set_player_player_type_blind(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->blind = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: paralyzed of class  player_type */
+static int toluaI_get_player_player_type_paralyzed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->paralyzed);
+ return 1;
+}
+
+/* set function: paralyzed of class  player_type */
+static int toluaI_set_player_player_type_paralyzed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->paralyzed = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suspended of class  player_type */
+static int toluaI_get_player_player_type_suspended(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suspended);
+ return 1;
+}
+
+/* set function: suspended of class  player_type */
+static int toluaI_set_player_player_type_suspended(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suspended = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: confused of class  player_type */
+static int toluaI_get_player_player_type_confused(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->confused);
+ return 1;
+}
+
+/* set function: confused of class  player_type */
+static int toluaI_set_player_player_type_confused(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->confused = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: afraid of class  player_type */
+static int toluaI_get_player_player_type_afraid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->afraid);
+ return 1;
+}
+
+/* set function: afraid of class  player_type */
+static int toluaI_set_player_player_type_afraid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->afraid = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: image of class  player_type */
+static int toluaI_get_player_player_type_image(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->image);
+ return 1;
+}
+
+/* set function: image of class  player_type */
+static int toluaI_set_player_player_type_image(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->image = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: poisoned of class  player_type */
+static int toluaI_get_player_player_type_poisoned(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->poisoned);
+ return 1;
+}
+
+/* set function: poisoned of class  player_type */
+static int toluaI_set_player_player_type_poisoned(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->poisoned = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: slow_poison of class  player_type */
+static int toluaI_get_player_player_type_slow_poison(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->slow_poison);
+ return 1;
+}
+
+/* set function: slow_poison of class  player_type */
+static int toluaI_set_player_player_type_slow_poison(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->slow_poison = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: diseased of class  player_type */
+static int toluaI_get_player_player_type_diseased(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->diseased);
+ return 1;
+}
+
+/* set function: diseased of class  player_type */
+static int toluaI_set_player_player_type_diseased(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->diseased = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: poisoned_attacker of class  player_type */
+static int toluaI_get_player_player_type_poisoned_attacker(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->poisoned_attacker);
+ return 1;
+}
+
+/* set function: poisoned_attacker of class  player_type */
+static int toluaI_set_player_player_type_poisoned_attacker(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->poisoned_attacker = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cut of class  player_type */
+static int toluaI_get_player_player_type_cut(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cut);
+ return 1;
+}
+
+/* set function: cut of class  player_type */
+static int toluaI_set_player_player_type_cut(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cut = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cut_bandaged of class  player_type */
+static int toluaI_get_player_player_type_cut_bandaged(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cut_bandaged);
+ return 1;
+}
+
+/* set function: cut_bandaged of class  player_type */
+static int toluaI_set_player_player_type_cut_bandaged(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cut_bandaged = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cut_attacker of class  player_type */
+static int toluaI_get_player_player_type_cut_attacker(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cut_attacker);
+ return 1;
+}
+
+/* set function: cut_attacker of class  player_type */
+static int toluaI_set_player_player_type_cut_attacker(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cut_attacker = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cut_intrinsic_regen of class  player_type */
+static int toluaI_get_player_player_type_cut_intrinsic_regen(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cut_intrinsic_regen);
+ return 1;
+}
+
+/* set function: cut_intrinsic_regen of class  player_type */
+static int toluaI_set_player_player_type_cut_intrinsic_regen(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cut_intrinsic_regen = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cut_intrinsic_nocut of class  player_type */
+static int toluaI_get_player_player_type_cut_intrinsic_nocut(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cut_intrinsic_nocut);
+ return 1;
+}
+
+/* set function: cut_intrinsic_nocut of class  player_type */
+static int toluaI_set_player_player_type_cut_intrinsic_nocut(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cut_intrinsic_nocut = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: stun of class  player_type */
+static int toluaI_get_player_player_type_stun(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->stun);
+ return 1;
+}
+
+/* set function: stun of class  player_type */
+static int toluaI_set_player_player_type_stun(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->stun = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtrastat_tim of class  player_type */
+static int toluaI_get_player_player_type_xtrastat_tim(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtrastat_tim);
+ return 1;
+}
+
+/* set function: xtrastat_tim of class  player_type */
+static int toluaI_set_player_player_type_xtrastat_tim(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtrastat_tim = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtrastat_demonic of class  player_type */
+static int toluaI_get_player_player_type_xtrastat_demonic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtrastat_demonic);
+ return 1;
+}
+
+/* set function: xtrastat_demonic of class  player_type */
+static int toluaI_set_player_player_type_xtrastat_demonic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtrastat_demonic = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: focus_time of class  player_type */
+static int toluaI_get_player_player_type_focus_time(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->focus_time);
+ return 1;
+}
+
+/* set function: focus_time of class  player_type */
+static int toluaI_set_player_player_type_focus_time(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->focus_time = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: protevil of class  player_type */
+static int toluaI_get_player_player_type_protevil(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->protevil);
+ return 1;
+}
+
+/* set function: protevil of class  player_type */
+static int toluaI_set_player_player_type_protevil(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->protevil = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: protevil_own of class  player_type */
+static int toluaI_get_player_player_type_protevil_own(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->protevil_own);
+ return 1;
+}
+
+/* set function: protevil_own of class  player_type */
+static int toluaI_set_player_player_type_protevil_own(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->protevil_own = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: zeal of class  player_type */
+static int toluaI_get_player_player_type_zeal(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->zeal);
+ return 1;
+}
+
+/* set function: zeal of class  player_type */
+static int toluaI_set_player_player_type_zeal(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->zeal = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: zeal_power of class  player_type */
+static int toluaI_get_player_player_type_zeal_power(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->zeal_power);
+ return 1;
+}
+
+/* set function: zeal_power of class  player_type */
+static int toluaI_set_player_player_type_zeal_power(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->zeal_power = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: martyr of class  player_type */
+static int toluaI_get_player_player_type_martyr(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->martyr);
+ return 1;
+}
+
+/* set function: martyr of class  player_type */
+static int toluaI_set_player_player_type_martyr(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->martyr = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: martyr_timeout of class  player_type */
+static int toluaI_get_player_player_type_martyr_timeout(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->martyr_timeout);
+ return 1;
+}
+
+/* set function: martyr_timeout of class  player_type */
+static int toluaI_set_player_player_type_martyr_timeout(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->martyr_timeout = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: res_fear_temp of class  player_type */
+static int toluaI_get_player_player_type_res_fear_temp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->res_fear_temp);
+ return 1;
+}
+
+/* set function: res_fear_temp of class  player_type */
+static int toluaI_set_player_player_type_res_fear_temp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->res_fear_temp = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: invuln of class  player_type */
+static int toluaI_get_player_player_type_invuln(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->invuln);
+ return 1;
+}
+
+/* set function: invuln of class  player_type */
+static int toluaI_set_player_player_type_invuln(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->invuln = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: hero of class  player_type */
+static int toluaI_get_player_player_type_hero(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->hero);
+ return 1;
+}
+
+/* set function: hero of class  player_type */
+static int toluaI_set_player_player_type_hero(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->hero = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: shero of class  player_type */
+static int toluaI_get_player_player_type_shero(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->shero);
+ return 1;
+}
+
+/* set function: shero of class  player_type */
+static int toluaI_set_player_player_type_shero(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->shero = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: fury of class  player_type */
+static int toluaI_get_player_player_type_fury(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->fury);
+ return 1;
+}
+
+/* set function: fury of class  player_type */
+static int toluaI_set_player_player_type_fury(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->fury = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: shield of class  player_type */
+static int toluaI_get_player_player_type_shield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->shield);
+ return 1;
+}
+
+/* set function: shield of class  player_type */
+static int toluaI_set_player_player_type_shield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->shield = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_regen of class  player_type */
+static int toluaI_get_player_player_type_tim_regen(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_regen);
+ return 1;
+}
+
+/* set function: tim_regen of class  player_type */
+static int toluaI_set_player_player_type_tim_regen(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_regen = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_regen_pow of class  player_type */
+static int toluaI_get_player_player_type_tim_regen_pow(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_regen_pow);
+ return 1;
+}
+
+/* set function: tim_regen_pow of class  player_type */
+static int toluaI_set_player_player_type_tim_regen_pow(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_regen_pow = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_regen_cost of class  player_type */
+static int toluaI_get_player_player_type_tim_regen_cost(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_regen_cost);
+ return 1;
+}
+
+/* set function: tim_regen_cost of class  player_type */
+static int toluaI_set_player_player_type_tim_regen_cost(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_regen_cost = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: blessed of class  player_type */
+static int toluaI_get_player_player_type_blessed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->blessed);
+ return 1;
+}
+
+/* set function: blessed of class  player_type */
+static int toluaI_set_player_player_type_blessed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->blessed = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: blessed_power of class  player_type */
+static int toluaI_get_player_player_type_blessed_power(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->blessed_power);
+ return 1;
+}
+
+/* set function: blessed_power of class  player_type */
+static int toluaI_set_player_player_type_blessed_power(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->blessed_power = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: blessed_own of class  player_type */
+static int toluaI_get_player_player_type_blessed_own(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->blessed_own);
+ return 1;
+}
+
+/* set function: blessed_own of class  player_type */
+static int toluaI_set_player_player_type_blessed_own(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->blessed_own = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dispersion of class  player_type */
+static int toluaI_get_player_player_type_dispersion(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dispersion);
+ return 1;
+}
+
+/* set function: dispersion of class  player_type */
+static int toluaI_set_player_player_type_dispersion(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dispersion = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dispersion_tim of class  player_type */
+static int toluaI_get_player_player_type_dispersion_tim(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dispersion_tim);
+ return 1;
+}
+
+/* set function: dispersion_tim of class  player_type */
+static int toluaI_set_player_player_type_dispersion_tim(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dispersion_tim = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_invis of class  player_type */
+static int toluaI_get_player_player_type_tim_invis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_invis);
+ return 1;
+}
+
+/* set function: tim_invis of class  player_type */
+static int toluaI_set_player_player_type_tim_invis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_invis = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_infra of class  player_type */
+static int toluaI_get_player_player_type_tim_infra(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_infra);
+ return 1;
+}
+
+/* set function: tim_infra of class  player_type */
+static int toluaI_set_player_player_type_tim_infra(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_infra = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_wraith of class  player_type */
+static int toluaI_get_player_player_type_tim_wraith(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_wraith);
+ return 1;
+}
+
+/* set function: tim_wraith of class  player_type */
+static int toluaI_set_player_player_type_tim_wraith(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_wraith = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_wraithstep of class  player_type */
+static int toluaI_get_player_player_type_tim_wraithstep(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_wraithstep);
+ return 1;
+}
+
+/* set function: tim_wraithstep of class  player_type */
+static int toluaI_set_player_player_type_tim_wraithstep(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_wraithstep = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: wraith_in_wall of class  player_type */
+static int toluaI_get_player_player_type_wraith_in_wall(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->wraith_in_wall);
+ return 1;
+}
+
+/* set function: wraith_in_wall of class  player_type */
+static int toluaI_set_player_player_type_wraith_in_wall(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->wraith_in_wall = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_jail of class  player_type */
+static int toluaI_get_player_player_type_tim_jail(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_jail);
+ return 1;
+}
+
+/* set function: tim_jail of class  player_type */
+static int toluaI_set_player_player_type_tim_jail(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_jail = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_susp of class  player_type */
+static int toluaI_get_player_player_type_tim_susp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_susp);
+ return 1;
+}
+
+/* set function: tim_susp of class  player_type */
+static int toluaI_set_player_player_type_tim_susp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_susp = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_pkill of class  player_type */
+static int toluaI_get_player_player_type_tim_pkill(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_pkill);
+ return 1;
+}
+
+/* set function: tim_pkill of class  player_type */
+static int toluaI_set_player_player_type_tim_pkill(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_pkill = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pkill of class  player_type */
+static int toluaI_get_player_player_type_pkill(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pkill);
+ return 1;
+}
+
+/* set function: pkill of class  player_type */
+static int toluaI_set_player_player_type_pkill(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pkill = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_meditation of class  player_type */
+static int toluaI_get_player_player_type_tim_meditation(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_meditation);
+ return 1;
+}
+
+/* set function: tim_meditation of class  player_type */
+static int toluaI_set_player_player_type_tim_meditation(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_meditation = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_invisibility of class  player_type */
+static int toluaI_get_player_player_type_tim_invisibility(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_invisibility);
+ return 1;
+}
+
+/* set function: tim_invisibility of class  player_type */
+static int toluaI_set_player_player_type_tim_invisibility(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_invisibility = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_invis_power of class  player_type */
+static int toluaI_get_player_player_type_tim_invis_power(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_invis_power);
+ return 1;
+}
+
+/* set function: tim_invis_power of class  player_type */
+static int toluaI_set_player_player_type_tim_invis_power(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_invis_power = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_invis_power2 of class  player_type */
+static int toluaI_get_player_player_type_tim_invis_power2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_invis_power2);
+ return 1;
+}
+
+/* set function: tim_invis_power2 of class  player_type */
+static int toluaI_set_player_player_type_tim_invis_power2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_invis_power2 = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_traps of class  player_type */
+static int toluaI_get_player_player_type_tim_traps(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_traps);
+ return 1;
+}
+
+/* set function: tim_traps of class  player_type */
+static int toluaI_set_player_player_type_tim_traps(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_traps = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_manashield of class  player_type */
+static int toluaI_get_player_player_type_tim_manashield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_manashield);
+ return 1;
+}
+
+/* set function: tim_manashield of class  player_type */
+static int toluaI_set_player_player_type_tim_manashield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_manashield = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_mimic of class  player_type */
+static int toluaI_get_player_player_type_tim_mimic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_mimic);
+ return 1;
+}
+
+/* set function: tim_mimic of class  player_type */
+static int toluaI_set_player_player_type_tim_mimic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_mimic = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_mimic_what of class  player_type */
+static int toluaI_get_player_player_type_tim_mimic_what(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_mimic_what);
+ return 1;
+}
+
+/* set function: tim_mimic_what of class  player_type */
+static int toluaI_set_player_player_type_tim_mimic_what(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_mimic_what = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ammo_brand of class  player_type */
+static int toluaI_get_player_player_type_ammo_brand(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ammo_brand);
+ return 1;
+}
+
+/* set function: ammo_brand of class  player_type */
+static int toluaI_set_player_player_type_ammo_brand(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ammo_brand = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ammo_brand_t of class  player_type */
+static int toluaI_get_player_player_type_ammo_brand_t(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ammo_brand_t);
+ return 1;
+}
+
+/* set function: ammo_brand_t of class  player_type */
+static int toluaI_set_player_player_type_ammo_brand_t(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ammo_brand_t = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ammo_brand_d of class  player_type */
+static int toluaI_get_player_player_type_ammo_brand_d(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ammo_brand_d);
+ return 1;
+}
+
+/* set function: ammo_brand_d of class  player_type */
+static int toluaI_set_player_player_type_ammo_brand_d(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ammo_brand_d = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: melee_brand of class  player_type */
+static int toluaI_get_player_player_type_melee_brand(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->melee_brand);
+ return 1;
+}
+
+/* set function: melee_brand of class  player_type */
+static int toluaI_set_player_player_type_melee_brand(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->melee_brand = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: melee_brand_t of class  player_type */
+static int toluaI_get_player_player_type_melee_brand_t(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->melee_brand_t);
+ return 1;
+}
+
+/* set function: melee_brand_t of class  player_type */
+static int toluaI_set_player_player_type_melee_brand_t(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->melee_brand_t = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: melee_brand_flags of class  player_type */
+static int toluaI_get_player_player_type_melee_brand_flags(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->melee_brand_flags);
+ return 1;
+}
+
+/* set function: melee_brand_flags of class  player_type */
+static int toluaI_set_player_player_type_melee_brand_flags(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->melee_brand_flags = ((unsigned char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: melee_brand2 of class  player_type */
+static int toluaI_get_player_player_type_melee_brand2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->melee_brand2);
+ return 1;
+}
+
+/* set function: melee_brand2 of class  player_type */
+static int toluaI_set_player_player_type_melee_brand2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->melee_brand2 = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: melee_brand2_t of class  player_type */
+static int toluaI_get_player_player_type_melee_brand2_t(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->melee_brand2_t);
+ return 1;
+}
+
+/* set function: melee_brand2_t of class  player_type */
+static int toluaI_set_player_player_type_melee_brand2_t(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->melee_brand2_t = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: melee_brand2_flags of class  player_type */
+static int toluaI_get_player_player_type_melee_brand2_flags(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->melee_brand2_flags);
+ return 1;
+}
+
+/* set function: melee_brand2_flags of class  player_type */
+static int toluaI_set_player_player_type_melee_brand2_flags(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->melee_brand2_flags = ((unsigned char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: melee_brand_ma of class  player_type */
+static int toluaI_get_player_player_type_melee_brand_ma(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->melee_brand_ma);
+ return 1;
+}
+
+/* set function: melee_brand_ma of class  player_type */
+static int toluaI_set_player_player_type_melee_brand_ma(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->melee_brand_ma = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: prob_travel of class  player_type */
+static int toluaI_get_player_player_type_prob_travel(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->prob_travel);
+ return 1;
+}
+
+/* set function: prob_travel of class  player_type */
+static int toluaI_set_player_player_type_prob_travel(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->prob_travel = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: st_anchor of class  player_type */
+static int toluaI_get_player_player_type_st_anchor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->st_anchor);
+ return 1;
+}
+
+/* set function: st_anchor of class  player_type */
+static int toluaI_set_player_player_type_st_anchor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->st_anchor = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_esp of class  player_type */
+static int toluaI_get_player_player_type_tim_esp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_esp);
+ return 1;
+}
+
+/* set function: tim_esp of class  player_type */
+static int toluaI_set_player_player_type_tim_esp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_esp = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: adrenaline of class  player_type */
+static int toluaI_get_player_player_type_adrenaline(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->adrenaline);
+ return 1;
+}
+
+/* set function: adrenaline of class  player_type */
+static int toluaI_set_player_player_type_adrenaline(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->adrenaline = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: biofeedback of class  player_type */
+static int toluaI_get_player_player_type_biofeedback(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->biofeedback);
+ return 1;
+}
+
+/* set function: biofeedback of class  player_type */
+static int toluaI_set_player_player_type_biofeedback(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->biofeedback = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mindboost of class  player_type */
+static int toluaI_get_player_player_type_mindboost(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mindboost);
+ return 1;
+}
+
+/* set function: mindboost of class  player_type */
+static int toluaI_set_player_player_type_mindboost(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mindboost = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mindboost_power of class  player_type */
+static int toluaI_get_player_player_type_mindboost_power(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mindboost_power);
+ return 1;
+}
+
+/* set function: mindboost_power of class  player_type */
+static int toluaI_set_player_player_type_mindboost_power(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mindboost_power = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: auto_tunnel of class  player_type */
+static int toluaI_get_player_player_type_auto_tunnel(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->auto_tunnel);
+ return 1;
+}
+
+/* set function: auto_tunnel of class  player_type */
+static int toluaI_set_player_player_type_auto_tunnel(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->auto_tunnel = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: body_monster of class  player_type */
+static int toluaI_get_player_player_type_body_monster(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->body_monster);
+ return 1;
+}
+
+/* set function: body_monster of class  player_type */
+static int toluaI_set_player_player_type_body_monster(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->body_monster = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: oppose_acid of class  player_type */
+static int toluaI_get_player_player_type_oppose_acid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->oppose_acid);
+ return 1;
+}
+
+/* set function: oppose_acid of class  player_type */
+static int toluaI_set_player_player_type_oppose_acid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->oppose_acid = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: oppose_elec of class  player_type */
+static int toluaI_get_player_player_type_oppose_elec(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->oppose_elec);
+ return 1;
+}
+
+/* set function: oppose_elec of class  player_type */
+static int toluaI_set_player_player_type_oppose_elec(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->oppose_elec = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: oppose_fire of class  player_type */
+static int toluaI_get_player_player_type_oppose_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->oppose_fire);
+ return 1;
+}
+
+/* set function: oppose_fire of class  player_type */
+static int toluaI_set_player_player_type_oppose_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->oppose_fire = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: oppose_cold of class  player_type */
+static int toluaI_get_player_player_type_oppose_cold(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->oppose_cold);
+ return 1;
+}
+
+/* set function: oppose_cold of class  player_type */
+static int toluaI_set_player_player_type_oppose_cold(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->oppose_cold = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: oppose_pois of class  player_type */
+static int toluaI_get_player_player_type_oppose_pois(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->oppose_pois);
+ return 1;
+}
+
+/* set function: oppose_pois of class  player_type */
+static int toluaI_set_player_player_type_oppose_pois(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->oppose_pois = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: word_recall of class  player_type */
+static int toluaI_get_player_player_type_word_recall(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->word_recall);
+ return 1;
+}
+
+/* set function: word_recall of class  player_type */
+static int toluaI_set_player_player_type_word_recall(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->word_recall = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: energy of class  player_type */
+static int toluaI_get_player_player_type_energy(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->energy);
+ return 1;
+}
+
+/* set function: energy of class  player_type */
+static int toluaI_set_player_player_type_energy(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->energy = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: food of class  player_type */
+static int toluaI_get_player_player_type_food(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->food);
+ return 1;
+}
+
+/* set function: food of class  player_type */
+static int toluaI_set_player_player_type_food(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->food = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: confusing of class  player_type */
+static int toluaI_get_player_player_type_confusing(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->confusing);
+ return 1;
+}
+
+/* set function: confusing of class  player_type */
+static int toluaI_set_player_player_type_confusing(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->confusing = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: stunning of class  player_type */
+static int toluaI_get_player_player_type_stunning(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->stunning);
+ return 1;
+}
+
+/* set function: stunning of class  player_type */
+static int toluaI_set_player_player_type_stunning(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->stunning = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: searching of class  player_type */
+static int toluaI_get_player_player_type_searching(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->searching);
+ return 1;
+}
+
+/* set function: searching of class  player_type */
+static int toluaI_set_player_player_type_searching(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->searching = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cloaked of class  player_type */
+static int toluaI_get_player_player_type_cloaked(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cloaked);
+ return 1;
+}
+
+/* set function: cloaked of class  player_type */
+static int toluaI_set_player_player_type_cloaked(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cloaked = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: old_lite of class  player_type */
+static int toluaI_get_player_player_type_old_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->old_lite);
+ return 1;
+}
+
+/* set function: old_lite of class  player_type */
+static int toluaI_set_player_player_type_old_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->old_lite = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: old_view of class  player_type */
+static int toluaI_get_player_player_type_old_view(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->old_view);
+ return 1;
+}
+
+/* set function: old_view of class  player_type */
+static int toluaI_set_player_player_type_old_view(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->old_view = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: old_food_aux of class  player_type */
+static int toluaI_get_player_player_type_old_food_aux(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->old_food_aux);
+ return 1;
+}
+
+/* set function: old_food_aux of class  player_type */
+static int toluaI_set_player_player_type_old_food_aux(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->old_food_aux = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cumber_armor of class  player_type */
+static int toluaI_get_player_player_type_cumber_armor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cumber_armor);
+ return 1;
+}
+
+/* set function: cumber_armor of class  player_type */
+static int toluaI_set_player_player_type_cumber_armor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cumber_armor = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: awkward_armor of class  player_type */
+static int toluaI_get_player_player_type_awkward_armor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->awkward_armor);
+ return 1;
+}
+
+/* set function: awkward_armor of class  player_type */
+static int toluaI_set_player_player_type_awkward_armor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->awkward_armor = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cumber_glove of class  player_type */
+static int toluaI_get_player_player_type_cumber_glove(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cumber_glove);
+ return 1;
+}
+
+/* set function: cumber_glove of class  player_type */
+static int toluaI_set_player_player_type_cumber_glove(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cumber_glove = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cumber_helm of class  player_type */
+static int toluaI_get_player_player_type_cumber_helm(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cumber_helm);
+ return 1;
+}
+
+/* set function: cumber_helm of class  player_type */
+static int toluaI_set_player_player_type_cumber_helm(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cumber_helm = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: heavy_wield of class  player_type */
+static int toluaI_get_player_player_type_heavy_wield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->heavy_wield);
+ return 1;
+}
+
+/* set function: heavy_wield of class  player_type */
+static int toluaI_set_player_player_type_heavy_wield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->heavy_wield = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: heavy_shield of class  player_type */
+static int toluaI_get_player_player_type_heavy_shield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->heavy_shield);
+ return 1;
+}
+
+/* set function: heavy_shield of class  player_type */
+static int toluaI_set_player_player_type_heavy_shield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->heavy_shield = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: heavy_shoot of class  player_type */
+static int toluaI_get_player_player_type_heavy_shoot(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->heavy_shoot);
+ return 1;
+}
+
+/* set function: heavy_shoot of class  player_type */
+static int toluaI_set_player_player_type_heavy_shoot(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->heavy_shoot = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: icky_wield of class  player_type */
+static int toluaI_get_player_player_type_icky_wield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->icky_wield);
+ return 1;
+}
+
+/* set function: icky_wield of class  player_type */
+static int toluaI_set_player_player_type_icky_wield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->icky_wield = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: awkward_wield of class  player_type */
+static int toluaI_get_player_player_type_awkward_wield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->awkward_wield);
+ return 1;
+}
+
+/* set function: awkward_wield of class  player_type */
+static int toluaI_set_player_player_type_awkward_wield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->awkward_wield = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: easy_wield of class  player_type */
+static int toluaI_get_player_player_type_easy_wield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->easy_wield);
+ return 1;
+}
+
+/* set function: easy_wield of class  player_type */
+static int toluaI_set_player_player_type_easy_wield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->easy_wield = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: heavy_tool of class  player_type */
+static int toluaI_get_player_player_type_heavy_tool(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->heavy_tool);
+ return 1;
+}
+
+/* set function: heavy_tool of class  player_type */
+static int toluaI_set_player_player_type_heavy_tool(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->heavy_tool = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cumber_weight of class  player_type */
+static int toluaI_get_player_player_type_cumber_weight(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cumber_weight);
+ return 1;
+}
+
+/* set function: cumber_weight of class  player_type */
+static int toluaI_set_player_player_type_cumber_weight(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cumber_weight = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: monk_heavyarmor of class  player_type */
+static int toluaI_get_player_player_type_monk_heavyarmor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->monk_heavyarmor);
+ return 1;
+}
+
+/* set function: monk_heavyarmor of class  player_type */
+static int toluaI_set_player_player_type_monk_heavyarmor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->monk_heavyarmor = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: awkward_shoot of class  player_type */
+static int toluaI_get_player_player_type_awkward_shoot(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->awkward_shoot);
+ return 1;
+}
+
+/* set function: awkward_shoot of class  player_type */
+static int toluaI_set_player_player_type_awkward_shoot(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->awkward_shoot = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: rogue_heavyarmor of class  player_type */
+static int toluaI_get_player_player_type_rogue_heavyarmor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->rogue_heavyarmor);
+ return 1;
+}
+
+/* set function: rogue_heavyarmor of class  player_type */
+static int toluaI_set_player_player_type_rogue_heavyarmor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->rogue_heavyarmor = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: heavy_swim of class  player_type */
+static int toluaI_get_player_player_type_heavy_swim(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->heavy_swim);
+ return 1;
+}
+
+/* set function: heavy_swim of class  player_type */
+static int toluaI_set_player_player_type_heavy_swim(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->heavy_swim = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cur_lite of class  player_type */
+static int toluaI_get_player_player_type_cur_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cur_lite);
+ return 1;
+}
+
+/* set function: cur_lite of class  player_type */
+static int toluaI_set_player_player_type_cur_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cur_lite = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: lite_type of class  player_type */
+static int toluaI_get_player_player_type_lite_type(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->lite_type);
+ return 1;
+}
+
+/* set function: lite_type of class  player_type */
+static int toluaI_set_player_player_type_lite_type(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->lite_type = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: notice of class  player_type */
+static int toluaI_get_player_player_type_notice(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->notice);
+ return 1;
+}
+
+/* set function: notice of class  player_type */
+static int toluaI_set_player_player_type_notice(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->notice = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: update of class  player_type */
+static int toluaI_get_player_player_type_update(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->update);
+ return 1;
+}
+
+/* set function: update of class  player_type */
+static int toluaI_set_player_player_type_update(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->update = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: redraw of class  player_type */
+static int toluaI_get_player_player_type_redraw(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->redraw);
+ return 1;
+}
+
+/* set function: redraw of class  player_type */
+static int toluaI_set_player_player_type_redraw(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->redraw = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: redraw2 of class  player_type */
+static int toluaI_get_player_player_type_redraw2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->redraw2);
+ return 1;
+}
+
+/* set function: redraw2 of class  player_type */
+static int toluaI_set_player_player_type_redraw2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->redraw2 = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: window of class  player_type */
+static int toluaI_get_player_player_type_window(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->window);
+ return 1;
+}
+
+/* set function: window of class  player_type */
+static int toluaI_set_player_player_type_window(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->window = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: stat_use of class  player_type */
+static int toluaI_get_player_player_type_stat_use(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->stat_use[toluaI_index]);
+ return 1;
+}
+
+/* set function: stat_use of class  player_type */
+static int toluaI_set_player_player_type_stat_use(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->stat_use[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: stat_top of class  player_type */
+static int toluaI_get_player_player_type_stat_top(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->stat_top[toluaI_index]);
+ return 1;
+}
+
+/* set function: stat_top of class  player_type */
+static int toluaI_set_player_player_type_stat_top(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->stat_top[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: stat_add of class  player_type */
+static int toluaI_get_player_player_type_stat_add(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->stat_add[toluaI_index]);
+ return 1;
+}
+
+/* set function: stat_add of class  player_type */
+static int toluaI_set_player_player_type_stat_add(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->stat_add[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: stat_tmp of class  player_type */
+static int toluaI_get_player_player_type_stat_tmp(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->stat_tmp[toluaI_index]);
+ return 1;
+}
+
+/* set function: stat_tmp of class  player_type */
+static int toluaI_set_player_player_type_stat_tmp(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->stat_tmp[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: stat_ind of class  player_type */
+static int toluaI_get_player_player_type_stat_ind(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->stat_ind[toluaI_index]);
+ return 1;
+}
+
+/* set function: stat_ind of class  player_type */
+static int toluaI_set_player_player_type_stat_ind(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=6)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->stat_ind[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: mimic_immunity of class  player_type */
+static int toluaI_get_player_player_type_mimic_immunity(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mimic_immunity);
+ return 1;
+}
+
+/* set function: mimic_immunity of class  player_type */
+static int toluaI_set_player_player_type_mimic_immunity(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mimic_immunity = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: breath_element of class  player_type */
+static int toluaI_get_player_player_type_breath_element(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->breath_element);
+ return 1;
+}
+
+/* set function: breath_element of class  player_type */
+static int toluaI_set_player_player_type_breath_element(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->breath_element = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: immune_acid of class  player_type */
+static int toluaI_get_player_player_type_immune_acid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->immune_acid);
+ return 1;
+}
+
+/* set function: immune_acid of class  player_type */
+static int toluaI_set_player_player_type_immune_acid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->immune_acid = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: immune_elec of class  player_type */
+static int toluaI_get_player_player_type_immune_elec(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->immune_elec);
+ return 1;
+}
+
+/* set function: immune_elec of class  player_type */
+static int toluaI_set_player_player_type_immune_elec(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->immune_elec = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: immune_fire of class  player_type */
+static int toluaI_get_player_player_type_immune_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->immune_fire);
+ return 1;
+}
+
+/* set function: immune_fire of class  player_type */
+static int toluaI_set_player_player_type_immune_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->immune_fire = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: immune_cold of class  player_type */
+static int toluaI_get_player_player_type_immune_cold(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->immune_cold);
+ return 1;
+}
+
+/* set function: immune_cold of class  player_type */
+static int toluaI_set_player_player_type_immune_cold(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->immune_cold = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: reduc_fire of class  player_type */
+static int toluaI_get_player_player_type_reduc_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->reduc_fire);
+ return 1;
+}
+
+/* set function: reduc_fire of class  player_type */
+static int toluaI_set_player_player_type_reduc_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->reduc_fire = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: reduc_elec of class  player_type */
+static int toluaI_get_player_player_type_reduc_elec(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->reduc_elec);
+ return 1;
+}
+
+/* set function: reduc_elec of class  player_type */
+static int toluaI_set_player_player_type_reduc_elec(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->reduc_elec = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: reduc_acid of class  player_type */
+static int toluaI_get_player_player_type_reduc_acid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->reduc_acid);
+ return 1;
+}
+
+/* set function: reduc_acid of class  player_type */
+static int toluaI_set_player_player_type_reduc_acid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->reduc_acid = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: reduc_cold of class  player_type */
+static int toluaI_get_player_player_type_reduc_cold(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->reduc_cold);
+ return 1;
+}
+
+/* set function: reduc_cold of class  player_type */
+static int toluaI_set_player_player_type_reduc_cold(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->reduc_cold = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_acid of class  player_type */
+static int toluaI_get_player_player_type_resist_acid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_acid);
+ return 1;
+}
+
+/* set function: resist_acid of class  player_type */
+static int toluaI_set_player_player_type_resist_acid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_acid = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_elec of class  player_type */
+static int toluaI_get_player_player_type_resist_elec(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_elec);
+ return 1;
+}
+
+/* set function: resist_elec of class  player_type */
+static int toluaI_set_player_player_type_resist_elec(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_elec = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_fire of class  player_type */
+static int toluaI_get_player_player_type_resist_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_fire);
+ return 1;
+}
+
+/* set function: resist_fire of class  player_type */
+static int toluaI_set_player_player_type_resist_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_fire = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_cold of class  player_type */
+static int toluaI_get_player_player_type_resist_cold(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_cold);
+ return 1;
+}
+
+/* set function: resist_cold of class  player_type */
+static int toluaI_set_player_player_type_resist_cold(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_cold = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_pois of class  player_type */
+static int toluaI_get_player_player_type_resist_pois(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_pois);
+ return 1;
+}
+
+/* set function: resist_pois of class  player_type */
+static int toluaI_set_player_player_type_resist_pois(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_pois = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_conf of class  player_type */
+static int toluaI_get_player_player_type_resist_conf(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_conf);
+ return 1;
+}
+
+/* set function: resist_conf of class  player_type */
+static int toluaI_set_player_player_type_resist_conf(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_conf = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_sound of class  player_type */
+static int toluaI_get_player_player_type_resist_sound(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_sound);
+ return 1;
+}
+
+/* set function: resist_sound of class  player_type */
+static int toluaI_set_player_player_type_resist_sound(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_sound = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_lite of class  player_type */
+static int toluaI_get_player_player_type_resist_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_lite);
+ return 1;
+}
+
+/* set function: resist_lite of class  player_type */
+static int toluaI_set_player_player_type_resist_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_lite = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_dark of class  player_type */
+static int toluaI_get_player_player_type_resist_dark(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_dark);
+ return 1;
+}
+
+/* set function: resist_dark of class  player_type */
+static int toluaI_set_player_player_type_resist_dark(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_dark = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_chaos of class  player_type */
+static int toluaI_get_player_player_type_resist_chaos(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_chaos);
+ return 1;
+}
+
+/* set function: resist_chaos of class  player_type */
+static int toluaI_set_player_player_type_resist_chaos(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_chaos = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_disen of class  player_type */
+static int toluaI_get_player_player_type_resist_disen(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_disen);
+ return 1;
+}
+
+/* set function: resist_disen of class  player_type */
+static int toluaI_set_player_player_type_resist_disen(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_disen = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_shard of class  player_type */
+static int toluaI_get_player_player_type_resist_shard(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_shard);
+ return 1;
+}
+
+/* set function: resist_shard of class  player_type */
+static int toluaI_set_player_player_type_resist_shard(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_shard = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_nexus of class  player_type */
+static int toluaI_get_player_player_type_resist_nexus(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_nexus);
+ return 1;
+}
+
+/* set function: resist_nexus of class  player_type */
+static int toluaI_set_player_player_type_resist_nexus(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_nexus = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_blind of class  player_type */
+static int toluaI_get_player_player_type_resist_blind(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_blind);
+ return 1;
+}
+
+/* set function: resist_blind of class  player_type */
+static int toluaI_set_player_player_type_resist_blind(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_blind = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_neth of class  player_type */
+static int toluaI_get_player_player_type_resist_neth(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_neth);
+ return 1;
+}
+
+/* set function: resist_neth of class  player_type */
+static int toluaI_set_player_player_type_resist_neth(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_neth = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_fear of class  player_type */
+static int toluaI_get_player_player_type_resist_fear(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_fear);
+ return 1;
+}
+
+/* set function: resist_fear of class  player_type */
+static int toluaI_set_player_player_type_resist_fear(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_fear = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: immune_neth of class  player_type */
+static int toluaI_get_player_player_type_immune_neth(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->immune_neth);
+ return 1;
+}
+
+/* set function: immune_neth of class  player_type */
+static int toluaI_set_player_player_type_immune_neth(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->immune_neth = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suscep_fire of class  player_type */
+static int toluaI_get_player_player_type_suscep_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suscep_fire);
+ return 1;
+}
+
+/* set function: suscep_fire of class  player_type */
+static int toluaI_set_player_player_type_suscep_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suscep_fire = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suscep_cold of class  player_type */
+static int toluaI_get_player_player_type_suscep_cold(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suscep_cold);
+ return 1;
+}
+
+/* set function: suscep_cold of class  player_type */
+static int toluaI_set_player_player_type_suscep_cold(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suscep_cold = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suscep_acid of class  player_type */
+static int toluaI_get_player_player_type_suscep_acid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suscep_acid);
+ return 1;
+}
+
+/* set function: suscep_acid of class  player_type */
+static int toluaI_set_player_player_type_suscep_acid(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suscep_acid = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suscep_elec of class  player_type */
+static int toluaI_get_player_player_type_suscep_elec(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suscep_elec);
+ return 1;
+}
+
+/* set function: suscep_elec of class  player_type */
+static int toluaI_set_player_player_type_suscep_elec(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suscep_elec = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suscep_pois of class  player_type */
+static int toluaI_get_player_player_type_suscep_pois(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suscep_pois);
+ return 1;
+}
+
+/* set function: suscep_pois of class  player_type */
+static int toluaI_set_player_player_type_suscep_pois(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suscep_pois = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suscep_lite of class  player_type */
+static int toluaI_get_player_player_type_suscep_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suscep_lite);
+ return 1;
+}
+
+/* set function: suscep_lite of class  player_type */
+static int toluaI_set_player_player_type_suscep_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suscep_lite = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suscep_good of class  player_type */
+static int toluaI_get_player_player_type_suscep_good(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suscep_good);
+ return 1;
+}
+
+/* set function: suscep_good of class  player_type */
+static int toluaI_set_player_player_type_suscep_good(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suscep_good = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suscep_evil of class  player_type */
+static int toluaI_get_player_player_type_suscep_evil(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suscep_evil);
+ return 1;
+}
+
+/* set function: suscep_evil of class  player_type */
+static int toluaI_set_player_player_type_suscep_evil(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suscep_evil = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: suscep_life of class  player_type */
+static int toluaI_get_player_player_type_suscep_life(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->suscep_life);
+ return 1;
+}
+
+/* set function: suscep_life of class  player_type */
+static int toluaI_set_player_player_type_suscep_life(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->suscep_life = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: demon of class  player_type */
+static int toluaI_get_player_player_type_demon(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->demon);
+ return 1;
+}
+
+/* set function: demon of class  player_type */
+static int toluaI_set_player_player_type_demon(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->demon = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: reflect of class  player_type */
+static int toluaI_get_player_player_type_reflect(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->reflect);
+ return 1;
+}
+
+/* set function: reflect of class  player_type */
+static int toluaI_set_player_player_type_reflect(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->reflect = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: shield_deflect of class  player_type */
+static int toluaI_get_player_player_type_shield_deflect(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->shield_deflect);
+ return 1;
+}
+
+/* set function: shield_deflect of class  player_type */
+static int toluaI_set_player_player_type_shield_deflect(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->shield_deflect = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: weapon_parry of class  player_type */
+static int toluaI_get_player_player_type_weapon_parry(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->weapon_parry);
+ return 1;
+}
+
+/* set function: weapon_parry of class  player_type */
+static int toluaI_set_player_player_type_weapon_parry(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->weapon_parry = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: res_tele of class  player_type */
+static int toluaI_get_player_player_type_res_tele(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->res_tele);
+ return 1;
+}
+
+/* set function: res_tele of class  player_type */
+static int toluaI_set_player_player_type_res_tele(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->res_tele = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ty_curse of class  player_type */
+static int toluaI_get_player_player_type_ty_curse(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ty_curse);
+ return 1;
+}
+
+/* set function: ty_curse of class  player_type */
+static int toluaI_set_player_player_type_ty_curse(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ty_curse = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dg_curse of class  player_type */
+static int toluaI_get_player_player_type_dg_curse(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dg_curse);
+ return 1;
+}
+
+/* set function: dg_curse of class  player_type */
+static int toluaI_set_player_player_type_dg_curse(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dg_curse = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xorder_id of class  player_type */
+static int toluaI_get_player_player_type_xorder_id(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xorder_id);
+ return 1;
+}
+
+/* set function: xorder_id of class  player_type */
+static int toluaI_set_player_player_type_xorder_id(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xorder_id = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xorder_num of class  player_type */
+static int toluaI_get_player_player_type_xorder_num(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xorder_num);
+ return 1;
+}
+
+/* set function: xorder_num of class  player_type */
+static int toluaI_set_player_player_type_xorder_num(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xorder_num = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: sustain_str of class  player_type */
+static int toluaI_get_player_player_type_sustain_str(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->sustain_str);
+ return 1;
+}
+
+/* set function: sustain_str of class  player_type */
+static int toluaI_set_player_player_type_sustain_str(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->sustain_str = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: sustain_int of class  player_type */
+static int toluaI_get_player_player_type_sustain_int(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->sustain_int);
+ return 1;
+}
+
+/* set function: sustain_int of class  player_type */
+static int toluaI_set_player_player_type_sustain_int(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->sustain_int = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: sustain_wis of class  player_type */
+static int toluaI_get_player_player_type_sustain_wis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->sustain_wis);
+ return 1;
+}
+
+/* set function: sustain_wis of class  player_type */
+static int toluaI_set_player_player_type_sustain_wis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->sustain_wis = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: sustain_dex of class  player_type */
+static int toluaI_get_player_player_type_sustain_dex(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->sustain_dex);
+ return 1;
+}
+
+/* set function: sustain_dex of class  player_type */
+static int toluaI_set_player_player_type_sustain_dex(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->sustain_dex = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: sustain_con of class  player_type */
+static int toluaI_get_player_player_type_sustain_con(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->sustain_con);
+ return 1;
+}
+
+/* set function: sustain_con of class  player_type */
+static int toluaI_set_player_player_type_sustain_con(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->sustain_con = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: sustain_chr of class  player_type */
+static int toluaI_get_player_player_type_sustain_chr(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->sustain_chr);
+ return 1;
+}
+
+/* set function: sustain_chr of class  player_type */
+static int toluaI_set_player_player_type_sustain_chr(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->sustain_chr = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: aggravate of class  player_type */
+static int toluaI_get_player_player_type_aggravate(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->aggravate);
+ return 1;
+}
+
+/* set function: aggravate of class  player_type */
+static int toluaI_set_player_player_type_aggravate(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->aggravate = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: teleport of class  player_type */
+static int toluaI_get_player_player_type_teleport(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->teleport);
+ return 1;
+}
+
+/* set function: teleport of class  player_type */
+static int toluaI_set_player_player_type_teleport(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->teleport = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: idle of class  player_type */
+static int toluaI_get_player_player_type_idle(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->idle);
+ return 1;
+}
+
+/* set function: idle of class  player_type */
+static int toluaI_set_player_player_type_idle(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->idle = ((long int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: idle_char of class  player_type */
+static int toluaI_get_player_player_type_idle_char(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->idle_char);
+ return 1;
+}
+
+/* set function: idle_char of class  player_type */
+static int toluaI_set_player_player_type_idle_char(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->idle_char = ((long int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: idle_attack of class  player_type */
+static int toluaI_get_player_player_type_idle_attack(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->idle_attack);
+ return 1;
+}
+
+/* set function: idle_attack of class  player_type */
+static int toluaI_set_player_player_type_idle_attack(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->idle_attack = ((long int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: afk of class  player_type */
+static int toluaI_get_player_player_type_afk(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->afk);
+ return 1;
+}
+
+/* set function: afk of class  player_type */
+static int toluaI_set_player_player_type_afk(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->afk = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: drain_exp of class  player_type */
+static int toluaI_get_player_player_type_drain_exp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->drain_exp);
+ return 1;
+}
+
+/* set function: drain_exp of class  player_type */
+static int toluaI_set_player_player_type_drain_exp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->drain_exp = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: drain_life of class  player_type */
+static int toluaI_get_player_player_type_drain_life(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->drain_life);
+ return 1;
+}
+
+/* set function: drain_life of class  player_type */
+static int toluaI_set_player_player_type_drain_life(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->drain_life = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: drain_mana of class  player_type */
+static int toluaI_get_player_player_type_drain_mana(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->drain_mana);
+ return 1;
+}
+
+/* set function: drain_mana of class  player_type */
+static int toluaI_set_player_player_type_drain_mana(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->drain_mana = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: feather_fall of class  player_type */
+static int toluaI_get_player_player_type_feather_fall(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->feather_fall);
+ return 1;
+}
+
+/* set function: feather_fall of class  player_type */
+static int toluaI_set_player_player_type_feather_fall(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->feather_fall = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: lite of class  player_type */
+static int toluaI_get_player_player_type_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->lite);
+ return 1;
+}
+
+/* set function: lite of class  player_type */
+static int toluaI_set_player_player_type_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->lite = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: free_act of class  player_type */
+static int toluaI_get_player_player_type_free_act(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->free_act);
+ return 1;
+}
+
+/* set function: free_act of class  player_type */
+static int toluaI_set_player_player_type_free_act(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->free_act = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: see_inv of class  player_type */
+static int toluaI_get_player_player_type_see_inv(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->see_inv);
+ return 1;
+}
+
+/* set function: see_inv of class  player_type */
+static int toluaI_set_player_player_type_see_inv(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->see_inv = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: regenerate of class  player_type */
+static int toluaI_get_player_player_type_regenerate(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->regenerate);
+ return 1;
+}
+
+/* set function: regenerate of class  player_type */
+static int toluaI_set_player_player_type_regenerate(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->regenerate = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_time of class  player_type */
+static int toluaI_get_player_player_type_resist_time(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_time);
+ return 1;
+}
+
+/* set function: resist_time of class  player_type */
+static int toluaI_set_player_player_type_resist_time(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_time = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_mana of class  player_type */
+static int toluaI_get_player_player_type_resist_mana(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_mana);
+ return 1;
+}
+
+/* set function: resist_mana of class  player_type */
+static int toluaI_set_player_player_type_resist_mana(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_mana = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: immune_poison of class  player_type */
+static int toluaI_get_player_player_type_immune_poison(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->immune_poison);
+ return 1;
+}
+
+/* set function: immune_poison of class  player_type */
+static int toluaI_set_player_player_type_immune_poison(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->immune_poison = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: immune_water of class  player_type */
+static int toluaI_get_player_player_type_immune_water(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->immune_water);
+ return 1;
+}
+
+/* set function: immune_water of class  player_type */
+static int toluaI_set_player_player_type_immune_water(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->immune_water = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resist_water of class  player_type */
+static int toluaI_get_player_player_type_resist_water(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resist_water);
+ return 1;
+}
+
+/* set function: resist_water of class  player_type */
+static int toluaI_set_player_player_type_resist_water(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resist_water = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: regen_mana of class  player_type */
+static int toluaI_get_player_player_type_regen_mana(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->regen_mana);
+ return 1;
+}
+
+/* set function: regen_mana of class  player_type */
+static int toluaI_set_player_player_type_regen_mana(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->regen_mana = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: keep_life of class  player_type */
+static int toluaI_get_player_player_type_keep_life(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->keep_life);
+ return 1;
+}
+
+/* set function: keep_life of class  player_type */
+static int toluaI_set_player_player_type_keep_life(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->keep_life = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: hold_life of class  player_type */
+static int toluaI_get_player_player_type_hold_life(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->hold_life);
+ return 1;
+}
+
+/* set function: hold_life of class  player_type */
+static int toluaI_set_player_player_type_hold_life(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->hold_life = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: telepathy of class  player_type */
+static int toluaI_get_player_player_type_telepathy(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->telepathy);
+ return 1;
+}
+
+/* set function: telepathy of class  player_type */
+static int toluaI_set_player_player_type_telepathy(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->telepathy = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: slow_digest of class  player_type */
+static int toluaI_get_player_player_type_slow_digest(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->slow_digest);
+ return 1;
+}
+
+/* set function: slow_digest of class  player_type */
+static int toluaI_set_player_player_type_slow_digest(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->slow_digest = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: blessed_weapon of class  player_type */
+static int toluaI_get_player_player_type_blessed_weapon(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->blessed_weapon);
+ return 1;
+}
+
+/* set function: blessed_weapon of class  player_type */
+static int toluaI_set_player_player_type_blessed_weapon(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->blessed_weapon = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtra_might of class  player_type */
+static int toluaI_get_player_player_type_xtra_might(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtra_might);
+ return 1;
+}
+
+/* set function: xtra_might of class  player_type */
+static int toluaI_set_player_player_type_xtra_might(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtra_might = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: impact of class  player_type */
+static int toluaI_get_player_player_type_impact(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->impact);
+ return 1;
+}
+
+/* set function: impact of class  player_type */
+static int toluaI_set_player_player_type_impact(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->impact = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: auto_id of class  player_type */
+static int toluaI_get_player_player_type_auto_id(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->auto_id);
+ return 1;
+}
+
+/* set function: auto_id of class  player_type */
+static int toluaI_set_player_player_type_auto_id(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->auto_id = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: no_cut of class  player_type */
+static int toluaI_get_player_player_type_no_cut(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->no_cut);
+ return 1;
+}
+
+/* set function: no_cut of class  player_type */
+static int toluaI_set_player_player_type_no_cut(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->no_cut = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: levitate of class  player_type */
+static int toluaI_get_player_player_type_levitate(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->levitate);
+ return 1;
+}
+
+/* set function: levitate of class  player_type */
+static int toluaI_set_player_player_type_levitate(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->levitate = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: can_swim of class  player_type */
+static int toluaI_get_player_player_type_can_swim(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->can_swim);
+ return 1;
+}
+
+/* set function: can_swim of class  player_type */
+static int toluaI_set_player_player_type_can_swim(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->can_swim = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pass_trees of class  player_type */
+static int toluaI_get_player_player_type_pass_trees(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pass_trees);
+ return 1;
+}
+
+/* set function: pass_trees of class  player_type */
+static int toluaI_set_player_player_type_pass_trees(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pass_trees = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: town_pass_trees of class  player_type */
+static int toluaI_get_player_player_type_town_pass_trees(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->town_pass_trees);
+ return 1;
+}
+
+/* set function: town_pass_trees of class  player_type */
+static int toluaI_set_player_player_type_town_pass_trees(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->town_pass_trees = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: reduce_insanity of class  player_type */
+static int toluaI_get_player_player_type_reduce_insanity(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->reduce_insanity);
+ return 1;
+}
+
+/* set function: reduce_insanity of class  player_type */
+static int toluaI_set_player_player_type_reduce_insanity(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->reduce_insanity = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: invis of class  player_type */
+static int toluaI_get_player_player_type_invis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->invis);
+ return 1;
+}
+
+/* set function: invis of class  player_type */
+static int toluaI_set_player_player_type_invis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->invis = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: admin_wiz of class  player_type */
+static int toluaI_get_player_player_type_admin_wiz(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->admin_wiz);
+ return 1;
+}
+
+/* set function: admin_wiz of class  player_type */
+static int toluaI_set_player_player_type_admin_wiz(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->admin_wiz = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: admin_dm of class  player_type */
+static int toluaI_get_player_player_type_admin_dm(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->admin_dm);
+ return 1;
+}
+
+/* set function: admin_dm of class  player_type */
+static int toluaI_set_player_player_type_admin_dm(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->admin_dm = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: extra_blows of class  player_type */
+static int toluaI_get_player_player_type_extra_blows(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->extra_blows);
+ return 1;
+}
+
+/* set function: extra_blows of class  player_type */
+static int toluaI_set_player_player_type_extra_blows(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->extra_blows = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xtra_crit of class  player_type */
+static int toluaI_get_player_player_type_xtra_crit(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xtra_crit);
+ return 1;
+}
+
+/* set function: xtra_crit of class  player_type */
+static int toluaI_set_player_player_type_xtra_crit(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xtra_crit = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_l of class  player_type */
+static int toluaI_get_player_player_type_to_l(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_l);
+ return 1;
+}
+
+/* set function: to_l of class  player_type */
+static int toluaI_set_player_player_type_to_l(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_l = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_hp of class  player_type */
+static int toluaI_get_player_player_type_to_hp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_hp);
+ return 1;
+}
+
+/* set function: to_hp of class  player_type */
+static int toluaI_set_player_player_type_to_hp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_hp = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_m of class  player_type */
+static int toluaI_get_player_player_type_to_m(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_m);
+ return 1;
+}
+
+/* set function: to_m of class  player_type */
+static int toluaI_set_player_player_type_to_m(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_m = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dis_to_h of class  player_type */
+static int toluaI_get_player_player_type_dis_to_h(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dis_to_h);
+ return 1;
+}
+
+/* set function: dis_to_h of class  player_type */
+static int toluaI_set_player_player_type_dis_to_h(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dis_to_h = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dis_to_d of class  player_type */
+static int toluaI_get_player_player_type_dis_to_d(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dis_to_d);
+ return 1;
+}
+
+/* set function: dis_to_d of class  player_type */
+static int toluaI_set_player_player_type_dis_to_d(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dis_to_d = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dis_to_a of class  player_type */
+static int toluaI_get_player_player_type_dis_to_a(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dis_to_a);
+ return 1;
+}
+
+/* set function: dis_to_a of class  player_type */
+static int toluaI_set_player_player_type_dis_to_a(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dis_to_a = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dis_ac of class  player_type */
+static int toluaI_get_player_player_type_dis_ac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dis_ac);
+ return 1;
+}
+
+/* set function: dis_ac of class  player_type */
+static int toluaI_set_player_player_type_dis_ac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dis_ac = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_h_melee of class  player_type */
+static int toluaI_get_player_player_type_to_h_melee(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_h_melee);
+ return 1;
+}
+
+/* set function: to_h_melee of class  player_type */
+static int toluaI_set_player_player_type_to_h_melee(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_h_melee = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_d_melee of class  player_type */
+static int toluaI_get_player_player_type_to_d_melee(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_d_melee);
+ return 1;
+}
+
+/* set function: to_d_melee of class  player_type */
+static int toluaI_set_player_player_type_to_d_melee(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_d_melee = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_h_ranged of class  player_type */
+static int toluaI_get_player_player_type_to_h_ranged(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_h_ranged);
+ return 1;
+}
+
+/* set function: to_h_ranged of class  player_type */
+static int toluaI_set_player_player_type_to_h_ranged(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_h_ranged = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_d_ranged of class  player_type */
+static int toluaI_get_player_player_type_to_d_ranged(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_d_ranged);
+ return 1;
+}
+
+/* set function: to_d_ranged of class  player_type */
+static int toluaI_set_player_player_type_to_d_ranged(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_d_ranged = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_h of class  player_type */
+static int toluaI_get_player_player_type_to_h(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_h);
+ return 1;
+}
+
+/* set function: to_h of class  player_type */
+static int toluaI_set_player_player_type_to_h(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_h = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_d of class  player_type */
+static int toluaI_get_player_player_type_to_d(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_d);
+ return 1;
+}
+
+/* set function: to_d of class  player_type */
+static int toluaI_set_player_player_type_to_d(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_d = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_a of class  player_type */
+static int toluaI_get_player_player_type_to_a(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_a);
+ return 1;
+}
+
+/* set function: to_a of class  player_type */
+static int toluaI_set_player_player_type_to_a(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_a = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_h_thrown of class  player_type */
+static int toluaI_get_player_player_type_to_h_thrown(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_h_thrown);
+ return 1;
+}
+
+/* set function: to_h_thrown of class  player_type */
+static int toluaI_set_player_player_type_to_h_thrown(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_h_thrown = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ac of class  player_type */
+static int toluaI_get_player_player_type_ac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ac);
+ return 1;
+}
+
+/* set function: ac of class  player_type */
+static int toluaI_set_player_player_type_ac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ac = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: overall_tohit_r of class  player_type */
+static int toluaI_get_player_player_type_overall_tohit_r(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->overall_tohit_r);
+ return 1;
+}
+
+/* set function: overall_tohit_r of class  player_type */
+static int toluaI_set_player_player_type_overall_tohit_r(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->overall_tohit_r = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: overall_todam_r of class  player_type */
+static int toluaI_get_player_player_type_overall_todam_r(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->overall_todam_r);
+ return 1;
+}
+
+/* set function: overall_todam_r of class  player_type */
+static int toluaI_set_player_player_type_overall_todam_r(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->overall_todam_r = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: overall_tohit_m of class  player_type */
+static int toluaI_get_player_player_type_overall_tohit_m(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->overall_tohit_m);
+ return 1;
+}
+
+/* set function: overall_tohit_m of class  player_type */
+static int toluaI_set_player_player_type_overall_tohit_m(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->overall_tohit_m = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: overall_todam_m of class  player_type */
+static int toluaI_get_player_player_type_overall_todam_m(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->overall_todam_m);
+ return 1;
+}
+
+/* set function: overall_todam_m of class  player_type */
+static int toluaI_set_player_player_type_overall_todam_m(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->overall_todam_m = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: see_infra of class  player_type */
+static int toluaI_get_player_player_type_see_infra(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->see_infra);
+ return 1;
+}
+
+/* set function: see_infra of class  player_type */
+static int toluaI_set_player_player_type_see_infra(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->see_infra = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill_dis of class  player_type */
+static int toluaI_get_player_player_type_skill_dis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_dis);
+ return 1;
+}
+
+/* set function: skill_dis of class  player_type */
+static int toluaI_set_player_player_type_skill_dis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_dis = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill_dev of class  player_type */
+static int toluaI_get_player_player_type_skill_dev(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_dev);
+ return 1;
+}
+
+/* set function: skill_dev of class  player_type */
+static int toluaI_set_player_player_type_skill_dev(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_dev = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill_sav of class  player_type */
+static int toluaI_get_player_player_type_skill_sav(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_sav);
+ return 1;
+}
+
+/* set function: skill_sav of class  player_type */
+static int toluaI_set_player_player_type_skill_sav(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_sav = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill_stl of class  player_type */
+static int toluaI_get_player_player_type_skill_stl(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_stl);
+ return 1;
+}
+
+/* set function: skill_stl of class  player_type */
+static int toluaI_set_player_player_type_skill_stl(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_stl = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill_srh of class  player_type */
+static int toluaI_get_player_player_type_skill_srh(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_srh);
+ return 1;
+}
+
+/* set function: skill_srh of class  player_type */
+static int toluaI_set_player_player_type_skill_srh(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_srh = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill_fos of class  player_type */
+static int toluaI_get_player_player_type_skill_fos(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_fos);
+ return 1;
+}
+
+/* set function: skill_fos of class  player_type */
+static int toluaI_set_player_player_type_skill_fos(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_fos = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill_thn of class  player_type */
+static int toluaI_get_player_player_type_skill_thn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_thn);
+ return 1;
+}
+
+/* set function: skill_thn of class  player_type */
+static int toluaI_set_player_player_type_skill_thn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_thn = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill_thb of class  player_type */
+static int toluaI_get_player_player_type_skill_thb(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_thb);
+ return 1;
+}
+
+/* set function: skill_thb of class  player_type */
+static int toluaI_set_player_player_type_skill_thb(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_thb = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill_tht of class  player_type */
+static int toluaI_get_player_player_type_skill_tht(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_tht);
+ return 1;
+}
+
+/* set function: skill_tht of class  player_type */
+static int toluaI_set_player_player_type_skill_tht(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_tht = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill_dig of class  player_type */
+static int toluaI_get_player_player_type_skill_dig(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_dig);
+ return 1;
+}
+
+/* set function: skill_dig of class  player_type */
+static int toluaI_set_player_player_type_skill_dig(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_dig = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: num_blow of class  player_type */
+static int toluaI_get_player_player_type_num_blow(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->num_blow);
+ return 1;
+}
+
+/* set function: num_blow of class  player_type */
+static int toluaI_set_player_player_type_num_blow(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->num_blow = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: num_fire of class  player_type */
+static int toluaI_get_player_player_type_num_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->num_fire);
+ return 1;
+}
+
+/* set function: num_fire of class  player_type */
+static int toluaI_set_player_player_type_num_fire(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->num_fire = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: num_spell of class  player_type */
+static int toluaI_get_player_player_type_num_spell(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->num_spell);
+ return 1;
+}
+
+/* set function: num_spell of class  player_type */
+static int toluaI_set_player_player_type_num_spell(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->num_spell = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tval_xtra of class  player_type */
+static int toluaI_get_player_player_type_tval_xtra(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tval_xtra);
+ return 1;
+}
+
+/* set function: tval_xtra of class  player_type */
+static int toluaI_set_player_player_type_tval_xtra(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tval_xtra = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tval_ammo of class  player_type */
+static int toluaI_get_player_player_type_tval_ammo(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tval_ammo);
+ return 1;
+}
+
+/* set function: tval_ammo of class  player_type */
+static int toluaI_set_player_player_type_tval_ammo(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tval_ammo = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pspeed of class  player_type */
+static int toluaI_get_player_player_type_pspeed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pspeed);
+ return 1;
+}
+
+/* set function: pspeed of class  player_type */
+static int toluaI_set_player_player_type_pspeed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pspeed = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: r_killed of class  player_type */
+static int toluaI_get_player_player_type_r_killed(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_R_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->r_killed[toluaI_index]);
+ return 1;
+}
+
+/* set function: r_killed of class  player_type */
+static int toluaI_set_player_player_type_r_killed(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_R_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->r_killed[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: r_mimicry of class  player_type */
+static int toluaI_get_player_player_type_r_mimicry(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_R_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->r_mimicry[toluaI_index]);
+ return 1;
+}
+
+/* set function: r_mimicry of class  player_type */
+static int toluaI_set_player_player_type_r_mimicry(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_R_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->r_mimicry[toluaI_index] = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: melee_techniques of class  player_type */
+static int toluaI_get_player_player_type_melee_techniques(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->melee_techniques);
+ return 1;
+}
+
+/* set function: melee_techniques of class  player_type */
+static int toluaI_set_player_player_type_melee_techniques(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->melee_techniques = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ranged_techniques of class  player_type */
+static int toluaI_get_player_player_type_ranged_techniques(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ranged_techniques);
+ return 1;
+}
+
+/* set function: ranged_techniques of class  player_type */
+static int toluaI_set_player_player_type_ranged_techniques(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ranged_techniques = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: innate_spells of class  player_type */
+static int toluaI_get_player_player_type_innate_spells(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=4)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->innate_spells[toluaI_index]);
+ return 1;
+}
+
+/* set function: innate_spells of class  player_type */
+static int toluaI_set_player_player_type_innate_spells(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=4)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->innate_spells[toluaI_index] = ((s32b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: body_changed of class  player_type */
+static int toluaI_get_player_player_type_body_changed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->body_changed);
+ return 1;
+}
+
+/* set function: body_changed of class  player_type */
+static int toluaI_set_player_player_type_body_changed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->body_changed = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: anti_magic of class  player_type */
+static int toluaI_get_player_player_type_anti_magic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->anti_magic);
+ return 1;
+}
+
+/* set function: anti_magic of class  player_type */
+static int toluaI_set_player_player_type_anti_magic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->anti_magic = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: antimagic of class  player_type */
+static int toluaI_get_player_player_type_antimagic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->antimagic);
+ return 1;
+}
+
+/* set function: antimagic of class  player_type */
+static int toluaI_set_player_player_type_antimagic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->antimagic = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: antimagic_dis of class  player_type */
+static int toluaI_get_player_player_type_antimagic_dis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->antimagic_dis);
+ return 1;
+}
+
+/* set function: antimagic_dis of class  player_type */
+static int toluaI_set_player_player_type_antimagic_dis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->antimagic_dis = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: blood_bond of class  player_type */
+static int toluaI_get_player_player_type_blood_bond(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)self->blood_bond,tolua_tag(tolua_S,"player_list_type"));
+ return 1;
+}
+
+/* set function: blood_bond of class  player_type */
+static int toluaI_set_player_player_type_blood_bond(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"player_list_type"),0))
+ TOLUA_ERR_ASSIGN;
+  self->blood_bond = ((player_list_type*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mode of class  player_type */
+static int toluaI_get_player_player_type_mode(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mode);
+ return 1;
+}
+
+/* set function: mode of class  player_type */
+static int toluaI_set_player_player_type_mode(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mode = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: esp_link of class  player_type */
+static int toluaI_get_player_player_type_esp_link(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->esp_link);
+ return 1;
+}
+
+/* set function: esp_link of class  player_type */
+static int toluaI_set_player_player_type_esp_link(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->esp_link = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: esp_link_type of class  player_type */
+static int toluaI_get_player_player_type_esp_link_type(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->esp_link_type);
+ return 1;
+}
+
+/* set function: esp_link_type of class  player_type */
+static int toluaI_set_player_player_type_esp_link_type(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->esp_link_type = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: esp_link_flags of class  player_type */
+static int toluaI_get_player_player_type_esp_link_flags(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->esp_link_flags);
+ return 1;
+}
+
+/* set function: esp_link_flags of class  player_type */
+static int toluaI_set_player_player_type_esp_link_flags(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->esp_link_flags = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: esp_link_end of class  player_type */
+static int toluaI_get_player_player_type_esp_link_end(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->esp_link_end);
+ return 1;
+}
+
+/* set function: esp_link_end of class  player_type */
+static int toluaI_set_player_player_type_esp_link_end(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->esp_link_end = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: black_breath of class  player_type */
+static int toluaI_get_player_player_type_black_breath(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->black_breath);
+ return 1;
+}
+
+/* set function: black_breath of class  player_type */
+static int toluaI_set_player_player_type_black_breath(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->black_breath = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: msane of class  player_type */
+static int toluaI_get_player_player_type_msane(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->msane);
+ return 1;
+}
+
+/* set function: msane of class  player_type */
+static int toluaI_set_player_player_type_msane(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->msane = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: csane of class  player_type */
+static int toluaI_get_player_player_type_csane(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->csane);
+ return 1;
+}
+
+/* set function: csane of class  player_type */
+static int toluaI_set_player_player_type_csane(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->csane = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: csane_frac of class  player_type */
+static int toluaI_get_player_player_type_csane_frac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->csane_frac);
+ return 1;
+}
+
+/* set function: csane_frac of class  player_type */
+static int toluaI_set_player_player_type_csane_frac(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->csane_frac = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: spell_project of class  player_type */
+static int toluaI_get_player_player_type_spell_project(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->spell_project);
+ return 1;
+}
+
+/* set function: spell_project of class  player_type */
+static int toluaI_set_player_player_type_spell_project(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->spell_project = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dodge_level of class  player_type */
+static int toluaI_get_player_player_type_dodge_level(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dodge_level);
+ return 1;
+}
+
+/* set function: dodge_level of class  player_type */
+static int toluaI_set_player_player_type_dodge_level(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dodge_level = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_blacklist of class  player_type */
+static int toluaI_get_player_player_type_tim_blacklist(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_blacklist);
+ return 1;
+}
+
+/* set function: tim_blacklist of class  player_type */
+static int toluaI_set_player_player_type_tim_blacklist(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_blacklist = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_watchlist of class  player_type */
+static int toluaI_get_player_player_type_tim_watchlist(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_watchlist);
+ return 1;
+}
+
+/* set function: tim_watchlist of class  player_type */
+static int toluaI_set_player_player_type_tim_watchlist(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_watchlist = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pstealing of class  player_type */
+static int toluaI_get_player_player_type_pstealing(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pstealing);
+ return 1;
+}
+
+/* set function: pstealing of class  player_type */
+static int toluaI_set_player_player_type_pstealing(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pstealing = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: team of class  player_type */
+static int toluaI_get_player_player_type_team(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->team);
+ return 1;
+}
+
+/* set function: team of class  player_type */
+static int toluaI_set_player_player_type_team(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->team = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ret_dam of class  player_type */
+static int toluaI_get_player_player_type_ret_dam(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ret_dam);
+ return 1;
+}
+
+/* set function: ret_dam of class  player_type */
+static int toluaI_set_player_player_type_ret_dam(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ret_dam = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: attacker of class  player_type */
+static int toluaI_get_player_player_type_attacker(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->attacker);
+ return 1;
+}
+
+/* get function: luck of class  player_type */
+static int toluaI_get_player_player_type_luck(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->luck);
+ return 1;
+}
+
+/* set function: luck of class  player_type */
+static int toluaI_set_player_player_type_luck(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->luck = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panic of class  player_type */
+static int toluaI_get_player_player_type_panic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panic);
+ return 1;
+}
+
+/* set function: panic of class  player_type */
+static int toluaI_set_player_player_type_panic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panic = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: supp of class  player_type */
+static int toluaI_get_player_player_type_supp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->supp);
+ return 1;
+}
+
+/* set function: supp of class  player_type */
+static int toluaI_set_player_player_type_supp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->supp = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: supp_top of class  player_type */
+static int toluaI_get_player_player_type_supp_top(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->supp_top);
+ return 1;
+}
+
+/* set function: supp_top of class  player_type */
+static int toluaI_set_player_player_type_supp_top(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->supp_top = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: support_timer of class  player_type */
+static int toluaI_get_player_player_type_support_timer(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->support_timer);
+ return 1;
+}
+
+/* set function: support_timer of class  player_type */
+static int toluaI_set_player_player_type_support_timer(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->support_timer = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: updated_savegame of class  player_type */
+static int toluaI_get_player_player_type_updated_savegame(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->updated_savegame);
+ return 1;
+}
+
+/* set function: updated_savegame of class  player_type */
+static int toluaI_set_player_player_type_updated_savegame(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->updated_savegame = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: artifact_reset of class  player_type */
+static int toluaI_get_player_player_type_artifact_reset(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->artifact_reset);
+ return 1;
+}
+
+/* set function: artifact_reset of class  player_type */
+static int toluaI_set_player_player_type_artifact_reset(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->artifact_reset = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: fluent_artifact_reset of class  player_type */
+static int toluaI_get_player_player_type_fluent_artifact_reset(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->fluent_artifact_reset);
+ return 1;
+}
+
+/* set function: fluent_artifact_reset of class  player_type */
+static int toluaI_set_player_player_type_fluent_artifact_reset(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->fluent_artifact_reset = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: corner_turn of class  player_type */
+static int toluaI_get_player_player_type_corner_turn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->corner_turn);
+ return 1;
+}
+
+/* set function: corner_turn of class  player_type */
+static int toluaI_set_player_player_type_corner_turn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->corner_turn = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: joke_weather of class  player_type */
+static int toluaI_get_player_player_type_joke_weather(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->joke_weather);
+ return 1;
+}
+
+/* set function: joke_weather of class  player_type */
+static int toluaI_set_player_player_type_joke_weather(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->joke_weather = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: has_pet of class  player_type */
+static int toluaI_get_player_player_type_has_pet(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->has_pet);
+ return 1;
+}
+
+/* set function: has_pet of class  player_type */
+static int toluaI_set_player_player_type_has_pet(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->has_pet = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: global_event_type of class  player_type */
+static int toluaI_get_player_player_type_global_event_type(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_GLOBAL_EVENTS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->global_event_type[toluaI_index]);
+ return 1;
+}
+
+/* set function: global_event_type of class  player_type */
+static int toluaI_set_player_player_type_global_event_type(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_GLOBAL_EVENTS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->global_event_type[toluaI_index] = ((int)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: global_event_signup of class  player_type */
+static int toluaI_get_player_player_type_global_event_signup(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_GLOBAL_EVENTS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&self->global_event_signup[toluaI_index],tolua_tag(tolua_S,"time_t"));
+ return 1;
+}
+
+/* set function: global_event_signup of class  player_type */
+static int toluaI_set_player_player_type_global_event_signup(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_GLOBAL_EVENTS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->global_event_signup[toluaI_index] = *((time_t*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: global_event_started of class  player_type */
+static int toluaI_get_player_player_type_global_event_started(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_GLOBAL_EVENTS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&self->global_event_started[toluaI_index],tolua_tag(tolua_S,"time_t"));
+ return 1;
+}
+
+/* set function: global_event_started of class  player_type */
+static int toluaI_set_player_player_type_global_event_started(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_GLOBAL_EVENTS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->global_event_started[toluaI_index] = *((time_t*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: global_event_participated of class  player_type */
+static int toluaI_get_player_player_type_global_event_participated(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_GLOBAL_EVENT_TYPES)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->global_event_participated[toluaI_index]);
+ return 1;
+}
+
+/* set function: global_event_participated of class  player_type */
+static int toluaI_set_player_player_type_global_event_participated(lua_State* tolua_S)
+{
+ int toluaI_index;
+  player_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (player_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_GLOBAL_EVENT_TYPES)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->global_event_participated[toluaI_index] = ((int)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: combat_stance of class  player_type */
+static int toluaI_get_player_player_type_combat_stance(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->combat_stance);
+ return 1;
+}
+
+/* set function: combat_stance of class  player_type */
+static int toluaI_set_player_player_type_combat_stance(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->combat_stance = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: combat_stance_prev of class  player_type */
+static int toluaI_get_player_player_type_combat_stance_prev(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->combat_stance_prev);
+ return 1;
+}
+
+/* set function: combat_stance_prev of class  player_type */
+static int toluaI_set_player_player_type_combat_stance_prev(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->combat_stance_prev = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: combat_stance_power of class  player_type */
+static int toluaI_get_player_player_type_combat_stance_power(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->combat_stance_power);
+ return 1;
+}
+
+/* set function: combat_stance_power of class  player_type */
+static int toluaI_set_player_player_type_combat_stance_power(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->combat_stance_power = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: shoot_till_kill of class  player_type */
+static int toluaI_get_player_player_type_shoot_till_kill(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->shoot_till_kill);
+ return 1;
+}
+
+/* set function: shoot_till_kill of class  player_type */
+static int toluaI_set_player_player_type_shoot_till_kill(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->shoot_till_kill = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: shooty_till_kill of class  player_type */
+static int toluaI_get_player_player_type_shooty_till_kill(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->shooty_till_kill);
+ return 1;
+}
+
+/* set function: shooty_till_kill of class  player_type */
+static int toluaI_set_player_player_type_shooty_till_kill(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->shooty_till_kill = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: shooting_till_kill of class  player_type */
+static int toluaI_get_player_player_type_shooting_till_kill(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->shooting_till_kill);
+ return 1;
+}
+
+/* set function: shooting_till_kill of class  player_type */
+static int toluaI_set_player_player_type_shooting_till_kill(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->shooting_till_kill = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: shoot_till_kill_book of class  player_type */
+static int toluaI_get_player_player_type_shoot_till_kill_book(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->shoot_till_kill_book);
+ return 1;
+}
+
+/* set function: shoot_till_kill_book of class  player_type */
+static int toluaI_set_player_player_type_shoot_till_kill_book(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->shoot_till_kill_book = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: shoot_till_kill_spell of class  player_type */
+static int toluaI_get_player_player_type_shoot_till_kill_spell(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->shoot_till_kill_spell);
+ return 1;
+}
+
+/* set function: shoot_till_kill_spell of class  player_type */
+static int toluaI_set_player_player_type_shoot_till_kill_spell(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->shoot_till_kill_spell = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: shoot_till_kill_mimic of class  player_type */
+static int toluaI_get_player_player_type_shoot_till_kill_mimic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->shoot_till_kill_mimic);
+ return 1;
+}
+
+/* set function: shoot_till_kill_mimic of class  player_type */
+static int toluaI_set_player_player_type_shoot_till_kill_mimic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->shoot_till_kill_mimic = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: kills_own of class  player_type */
+static int toluaI_get_player_player_type_kills_own(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->kills_own);
+ return 1;
+}
+
+/* set function: kills_own of class  player_type */
+static int toluaI_set_player_player_type_kills_own(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->kills_own = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: kills of class  player_type */
+static int toluaI_get_player_player_type_kills(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->kills);
+ return 1;
+}
+
+/* set function: kills of class  player_type */
+static int toluaI_set_player_player_type_kills(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->kills = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: kills_lower of class  player_type */
+static int toluaI_get_player_player_type_kills_lower(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->kills_lower);
+ return 1;
+}
+
+/* set function: kills_lower of class  player_type */
+static int toluaI_set_player_player_type_kills_lower(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->kills_lower = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: kills_higher of class  player_type */
+static int toluaI_get_player_player_type_kills_higher(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->kills_higher);
+ return 1;
+}
+
+/* set function: kills_higher of class  player_type */
+static int toluaI_set_player_player_type_kills_higher(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->kills_higher = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: kills_equal of class  player_type */
+static int toluaI_get_player_player_type_kills_equal(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->kills_equal);
+ return 1;
+}
+
+/* set function: kills_equal of class  player_type */
+static int toluaI_set_player_player_type_kills_equal(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->kills_equal = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: free_mimic of class  player_type */
+static int toluaI_get_player_player_type_free_mimic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->free_mimic);
+ return 1;
+}
+
+/* set function: free_mimic of class  player_type */
+static int toluaI_set_player_player_type_free_mimic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->free_mimic = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pvp_prevent_tele of class  player_type */
+static int toluaI_get_player_player_type_pvp_prevent_tele(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pvp_prevent_tele);
+ return 1;
+}
+
+/* set function: pvp_prevent_tele of class  player_type */
+static int toluaI_set_player_player_type_pvp_prevent_tele(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pvp_prevent_tele = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: heal_effect of class  player_type */
+static int toluaI_get_player_player_type_heal_effect(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->heal_effect);
+ return 1;
+}
+
+/* set function: heal_effect of class  player_type */
+static int toluaI_set_player_player_type_heal_effect(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->heal_effect = ((long)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mcharming of class  player_type */
+static int toluaI_get_player_player_type_mcharming(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mcharming);
+ return 1;
+}
+
+/* set function: mcharming of class  player_type */
+static int toluaI_set_player_player_type_mcharming(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mcharming = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: turns_on_floor of class  player_type */
+static int toluaI_get_player_player_type_turns_on_floor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->turns_on_floor);
+ return 1;
+}
+
+/* set function: turns_on_floor of class  player_type */
+static int toluaI_set_player_player_type_turns_on_floor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->turns_on_floor = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dual_mode of class  player_type */
+static int toluaI_get_player_player_type_dual_mode(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dual_mode);
+ return 1;
+}
+
+/* set function: dual_mode of class  player_type */
+static int toluaI_set_player_player_type_dual_mode(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dual_mode = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tim_reflect of class  player_type */
+static int toluaI_get_player_player_type_tim_reflect(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tim_reflect);
+ return 1;
+}
+
+/* set function: tim_reflect of class  player_type */
+static int toluaI_set_player_player_type_tim_reflect(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tim_reflect = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: panel_changed of class  player_type */
+static int toluaI_get_player_player_type_panel_changed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->panel_changed);
+ return 1;
+}
+
+/* set function: panel_changed of class  player_type */
+static int toluaI_set_player_player_type_panel_changed(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->panel_changed = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_bpr of class  player_type */
+static int toluaI_get_player_player_type_warning_bpr(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_bpr);
+ return 1;
+}
+
+/* set function: warning_bpr of class  player_type */
+static int toluaI_set_player_player_type_warning_bpr(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_bpr = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_bpr2 of class  player_type */
+static int toluaI_get_player_player_type_warning_bpr2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_bpr2);
+ return 1;
+}
+
+/* set function: warning_bpr2 of class  player_type */
+static int toluaI_set_player_player_type_warning_bpr2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_bpr2 = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_bpr3 of class  player_type */
+static int toluaI_get_player_player_type_warning_bpr3(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_bpr3);
+ return 1;
+}
+
+/* set function: warning_bpr3 of class  player_type */
+static int toluaI_set_player_player_type_warning_bpr3(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_bpr3 = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_run of class  player_type */
+static int toluaI_get_player_player_type_warning_run(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_run);
+ return 1;
+}
+
+/* set function: warning_run of class  player_type */
+static int toluaI_set_player_player_type_warning_run(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_run = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_run_steps of class  player_type */
+static int toluaI_get_player_player_type_warning_run_steps(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_run_steps);
+ return 1;
+}
+
+/* set function: warning_run_steps of class  player_type */
+static int toluaI_set_player_player_type_warning_run_steps(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_run_steps = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_run_monlos of class  player_type */
+static int toluaI_get_player_player_type_warning_run_monlos(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_run_monlos);
+ return 1;
+}
+
+/* set function: warning_run_monlos of class  player_type */
+static int toluaI_set_player_player_type_warning_run_monlos(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_run_monlos = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_wield of class  player_type */
+static int toluaI_get_player_player_type_warning_wield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_wield);
+ return 1;
+}
+
+/* set function: warning_wield of class  player_type */
+static int toluaI_set_player_player_type_warning_wield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_wield = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_chat of class  player_type */
+static int toluaI_get_player_player_type_warning_chat(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_chat);
+ return 1;
+}
+
+/* set function: warning_chat of class  player_type */
+static int toluaI_set_player_player_type_warning_chat(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_chat = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_lite of class  player_type */
+static int toluaI_get_player_player_type_warning_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_lite);
+ return 1;
+}
+
+/* set function: warning_lite of class  player_type */
+static int toluaI_set_player_player_type_warning_lite(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_lite = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_rest of class  player_type */
+static int toluaI_get_player_player_type_warning_rest(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_rest);
+ return 1;
+}
+
+/* set function: warning_rest of class  player_type */
+static int toluaI_set_player_player_type_warning_rest(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_rest = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_rest_cooldown of class  player_type */
+static int toluaI_get_player_player_type_warning_rest_cooldown(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_rest_cooldown);
+ return 1;
+}
+
+/* set function: warning_rest_cooldown of class  player_type */
+static int toluaI_set_player_player_type_warning_rest_cooldown(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_rest_cooldown = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_mimic of class  player_type */
+static int toluaI_get_player_player_type_warning_mimic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_mimic);
+ return 1;
+}
+
+/* set function: warning_mimic of class  player_type */
+static int toluaI_set_player_player_type_warning_mimic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_mimic = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_dual of class  player_type */
+static int toluaI_get_player_player_type_warning_dual(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_dual);
+ return 1;
+}
+
+/* set function: warning_dual of class  player_type */
+static int toluaI_set_player_player_type_warning_dual(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_dual = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_potions of class  player_type */
+static int toluaI_get_player_player_type_warning_potions(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_potions);
+ return 1;
+}
+
+/* set function: warning_potions of class  player_type */
+static int toluaI_set_player_player_type_warning_potions(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_potions = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_wor of class  player_type */
+static int toluaI_get_player_player_type_warning_wor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_wor);
+ return 1;
+}
+
+/* set function: warning_wor of class  player_type */
+static int toluaI_set_player_player_type_warning_wor(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_wor = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_wor2 of class  player_type */
+static int toluaI_get_player_player_type_warning_wor2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_wor2);
+ return 1;
+}
+
+/* set function: warning_wor2 of class  player_type */
+static int toluaI_set_player_player_type_warning_wor2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_wor2 = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_ghost of class  player_type */
+static int toluaI_get_player_player_type_warning_ghost(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_ghost);
+ return 1;
+}
+
+/* set function: warning_ghost of class  player_type */
+static int toluaI_set_player_player_type_warning_ghost(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_ghost = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_instares of class  player_type */
+static int toluaI_get_player_player_type_warning_instares(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_instares);
+ return 1;
+}
+
+/* set function: warning_instares of class  player_type */
+static int toluaI_set_player_player_type_warning_instares(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_instares = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_ma_weapon of class  player_type */
+static int toluaI_get_player_player_type_warning_ma_weapon(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_ma_weapon);
+ return 1;
+}
+
+/* set function: warning_ma_weapon of class  player_type */
+static int toluaI_set_player_player_type_warning_ma_weapon(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_ma_weapon = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_ma_shield of class  player_type */
+static int toluaI_get_player_player_type_warning_ma_shield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_ma_shield);
+ return 1;
+}
+
+/* set function: warning_ma_shield of class  player_type */
+static int toluaI_set_player_player_type_warning_ma_shield(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_ma_shield = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_repair of class  player_type */
+static int toluaI_get_player_player_type_warning_repair(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_repair);
+ return 1;
+}
+
+/* set function: warning_repair of class  player_type */
+static int toluaI_set_player_player_type_warning_repair(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_repair = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_depth of class  player_type */
+static int toluaI_get_player_player_type_warning_depth(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_depth);
+ return 1;
+}
+
+/* set function: warning_depth of class  player_type */
+static int toluaI_set_player_player_type_warning_depth(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_depth = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: warning_partyexp of class  player_type */
+static int toluaI_get_player_player_type_warning_partyexp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->warning_partyexp);
+ return 1;
+}
+
+/* set function: warning_partyexp of class  player_type */
+static int toluaI_set_player_player_type_warning_partyexp(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->warning_partyexp = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: music_current of class  player_type */
+static int toluaI_get_player_player_type_music_current(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->music_current);
+ return 1;
+}
+
+/* set function: music_current of class  player_type */
+static int toluaI_set_player_player_type_music_current(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->music_current = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: musicalt_current of class  player_type */
+static int toluaI_get_player_player_type_musicalt_current(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->musicalt_current);
+ return 1;
+}
+
+/* set function: musicalt_current of class  player_type */
+static int toluaI_set_player_player_type_musicalt_current(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->musicalt_current = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: musicalt2_current of class  player_type */
+static int toluaI_get_player_player_type_musicalt2_current(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->musicalt2_current);
+ return 1;
+}
+
+/* set function: musicalt2_current of class  player_type */
+static int toluaI_set_player_player_type_musicalt2_current(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->musicalt2_current = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: music_monster of class  player_type */
+static int toluaI_get_player_player_type_music_monster(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->music_monster);
+ return 1;
+}
+
+/* set function: music_monster of class  player_type */
+static int toluaI_set_player_player_type_music_monster(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->music_monster = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: audio_sfx of class  player_type */
+static int toluaI_get_player_player_type_audio_sfx(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->audio_sfx);
+ return 1;
+}
+
+/* set function: audio_sfx of class  player_type */
+static int toluaI_set_player_player_type_audio_sfx(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->audio_sfx = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: audio_mus of class  player_type */
+static int toluaI_get_player_player_type_audio_mus(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->audio_mus);
+ return 1;
+}
+
+/* set function: audio_mus of class  player_type */
+static int toluaI_set_player_player_type_audio_mus(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->audio_mus = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: sound_ambient of class  player_type */
+static int toluaI_get_player_player_type_sound_ambient(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->sound_ambient);
+ return 1;
+}
+
+/* set function: sound_ambient of class  player_type */
+static int toluaI_set_player_player_type_sound_ambient(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->sound_ambient = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: custom_font of class  player_type */
+static int toluaI_get_player_player_type_custom_font(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->custom_font);
+ return 1;
+}
+
+/* set function: custom_font of class  player_type */
+static int toluaI_set_player_player_type_custom_font(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->custom_font = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: admin_stasis of class  player_type */
+static int toluaI_get_player_player_type_admin_stasis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->admin_stasis);
+ return 1;
+}
+
+/* set function: admin_stasis of class  player_type */
+static int toluaI_set_player_player_type_admin_stasis(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->admin_stasis = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: admin_godly_strike of class  player_type */
+static int toluaI_get_player_player_type_admin_godly_strike(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->admin_godly_strike);
+ return 1;
+}
+
+/* set function: admin_godly_strike of class  player_type */
+static int toluaI_set_player_player_type_admin_godly_strike(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->admin_godly_strike = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: admin_set_defeat of class  player_type */
+static int toluaI_get_player_player_type_admin_set_defeat(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->admin_set_defeat);
+ return 1;
+}
+
+/* set function: admin_set_defeat of class  player_type */
+static int toluaI_set_player_player_type_admin_set_defeat(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->admin_set_defeat = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: player_sees_dm of class  player_type */
+static int toluaI_get_player_player_type_player_sees_dm(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->player_sees_dm);
+ return 1;
+}
+
+/* set function: player_sees_dm of class  player_type */
+static int toluaI_set_player_player_type_player_sees_dm(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->player_sees_dm = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: instakills of class  player_type */
+static int toluaI_get_player_player_type_instakills(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->instakills);
+ return 1;
+}
+
+/* set function: instakills of class  player_type */
+static int toluaI_set_player_player_type_instakills(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->instakills = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: go_level of class  player_type */
+static int toluaI_get_player_player_type_go_level(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->go_level);
+ return 1;
+}
+
+/* set function: go_level of class  player_type */
+static int toluaI_set_player_player_type_go_level(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->go_level = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: go_sublevel of class  player_type */
+static int toluaI_get_player_player_type_go_sublevel(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->go_sublevel);
+ return 1;
+}
+
+/* set function: go_sublevel of class  player_type */
+static int toluaI_set_player_player_type_go_sublevel(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->go_sublevel = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: vampiric_melee of class  player_type */
+static int toluaI_get_player_player_type_vampiric_melee(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->vampiric_melee);
+ return 1;
+}
+
+/* set function: vampiric_melee of class  player_type */
+static int toluaI_set_player_player_type_vampiric_melee(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->vampiric_melee = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: vampiric_ranged of class  player_type */
+static int toluaI_get_player_player_type_vampiric_ranged(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->vampiric_ranged);
+ return 1;
+}
+
+/* set function: vampiric_ranged of class  player_type */
+static int toluaI_set_player_player_type_vampiric_ranged(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->vampiric_ranged = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: IDDC_found_rndtown of class  player_type */
+static int toluaI_get_player_player_type_IDDC_found_rndtown(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->IDDC_found_rndtown);
+ return 1;
+}
+
+/* set function: IDDC_found_rndtown of class  player_type */
+static int toluaI_set_player_player_type_IDDC_found_rndtown(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->IDDC_found_rndtown = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: IDDC_logscum of class  player_type */
+static int toluaI_get_player_player_type_IDDC_logscum(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->IDDC_logscum);
+ return 1;
+}
+
+/* set function: IDDC_logscum of class  player_type */
+static int toluaI_set_player_player_type_IDDC_logscum(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->IDDC_logscum = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: IDDC_freepass of class  player_type */
+static int toluaI_get_player_player_type_IDDC_freepass(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->IDDC_freepass);
+ return 1;
+}
+
+/* set function: IDDC_freepass of class  player_type */
+static int toluaI_set_player_player_type_IDDC_freepass(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->IDDC_freepass = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: IDDC_flags of class  player_type */
+static int toluaI_get_player_player_type_IDDC_flags(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->IDDC_flags);
+ return 1;
+}
+
+/* set function: IDDC_flags of class  player_type */
+static int toluaI_set_player_player_type_IDDC_flags(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->IDDC_flags = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: insta_res of class  player_type */
+static int toluaI_get_player_player_type_insta_res(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->insta_res);
+ return 1;
+}
+
+/* set function: insta_res of class  player_type */
+static int toluaI_set_player_player_type_insta_res(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->insta_res = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: hilite_player of class  player_type */
+static int toluaI_get_player_player_type_hilite_player(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->hilite_player);
+ return 1;
+}
+
+/* set function: hilite_player of class  player_type */
+static int toluaI_set_player_player_type_hilite_player(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->hilite_player = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: basic_players_symb of class  player_type */
+static int toluaI_get_player_player_type_basic_players_symb(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->basic_players_symb);
+ return 1;
+}
+
+/* set function: basic_players_symb of class  player_type */
+static int toluaI_set_player_player_type_basic_players_symb(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->basic_players_symb = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: basic_players_col of class  player_type */
+static int toluaI_get_player_player_type_basic_players_col(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->basic_players_col);
+ return 1;
+}
+
+/* set function: basic_players_col of class  player_type */
+static int toluaI_set_player_player_type_basic_players_col(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->basic_players_col = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: distinct_floor_feeling of class  player_type */
+static int toluaI_get_player_player_type_distinct_floor_feeling(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->distinct_floor_feeling);
+ return 1;
+}
+
+/* set function: distinct_floor_feeling of class  player_type */
+static int toluaI_set_player_player_type_distinct_floor_feeling(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->distinct_floor_feeling = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: exp_bar of class  player_type */
+static int toluaI_get_player_player_type_exp_bar(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->exp_bar);
+ return 1;
+}
+
+/* set function: exp_bar of class  player_type */
+static int toluaI_set_player_player_type_exp_bar(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->exp_bar = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: limit_spells of class  player_type */
+static int toluaI_get_player_player_type_limit_spells(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->limit_spells);
+ return 1;
+}
+
+/* set function: limit_spells of class  player_type */
+static int toluaI_set_player_player_type_limit_spells(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->limit_spells = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: temp_misc_1 of class  player_type */
+static int toluaI_get_player_player_type_temp_misc_1(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->temp_misc_1);
+ return 1;
+}
+
+/* set function: temp_misc_1 of class  player_type */
+static int toluaI_set_player_player_type_temp_misc_1(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->temp_misc_1 = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: temp_misc_2 of class  player_type */
+static int toluaI_get_player_player_type_temp_misc_2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->temp_misc_2);
+ return 1;
+}
+
+/* set function: temp_misc_2 of class  player_type */
+static int toluaI_set_player_player_type_temp_misc_2(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->temp_misc_2 = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: temp_misc_3 of class  player_type */
+static int toluaI_get_player_player_type_temp_misc_3(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->temp_misc_3);
+ return 1;
+}
+
+/* set function: temp_misc_3 of class  player_type */
+static int toluaI_set_player_player_type_temp_misc_3(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->temp_misc_3 = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: solo_reking of class  player_type */
+static int toluaI_get_player_player_type_solo_reking(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->solo_reking);
+ return 1;
+}
+
+/* set function: solo_reking of class  player_type */
+static int toluaI_set_player_player_type_solo_reking(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->solo_reking = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: solo_reking_au of class  player_type */
+static int toluaI_get_player_player_type_solo_reking_au(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->solo_reking_au);
+ return 1;
+}
+
+/* set function: solo_reking_au of class  player_type */
+static int toluaI_set_player_player_type_solo_reking_au(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->solo_reking_au = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: solo_reking_laston of class  player_type */
+static int toluaI_get_player_player_type_solo_reking_laston(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->solo_reking_laston,tolua_tag(tolua_S,"time_t"));
+ return 1;
+}
+
+/* set function: solo_reking_laston of class  player_type */
+static int toluaI_set_player_player_type_solo_reking_laston(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"time_t"),0))
+ TOLUA_ERR_ASSIGN;
+  self->solo_reking_laston = *((time_t*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: item_order_store of class  player_type */
+static int toluaI_get_player_player_type_item_order_store(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->item_order_store);
+ return 1;
+}
+
+/* set function: item_order_store of class  player_type */
+static int toluaI_set_player_player_type_item_order_store(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->item_order_store = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: item_order_town of class  player_type */
+static int toluaI_get_player_player_type_item_order_town(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->item_order_town);
+ return 1;
+}
+
+/* set function: item_order_town of class  player_type */
+static int toluaI_set_player_player_type_item_order_town(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->item_order_town = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: item_order_rarity of class  player_type */
+static int toluaI_get_player_player_type_item_order_rarity(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->item_order_rarity);
+ return 1;
+}
+
+/* set function: item_order_rarity of class  player_type */
+static int toluaI_set_player_player_type_item_order_rarity(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->item_order_rarity = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: item_order_forge of class  player_type */
+static int toluaI_get_player_player_type_item_order_forge(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->item_order_forge,tolua_tag(tolua_S,"object_type"));
+ return 1;
+}
+
+/* set function: item_order_forge of class  player_type */
+static int toluaI_set_player_player_type_item_order_forge(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"object_type"),0))
+ TOLUA_ERR_ASSIGN;
+  self->item_order_forge = *((object_type*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: item_order_cost of class  player_type */
+static int toluaI_get_player_player_type_item_order_cost(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->item_order_cost,tolua_tag(tolua_S,"s64b"));
+ return 1;
+}
+
+/* set function: item_order_cost of class  player_type */
+static int toluaI_set_player_player_type_item_order_cost(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"s64b"),0))
+ TOLUA_ERR_ASSIGN;
+  self->item_order_cost = *((s64b*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: item_order_turn of class  player_type */
+static int toluaI_get_player_player_type_item_order_turn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->item_order_turn);
+ return 1;
+}
+
+/* set function: item_order_turn of class  player_type */
+static int toluaI_set_player_player_type_item_order_turn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->item_order_turn = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: iron_trade of class  player_type */
+static int toluaI_get_player_player_type_iron_trade(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->iron_trade);
+ return 1;
+}
+
+/* set function: iron_trade of class  player_type */
+static int toluaI_set_player_player_type_iron_trade(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->iron_trade = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: iron_turn of class  player_type */
+static int toluaI_get_player_player_type_iron_turn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->iron_turn);
+ return 1;
+}
+
+/* set function: iron_turn of class  player_type */
+static int toluaI_set_player_player_type_iron_turn(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->iron_turn = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: font_map_solid_walls of class  player_type */
+static int toluaI_get_player_player_type_font_map_solid_walls(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->font_map_solid_walls);
+ return 1;
+}
+
+/* set function: font_map_solid_walls of class  player_type */
+static int toluaI_set_player_player_type_font_map_solid_walls(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->font_map_solid_walls = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: solid_bars of class  player_type */
+static int toluaI_get_player_player_type_solid_bars(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->solid_bars);
+ return 1;
+}
+
+/* set function: solid_bars of class  player_type */
+static int toluaI_set_player_player_type_solid_bars(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->solid_bars = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: diz_unique of class  player_type */
+static int toluaI_get_player_player_type_diz_unique(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->diz_unique);
+ return 1;
+}
+
+/* set function: diz_unique of class  player_type */
+static int toluaI_set_player_player_type_diz_unique(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->diz_unique = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: diz_death of class  player_type */
+static int toluaI_get_player_player_type_diz_death(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->diz_death);
+ return 1;
+}
+
+/* set function: diz_death of class  player_type */
+static int toluaI_set_player_player_type_diz_death(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->diz_death = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: diz_death_any of class  player_type */
+static int toluaI_get_player_player_type_diz_death_any(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->diz_death_any);
+ return 1;
+}
+
+/* set function: diz_death_any of class  player_type */
+static int toluaI_set_player_player_type_diz_death_any(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->diz_death_any = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: diz_first of class  player_type */
+static int toluaI_get_player_player_type_diz_first(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->diz_first);
+ return 1;
+}
+
+/* set function: diz_first of class  player_type */
+static int toluaI_set_player_player_type_diz_first(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->diz_first = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: palette_animation of class  player_type */
+static int toluaI_get_player_player_type_palette_animation(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->palette_animation);
+ return 1;
+}
+
+/* set function: palette_animation of class  player_type */
+static int toluaI_set_player_player_type_palette_animation(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->palette_animation = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mute_when_idle of class  player_type */
+static int toluaI_get_player_player_type_mute_when_idle(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mute_when_idle);
+ return 1;
+}
+
+/* set function: mute_when_idle of class  player_type */
+static int toluaI_set_player_player_type_mute_when_idle(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mute_when_idle = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: censor_swearing of class  player_type */
+static int toluaI_get_player_player_type_censor_swearing(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->censor_swearing);
+ return 1;
+}
+
+/* set function: censor_swearing of class  player_type */
+static int toluaI_set_player_player_type_censor_swearing(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->censor_swearing = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: keep_bottle of class  player_type */
+static int toluaI_get_player_player_type_keep_bottle(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->keep_bottle);
+ return 1;
+}
+
+/* set function: keep_bottle of class  player_type */
+static int toluaI_set_player_player_type_keep_bottle(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->keep_bottle = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: no_house_magic of class  player_type */
+static int toluaI_get_player_player_type_no_house_magic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->no_house_magic);
+ return 1;
+}
+
+/* set function: no_house_magic of class  player_type */
+static int toluaI_set_player_player_type_no_house_magic(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->no_house_magic = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: steamblast of class  player_type */
+static int toluaI_get_player_player_type_steamblast(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->steamblast);
+ return 1;
+}
+
+/* set function: steamblast of class  player_type */
+static int toluaI_set_player_player_type_steamblast(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->steamblast = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: player_list_window of class  player_type */
+static int toluaI_get_player_player_type_player_list_window(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->player_list_window);
+ return 1;
+}
+
+/* set function: player_list_window of class  player_type */
+static int toluaI_set_player_player_type_player_list_window(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->player_list_window = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: item_newest of class  player_type */
+static int toluaI_get_player_player_type_item_newest(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->item_newest);
+ return 1;
+}
+
+/* set function: item_newest of class  player_type */
+static int toluaI_set_player_player_type_item_newest(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->item_newest = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: item_newest_2nd of class  player_type */
+static int toluaI_get_player_player_type_item_newest_2nd(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->item_newest_2nd);
+ return 1;
+}
+
+/* set function: item_newest_2nd of class  player_type */
+static int toluaI_set_player_player_type_item_newest_2nd(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->item_newest_2nd = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: add_kind_diz of class  player_type */
+static int toluaI_get_player_player_type_add_kind_diz(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->add_kind_diz);
+ return 1;
+}
+
+/* set function: add_kind_diz of class  player_type */
+static int toluaI_set_player_player_type_add_kind_diz(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->add_kind_diz = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: hide_lore_paste of class  player_type */
+static int toluaI_get_player_player_type_hide_lore_paste(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->hide_lore_paste);
+ return 1;
+}
+
+/* set function: hide_lore_paste of class  player_type */
+static int toluaI_set_player_player_type_hide_lore_paste(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->hide_lore_paste = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: new_retaliator of class  player_type */
+static int toluaI_get_player_player_type_new_retaliator(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->new_retaliator);
+ return 1;
+}
+
+/* set function: new_retaliator of class  player_type */
+static int toluaI_set_player_player_type_new_retaliator(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->new_retaliator = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: sunburn_msg of class  player_type */
+static int toluaI_get_player_player_type_sunburn_msg(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->sunburn_msg);
+ return 1;
+}
+
+/* set function: sunburn_msg of class  player_type */
+static int toluaI_set_player_player_type_sunburn_msg(lua_State* tolua_S)
+{
+  player_type* self = (player_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->sunburn_msg = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* function: imprison */
+static int toluaI_player_imprison00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int time = ((int)  tolua_getnumber(tolua_S,2,0));
+  char* reason = ((char*)  tolua_getstring(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  imprison(Ind,time,reason);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'imprison'.");
+ return 0;
+}
+
+/* function: check_antimagic */
+static int toluaI_player_check_antimagic00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int percentage = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  check_antimagic(Ind,percentage);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'check_antimagic'.");
+ return 0;
+}
+
+/* get function: NumPlayers */
+static int toluaI_get_player_NumPlayers(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)NumPlayers);
+ return 1;
+}
+
+/* set function: NumPlayers */
+static int toluaI_set_player_NumPlayers(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  NumPlayers = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: Players */
+static int toluaI_get_player_Players_real(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=0xFFFFF)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)Players[toluaI_index],tolua_tag(tolua_S,"player_type"));
+ return 1;
+}
+
+/* set function: Players */
+static int toluaI_set_player_Players_real(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=0xFFFFF)
+ tolua_error(tolua_S,"array indexing out of range.");
+  Players[toluaI_index] = ((player_type*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* function: get_playerind */
+static int toluaI_player_get_playerind00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  char* name = ((char*)  tolua_getstring(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  get_playerind(name);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'get_playerind'.");
+ return 0;
+}
+
+/* function: get_playerind_loose */
+static int toluaI_player_get_playerind_loose00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  char* name = ((char*)  tolua_getstring(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  get_playerind_loose(name);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'get_playerind_loose'.");
+ return 0;
+}
+
+/* function: get_playerslot_loose */
+static int toluaI_player_get_playerslot_loose00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  char* iname = ((char*)  tolua_getstring(tolua_S,2,0));
+ {
+  int toluaI_ret = (int)  get_playerslot_loose(Ind,iname);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'get_playerslot_loose'.");
+ return 0;
+}
+
+/* function: no_lite */
+static int toluaI_player_no_lite00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  no_lite(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'no_lite'.");
+ return 0;
+}
+
+/* function: can_use */
+static int toluaI_player_can_use00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,tolua_tag(tolua_S,"object_type"),0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  object_type* o_ptr = ((object_type*)  tolua_getusertype(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  can_use(Ind,o_ptr);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'can_use'.");
+ return 0;
+}
+
+/* function: can_use_verbose */
+static int toluaI_player_can_use_verbose00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,tolua_tag(tolua_S,"object_type"),0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  object_type* o_ptr = ((object_type*)  tolua_getusertype(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  can_use_verbose(Ind,o_ptr);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'can_use_verbose'.");
+ return 0;
+}
+
+/* function: interfere */
+static int toluaI_player_interfere00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int chance = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  interfere(Ind,chance);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'interfere'.");
+ return 0;
+}
+
+/* function: telekinesis */
+static int toluaI_player_telekinesis00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,tolua_tag(tolua_S,"object_type"),0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  object_type* o_ptr = ((object_type*)  tolua_getusertype(tolua_S,2,0));
+  int max_weight = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  telekinesis(Ind,o_ptr,max_weight);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'telekinesis'.");
+ return 0;
+}
+
+/* function: telekinesis_aux */
+static int toluaI_player_telekinesis_aux00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int item = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  telekinesis_aux(Ind,item);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'telekinesis_aux'.");
+ return 0;
+}
+
+/* function: recall_player */
+static int toluaI_player_recall_player00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  char* message = ((char*)  tolua_getstring(tolua_S,2,0));
+ {
+  recall_player(Ind,message);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'recall_player'.");
+ return 0;
+}
+
+/* function: apply_dodge_chance */
+static int toluaI_player_apply_dodge_chance00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int attack_level = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  int toluaI_ret = (int)  apply_dodge_chance(Ind,attack_level);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'apply_dodge_chance'.");
+ return 0;
+}
+
+/* function: respec_skill */
+static int toluaI_player_respec_skill00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int i = ((int)  tolua_getnumber(tolua_S,2,0));
+  bool update_skill = ((bool)  tolua_getnumber(tolua_S,3,0));
+  bool polymorph = ((bool)  tolua_getnumber(tolua_S,4,0));
+ {
+  respec_skill(Ind,i,update_skill,polymorph);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'respec_skill'.");
+ return 0;
+}
+
+/* function: respec_skills */
+static int toluaI_player_respec_skills00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  bool update_skills = ((bool)  tolua_getnumber(tolua_S,2,0));
+ {
+  respec_skills(Ind,update_skills);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'respec_skills'.");
+ return 0;
+}
+
+/* function: invested_skill_points */
+static int toluaI_player_invested_skill_points00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int i = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  int toluaI_ret = (int)  invested_skill_points(Ind,i);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'invested_skill_points'.");
+ return 0;
+}
+
+/* function: get_inven_sval */
+static int toluaI_player_get_inven_sval00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int inven_slot = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  int toluaI_ret = (int)  get_inven_sval(Ind,inven_slot);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'get_inven_sval'.");
+ return 0;
+}
+
+/* function: get_inven_xtra */
+static int toluaI_player_get_inven_xtra00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int inven_slot = ((int)  tolua_getnumber(tolua_S,2,0));
+  int n = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  int toluaI_ret = (int)  get_inven_xtra(Ind,inven_slot,n);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'get_inven_xtra'.");
+ return 0;
+}
+
+/* get function: title of class  player_race */
+static int toluaI_get_player_player_race_title(lua_State* tolua_S)
+{
+  player_race* self = (player_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->title);
+ return 1;
+}
+
+/* set function: title of class  player_race */
+static int toluaI_set_player_player_race_title(lua_State* tolua_S)
+{
+  player_race* self = (player_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->title = ((cptr)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: choice of class  player_race */
+static int toluaI_get_player_player_race_choice(lua_State* tolua_S)
+{
+  player_race* self = (player_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->choice);
+ return 1;
+}
+
+/* set function: choice of class  player_race */
+static int toluaI_set_player_player_race_choice(lua_State* tolua_S)
+{
+  player_race* self = (player_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->choice = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: race_info */
+static int toluaI_get_player_race_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_RACE)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&race_info[toluaI_index],tolua_tag(tolua_S,"player_race"));
+ return 1;
+}
+
+/* set function: race_info */
+static int toluaI_set_player_race_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_RACE)
+ tolua_error(tolua_S,"array indexing out of range.");
+  race_info[toluaI_index] = *((player_race*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: title of class  player_class */
+static int toluaI_get_player_player_class_title(lua_State* tolua_S)
+{
+  player_class* self = (player_class*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->title);
+ return 1;
+}
+
+/* set function: title of class  player_class */
+static int toluaI_set_player_player_class_title(lua_State* tolua_S)
+{
+  player_class* self = (player_class*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->title = ((cptr)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: color of class  player_class */
+static int toluaI_get_player_player_class_color(lua_State* tolua_S)
+{
+  player_class* self = (player_class*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->color);
+ return 1;
+}
+
+/* set function: color of class  player_class */
+static int toluaI_set_player_player_class_color(lua_State* tolua_S)
+{
+  player_class* self = (player_class*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->color = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: class_info */
+static int toluaI_get_player_class_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_CLASS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&class_info[toluaI_index],tolua_tag(tolua_S,"player_class"));
+ return 1;
+}
+
+/* set function: class_info */
+static int toluaI_set_player_class_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_CLASS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  class_info[toluaI_index] = *((player_class*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: title of class  player_trait */
+static int toluaI_get_player_player_trait_title(lua_State* tolua_S)
+{
+  player_trait* self = (player_trait*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->title);
+ return 1;
+}
+
+/* set function: title of class  player_trait */
+static int toluaI_set_player_player_trait_title(lua_State* tolua_S)
+{
+  player_trait* self = (player_trait*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->title = ((cptr)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: choice of class  player_trait */
+static int toluaI_get_player_player_trait_choice(lua_State* tolua_S)
+{
+  player_trait* self = (player_trait*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->choice);
+ return 1;
+}
+
+/* set function: choice of class  player_trait */
+static int toluaI_set_player_player_trait_choice(lua_State* tolua_S)
+{
+  player_trait* self = (player_trait*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->choice = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: trait_info */
+static int toluaI_get_player_trait_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_TRAIT)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&trait_info[toluaI_index],tolua_tag(tolua_S,"player_trait"));
+ return 1;
+}
+
+/* set function: trait_info */
+static int toluaI_set_player_trait_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_TRAIT)
+ tolua_error(tolua_S,"array indexing out of range.");
+  trait_info[toluaI_index] = *((player_trait*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* function: do_mimic_change */
+static int toluaI_player_do_mimic_change00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int r_idx = ((int)  tolua_getnumber(tolua_S,2,0));
+  bool force = ((bool)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  do_mimic_change(Ind,r_idx,force);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_mimic_change'.");
+ return 0;
+}
+
+/* function: shape_Maia_skills */
+static int toluaI_player_shape_Maia_skills00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  bool live = ((bool)  tolua_getnumber(tolua_S,2,0));
+ {
+  shape_Maia_skills(Ind,live);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'shape_Maia_skills'.");
+ return 0;
+}
+
+/* function: gain_exp */
+static int toluaI_player_gain_exp00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int amount = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  gain_exp(Ind,amount);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'gain_exp'.");
+ return 0;
+}
+
+/* function: lua_fix_max_depth */
+static int toluaI_player_lua_fix_max_depth00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_fix_max_depth(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_fix_max_depth'.");
+ return 0;
+}
+
+/* function: lua_fix_max_depth_bug */
+static int toluaI_player_lua_fix_max_depth_bug00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_fix_max_depth_bug(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_fix_max_depth_bug'.");
+ return 0;
+}
+
+/* function: lua_fix_acc_house_limit */
+static int toluaI_player_lua_fix_acc_house_limit00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_fix_acc_house_limit(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_fix_acc_house_limit'.");
+ return 0;
+}
+
+/* function: lua_wish */
+static int toluaI_player_lua_wish00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,8,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,9,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,10,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,11)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int tval = ((int)  tolua_getnumber(tolua_S,2,0));
+  int sval = ((int)  tolua_getnumber(tolua_S,3,0));
+  int number = ((int)  tolua_getnumber(tolua_S,4,0));
+  int bpval = ((int)  tolua_getnumber(tolua_S,5,0));
+  int pval = ((int)  tolua_getnumber(tolua_S,6,0));
+  int name1 = ((int)  tolua_getnumber(tolua_S,7,0));
+  int name2 = ((int)  tolua_getnumber(tolua_S,8,0));
+  int name2b = ((int)  tolua_getnumber(tolua_S,9,0));
+  int level = ((int)  tolua_getnumber(tolua_S,10,0));
+ {
+  lua_wish(Ind,tval,sval,number,bpval,pval,name1,name2,name2b,level);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_wish'.");
+ return 0;
+}
+
+/* get function: player_id */
+static int toluaI_get_player_player_id(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)player_id);
+ return 1;
+}
+
+/* set function: player_id */
+static int toluaI_set_player_player_id(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  player_id = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: account_id */
+static int toluaI_get_player_account_id(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)account_id);
+ return 1;
+}
+
+/* set function: account_id */
+static int toluaI_set_player_account_id(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  account_id = ((u32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* function: disturb */
+static int toluaI_player_disturb00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int stop_search = ((int)  tolua_getnumber(tolua_S,2,0));
+  int keep_resting = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  disturb(Ind,stop_search,keep_resting);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'disturb'.");
+ return 0;
+}
+
+/* function: lua_get_subinven_item */
+static int toluaI_player_lua_get_subinven_item00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int inven = ((int)  tolua_getnumber(tolua_S,2,0));
+  int subinven = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  object_type toluaI_ret = (object_type)  lua_get_subinven_item(Ind,inven,subinven);
+ {
+#ifdef __cplusplus
+ void* toluaI_clone = new object_type(toluaI_ret);
+#else
+ void* toluaI_clone = tolua_copy(tolua_S,(void*)&toluaI_ret,sizeof(object_type));
+#endif
+ tolua_pushusertype(tolua_S,tolua_doclone(tolua_S,toluaI_clone,tolua_tag(tolua_S,"object_type")),tolua_tag(tolua_S,"object_type"));
+ }
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_get_subinven_item'.");
+ return 0;
+}
+
+/* function: gain_exp_to_level */
+static int toluaI_player_gain_exp_to_level00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int level = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  gain_exp_to_level(Ind,level);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'gain_exp_to_level'.");
+ return 0;
+}
+
+/* Open function */
+int tolua_player_open (lua_State* tolua_S)
+{
+ tolua_open(tolua_S);
+ toluaI_reg_types(tolua_S);
+ tolua_constant(tolua_S,NULL,"PW_PLAYER",PW_PLAYER);
+ tolua_constant(tolua_S,NULL,"PY_FOOD_MAX",PY_FOOD_MAX);
+ tolua_constant(tolua_S,NULL,"PY_FOOD_FULL",PY_FOOD_FULL);
+ tolua_constant(tolua_S,NULL,"INVEN_PACK",INVEN_PACK);
+ tolua_constant(tolua_S,NULL,"INVEN_WIELD",INVEN_WIELD);
+ tolua_constant(tolua_S,NULL,"INVEN_TOTAL",INVEN_TOTAL);
+ tolua_constant(tolua_S,NULL,"A_STR",A_STR);
+ tolua_constant(tolua_S,NULL,"A_INT",A_INT);
+ tolua_constant(tolua_S,NULL,"A_WIS",A_WIS);
+ tolua_constant(tolua_S,NULL,"A_DEX",A_DEX);
+ tolua_constant(tolua_S,NULL,"A_CON",A_CON);
+ tolua_constant(tolua_S,NULL,"A_CHR",A_CHR);
+ tolua_constant(tolua_S,NULL,"RACE_HUMAN",RACE_HUMAN);
+ tolua_constant(tolua_S,NULL,"RACE_HALF_ELF",RACE_HALF_ELF);
+ tolua_constant(tolua_S,NULL,"RACE_ELF",RACE_ELF);
+ tolua_constant(tolua_S,NULL,"RACE_HOBBIT",RACE_HOBBIT);
+ tolua_constant(tolua_S,NULL,"RACE_GNOME",RACE_GNOME);
+ tolua_constant(tolua_S,NULL,"RACE_DWARF",RACE_DWARF);
+ tolua_constant(tolua_S,NULL,"RACE_HALF_ORC",RACE_HALF_ORC);
+ tolua_constant(tolua_S,NULL,"RACE_HALF_TROLL",RACE_HALF_TROLL);
+ tolua_constant(tolua_S,NULL,"RACE_DUNADAN",RACE_DUNADAN);
+ tolua_constant(tolua_S,NULL,"RACE_HIGH_ELF",RACE_HIGH_ELF);
+ tolua_constant(tolua_S,NULL,"RACE_YEEK",RACE_YEEK);
+ tolua_constant(tolua_S,NULL,"RACE_GOBLIN",RACE_GOBLIN);
+ tolua_constant(tolua_S,NULL,"RACE_ENT",RACE_ENT);
+ tolua_constant(tolua_S,NULL,"RACE_DRACONIAN",RACE_DRACONIAN);
+ tolua_constant(tolua_S,NULL,"RACE_KOBOLD",RACE_KOBOLD);
+ tolua_constant(tolua_S,NULL,"RACE_DARK_ELF",RACE_DARK_ELF);
+ tolua_constant(tolua_S,NULL,"RACE_VAMPIRE",RACE_VAMPIRE);
+ tolua_constant(tolua_S,NULL,"RACE_MAIA",RACE_MAIA);
+ tolua_constant(tolua_S,NULL,"CLASS_WARRIOR",CLASS_WARRIOR);
+ tolua_constant(tolua_S,NULL,"CLASS_MAGE",CLASS_MAGE);
+ tolua_constant(tolua_S,NULL,"CLASS_PRIEST",CLASS_PRIEST);
+ tolua_constant(tolua_S,NULL,"CLASS_ROGUE",CLASS_ROGUE);
+ tolua_constant(tolua_S,NULL,"CLASS_MIMIC",CLASS_MIMIC);
+ tolua_constant(tolua_S,NULL,"CLASS_ARCHER",CLASS_ARCHER);
+ tolua_constant(tolua_S,NULL,"CLASS_PALADIN",CLASS_PALADIN);
+ tolua_constant(tolua_S,NULL,"CLASS_RANGER",CLASS_RANGER);
+ tolua_constant(tolua_S,NULL,"CLASS_ADVENTURER",CLASS_ADVENTURER);
+ tolua_constant(tolua_S,NULL,"CLASS_DRUID",CLASS_DRUID);
+ tolua_constant(tolua_S,NULL,"CLASS_SHAMAN",CLASS_SHAMAN);
+ tolua_constant(tolua_S,NULL,"CLASS_RUNEMASTER",CLASS_RUNEMASTER);
+ tolua_constant(tolua_S,NULL,"CLASS_MINDCRAFTER",CLASS_MINDCRAFTER);
+ tolua_constant(tolua_S,NULL,"CLASS_DEATHKNIGHT",CLASS_DEATHKNIGHT);
+ tolua_constant(tolua_S,NULL,"CLASS_HELLKNIGHT",CLASS_HELLKNIGHT);
+ tolua_constant(tolua_S,NULL,"CLASS_CPRIEST",CLASS_CPRIEST);
+ tolua_constant(tolua_S,NULL,"TRAIT_ENLIGHTENED",TRAIT_ENLIGHTENED);
+ tolua_constant(tolua_S,NULL,"TRAIT_CORRUPTED",TRAIT_CORRUPTED);
+ tolua_constant(tolua_S,NULL,"SKILL_MAX",SKILL_MAX);
+ tolua_constant(tolua_S,NULL,"SKILL_STEP",SKILL_STEP);
+ tolua_constant(tolua_S,NULL,"SKILL_EXCLUSIVE",SKILL_EXCLUSIVE);
+ tolua_constant(tolua_S,NULL,"SKILL_COMBAT",SKILL_COMBAT);
+ tolua_constant(tolua_S,NULL,"SKILL_MASTERY",SKILL_MASTERY);
+ tolua_constant(tolua_S,NULL,"SKILL_SWORD",SKILL_SWORD);
+ tolua_constant(tolua_S,NULL,"SKILL_CRITS",SKILL_CRITS);
+ tolua_constant(tolua_S,NULL,"SKILL_POLEARM",SKILL_POLEARM);
+ tolua_constant(tolua_S,NULL,"SKILL_BLUNT",SKILL_BLUNT);
+ tolua_constant(tolua_S,NULL,"SKILL_ARCHERY",SKILL_ARCHERY);
+ tolua_constant(tolua_S,NULL,"SKILL_SLING",SKILL_SLING);
+ tolua_constant(tolua_S,NULL,"SKILL_BOW",SKILL_BOW);
+ tolua_constant(tolua_S,NULL,"SKILL_XBOW",SKILL_XBOW);
+ tolua_constant(tolua_S,NULL,"SKILL_BACKSTAB",SKILL_BACKSTAB);
+ tolua_constant(tolua_S,NULL,"SKILL_MAGIC",SKILL_MAGIC);
+ tolua_constant(tolua_S,NULL,"SKILL_SHOOT_TILL_KILL",SKILL_SHOOT_TILL_KILL);
+ tolua_constant(tolua_S,NULL,"SKILL_SORCERY",SKILL_SORCERY);
+ tolua_constant(tolua_S,NULL,"SKILL_MAGERY",SKILL_MAGERY);
+ tolua_constant(tolua_S,NULL,"SKILL_MIMIC",SKILL_MIMIC);
+ tolua_constant(tolua_S,NULL,"SKILL_DEVICE",SKILL_DEVICE);
+ tolua_constant(tolua_S,NULL,"SKILL_SHADOW",SKILL_SHADOW);
+ tolua_constant(tolua_S,NULL,"SKILL_PRAY",SKILL_PRAY);
+ tolua_constant(tolua_S,NULL,"SKILL_SPELLLENGTH",SKILL_SPELLLENGTH);
+ tolua_constant(tolua_S,NULL,"SKILL_SNEAKINESS",SKILL_SNEAKINESS);
+ tolua_constant(tolua_S,NULL,"SKILL_DISARM",SKILL_DISARM);
+ tolua_constant(tolua_S,NULL,"SKILL_STEALTH",SKILL_STEALTH);
+ tolua_constant(tolua_S,NULL,"SKILL_STEALING",SKILL_STEALING);
+ tolua_constant(tolua_S,NULL,"SKILL_NECROMANCY",SKILL_NECROMANCY);
+ tolua_constant(tolua_S,NULL,"SKILL_ANTIMAGIC",SKILL_ANTIMAGIC);
+ tolua_constant(tolua_S,NULL,"SKILL_TRAUMATURGY",SKILL_TRAUMATURGY);
+ tolua_constant(tolua_S,NULL,"SKILL_AURA_FEAR",SKILL_AURA_FEAR);
+ tolua_constant(tolua_S,NULL,"SKILL_AURA_SHIVER",SKILL_AURA_SHIVER);
+ tolua_constant(tolua_S,NULL,"SKILL_AURA_DEATH",SKILL_AURA_DEATH);
+ tolua_constant(tolua_S,NULL,"SKILL_HUNTING",SKILL_HUNTING);
+ tolua_constant(tolua_S,NULL,"SKILL_TECHNIQUE",SKILL_TECHNIQUE);
+ tolua_constant(tolua_S,NULL,"SKILL_MISC",SKILL_MISC);
+ tolua_constant(tolua_S,NULL,"SKILL_AGILITY",SKILL_AGILITY);
+ tolua_constant(tolua_S,NULL,"SKILL_CALMNESS",SKILL_CALMNESS);
+ tolua_constant(tolua_S,NULL,"SKILL_SWIM",SKILL_SWIM);
+ tolua_constant(tolua_S,NULL,"SKILL_MARTIAL_ARTS",SKILL_MARTIAL_ARTS);
+ tolua_constant(tolua_S,NULL,"SKILL_RICOCHET",SKILL_RICOCHET);
+ tolua_constant(tolua_S,NULL,"SKILL_BOOMERANG",SKILL_BOOMERANG);
+ tolua_constant(tolua_S,NULL,"SKILL_TRAINING",SKILL_TRAINING);
+ tolua_constant(tolua_S,NULL,"SKILL_INTERCEPT",SKILL_INTERCEPT);
+ tolua_constant(tolua_S,NULL,"SKILL_DODGE",SKILL_DODGE);
+ tolua_constant(tolua_S,NULL,"SKILL_HEALTH",SKILL_HEALTH);
+ tolua_constant(tolua_S,NULL,"SKILL_DIG",SKILL_DIG);
+ tolua_constant(tolua_S,NULL,"SKILL_SPELLRAD",SKILL_SPELLRAD);
+ tolua_constant(tolua_S,NULL,"SKILL_TRAPPING",SKILL_TRAPPING);
+ tolua_constant(tolua_S,NULL,"SKILL_AXE",SKILL_AXE);
+ tolua_constant(tolua_S,NULL,"SKILL_CONVEYANCE",SKILL_CONVEYANCE);
+ tolua_constant(tolua_S,NULL,"SKILL_SPELL",SKILL_SPELL);
+ tolua_constant(tolua_S,NULL,"SKILL_MANA",SKILL_MANA);
+ tolua_constant(tolua_S,NULL,"SKILL_FIRE",SKILL_FIRE);
+ tolua_constant(tolua_S,NULL,"SKILL_AIR",SKILL_AIR);
+ tolua_constant(tolua_S,NULL,"SKILL_WATER",SKILL_WATER);
+ tolua_constant(tolua_S,NULL,"SKILL_NATURE",SKILL_NATURE);
+ tolua_constant(tolua_S,NULL,"SKILL_EARTH",SKILL_EARTH);
+ tolua_constant(tolua_S,NULL,"SKILL_DIVINATION",SKILL_DIVINATION);
+ tolua_constant(tolua_S,NULL,"SKILL_TEMPORAL",SKILL_TEMPORAL);
+ tolua_constant(tolua_S,NULL,"SKILL_META",SKILL_META);
+ tolua_constant(tolua_S,NULL,"SKILL_MIND",SKILL_MIND);
+ tolua_constant(tolua_S,NULL,"SKILL_UDUN",SKILL_UDUN);
+ tolua_constant(tolua_S,NULL,"SKILL_SCHOOL_CRAFTING",SKILL_SCHOOL_CRAFTING);
+ tolua_constant(tolua_S,NULL,"SKILL_WEAPONSMITHING",SKILL_WEAPONSMITHING);
+ tolua_constant(tolua_S,NULL,"SKILL_ARMOURSMITHING",SKILL_ARMOURSMITHING);
+ tolua_constant(tolua_S,NULL,"SKILL_FLETCHING",SKILL_FLETCHING);
+ tolua_constant(tolua_S,NULL,"SKILL_JEWELCRAFT",SKILL_JEWELCRAFT);
+ tolua_constant(tolua_S,NULL,"SKILL_TOOLCRAFT",SKILL_TOOLCRAFT);
+ tolua_constant(tolua_S,NULL,"SKILL_TAILORING",SKILL_TAILORING);
+ tolua_constant(tolua_S,NULL,"SKILL_ALCHEMY",SKILL_ALCHEMY);
+ tolua_constant(tolua_S,NULL,"SKILL_ENCHANTING",SKILL_ENCHANTING);
+ tolua_constant(tolua_S,NULL,"SKILL_HOFFENSE",SKILL_HOFFENSE);
+ tolua_constant(tolua_S,NULL,"SKILL_HDEFENSE",SKILL_HDEFENSE);
+ tolua_constant(tolua_S,NULL,"SKILL_HCURING",SKILL_HCURING);
+ tolua_constant(tolua_S,NULL,"SKILL_HSUPPORT",SKILL_HSUPPORT);
+ tolua_constant(tolua_S,NULL,"SKILL_DRUID_ARCANE",SKILL_DRUID_ARCANE);
+ tolua_constant(tolua_S,NULL,"SKILL_DRUID_PHYSICAL",SKILL_DRUID_PHYSICAL);
+ tolua_constant(tolua_S,NULL,"SKILL_ASTRAL",SKILL_ASTRAL);
+ tolua_constant(tolua_S,NULL,"SKILL_DUAL",SKILL_DUAL);
+ tolua_constant(tolua_S,NULL,"SKILL_STANCE",SKILL_STANCE);
+ tolua_constant(tolua_S,NULL,"SKILL_PPOWER",SKILL_PPOWER);
+ tolua_constant(tolua_S,NULL,"SKILL_ATTUNEMENT",SKILL_ATTUNEMENT);
+ tolua_constant(tolua_S,NULL,"SKILL_MINTRUSION",SKILL_MINTRUSION);
+ tolua_constant(tolua_S,NULL,"SKILL_SCHOOL_MAGIC",SKILL_SCHOOL_MAGIC);
+ tolua_constant(tolua_S,NULL,"SKILL_SCHOOL_PRAYING",SKILL_SCHOOL_PRAYING);
+ tolua_constant(tolua_S,NULL,"SKILL_SCHOOL_DRUIDISM",SKILL_SCHOOL_DRUIDISM);
+ tolua_constant(tolua_S,NULL,"SKILL_SCHOOL_MINDCRAFT",SKILL_SCHOOL_MINDCRAFT);
+ tolua_constant(tolua_S,NULL,"SKILL_OSHADOW",SKILL_OSHADOW);
+ tolua_constant(tolua_S,NULL,"SKILL_OSPIRIT",SKILL_OSPIRIT);
+ tolua_constant(tolua_S,NULL,"SKILL_SCHOOL_OCCULT",SKILL_SCHOOL_OCCULT);
+ tolua_constant(tolua_S,NULL,"SKILL_OHERETICISM",SKILL_OHERETICISM);
+ tolua_constant(tolua_S,NULL,"SKILL_OUNLIFE",SKILL_OUNLIFE);
+ tolua_constant(tolua_S,NULL,"SKILL_CLIMB",SKILL_CLIMB);
+ tolua_constant(tolua_S,NULL,"SKILL_LEVITATE",SKILL_LEVITATE);
+ tolua_constant(tolua_S,NULL,"SKILL_FREEACT",SKILL_FREEACT);
+ tolua_constant(tolua_S,NULL,"SKILL_RESCONF",SKILL_RESCONF);
+ tolua_constant(tolua_S,NULL,"SKILL_SCHOOL_RUNECRAFT",SKILL_SCHOOL_RUNECRAFT);
+ tolua_constant(tolua_S,NULL,"SKILL_R_LITE",SKILL_R_LITE);
+ tolua_constant(tolua_S,NULL,"SKILL_R_DARK",SKILL_R_DARK);
+ tolua_constant(tolua_S,NULL,"SKILL_R_NEXU",SKILL_R_NEXU);
+ tolua_constant(tolua_S,NULL,"SKILL_R_NETH",SKILL_R_NETH);
+ tolua_constant(tolua_S,NULL,"SKILL_R_CHAO",SKILL_R_CHAO);
+ tolua_constant(tolua_S,NULL,"SKILL_R_MANA",SKILL_R_MANA);
+ tolua_constant(tolua_S,NULL,"SKILL_SOULFEASTING",SKILL_SOULFEASTING);
+ tolua_constant(tolua_S,NULL,"SKILL_SUMMONING",SKILL_SUMMONING);
+ tolua_constant(tolua_S,NULL,"SKILL_TAMING",SKILL_TAMING);
+ tolua_constant(tolua_S,NULL,"SKILL_BLOOD_MAGIC",SKILL_BLOOD_MAGIC);
+ tolua_constant(tolua_S,NULL,"SKILL_BREATH",SKILL_BREATH);
+ tolua_constant(tolua_S,NULL,"SKILL_PICK_BREATH",SKILL_PICK_BREATH);
+ tolua_constant(tolua_S,NULL,"MAX_SKILLS",MAX_SKILLS);
+ tolua_cclass(tolua_S,"worldpos","");
+ tolua_tablevar(tolua_S,"worldpos","wx",toluaI_get_player_worldpos_wx,toluaI_set_player_worldpos_wx);
+ tolua_tablevar(tolua_S,"worldpos","wy",toluaI_get_player_worldpos_wy,toluaI_set_player_worldpos_wy);
+ tolua_tablevar(tolua_S,"worldpos","wz",toluaI_get_player_worldpos_wz,toluaI_set_player_worldpos_wz);
+ tolua_cclass(tolua_S,"object_type","");
+ tolua_tablevar(tolua_S,"object_type","mode",toluaI_get_player_object_type_mode,toluaI_set_player_object_type_mode);
+ tolua_tablevar(tolua_S,"object_type","owner",toluaI_get_player_object_type_owner,toluaI_set_player_object_type_owner);
+ tolua_tablevar(tolua_S,"object_type","level",toluaI_get_player_object_type_level,toluaI_set_player_object_type_level);
+ tolua_tablevar(tolua_S,"object_type","k_idx",toluaI_get_player_object_type_k_idx,toluaI_set_player_object_type_k_idx);
+ tolua_tablevar(tolua_S,"object_type","iy",toluaI_get_player_object_type_iy,toluaI_set_player_object_type_iy);
+ tolua_tablevar(tolua_S,"object_type","ix",toluaI_get_player_object_type_ix,toluaI_set_player_object_type_ix);
+ tolua_tablevar(tolua_S,"object_type","wpos",toluaI_get_player_object_type_wpos,toluaI_set_player_object_type_wpos);
+ tolua_tablevar(tolua_S,"object_type","tval",toluaI_get_player_object_type_tval,toluaI_set_player_object_type_tval);
+ tolua_tablevar(tolua_S,"object_type","sval",toluaI_get_player_object_type_sval,toluaI_set_player_object_type_sval);
+ tolua_tablevar(tolua_S,"object_type","tval2",toluaI_get_player_object_type_tval2,toluaI_set_player_object_type_tval2);
+ tolua_tablevar(tolua_S,"object_type","sval2",toluaI_get_player_object_type_sval2,toluaI_set_player_object_type_sval2);
+ tolua_tablevar(tolua_S,"object_type","bpval",toluaI_get_player_object_type_bpval,toluaI_set_player_object_type_bpval);
+ tolua_tablevar(tolua_S,"object_type","pval",toluaI_get_player_object_type_pval,toluaI_set_player_object_type_pval);
+ tolua_tablevar(tolua_S,"object_type","pval2",toluaI_get_player_object_type_pval2,toluaI_set_player_object_type_pval2);
+ tolua_tablevar(tolua_S,"object_type","pval3",toluaI_get_player_object_type_pval3,toluaI_set_player_object_type_pval3);
+ tolua_tablevar(tolua_S,"object_type","discount",toluaI_get_player_object_type_discount,toluaI_set_player_object_type_discount);
+ tolua_tablevar(tolua_S,"object_type","number",toluaI_get_player_object_type_number,toluaI_set_player_object_type_number);
+ tolua_tablevar(tolua_S,"object_type","weight",toluaI_get_player_object_type_weight,toluaI_set_player_object_type_weight);
+ tolua_tablevar(tolua_S,"object_type","name1",toluaI_get_player_object_type_name1,toluaI_set_player_object_type_name1);
+ tolua_tablevar(tolua_S,"object_type","name2",toluaI_get_player_object_type_name2,toluaI_set_player_object_type_name2);
+ tolua_tablevar(tolua_S,"object_type","name2b",toluaI_get_player_object_type_name2b,toluaI_set_player_object_type_name2b);
+ tolua_tablevar(tolua_S,"object_type","name3",toluaI_get_player_object_type_name3,toluaI_set_player_object_type_name3);
+ tolua_tablevar(tolua_S,"object_type","attr",toluaI_get_player_object_type_attr,toluaI_set_player_object_type_attr);
+ tolua_tablevar(tolua_S,"object_type","xtra1",toluaI_get_player_object_type_xtra1,toluaI_set_player_object_type_xtra1);
+ tolua_tablevar(tolua_S,"object_type","xtra2",toluaI_get_player_object_type_xtra2,toluaI_set_player_object_type_xtra2);
+ tolua_tablevar(tolua_S,"object_type","xtra3",toluaI_get_player_object_type_xtra3,toluaI_set_player_object_type_xtra3);
+ tolua_tablevar(tolua_S,"object_type","xtra4",toluaI_get_player_object_type_xtra4,toluaI_set_player_object_type_xtra4);
+ tolua_tablevar(tolua_S,"object_type","xtra5",toluaI_get_player_object_type_xtra5,toluaI_set_player_object_type_xtra5);
+ tolua_tablevar(tolua_S,"object_type","xtra6",toluaI_get_player_object_type_xtra6,toluaI_set_player_object_type_xtra6);
+ tolua_tablevar(tolua_S,"object_type","xtra7",toluaI_get_player_object_type_xtra7,toluaI_set_player_object_type_xtra7);
+ tolua_tablevar(tolua_S,"object_type","xtra8",toluaI_get_player_object_type_xtra8,toluaI_set_player_object_type_xtra8);
+ tolua_tablevar(tolua_S,"object_type","xtra9",toluaI_get_player_object_type_xtra9,toluaI_set_player_object_type_xtra9);
+ tolua_tablevar(tolua_S,"object_type","to_h",toluaI_get_player_object_type_to_h,toluaI_set_player_object_type_to_h);
+ tolua_tablevar(tolua_S,"object_type","to_d",toluaI_get_player_object_type_to_d,toluaI_set_player_object_type_to_d);
+ tolua_tablevar(tolua_S,"object_type","to_a",toluaI_get_player_object_type_to_a,toluaI_set_player_object_type_to_a);
+ tolua_tablevar(tolua_S,"object_type","ac",toluaI_get_player_object_type_ac,toluaI_set_player_object_type_ac);
+ tolua_tablevar(tolua_S,"object_type","dd",toluaI_get_player_object_type_dd,toluaI_set_player_object_type_dd);
+ tolua_tablevar(tolua_S,"object_type","ds",toluaI_get_player_object_type_ds,toluaI_set_player_object_type_ds);
+ tolua_tablevar(tolua_S,"object_type","timeout",toluaI_get_player_object_type_timeout,toluaI_set_player_object_type_timeout);
+ tolua_tablevar(tolua_S,"object_type","timeout_magic",toluaI_get_player_object_type_timeout_magic,toluaI_set_player_object_type_timeout_magic);
+ tolua_tablevar(tolua_S,"object_type","recharging",toluaI_get_player_object_type_recharging,toluaI_set_player_object_type_recharging);
+ tolua_tablevar(tolua_S,"object_type","ident",toluaI_get_player_object_type_ident,toluaI_set_player_object_type_ident);
+ tolua_tablevar(tolua_S,"object_type","note",toluaI_get_player_object_type_note,toluaI_set_player_object_type_note);
+ tolua_tablevar(tolua_S,"object_type","questor",toluaI_get_player_object_type_questor,toluaI_set_player_object_type_questor);
+ tolua_tablevar(tolua_S,"object_type","quest",toluaI_get_player_object_type_quest,toluaI_set_player_object_type_quest);
+ tolua_tablevar(tolua_S,"object_type","quest_stage",toluaI_get_player_object_type_quest_stage,toluaI_set_player_object_type_quest_stage);
+ tolua_tablevar(tolua_S,"object_type","questor_idx",toluaI_get_player_object_type_questor_idx,toluaI_set_player_object_type_questor_idx);
+ tolua_tablevar(tolua_S,"object_type","iron_trade",toluaI_get_player_object_type_iron_trade,toluaI_set_player_object_type_iron_trade);
+ tolua_tablevar(tolua_S,"object_type","iron_turn",toluaI_get_player_object_type_iron_turn,toluaI_set_player_object_type_iron_turn);
+ tolua_tablevar(tolua_S,"object_type","id",toluaI_get_player_object_type_id,toluaI_set_player_object_type_id);
+ tolua_tablevar(tolua_S,"object_type","f_id",toluaI_get_player_object_type_f_id,toluaI_set_player_object_type_f_id);
+ tolua_tablearray(tolua_S,"object_type","f_name",toluaI_get_player_object_type_f_name,toluaI_set_player_object_type_f_name);
+ tolua_tablevar(tolua_S,"object_type","f_turn",toluaI_get_player_object_type_f_turn,toluaI_set_player_object_type_f_turn);
+ tolua_tablevar(tolua_S,"object_type","f_time",toluaI_get_player_object_type_f_time,toluaI_set_player_object_type_f_time);
+ tolua_tablevar(tolua_S,"object_type","f_wpos",toluaI_get_player_object_type_f_wpos,toluaI_set_player_object_type_f_wpos);
+ tolua_tablevar(tolua_S,"object_type","f_dun",toluaI_get_player_object_type_f_dun,toluaI_set_player_object_type_f_dun);
+ tolua_tablevar(tolua_S,"object_type","f_player",toluaI_get_player_object_type_f_player,toluaI_set_player_object_type_f_player);
+ tolua_tablevar(tolua_S,"object_type","f_player_turn",toluaI_get_player_object_type_f_player_turn,toluaI_set_player_object_type_f_player_turn);
+ tolua_tablevar(tolua_S,"object_type","f_ridx",toluaI_get_player_object_type_f_ridx,toluaI_set_player_object_type_f_ridx);
+ tolua_tablevar(tolua_S,"object_type","f_reidx",toluaI_get_player_object_type_f_reidx,toluaI_set_player_object_type_f_reidx);
+ tolua_tablevar(tolua_S,"object_type","f_special",toluaI_get_player_object_type_f_special,toluaI_set_player_object_type_f_special);
+ tolua_tablevar(tolua_S,"object_type","f_reward",toluaI_get_player_object_type_f_reward,toluaI_set_player_object_type_f_reward);
+ tolua_cclass(tolua_S,"skill_player","");
+ tolua_tablevar(tolua_S,"skill_player","base_value",toluaI_get_player_skill_player_base_value,toluaI_set_player_skill_player_base_value);
+ tolua_tablevar(tolua_S,"skill_player","value",toluaI_get_player_skill_player_value,toluaI_set_player_skill_player_value);
+ tolua_tablevar(tolua_S,"skill_player","mod",toluaI_get_player_skill_player_mod,toluaI_set_player_skill_player_mod);
+ tolua_tablevar(tolua_S,"skill_player","dev",toluaI_get_player_skill_player_dev,toluaI_set_player_skill_player_dev);
+ tolua_tablevar(tolua_S,"skill_player","flags1",toluaI_get_player_skill_player_flags1,toluaI_set_player_skill_player_flags1);
+ tolua_cclass(tolua_S,"version_type","");
+ tolua_tablevar(tolua_S,"version_type","major",toluaI_get_player_version_type_major,toluaI_set_player_version_type_major);
+ tolua_tablevar(tolua_S,"version_type","minor",toluaI_get_player_version_type_minor,toluaI_set_player_version_type_minor);
+ tolua_tablevar(tolua_S,"version_type","patch",toluaI_get_player_version_type_patch,toluaI_set_player_version_type_patch);
+ tolua_tablevar(tolua_S,"version_type","extra",toluaI_get_player_version_type_extra,toluaI_set_player_version_type_extra);
+ tolua_tablevar(tolua_S,"version_type","branch",toluaI_get_player_version_type_branch,toluaI_set_player_version_type_branch);
+ tolua_tablevar(tolua_S,"version_type","build",toluaI_get_player_version_type_build,toluaI_set_player_version_type_build);
+ tolua_tablevar(tolua_S,"version_type","os",toluaI_get_player_version_type_os,toluaI_set_player_version_type_os);
+ tolua_tablevar(tolua_S,"version_type","os_sub",toluaI_get_player_version_type_os_sub,toluaI_set_player_version_type_os_sub);
+ tolua_cclass(tolua_S,"inventory_change_type","");
+ tolua_tablevar(tolua_S,"inventory_change_type","type",toluaI_get_player_inventory_change_type_type,toluaI_set_player_inventory_change_type_type);
+ tolua_tablevar(tolua_S,"inventory_change_type","revision",toluaI_get_player_inventory_change_type_revision,toluaI_set_player_inventory_change_type_revision);
+ tolua_tablevar(tolua_S,"inventory_change_type","begin",toluaI_get_player_inventory_change_type_begin,toluaI_set_player_inventory_change_type_begin);
+ tolua_tablevar(tolua_S,"inventory_change_type","end",toluaI_get_player_inventory_change_type_end,toluaI_set_player_inventory_change_type_end);
+ tolua_tablevar(tolua_S,"inventory_change_type","mod",toluaI_get_player_inventory_change_type_mod,toluaI_set_player_inventory_change_type_mod);
+ tolua_tablevar(tolua_S,"inventory_change_type","next",toluaI_get_player_inventory_change_type_next,toluaI_set_player_inventory_change_type_next);
+ tolua_cclass(tolua_S,"player_type","");
+ tolua_tablevar(tolua_S,"player_type","conn",toluaI_get_player_player_type_conn,toluaI_set_player_player_type_conn);
+ tolua_tablevar(tolua_S,"player_type","Ind",toluaI_get_player_player_type_Ind,toluaI_set_player_player_type_Ind);
+ tolua_tablevar(tolua_S,"player_type","name",toluaI_get_player_player_type_name,NULL);
+ tolua_tablevar(tolua_S,"player_type","basename",toluaI_get_player_player_type_basename,NULL);
+ tolua_tablevar(tolua_S,"player_type","realname",toluaI_get_player_player_type_realname,NULL);
+ tolua_tablevar(tolua_S,"player_type","accountname",toluaI_get_player_player_type_accountname,NULL);
+ tolua_tablevar(tolua_S,"player_type","hostname",toluaI_get_player_player_type_hostname,NULL);
+ tolua_tablevar(tolua_S,"player_type","addr",toluaI_get_player_player_type_addr,NULL);
+ tolua_tablevar(tolua_S,"player_type","version",toluaI_get_player_player_type_version,toluaI_set_player_player_type_version);
+ tolua_tablevar(tolua_S,"player_type","v_outdated",toluaI_get_player_player_type_v_outdated,toluaI_set_player_player_type_v_outdated);
+ tolua_tablevar(tolua_S,"player_type","v_latest",toluaI_get_player_player_type_v_latest,toluaI_set_player_player_type_v_latest);
+ tolua_tablevar(tolua_S,"player_type","v_test",toluaI_get_player_player_type_v_test,toluaI_set_player_player_type_v_test);
+ tolua_tablevar(tolua_S,"player_type","v_test_latest",toluaI_get_player_player_type_v_test_latest,toluaI_set_player_player_type_v_test_latest);
+ tolua_tablevar(tolua_S,"player_type","v_unknown",toluaI_get_player_player_type_v_unknown,toluaI_set_player_player_type_v_unknown);
+ tolua_tablevar(tolua_S,"player_type","rogue_like_commands",toluaI_get_player_player_type_rogue_like_commands,toluaI_set_player_player_type_rogue_like_commands);
+ tolua_tablevar(tolua_S,"player_type","id",toluaI_get_player_player_type_id,toluaI_set_player_player_type_id);
+ tolua_tablevar(tolua_S,"player_type","account",toluaI_get_player_player_type_account,toluaI_set_player_player_type_account);
+ tolua_tablevar(tolua_S,"player_type","dna",toluaI_get_player_player_type_dna,toluaI_set_player_player_type_dna);
+ tolua_tablevar(tolua_S,"player_type","turn",toluaI_get_player_player_type_turn,toluaI_set_player_player_type_turn);
+ tolua_tablevar(tolua_S,"player_type","turns_online",toluaI_get_player_player_type_turns_online,toluaI_set_player_player_type_turns_online);
+ tolua_tablevar(tolua_S,"player_type","turns_afk",toluaI_get_player_player_type_turns_afk,toluaI_set_player_player_type_turns_afk);
+ tolua_tablevar(tolua_S,"player_type","turns_idle",toluaI_get_player_player_type_turns_idle,toluaI_set_player_player_type_turns_idle);
+ tolua_tablevar(tolua_S,"player_type","turns_active",toluaI_get_player_player_type_turns_active,toluaI_set_player_player_type_turns_active);
+ tolua_tablevar(tolua_S,"player_type","hostile",toluaI_get_player_player_type_hostile,toluaI_set_player_player_type_hostile);
+ tolua_tablevar(tolua_S,"player_type","savefile",toluaI_get_player_player_type_savefile,NULL);
+ tolua_tablevar(tolua_S,"player_type","restricted",toluaI_get_player_player_type_restricted,toluaI_set_player_player_type_restricted);
+ tolua_tablevar(tolua_S,"player_type","privileged",toluaI_get_player_player_type_privileged,toluaI_set_player_player_type_privileged);
+ tolua_tablevar(tolua_S,"player_type","pvpexception",toluaI_get_player_player_type_pvpexception,toluaI_set_player_player_type_pvpexception);
+ tolua_tablevar(tolua_S,"player_type","mutedchat",toluaI_get_player_player_type_mutedchat,toluaI_set_player_player_type_mutedchat);
+ tolua_tablevar(tolua_S,"player_type","inval",toluaI_get_player_player_type_inval,toluaI_set_player_player_type_inval);
+ tolua_tablevar(tolua_S,"player_type","suicided",toluaI_get_player_player_type_suicided,toluaI_set_player_player_type_suicided);
+ tolua_tablevar(tolua_S,"player_type","death",toluaI_get_player_player_type_death,toluaI_set_player_player_type_death);
+ tolua_tablevar(tolua_S,"player_type","deathblow",toluaI_get_player_player_type_deathblow,toluaI_set_player_player_type_deathblow);
+ tolua_tablevar(tolua_S,"player_type","deaths",toluaI_get_player_player_type_deaths,toluaI_set_player_player_type_deaths);
+ tolua_tablevar(tolua_S,"player_type","soft_deaths",toluaI_get_player_player_type_soft_deaths,toluaI_set_player_player_type_soft_deaths);
+ tolua_tablevar(tolua_S,"player_type","ghost",toluaI_get_player_player_type_ghost,toluaI_set_player_player_type_ghost);
+ tolua_tablevar(tolua_S,"player_type","fruit_bat",toluaI_get_player_player_type_fruit_bat,toluaI_set_player_player_type_fruit_bat);
+ tolua_tablevar(tolua_S,"player_type","lives",toluaI_get_player_player_type_lives,toluaI_set_player_player_type_lives);
+ tolua_tablevar(tolua_S,"player_type","houses_owned",toluaI_get_player_player_type_houses_owned,toluaI_set_player_player_type_houses_owned);
+ tolua_tablevar(tolua_S,"player_type","castles_owned",toluaI_get_player_player_type_castles_owned,toluaI_set_player_player_type_castles_owned);
+ tolua_tablevar(tolua_S,"player_type","prace",toluaI_get_player_player_type_prace,toluaI_set_player_player_type_prace);
+ tolua_tablevar(tolua_S,"player_type","pclass",toluaI_get_player_player_type_pclass,toluaI_set_player_player_type_pclass);
+ tolua_tablevar(tolua_S,"player_type","ptrait",toluaI_get_player_player_type_ptrait,toluaI_set_player_player_type_ptrait);
+ tolua_tablevar(tolua_S,"player_type","male",toluaI_get_player_player_type_male,toluaI_set_player_player_type_male);
+ tolua_tablearray(tolua_S,"player_type","s_info",toluaI_get_player_player_type_s_info,toluaI_set_player_player_type_s_info);
+ tolua_tablevar(tolua_S,"player_type","skill_points",toluaI_get_player_player_type_skill_points,toluaI_set_player_player_type_skill_points);
+ tolua_tablearray(tolua_S,"player_type","s_info_old",toluaI_get_player_player_type_s_info_old,toluaI_set_player_player_type_s_info_old);
+ tolua_tablevar(tolua_S,"player_type","skill_points_old",toluaI_get_player_player_type_skill_points_old,toluaI_set_player_player_type_skill_points_old);
+ tolua_tablevar(tolua_S,"player_type","reskill_possible",toluaI_get_player_player_type_reskill_possible,toluaI_set_player_player_type_reskill_possible);
+ tolua_tablevar(tolua_S,"player_type","hitdie",toluaI_get_player_player_type_hitdie,toluaI_set_player_player_type_hitdie);
+ tolua_tablevar(tolua_S,"player_type","expfact",toluaI_get_player_player_type_expfact,toluaI_set_player_player_type_expfact);
+ tolua_tablevar(tolua_S,"player_type","au",toluaI_get_player_player_type_au,toluaI_set_player_player_type_au);
+ tolua_tablevar(tolua_S,"player_type","balance",toluaI_get_player_player_type_balance,toluaI_set_player_player_type_balance);
+ tolua_tablevar(tolua_S,"player_type","max_exp",toluaI_get_player_player_type_max_exp,toluaI_set_player_player_type_max_exp);
+ tolua_tablevar(tolua_S,"player_type","exp",toluaI_get_player_player_type_exp,toluaI_set_player_player_type_exp);
+ tolua_tablevar(tolua_S,"player_type","exp_frac",toluaI_get_player_player_type_exp_frac,toluaI_set_player_player_type_exp_frac);
+ tolua_tablevar(tolua_S,"player_type","lev",toluaI_get_player_player_type_lev,toluaI_set_player_player_type_lev);
+ tolua_tablevar(tolua_S,"player_type","max_lev",toluaI_get_player_player_type_max_lev,toluaI_set_player_player_type_max_lev);
+ tolua_tablevar(tolua_S,"player_type","mhp",toluaI_get_player_player_type_mhp,toluaI_set_player_player_type_mhp);
+ tolua_tablevar(tolua_S,"player_type","chp",toluaI_get_player_player_type_chp,toluaI_set_player_player_type_chp);
+ tolua_tablevar(tolua_S,"player_type","chp_frac",toluaI_get_player_player_type_chp_frac,toluaI_set_player_player_type_chp_frac);
+ tolua_tablearray(tolua_S,"player_type","player_hp",toluaI_get_player_player_type_player_hp,toluaI_set_player_player_type_player_hp);
+ tolua_tablevar(tolua_S,"player_type","mmp",toluaI_get_player_player_type_mmp,toluaI_set_player_player_type_mmp);
+ tolua_tablevar(tolua_S,"player_type","cmp",toluaI_get_player_player_type_cmp,toluaI_set_player_player_type_cmp);
+ tolua_tablevar(tolua_S,"player_type","cmp_frac",toluaI_get_player_player_type_cmp_frac,toluaI_set_player_player_type_cmp_frac);
+ tolua_tablevar(tolua_S,"player_type","mst",toluaI_get_player_player_type_mst,toluaI_set_player_player_type_mst);
+ tolua_tablevar(tolua_S,"player_type","cst",toluaI_get_player_player_type_cst,toluaI_set_player_player_type_cst);
+ tolua_tablevar(tolua_S,"player_type","cst_frac",toluaI_get_player_player_type_cst_frac,toluaI_set_player_player_type_cst_frac);
+ tolua_tablearray(tolua_S,"player_type","inventory",toluaI_get_player_player_type_inventory,toluaI_set_player_player_type_inventory);
+ tolua_tablevar(tolua_S,"player_type","inventory_changes",toluaI_get_player_player_type_inventory_changes,toluaI_set_player_player_type_inventory_changes);
+ tolua_tablevar(tolua_S,"player_type","inventory_revision",toluaI_get_player_player_type_inventory_revision,toluaI_set_player_player_type_inventory_revision);
+ tolua_tablevar(tolua_S,"player_type","inventory_changed",toluaI_get_player_player_type_inventory_changed,toluaI_set_player_player_type_inventory_changed);
+ tolua_tablevar(tolua_S,"player_type","total_weight",toluaI_get_player_player_type_total_weight,toluaI_set_player_player_type_total_weight);
+ tolua_tablevar(tolua_S,"player_type","inven_cnt",toluaI_get_player_player_type_inven_cnt,toluaI_set_player_player_type_inven_cnt);
+ tolua_tablevar(tolua_S,"player_type","equip_cnt",toluaI_get_player_player_type_equip_cnt,toluaI_set_player_player_type_equip_cnt);
+ tolua_tablevar(tolua_S,"player_type","max_plv",toluaI_get_player_player_type_max_plv,toluaI_set_player_player_type_max_plv);
+ tolua_tablevar(tolua_S,"player_type","max_dlv",toluaI_get_player_player_type_max_dlv,toluaI_set_player_player_type_max_dlv);
+ tolua_tablevar(tolua_S,"player_type","recall_pos",toluaI_get_player_player_type_recall_pos,toluaI_set_player_player_type_recall_pos);
+ tolua_tablearray(tolua_S,"player_type","stat_max",toluaI_get_player_player_type_stat_max,toluaI_set_player_player_type_stat_max);
+ tolua_tablearray(tolua_S,"player_type","stat_cur",toluaI_get_player_player_type_stat_cur,toluaI_set_player_player_type_stat_cur);
+ tolua_tablearray(tolua_S,"player_type","stat_los",toluaI_get_player_player_type_stat_los,toluaI_set_player_player_type_stat_los);
+ tolua_tablearray(tolua_S,"player_type","stat_cnt",toluaI_get_player_player_type_stat_cnt,toluaI_set_player_player_type_stat_cnt);
+ tolua_tablearray(tolua_S,"player_type","wild_map",toluaI_get_player_player_type_wild_map,toluaI_set_player_player_type_wild_map);
+ tolua_tablevar(tolua_S,"player_type","py",toluaI_get_player_player_type_py,toluaI_set_player_player_type_py);
+ tolua_tablevar(tolua_S,"player_type","px",toluaI_get_player_player_type_px,toluaI_set_player_player_type_px);
+ tolua_tablevar(tolua_S,"player_type","wpos",toluaI_get_player_player_type_wpos,toluaI_set_player_player_type_wpos);
+ tolua_tablearray(tolua_S,"player_type","aura",toluaI_get_player_player_type_aura,toluaI_set_player_player_type_aura);
+ tolua_tablevar(tolua_S,"player_type","cur_hgt",toluaI_get_player_player_type_cur_hgt,toluaI_set_player_player_type_cur_hgt);
+ tolua_tablevar(tolua_S,"player_type","cur_wid",toluaI_get_player_player_type_cur_wid,toluaI_set_player_player_type_cur_wid);
+ tolua_tablevar(tolua_S,"player_type","new_level_flag",toluaI_get_player_player_type_new_level_flag,toluaI_set_player_player_type_new_level_flag);
+ tolua_tablevar(tolua_S,"player_type","new_level_method",toluaI_get_player_player_type_new_level_method,toluaI_set_player_player_type_new_level_method);
+ tolua_tablevar(tolua_S,"player_type","party",toluaI_get_player_player_type_party,toluaI_set_player_player_type_party);
+ tolua_tablevar(tolua_S,"player_type","guild",toluaI_get_player_player_type_guild,toluaI_set_player_player_type_guild);
+ tolua_tablevar(tolua_S,"player_type","guild_dna",toluaI_get_player_player_type_guild_dna,toluaI_set_player_player_type_guild_dna);
+ tolua_tablevar(tolua_S,"player_type","target_who",toluaI_get_player_player_type_target_who,toluaI_set_player_player_type_target_who);
+ tolua_tablevar(tolua_S,"player_type","target_col",toluaI_get_player_player_type_target_col,toluaI_set_player_player_type_target_col);
+ tolua_tablevar(tolua_S,"player_type","target_row",toluaI_get_player_player_type_target_row,toluaI_set_player_player_type_target_row);
+ tolua_tablevar(tolua_S,"player_type","health_who",toluaI_get_player_player_type_health_who,toluaI_set_player_player_type_health_who);
+ tolua_tablevar(tolua_S,"player_type","view_n",toluaI_get_player_player_type_view_n,toluaI_set_player_player_type_view_n);
+ tolua_tablearray(tolua_S,"player_type","view_y",toluaI_get_player_player_type_view_y,toluaI_set_player_player_type_view_y);
+ tolua_tablearray(tolua_S,"player_type","view_x",toluaI_get_player_player_type_view_x,toluaI_set_player_player_type_view_x);
+ tolua_tablevar(tolua_S,"player_type","lite_n",toluaI_get_player_player_type_lite_n,toluaI_set_player_player_type_lite_n);
+ tolua_tablearray(tolua_S,"player_type","lite_y",toluaI_get_player_player_type_lite_y,toluaI_set_player_player_type_lite_y);
+ tolua_tablearray(tolua_S,"player_type","lite_x",toluaI_get_player_player_type_lite_x,toluaI_set_player_player_type_lite_x);
+ tolua_tablearray(tolua_S,"player_type","lite_t",toluaI_get_player_player_type_lite_t,toluaI_set_player_player_type_lite_t);
+ tolua_tablevar(tolua_S,"player_type","temp_n",toluaI_get_player_player_type_temp_n,toluaI_set_player_player_type_temp_n);
+ tolua_tablearray(tolua_S,"player_type","temp_y",toluaI_get_player_player_type_temp_y,toluaI_set_player_player_type_temp_y);
+ tolua_tablearray(tolua_S,"player_type","temp_x",toluaI_get_player_player_type_temp_x,toluaI_set_player_player_type_temp_x);
+ tolua_tablevar(tolua_S,"player_type","target_n",toluaI_get_player_player_type_target_n,toluaI_set_player_player_type_target_n);
+ tolua_tablearray(tolua_S,"player_type","target_y",toluaI_get_player_player_type_target_y,toluaI_set_player_player_type_target_y);
+ tolua_tablearray(tolua_S,"player_type","target_x",toluaI_get_player_player_type_target_x,toluaI_set_player_player_type_target_x);
+ tolua_tablearray(tolua_S,"player_type","target_idx",toluaI_get_player_player_type_target_idx,toluaI_set_player_player_type_target_idx);
+ tolua_tablevar(tolua_S,"player_type","dlev_id",toluaI_get_player_player_type_dlev_id,toluaI_set_player_player_type_dlev_id);
+ tolua_tablevar(tolua_S,"player_type","infofile",toluaI_get_player_player_type_infofile,NULL);
+ tolua_tablevar(tolua_S,"player_type","special_file_type",toluaI_get_player_player_type_special_file_type,toluaI_set_player_player_type_special_file_type);
+ tolua_tablearray(tolua_S,"player_type","obj_aware",toluaI_get_player_player_type_obj_aware,toluaI_set_player_player_type_obj_aware);
+ tolua_tablearray(tolua_S,"player_type","obj_tried",toluaI_get_player_player_type_obj_tried,toluaI_set_player_player_type_obj_tried);
+ tolua_tablearray(tolua_S,"player_type","trap_ident",toluaI_get_player_player_type_trap_ident,toluaI_set_player_player_type_trap_ident);
+ tolua_tablearray(tolua_S,"player_type","d_attr",toluaI_get_player_player_type_d_attr,toluaI_set_player_player_type_d_attr);
+ tolua_tablearray(tolua_S,"player_type","d_char",toluaI_get_player_player_type_d_char,toluaI_set_player_player_type_d_char);
+ tolua_tablearray(tolua_S,"player_type","f_attr",toluaI_get_player_player_type_f_attr,toluaI_set_player_player_type_f_attr);
+ tolua_tablearray(tolua_S,"player_type","f_char",toluaI_get_player_player_type_f_char,toluaI_set_player_player_type_f_char);
+ tolua_tablearray(tolua_S,"player_type","k_attr",toluaI_get_player_player_type_k_attr,toluaI_set_player_player_type_k_attr);
+ tolua_tablearray(tolua_S,"player_type","k_char",toluaI_get_player_player_type_k_char,toluaI_set_player_player_type_k_char);
+ tolua_tablearray(tolua_S,"player_type","r_attr",toluaI_get_player_player_type_r_attr,toluaI_set_player_player_type_r_attr);
+ tolua_tablearray(tolua_S,"player_type","r_char",toluaI_get_player_player_type_r_char,toluaI_set_player_player_type_r_char);
+ tolua_tablevar(tolua_S,"player_type","carry_query_flag",toluaI_get_player_player_type_carry_query_flag,toluaI_set_player_player_type_carry_query_flag);
+ tolua_tablevar(tolua_S,"player_type","use_old_target",toluaI_get_player_player_type_use_old_target,toluaI_set_player_player_type_use_old_target);
+ tolua_tablevar(tolua_S,"player_type","always_pickup",toluaI_get_player_player_type_always_pickup,toluaI_set_player_player_type_always_pickup);
+ tolua_tablevar(tolua_S,"player_type","stack_force_notes",toluaI_get_player_player_type_stack_force_notes,toluaI_set_player_player_type_stack_force_notes);
+ tolua_tablevar(tolua_S,"player_type","stack_force_costs",toluaI_get_player_player_type_stack_force_costs,toluaI_set_player_player_type_stack_force_costs);
+ tolua_tablevar(tolua_S,"player_type","find_ignore_stairs",toluaI_get_player_player_type_find_ignore_stairs,toluaI_set_player_player_type_find_ignore_stairs);
+ tolua_tablevar(tolua_S,"player_type","find_ignore_doors",toluaI_get_player_player_type_find_ignore_doors,toluaI_set_player_player_type_find_ignore_doors);
+ tolua_tablevar(tolua_S,"player_type","find_cut",toluaI_get_player_player_type_find_cut,toluaI_set_player_player_type_find_cut);
+ tolua_tablevar(tolua_S,"player_type","find_examine",toluaI_get_player_player_type_find_examine,toluaI_set_player_player_type_find_examine);
+ tolua_tablevar(tolua_S,"player_type","find_ignore_montraps",toluaI_get_player_player_type_find_ignore_montraps,toluaI_set_player_player_type_find_ignore_montraps);
+ tolua_tablevar(tolua_S,"player_type","disturb_move",toluaI_get_player_player_type_disturb_move,toluaI_set_player_player_type_disturb_move);
+ tolua_tablevar(tolua_S,"player_type","disturb_near",toluaI_get_player_player_type_disturb_near,toluaI_set_player_player_type_disturb_near);
+ tolua_tablevar(tolua_S,"player_type","disturb_see",toluaI_get_player_player_type_disturb_see,toluaI_set_player_player_type_disturb_see);
+ tolua_tablevar(tolua_S,"player_type","disturb_panel",toluaI_get_player_player_type_disturb_panel,toluaI_set_player_player_type_disturb_panel);
+ tolua_tablevar(tolua_S,"player_type","disturb_state",toluaI_get_player_player_type_disturb_state,toluaI_set_player_player_type_disturb_state);
+ tolua_tablevar(tolua_S,"player_type","disturb_minor",toluaI_get_player_player_type_disturb_minor,toluaI_set_player_player_type_disturb_minor);
+ tolua_tablevar(tolua_S,"player_type","disturb_other",toluaI_get_player_player_type_disturb_other,toluaI_set_player_player_type_disturb_other);
+ tolua_tablevar(tolua_S,"player_type","stack_allow_items",toluaI_get_player_player_type_stack_allow_items,toluaI_set_player_player_type_stack_allow_items);
+ tolua_tablevar(tolua_S,"player_type","stack_allow_devices",toluaI_get_player_player_type_stack_allow_devices,toluaI_set_player_player_type_stack_allow_devices);
+ tolua_tablevar(tolua_S,"player_type","view_perma_grids",toluaI_get_player_player_type_view_perma_grids,toluaI_set_player_player_type_view_perma_grids);
+ tolua_tablevar(tolua_S,"player_type","view_torch_grids",toluaI_get_player_player_type_view_torch_grids,toluaI_set_player_player_type_view_torch_grids);
+ tolua_tablevar(tolua_S,"player_type","view_reduce_lite",toluaI_get_player_player_type_view_reduce_lite,toluaI_set_player_player_type_view_reduce_lite);
+ tolua_tablevar(tolua_S,"player_type","view_reduce_view",toluaI_get_player_player_type_view_reduce_view,toluaI_set_player_player_type_view_reduce_view);
+ tolua_tablevar(tolua_S,"player_type","view_lamp_floor",toluaI_get_player_player_type_view_lamp_floor,toluaI_set_player_player_type_view_lamp_floor);
+ tolua_tablevar(tolua_S,"player_type","view_lamp_walls",toluaI_get_player_player_type_view_lamp_walls,toluaI_set_player_player_type_view_lamp_walls);
+ tolua_tablevar(tolua_S,"player_type","view_shade_floor",toluaI_get_player_player_type_view_shade_floor,toluaI_set_player_player_type_view_shade_floor);
+ tolua_tablevar(tolua_S,"player_type","view_shade_walls",toluaI_get_player_player_type_view_shade_walls,toluaI_set_player_player_type_view_shade_walls);
+ tolua_tablevar(tolua_S,"player_type","wall_lighting",toluaI_get_player_player_type_wall_lighting,toluaI_set_player_player_type_wall_lighting);
+ tolua_tablevar(tolua_S,"player_type","floor_lighting",toluaI_get_player_player_type_floor_lighting,toluaI_set_player_player_type_floor_lighting);
+ tolua_tablevar(tolua_S,"player_type","view_animated_lite",toluaI_get_player_player_type_view_animated_lite,toluaI_set_player_player_type_view_animated_lite);
+ tolua_tablevar(tolua_S,"player_type","permawalls_shade",toluaI_get_player_player_type_permawalls_shade,toluaI_set_player_player_type_permawalls_shade);
+ tolua_tablevar(tolua_S,"player_type","live_timeouts",toluaI_get_player_player_type_live_timeouts,toluaI_set_player_player_type_live_timeouts);
+ tolua_tablevar(tolua_S,"player_type","easy_open",toluaI_get_player_player_type_easy_open,toluaI_set_player_player_type_easy_open);
+ tolua_tablevar(tolua_S,"player_type","easy_disarm",toluaI_get_player_player_type_easy_disarm,toluaI_set_player_player_type_easy_disarm);
+ tolua_tablevar(tolua_S,"player_type","easy_disarm_montraps",toluaI_get_player_player_type_easy_disarm_montraps,toluaI_set_player_player_type_easy_disarm_montraps);
+ tolua_tablevar(tolua_S,"player_type","easy_tunnel",toluaI_get_player_player_type_easy_tunnel,toluaI_set_player_player_type_easy_tunnel);
+ tolua_tablevar(tolua_S,"player_type","clear_inscr",toluaI_get_player_player_type_clear_inscr,toluaI_set_player_player_type_clear_inscr);
+ tolua_tablevar(tolua_S,"player_type","auto_inscr_server",toluaI_get_player_player_type_auto_inscr_server,toluaI_set_player_player_type_auto_inscr_server);
+ tolua_tablevar(tolua_S,"player_type","auto_inscr_server_ch",toluaI_get_player_player_type_auto_inscr_server_ch,toluaI_set_player_player_type_auto_inscr_server_ch);
+ tolua_tablevar(tolua_S,"player_type","autopickup_chemicals",toluaI_get_player_player_type_autopickup_chemicals,toluaI_set_player_player_type_autopickup_chemicals);
+ tolua_tablevar(tolua_S,"player_type","taciturn_messages",toluaI_get_player_player_type_taciturn_messages,toluaI_set_player_player_type_taciturn_messages);
+ tolua_tablevar(tolua_S,"player_type","last_words",toluaI_get_player_player_type_last_words,toluaI_set_player_player_type_last_words);
+ tolua_tablevar(tolua_S,"player_type","warn_unique_credit",toluaI_get_player_player_type_warn_unique_credit,toluaI_set_player_player_type_warn_unique_credit);
+ tolua_tablevar(tolua_S,"player_type","max_panel_rows",toluaI_get_player_player_type_max_panel_rows,toluaI_set_player_player_type_max_panel_rows);
+ tolua_tablevar(tolua_S,"player_type","max_panel_cols",toluaI_get_player_player_type_max_panel_cols,toluaI_set_player_player_type_max_panel_cols);
+ tolua_tablevar(tolua_S,"player_type","panel_row",toluaI_get_player_player_type_panel_row,toluaI_set_player_player_type_panel_row);
+ tolua_tablevar(tolua_S,"player_type","panel_col",toluaI_get_player_player_type_panel_col,toluaI_set_player_player_type_panel_col);
+ tolua_tablevar(tolua_S,"player_type","panel_row_min",toluaI_get_player_player_type_panel_row_min,toluaI_set_player_player_type_panel_row_min);
+ tolua_tablevar(tolua_S,"player_type","panel_row_max",toluaI_get_player_player_type_panel_row_max,toluaI_set_player_player_type_panel_row_max);
+ tolua_tablevar(tolua_S,"player_type","panel_col_min",toluaI_get_player_player_type_panel_col_min,toluaI_set_player_player_type_panel_col_min);
+ tolua_tablevar(tolua_S,"player_type","panel_col_max",toluaI_get_player_player_type_panel_col_max,toluaI_set_player_player_type_panel_col_max);
+ tolua_tablevar(tolua_S,"player_type","panel_col_prt",toluaI_get_player_player_type_panel_col_prt,toluaI_set_player_player_type_panel_col_prt);
+ tolua_tablevar(tolua_S,"player_type","panel_row_prt",toluaI_get_player_player_type_panel_row_prt,toluaI_set_player_player_type_panel_row_prt);
+ tolua_tablevar(tolua_S,"player_type","panel_row_old",toluaI_get_player_player_type_panel_row_old,toluaI_set_player_player_type_panel_row_old);
+ tolua_tablevar(tolua_S,"player_type","panel_col_old",toluaI_get_player_player_type_panel_col_old,toluaI_set_player_player_type_panel_col_old);
+ tolua_tablevar(tolua_S,"player_type","screen_wid",toluaI_get_player_player_type_screen_wid,toluaI_set_player_player_type_screen_wid);
+ tolua_tablevar(tolua_S,"player_type","screen_hgt",toluaI_get_player_player_type_screen_hgt,toluaI_set_player_player_type_screen_hgt);
+ tolua_tablevar(tolua_S,"player_type","died_from",toluaI_get_player_player_type_died_from,NULL);
+ tolua_tablevar(tolua_S,"player_type","really_died_from",toluaI_get_player_player_type_really_died_from,NULL);
+ tolua_tablevar(tolua_S,"player_type","died_from_list",toluaI_get_player_player_type_died_from_list,NULL);
+ tolua_tablevar(tolua_S,"player_type","died_from_depth",toluaI_get_player_player_type_died_from_depth,toluaI_set_player_player_type_died_from_depth);
+ tolua_tablevar(tolua_S,"player_type","total_winner",toluaI_get_player_player_type_total_winner,toluaI_set_player_player_type_total_winner);
+ tolua_tablevar(tolua_S,"player_type","once_winner",toluaI_get_player_player_type_once_winner,toluaI_set_player_player_type_once_winner);
+ tolua_tablevar(tolua_S,"player_type","iron_winner",toluaI_get_player_player_type_iron_winner,toluaI_set_player_player_type_iron_winner);
+ tolua_tablevar(tolua_S,"player_type","iron_winner_ded",toluaI_get_player_player_type_iron_winner_ded,toluaI_set_player_player_type_iron_winner_ded);
+ tolua_tablevar(tolua_S,"player_type","own1",toluaI_get_player_player_type_own1,toluaI_set_player_player_type_own1);
+ tolua_tablevar(tolua_S,"player_type","own2",toluaI_get_player_player_type_own2,toluaI_set_player_player_type_own2);
+ tolua_tablevar(tolua_S,"player_type","retire_timer",toluaI_get_player_player_type_retire_timer,toluaI_set_player_player_type_retire_timer);
+ tolua_tablevar(tolua_S,"player_type","noscore",toluaI_get_player_player_type_noscore,toluaI_set_player_player_type_noscore);
+ tolua_tablevar(tolua_S,"player_type","command_rep",toluaI_get_player_player_type_command_rep,toluaI_set_player_player_type_command_rep);
+ tolua_tablevar(tolua_S,"player_type","last_dir",toluaI_get_player_player_type_last_dir,toluaI_set_player_player_type_last_dir);
+ tolua_tablevar(tolua_S,"player_type","running",toluaI_get_player_player_type_running,toluaI_set_player_player_type_running);
+ tolua_tablevar(tolua_S,"player_type","find_current",toluaI_get_player_player_type_find_current,toluaI_set_player_player_type_find_current);
+ tolua_tablevar(tolua_S,"player_type","find_prevdir",toluaI_get_player_player_type_find_prevdir,toluaI_set_player_player_type_find_prevdir);
+ tolua_tablevar(tolua_S,"player_type","find_openarea",toluaI_get_player_player_type_find_openarea,toluaI_set_player_player_type_find_openarea);
+ tolua_tablevar(tolua_S,"player_type","find_breakright",toluaI_get_player_player_type_find_breakright,toluaI_set_player_player_type_find_breakright);
+ tolua_tablevar(tolua_S,"player_type","find_breakleft",toluaI_get_player_player_type_find_breakleft,toluaI_set_player_player_type_find_breakleft);
+ tolua_tablevar(tolua_S,"player_type","resting",toluaI_get_player_player_type_resting,toluaI_set_player_player_type_resting);
+ tolua_tablevar(tolua_S,"player_type","energy_use",toluaI_get_player_player_type_energy_use,toluaI_set_player_player_type_energy_use);
+ tolua_tablevar(tolua_S,"player_type","look_index",toluaI_get_player_player_type_look_index,toluaI_set_player_player_type_look_index);
+ tolua_tablevar(tolua_S,"player_type","current_char",toluaI_get_player_player_type_current_char,toluaI_set_player_player_type_current_char);
+ tolua_tablevar(tolua_S,"player_type","current_spell",toluaI_get_player_player_type_current_spell,toluaI_set_player_player_type_current_spell);
+ tolua_tablevar(tolua_S,"player_type","current_mind",toluaI_get_player_player_type_current_mind,toluaI_set_player_player_type_current_mind);
+ tolua_tablevar(tolua_S,"player_type","current_rod",toluaI_get_player_player_type_current_rod,toluaI_set_player_player_type_current_rod);
+ tolua_tablevar(tolua_S,"player_type","current_activation",toluaI_get_player_player_type_current_activation,toluaI_set_player_player_type_current_activation);
+ tolua_tablevar(tolua_S,"player_type","current_enchant_h",toluaI_get_player_player_type_current_enchant_h,toluaI_set_player_player_type_current_enchant_h);
+ tolua_tablevar(tolua_S,"player_type","current_enchant_d",toluaI_get_player_player_type_current_enchant_d,toluaI_set_player_player_type_current_enchant_d);
+ tolua_tablevar(tolua_S,"player_type","current_enchant_a",toluaI_get_player_player_type_current_enchant_a,toluaI_set_player_player_type_current_enchant_a);
+ tolua_tablevar(tolua_S,"player_type","current_identify",toluaI_get_player_player_type_current_identify,toluaI_set_player_player_type_current_identify);
+ tolua_tablevar(tolua_S,"player_type","current_star_identify",toluaI_get_player_player_type_current_star_identify,toluaI_set_player_player_type_current_star_identify);
+ tolua_tablevar(tolua_S,"player_type","current_recharge",toluaI_get_player_player_type_current_recharge,toluaI_set_player_player_type_current_recharge);
+ tolua_tablevar(tolua_S,"player_type","current_artifact",toluaI_get_player_player_type_current_artifact,toluaI_set_player_player_type_current_artifact);
+ tolua_tablevar(tolua_S,"player_type","current_artifact_nolife",toluaI_get_player_player_type_current_artifact_nolife,toluaI_set_player_player_type_current_artifact_nolife);
+ tolua_tablevar(tolua_S,"player_type","current_telekinesis",toluaI_get_player_player_type_current_telekinesis,toluaI_set_player_player_type_current_telekinesis);
+ tolua_tablevar(tolua_S,"player_type","current_telekinesis_mw",toluaI_get_player_player_type_current_telekinesis_mw,toluaI_set_player_player_type_current_telekinesis_mw);
+ tolua_tablevar(tolua_S,"player_type","current_curse",toluaI_get_player_player_type_current_curse,toluaI_set_player_player_type_current_curse);
+ tolua_tablevar(tolua_S,"player_type","suppress_ingredients",toluaI_get_player_player_type_suppress_ingredients,toluaI_set_player_player_type_suppress_ingredients);
+ tolua_tablevar(tolua_S,"player_type","current_selling",toluaI_get_player_player_type_current_selling,toluaI_set_player_player_type_current_selling);
+ tolua_tablevar(tolua_S,"player_type","current_sell_amt",toluaI_get_player_player_type_current_sell_amt,toluaI_set_player_player_type_current_sell_amt);
+ tolua_tablevar(tolua_S,"player_type","current_sell_price",toluaI_get_player_player_type_current_sell_price,toluaI_set_player_player_type_current_sell_price);
+ tolua_tablevar(tolua_S,"player_type","store_num",toluaI_get_player_player_type_store_num,toluaI_set_player_player_type_store_num);
+ tolua_tablevar(tolua_S,"player_type","fast",toluaI_get_player_player_type_fast,toluaI_set_player_player_type_fast);
+ tolua_tablevar(tolua_S,"player_type","fast_mod",toluaI_get_player_player_type_fast_mod,toluaI_set_player_player_type_fast_mod);
+ tolua_tablevar(tolua_S,"player_type","slow",toluaI_get_player_player_type_slow,toluaI_set_player_player_type_slow);
+ tolua_tablevar(tolua_S,"player_type","blind",toluaI_get_player_player_type_blind,toluaI_set_player_player_type_blind);
+ tolua_tablevar(tolua_S,"player_type","paralyzed",toluaI_get_player_player_type_paralyzed,toluaI_set_player_player_type_paralyzed);
+ tolua_tablevar(tolua_S,"player_type","suspended",toluaI_get_player_player_type_suspended,toluaI_set_player_player_type_suspended);
+ tolua_tablevar(tolua_S,"player_type","confused",toluaI_get_player_player_type_confused,toluaI_set_player_player_type_confused);
+ tolua_tablevar(tolua_S,"player_type","afraid",toluaI_get_player_player_type_afraid,toluaI_set_player_player_type_afraid);
+ tolua_tablevar(tolua_S,"player_type","image",toluaI_get_player_player_type_image,toluaI_set_player_player_type_image);
+ tolua_tablevar(tolua_S,"player_type","poisoned",toluaI_get_player_player_type_poisoned,toluaI_set_player_player_type_poisoned);
+ tolua_tablevar(tolua_S,"player_type","slow_poison",toluaI_get_player_player_type_slow_poison,toluaI_set_player_player_type_slow_poison);
+ tolua_tablevar(tolua_S,"player_type","diseased",toluaI_get_player_player_type_diseased,toluaI_set_player_player_type_diseased);
+ tolua_tablevar(tolua_S,"player_type","poisoned_attacker",toluaI_get_player_player_type_poisoned_attacker,toluaI_set_player_player_type_poisoned_attacker);
+ tolua_tablevar(tolua_S,"player_type","cut",toluaI_get_player_player_type_cut,toluaI_set_player_player_type_cut);
+ tolua_tablevar(tolua_S,"player_type","cut_bandaged",toluaI_get_player_player_type_cut_bandaged,toluaI_set_player_player_type_cut_bandaged);
+ tolua_tablevar(tolua_S,"player_type","cut_attacker",toluaI_get_player_player_type_cut_attacker,toluaI_set_player_player_type_cut_attacker);
+ tolua_tablevar(tolua_S,"player_type","cut_intrinsic_regen",toluaI_get_player_player_type_cut_intrinsic_regen,toluaI_set_player_player_type_cut_intrinsic_regen);
+ tolua_tablevar(tolua_S,"player_type","cut_intrinsic_nocut",toluaI_get_player_player_type_cut_intrinsic_nocut,toluaI_set_player_player_type_cut_intrinsic_nocut);
+ tolua_tablevar(tolua_S,"player_type","stun",toluaI_get_player_player_type_stun,toluaI_set_player_player_type_stun);
+ tolua_tablevar(tolua_S,"player_type","xtrastat_tim",toluaI_get_player_player_type_xtrastat_tim,toluaI_set_player_player_type_xtrastat_tim);
+ tolua_tablevar(tolua_S,"player_type","xtrastat_demonic",toluaI_get_player_player_type_xtrastat_demonic,toluaI_set_player_player_type_xtrastat_demonic);
+ tolua_tablevar(tolua_S,"player_type","focus_time",toluaI_get_player_player_type_focus_time,toluaI_set_player_player_type_focus_time);
+ tolua_tablevar(tolua_S,"player_type","protevil",toluaI_get_player_player_type_protevil,toluaI_set_player_player_type_protevil);
+ tolua_tablevar(tolua_S,"player_type","protevil_own",toluaI_get_player_player_type_protevil_own,toluaI_set_player_player_type_protevil_own);
+ tolua_tablevar(tolua_S,"player_type","zeal",toluaI_get_player_player_type_zeal,toluaI_set_player_player_type_zeal);
+ tolua_tablevar(tolua_S,"player_type","zeal_power",toluaI_get_player_player_type_zeal_power,toluaI_set_player_player_type_zeal_power);
+ tolua_tablevar(tolua_S,"player_type","martyr",toluaI_get_player_player_type_martyr,toluaI_set_player_player_type_martyr);
+ tolua_tablevar(tolua_S,"player_type","martyr_timeout",toluaI_get_player_player_type_martyr_timeout,toluaI_set_player_player_type_martyr_timeout);
+ tolua_tablevar(tolua_S,"player_type","res_fear_temp",toluaI_get_player_player_type_res_fear_temp,toluaI_set_player_player_type_res_fear_temp);
+ tolua_tablevar(tolua_S,"player_type","invuln",toluaI_get_player_player_type_invuln,toluaI_set_player_player_type_invuln);
+ tolua_tablevar(tolua_S,"player_type","hero",toluaI_get_player_player_type_hero,toluaI_set_player_player_type_hero);
+ tolua_tablevar(tolua_S,"player_type","shero",toluaI_get_player_player_type_shero,toluaI_set_player_player_type_shero);
+ tolua_tablevar(tolua_S,"player_type","fury",toluaI_get_player_player_type_fury,toluaI_set_player_player_type_fury);
+ tolua_tablevar(tolua_S,"player_type","shield",toluaI_get_player_player_type_shield,toluaI_set_player_player_type_shield);
+ tolua_tablevar(tolua_S,"player_type","tim_regen",toluaI_get_player_player_type_tim_regen,toluaI_set_player_player_type_tim_regen);
+ tolua_tablevar(tolua_S,"player_type","tim_regen_pow",toluaI_get_player_player_type_tim_regen_pow,toluaI_set_player_player_type_tim_regen_pow);
+ tolua_tablevar(tolua_S,"player_type","tim_regen_cost",toluaI_get_player_player_type_tim_regen_cost,toluaI_set_player_player_type_tim_regen_cost);
+ tolua_tablevar(tolua_S,"player_type","blessed",toluaI_get_player_player_type_blessed,toluaI_set_player_player_type_blessed);
+ tolua_tablevar(tolua_S,"player_type","blessed_power",toluaI_get_player_player_type_blessed_power,toluaI_set_player_player_type_blessed_power);
+ tolua_tablevar(tolua_S,"player_type","blessed_own",toluaI_get_player_player_type_blessed_own,toluaI_set_player_player_type_blessed_own);
+ tolua_tablevar(tolua_S,"player_type","dispersion",toluaI_get_player_player_type_dispersion,toluaI_set_player_player_type_dispersion);
+ tolua_tablevar(tolua_S,"player_type","dispersion_tim",toluaI_get_player_player_type_dispersion_tim,toluaI_set_player_player_type_dispersion_tim);
+ tolua_tablevar(tolua_S,"player_type","tim_invis",toluaI_get_player_player_type_tim_invis,toluaI_set_player_player_type_tim_invis);
+ tolua_tablevar(tolua_S,"player_type","tim_infra",toluaI_get_player_player_type_tim_infra,toluaI_set_player_player_type_tim_infra);
+ tolua_tablevar(tolua_S,"player_type","tim_wraith",toluaI_get_player_player_type_tim_wraith,toluaI_set_player_player_type_tim_wraith);
+ tolua_tablevar(tolua_S,"player_type","tim_wraithstep",toluaI_get_player_player_type_tim_wraithstep,toluaI_set_player_player_type_tim_wraithstep);
+ tolua_tablevar(tolua_S,"player_type","wraith_in_wall",toluaI_get_player_player_type_wraith_in_wall,toluaI_set_player_player_type_wraith_in_wall);
+ tolua_tablevar(tolua_S,"player_type","tim_jail",toluaI_get_player_player_type_tim_jail,toluaI_set_player_player_type_tim_jail);
+ tolua_tablevar(tolua_S,"player_type","tim_susp",toluaI_get_player_player_type_tim_susp,toluaI_set_player_player_type_tim_susp);
+ tolua_tablevar(tolua_S,"player_type","tim_pkill",toluaI_get_player_player_type_tim_pkill,toluaI_set_player_player_type_tim_pkill);
+ tolua_tablevar(tolua_S,"player_type","pkill",toluaI_get_player_player_type_pkill,toluaI_set_player_player_type_pkill);
+ tolua_tablevar(tolua_S,"player_type","tim_meditation",toluaI_get_player_player_type_tim_meditation,toluaI_set_player_player_type_tim_meditation);
+ tolua_tablevar(tolua_S,"player_type","tim_invisibility",toluaI_get_player_player_type_tim_invisibility,toluaI_set_player_player_type_tim_invisibility);
+ tolua_tablevar(tolua_S,"player_type","tim_invis_power",toluaI_get_player_player_type_tim_invis_power,toluaI_set_player_player_type_tim_invis_power);
+ tolua_tablevar(tolua_S,"player_type","tim_invis_power2",toluaI_get_player_player_type_tim_invis_power2,toluaI_set_player_player_type_tim_invis_power2);
+ tolua_tablevar(tolua_S,"player_type","tim_traps",toluaI_get_player_player_type_tim_traps,toluaI_set_player_player_type_tim_traps);
+ tolua_tablevar(tolua_S,"player_type","tim_manashield",toluaI_get_player_player_type_tim_manashield,toluaI_set_player_player_type_tim_manashield);
+ tolua_tablevar(tolua_S,"player_type","tim_mimic",toluaI_get_player_player_type_tim_mimic,toluaI_set_player_player_type_tim_mimic);
+ tolua_tablevar(tolua_S,"player_type","tim_mimic_what",toluaI_get_player_player_type_tim_mimic_what,toluaI_set_player_player_type_tim_mimic_what);
+ tolua_tablevar(tolua_S,"player_type","ammo_brand",toluaI_get_player_player_type_ammo_brand,toluaI_set_player_player_type_ammo_brand);
+ tolua_tablevar(tolua_S,"player_type","ammo_brand_t",toluaI_get_player_player_type_ammo_brand_t,toluaI_set_player_player_type_ammo_brand_t);
+ tolua_tablevar(tolua_S,"player_type","ammo_brand_d",toluaI_get_player_player_type_ammo_brand_d,toluaI_set_player_player_type_ammo_brand_d);
+ tolua_tablevar(tolua_S,"player_type","melee_brand",toluaI_get_player_player_type_melee_brand,toluaI_set_player_player_type_melee_brand);
+ tolua_tablevar(tolua_S,"player_type","melee_brand_t",toluaI_get_player_player_type_melee_brand_t,toluaI_set_player_player_type_melee_brand_t);
+ tolua_tablevar(tolua_S,"player_type","melee_brand_flags",toluaI_get_player_player_type_melee_brand_flags,toluaI_set_player_player_type_melee_brand_flags);
+ tolua_tablevar(tolua_S,"player_type","melee_brand2",toluaI_get_player_player_type_melee_brand2,toluaI_set_player_player_type_melee_brand2);
+ tolua_tablevar(tolua_S,"player_type","melee_brand2_t",toluaI_get_player_player_type_melee_brand2_t,toluaI_set_player_player_type_melee_brand2_t);
+ tolua_tablevar(tolua_S,"player_type","melee_brand2_flags",toluaI_get_player_player_type_melee_brand2_flags,toluaI_set_player_player_type_melee_brand2_flags);
+ tolua_tablevar(tolua_S,"player_type","melee_brand_ma",toluaI_get_player_player_type_melee_brand_ma,toluaI_set_player_player_type_melee_brand_ma);
+ tolua_tablevar(tolua_S,"player_type","prob_travel",toluaI_get_player_player_type_prob_travel,toluaI_set_player_player_type_prob_travel);
+ tolua_tablevar(tolua_S,"player_type","st_anchor",toluaI_get_player_player_type_st_anchor,toluaI_set_player_player_type_st_anchor);
+ tolua_tablevar(tolua_S,"player_type","tim_esp",toluaI_get_player_player_type_tim_esp,toluaI_set_player_player_type_tim_esp);
+ tolua_tablevar(tolua_S,"player_type","adrenaline",toluaI_get_player_player_type_adrenaline,toluaI_set_player_player_type_adrenaline);
+ tolua_tablevar(tolua_S,"player_type","biofeedback",toluaI_get_player_player_type_biofeedback,toluaI_set_player_player_type_biofeedback);
+ tolua_tablevar(tolua_S,"player_type","mindboost",toluaI_get_player_player_type_mindboost,toluaI_set_player_player_type_mindboost);
+ tolua_tablevar(tolua_S,"player_type","mindboost_power",toluaI_get_player_player_type_mindboost_power,toluaI_set_player_player_type_mindboost_power);
+ tolua_tablevar(tolua_S,"player_type","auto_tunnel",toluaI_get_player_player_type_auto_tunnel,toluaI_set_player_player_type_auto_tunnel);
+ tolua_tablevar(tolua_S,"player_type","body_monster",toluaI_get_player_player_type_body_monster,toluaI_set_player_player_type_body_monster);
+ tolua_tablevar(tolua_S,"player_type","oppose_acid",toluaI_get_player_player_type_oppose_acid,toluaI_set_player_player_type_oppose_acid);
+ tolua_tablevar(tolua_S,"player_type","oppose_elec",toluaI_get_player_player_type_oppose_elec,toluaI_set_player_player_type_oppose_elec);
+ tolua_tablevar(tolua_S,"player_type","oppose_fire",toluaI_get_player_player_type_oppose_fire,toluaI_set_player_player_type_oppose_fire);
+ tolua_tablevar(tolua_S,"player_type","oppose_cold",toluaI_get_player_player_type_oppose_cold,toluaI_set_player_player_type_oppose_cold);
+ tolua_tablevar(tolua_S,"player_type","oppose_pois",toluaI_get_player_player_type_oppose_pois,toluaI_set_player_player_type_oppose_pois);
+ tolua_tablevar(tolua_S,"player_type","word_recall",toluaI_get_player_player_type_word_recall,toluaI_set_player_player_type_word_recall);
+ tolua_tablevar(tolua_S,"player_type","energy",toluaI_get_player_player_type_energy,toluaI_set_player_player_type_energy);
+ tolua_tablevar(tolua_S,"player_type","food",toluaI_get_player_player_type_food,toluaI_set_player_player_type_food);
+ tolua_tablevar(tolua_S,"player_type","confusing",toluaI_get_player_player_type_confusing,toluaI_set_player_player_type_confusing);
+ tolua_tablevar(tolua_S,"player_type","stunning",toluaI_get_player_player_type_stunning,toluaI_set_player_player_type_stunning);
+ tolua_tablevar(tolua_S,"player_type","searching",toluaI_get_player_player_type_searching,toluaI_set_player_player_type_searching);
+ tolua_tablevar(tolua_S,"player_type","cloaked",toluaI_get_player_player_type_cloaked,toluaI_set_player_player_type_cloaked);
+ tolua_tablevar(tolua_S,"player_type","old_lite",toluaI_get_player_player_type_old_lite,toluaI_set_player_player_type_old_lite);
+ tolua_tablevar(tolua_S,"player_type","old_view",toluaI_get_player_player_type_old_view,toluaI_set_player_player_type_old_view);
+ tolua_tablevar(tolua_S,"player_type","old_food_aux",toluaI_get_player_player_type_old_food_aux,toluaI_set_player_player_type_old_food_aux);
+ tolua_tablevar(tolua_S,"player_type","cumber_armor",toluaI_get_player_player_type_cumber_armor,toluaI_set_player_player_type_cumber_armor);
+ tolua_tablevar(tolua_S,"player_type","awkward_armor",toluaI_get_player_player_type_awkward_armor,toluaI_set_player_player_type_awkward_armor);
+ tolua_tablevar(tolua_S,"player_type","cumber_glove",toluaI_get_player_player_type_cumber_glove,toluaI_set_player_player_type_cumber_glove);
+ tolua_tablevar(tolua_S,"player_type","cumber_helm",toluaI_get_player_player_type_cumber_helm,toluaI_set_player_player_type_cumber_helm);
+ tolua_tablevar(tolua_S,"player_type","heavy_wield",toluaI_get_player_player_type_heavy_wield,toluaI_set_player_player_type_heavy_wield);
+ tolua_tablevar(tolua_S,"player_type","heavy_shield",toluaI_get_player_player_type_heavy_shield,toluaI_set_player_player_type_heavy_shield);
+ tolua_tablevar(tolua_S,"player_type","heavy_shoot",toluaI_get_player_player_type_heavy_shoot,toluaI_set_player_player_type_heavy_shoot);
+ tolua_tablevar(tolua_S,"player_type","icky_wield",toluaI_get_player_player_type_icky_wield,toluaI_set_player_player_type_icky_wield);
+ tolua_tablevar(tolua_S,"player_type","awkward_wield",toluaI_get_player_player_type_awkward_wield,toluaI_set_player_player_type_awkward_wield);
+ tolua_tablevar(tolua_S,"player_type","easy_wield",toluaI_get_player_player_type_easy_wield,toluaI_set_player_player_type_easy_wield);
+ tolua_tablevar(tolua_S,"player_type","heavy_tool",toluaI_get_player_player_type_heavy_tool,toluaI_set_player_player_type_heavy_tool);
+ tolua_tablevar(tolua_S,"player_type","cumber_weight",toluaI_get_player_player_type_cumber_weight,toluaI_set_player_player_type_cumber_weight);
+ tolua_tablevar(tolua_S,"player_type","monk_heavyarmor",toluaI_get_player_player_type_monk_heavyarmor,toluaI_set_player_player_type_monk_heavyarmor);
+ tolua_tablevar(tolua_S,"player_type","awkward_shoot",toluaI_get_player_player_type_awkward_shoot,toluaI_set_player_player_type_awkward_shoot);
+ tolua_tablevar(tolua_S,"player_type","rogue_heavyarmor",toluaI_get_player_player_type_rogue_heavyarmor,toluaI_set_player_player_type_rogue_heavyarmor);
+ tolua_tablevar(tolua_S,"player_type","heavy_swim",toluaI_get_player_player_type_heavy_swim,toluaI_set_player_player_type_heavy_swim);
+ tolua_tablevar(tolua_S,"player_type","cur_lite",toluaI_get_player_player_type_cur_lite,toluaI_set_player_player_type_cur_lite);
+ tolua_tablevar(tolua_S,"player_type","lite_type",toluaI_get_player_player_type_lite_type,toluaI_set_player_player_type_lite_type);
+ tolua_tablevar(tolua_S,"player_type","notice",toluaI_get_player_player_type_notice,toluaI_set_player_player_type_notice);
+ tolua_tablevar(tolua_S,"player_type","update",toluaI_get_player_player_type_update,toluaI_set_player_player_type_update);
+ tolua_tablevar(tolua_S,"player_type","redraw",toluaI_get_player_player_type_redraw,toluaI_set_player_player_type_redraw);
+ tolua_tablevar(tolua_S,"player_type","redraw2",toluaI_get_player_player_type_redraw2,toluaI_set_player_player_type_redraw2);
+ tolua_tablevar(tolua_S,"player_type","window",toluaI_get_player_player_type_window,toluaI_set_player_player_type_window);
+ tolua_tablearray(tolua_S,"player_type","stat_use",toluaI_get_player_player_type_stat_use,toluaI_set_player_player_type_stat_use);
+ tolua_tablearray(tolua_S,"player_type","stat_top",toluaI_get_player_player_type_stat_top,toluaI_set_player_player_type_stat_top);
+ tolua_tablearray(tolua_S,"player_type","stat_add",toluaI_get_player_player_type_stat_add,toluaI_set_player_player_type_stat_add);
+ tolua_tablearray(tolua_S,"player_type","stat_tmp",toluaI_get_player_player_type_stat_tmp,toluaI_set_player_player_type_stat_tmp);
+ tolua_tablearray(tolua_S,"player_type","stat_ind",toluaI_get_player_player_type_stat_ind,toluaI_set_player_player_type_stat_ind);
+ tolua_tablevar(tolua_S,"player_type","mimic_immunity",toluaI_get_player_player_type_mimic_immunity,toluaI_set_player_player_type_mimic_immunity);
+ tolua_tablevar(tolua_S,"player_type","breath_element",toluaI_get_player_player_type_breath_element,toluaI_set_player_player_type_breath_element);
+ tolua_tablevar(tolua_S,"player_type","immune_acid",toluaI_get_player_player_type_immune_acid,toluaI_set_player_player_type_immune_acid);
+ tolua_tablevar(tolua_S,"player_type","immune_elec",toluaI_get_player_player_type_immune_elec,toluaI_set_player_player_type_immune_elec);
+ tolua_tablevar(tolua_S,"player_type","immune_fire",toluaI_get_player_player_type_immune_fire,toluaI_set_player_player_type_immune_fire);
+ tolua_tablevar(tolua_S,"player_type","immune_cold",toluaI_get_player_player_type_immune_cold,toluaI_set_player_player_type_immune_cold);
+ tolua_tablevar(tolua_S,"player_type","reduc_fire",toluaI_get_player_player_type_reduc_fire,toluaI_set_player_player_type_reduc_fire);
+ tolua_tablevar(tolua_S,"player_type","reduc_elec",toluaI_get_player_player_type_reduc_elec,toluaI_set_player_player_type_reduc_elec);
+ tolua_tablevar(tolua_S,"player_type","reduc_acid",toluaI_get_player_player_type_reduc_acid,toluaI_set_player_player_type_reduc_acid);
+ tolua_tablevar(tolua_S,"player_type","reduc_cold",toluaI_get_player_player_type_reduc_cold,toluaI_set_player_player_type_reduc_cold);
+ tolua_tablevar(tolua_S,"player_type","resist_acid",toluaI_get_player_player_type_resist_acid,toluaI_set_player_player_type_resist_acid);
+ tolua_tablevar(tolua_S,"player_type","resist_elec",toluaI_get_player_player_type_resist_elec,toluaI_set_player_player_type_resist_elec);
+ tolua_tablevar(tolua_S,"player_type","resist_fire",toluaI_get_player_player_type_resist_fire,toluaI_set_player_player_type_resist_fire);
+ tolua_tablevar(tolua_S,"player_type","resist_cold",toluaI_get_player_player_type_resist_cold,toluaI_set_player_player_type_resist_cold);
+ tolua_tablevar(tolua_S,"player_type","resist_pois",toluaI_get_player_player_type_resist_pois,toluaI_set_player_player_type_resist_pois);
+ tolua_tablevar(tolua_S,"player_type","resist_conf",toluaI_get_player_player_type_resist_conf,toluaI_set_player_player_type_resist_conf);
+ tolua_tablevar(tolua_S,"player_type","resist_sound",toluaI_get_player_player_type_resist_sound,toluaI_set_player_player_type_resist_sound);
+ tolua_tablevar(tolua_S,"player_type","resist_lite",toluaI_get_player_player_type_resist_lite,toluaI_set_player_player_type_resist_lite);
+ tolua_tablevar(tolua_S,"player_type","resist_dark",toluaI_get_player_player_type_resist_dark,toluaI_set_player_player_type_resist_dark);
+ tolua_tablevar(tolua_S,"player_type","resist_chaos",toluaI_get_player_player_type_resist_chaos,toluaI_set_player_player_type_resist_chaos);
+ tolua_tablevar(tolua_S,"player_type","resist_disen",toluaI_get_player_player_type_resist_disen,toluaI_set_player_player_type_resist_disen);
+ tolua_tablevar(tolua_S,"player_type","resist_shard",toluaI_get_player_player_type_resist_shard,toluaI_set_player_player_type_resist_shard);
+ tolua_tablevar(tolua_S,"player_type","resist_nexus",toluaI_get_player_player_type_resist_nexus,toluaI_set_player_player_type_resist_nexus);
+ tolua_tablevar(tolua_S,"player_type","resist_blind",toluaI_get_player_player_type_resist_blind,toluaI_set_player_player_type_resist_blind);
+ tolua_tablevar(tolua_S,"player_type","resist_neth",toluaI_get_player_player_type_resist_neth,toluaI_set_player_player_type_resist_neth);
+ tolua_tablevar(tolua_S,"player_type","resist_fear",toluaI_get_player_player_type_resist_fear,toluaI_set_player_player_type_resist_fear);
+ tolua_tablevar(tolua_S,"player_type","immune_neth",toluaI_get_player_player_type_immune_neth,toluaI_set_player_player_type_immune_neth);
+ tolua_tablevar(tolua_S,"player_type","suscep_fire",toluaI_get_player_player_type_suscep_fire,toluaI_set_player_player_type_suscep_fire);
+ tolua_tablevar(tolua_S,"player_type","suscep_cold",toluaI_get_player_player_type_suscep_cold,toluaI_set_player_player_type_suscep_cold);
+ tolua_tablevar(tolua_S,"player_type","suscep_acid",toluaI_get_player_player_type_suscep_acid,toluaI_set_player_player_type_suscep_acid);
+ tolua_tablevar(tolua_S,"player_type","suscep_elec",toluaI_get_player_player_type_suscep_elec,toluaI_set_player_player_type_suscep_elec);
+ tolua_tablevar(tolua_S,"player_type","suscep_pois",toluaI_get_player_player_type_suscep_pois,toluaI_set_player_player_type_suscep_pois);
+ tolua_tablevar(tolua_S,"player_type","suscep_lite",toluaI_get_player_player_type_suscep_lite,toluaI_set_player_player_type_suscep_lite);
+ tolua_tablevar(tolua_S,"player_type","suscep_good",toluaI_get_player_player_type_suscep_good,toluaI_set_player_player_type_suscep_good);
+ tolua_tablevar(tolua_S,"player_type","suscep_evil",toluaI_get_player_player_type_suscep_evil,toluaI_set_player_player_type_suscep_evil);
+ tolua_tablevar(tolua_S,"player_type","suscep_life",toluaI_get_player_player_type_suscep_life,toluaI_set_player_player_type_suscep_life);
+ tolua_tablevar(tolua_S,"player_type","demon",toluaI_get_player_player_type_demon,toluaI_set_player_player_type_demon);
+ tolua_tablevar(tolua_S,"player_type","reflect",toluaI_get_player_player_type_reflect,toluaI_set_player_player_type_reflect);
+ tolua_tablevar(tolua_S,"player_type","shield_deflect",toluaI_get_player_player_type_shield_deflect,toluaI_set_player_player_type_shield_deflect);
+ tolua_tablevar(tolua_S,"player_type","weapon_parry",toluaI_get_player_player_type_weapon_parry,toluaI_set_player_player_type_weapon_parry);
+ tolua_tablevar(tolua_S,"player_type","res_tele",toluaI_get_player_player_type_res_tele,toluaI_set_player_player_type_res_tele);
+ tolua_tablevar(tolua_S,"player_type","ty_curse",toluaI_get_player_player_type_ty_curse,toluaI_set_player_player_type_ty_curse);
+ tolua_tablevar(tolua_S,"player_type","dg_curse",toluaI_get_player_player_type_dg_curse,toluaI_set_player_player_type_dg_curse);
+ tolua_tablevar(tolua_S,"player_type","xorder_id",toluaI_get_player_player_type_xorder_id,toluaI_set_player_player_type_xorder_id);
+ tolua_tablevar(tolua_S,"player_type","xorder_num",toluaI_get_player_player_type_xorder_num,toluaI_set_player_player_type_xorder_num);
+ tolua_tablevar(tolua_S,"player_type","sustain_str",toluaI_get_player_player_type_sustain_str,toluaI_set_player_player_type_sustain_str);
+ tolua_tablevar(tolua_S,"player_type","sustain_int",toluaI_get_player_player_type_sustain_int,toluaI_set_player_player_type_sustain_int);
+ tolua_tablevar(tolua_S,"player_type","sustain_wis",toluaI_get_player_player_type_sustain_wis,toluaI_set_player_player_type_sustain_wis);
+ tolua_tablevar(tolua_S,"player_type","sustain_dex",toluaI_get_player_player_type_sustain_dex,toluaI_set_player_player_type_sustain_dex);
+ tolua_tablevar(tolua_S,"player_type","sustain_con",toluaI_get_player_player_type_sustain_con,toluaI_set_player_player_type_sustain_con);
+ tolua_tablevar(tolua_S,"player_type","sustain_chr",toluaI_get_player_player_type_sustain_chr,toluaI_set_player_player_type_sustain_chr);
+ tolua_tablevar(tolua_S,"player_type","aggravate",toluaI_get_player_player_type_aggravate,toluaI_set_player_player_type_aggravate);
+ tolua_tablevar(tolua_S,"player_type","teleport",toluaI_get_player_player_type_teleport,toluaI_set_player_player_type_teleport);
+ tolua_tablevar(tolua_S,"player_type","idle",toluaI_get_player_player_type_idle,toluaI_set_player_player_type_idle);
+ tolua_tablevar(tolua_S,"player_type","idle_char",toluaI_get_player_player_type_idle_char,toluaI_set_player_player_type_idle_char);
+ tolua_tablevar(tolua_S,"player_type","idle_attack",toluaI_get_player_player_type_idle_attack,toluaI_set_player_player_type_idle_attack);
+ tolua_tablevar(tolua_S,"player_type","afk",toluaI_get_player_player_type_afk,toluaI_set_player_player_type_afk);
+ tolua_tablevar(tolua_S,"player_type","drain_exp",toluaI_get_player_player_type_drain_exp,toluaI_set_player_player_type_drain_exp);
+ tolua_tablevar(tolua_S,"player_type","drain_life",toluaI_get_player_player_type_drain_life,toluaI_set_player_player_type_drain_life);
+ tolua_tablevar(tolua_S,"player_type","drain_mana",toluaI_get_player_player_type_drain_mana,toluaI_set_player_player_type_drain_mana);
+ tolua_tablevar(tolua_S,"player_type","feather_fall",toluaI_get_player_player_type_feather_fall,toluaI_set_player_player_type_feather_fall);
+ tolua_tablevar(tolua_S,"player_type","lite",toluaI_get_player_player_type_lite,toluaI_set_player_player_type_lite);
+ tolua_tablevar(tolua_S,"player_type","free_act",toluaI_get_player_player_type_free_act,toluaI_set_player_player_type_free_act);
+ tolua_tablevar(tolua_S,"player_type","see_inv",toluaI_get_player_player_type_see_inv,toluaI_set_player_player_type_see_inv);
+ tolua_tablevar(tolua_S,"player_type","regenerate",toluaI_get_player_player_type_regenerate,toluaI_set_player_player_type_regenerate);
+ tolua_tablevar(tolua_S,"player_type","resist_time",toluaI_get_player_player_type_resist_time,toluaI_set_player_player_type_resist_time);
+ tolua_tablevar(tolua_S,"player_type","resist_mana",toluaI_get_player_player_type_resist_mana,toluaI_set_player_player_type_resist_mana);
+ tolua_tablevar(tolua_S,"player_type","immune_poison",toluaI_get_player_player_type_immune_poison,toluaI_set_player_player_type_immune_poison);
+ tolua_tablevar(tolua_S,"player_type","immune_water",toluaI_get_player_player_type_immune_water,toluaI_set_player_player_type_immune_water);
+ tolua_tablevar(tolua_S,"player_type","resist_water",toluaI_get_player_player_type_resist_water,toluaI_set_player_player_type_resist_water);
+ tolua_tablevar(tolua_S,"player_type","regen_mana",toluaI_get_player_player_type_regen_mana,toluaI_set_player_player_type_regen_mana);
+ tolua_tablevar(tolua_S,"player_type","keep_life",toluaI_get_player_player_type_keep_life,toluaI_set_player_player_type_keep_life);
+ tolua_tablevar(tolua_S,"player_type","hold_life",toluaI_get_player_player_type_hold_life,toluaI_set_player_player_type_hold_life);
+ tolua_tablevar(tolua_S,"player_type","telepathy",toluaI_get_player_player_type_telepathy,toluaI_set_player_player_type_telepathy);
+ tolua_tablevar(tolua_S,"player_type","slow_digest",toluaI_get_player_player_type_slow_digest,toluaI_set_player_player_type_slow_digest);
+ tolua_tablevar(tolua_S,"player_type","blessed_weapon",toluaI_get_player_player_type_blessed_weapon,toluaI_set_player_player_type_blessed_weapon);
+ tolua_tablevar(tolua_S,"player_type","xtra_might",toluaI_get_player_player_type_xtra_might,toluaI_set_player_player_type_xtra_might);
+ tolua_tablevar(tolua_S,"player_type","impact",toluaI_get_player_player_type_impact,toluaI_set_player_player_type_impact);
+ tolua_tablevar(tolua_S,"player_type","auto_id",toluaI_get_player_player_type_auto_id,toluaI_set_player_player_type_auto_id);
+ tolua_tablevar(tolua_S,"player_type","no_cut",toluaI_get_player_player_type_no_cut,toluaI_set_player_player_type_no_cut);
+ tolua_tablevar(tolua_S,"player_type","levitate",toluaI_get_player_player_type_levitate,toluaI_set_player_player_type_levitate);
+ tolua_tablevar(tolua_S,"player_type","can_swim",toluaI_get_player_player_type_can_swim,toluaI_set_player_player_type_can_swim);
+ tolua_tablevar(tolua_S,"player_type","pass_trees",toluaI_get_player_player_type_pass_trees,toluaI_set_player_player_type_pass_trees);
+ tolua_tablevar(tolua_S,"player_type","town_pass_trees",toluaI_get_player_player_type_town_pass_trees,toluaI_set_player_player_type_town_pass_trees);
+ tolua_tablevar(tolua_S,"player_type","reduce_insanity",toluaI_get_player_player_type_reduce_insanity,toluaI_set_player_player_type_reduce_insanity);
+ tolua_tablevar(tolua_S,"player_type","invis",toluaI_get_player_player_type_invis,toluaI_set_player_player_type_invis);
+ tolua_tablevar(tolua_S,"player_type","admin_wiz",toluaI_get_player_player_type_admin_wiz,toluaI_set_player_player_type_admin_wiz);
+ tolua_tablevar(tolua_S,"player_type","admin_dm",toluaI_get_player_player_type_admin_dm,toluaI_set_player_player_type_admin_dm);
+ tolua_tablevar(tolua_S,"player_type","extra_blows",toluaI_get_player_player_type_extra_blows,toluaI_set_player_player_type_extra_blows);
+ tolua_tablevar(tolua_S,"player_type","xtra_crit",toluaI_get_player_player_type_xtra_crit,toluaI_set_player_player_type_xtra_crit);
+ tolua_tablevar(tolua_S,"player_type","to_l",toluaI_get_player_player_type_to_l,toluaI_set_player_player_type_to_l);
+ tolua_tablevar(tolua_S,"player_type","to_hp",toluaI_get_player_player_type_to_hp,toluaI_set_player_player_type_to_hp);
+ tolua_tablevar(tolua_S,"player_type","to_m",toluaI_get_player_player_type_to_m,toluaI_set_player_player_type_to_m);
+ tolua_tablevar(tolua_S,"player_type","dis_to_h",toluaI_get_player_player_type_dis_to_h,toluaI_set_player_player_type_dis_to_h);
+ tolua_tablevar(tolua_S,"player_type","dis_to_d",toluaI_get_player_player_type_dis_to_d,toluaI_set_player_player_type_dis_to_d);
+ tolua_tablevar(tolua_S,"player_type","dis_to_a",toluaI_get_player_player_type_dis_to_a,toluaI_set_player_player_type_dis_to_a);
+ tolua_tablevar(tolua_S,"player_type","dis_ac",toluaI_get_player_player_type_dis_ac,toluaI_set_player_player_type_dis_ac);
+ tolua_tablevar(tolua_S,"player_type","to_h_melee",toluaI_get_player_player_type_to_h_melee,toluaI_set_player_player_type_to_h_melee);
+ tolua_tablevar(tolua_S,"player_type","to_d_melee",toluaI_get_player_player_type_to_d_melee,toluaI_set_player_player_type_to_d_melee);
+ tolua_tablevar(tolua_S,"player_type","to_h_ranged",toluaI_get_player_player_type_to_h_ranged,toluaI_set_player_player_type_to_h_ranged);
+ tolua_tablevar(tolua_S,"player_type","to_d_ranged",toluaI_get_player_player_type_to_d_ranged,toluaI_set_player_player_type_to_d_ranged);
+ tolua_tablevar(tolua_S,"player_type","to_h",toluaI_get_player_player_type_to_h,toluaI_set_player_player_type_to_h);
+ tolua_tablevar(tolua_S,"player_type","to_d",toluaI_get_player_player_type_to_d,toluaI_set_player_player_type_to_d);
+ tolua_tablevar(tolua_S,"player_type","to_a",toluaI_get_player_player_type_to_a,toluaI_set_player_player_type_to_a);
+ tolua_tablevar(tolua_S,"player_type","to_h_thrown",toluaI_get_player_player_type_to_h_thrown,toluaI_set_player_player_type_to_h_thrown);
+ tolua_tablevar(tolua_S,"player_type","ac",toluaI_get_player_player_type_ac,toluaI_set_player_player_type_ac);
+ tolua_tablevar(tolua_S,"player_type","overall_tohit_r",toluaI_get_player_player_type_overall_tohit_r,toluaI_set_player_player_type_overall_tohit_r);
+ tolua_tablevar(tolua_S,"player_type","overall_todam_r",toluaI_get_player_player_type_overall_todam_r,toluaI_set_player_player_type_overall_todam_r);
+ tolua_tablevar(tolua_S,"player_type","overall_tohit_m",toluaI_get_player_player_type_overall_tohit_m,toluaI_set_player_player_type_overall_tohit_m);
+ tolua_tablevar(tolua_S,"player_type","overall_todam_m",toluaI_get_player_player_type_overall_todam_m,toluaI_set_player_player_type_overall_todam_m);
+ tolua_tablevar(tolua_S,"player_type","see_infra",toluaI_get_player_player_type_see_infra,toluaI_set_player_player_type_see_infra);
+ tolua_tablevar(tolua_S,"player_type","skill_dis",toluaI_get_player_player_type_skill_dis,toluaI_set_player_player_type_skill_dis);
+ tolua_tablevar(tolua_S,"player_type","skill_dev",toluaI_get_player_player_type_skill_dev,toluaI_set_player_player_type_skill_dev);
+ tolua_tablevar(tolua_S,"player_type","skill_sav",toluaI_get_player_player_type_skill_sav,toluaI_set_player_player_type_skill_sav);
+ tolua_tablevar(tolua_S,"player_type","skill_stl",toluaI_get_player_player_type_skill_stl,toluaI_set_player_player_type_skill_stl);
+ tolua_tablevar(tolua_S,"player_type","skill_srh",toluaI_get_player_player_type_skill_srh,toluaI_set_player_player_type_skill_srh);
+ tolua_tablevar(tolua_S,"player_type","skill_fos",toluaI_get_player_player_type_skill_fos,toluaI_set_player_player_type_skill_fos);
+ tolua_tablevar(tolua_S,"player_type","skill_thn",toluaI_get_player_player_type_skill_thn,toluaI_set_player_player_type_skill_thn);
+ tolua_tablevar(tolua_S,"player_type","skill_thb",toluaI_get_player_player_type_skill_thb,toluaI_set_player_player_type_skill_thb);
+ tolua_tablevar(tolua_S,"player_type","skill_tht",toluaI_get_player_player_type_skill_tht,toluaI_set_player_player_type_skill_tht);
+ tolua_tablevar(tolua_S,"player_type","skill_dig",toluaI_get_player_player_type_skill_dig,toluaI_set_player_player_type_skill_dig);
+ tolua_tablevar(tolua_S,"player_type","num_blow",toluaI_get_player_player_type_num_blow,toluaI_set_player_player_type_num_blow);
+ tolua_tablevar(tolua_S,"player_type","num_fire",toluaI_get_player_player_type_num_fire,toluaI_set_player_player_type_num_fire);
+ tolua_tablevar(tolua_S,"player_type","num_spell",toluaI_get_player_player_type_num_spell,toluaI_set_player_player_type_num_spell);
+ tolua_tablevar(tolua_S,"player_type","tval_xtra",toluaI_get_player_player_type_tval_xtra,toluaI_set_player_player_type_tval_xtra);
+ tolua_tablevar(tolua_S,"player_type","tval_ammo",toluaI_get_player_player_type_tval_ammo,toluaI_set_player_player_type_tval_ammo);
+ tolua_tablevar(tolua_S,"player_type","pspeed",toluaI_get_player_player_type_pspeed,toluaI_set_player_player_type_pspeed);
+ tolua_tablearray(tolua_S,"player_type","r_killed",toluaI_get_player_player_type_r_killed,toluaI_set_player_player_type_r_killed);
+ tolua_tablearray(tolua_S,"player_type","r_mimicry",toluaI_get_player_player_type_r_mimicry,toluaI_set_player_player_type_r_mimicry);
+ tolua_tablevar(tolua_S,"player_type","melee_techniques",toluaI_get_player_player_type_melee_techniques,toluaI_set_player_player_type_melee_techniques);
+ tolua_tablevar(tolua_S,"player_type","ranged_techniques",toluaI_get_player_player_type_ranged_techniques,toluaI_set_player_player_type_ranged_techniques);
+ tolua_tablearray(tolua_S,"player_type","innate_spells",toluaI_get_player_player_type_innate_spells,toluaI_set_player_player_type_innate_spells);
+ tolua_tablevar(tolua_S,"player_type","body_changed",toluaI_get_player_player_type_body_changed,toluaI_set_player_player_type_body_changed);
+ tolua_tablevar(tolua_S,"player_type","anti_magic",toluaI_get_player_player_type_anti_magic,toluaI_set_player_player_type_anti_magic);
+ tolua_tablevar(tolua_S,"player_type","antimagic",toluaI_get_player_player_type_antimagic,toluaI_set_player_player_type_antimagic);
+ tolua_tablevar(tolua_S,"player_type","antimagic_dis",toluaI_get_player_player_type_antimagic_dis,toluaI_set_player_player_type_antimagic_dis);
+ tolua_tablevar(tolua_S,"player_type","blood_bond",toluaI_get_player_player_type_blood_bond,toluaI_set_player_player_type_blood_bond);
+ tolua_tablevar(tolua_S,"player_type","mode",toluaI_get_player_player_type_mode,toluaI_set_player_player_type_mode);
+ tolua_tablevar(tolua_S,"player_type","esp_link",toluaI_get_player_player_type_esp_link,toluaI_set_player_player_type_esp_link);
+ tolua_tablevar(tolua_S,"player_type","esp_link_type",toluaI_get_player_player_type_esp_link_type,toluaI_set_player_player_type_esp_link_type);
+ tolua_tablevar(tolua_S,"player_type","esp_link_flags",toluaI_get_player_player_type_esp_link_flags,toluaI_set_player_player_type_esp_link_flags);
+ tolua_tablevar(tolua_S,"player_type","esp_link_end",toluaI_get_player_player_type_esp_link_end,toluaI_set_player_player_type_esp_link_end);
+ tolua_tablevar(tolua_S,"player_type","black_breath",toluaI_get_player_player_type_black_breath,toluaI_set_player_player_type_black_breath);
+ tolua_tablevar(tolua_S,"player_type","msane",toluaI_get_player_player_type_msane,toluaI_set_player_player_type_msane);
+ tolua_tablevar(tolua_S,"player_type","csane",toluaI_get_player_player_type_csane,toluaI_set_player_player_type_csane);
+ tolua_tablevar(tolua_S,"player_type","csane_frac",toluaI_get_player_player_type_csane_frac,toluaI_set_player_player_type_csane_frac);
+ tolua_tablevar(tolua_S,"player_type","spell_project",toluaI_get_player_player_type_spell_project,toluaI_set_player_player_type_spell_project);
+ tolua_tablevar(tolua_S,"player_type","dodge_level",toluaI_get_player_player_type_dodge_level,toluaI_set_player_player_type_dodge_level);
+ tolua_tablevar(tolua_S,"player_type","tim_blacklist",toluaI_get_player_player_type_tim_blacklist,toluaI_set_player_player_type_tim_blacklist);
+ tolua_tablevar(tolua_S,"player_type","tim_watchlist",toluaI_get_player_player_type_tim_watchlist,toluaI_set_player_player_type_tim_watchlist);
+ tolua_tablevar(tolua_S,"player_type","pstealing",toluaI_get_player_player_type_pstealing,toluaI_set_player_player_type_pstealing);
+ tolua_tablevar(tolua_S,"player_type","team",toluaI_get_player_player_type_team,toluaI_set_player_player_type_team);
+ tolua_tablevar(tolua_S,"player_type","ret_dam",toluaI_get_player_player_type_ret_dam,toluaI_set_player_player_type_ret_dam);
+ tolua_tablevar(tolua_S,"player_type","attacker",toluaI_get_player_player_type_attacker,NULL);
+ tolua_tablevar(tolua_S,"player_type","luck",toluaI_get_player_player_type_luck,toluaI_set_player_player_type_luck);
+ tolua_tablevar(tolua_S,"player_type","panic",toluaI_get_player_player_type_panic,toluaI_set_player_player_type_panic);
+ tolua_tablevar(tolua_S,"player_type","supp",toluaI_get_player_player_type_supp,toluaI_set_player_player_type_supp);
+ tolua_tablevar(tolua_S,"player_type","supp_top",toluaI_get_player_player_type_supp_top,toluaI_set_player_player_type_supp_top);
+ tolua_tablevar(tolua_S,"player_type","support_timer",toluaI_get_player_player_type_support_timer,toluaI_set_player_player_type_support_timer);
+ tolua_tablevar(tolua_S,"player_type","updated_savegame",toluaI_get_player_player_type_updated_savegame,toluaI_set_player_player_type_updated_savegame);
+ tolua_tablevar(tolua_S,"player_type","artifact_reset",toluaI_get_player_player_type_artifact_reset,toluaI_set_player_player_type_artifact_reset);
+ tolua_tablevar(tolua_S,"player_type","fluent_artifact_reset",toluaI_get_player_player_type_fluent_artifact_reset,toluaI_set_player_player_type_fluent_artifact_reset);
+ tolua_tablevar(tolua_S,"player_type","corner_turn",toluaI_get_player_player_type_corner_turn,toluaI_set_player_player_type_corner_turn);
+ tolua_tablevar(tolua_S,"player_type","joke_weather",toluaI_get_player_player_type_joke_weather,toluaI_set_player_player_type_joke_weather);
+ tolua_tablevar(tolua_S,"player_type","has_pet",toluaI_get_player_player_type_has_pet,toluaI_set_player_player_type_has_pet);
+ tolua_tablearray(tolua_S,"player_type","global_event_type",toluaI_get_player_player_type_global_event_type,toluaI_set_player_player_type_global_event_type);
+ tolua_tablearray(tolua_S,"player_type","global_event_signup",toluaI_get_player_player_type_global_event_signup,toluaI_set_player_player_type_global_event_signup);
+ tolua_tablearray(tolua_S,"player_type","global_event_started",toluaI_get_player_player_type_global_event_started,toluaI_set_player_player_type_global_event_started);
+ tolua_tablearray(tolua_S,"player_type","global_event_participated",toluaI_get_player_player_type_global_event_participated,toluaI_set_player_player_type_global_event_participated);
+ tolua_tablevar(tolua_S,"player_type","combat_stance",toluaI_get_player_player_type_combat_stance,toluaI_set_player_player_type_combat_stance);
+ tolua_tablevar(tolua_S,"player_type","combat_stance_prev",toluaI_get_player_player_type_combat_stance_prev,toluaI_set_player_player_type_combat_stance_prev);
+ tolua_tablevar(tolua_S,"player_type","combat_stance_power",toluaI_get_player_player_type_combat_stance_power,toluaI_set_player_player_type_combat_stance_power);
+ tolua_tablevar(tolua_S,"player_type","shoot_till_kill",toluaI_get_player_player_type_shoot_till_kill,toluaI_set_player_player_type_shoot_till_kill);
+ tolua_tablevar(tolua_S,"player_type","shooty_till_kill",toluaI_get_player_player_type_shooty_till_kill,toluaI_set_player_player_type_shooty_till_kill);
+ tolua_tablevar(tolua_S,"player_type","shooting_till_kill",toluaI_get_player_player_type_shooting_till_kill,toluaI_set_player_player_type_shooting_till_kill);
+ tolua_tablevar(tolua_S,"player_type","shoot_till_kill_book",toluaI_get_player_player_type_shoot_till_kill_book,toluaI_set_player_player_type_shoot_till_kill_book);
+ tolua_tablevar(tolua_S,"player_type","shoot_till_kill_spell",toluaI_get_player_player_type_shoot_till_kill_spell,toluaI_set_player_player_type_shoot_till_kill_spell);
+ tolua_tablevar(tolua_S,"player_type","shoot_till_kill_mimic",toluaI_get_player_player_type_shoot_till_kill_mimic,toluaI_set_player_player_type_shoot_till_kill_mimic);
+ tolua_tablevar(tolua_S,"player_type","kills_own",toluaI_get_player_player_type_kills_own,toluaI_set_player_player_type_kills_own);
+ tolua_tablevar(tolua_S,"player_type","kills",toluaI_get_player_player_type_kills,toluaI_set_player_player_type_kills);
+ tolua_tablevar(tolua_S,"player_type","kills_lower",toluaI_get_player_player_type_kills_lower,toluaI_set_player_player_type_kills_lower);
+ tolua_tablevar(tolua_S,"player_type","kills_higher",toluaI_get_player_player_type_kills_higher,toluaI_set_player_player_type_kills_higher);
+ tolua_tablevar(tolua_S,"player_type","kills_equal",toluaI_get_player_player_type_kills_equal,toluaI_set_player_player_type_kills_equal);
+ tolua_tablevar(tolua_S,"player_type","free_mimic",toluaI_get_player_player_type_free_mimic,toluaI_set_player_player_type_free_mimic);
+ tolua_tablevar(tolua_S,"player_type","pvp_prevent_tele",toluaI_get_player_player_type_pvp_prevent_tele,toluaI_set_player_player_type_pvp_prevent_tele);
+ tolua_tablevar(tolua_S,"player_type","heal_effect",toluaI_get_player_player_type_heal_effect,toluaI_set_player_player_type_heal_effect);
+ tolua_tablevar(tolua_S,"player_type","mcharming",toluaI_get_player_player_type_mcharming,toluaI_set_player_player_type_mcharming);
+ tolua_tablevar(tolua_S,"player_type","turns_on_floor",toluaI_get_player_player_type_turns_on_floor,toluaI_set_player_player_type_turns_on_floor);
+ tolua_tablevar(tolua_S,"player_type","dual_mode",toluaI_get_player_player_type_dual_mode,toluaI_set_player_player_type_dual_mode);
+ tolua_tablevar(tolua_S,"player_type","tim_reflect",toluaI_get_player_player_type_tim_reflect,toluaI_set_player_player_type_tim_reflect);
+ tolua_tablevar(tolua_S,"player_type","panel_changed",toluaI_get_player_player_type_panel_changed,toluaI_set_player_player_type_panel_changed);
+ tolua_tablevar(tolua_S,"player_type","warning_bpr",toluaI_get_player_player_type_warning_bpr,toluaI_set_player_player_type_warning_bpr);
+ tolua_tablevar(tolua_S,"player_type","warning_bpr2",toluaI_get_player_player_type_warning_bpr2,toluaI_set_player_player_type_warning_bpr2);
+ tolua_tablevar(tolua_S,"player_type","warning_bpr3",toluaI_get_player_player_type_warning_bpr3,toluaI_set_player_player_type_warning_bpr3);
+ tolua_tablevar(tolua_S,"player_type","warning_run",toluaI_get_player_player_type_warning_run,toluaI_set_player_player_type_warning_run);
+ tolua_tablevar(tolua_S,"player_type","warning_run_steps",toluaI_get_player_player_type_warning_run_steps,toluaI_set_player_player_type_warning_run_steps);
+ tolua_tablevar(tolua_S,"player_type","warning_run_monlos",toluaI_get_player_player_type_warning_run_monlos,toluaI_set_player_player_type_warning_run_monlos);
+ tolua_tablevar(tolua_S,"player_type","warning_wield",toluaI_get_player_player_type_warning_wield,toluaI_set_player_player_type_warning_wield);
+ tolua_tablevar(tolua_S,"player_type","warning_chat",toluaI_get_player_player_type_warning_chat,toluaI_set_player_player_type_warning_chat);
+ tolua_tablevar(tolua_S,"player_type","warning_lite",toluaI_get_player_player_type_warning_lite,toluaI_set_player_player_type_warning_lite);
+ tolua_tablevar(tolua_S,"player_type","warning_rest",toluaI_get_player_player_type_warning_rest,toluaI_set_player_player_type_warning_rest);
+ tolua_tablevar(tolua_S,"player_type","warning_rest_cooldown",toluaI_get_player_player_type_warning_rest_cooldown,toluaI_set_player_player_type_warning_rest_cooldown);
+ tolua_tablevar(tolua_S,"player_type","warning_mimic",toluaI_get_player_player_type_warning_mimic,toluaI_set_player_player_type_warning_mimic);
+ tolua_tablevar(tolua_S,"player_type","warning_dual",toluaI_get_player_player_type_warning_dual,toluaI_set_player_player_type_warning_dual);
+ tolua_tablevar(tolua_S,"player_type","warning_potions",toluaI_get_player_player_type_warning_potions,toluaI_set_player_player_type_warning_potions);
+ tolua_tablevar(tolua_S,"player_type","warning_wor",toluaI_get_player_player_type_warning_wor,toluaI_set_player_player_type_warning_wor);
+ tolua_tablevar(tolua_S,"player_type","warning_wor2",toluaI_get_player_player_type_warning_wor2,toluaI_set_player_player_type_warning_wor2);
+ tolua_tablevar(tolua_S,"player_type","warning_ghost",toluaI_get_player_player_type_warning_ghost,toluaI_set_player_player_type_warning_ghost);
+ tolua_tablevar(tolua_S,"player_type","warning_instares",toluaI_get_player_player_type_warning_instares,toluaI_set_player_player_type_warning_instares);
+ tolua_tablevar(tolua_S,"player_type","warning_ma_weapon",toluaI_get_player_player_type_warning_ma_weapon,toluaI_set_player_player_type_warning_ma_weapon);
+ tolua_tablevar(tolua_S,"player_type","warning_ma_shield",toluaI_get_player_player_type_warning_ma_shield,toluaI_set_player_player_type_warning_ma_shield);
+ tolua_tablevar(tolua_S,"player_type","warning_repair",toluaI_get_player_player_type_warning_repair,toluaI_set_player_player_type_warning_repair);
+ tolua_tablevar(tolua_S,"player_type","warning_depth",toluaI_get_player_player_type_warning_depth,toluaI_set_player_player_type_warning_depth);
+ tolua_tablevar(tolua_S,"player_type","warning_partyexp",toluaI_get_player_player_type_warning_partyexp,toluaI_set_player_player_type_warning_partyexp);
+ tolua_tablevar(tolua_S,"player_type","music_current",toluaI_get_player_player_type_music_current,toluaI_set_player_player_type_music_current);
+ tolua_tablevar(tolua_S,"player_type","musicalt_current",toluaI_get_player_player_type_musicalt_current,toluaI_set_player_player_type_musicalt_current);
+ tolua_tablevar(tolua_S,"player_type","musicalt2_current",toluaI_get_player_player_type_musicalt2_current,toluaI_set_player_player_type_musicalt2_current);
+ tolua_tablevar(tolua_S,"player_type","music_monster",toluaI_get_player_player_type_music_monster,toluaI_set_player_player_type_music_monster);
+ tolua_tablevar(tolua_S,"player_type","audio_sfx",toluaI_get_player_player_type_audio_sfx,toluaI_set_player_player_type_audio_sfx);
+ tolua_tablevar(tolua_S,"player_type","audio_mus",toluaI_get_player_player_type_audio_mus,toluaI_set_player_player_type_audio_mus);
+ tolua_tablevar(tolua_S,"player_type","sound_ambient",toluaI_get_player_player_type_sound_ambient,toluaI_set_player_player_type_sound_ambient);
+ tolua_tablevar(tolua_S,"player_type","custom_font",toluaI_get_player_player_type_custom_font,toluaI_set_player_player_type_custom_font);
+ tolua_tablevar(tolua_S,"player_type","admin_stasis",toluaI_get_player_player_type_admin_stasis,toluaI_set_player_player_type_admin_stasis);
+ tolua_tablevar(tolua_S,"player_type","admin_godly_strike",toluaI_get_player_player_type_admin_godly_strike,toluaI_set_player_player_type_admin_godly_strike);
+ tolua_tablevar(tolua_S,"player_type","admin_set_defeat",toluaI_get_player_player_type_admin_set_defeat,toluaI_set_player_player_type_admin_set_defeat);
+ tolua_tablevar(tolua_S,"player_type","player_sees_dm",toluaI_get_player_player_type_player_sees_dm,toluaI_set_player_player_type_player_sees_dm);
+ tolua_tablevar(tolua_S,"player_type","instakills",toluaI_get_player_player_type_instakills,toluaI_set_player_player_type_instakills);
+ tolua_tablevar(tolua_S,"player_type","go_level",toluaI_get_player_player_type_go_level,toluaI_set_player_player_type_go_level);
+ tolua_tablevar(tolua_S,"player_type","go_sublevel",toluaI_get_player_player_type_go_sublevel,toluaI_set_player_player_type_go_sublevel);
+ tolua_tablevar(tolua_S,"player_type","vampiric_melee",toluaI_get_player_player_type_vampiric_melee,toluaI_set_player_player_type_vampiric_melee);
+ tolua_tablevar(tolua_S,"player_type","vampiric_ranged",toluaI_get_player_player_type_vampiric_ranged,toluaI_set_player_player_type_vampiric_ranged);
+ tolua_tablevar(tolua_S,"player_type","IDDC_found_rndtown",toluaI_get_player_player_type_IDDC_found_rndtown,toluaI_set_player_player_type_IDDC_found_rndtown);
+ tolua_tablevar(tolua_S,"player_type","IDDC_logscum",toluaI_get_player_player_type_IDDC_logscum,toluaI_set_player_player_type_IDDC_logscum);
+ tolua_tablevar(tolua_S,"player_type","IDDC_freepass",toluaI_get_player_player_type_IDDC_freepass,toluaI_set_player_player_type_IDDC_freepass);
+ tolua_tablevar(tolua_S,"player_type","IDDC_flags",toluaI_get_player_player_type_IDDC_flags,toluaI_set_player_player_type_IDDC_flags);
+ tolua_tablevar(tolua_S,"player_type","insta_res",toluaI_get_player_player_type_insta_res,toluaI_set_player_player_type_insta_res);
+ tolua_tablevar(tolua_S,"player_type","hilite_player",toluaI_get_player_player_type_hilite_player,toluaI_set_player_player_type_hilite_player);
+ tolua_tablevar(tolua_S,"player_type","basic_players_symb",toluaI_get_player_player_type_basic_players_symb,toluaI_set_player_player_type_basic_players_symb);
+ tolua_tablevar(tolua_S,"player_type","basic_players_col",toluaI_get_player_player_type_basic_players_col,toluaI_set_player_player_type_basic_players_col);
+ tolua_tablevar(tolua_S,"player_type","distinct_floor_feeling",toluaI_get_player_player_type_distinct_floor_feeling,toluaI_set_player_player_type_distinct_floor_feeling);
+ tolua_tablevar(tolua_S,"player_type","exp_bar",toluaI_get_player_player_type_exp_bar,toluaI_set_player_player_type_exp_bar);
+ tolua_tablevar(tolua_S,"player_type","limit_spells",toluaI_get_player_player_type_limit_spells,toluaI_set_player_player_type_limit_spells);
+ tolua_tablevar(tolua_S,"player_type","temp_misc_1",toluaI_get_player_player_type_temp_misc_1,toluaI_set_player_player_type_temp_misc_1);
+ tolua_tablevar(tolua_S,"player_type","temp_misc_2",toluaI_get_player_player_type_temp_misc_2,toluaI_set_player_player_type_temp_misc_2);
+ tolua_tablevar(tolua_S,"player_type","temp_misc_3",toluaI_get_player_player_type_temp_misc_3,toluaI_set_player_player_type_temp_misc_3);
+ tolua_tablevar(tolua_S,"player_type","solo_reking",toluaI_get_player_player_type_solo_reking,toluaI_set_player_player_type_solo_reking);
+ tolua_tablevar(tolua_S,"player_type","solo_reking_au",toluaI_get_player_player_type_solo_reking_au,toluaI_set_player_player_type_solo_reking_au);
+ tolua_tablevar(tolua_S,"player_type","solo_reking_laston",toluaI_get_player_player_type_solo_reking_laston,toluaI_set_player_player_type_solo_reking_laston);
+ tolua_tablevar(tolua_S,"player_type","item_order_store",toluaI_get_player_player_type_item_order_store,toluaI_set_player_player_type_item_order_store);
+ tolua_tablevar(tolua_S,"player_type","item_order_town",toluaI_get_player_player_type_item_order_town,toluaI_set_player_player_type_item_order_town);
+ tolua_tablevar(tolua_S,"player_type","item_order_rarity",toluaI_get_player_player_type_item_order_rarity,toluaI_set_player_player_type_item_order_rarity);
+ tolua_tablevar(tolua_S,"player_type","item_order_forge",toluaI_get_player_player_type_item_order_forge,toluaI_set_player_player_type_item_order_forge);
+ tolua_tablevar(tolua_S,"player_type","item_order_cost",toluaI_get_player_player_type_item_order_cost,toluaI_set_player_player_type_item_order_cost);
+ tolua_tablevar(tolua_S,"player_type","item_order_turn",toluaI_get_player_player_type_item_order_turn,toluaI_set_player_player_type_item_order_turn);
+ tolua_tablevar(tolua_S,"player_type","iron_trade",toluaI_get_player_player_type_iron_trade,toluaI_set_player_player_type_iron_trade);
+ tolua_tablevar(tolua_S,"player_type","iron_turn",toluaI_get_player_player_type_iron_turn,toluaI_set_player_player_type_iron_turn);
+ tolua_tablevar(tolua_S,"player_type","font_map_solid_walls",toluaI_get_player_player_type_font_map_solid_walls,toluaI_set_player_player_type_font_map_solid_walls);
+ tolua_tablevar(tolua_S,"player_type","solid_bars",toluaI_get_player_player_type_solid_bars,toluaI_set_player_player_type_solid_bars);
+ tolua_tablevar(tolua_S,"player_type","diz_unique",toluaI_get_player_player_type_diz_unique,toluaI_set_player_player_type_diz_unique);
+ tolua_tablevar(tolua_S,"player_type","diz_death",toluaI_get_player_player_type_diz_death,toluaI_set_player_player_type_diz_death);
+ tolua_tablevar(tolua_S,"player_type","diz_death_any",toluaI_get_player_player_type_diz_death_any,toluaI_set_player_player_type_diz_death_any);
+ tolua_tablevar(tolua_S,"player_type","diz_first",toluaI_get_player_player_type_diz_first,toluaI_set_player_player_type_diz_first);
+ tolua_tablevar(tolua_S,"player_type","palette_animation",toluaI_get_player_player_type_palette_animation,toluaI_set_player_player_type_palette_animation);
+ tolua_tablevar(tolua_S,"player_type","mute_when_idle",toluaI_get_player_player_type_mute_when_idle,toluaI_set_player_player_type_mute_when_idle);
+ tolua_tablevar(tolua_S,"player_type","censor_swearing",toluaI_get_player_player_type_censor_swearing,toluaI_set_player_player_type_censor_swearing);
+ tolua_tablevar(tolua_S,"player_type","keep_bottle",toluaI_get_player_player_type_keep_bottle,toluaI_set_player_player_type_keep_bottle);
+ tolua_tablevar(tolua_S,"player_type","no_house_magic",toluaI_get_player_player_type_no_house_magic,toluaI_set_player_player_type_no_house_magic);
+ tolua_tablevar(tolua_S,"player_type","steamblast",toluaI_get_player_player_type_steamblast,toluaI_set_player_player_type_steamblast);
+ tolua_tablevar(tolua_S,"player_type","player_list_window",toluaI_get_player_player_type_player_list_window,toluaI_set_player_player_type_player_list_window);
+ tolua_tablevar(tolua_S,"player_type","item_newest",toluaI_get_player_player_type_item_newest,toluaI_set_player_player_type_item_newest);
+ tolua_tablevar(tolua_S,"player_type","item_newest_2nd",toluaI_get_player_player_type_item_newest_2nd,toluaI_set_player_player_type_item_newest_2nd);
+ tolua_tablevar(tolua_S,"player_type","add_kind_diz",toluaI_get_player_player_type_add_kind_diz,toluaI_set_player_player_type_add_kind_diz);
+ tolua_tablevar(tolua_S,"player_type","hide_lore_paste",toluaI_get_player_player_type_hide_lore_paste,toluaI_set_player_player_type_hide_lore_paste);
+ tolua_tablevar(tolua_S,"player_type","new_retaliator",toluaI_get_player_player_type_new_retaliator,toluaI_set_player_player_type_new_retaliator);
+ tolua_tablevar(tolua_S,"player_type","sunburn_msg",toluaI_get_player_player_type_sunburn_msg,toluaI_set_player_player_type_sunburn_msg);
+ tolua_function(tolua_S,NULL,"imprison",toluaI_player_imprison00);
+ tolua_function(tolua_S,NULL,"check_antimagic",toluaI_player_check_antimagic00);
+ tolua_globalvar(tolua_S,"NumPlayers",toluaI_get_player_NumPlayers,toluaI_set_player_NumPlayers);
+ tolua_globalarray(tolua_S,"Players_real",toluaI_get_player_Players_real,toluaI_set_player_Players_real);
+ tolua_function(tolua_S,NULL,"get_playerind",toluaI_player_get_playerind00);
+ tolua_function(tolua_S,NULL,"get_playerind_loose",toluaI_player_get_playerind_loose00);
+ tolua_function(tolua_S,NULL,"get_playerslot_loose",toluaI_player_get_playerslot_loose00);
+ tolua_function(tolua_S,NULL,"no_lite",toluaI_player_no_lite00);
+ tolua_function(tolua_S,NULL,"can_use",toluaI_player_can_use00);
+ tolua_function(tolua_S,NULL,"can_use_verbose",toluaI_player_can_use_verbose00);
+ tolua_function(tolua_S,NULL,"interfere",toluaI_player_interfere00);
+ tolua_function(tolua_S,NULL,"telekinesis",toluaI_player_telekinesis00);
+ tolua_function(tolua_S,NULL,"telekinesis_aux",toluaI_player_telekinesis_aux00);
+ tolua_function(tolua_S,NULL,"recall_player",toluaI_player_recall_player00);
+ tolua_function(tolua_S,NULL,"apply_dodge_chance",toluaI_player_apply_dodge_chance00);
+ tolua_function(tolua_S,NULL,"respec_skill",toluaI_player_respec_skill00);
+ tolua_function(tolua_S,NULL,"respec_skills",toluaI_player_respec_skills00);
+ tolua_function(tolua_S,NULL,"invested_skill_points",toluaI_player_invested_skill_points00);
+ tolua_function(tolua_S,NULL,"get_inven_sval",toluaI_player_get_inven_sval00);
+ tolua_function(tolua_S,NULL,"get_inven_xtra",toluaI_player_get_inven_xtra00);
+ tolua_cclass(tolua_S,"player_race","");
+ tolua_tablevar(tolua_S,"player_race","title",toluaI_get_player_player_race_title,toluaI_set_player_player_race_title);
+ tolua_tablevar(tolua_S,"player_race","choice",toluaI_get_player_player_race_choice,toluaI_set_player_player_race_choice);
+ tolua_globalarray(tolua_S,"race_info",toluaI_get_player_race_info,toluaI_set_player_race_info);
+ tolua_cclass(tolua_S,"player_class","");
+ tolua_tablevar(tolua_S,"player_class","title",toluaI_get_player_player_class_title,toluaI_set_player_player_class_title);
+ tolua_tablevar(tolua_S,"player_class","color",toluaI_get_player_player_class_color,toluaI_set_player_player_class_color);
+ tolua_globalarray(tolua_S,"class_info",toluaI_get_player_class_info,toluaI_set_player_class_info);
+ tolua_cclass(tolua_S,"player_trait","");
+ tolua_tablevar(tolua_S,"player_trait","title",toluaI_get_player_player_trait_title,toluaI_set_player_player_trait_title);
+ tolua_tablevar(tolua_S,"player_trait","choice",toluaI_get_player_player_trait_choice,toluaI_set_player_player_trait_choice);
+ tolua_globalarray(tolua_S,"trait_info",toluaI_get_player_trait_info,toluaI_set_player_trait_info);
+ tolua_function(tolua_S,NULL,"do_mimic_change",toluaI_player_do_mimic_change00);
+ tolua_function(tolua_S,NULL,"shape_Maia_skills",toluaI_player_shape_Maia_skills00);
+ tolua_function(tolua_S,NULL,"gain_exp",toluaI_player_gain_exp00);
+ tolua_function(tolua_S,NULL,"lua_fix_max_depth",toluaI_player_lua_fix_max_depth00);
+ tolua_function(tolua_S,NULL,"lua_fix_max_depth_bug",toluaI_player_lua_fix_max_depth_bug00);
+ tolua_function(tolua_S,NULL,"lua_fix_acc_house_limit",toluaI_player_lua_fix_acc_house_limit00);
+ tolua_function(tolua_S,NULL,"lua_wish",toluaI_player_lua_wish00);
+ tolua_globalvar(tolua_S,"player_id",toluaI_get_player_player_id,toluaI_set_player_player_id);
+ tolua_globalvar(tolua_S,"account_id",toluaI_get_player_account_id,toluaI_set_player_account_id);
+ tolua_function(tolua_S,NULL,"disturb",toluaI_player_disturb00);
+ tolua_function(tolua_S,NULL,"lua_get_subinven_item",toluaI_player_lua_get_subinven_item00);
+ tolua_function(tolua_S,NULL,"gain_exp_to_level",toluaI_player_gain_exp_to_level00);
+ return 1;
+}
+/* Close function */
+void tolua_player_close (lua_State* tolua_S)
+{
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PW_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PY_FOOD_MAX");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PY_FOOD_FULL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"INVEN_PACK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"INVEN_WIELD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"INVEN_TOTAL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"A_STR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"A_INT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"A_WIS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"A_DEX");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"A_CON");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"A_CHR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_HUMAN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_HALF_ELF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_ELF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_HOBBIT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_GNOME");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_DWARF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_HALF_ORC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_HALF_TROLL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_DUNADAN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_HIGH_ELF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_YEEK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_GOBLIN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_ENT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_DRACONIAN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_KOBOLD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_DARK_ELF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_VAMPIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"RACE_MAIA");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_WARRIOR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_MAGE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_PRIEST");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_ROGUE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_MIMIC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_ARCHER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_PALADIN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_RANGER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_ADVENTURER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_DRUID");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_SHAMAN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_RUNEMASTER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_MINDCRAFTER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_DEATHKNIGHT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_HELLKNIGHT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLASS_CPRIEST");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TRAIT_ENLIGHTENED");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TRAIT_CORRUPTED");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_MAX");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_STEP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_EXCLUSIVE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_COMBAT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_MASTERY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SWORD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_CRITS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_POLEARM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_BLUNT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_ARCHERY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SLING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_BOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_XBOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_BACKSTAB");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_MAGIC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SHOOT_TILL_KILL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SORCERY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_MAGERY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_MIMIC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_DEVICE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SHADOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_PRAY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SPELLLENGTH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SNEAKINESS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_DISARM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_STEALTH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_STEALING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_NECROMANCY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_ANTIMAGIC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_TRAUMATURGY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_AURA_FEAR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_AURA_SHIVER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_AURA_DEATH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_HUNTING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_TECHNIQUE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_MISC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_AGILITY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_CALMNESS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SWIM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_MARTIAL_ARTS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_RICOCHET");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_BOOMERANG");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_TRAINING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_INTERCEPT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_DODGE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_HEALTH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_DIG");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SPELLRAD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_TRAPPING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_AXE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_CONVEYANCE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SPELL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_MANA");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_FIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_AIR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_WATER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_NATURE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_EARTH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_DIVINATION");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_TEMPORAL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_META");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_MIND");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_UDUN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SCHOOL_CRAFTING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_WEAPONSMITHING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_ARMOURSMITHING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_FLETCHING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_JEWELCRAFT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_TOOLCRAFT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_TAILORING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_ALCHEMY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_ENCHANTING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_HOFFENSE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_HDEFENSE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_HCURING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_HSUPPORT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_DRUID_ARCANE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_DRUID_PHYSICAL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_ASTRAL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_DUAL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_STANCE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_PPOWER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_ATTUNEMENT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_MINTRUSION");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SCHOOL_MAGIC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SCHOOL_PRAYING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SCHOOL_DRUIDISM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SCHOOL_MINDCRAFT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_OSHADOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_OSPIRIT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SCHOOL_OCCULT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_OHERETICISM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_OUNLIFE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_CLIMB");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_LEVITATE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_FREEACT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_RESCONF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SCHOOL_RUNECRAFT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_R_LITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_R_DARK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_R_NEXU");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_R_NETH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_R_CHAO");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_R_MANA");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SOULFEASTING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_SUMMONING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_TAMING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_BLOOD_MAGIC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_BREATH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SKILL_PICK_BREATH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"MAX_SKILLS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"worldpos");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"object_type");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"skill_player");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"version_type");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"inventory_change_type");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"player_type");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"imprison");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"check_antimagic");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"NumPlayers"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"Players_real");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"get_playerind");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"get_playerind_loose");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"get_playerslot_loose");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"no_lite");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"can_use");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"can_use_verbose");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"interfere");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"telekinesis");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"telekinesis_aux");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"recall_player");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"apply_dodge_chance");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"respec_skill");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"respec_skills");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"invested_skill_points");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"get_inven_sval");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"get_inven_xtra");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"player_race");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"race_info");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"player_class");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"class_info");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"player_trait");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"trait_info");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_mimic_change");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"shape_Maia_skills");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"gain_exp");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_fix_max_depth");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_fix_max_depth_bug");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_fix_acc_house_limit");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_wish");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"player_id"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"account_id"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"disturb");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_get_subinven_item");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"gain_exp_to_level");
+}
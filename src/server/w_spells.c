@@ -0,0 +1,9666 @@
+/*
+** Lua binding: spells
+** Generated automatically by tolua 4.0a - angband on Mon Oct 19 05:17:07 2026.
+*/
+
+#include "lua/tolua.h"
+
+/* Exported function */
+int tolua_spells_open (lua_State* tolua_S);
+void tolua_spells_close (lua_State* tolua_S);
+
+#define SERVER
+#include "angband.h"
+#include "lua.h"
+
+/* function to register type */
+static void toluaI_reg_types (lua_State* tolua_S)
+{
+ tolua_usertype(tolua_S,"inven_func");
+ tolua_usertype(tolua_S,"object_type");
+ tolua_usertype(tolua_S,"worldpos");
+ tolua_usertype(tolua_S,"spell_type");
+ tolua_usertype(tolua_S,"school_type");
+ tolua_usertype(tolua_S,"player_type");
+}
+
+/* error messages */
+#define TOLUA_ERR_SELF tolua_error(tolua_S,"invalid 'self'")
+#define TOLUA_ERR_ASSIGN tolua_error(tolua_S,"#vinvalid type in variable assignment.")
+
+/* function: warding_glyph */
+static int toluaI_spells_warding_glyph00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  warding_glyph(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'warding_glyph'.");
+ return 0;
+}
+
+/* function: cave_set_feat */
+static int toluaI_spells_cave_set_feat00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+  int feat = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  int toluaI_ret = (int)  cave_set_feat(wpos,y,x,feat);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cave_set_feat'.");
+ return 0;
+}
+
+/* function: cave_set_feat_live */
+static int toluaI_spells_cave_set_feat_live00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+  int feat = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  cave_set_feat_live(wpos,y,x,feat);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cave_set_feat_live'.");
+ return 0;
+}
+
+/* function: custom_cave_set_feat */
+static int toluaI_spells_custom_cave_set_feat00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,8,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,9,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,10,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,11,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,12,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,13)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+  int feat = ((int)  tolua_getnumber(tolua_S,4,0));
+  s16b custom_lua_tunnel_hand = ((s16b)  tolua_getnumber(tolua_S,5,0));
+  s16b custom_lua_tunnel = ((s16b)  tolua_getnumber(tolua_S,6,0));
+  s16b custom_lua_search = ((s16b)  tolua_getnumber(tolua_S,7,0));
+  byte custom_lua_search_diff_minus = ((byte)  tolua_getnumber(tolua_S,8,0));
+  byte custom_lua_search_diff_chance = ((byte)  tolua_getnumber(tolua_S,9,0));
+  s16b custom_lua_newlivefeat = ((s16b)  tolua_getnumber(tolua_S,10,0));
+  s16b custom_lua_way = ((s16b)  tolua_getnumber(tolua_S,11,0));
+  s16b custom_lua_spawned = ((s16b)  tolua_getnumber(tolua_S,12,0));
+ {
+  custom_cave_set_feat(wpos,y,x,feat,custom_lua_tunnel_hand,custom_lua_tunnel,custom_lua_search,custom_lua_search_diff_minus,custom_lua_search_diff_chance,custom_lua_newlivefeat,custom_lua_way,custom_lua_spawned);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'custom_cave_set_feat'.");
+ return 0;
+}
+
+/* function: custom_cave_set_feat_live */
+static int toluaI_spells_custom_cave_set_feat_live00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,8,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,9,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,10,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,11,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,12,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,13)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+  int feat = ((int)  tolua_getnumber(tolua_S,4,0));
+  s16b custom_lua_tunnel_hand = ((s16b)  tolua_getnumber(tolua_S,5,0));
+  s16b custom_lua_tunnel = ((s16b)  tolua_getnumber(tolua_S,6,0));
+  s16b custom_lua_search = ((s16b)  tolua_getnumber(tolua_S,7,0));
+  byte custom_lua_search_diff_minus = ((byte)  tolua_getnumber(tolua_S,8,0));
+  byte custom_lua_search_diff_chance = ((byte)  tolua_getnumber(tolua_S,9,0));
+  s16b custom_lua_newlivefeat = ((s16b)  tolua_getnumber(tolua_S,10,0));
+  s16b custom_lua_way = ((s16b)  tolua_getnumber(tolua_S,11,0));
+  s16b custom_lua_spawned = ((s16b)  tolua_getnumber(tolua_S,12,0));
+ {
+  bool toluaI_ret = (bool)  custom_cave_set_feat_live(wpos,y,x,feat,custom_lua_tunnel_hand,custom_lua_tunnel,custom_lua_search,custom_lua_search_diff_minus,custom_lua_search_diff_chance,custom_lua_newlivefeat,custom_lua_way,custom_lua_spawned);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'custom_cave_set_feat_live'.");
+ return 0;
+}
+
+/* function: check_feat */
+static int toluaI_spells_check_feat00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  int toluaI_ret = (int)  check_feat(wpos,y,x);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'check_feat'.");
+ return 0;
+}
+
+/* function: dun_get_wid */
+static int toluaI_spells_dun_get_wid00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  dun_get_wid(wpos);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'dun_get_wid'.");
+ return 0;
+}
+
+/* function: dun_get_hgt */
+static int toluaI_spells_dun_get_hgt00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  dun_get_hgt(wpos);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'dun_get_hgt'.");
+ return 0;
+}
+
+/* function: check_monster */
+static int toluaI_spells_check_monster00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  int toluaI_ret = (int)  check_monster(wpos,y,x);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'check_monster'.");
+ return 0;
+}
+
+/* function: check_monster_ego */
+static int toluaI_spells_check_monster_ego00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  int toluaI_ret = (int)  check_monster_ego(wpos,y,x);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'check_monster_ego'.");
+ return 0;
+}
+
+/* function: check_item_tval */
+static int toluaI_spells_check_item_tval00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  int toluaI_ret = (int)  check_item_tval(wpos,y,x);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'check_item_tval'.");
+ return 0;
+}
+
+/* function: check_item_sval */
+static int toluaI_spells_check_item_sval00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  int toluaI_ret = (int)  check_item_sval(wpos,y,x);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'check_item_sval'.");
+ return 0;
+}
+
+/* function: custom_place_item_module */
+static int toluaI_spells_custom_place_item_module00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,8,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,9,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,10,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,11)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+  int tval = ((int)  tolua_getnumber(tolua_S,4,0));
+  int sval = ((int)  tolua_getnumber(tolua_S,5,0));
+  s16b custom_lua_carrystate = ((s16b)  tolua_getnumber(tolua_S,6,0));
+  s16b custom_lua_equipstate = ((s16b)  tolua_getnumber(tolua_S,7,0));
+  s16b custom_lua_destruction = ((s16b)  tolua_getnumber(tolua_S,8,0));
+  s16b custom_lua_usage = ((s16b)  tolua_getnumber(tolua_S,9,0));
+  s16b custom_lua_spawned = ((s16b)  tolua_getnumber(tolua_S,10,0));
+ {
+  int toluaI_ret = (int)  custom_place_item_module(wpos,y,x,tval,sval,custom_lua_carrystate,custom_lua_equipstate,custom_lua_destruction,custom_lua_usage,custom_lua_spawned);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'custom_place_item_module'.");
+ return 0;
+}
+
+/* function: place_item_module */
+static int toluaI_spells_place_item_module00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,6)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+  int tval = ((int)  tolua_getnumber(tolua_S,4,0));
+  int sval = ((int)  tolua_getnumber(tolua_S,5,0));
+ {
+  int toluaI_ret = (int)  place_item_module(wpos,y,x,tval,sval);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'place_item_module'.");
+ return 0;
+}
+
+/* function: place_monster_ego */
+static int toluaI_spells_place_monster_ego00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,8,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,9,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,10)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+  int r_idx = ((int)  tolua_getnumber(tolua_S,4,0));
+  int e_idx = ((int)  tolua_getnumber(tolua_S,5,0));
+  bool slp = ((bool)  tolua_getnumber(tolua_S,6,0));
+  bool grp = ((bool)  tolua_getnumber(tolua_S,7,0));
+  int clo = ((int)  tolua_getnumber(tolua_S,8,0));
+  int clone_summoning = ((int)  tolua_getnumber(tolua_S,9,0));
+ {
+  int toluaI_ret = (int)  place_monster_ego(wpos,y,x,r_idx,e_idx,slp,grp,clo,clone_summoning);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'place_monster_ego'.");
+ return 0;
+}
+
+/* function: custom_place_monster_ego */
+static int toluaI_spells_custom_place_monster_ego00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,8,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,9,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,10,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,11,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,12,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,13,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,14,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,15,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,16)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+  int r_idx = ((int)  tolua_getnumber(tolua_S,4,0));
+  int e_idx = ((int)  tolua_getnumber(tolua_S,5,0));
+  bool slp = ((bool)  tolua_getnumber(tolua_S,6,0));
+  bool grp = ((bool)  tolua_getnumber(tolua_S,7,0));
+  int clo = ((int)  tolua_getnumber(tolua_S,8,0));
+  int clone_summoning = ((int)  tolua_getnumber(tolua_S,9,0));
+  s32b custom_xp = ((s32b)  tolua_getnumber(tolua_S,10,0));
+  s16b custom_lua_death = ((s16b)  tolua_getnumber(tolua_S,11,0));
+  s16b custom_lua_deletion = ((s16b)  tolua_getnumber(tolua_S,12,0));
+  s16b custom_lua_awoke = ((s16b)  tolua_getnumber(tolua_S,13,0));
+  s16b custom_lua_sighted = ((s16b)  tolua_getnumber(tolua_S,14,0));
+  s16b custom_lua_spawned = ((s16b)  tolua_getnumber(tolua_S,15,0));
+ {
+  int toluaI_ret = (int)  custom_place_monster_ego(wpos,y,x,r_idx,e_idx,slp,grp,clo,clone_summoning,custom_xp,custom_lua_death,custom_lua_deletion,custom_lua_awoke,custom_lua_sighted,custom_lua_spawned);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'custom_place_monster_ego'.");
+ return 0;
+}
+
+/* function: players_on_depth */
+static int toluaI_spells_players_on_depth00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  players_on_depth(wpos);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'players_on_depth'.");
+ return 0;
+}
+
+/* function: level_up_x */
+static int toluaI_spells_level_up_x00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+ {
+  byte toluaI_ret = (byte)  level_up_x(wpos);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'level_up_x'.");
+ return 0;
+}
+
+/* function: level_up_y */
+static int toluaI_spells_level_up_y00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+ {
+  byte toluaI_ret = (byte)  level_up_y(wpos);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'level_up_y'.");
+ return 0;
+}
+
+/* function: level_down_x */
+static int toluaI_spells_level_down_x00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+ {
+  byte toluaI_ret = (byte)  level_down_x(wpos);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'level_down_x'.");
+ return 0;
+}
+
+/* function: level_down_y */
+static int toluaI_spells_level_down_y00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+ {
+  byte toluaI_ret = (byte)  level_down_y(wpos);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'level_down_y'.");
+ return 0;
+}
+
+/* function: level_rand_x */
+static int toluaI_spells_level_rand_x00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+ {
+  byte toluaI_ret = (byte)  level_rand_x(wpos);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'level_rand_x'.");
+ return 0;
+}
+
+/* function: level_rand_y */
+static int toluaI_spells_level_rand_y00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+ {
+  byte toluaI_ret = (byte)  level_rand_y(wpos);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'level_rand_y'.");
+ return 0;
+}
+
+/* function: new_level_up_x */
+static int toluaI_spells_new_level_up_x00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int x = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  new_level_up_x(wpos,x);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new_level_up_x'.");
+ return 0;
+}
+
+/* function: new_level_up_y */
+static int toluaI_spells_new_level_up_y00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  new_level_up_y(wpos,y);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new_level_up_y'.");
+ return 0;
+}
+
+/* function: new_level_down_x */
+static int toluaI_spells_new_level_down_x00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int x = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  new_level_down_x(wpos,x);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new_level_down_x'.");
+ return 0;
+}
+
+/* function: new_level_down_y */
+static int toluaI_spells_new_level_down_y00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  new_level_down_y(wpos,y);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new_level_down_y'.");
+ return 0;
+}
+
+/* function: new_level_rand_x */
+static int toluaI_spells_new_level_rand_x00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int x = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  new_level_rand_x(wpos,x);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new_level_rand_x'.");
+ return 0;
+}
+
+/* function: new_level_rand_y */
+static int toluaI_spells_new_level_rand_y00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  new_level_rand_y(wpos,y);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new_level_rand_y'.");
+ return 0;
+}
+
+/* function: make_wpos */
+static int toluaI_spells_make_wpos00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int wx = ((int)  tolua_getnumber(tolua_S,1,0));
+  int wy = ((int)  tolua_getnumber(tolua_S,2,0));
+  int wz = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  struct worldpos toluaI_ret = (struct worldpos)  make_wpos(wx,wy,wz);
+ {
+#ifdef __cplusplus
+ void* toluaI_clone = new worldpos(toluaI_ret);
+#else
+ void* toluaI_clone = tolua_copy(tolua_S,(void*)&toluaI_ret,sizeof(worldpos));
+#endif
+ tolua_pushusertype(tolua_S,tolua_doclone(tolua_S,toluaI_clone,tolua_tag(tolua_S,"worldpos")),tolua_tag(tolua_S,"worldpos"));
+ }
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'make_wpos'.");
+ return 0;
+}
+
+/* function: summon_override */
+static int toluaI_spells_summon_override00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  bool force = ((bool)  tolua_getnumber(tolua_S,1,0));
+ {
+  summon_override(force);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'summon_override'.");
+ return 0;
+}
+
+/* function: generate_cave_blank */
+static int toluaI_spells_generate_cave_blank00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* twpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int W = ((int)  tolua_getnumber(tolua_S,2,0));
+  int H = ((int)  tolua_getnumber(tolua_S,3,0));
+  bool light = ((bool)  tolua_getnumber(tolua_S,4,0));
+ {
+  generate_cave_blank(twpos,W,H,light);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'generate_cave_blank'.");
+ return 0;
+}
+
+/* function: do_cmd_fusion */
+static int toluaI_spells_do_cmd_fusion00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  do_cmd_fusion(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_cmd_fusion'.");
+ return 0;
+}
+
+/* function: place_up_stairs */
+static int toluaI_spells_place_up_stairs00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  place_up_stairs(wpos,y,x);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'place_up_stairs'.");
+ return 0;
+}
+
+/* function: spell_color */
+static int toluaI_spells_spell_color00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int type = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  byte toluaI_ret = (byte)  spell_color(type);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'spell_color'.");
+ return 0;
+}
+
+/* function: take_hit */
+static int toluaI_spells_take_hit00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int damage = ((int)  tolua_getnumber(tolua_S,2,0));
+  cptr kb_str = ((cptr)  tolua_getstring(tolua_S,3,0));
+  int Ind_attacker = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  take_hit(Ind,damage,kb_str,Ind_attacker);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'take_hit'.");
+ return 0;
+}
+
+/* function: take_xp_hit */
+static int toluaI_spells_take_xp_hit00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,8)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int damage = ((int)  tolua_getnumber(tolua_S,2,0));
+  cptr hit_from = ((cptr)  tolua_getstring(tolua_S,3,0));
+  bool mode = ((bool)  tolua_getnumber(tolua_S,4,0));
+  bool fatal = ((bool)  tolua_getnumber(tolua_S,5,0));
+  bool disturb = ((bool)  tolua_getnumber(tolua_S,6,0));
+  int Ind_attacker = ((int)  tolua_getnumber(tolua_S,7,0));
+ {
+  take_xp_hit(Ind,damage,hit_from,mode,fatal,disturb,Ind_attacker);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'take_xp_hit'.");
+ return 0;
+}
+
+/* function: take_sanity_hit */
+static int toluaI_spells_take_sanity_hit00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int damage = ((int)  tolua_getnumber(tolua_S,2,0));
+  cptr hit_from = ((cptr)  tolua_getstring(tolua_S,3,0));
+  int Ind_attacker = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  take_sanity_hit(Ind,damage,hit_from,Ind_attacker);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'take_sanity_hit'.");
+ return 0;
+}
+
+/* function: poly_r_idx */
+static int toluaI_spells_poly_r_idx00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int r_idx = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  s16b toluaI_ret = (s16b)  poly_r_idx(r_idx);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'poly_r_idx'.");
+ return 0;
+}
+
+/* function: check_st_anchor */
+static int toluaI_spells_check_st_anchor00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  check_st_anchor(wpos,y,x);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'check_st_anchor'.");
+ return 0;
+}
+
+/* function: swap_position */
+static int toluaI_spells_swap_position00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int lty = ((int)  tolua_getnumber(tolua_S,2,0));
+  int ltx = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  swap_position(Ind,lty,ltx);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'swap_position'.");
+ return 0;
+}
+
+/* function: teleport_away */
+static int toluaI_spells_teleport_away00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int m_idx = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dis = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  teleport_away(m_idx,dis);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'teleport_away'.");
+ return 0;
+}
+
+/* function: teleport_player */
+static int toluaI_spells_teleport_player00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dis = ((int)  tolua_getnumber(tolua_S,2,0));
+  bool ignore_pvp = ((bool)  tolua_getnumber(tolua_S,3,0));
+ {
+  teleport_player(Ind,dis,ignore_pvp);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'teleport_player'.");
+ return 0;
+}
+
+/* function: teleport_player_to */
+static int toluaI_spells_teleport_player_to00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int ny = ((int)  tolua_getnumber(tolua_S,2,0));
+  int nx = ((int)  tolua_getnumber(tolua_S,3,0));
+  bool forced = ((bool)  tolua_getnumber(tolua_S,4,0));
+ {
+  teleport_player_to(Ind,ny,nx,forced);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'teleport_player_to'.");
+ return 0;
+}
+
+/* function: teleport_player_level */
+static int toluaI_spells_teleport_player_level00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  bool force = ((bool)  tolua_getnumber(tolua_S,2,0));
+ {
+  teleport_player_level(Ind,force);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'teleport_player_level'.");
+ return 0;
+}
+
+/* function: retreat_player */
+static int toluaI_spells_retreat_player00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dis = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  retreat_player(Ind,dis);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'retreat_player'.");
+ return 0;
+}
+
+/* get function: bypass_invuln */
+static int toluaI_get_spells_bypass_invuln(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)bypass_invuln);
+ return 1;
+}
+
+/* set function: bypass_invuln */
+static int toluaI_set_spells_bypass_invuln(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  bypass_invuln = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* function: acid_dam */
+static int toluaI_spells_acid_dam00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,2,0));
+  cptr kb_str = ((cptr)  tolua_getstring(tolua_S,3,0));
+  int Ind_attacker = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  acid_dam(Ind,dam,kb_str,Ind_attacker);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'acid_dam'.");
+ return 0;
+}
+
+/* function: elec_dam */
+static int toluaI_spells_elec_dam00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,2,0));
+  cptr kb_str = ((cptr)  tolua_getstring(tolua_S,3,0));
+  int Ind_attacker = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  elec_dam(Ind,dam,kb_str,Ind_attacker);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'elec_dam'.");
+ return 0;
+}
+
+/* function: fire_dam */
+static int toluaI_spells_fire_dam00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,2,0));
+  cptr kb_str = ((cptr)  tolua_getstring(tolua_S,3,0));
+  int Ind_attacker = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  fire_dam(Ind,dam,kb_str,Ind_attacker);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_dam'.");
+ return 0;
+}
+
+/* function: cold_dam */
+static int toluaI_spells_cold_dam00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,2,0));
+  cptr kb_str = ((cptr)  tolua_getstring(tolua_S,3,0));
+  int Ind_attacker = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  cold_dam(Ind,dam,kb_str,Ind_attacker);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cold_dam'.");
+ return 0;
+}
+
+/* function: inc_stat */
+static int toluaI_spells_inc_stat00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int stat = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  inc_stat(Ind,stat);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'inc_stat'.");
+ return 0;
+}
+
+/* function: dec_stat */
+static int toluaI_spells_dec_stat00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int stat = ((int)  tolua_getnumber(tolua_S,2,0));
+  int amount = ((int)  tolua_getnumber(tolua_S,3,0));
+  int mode = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  dec_stat(Ind,stat,amount,mode);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'dec_stat'.");
+ return 0;
+}
+
+/* function: res_stat */
+static int toluaI_spells_res_stat00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int stat = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  res_stat(Ind,stat);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'res_stat'.");
+ return 0;
+}
+
+/* function: apply_disenchant */
+static int toluaI_spells_apply_disenchant00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int mode = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  apply_disenchant(Ind,mode);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'apply_disenchant'.");
+ return 0;
+}
+
+/* function: apply_discharge */
+static int toluaI_spells_apply_discharge00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  apply_discharge(Ind,dam);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'apply_discharge'.");
+ return 0;
+}
+
+/* function: apply_discharge_item */
+static int toluaI_spells_apply_discharge_item00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int o_idx = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  apply_discharge_item(o_idx,dam);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'apply_discharge_item'.");
+ return 0;
+}
+
+/* function: project_hook */
+static int toluaI_spells_project_hook00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  int flg = ((int)  tolua_getnumber(tolua_S,5,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,6,0));
+ {
+  bool toluaI_ret = (bool)  project_hook(Ind,typ,dir,dam,flg,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'project_hook'.");
+ return 0;
+}
+
+/* function: project */
+static int toluaI_spells_project00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,8,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,9,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,10)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int who = ((int)  tolua_getnumber(tolua_S,1,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,2,0));
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,3,0));
+  int y = ((int)  tolua_getnumber(tolua_S,4,0));
+  int x = ((int)  tolua_getnumber(tolua_S,5,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,6,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,7,0));
+  int flg = ((int)  tolua_getnumber(tolua_S,8,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,9,0));
+ {
+  bool toluaI_ret = (bool)  project(who,rad,wpos,y,x,dam,typ,flg,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'project'.");
+ return 0;
+}
+
+/* function: set_all_destroy */
+static int toluaI_spells_set_all_destroy00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"object_type"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  object_type* o_ptr = ((object_type*)  tolua_getusertype(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  set_all_destroy(o_ptr);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_all_destroy'.");
+ return 0;
+}
+
+/* function: set_cold_destroy */
+static int toluaI_spells_set_cold_destroy00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"object_type"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  object_type* o_ptr = ((object_type*)  tolua_getusertype(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  set_cold_destroy(o_ptr);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_cold_destroy'.");
+ return 0;
+}
+
+/* function: set_impact_destroy */
+static int toluaI_spells_set_impact_destroy00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"object_type"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  object_type* o_ptr = ((object_type*)  tolua_getusertype(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  set_impact_destroy(o_ptr);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_impact_destroy'.");
+ return 0;
+}
+
+/* function: set_water_destroy */
+static int toluaI_spells_set_water_destroy00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"object_type"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  object_type* o_ptr = ((object_type*)  tolua_getusertype(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  set_water_destroy(o_ptr);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_water_destroy'.");
+ return 0;
+}
+
+/* function: equip_damage */
+static int toluaI_spells_equip_damage00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  int toluaI_ret = (int)  equip_damage(Ind,typ);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'equip_damage'.");
+ return 0;
+}
+
+/* function: inven_damage */
+static int toluaI_spells_inven_damage00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,tolua_tag(tolua_S,"inven_func"),0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  inven_func typ = *((inven_func*)  tolua_getusertype(tolua_S,2,0));
+  int perc = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  int toluaI_ret = (int)  inven_damage(Ind,typ,perc);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'inven_damage'.");
+ return 0;
+}
+
+/* function: weapon_takes_damage */
+static int toluaI_spells_weapon_takes_damage00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int slot = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  int toluaI_ret = (int)  weapon_takes_damage(Ind,typ,slot);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'weapon_takes_damage'.");
+ return 0;
+}
+
+/* function: set_oppose_acid */
+static int toluaI_spells_set_oppose_acid00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_oppose_acid(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_oppose_acid'.");
+ return 0;
+}
+
+/* function: set_oppose_elec */
+static int toluaI_spells_set_oppose_elec00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_oppose_elec(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_oppose_elec'.");
+ return 0;
+}
+
+/* function: set_oppose_fire */
+static int toluaI_spells_set_oppose_fire00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_oppose_fire(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_oppose_fire'.");
+ return 0;
+}
+
+/* function: set_oppose_cold */
+static int toluaI_spells_set_oppose_cold00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_oppose_cold(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_oppose_cold'.");
+ return 0;
+}
+
+/* function: set_oppose_pois */
+static int toluaI_spells_set_oppose_pois00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_oppose_pois(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_oppose_pois'.");
+ return 0;
+}
+
+/* function: set_stun */
+static int toluaI_spells_set_stun00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_stun(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_stun'.");
+ return 0;
+}
+
+/* function: set_cut */
+static int toluaI_spells_set_cut00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int attacker = ((int)  tolua_getnumber(tolua_S,3,0));
+  bool quiet = ((bool)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  set_cut(Ind,v,attacker,quiet);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_cut'.");
+ return 0;
+}
+
+/* function: set_food */
+static int toluaI_spells_set_food00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_food(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_food'.");
+ return 0;
+}
+
+/* function: set_invuln_short */
+static int toluaI_spells_set_invuln_short00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_invuln_short(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_invuln_short'.");
+ return 0;
+}
+
+/* function: set_biofeedback */
+static int toluaI_spells_set_biofeedback00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_biofeedback(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_biofeedback'.");
+ return 0;
+}
+
+/* function: set_adrenaline */
+static int toluaI_spells_set_adrenaline00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_adrenaline(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_adrenaline'.");
+ return 0;
+}
+
+/* function: set_tim_esp */
+static int toluaI_spells_set_tim_esp00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_esp(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_esp'.");
+ return 0;
+}
+
+/* function: set_st_anchor */
+static int toluaI_spells_set_st_anchor00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_st_anchor(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_st_anchor'.");
+ return 0;
+}
+
+/* function: set_prob_travel */
+static int toluaI_spells_set_prob_travel00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_prob_travel(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_prob_travel'.");
+ return 0;
+}
+
+/* function: set_mimic */
+static int toluaI_spells_set_mimic00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int p = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_mimic(Ind,v,p);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_mimic'.");
+ return 0;
+}
+
+/* function: set_tim_traps */
+static int toluaI_spells_set_tim_traps00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_traps(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_traps'.");
+ return 0;
+}
+
+/* function: set_tim_manashield */
+static int toluaI_spells_set_tim_manashield00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_manashield(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_manashield'.");
+ return 0;
+}
+
+/* function: set_invis */
+static int toluaI_spells_set_invis00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int p = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_invis(Ind,v,p);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_invis'.");
+ return 0;
+}
+
+/* function: set_shroud */
+static int toluaI_spells_set_shroud00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int p = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_shroud(Ind,v,p);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_shroud'.");
+ return 0;
+}
+
+/* function: set_fury */
+static int toluaI_spells_set_fury00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_fury(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_fury'.");
+ return 0;
+}
+
+/* function: set_tim_meditation */
+static int toluaI_spells_set_tim_meditation00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_meditation(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_meditation'.");
+ return 0;
+}
+
+/* function: set_tim_wraith */
+static int toluaI_spells_set_tim_wraith00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_wraith(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_wraith'.");
+ return 0;
+}
+
+/* function: set_tim_wraithstep */
+static int toluaI_spells_set_tim_wraithstep00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_wraithstep(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_wraithstep'.");
+ return 0;
+}
+
+/* function: set_blind */
+static int toluaI_spells_set_blind00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_blind(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_blind'.");
+ return 0;
+}
+
+/* function: set_confused */
+static int toluaI_spells_set_confused00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_confused(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_confused'.");
+ return 0;
+}
+
+/* function: set_poisoned */
+static int toluaI_spells_set_poisoned00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int attacker = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_poisoned(Ind,v,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_poisoned'.");
+ return 0;
+}
+
+/* function: set_diseased */
+static int toluaI_spells_set_diseased00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int attacker = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_diseased(Ind,v,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_diseased'.");
+ return 0;
+}
+
+/* function: set_afraid */
+static int toluaI_spells_set_afraid00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_afraid(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_afraid'.");
+ return 0;
+}
+
+/* function: set_paralyzed */
+static int toluaI_spells_set_paralyzed00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_paralyzed(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_paralyzed'.");
+ return 0;
+}
+
+/* function: set_stopped */
+static int toluaI_spells_set_stopped00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_stopped(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_stopped'.");
+ return 0;
+}
+
+/* function: set_image */
+static int toluaI_spells_set_image00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_image(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_image'.");
+ return 0;
+}
+
+/* function: set_fast */
+static int toluaI_spells_set_fast00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int p = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_fast(Ind,v,p);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_fast'.");
+ return 0;
+}
+
+/* function: set_slow */
+static int toluaI_spells_set_slow00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_slow(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_slow'.");
+ return 0;
+}
+
+/* function: set_tim_reflect */
+static int toluaI_spells_set_tim_reflect00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_reflect(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_reflect'.");
+ return 0;
+}
+
+/* function: wizard_lock */
+static int toluaI_spells_wizard_lock00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  wizard_lock(Ind,dir);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'wizard_lock'.");
+ return 0;
+}
+
+/* function: set_shield */
+static int toluaI_spells_set_shield00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int p = ((int)  tolua_getnumber(tolua_S,3,0));
+  s16b o = ((s16b)  tolua_getnumber(tolua_S,4,0));
+  s16b d1 = ((s16b)  tolua_getnumber(tolua_S,5,0));
+  s16b d2 = ((s16b)  tolua_getnumber(tolua_S,6,0));
+ {
+  bool toluaI_ret = (bool)  set_shield(Ind,v,p,o,d1,d2);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_shield'.");
+ return 0;
+}
+
+/* function: set_tim_thunder */
+static int toluaI_spells_set_tim_thunder00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int p1 = ((int)  tolua_getnumber(tolua_S,3,0));
+  int p2 = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_thunder(Ind,v,p1,p2);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_thunder'.");
+ return 0;
+}
+
+/* function: set_tim_regen */
+static int toluaI_spells_set_tim_regen00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int p = ((int)  tolua_getnumber(tolua_S,3,0));
+  int c = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_regen(Ind,v,p,c);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_regen'.");
+ return 0;
+}
+
+/* function: set_tim_mp2hp */
+static int toluaI_spells_set_tim_mp2hp00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int p = ((int)  tolua_getnumber(tolua_S,3,0));
+  int c = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_mp2hp(Ind,v,p,c);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_mp2hp'.");
+ return 0;
+}
+
+/* function: set_tim_ffall */
+static int toluaI_spells_set_tim_ffall00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_ffall(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_ffall'.");
+ return 0;
+}
+
+/* function: set_tim_lev */
+static int toluaI_spells_set_tim_lev00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_lev(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_lev'.");
+ return 0;
+}
+
+/* function: set_blessed */
+static int toluaI_spells_set_blessed00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  bool own = ((bool)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_blessed(Ind,v,own);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_blessed'.");
+ return 0;
+}
+
+/* function: set_dispersion */
+static int toluaI_spells_set_dispersion00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int d = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_dispersion(Ind,v,d);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_dispersion'.");
+ return 0;
+}
+
+/* function: set_res_fear */
+static int toluaI_spells_set_res_fear00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_res_fear(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_res_fear'.");
+ return 0;
+}
+
+/* function: set_hero */
+static int toluaI_spells_set_hero00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_hero(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_hero'.");
+ return 0;
+}
+
+/* function: set_shero */
+static int toluaI_spells_set_shero00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_shero(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_shero'.");
+ return 0;
+}
+
+/* function: set_protevil */
+static int toluaI_spells_set_protevil00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  bool own = ((bool)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_protevil(Ind,v,own);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_protevil'.");
+ return 0;
+}
+
+/* function: set_zeal */
+static int toluaI_spells_set_zeal00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int p = ((int)  tolua_getnumber(tolua_S,2,0));
+  int v = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_zeal(Ind,p,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_zeal'.");
+ return 0;
+}
+
+/* function: set_martyr */
+static int toluaI_spells_set_martyr00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_martyr(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_martyr'.");
+ return 0;
+}
+
+/* function: set_invuln */
+static int toluaI_spells_set_invuln00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_invuln(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_invuln'.");
+ return 0;
+}
+
+/* function: set_tim_invis */
+static int toluaI_spells_set_tim_invis00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_invis(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_invis'.");
+ return 0;
+}
+
+/* function: set_tim_infra */
+static int toluaI_spells_set_tim_infra00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_infra(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_infra'.");
+ return 0;
+}
+
+/* function: set_mindboost */
+static int toluaI_spells_set_mindboost00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int p = ((int)  tolua_getnumber(tolua_S,2,0));
+  int v = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_mindboost(Ind,p,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_mindboost'.");
+ return 0;
+}
+
+/* function: set_kinetic_shield */
+static int toluaI_spells_set_kinetic_shield00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_kinetic_shield(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_kinetic_shield'.");
+ return 0;
+}
+
+/* function: set_savingthrow */
+static int toluaI_spells_set_savingthrow00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_savingthrow(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_savingthrow'.");
+ return 0;
+}
+
+/* function: set_spirit_shield */
+static int toluaI_spells_set_spirit_shield00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int power = ((int)  tolua_getnumber(tolua_S,2,0));
+  int v = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_spirit_shield(Ind,power,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_spirit_shield'.");
+ return 0;
+}
+
+/* function: identify_fully */
+static int toluaI_spells_identify_fully00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  identify_fully(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'identify_fully'.");
+ return 0;
+}
+
+/* function: self_knowledge */
+static int toluaI_spells_self_knowledge00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  self_knowledge(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'self_knowledge'.");
+ return 0;
+}
+
+/* function: ident_spell */
+static int toluaI_spells_ident_spell00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  ident_spell(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'ident_spell'.");
+ return 0;
+}
+
+/* function: map_area */
+static int toluaI_spells_map_area00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  bool full = ((bool)  tolua_getnumber(tolua_S,2,0));
+ {
+  map_area(Ind,full);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'map_area'.");
+ return 0;
+}
+
+/* function: mind_map_level */
+static int toluaI_spells_mind_map_level00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int pow = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  mind_map_level(Ind,pow);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'mind_map_level'.");
+ return 0;
+}
+
+/* function: wiz_lite */
+static int toluaI_spells_wiz_lite00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  wiz_lite(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'wiz_lite'.");
+ return 0;
+}
+
+/* function: wiz_lite_extra */
+static int toluaI_spells_wiz_lite_extra00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  wiz_lite_extra(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'wiz_lite_extra'.");
+ return 0;
+}
+
+/* function: wiz_lite_spell */
+static int toluaI_spells_wiz_lite_spell00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  wiz_lite_spell(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'wiz_lite_spell'.");
+ return 0;
+}
+
+/* function: wiz_dark */
+static int toluaI_spells_wiz_dark00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  wiz_dark(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'wiz_dark'.");
+ return 0;
+}
+
+/* function: detect_creatures_xxx */
+static int toluaI_spells_detect_creatures_xxx00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  u32b match_flag = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  detect_creatures_xxx(Ind,match_flag);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detect_creatures_xxx'.");
+ return 0;
+}
+
+/* function: detect_creatures */
+static int toluaI_spells_detect_creatures00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  detect_creatures(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detect_creatures'.");
+ return 0;
+}
+
+/* function: place_foe */
+static int toluaI_spells_place_foe00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,6)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int owner_id = ((int)  tolua_getnumber(tolua_S,1,0));
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,2,0));
+  int y = ((int)  tolua_getnumber(tolua_S,3,0));
+  int x = ((int)  tolua_getnumber(tolua_S,4,0));
+  int r_idx = ((int)  tolua_getnumber(tolua_S,5,0));
+ {
+  bool toluaI_ret = (bool)  place_foe(owner_id,wpos,y,x,r_idx);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'place_foe'.");
+ return 0;
+}
+
+/* function: heal_insanity */
+static int toluaI_spells_heal_insanity00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int val = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  heal_insanity(Ind,val);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'heal_insanity'.");
+ return 0;
+}
+
+/* function: summon_cyber */
+static int toluaI_spells_summon_cyber00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int s_clone = ((int)  tolua_getnumber(tolua_S,2,0));
+  int clone_summoning = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  summon_cyber(Ind,s_clone,clone_summoning);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'summon_cyber'.");
+ return 0;
+}
+
+/* function: golem_creation */
+static int toluaI_spells_golem_creation00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int max = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  golem_creation(Ind,max);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'golem_creation'.");
+ return 0;
+}
+
+/* function: hp_player */
+static int toluaI_spells_hp_player00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int num = ((int)  tolua_getnumber(tolua_S,2,0));
+  bool quiet = ((bool)  tolua_getnumber(tolua_S,3,0));
+  bool autoeffect = ((bool)  tolua_getnumber(tolua_S,4,0));
+ {
+  s16b toluaI_ret = (s16b)  hp_player(Ind,num,quiet,autoeffect);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'hp_player'.");
+ return 0;
+}
+
+/* function: warding_glyph */
+static int toluaI_spells_warding_glyph01(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  warding_glyph(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ return toluaI_spells_warding_glyph00(tolua_S);
+}
+
+/* function: do_dec_stat */
+static int toluaI_spells_do_dec_stat00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int stat = ((int)  tolua_getnumber(tolua_S,2,0));
+  int mode = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  do_dec_stat(Ind,stat,mode);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_dec_stat'.");
+ return 0;
+}
+
+/* function: do_res_stat */
+static int toluaI_spells_do_res_stat00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int stat = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  do_res_stat(Ind,stat);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_res_stat'.");
+ return 0;
+}
+
+/* function: do_inc_stat */
+static int toluaI_spells_do_inc_stat00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int stat = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  do_inc_stat(Ind,stat);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_inc_stat'.");
+ return 0;
+}
+
+/* function: identify_pack */
+static int toluaI_spells_identify_pack00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  identify_pack(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'identify_pack'.");
+ return 0;
+}
+
+/* function: message_pain */
+static int toluaI_spells_message_pain00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int m_idx = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  message_pain(Ind,m_idx,dam);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'message_pain'.");
+ return 0;
+}
+
+/* function: remove_curse */
+static int toluaI_spells_remove_curse00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  remove_curse(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'remove_curse'.");
+ return 0;
+}
+
+/* function: remove_all_curse */
+static int toluaI_spells_remove_all_curse00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  remove_all_curse(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'remove_all_curse'.");
+ return 0;
+}
+
+/* function: restore_level */
+static int toluaI_spells_restore_level00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  restore_level(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'restore_level'.");
+ return 0;
+}
+
+/* function: self_knowledge */
+static int toluaI_spells_self_knowledge01(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  self_knowledge(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ return toluaI_spells_self_knowledge00(tolua_S);
+}
+
+/* function: lose_all_info */
+static int toluaI_spells_lose_all_info00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  lose_all_info(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lose_all_info'.");
+ return 0;
+}
+
+/* function: detect_treasure */
+static int toluaI_spells_detect_treasure00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  detect_treasure(Ind,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detect_treasure'.");
+ return 0;
+}
+
+/* function: detect_magic */
+static int toluaI_spells_detect_magic00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  detect_magic(Ind,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detect_magic'.");
+ return 0;
+}
+
+/* function: detect_invisible */
+static int toluaI_spells_detect_invisible00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  detect_invisible(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detect_invisible'.");
+ return 0;
+}
+
+/* function: detect_evil */
+static int toluaI_spells_detect_evil00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  detect_evil(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detect_evil'.");
+ return 0;
+}
+
+/* function: detect_living */
+static int toluaI_spells_detect_living00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  detect_living(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detect_living'.");
+ return 0;
+}
+
+/* function: detect_noise */
+static int toluaI_spells_detect_noise00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  detect_noise(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detect_noise'.");
+ return 0;
+}
+
+/* function: detection */
+static int toluaI_spells_detection00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  detection(Ind,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detection'.");
+ return 0;
+}
+
+/* function: detect_object */
+static int toluaI_spells_detect_object00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  detect_object(Ind,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detect_object'.");
+ return 0;
+}
+
+/* function: detect_trap */
+static int toluaI_spells_detect_trap00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  detect_trap(Ind,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detect_trap'.");
+ return 0;
+}
+
+/* function: detect_sdoor */
+static int toluaI_spells_detect_sdoor00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  detect_sdoor(Ind,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'detect_sdoor'.");
+ return 0;
+}
+
+/* function: stair_creation */
+static int toluaI_spells_stair_creation00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  stair_creation(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'stair_creation'.");
+ return 0;
+}
+
+/* function: enchant */
+static int toluaI_spells_enchant00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,tolua_tag(tolua_S,"object_type"),0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  object_type* o_ptr = ((object_type*)  tolua_getusertype(tolua_S,2,0));
+  int n = ((int)  tolua_getnumber(tolua_S,3,0));
+  int eflag = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  enchant(Ind,o_ptr,n,eflag);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'enchant'.");
+ return 0;
+}
+
+/* function: enchant_spell */
+static int toluaI_spells_enchant_spell00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,6)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int num_hit = ((int)  tolua_getnumber(tolua_S,2,0));
+  int num_dam = ((int)  tolua_getnumber(tolua_S,3,0));
+  int num_ac = ((int)  tolua_getnumber(tolua_S,4,0));
+  int flags = ((int)  tolua_getnumber(tolua_S,5,0));
+ {
+  bool toluaI_ret = (bool)  enchant_spell(Ind,num_hit,num_dam,num_ac,flags);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'enchant_spell'.");
+ return 0;
+}
+
+/* function: enchant_spell_aux */
+static int toluaI_spells_enchant_spell_aux00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int item = ((int)  tolua_getnumber(tolua_S,2,0));
+  int num_hit = ((int)  tolua_getnumber(tolua_S,3,0));
+  int num_dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  int num_ac = ((int)  tolua_getnumber(tolua_S,5,0));
+  int flags = ((int)  tolua_getnumber(tolua_S,6,0));
+ {
+  bool toluaI_ret = (bool)  enchant_spell_aux(Ind,item,num_hit,num_dam,num_ac,flags);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'enchant_spell_aux'.");
+ return 0;
+}
+
+/* function: ident_spell */
+static int toluaI_spells_ident_spell01(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  ident_spell(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ return toluaI_spells_ident_spell00(tolua_S);
+}
+
+/* function: ident_spell_aux */
+static int toluaI_spells_ident_spell_aux00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int item = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  ident_spell_aux(Ind,item);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'ident_spell_aux'.");
+ return 0;
+}
+
+/* function: identify_fully */
+static int toluaI_spells_identify_fully01(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  identify_fully(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ return toluaI_spells_identify_fully00(tolua_S);
+}
+
+/* function: identify_fully_item */
+static int toluaI_spells_identify_fully_item00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int item = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  identify_fully_item(Ind,item);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'identify_fully_item'.");
+ return 0;
+}
+
+/* function: recharge */
+static int toluaI_spells_recharge00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int num = ((int)  tolua_getnumber(tolua_S,2,0));
+  int item = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  recharge(Ind,num,item);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'recharge'.");
+ return 0;
+}
+
+/* function: recharge_aux */
+static int toluaI_spells_recharge_aux00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int item = ((int)  tolua_getnumber(tolua_S,2,0));
+  int num = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  recharge_aux(Ind,item,num);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'recharge_aux'.");
+ return 0;
+}
+
+/* function: speed_monsters */
+static int toluaI_spells_speed_monsters00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  speed_monsters(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'speed_monsters'.");
+ return 0;
+}
+
+/* function: slow_monsters */
+static int toluaI_spells_slow_monsters00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int pow = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  slow_monsters(Ind,pow);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'slow_monsters'.");
+ return 0;
+}
+
+/* function: sleep_monsters */
+static int toluaI_spells_sleep_monsters00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int pow = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  sleep_monsters(Ind,pow);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'sleep_monsters'.");
+ return 0;
+}
+
+/* function: fear_monsters */
+static int toluaI_spells_fear_monsters00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int pow = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  fear_monsters(Ind,pow);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fear_monsters'.");
+ return 0;
+}
+
+/* function: stun_monsters */
+static int toluaI_spells_stun_monsters00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int pow = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  stun_monsters(Ind,pow);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'stun_monsters'.");
+ return 0;
+}
+
+/* function: aggravate_monsters */
+static int toluaI_spells_aggravate_monsters00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int who = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  aggravate_monsters(Ind,who);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'aggravate_monsters'.");
+ return 0;
+}
+
+/* function: wake_minions */
+static int toluaI_spells_wake_minions00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int who = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  wake_minions(Ind,who);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'wake_minions'.");
+ return 0;
+}
+
+/* function: genocide_aux */
+static int toluaI_spells_genocide_aux00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,2,0));
+  char typ = ((char)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  genocide_aux(Ind,wpos,typ);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'genocide_aux'.");
+ return 0;
+}
+
+/* function: genocide */
+static int toluaI_spells_genocide00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  genocide(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'genocide'.");
+ return 0;
+}
+
+/* function: obliteration */
+static int toluaI_spells_obliteration00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int who = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  obliteration(who);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'obliteration'.");
+ return 0;
+}
+
+/* function: probing */
+static int toluaI_spells_probing00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  probing(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'probing'.");
+ return 0;
+}
+
+/* function: project_los_wall */
+static int toluaI_spells_project_los_wall00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,3,0));
+  int time = ((int)  tolua_getnumber(tolua_S,4,0));
+  int interval = ((int)  tolua_getnumber(tolua_S,5,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,6,0));
+ {
+  bool toluaI_ret = (bool)  project_los_wall(Ind,typ,dam,time,interval,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'project_los_wall'.");
+ return 0;
+}
+
+/* function: project_los */
+static int toluaI_spells_project_los00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,3,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  project_los(Ind,typ,dam,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'project_los'.");
+ return 0;
+}
+
+/* function: away_evil */
+static int toluaI_spells_away_evil00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dist = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  away_evil(Ind,dist);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'away_evil'.");
+ return 0;
+}
+
+/* function: dispel_evil */
+static int toluaI_spells_dispel_evil00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  dispel_evil(Ind,dam);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'dispel_evil'.");
+ return 0;
+}
+
+/* function: dispel_undead */
+static int toluaI_spells_dispel_undead00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  dispel_undead(Ind,dam);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'dispel_undead'.");
+ return 0;
+}
+
+/* function: dispel_demons */
+static int toluaI_spells_dispel_demons00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  dispel_demons(Ind,dam);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'dispel_demons'.");
+ return 0;
+}
+
+/* function: dispel_monsters */
+static int toluaI_spells_dispel_monsters00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  dispel_monsters(Ind,dam);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'dispel_monsters'.");
+ return 0;
+}
+
+/* function: turn_undead */
+static int toluaI_spells_turn_undead00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  turn_undead(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'turn_undead'.");
+ return 0;
+}
+
+/* function: destroy_area */
+static int toluaI_spells_destroy_area00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,8)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y1 = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x1 = ((int)  tolua_getnumber(tolua_S,3,0));
+  int r = ((int)  tolua_getnumber(tolua_S,4,0));
+  bool full = ((bool)  tolua_getnumber(tolua_S,5,0));
+  u16b feat = ((u16b)  tolua_getnumber(tolua_S,6,0));
+  int stun = ((int)  tolua_getnumber(tolua_S,7,0));
+ {
+  destroy_area(wpos,y1,x1,r,full,feat,stun);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'destroy_area'.");
+ return 0;
+}
+
+/* function: earthquake */
+static int toluaI_spells_earthquake00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int cy = ((int)  tolua_getnumber(tolua_S,2,0));
+  int cx = ((int)  tolua_getnumber(tolua_S,3,0));
+  int r = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  earthquake(wpos,cy,cx,r);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'earthquake'.");
+ return 0;
+}
+
+/* function: open_rift */
+static int toluaI_spells_open_rift00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+  int intensity = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  open_rift(Ind,dir,intensity);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'open_rift'.");
+ return 0;
+}
+
+/* function: wipe_spell */
+static int toluaI_spells_wipe_spell00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int cy = ((int)  tolua_getnumber(tolua_S,2,0));
+  int cx = ((int)  tolua_getnumber(tolua_S,3,0));
+  int r = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  wipe_spell(wpos,cy,cx,r);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'wipe_spell'.");
+ return 0;
+}
+
+/* function: target_okay */
+static int toluaI_spells_target_okay00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  target_okay(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'target_okay'.");
+ return 0;
+}
+
+/* function: lite_room */
+static int toluaI_spells_lite_room00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,2,0));
+  int y1 = ((int)  tolua_getnumber(tolua_S,3,0));
+  int x1 = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  lite_room(Ind,wpos,y1,x1);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lite_room'.");
+ return 0;
+}
+
+/* function: unlite_room */
+static int toluaI_spells_unlite_room00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,2,0));
+  int y1 = ((int)  tolua_getnumber(tolua_S,3,0));
+  int x1 = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  unlite_room(Ind,wpos,y1,x1);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'unlite_room'.");
+ return 0;
+}
+
+/* function: lite_area */
+static int toluaI_spells_lite_area00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,2,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  lite_area(Ind,dam,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lite_area'.");
+ return 0;
+}
+
+/* function: unlite_area */
+static int toluaI_spells_unlite_area00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  bool player = ((bool)  tolua_getnumber(tolua_S,2,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,3,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  unlite_area(Ind,player,dam,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'unlite_area'.");
+ return 0;
+}
+
+/* function: fire_ball */
+static int toluaI_spells_fire_ball00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,5,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,6,0));
+ {
+  bool toluaI_ret = (bool)  fire_ball(Ind,typ,dir,dam,rad,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_ball'.");
+ return 0;
+}
+
+/* function: fire_burst */
+static int toluaI_spells_fire_burst00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,5,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,6,0));
+ {
+  bool toluaI_ret = (bool)  fire_burst(Ind,typ,dir,dam,rad,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_burst'.");
+ return 0;
+}
+
+/* function: fire_swarm */
+static int toluaI_spells_fire_swarm00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  int num = ((int)  tolua_getnumber(tolua_S,5,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,6,0));
+ {
+  bool toluaI_ret = (bool)  fire_swarm(Ind,typ,dir,dam,num,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_swarm'.");
+ return 0;
+}
+
+/* function: fire_cone */
+static int toluaI_spells_fire_cone00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,5,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,6,0));
+ {
+  bool toluaI_ret = (bool)  fire_cone(Ind,typ,dir,dam,rad,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_cone'.");
+ return 0;
+}
+
+/* function: fire_shot */
+static int toluaI_spells_fire_shot00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,8,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,9)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dx = ((int)  tolua_getnumber(tolua_S,4,0));
+  int dy = ((int)  tolua_getnumber(tolua_S,5,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,6,0));
+  int num = ((int)  tolua_getnumber(tolua_S,7,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,8,0));
+ {
+  bool toluaI_ret = (bool)  fire_shot(Ind,typ,dir,dx,dy,rad,num,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_shot'.");
+ return 0;
+}
+
+/* function: fire_wall */
+static int toluaI_spells_fire_wall00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,8)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  int time = ((int)  tolua_getnumber(tolua_S,5,0));
+  int interval = ((int)  tolua_getnumber(tolua_S,6,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,7,0));
+ {
+  bool toluaI_ret = (bool)  fire_wall(Ind,typ,dir,dam,time,interval,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_wall'.");
+ return 0;
+}
+
+/* function: fire_wall_wide */
+static int toluaI_spells_fire_wall_wide00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,8)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  int time = ((int)  tolua_getnumber(tolua_S,5,0));
+  int interval = ((int)  tolua_getnumber(tolua_S,6,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,7,0));
+ {
+  bool toluaI_ret = (bool)  fire_wall_wide(Ind,typ,dir,dam,time,interval,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_wall_wide'.");
+ return 0;
+}
+
+/* function: fire_nova */
+static int toluaI_spells_fire_nova00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,8)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  int time = ((int)  tolua_getnumber(tolua_S,5,0));
+  int interval = ((int)  tolua_getnumber(tolua_S,6,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,7,0));
+ {
+  bool toluaI_ret = (bool)  fire_nova(Ind,typ,dir,dam,time,interval,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_nova'.");
+ return 0;
+}
+
+/* function: fire_cloud */
+static int toluaI_spells_fire_cloud00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,8,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,9)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,5,0));
+  int time = ((int)  tolua_getnumber(tolua_S,6,0));
+  int interval = ((int)  tolua_getnumber(tolua_S,7,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,8,0));
+ {
+  bool toluaI_ret = (bool)  fire_cloud(Ind,typ,dir,dam,rad,time,interval,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_cloud'.");
+ return 0;
+}
+
+/* function: fire_wave */
+static int toluaI_spells_fire_wave00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,8,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,9,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,10)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,5,0));
+  int time = ((int)  tolua_getnumber(tolua_S,6,0));
+  int interval = ((int)  tolua_getnumber(tolua_S,7,0));
+  s32b eff = ((s32b)  tolua_getnumber(tolua_S,8,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,9,0));
+ {
+  bool toluaI_ret = (bool)  fire_wave(Ind,typ,dir,dam,rad,time,interval,eff,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_wave'.");
+ return 0;
+}
+
+/* function: fire_bolt */
+static int toluaI_spells_fire_bolt00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,6)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,5,0));
+ {
+  bool toluaI_ret = (bool)  fire_bolt(Ind,typ,dir,dam,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_bolt'.");
+ return 0;
+}
+
+/* function: fire_beam */
+static int toluaI_spells_fire_beam00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,6)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,5,0));
+ {
+  bool toluaI_ret = (bool)  fire_beam(Ind,typ,dir,dam,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_beam'.");
+ return 0;
+}
+
+/* function: fire_bolt_or_beam */
+static int toluaI_spells_fire_bolt_or_beam00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int prob = ((int)  tolua_getnumber(tolua_S,2,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,4,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,5,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,6,0));
+ {
+  bool toluaI_ret = (bool)  fire_bolt_or_beam(Ind,prob,typ,dir,dam,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_bolt_or_beam'.");
+ return 0;
+}
+
+/* function: fire_grid_bolt */
+static int toluaI_spells_fire_grid_bolt00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,6)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,5,0));
+ {
+  bool toluaI_ret = (bool)  fire_grid_bolt(Ind,typ,dir,dam,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_grid_bolt'.");
+ return 0;
+}
+
+/* function: fire_grid_beam */
+static int toluaI_spells_fire_grid_beam00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,6)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,4,0));
+  char* attacker = ((char*)  tolua_getstring(tolua_S,5,0));
+ {
+  bool toluaI_ret = (bool)  fire_grid_beam(Ind,typ,dir,dam,attacker);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fire_grid_beam'.");
+ return 0;
+}
+
+/* function: lite_line */
+static int toluaI_spells_lite_line00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,3,0));
+  bool starlight = ((bool)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  lite_line(Ind,dir,dam,starlight);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lite_line'.");
+ return 0;
+}
+
+/* function: drain_life */
+static int toluaI_spells_drain_life00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  drain_life(Ind,dir,dam);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'drain_life'.");
+ return 0;
+}
+
+/* function: wall_to_mud */
+static int toluaI_spells_wall_to_mud00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  wall_to_mud(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'wall_to_mud'.");
+ return 0;
+}
+
+/* function: destroy_trap_door */
+static int toluaI_spells_destroy_trap_door00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  destroy_trap_door(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'destroy_trap_door'.");
+ return 0;
+}
+
+/* function: disarm_trap_door */
+static int toluaI_spells_disarm_trap_door00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  disarm_trap_door(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'disarm_trap_door'.");
+ return 0;
+}
+
+/* function: heal_monster */
+static int toluaI_spells_heal_monster00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  heal_monster(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'heal_monster'.");
+ return 0;
+}
+
+/* function: speed_monster */
+static int toluaI_spells_speed_monster00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  speed_monster(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'speed_monster'.");
+ return 0;
+}
+
+/* function: slow_monster */
+static int toluaI_spells_slow_monster00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+  int pow = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  slow_monster(Ind,dir,pow);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'slow_monster'.");
+ return 0;
+}
+
+/* function: sleep_monster */
+static int toluaI_spells_sleep_monster00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+  int pow = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  sleep_monster(Ind,dir,pow);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'sleep_monster'.");
+ return 0;
+}
+
+/* function: confuse_monster */
+static int toluaI_spells_confuse_monster00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+  int pow = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  confuse_monster(Ind,dir,pow);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'confuse_monster'.");
+ return 0;
+}
+
+/* function: fear_monster */
+static int toluaI_spells_fear_monster00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+  int pow = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  fear_monster(Ind,dir,pow);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fear_monster'.");
+ return 0;
+}
+
+/* function: poly_monster */
+static int toluaI_spells_poly_monster00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  poly_monster(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'poly_monster'.");
+ return 0;
+}
+
+/* function: clone_monster */
+static int toluaI_spells_clone_monster00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  clone_monster(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'clone_monster'.");
+ return 0;
+}
+
+/* function: teleport_monster */
+static int toluaI_spells_teleport_monster00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  teleport_monster(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'teleport_monster'.");
+ return 0;
+}
+
+/* function: cure_light_wounds_proj */
+static int toluaI_spells_cure_light_wounds_proj00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  cure_light_wounds_proj(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cure_light_wounds_proj'.");
+ return 0;
+}
+
+/* function: cure_serious_wounds_proj */
+static int toluaI_spells_cure_serious_wounds_proj00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  cure_serious_wounds_proj(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cure_serious_wounds_proj'.");
+ return 0;
+}
+
+/* function: cure_critical_wounds_proj */
+static int toluaI_spells_cure_critical_wounds_proj00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  cure_critical_wounds_proj(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cure_critical_wounds_proj'.");
+ return 0;
+}
+
+/* function: grow_trees */
+static int toluaI_spells_grow_trees00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  grow_trees(Ind,rad);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'grow_trees'.");
+ return 0;
+}
+
+/* function: heal_other_proj */
+static int toluaI_spells_heal_other_proj00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dir = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  heal_other_proj(Ind,dir);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'heal_other_proj'.");
+ return 0;
+}
+
+/* function: door_creation */
+static int toluaI_spells_door_creation00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  door_creation(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'door_creation'.");
+ return 0;
+}
+
+/* function: trap_creation */
+static int toluaI_spells_trap_creation00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int mod = ((int)  tolua_getnumber(tolua_S,2,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,3,0));
+  int clone = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  trap_creation(Ind,mod,rad,clone);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'trap_creation'.");
+ return 0;
+}
+
+/* function: destroy_doors_touch */
+static int toluaI_spells_destroy_doors_touch00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  destroy_doors_touch(Ind,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'destroy_doors_touch'.");
+ return 0;
+}
+
+/* function: destroy_traps_touch */
+static int toluaI_spells_destroy_traps_touch00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  destroy_traps_touch(Ind,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'destroy_traps_touch'.");
+ return 0;
+}
+
+/* function: destroy_traps_doors_touch */
+static int toluaI_spells_destroy_traps_doors_touch00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int rad = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  destroy_traps_doors_touch(Ind,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'destroy_traps_doors_touch'.");
+ return 0;
+}
+
+/* function: sleep_monsters_touch */
+static int toluaI_spells_sleep_monsters_touch00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  sleep_monsters_touch(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'sleep_monsters_touch'.");
+ return 0;
+}
+
+/* function: create_artifact */
+static int toluaI_spells_create_artifact00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  bool nolife = ((bool)  tolua_getnumber(tolua_S,2,0));
+ {
+  create_artifact(Ind,nolife);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'create_artifact'.");
+ return 0;
+}
+
+/* function: create_artifact_aux */
+static int toluaI_spells_create_artifact_aux00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int item = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  create_artifact_aux(Ind,item);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'create_artifact_aux'.");
+ return 0;
+}
+
+/* function: curse_spell */
+static int toluaI_spells_curse_spell00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  curse_spell(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'curse_spell'.");
+ return 0;
+}
+
+/* function: curse_spell_aux */
+static int toluaI_spells_curse_spell_aux00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int item = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  curse_spell_aux(Ind,item);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'curse_spell_aux'.");
+ return 0;
+}
+
+/* function: house_creation */
+static int toluaI_spells_house_creation00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  bool floor = ((bool)  tolua_getnumber(tolua_S,2,0));
+  bool jail = ((bool)  tolua_getnumber(tolua_S,3,0));
+ {
+  house_creation(Ind,floor,jail);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'house_creation'.");
+ return 0;
+}
+
+/* function: do_vermin_control */
+static int toluaI_spells_do_vermin_control00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  do_vermin_control(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_vermin_control'.");
+ return 0;
+}
+
+/* function: do_autokinesis_to */
+static int toluaI_spells_do_autokinesis_to00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int dis = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  do_autokinesis_to(Ind,dis);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_autokinesis_to'.");
+ return 0;
+}
+
+/* function: do_mstopcharm */
+static int toluaI_spells_do_mstopcharm00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  do_mstopcharm(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_mstopcharm'.");
+ return 0;
+}
+
+/* function: cast_raindrop */
+static int toluaI_spells_cast_raindrop00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int x = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  cast_raindrop(wpos,x);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cast_raindrop'.");
+ return 0;
+}
+
+/* function: cast_snowflake */
+static int toluaI_spells_cast_snowflake00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int x = ((int)  tolua_getnumber(tolua_S,2,0));
+  int interval = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  cast_snowflake(wpos,x,interval);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cast_snowflake'.");
+ return 0;
+}
+
+/* function: cast_fireworks */
+static int toluaI_spells_cast_fireworks00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int x = ((int)  tolua_getnumber(tolua_S,2,0));
+  int y = ((int)  tolua_getnumber(tolua_S,3,0));
+  int typ = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  cast_fireworks(wpos,x,y,typ);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cast_fireworks'.");
+ return 0;
+}
+
+/* function: cast_falling_star */
+static int toluaI_spells_cast_falling_star00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int x = ((int)  tolua_getnumber(tolua_S,2,0));
+  int y = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dur = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  cast_falling_star(wpos,x,y,dur);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cast_falling_star'.");
+ return 0;
+}
+
+/* function: thunderstorm_visual */
+static int toluaI_spells_thunderstorm_visual00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int x = ((int)  tolua_getnumber(tolua_S,2,0));
+  int y = ((int)  tolua_getnumber(tolua_S,3,0));
+  int dur = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  thunderstorm_visual(wpos,x,y,dur);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'thunderstorm_visual'.");
+ return 0;
+}
+
+/* function: place_trap_specific */
+static int toluaI_spells_place_trap_specific00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,6)
+ )
+ goto tolua_lerror;
+ else
+ {
+  struct worldpos* wpos = ((struct worldpos*)  tolua_getusertype(tolua_S,1,0));
+  int y = ((int)  tolua_getnumber(tolua_S,2,0));
+  int x = ((int)  tolua_getnumber(tolua_S,3,0));
+  int mod = ((int)  tolua_getnumber(tolua_S,4,0));
+  int found = ((int)  tolua_getnumber(tolua_S,5,0));
+ {
+  place_trap_specific(wpos,y,x,mod,found);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'place_trap_specific'.");
+ return 0;
+}
+
+/* function: rune_enchant */
+static int toluaI_spells_rune_enchant00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int item = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  rune_enchant(Ind,item);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'rune_enchant'.");
+ return 0;
+}
+
+/* function: warding_rune */
+static int toluaI_spells_warding_rune00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  byte typ = ((byte)  tolua_getnumber(tolua_S,2,0));
+  int dam = ((int)  tolua_getnumber(tolua_S,3,0));
+  byte rad = ((byte)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  warding_rune(Ind,typ,dam,rad);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'warding_rune'.");
+ return 0;
+}
+
+/* function: warding_rune_break */
+static int toluaI_spells_warding_rune_break00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int m_idx = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  warding_rune_break(m_idx);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'warding_rune_break'.");
+ return 0;
+}
+
+/* function: py_warding_rune_break */
+static int toluaI_spells_py_warding_rune_break00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  py_warding_rune_break(Ind);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'py_warding_rune_break'.");
+ return 0;
+}
+
+/* function: create_garden */
+static int toluaI_spells_create_garden00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int level = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  create_garden(Ind,level);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'create_garden'.");
+ return 0;
+}
+
+/* function: do_banish_animals */
+static int toluaI_spells_do_banish_animals00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int chance = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  do_banish_animals(Ind,chance);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_banish_animals'.");
+ return 0;
+}
+
+/* function: do_xtra_stats */
+static int toluaI_spells_do_xtra_stats00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,6)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int s = ((int)  tolua_getnumber(tolua_S,2,0));
+  int p = ((int)  tolua_getnumber(tolua_S,3,0));
+  int v = ((int)  tolua_getnumber(tolua_S,4,0));
+  bool demonic = ((bool)  tolua_getnumber(tolua_S,5,0));
+ {
+  bool toluaI_ret = (bool)  do_xtra_stats(Ind,s,p,v,demonic);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_xtra_stats'.");
+ return 0;
+}
+
+/* function: do_focus */
+static int toluaI_spells_do_focus00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int p = ((int)  tolua_getnumber(tolua_S,2,0));
+  int v = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  do_focus(Ind,p,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_focus'.");
+ return 0;
+}
+
+/* function: set_tim_lcage */
+static int toluaI_spells_set_tim_lcage00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_tim_lcage(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_tim_lcage'.");
+ return 0;
+}
+
+/* function: divine_vengeance */
+static int toluaI_spells_divine_vengeance00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int power = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  divine_vengeance(Ind,power);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'divine_vengeance'.");
+ return 0;
+}
+
+/* function: divine_gateway */
+static int toluaI_spells_divine_gateway00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  divine_gateway(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'divine_gateway'.");
+ return 0;
+}
+
+/* function: do_divine_xtra_res */
+static int toluaI_spells_do_divine_xtra_res00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int p = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  do_divine_xtra_res(Ind,p);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_divine_xtra_res'.");
+ return 0;
+}
+
+/* function: do_divine_hp */
+static int toluaI_spells_do_divine_hp00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int p = ((int)  tolua_getnumber(tolua_S,2,0));
+  int v = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  do_divine_hp(Ind,p,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_divine_hp'.");
+ return 0;
+}
+
+/* function: do_divine_crit */
+static int toluaI_spells_do_divine_crit00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int p = ((int)  tolua_getnumber(tolua_S,2,0));
+  int v = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  do_divine_crit(Ind,p,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_divine_crit'.");
+ return 0;
+}
+
+/* function: set_recall_depth */
+static int toluaI_spells_set_recall_depth00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"player_type"),0) ||
+ !tolua_istype(tolua_S,2,tolua_tag(tolua_S,"object_type"),0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  player_type* p_ptr = ((player_type*)  tolua_getusertype(tolua_S,1,0));
+  object_type* o_ptr = ((object_type*)  tolua_getusertype(tolua_S,2,0));
+ {
+  set_recall_depth(p_ptr,o_ptr);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_recall_depth'.");
+ return 0;
+}
+
+/* function: set_recall_timer */
+static int toluaI_spells_set_recall_timer00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  set_recall_timer(Ind,v);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_recall_timer'.");
+ return 0;
+}
+
+/* function: set_recall */
+static int toluaI_spells_set_recall00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,tolua_tag(tolua_S,"object_type"),0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  object_type* o_ptr = ((object_type*)  tolua_getusertype(tolua_S,3,0));
+ {
+  bool toluaI_ret = (bool)  set_recall(Ind,v,o_ptr);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_recall'.");
+ return 0;
+}
+
+/* function: do_shadow_gate */
+static int toluaI_spells_do_shadow_gate00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int range = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  do_shadow_gate(Ind,range);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'do_shadow_gate'.");
+ return 0;
+}
+
+/* function: set_melee_brand */
+static int toluaI_spells_set_melee_brand00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int t = ((int)  tolua_getnumber(tolua_S,3,0));
+  unsigned char flags = ((unsigned char)  tolua_getnumber(tolua_S,4,0));
+  bool cast = ((bool)  tolua_getnumber(tolua_S,5,0));
+  bool weapons_only = ((bool)  tolua_getnumber(tolua_S,6,0));
+ {
+  bool toluaI_ret = (bool)  set_melee_brand(Ind,v,t,flags,cast,weapons_only);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_melee_brand'.");
+ return 0;
+}
+
+/* function: set_ammo_brand */
+static int toluaI_spells_set_ammo_brand00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  int t = ((int)  tolua_getnumber(tolua_S,3,0));
+  int p = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  set_ammo_brand(Ind,v,t,p);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_ammo_brand'.");
+ return 0;
+}
+
+/* function: set_nimbus */
+static int toluaI_spells_set_nimbus00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int v = ((int)  tolua_getnumber(tolua_S,2,0));
+  byte t = ((byte)  tolua_getnumber(tolua_S,3,0));
+  byte d = ((byte)  tolua_getnumber(tolua_S,4,0));
+ {
+  bool toluaI_ret = (bool)  set_nimbus(Ind,v,t,d);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'set_nimbus'.");
+ return 0;
+}
+
+/* get function: name of class  spell_type */
+static int toluaI_get_spells_spell_type_name(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->name);
+ return 1;
+}
+
+/* set function: name of class  spell_type */
+static int toluaI_set_spells_spell_type_name(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->name = ((cptr)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill_level of class  spell_type */
+static int toluaI_get_spells_spell_type_skill_level(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill_level);
+ return 1;
+}
+
+/* set function: skill_level of class  spell_type */
+static int toluaI_set_spells_spell_type_skill_level(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill_level = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mana of class  spell_type */
+static int toluaI_get_spells_spell_type_mana(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mana);
+ return 1;
+}
+
+/* set function: mana of class  spell_type */
+static int toluaI_set_spells_spell_type_mana(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mana = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mana_max of class  spell_type */
+static int toluaI_get_spells_spell_type_mana_max(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mana_max);
+ return 1;
+}
+
+/* set function: mana_max of class  spell_type */
+static int toluaI_set_spells_spell_type_mana_max(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mana_max = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: fail of class  spell_type */
+static int toluaI_get_spells_spell_type_fail(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->fail);
+ return 1;
+}
+
+/* set function: fail of class  spell_type */
+static int toluaI_set_spells_spell_type_fail(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->fail = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: level of class  spell_type */
+static int toluaI_get_spells_spell_type_level(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->level);
+ return 1;
+}
+
+/* set function: level of class  spell_type */
+static int toluaI_set_spells_spell_type_level(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->level = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: spell_power of class  spell_type */
+static int toluaI_get_spells_spell_type_spell_power(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->spell_power);
+ return 1;
+}
+
+/* set function: spell_power of class  spell_type */
+static int toluaI_set_spells_spell_type_spell_power(lua_State* tolua_S)
+{
+  spell_type* self = (spell_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->spell_power = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: name of class  school_type */
+static int toluaI_get_spells_school_type_name(lua_State* tolua_S)
+{
+  school_type* self = (school_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->name);
+ return 1;
+}
+
+/* set function: name of class  school_type */
+static int toluaI_set_spells_school_type_name(lua_State* tolua_S)
+{
+  school_type* self = (school_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->name = ((cptr)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: skill of class  school_type */
+static int toluaI_get_spells_school_type_skill(lua_State* tolua_S)
+{
+  school_type* self = (school_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->skill);
+ return 1;
+}
+
+/* set function: skill of class  school_type */
+static int toluaI_set_spells_school_type_skill(lua_State* tolua_S)
+{
+  school_type* self = (school_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->skill = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: project_interval */
+static int toluaI_get_spells_project_interval(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)project_interval);
+ return 1;
+}
+
+/* set function: project_interval */
+static int toluaI_set_spells_project_interval(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  project_interval = ((s16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: project_time */
+static int toluaI_get_spells_project_time(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)project_time);
+ return 1;
+}
+
+/* set function: project_time */
+static int toluaI_set_spells_project_time(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  project_time = ((s16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: project_time_effect */
+static int toluaI_get_spells_project_time_effect(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)project_time_effect);
+ return 1;
+}
+
+/* set function: project_time_effect */
+static int toluaI_set_spells_project_time_effect(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  project_time_effect = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* function: new_school */
+static int toluaI_spells_new_school00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int i = ((int)  tolua_getnumber(tolua_S,1,0));
+  cptr name = ((cptr)  tolua_getstring(tolua_S,2,0));
+  s16b skill = ((s16b)  tolua_getnumber(tolua_S,3,0));
+ {
+  s16b toluaI_ret = (s16b)  new_school(i,name,skill);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new_school'.");
+ return 0;
+}
+
+/* function: new_spell */
+static int toluaI_spells_new_spell00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int i = ((int)  tolua_getnumber(tolua_S,1,0));
+  cptr name = ((cptr)  tolua_getstring(tolua_S,2,0));
+ {
+  s16b toluaI_ret = (s16b)  new_spell(i,name);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'new_spell'.");
+ return 0;
+}
+
+/* function: grab_spell_type */
+static int toluaI_spells_spell00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  s16b num = ((s16b)  tolua_getnumber(tolua_S,1,0));
+ {
+  spell_type* toluaI_ret = (spell_type*)  grab_spell_type(num);
+ tolua_pushusertype(tolua_S,(void*)toluaI_ret,tolua_tag(tolua_S,"spell_type"));
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'spell'.");
+ return 0;
+}
+
+/* function: grab_school_type */
+static int toluaI_spells_school00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  s16b num = ((s16b)  tolua_getnumber(tolua_S,1,0));
+ {
+  school_type* toluaI_ret = (school_type*)  grab_school_type(num);
+ tolua_pushusertype(tolua_S,(void*)toluaI_ret,tolua_tag(tolua_S,"school_type"));
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'school'.");
+ return 0;
+}
+
+/* function: lua_get_level */
+static int toluaI_spells_lua_get_level00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  s32b s = ((s32b)  tolua_getnumber(tolua_S,2,0));
+  s32b lvl = ((s32b)  tolua_getnumber(tolua_S,3,0));
+  s32b max = ((s32b)  tolua_getnumber(tolua_S,4,0));
+  s32b min = ((s32b)  tolua_getnumber(tolua_S,5,0));
+  s32b bonus = ((s32b)  tolua_getnumber(tolua_S,6,0));
+ {
+  s32b toluaI_ret = (s32b)  lua_get_level(Ind,s,lvl,max,min,bonus);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_get_level'.");
+ return 0;
+}
+
+/* function: lua_spell_chance */
+static int toluaI_spells_lua_spell_chance00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,8)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  s32b chance = ((s32b)  tolua_getnumber(tolua_S,2,0));
+  int level = ((int)  tolua_getnumber(tolua_S,3,0));
+  int skill_level = ((int)  tolua_getnumber(tolua_S,4,0));
+  int mana = ((int)  tolua_getnumber(tolua_S,5,0));
+  int cur_mana = ((int)  tolua_getnumber(tolua_S,6,0));
+  int stat = ((int)  tolua_getnumber(tolua_S,7,0));
+ {
+  s32b toluaI_ret = (s32b)  lua_spell_chance(Ind,chance,level,skill_level,mana,cur_mana,stat);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_spell_chance'.");
+ return 0;
+}
+
+/* function: lua_s_print */
+static int toluaI_spells_lua_s_print00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  cptr logstr = ((cptr)  tolua_getstring(tolua_S,1,0));
+ {
+  lua_s_print(logstr);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_s_print'.");
+ return 0;
+}
+
+/* function: lua_x_print */
+static int toluaI_spells_lua_x_print00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  cptr logstr = ((cptr)  tolua_getstring(tolua_S,1,0));
+ {
+  lua_x_print(logstr);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_x_print'.");
+ return 0;
+}
+
+/* function: lua_add_anote */
+static int toluaI_spells_lua_add_anote00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  char* anote = ((char*)  tolua_getstring(tolua_S,1,0));
+ {
+  lua_add_anote(anote);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_add_anote'.");
+ return 0;
+}
+
+/* function: lua_del_anotes */
+static int toluaI_spells_lua_del_anotes00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  lua_del_anotes();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_del_anotes'.");
+ return 0;
+}
+
+/* function: lua_broadcast_motd */
+static int toluaI_spells_lua_broadcast_motd00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  lua_broadcast_motd();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_broadcast_motd'.");
+ return 0;
+}
+
+/* function: lua_count_houses */
+static int toluaI_spells_lua_count_houses00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_count_houses(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_count_houses'.");
+ return 0;
+}
+
+/* function: lua_recalc_char */
+static int toluaI_spells_lua_recalc_char00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_recalc_char(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_recalc_char'.");
+ return 0;
+}
+
+/* function: lua_examine_item */
+static int toluaI_spells_lua_examine_item00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int Ind_target = ((int)  tolua_getnumber(tolua_S,2,0));
+  int item = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  lua_examine_item(Ind,Ind_target,item);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_examine_item'.");
+ return 0;
+}
+
+/* function: lua_determine_level_req */
+static int toluaI_spells_lua_determine_level_req00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int item = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  lua_determine_level_req(Ind,item);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_determine_level_req'.");
+ return 0;
+}
+
+/* function: lua_strip_true_arts_from_absent_players */
+static int toluaI_spells_lua_strip_true_arts_from_absent_players00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  lua_strip_true_arts_from_absent_players();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_strip_true_arts_from_absent_players'.");
+ return 0;
+}
+
+/* function: lua_strip_true_arts_from_present_player */
+static int toluaI_spells_lua_strip_true_arts_from_present_player00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int mode = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  lua_strip_true_arts_from_present_player(Ind,mode);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_strip_true_arts_from_present_player'.");
+ return 0;
+}
+
+/* function: lua_strip_true_arts_from_floors */
+static int toluaI_spells_lua_strip_true_arts_from_floors00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  lua_strip_true_arts_from_floors();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_strip_true_arts_from_floors'.");
+ return 0;
+}
+
+/* function: lua_check_player_for_true_arts */
+static int toluaI_spells_lua_check_player_for_true_arts00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_check_player_for_true_arts(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_check_player_for_true_arts'.");
+ return 0;
+}
+
+/* function: lua_get_mon_lev */
+static int toluaI_spells_lua_get_mon_lev00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int r_idx = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  lua_get_mon_lev(r_idx);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_get_mon_lev'.");
+ return 0;
+}
+
+/* function: lua_get_mon_name */
+static int toluaI_spells_lua_get_mon_name00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int r_idx = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  char* toluaI_ret = (char*)  lua_get_mon_name(r_idx);
+ tolua_pushstring(tolua_S,(const char*)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_get_mon_name'.");
+ return 0;
+}
+
+/* function: lua_towns_treset */
+static int toluaI_spells_lua_towns_treset00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  lua_towns_treset();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_towns_treset'.");
+ return 0;
+}
+
+/* function: lua_player_exp */
+static int toluaI_spells_lua_player_exp00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int level = ((int)  tolua_getnumber(tolua_S,1,0));
+  int expfact = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  long toluaI_ret = (long)  lua_player_exp(level,expfact);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_player_exp'.");
+ return 0;
+}
+
+/* function: lua_fix_spellbooks */
+static int toluaI_spells_lua_fix_spellbooks00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int spell = ((int)  tolua_getnumber(tolua_S,1,0));
+  int mod = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  lua_fix_spellbooks(spell,mod);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_fix_spellbooks'.");
+ return 0;
+}
+
+/* function: lua_fix_spellbooks_hackfix */
+static int toluaI_spells_lua_fix_spellbooks_hackfix00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int spell = ((int)  tolua_getnumber(tolua_S,1,0));
+  int mod = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  lua_fix_spellbooks_hackfix(spell,mod);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_fix_spellbooks_hackfix'.");
+ return 0;
+}
+
+/* function: lua_fix_spellbooks2 */
+static int toluaI_spells_lua_fix_spellbooks200(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int sold = ((int)  tolua_getnumber(tolua_S,1,0));
+  int snew = ((int)  tolua_getnumber(tolua_S,2,0));
+  int swap = ((int)  tolua_getnumber(tolua_S,3,0));
+ {
+  lua_fix_spellbooks2(sold,snew,swap);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_fix_spellbooks2'.");
+ return 0;
+}
+
+/* function: lua_arts_fix */
+static int toluaI_spells_lua_arts_fix00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_arts_fix(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_arts_fix'.");
+ return 0;
+}
+
+/* function: lua_get_last_chat_line */
+static int toluaI_spells_lua_get_last_chat_line00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  char* toluaI_ret = (char*)  lua_get_last_chat_line();
+ tolua_pushstring(tolua_S,(const char*)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_get_last_chat_line'.");
+ return 0;
+}
+
+/* function: lua_get_last_chat_owner */
+static int toluaI_spells_lua_get_last_chat_owner00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  char* toluaI_ret = (char*)  lua_get_last_chat_owner();
+ tolua_pushstring(tolua_S,(const char*)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_get_last_chat_owner'.");
+ return 0;
+}
+
+/* function: lua_get_last_chat_account */
+static int toluaI_spells_lua_get_last_chat_account00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  char* toluaI_ret = (char*)  lua_get_last_chat_account();
+ tolua_pushstring(tolua_S,(const char*)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_get_last_chat_account'.");
+ return 0;
+}
+
+/* function: lua_get_pgestat */
+static int toluaI_spells_lua_get_pgestat00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int n = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  lua_get_pgestat(Ind,n);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_get_pgestat'.");
+ return 0;
+}
+
+/* function: lua_start_global_event */
+static int toluaI_spells_lua_start_global_event00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int evtype = ((int)  tolua_getnumber(tolua_S,2,0));
+  char* parm = ((char*)  tolua_getstring(tolua_S,3,0));
+ {
+  lua_start_global_event(Ind,evtype,parm);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_start_global_event'.");
+ return 0;
+}
+
+/* function: lua_apply_item_changes */
+static int toluaI_spells_lua_apply_item_changes00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int changes = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  lua_apply_item_changes(Ind,changes);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_apply_item_changes'.");
+ return 0;
+}
+
+/* function: lua_set_floor_flags */
+static int toluaI_spells_lua_set_floor_flags00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  u32b flags = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ {
+  lua_set_floor_flags(Ind,flags);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_set_floor_flags'.");
+ return 0;
+}
+
+/* function: lua_get_skill_mod */
+static int toluaI_spells_lua_get_skill_mod00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int i = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  s32b toluaI_ret = (s32b)  lua_get_skill_mod(Ind,i);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_get_skill_mod'.");
+ return 0;
+}
+
+/* function: lua_get_skill_value */
+static int toluaI_spells_lua_get_skill_value00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int i = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  s32b toluaI_ret = (s32b)  lua_get_skill_value(Ind,i);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_get_skill_value'.");
+ return 0;
+}
+
+/* function: lua_fix_equip_slots */
+static int toluaI_spells_lua_fix_equip_slots00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_fix_equip_slots(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_fix_equip_slots'.");
+ return 0;
+}
+
+/* function: lua_fix_skill_chart */
+static int toluaI_spells_lua_fix_skill_chart00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_fix_skill_chart(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_fix_skill_chart'.");
+ return 0;
+}
+
+/* function: lua_takeoff_costumes */
+static int toluaI_spells_lua_takeoff_costumes00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_takeoff_costumes(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_takeoff_costumes'.");
+ return 0;
+}
+
+/* function: lua_is_unique */
+static int toluaI_spells_lua_is_unique00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int r_idx = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  lua_is_unique(r_idx);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_is_unique'.");
+ return 0;
+}
+
+/* function: lua_mimic_eligible */
+static int toluaI_spells_lua_mimic_eligible00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int r_idx = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  lua_mimic_eligible(Ind,r_idx);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_mimic_eligible'.");
+ return 0;
+}
+
+/* function: lua_mimic_humanoid */
+static int toluaI_spells_lua_mimic_humanoid00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int r_idx = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  bool toluaI_ret = (bool)  lua_mimic_humanoid(r_idx);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_mimic_humanoid'.");
+ return 0;
+}
+
+/* function: lua_forget_flavours */
+static int toluaI_spells_lua_forget_flavours00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_forget_flavours(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_forget_flavours'.");
+ return 0;
+}
+
+/* function: lua_forget_map */
+static int toluaI_spells_lua_forget_map00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_forget_map(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_forget_map'.");
+ return 0;
+}
+
+/* function: lua_forget_parties */
+static int toluaI_spells_lua_forget_parties00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  lua_forget_parties();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_forget_parties'.");
+ return 0;
+}
+
+/* function: lua_forget_guilds */
+static int toluaI_spells_lua_forget_guilds00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  lua_forget_guilds();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_forget_guilds'.");
+ return 0;
+}
+
+/* function: hack_skill */
+static int toluaI_spells_hack_skill00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,5)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int s = ((int)  tolua_getnumber(tolua_S,2,0));
+  int v = ((int)  tolua_getnumber(tolua_S,3,0));
+  int m = ((int)  tolua_getnumber(tolua_S,4,0));
+ {
+  hack_skill(Ind,s,v,m);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'hack_skill'.");
+ return 0;
+}
+
+/* function: wild_flags */
+static int toluaI_spells_wild_flags00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  u32b flags = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ {
+  wild_flags(Ind,flags);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'wild_flags'.");
+ return 0;
+}
+
+/* get function: __lua_HHEALING */
+static int toluaI_get_spells___lua_HHEALING(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_HHEALING);
+ return 1;
+}
+
+/* set function: __lua_HHEALING */
+static int toluaI_set_spells___lua_HHEALING(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_HHEALING = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_HBLESSING */
+static int toluaI_get_spells___lua_HBLESSING(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_HBLESSING);
+ return 1;
+}
+
+/* set function: __lua_HBLESSING */
+static int toluaI_set_spells___lua_HBLESSING(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_HBLESSING = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_HDELFEAR */
+static int toluaI_get_spells___lua_HDELFEAR(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_HDELFEAR);
+ return 1;
+}
+
+/* set function: __lua_HDELFEAR */
+static int toluaI_set_spells___lua_HDELFEAR(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_HDELFEAR = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_BLINK */
+static int toluaI_get_spells___lua_BLINK(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_BLINK);
+ return 1;
+}
+
+/* set function: __lua_BLINK */
+static int toluaI_set_spells___lua_BLINK(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_BLINK = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_MSCARE */
+static int toluaI_get_spells___lua_MSCARE(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_MSCARE);
+ return 1;
+}
+
+/* set function: __lua_MSCARE */
+static int toluaI_set_spells___lua_MSCARE(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_MSCARE = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_M_FIRST */
+static int toluaI_get_spells___lua_M_FIRST(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_M_FIRST);
+ return 1;
+}
+
+/* set function: __lua_M_FIRST */
+static int toluaI_set_spells___lua_M_FIRST(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_M_FIRST = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_M_LAST */
+static int toluaI_get_spells___lua_M_LAST(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_M_LAST);
+ return 1;
+}
+
+/* set function: __lua_M_LAST */
+static int toluaI_set_spells___lua_M_LAST(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_M_LAST = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_P_FIRST */
+static int toluaI_get_spells___lua_P_FIRST(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_P_FIRST);
+ return 1;
+}
+
+/* set function: __lua_P_FIRST */
+static int toluaI_set_spells___lua_P_FIRST(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_P_FIRST = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_P_LAST */
+static int toluaI_get_spells___lua_P_LAST(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_P_LAST);
+ return 1;
+}
+
+/* set function: __lua_P_LAST */
+static int toluaI_set_spells___lua_P_LAST(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_P_LAST = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_OFEAR */
+static int toluaI_get_spells___lua_OFEAR(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_OFEAR);
+ return 1;
+}
+
+/* set function: __lua_OFEAR */
+static int toluaI_set_spells___lua_OFEAR(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_OFEAR = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_FOCUS */
+static int toluaI_get_spells___lua_FOCUS(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_FOCUS);
+ return 1;
+}
+
+/* set function: __lua_FOCUS */
+static int toluaI_set_spells___lua_FOCUS(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_FOCUS = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_POWERBOLT */
+static int toluaI_get_spells___lua_POWERBOLT(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_POWERBOLT);
+ return 1;
+}
+
+/* set function: __lua_POWERBOLT */
+static int toluaI_set_spells___lua_POWERBOLT(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_POWERBOLT = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __lua_HEALING_I */
+static int toluaI_get_spells___lua_HEALING_I(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__lua_HEALING_I);
+ return 1;
+}
+
+/* set function: __lua_HEALING_I */
+static int toluaI_set_spells___lua_HEALING_I(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __lua_HEALING_I = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: sauron_weakened */
+static int toluaI_get_spells_sauron_weakened(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)sauron_weakened);
+ return 1;
+}
+
+/* set function: sauron_weakened */
+static int toluaI_set_spells_sauron_weakened(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  sauron_weakened = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: sauron_weakened_iddc */
+static int toluaI_get_spells_sauron_weakened_iddc(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)sauron_weakened_iddc);
+ return 1;
+}
+
+/* set function: sauron_weakened_iddc */
+static int toluaI_set_spells_sauron_weakened_iddc(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  sauron_weakened_iddc = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* function: shriek */
+static int toluaI_spells_shriek00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  shriek(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'shriek'.");
+ return 0;
+}
+
+/* Open function */
+int tolua_spells_open (lua_State* tolua_S)
+{
+ tolua_open(tolua_S);
+ toluaI_reg_types(tolua_S);
+ tolua_constant(tolua_S,NULL,"PR_MANA",PR_MANA);
+ tolua_constant(tolua_S,NULL,"PR_STATE",PR_STATE);
+ tolua_constant(tolua_S,NULL,"EFF_WAVE",EFF_WAVE);
+ tolua_constant(tolua_S,NULL,"EFF_STORM",EFF_STORM);
+ tolua_constant(tolua_S,NULL,"EFF_THINWAVE",EFF_THINWAVE);
+ tolua_constant(tolua_S,NULL,"EFF_VORTEX",EFF_VORTEX);
+ tolua_constant(tolua_S,NULL,"TBRAND_ELEC",TBRAND_ELEC);
+ tolua_constant(tolua_S,NULL,"TBRAND_COLD",TBRAND_COLD);
+ tolua_constant(tolua_S,NULL,"TBRAND_FIRE",TBRAND_FIRE);
+ tolua_constant(tolua_S,NULL,"TBRAND_ACID",TBRAND_ACID);
+ tolua_constant(tolua_S,NULL,"TBRAND_POIS",TBRAND_POIS);
+ tolua_constant(tolua_S,NULL,"TBRAND_BASE",TBRAND_BASE);
+ tolua_constant(tolua_S,NULL,"TBRAND_CHAO",TBRAND_CHAO);
+ tolua_constant(tolua_S,NULL,"TBRAND_VORP",TBRAND_VORP);
+ tolua_constant(tolua_S,NULL,"TBRAND_BALL_FIRE",TBRAND_BALL_FIRE);
+ tolua_constant(tolua_S,NULL,"TBRAND_BALL_COLD",TBRAND_BALL_COLD);
+ tolua_constant(tolua_S,NULL,"TBRAND_BALL_ELEC",TBRAND_BALL_ELEC);
+ tolua_constant(tolua_S,NULL,"TBRAND_BALL_ACID",TBRAND_BALL_ACID);
+ tolua_constant(tolua_S,NULL,"TBRAND_BALL_SOUN",TBRAND_BALL_SOUN);
+ tolua_constant(tolua_S,NULL,"TBRAND_HELLFIRE",TBRAND_HELLFIRE);
+ tolua_constant(tolua_S,NULL,"TBRAND_VAMPIRIC",TBRAND_VAMPIRIC);
+ tolua_constant(tolua_S,NULL,"TBRAND_ICE",TBRAND_ICE);
+ tolua_constant(tolua_S,NULL,"TBRAND_PLASMA",TBRAND_PLASMA);
+ tolua_constant(tolua_S,NULL,"TBRAND_F_EXTERN",TBRAND_F_EXTERN);
+ tolua_constant(tolua_S,NULL,"TBRAND_F_POTION_MUSHROOM",TBRAND_F_POTION_MUSHROOM);
+ tolua_constant(tolua_S,NULL,"TBRAND_F_MAINHAND",TBRAND_F_MAINHAND);
+ tolua_constant(tolua_S,NULL,"TBRAND_F_OFFHAND",TBRAND_F_OFFHAND);
+ tolua_constant(tolua_S,NULL,"TBRAND_F_DUAL",TBRAND_F_DUAL);
+ tolua_constant(tolua_S,NULL,"SHIELD_NONE",SHIELD_NONE);
+ tolua_constant(tolua_S,NULL,"SHIELD_COUNTER",SHIELD_COUNTER);
+ tolua_constant(tolua_S,NULL,"SHIELD_FIRE",SHIELD_FIRE);
+ tolua_constant(tolua_S,NULL,"GF_ELEC",GF_ELEC);
+ tolua_constant(tolua_S,NULL,"GF_POIS",GF_POIS);
+ tolua_constant(tolua_S,NULL,"GF_ACID",GF_ACID);
+ tolua_constant(tolua_S,NULL,"GF_COLD",GF_COLD);
+ tolua_constant(tolua_S,NULL,"GF_FIRE",GF_FIRE);
+ tolua_constant(tolua_S,NULL,"GF_SHOT",GF_SHOT);
+ tolua_constant(tolua_S,NULL,"GF_ARROW",GF_ARROW);
+ tolua_constant(tolua_S,NULL,"GF_BOLT",GF_BOLT);
+ tolua_constant(tolua_S,NULL,"GF_BOULDER",GF_BOULDER);
+ tolua_constant(tolua_S,NULL,"GF_MISSILE",GF_MISSILE);
+ tolua_constant(tolua_S,NULL,"GF_ACID_BLIND",GF_ACID_BLIND);
+ tolua_constant(tolua_S,NULL,"GF_PLASMA",GF_PLASMA);
+ tolua_constant(tolua_S,NULL,"GF_HOLY_ORB",GF_HOLY_ORB);
+ tolua_constant(tolua_S,NULL,"GF_WATER",GF_WATER);
+ tolua_constant(tolua_S,NULL,"GF_LITE",GF_LITE);
+ tolua_constant(tolua_S,NULL,"GF_DARK",GF_DARK);
+ tolua_constant(tolua_S,NULL,"GF_LITE_WEAK",GF_LITE_WEAK);
+ tolua_constant(tolua_S,NULL,"GF_DARK_WEAK",GF_DARK_WEAK);
+ tolua_constant(tolua_S,NULL,"GF_PROTEVIL_PLAYER",GF_PROTEVIL_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_SHARDS",GF_SHARDS);
+ tolua_constant(tolua_S,NULL,"GF_SOUND",GF_SOUND);
+ tolua_constant(tolua_S,NULL,"GF_CONFUSION",GF_CONFUSION);
+ tolua_constant(tolua_S,NULL,"GF_FORCE",GF_FORCE);
+ tolua_constant(tolua_S,NULL,"GF_INERTIA",GF_INERTIA);
+ tolua_constant(tolua_S,NULL,"GF_MANA",GF_MANA);
+ tolua_constant(tolua_S,NULL,"GF_METEOR",GF_METEOR);
+ tolua_constant(tolua_S,NULL,"GF_ICE",GF_ICE);
+ tolua_constant(tolua_S,NULL,"GF_CHAOS",GF_CHAOS);
+ tolua_constant(tolua_S,NULL,"GF_NETHER",GF_NETHER);
+ tolua_constant(tolua_S,NULL,"GF_DISENCHANT",GF_DISENCHANT);
+ tolua_constant(tolua_S,NULL,"GF_NEXUS",GF_NEXUS);
+ tolua_constant(tolua_S,NULL,"GF_TIME",GF_TIME);
+ tolua_constant(tolua_S,NULL,"GF_GRAVITY",GF_GRAVITY);
+ tolua_constant(tolua_S,NULL,"GF_KILL_WALL",GF_KILL_WALL);
+ tolua_constant(tolua_S,NULL,"GF_KILL_DOOR",GF_KILL_DOOR);
+ tolua_constant(tolua_S,NULL,"GF_KILL_TRAP",GF_KILL_TRAP);
+ tolua_constant(tolua_S,NULL,"GF_KILL_TRAP_DOOR",GF_KILL_TRAP_DOOR);
+ tolua_constant(tolua_S,NULL,"GF_MAKE_WALL",GF_MAKE_WALL);
+ tolua_constant(tolua_S,NULL,"GF_MAKE_DOOR",GF_MAKE_DOOR);
+ tolua_constant(tolua_S,NULL,"GF_MAKE_TRAP",GF_MAKE_TRAP);
+ tolua_constant(tolua_S,NULL,"GF_OLD_CLONE",GF_OLD_CLONE);
+ tolua_constant(tolua_S,NULL,"GF_OLD_POLY",GF_OLD_POLY);
+ tolua_constant(tolua_S,NULL,"GF_OLD_HEAL",GF_OLD_HEAL);
+ tolua_constant(tolua_S,NULL,"GF_OLD_SPEED",GF_OLD_SPEED);
+ tolua_constant(tolua_S,NULL,"GF_OLD_SLOW",GF_OLD_SLOW);
+ tolua_constant(tolua_S,NULL,"GF_OLD_CONF",GF_OLD_CONF);
+ tolua_constant(tolua_S,NULL,"GF_OLD_SLEEP",GF_OLD_SLEEP);
+ tolua_constant(tolua_S,NULL,"GF_OLD_DRAIN",GF_OLD_DRAIN);
+ tolua_constant(tolua_S,NULL,"GF_AWAY_UNDEAD",GF_AWAY_UNDEAD);
+ tolua_constant(tolua_S,NULL,"GF_AWAY_EVIL",GF_AWAY_EVIL);
+ tolua_constant(tolua_S,NULL,"GF_AWAY_ALL",GF_AWAY_ALL);
+ tolua_constant(tolua_S,NULL,"GF_TURN_UNDEAD",GF_TURN_UNDEAD);
+ tolua_constant(tolua_S,NULL,"GF_TURN_EVIL",GF_TURN_EVIL);
+ tolua_constant(tolua_S,NULL,"GF_TURN_ALL",GF_TURN_ALL);
+ tolua_constant(tolua_S,NULL,"GF_DISP_UNDEAD",GF_DISP_UNDEAD);
+ tolua_constant(tolua_S,NULL,"GF_DISP_EVIL",GF_DISP_EVIL);
+ tolua_constant(tolua_S,NULL,"GF_DISP_ALL",GF_DISP_ALL);
+ tolua_constant(tolua_S,NULL,"GF_HEAL_PLAYER",GF_HEAL_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_STONE_WALL",GF_STONE_WALL);
+ tolua_constant(tolua_S,NULL,"GF_EARTHQUAKE",GF_EARTHQUAKE);
+ tolua_constant(tolua_S,NULL,"GF_WRAITH_PLAYER",GF_WRAITH_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_SPEED_PLAYER",GF_SPEED_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_SHIELD_PLAYER",GF_SHIELD_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_RECALL_PLAYER",GF_RECALL_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_STUN",GF_STUN);
+ tolua_constant(tolua_S,NULL,"GF_IDENTIFY",GF_IDENTIFY);
+ tolua_constant(tolua_S,NULL,"GF_PSI",GF_PSI);
+ tolua_constant(tolua_S,NULL,"GF_HOLY_FIRE",GF_HOLY_FIRE);
+ tolua_constant(tolua_S,NULL,"GF_DISINTEGRATE",GF_DISINTEGRATE);
+ tolua_constant(tolua_S,NULL,"GF_HELLFIRE",GF_HELLFIRE);
+ tolua_constant(tolua_S,NULL,"GF_NETHER_WEAK",GF_NETHER_WEAK);
+ tolua_constant(tolua_S,NULL,"GF_REMCURSE_PLAYER",GF_REMCURSE_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_KILL_GLYPH",GF_KILL_GLYPH);
+ tolua_constant(tolua_S,NULL,"GF_STARLITE",GF_STARLITE);
+ tolua_constant(tolua_S,NULL,"GF_TERROR",GF_TERROR);
+ tolua_constant(tolua_S,NULL,"GF_HAVOC",GF_HAVOC);
+ tolua_constant(tolua_S,NULL,"GF_INFERNO",GF_INFERNO);
+ tolua_constant(tolua_S,NULL,"GF_DETONATION",GF_DETONATION);
+ tolua_constant(tolua_S,NULL,"GF_ROCKET",GF_ROCKET);
+ tolua_constant(tolua_S,NULL,"GF_REMFEAR",GF_REMFEAR);
+ tolua_constant(tolua_S,NULL,"GF_HERO_MONSTER",GF_HERO_MONSTER);
+ tolua_constant(tolua_S,NULL,"GF_LIFEHEAL",GF_LIFEHEAL);
+ tolua_constant(tolua_S,NULL,"GF_DEC_STR",GF_DEC_STR);
+ tolua_constant(tolua_S,NULL,"GF_DEC_DEX",GF_DEC_DEX);
+ tolua_constant(tolua_S,NULL,"GF_DEC_CON",GF_DEC_CON);
+ tolua_constant(tolua_S,NULL,"GF_RES_STR",GF_RES_STR);
+ tolua_constant(tolua_S,NULL,"GF_RES_DEX",GF_RES_DEX);
+ tolua_constant(tolua_S,NULL,"GF_RES_CON",GF_RES_CON);
+ tolua_constant(tolua_S,NULL,"GF_INC_STR",GF_INC_STR);
+ tolua_constant(tolua_S,NULL,"GF_INC_DEX",GF_INC_DEX);
+ tolua_constant(tolua_S,NULL,"GF_INC_CON",GF_INC_CON);
+ tolua_constant(tolua_S,NULL,"GF_AUGMENTATION",GF_AUGMENTATION);
+ tolua_constant(tolua_S,NULL,"GF_RUINATION",GF_RUINATION);
+ tolua_constant(tolua_S,NULL,"GF_EXP",GF_EXP);
+ tolua_constant(tolua_S,NULL,"GF_MIND_SLOW",GF_MIND_SLOW);
+ tolua_constant(tolua_S,NULL,"GF_TBRAND_POIS",GF_TBRAND_POIS);
+ tolua_constant(tolua_S,NULL,"GF_CODE",GF_CODE);
+ tolua_constant(tolua_S,NULL,"GF_NUKE",GF_NUKE);
+ tolua_constant(tolua_S,NULL,"GF_BLIND",GF_BLIND);
+ tolua_constant(tolua_S,NULL,"GF_HOLD",GF_HOLD);
+ tolua_constant(tolua_S,NULL,"GF_DOMINATE",GF_DOMINATE);
+ tolua_constant(tolua_S,NULL,"GF_BLESS_PLAYER",GF_BLESS_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_REMFEAR_PLAYER",GF_REMFEAR_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_SATHUNGER_PLAYER",GF_SATHUNGER_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_RESFIRE_PLAYER",GF_RESFIRE_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_RESCOLD_PLAYER",GF_RESCOLD_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_CUREPOISON_PLAYER",GF_CUREPOISON_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_SEEINVIS_PLAYER",GF_SEEINVIS_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_SEEMAP_PLAYER",GF_SEEMAP_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_CURECUT_PLAYER",GF_CURECUT_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_CURESTUN_PLAYER",GF_CURESTUN_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_DETECTCREATURE_PLAYER",GF_DETECTCREATURE_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_DETECTDOOR_PLAYER",GF_DETECTDOOR_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_DETECTTRAP_PLAYER",GF_DETECTTRAP_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_TELEPORTLVL_PLAYER",GF_TELEPORTLVL_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_RESPOIS_PLAYER",GF_RESPOIS_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_RESELEC_PLAYER",GF_RESELEC_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_RESACID_PLAYER",GF_RESACID_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_HPINCREASE_PLAYER",GF_HPINCREASE_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_HERO_PLAYER",GF_HERO_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_SHERO_PLAYER",GF_SHERO_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_UNBREATH",GF_UNBREATH);
+ tolua_constant(tolua_S,NULL,"GF_WAVE",GF_WAVE);
+ tolua_constant(tolua_S,NULL,"GF_TELEPORT_PLAYER",GF_TELEPORT_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_RESTORE_PLAYER",GF_RESTORE_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_VAPOUR",GF_VAPOUR);
+ tolua_constant(tolua_S,NULL,"GF_CURE_PLAYER",GF_CURE_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_RESURRECT_PLAYER",GF_RESURRECT_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_SANITY_PLAYER",GF_SANITY_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_ZEAL_PLAYER",GF_ZEAL_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_DISP_DEMON",GF_DISP_DEMON);
+ tolua_constant(tolua_S,NULL,"GF_SOULCURE_PLAYER",GF_SOULCURE_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_MINDBOOST_PLAYER",GF_MINDBOOST_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_REMCONF_PLAYER",GF_REMCONF_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_REMIMAGE_PLAYER",GF_REMIMAGE_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_SLOWPOISON_PLAYER",GF_SLOWPOISON_PLAYER);
+ tolua_constant(tolua_S,NULL,"GF_CURING",GF_CURING);
+ tolua_constant(tolua_S,NULL,"GF_TELE_TO",GF_TELE_TO);
+ tolua_constant(tolua_S,NULL,"GF_HAND_DOOM",GF_HAND_DOOM);
+ tolua_constant(tolua_S,NULL,"GF_STASIS",GF_STASIS);
+ tolua_constant(tolua_S,NULL,"GF_CURSE",GF_CURSE);
+ tolua_constant(tolua_S,NULL,"GF_HEALINGCLOUD",GF_HEALINGCLOUD);
+ tolua_constant(tolua_S,NULL,"GF_WATERPOISON",GF_WATERPOISON);
+ tolua_constant(tolua_S,NULL,"GF_ICEPOISON",GF_ICEPOISON);
+ tolua_constant(tolua_S,NULL,"GF_EXTRA_STATS",GF_EXTRA_STATS);
+ tolua_constant(tolua_S,NULL,"GF_EXTRA_TOHIT",GF_EXTRA_TOHIT);
+ tolua_constant(tolua_S,NULL,"GF_PUSH",GF_PUSH);
+ tolua_constant(tolua_S,NULL,"GF_SILENCE",GF_SILENCE);
+ tolua_constant(tolua_S,NULL,"GF_CHARMIGNORE",GF_CHARMIGNORE);
+ tolua_constant(tolua_S,NULL,"GF_STOP",GF_STOP);
+ tolua_constant(tolua_S,NULL,"GF_CAUSE",GF_CAUSE);
+ tolua_constant(tolua_S,NULL,"GF_FLARE",GF_FLARE);
+ tolua_constant(tolua_S,NULL,"GF_LIFE_SLOW",GF_LIFE_SLOW);
+ tolua_constant(tolua_S,NULL,"GF_NO_REGEN",GF_NO_REGEN);
+ tolua_constant(tolua_S,NULL,"GF_THUNDER",GF_THUNDER);
+ tolua_constant(tolua_S,NULL,"GF_ANNIHILATION",GF_ANNIHILATION);
+ tolua_constant(tolua_S,NULL,"GF_VINE_SLOW",GF_VINE_SLOW);
+ tolua_constant(tolua_S,NULL,"GF_DISP_UNDEAD_DEMON",GF_DISP_UNDEAD_DEMON);
+ tolua_constant(tolua_S,NULL,"GF_RIFT",GF_RIFT);
+ tolua_constant(tolua_S,NULL,"GF_RESTORING",GF_RESTORING);
+ tolua_constant(tolua_S,NULL,"GF_UNHEALTH",GF_UNHEALTH);
+ tolua_constant(tolua_S,NULL,"GF_DISEASE",GF_DISEASE);
+ tolua_constant(tolua_S,NULL,"GF_DEC_INT",GF_DEC_INT);
+ tolua_constant(tolua_S,NULL,"GF_DEC_WIS",GF_DEC_WIS);
+ tolua_constant(tolua_S,NULL,"GF_DEC_CHR",GF_DEC_CHR);
+ tolua_constant(tolua_S,NULL,"GF_RES_INT",GF_RES_INT);
+ tolua_constant(tolua_S,NULL,"GF_RES_WIS",GF_RES_WIS);
+ tolua_constant(tolua_S,NULL,"GF_RES_CHR",GF_RES_CHR);
+ tolua_constant(tolua_S,NULL,"GF_INC_INT",GF_INC_INT);
+ tolua_constant(tolua_S,NULL,"GF_INC_WIS",GF_INC_WIS);
+ tolua_constant(tolua_S,NULL,"GF_INC_CHR",GF_INC_CHR);
+ tolua_constant(tolua_S,NULL,"GF_SNOWFLAKE",GF_SNOWFLAKE);
+ tolua_constant(tolua_S,NULL,"GF_FW_FIRE",GF_FW_FIRE);
+ tolua_constant(tolua_S,NULL,"GF_FW_ELEC",GF_FW_ELEC);
+ tolua_constant(tolua_S,NULL,"GF_FW_POIS",GF_FW_POIS);
+ tolua_constant(tolua_S,NULL,"GF_FW_LITE",GF_FW_LITE);
+ tolua_constant(tolua_S,NULL,"GF_FW_YCLD",GF_FW_YCLD);
+ tolua_constant(tolua_S,NULL,"GF_FW_SHDM",GF_FW_SHDM);
+ tolua_constant(tolua_S,NULL,"GF_FW_MULT",GF_FW_MULT);
+ tolua_constant(tolua_S,NULL,"GF_RAINDROP",GF_RAINDROP);
+ tolua_constant(tolua_S,NULL,"GF_LEAF",GF_LEAF);
+ tolua_constant(tolua_S,NULL,"GF_SHOW_LIGHTNING",GF_SHOW_LIGHTNING);
+ tolua_constant(tolua_S,NULL,"GF_THUNDER_VISUAL",GF_THUNDER_VISUAL);
+ tolua_function(tolua_S,NULL,"warding_glyph",toluaI_spells_warding_glyph00);
+ tolua_function(tolua_S,NULL,"cave_set_feat",toluaI_spells_cave_set_feat00);
+ tolua_function(tolua_S,NULL,"cave_set_feat_live",toluaI_spells_cave_set_feat_live00);
+ tolua_function(tolua_S,NULL,"custom_cave_set_feat",toluaI_spells_custom_cave_set_feat00);
+ tolua_function(tolua_S,NULL,"custom_cave_set_feat_live",toluaI_spells_custom_cave_set_feat_live00);
+ tolua_function(tolua_S,NULL,"check_feat",toluaI_spells_check_feat00);
+ tolua_function(tolua_S,NULL,"dun_get_wid",toluaI_spells_dun_get_wid00);
+ tolua_function(tolua_S,NULL,"dun_get_hgt",toluaI_spells_dun_get_hgt00);
+ tolua_function(tolua_S,NULL,"check_monster",toluaI_spells_check_monster00);
+ tolua_function(tolua_S,NULL,"check_monster_ego",toluaI_spells_check_monster_ego00);
+ tolua_function(tolua_S,NULL,"check_item_tval",toluaI_spells_check_item_tval00);
+ tolua_function(tolua_S,NULL,"check_item_sval",toluaI_spells_check_item_sval00);
+ tolua_function(tolua_S,NULL,"custom_place_item_module",toluaI_spells_custom_place_item_module00);
+ tolua_function(tolua_S,NULL,"place_item_module",toluaI_spells_place_item_module00);
+ tolua_function(tolua_S,NULL,"place_monster_ego",toluaI_spells_place_monster_ego00);
+ tolua_function(tolua_S,NULL,"custom_place_monster_ego",toluaI_spells_custom_place_monster_ego00);
+ tolua_function(tolua_S,NULL,"players_on_depth",toluaI_spells_players_on_depth00);
+ tolua_function(tolua_S,NULL,"level_up_x",toluaI_spells_level_up_x00);
+ tolua_function(tolua_S,NULL,"level_up_y",toluaI_spells_level_up_y00);
+ tolua_function(tolua_S,NULL,"level_down_x",toluaI_spells_level_down_x00);
+ tolua_function(tolua_S,NULL,"level_down_y",toluaI_spells_level_down_y00);
+ tolua_function(tolua_S,NULL,"level_rand_x",toluaI_spells_level_rand_x00);
+ tolua_function(tolua_S,NULL,"level_rand_y",toluaI_spells_level_rand_y00);
+ tolua_function(tolua_S,NULL,"new_level_up_x",toluaI_spells_new_level_up_x00);
+ tolua_function(tolua_S,NULL,"new_level_up_y",toluaI_spells_new_level_up_y00);
+ tolua_function(tolua_S,NULL,"new_level_down_x",toluaI_spells_new_level_down_x00);
+ tolua_function(tolua_S,NULL,"new_level_down_y",toluaI_spells_new_level_down_y00);
+ tolua_function(tolua_S,NULL,"new_level_rand_x",toluaI_spells_new_level_rand_x00);
+ tolua_function(tolua_S,NULL,"new_level_rand_y",toluaI_spells_new_level_rand_y00);
+ tolua_function(tolua_S,NULL,"make_wpos",toluaI_spells_make_wpos00);
+ tolua_function(tolua_S,NULL,"summon_override",toluaI_spells_summon_override00);
+ tolua_function(tolua_S,NULL,"generate_cave_blank",toluaI_spells_generate_cave_blank00);
+ tolua_function(tolua_S,NULL,"do_cmd_fusion",toluaI_spells_do_cmd_fusion00);
+ tolua_function(tolua_S,NULL,"place_up_stairs",toluaI_spells_place_up_stairs00);
+ tolua_function(tolua_S,NULL,"spell_color",toluaI_spells_spell_color00);
+ tolua_function(tolua_S,NULL,"take_hit",toluaI_spells_take_hit00);
+ tolua_function(tolua_S,NULL,"take_xp_hit",toluaI_spells_take_xp_hit00);
+ tolua_function(tolua_S,NULL,"take_sanity_hit",toluaI_spells_take_sanity_hit00);
+ tolua_function(tolua_S,NULL,"poly_r_idx",toluaI_spells_poly_r_idx00);
+ tolua_function(tolua_S,NULL,"check_st_anchor",toluaI_spells_check_st_anchor00);
+ tolua_function(tolua_S,NULL,"swap_position",toluaI_spells_swap_position00);
+ tolua_function(tolua_S,NULL,"teleport_away",toluaI_spells_teleport_away00);
+ tolua_function(tolua_S,NULL,"teleport_player",toluaI_spells_teleport_player00);
+ tolua_function(tolua_S,NULL,"teleport_player_to",toluaI_spells_teleport_player_to00);
+ tolua_function(tolua_S,NULL,"teleport_player_level",toluaI_spells_teleport_player_level00);
+ tolua_function(tolua_S,NULL,"retreat_player",toluaI_spells_retreat_player00);
+ tolua_globalvar(tolua_S,"bypass_invuln",toluaI_get_spells_bypass_invuln,toluaI_set_spells_bypass_invuln);
+ tolua_function(tolua_S,NULL,"acid_dam",toluaI_spells_acid_dam00);
+ tolua_function(tolua_S,NULL,"elec_dam",toluaI_spells_elec_dam00);
+ tolua_function(tolua_S,NULL,"fire_dam",toluaI_spells_fire_dam00);
+ tolua_function(tolua_S,NULL,"cold_dam",toluaI_spells_cold_dam00);
+ tolua_function(tolua_S,NULL,"inc_stat",toluaI_spells_inc_stat00);
+ tolua_function(tolua_S,NULL,"dec_stat",toluaI_spells_dec_stat00);
+ tolua_function(tolua_S,NULL,"res_stat",toluaI_spells_res_stat00);
+ tolua_function(tolua_S,NULL,"apply_disenchant",toluaI_spells_apply_disenchant00);
+ tolua_function(tolua_S,NULL,"apply_discharge",toluaI_spells_apply_discharge00);
+ tolua_function(tolua_S,NULL,"apply_discharge_item",toluaI_spells_apply_discharge_item00);
+ tolua_function(tolua_S,NULL,"project_hook",toluaI_spells_project_hook00);
+ tolua_function(tolua_S,NULL,"project",toluaI_spells_project00);
+ tolua_function(tolua_S,NULL,"set_all_destroy",toluaI_spells_set_all_destroy00);
+ tolua_function(tolua_S,NULL,"set_cold_destroy",toluaI_spells_set_cold_destroy00);
+ tolua_function(tolua_S,NULL,"set_impact_destroy",toluaI_spells_set_impact_destroy00);
+ tolua_function(tolua_S,NULL,"set_water_destroy",toluaI_spells_set_water_destroy00);
+ tolua_function(tolua_S,NULL,"equip_damage",toluaI_spells_equip_damage00);
+ tolua_function(tolua_S,NULL,"inven_damage",toluaI_spells_inven_damage00);
+ tolua_function(tolua_S,NULL,"weapon_takes_damage",toluaI_spells_weapon_takes_damage00);
+ tolua_function(tolua_S,NULL,"set_oppose_acid",toluaI_spells_set_oppose_acid00);
+ tolua_function(tolua_S,NULL,"set_oppose_elec",toluaI_spells_set_oppose_elec00);
+ tolua_function(tolua_S,NULL,"set_oppose_fire",toluaI_spells_set_oppose_fire00);
+ tolua_function(tolua_S,NULL,"set_oppose_cold",toluaI_spells_set_oppose_cold00);
+ tolua_function(tolua_S,NULL,"set_oppose_pois",toluaI_spells_set_oppose_pois00);
+ tolua_function(tolua_S,NULL,"set_stun",toluaI_spells_set_stun00);
+ tolua_function(tolua_S,NULL,"set_cut",toluaI_spells_set_cut00);
+ tolua_function(tolua_S,NULL,"set_food",toluaI_spells_set_food00);
+ tolua_function(tolua_S,NULL,"set_invuln_short",toluaI_spells_set_invuln_short00);
+ tolua_function(tolua_S,NULL,"set_biofeedback",toluaI_spells_set_biofeedback00);
+ tolua_function(tolua_S,NULL,"set_adrenaline",toluaI_spells_set_adrenaline00);
+ tolua_function(tolua_S,NULL,"set_tim_esp",toluaI_spells_set_tim_esp00);
+ tolua_function(tolua_S,NULL,"set_st_anchor",toluaI_spells_set_st_anchor00);
+ tolua_function(tolua_S,NULL,"set_prob_travel",toluaI_spells_set_prob_travel00);
+ tolua_function(tolua_S,NULL,"set_mimic",toluaI_spells_set_mimic00);
+ tolua_function(tolua_S,NULL,"set_tim_traps",toluaI_spells_set_tim_traps00);
+ tolua_function(tolua_S,NULL,"set_tim_manashield",toluaI_spells_set_tim_manashield00);
+ tolua_function(tolua_S,NULL,"set_invis",toluaI_spells_set_invis00);
+ tolua_function(tolua_S,NULL,"set_shroud",toluaI_spells_set_shroud00);
+ tolua_function(tolua_S,NULL,"set_fury",toluaI_spells_set_fury00);
+ tolua_function(tolua_S,NULL,"set_tim_meditation",toluaI_spells_set_tim_meditation00);
+ tolua_function(tolua_S,NULL,"set_tim_wraith",toluaI_spells_set_tim_wraith00);
+ tolua_function(tolua_S,NULL,"set_tim_wraithstep",toluaI_spells_set_tim_wraithstep00);
+ tolua_function(tolua_S,NULL,"set_blind",toluaI_spells_set_blind00);
+ tolua_function(tolua_S,NULL,"set_confused",toluaI_spells_set_confused00);
+ tolua_function(tolua_S,NULL,"set_poisoned",toluaI_spells_set_poisoned00);
+ tolua_function(tolua_S,NULL,"set_diseased",toluaI_spells_set_diseased00);
+ tolua_function(tolua_S,NULL,"set_afraid",toluaI_spells_set_afraid00);
+ tolua_function(tolua_S,NULL,"set_paralyzed",toluaI_spells_set_paralyzed00);
+ tolua_function(tolua_S,NULL,"set_stopped",toluaI_spells_set_stopped00);
+ tolua_function(tolua_S,NULL,"set_image",toluaI_spells_set_image00);
+ tolua_function(tolua_S,NULL,"set_fast",toluaI_spells_set_fast00);
+ tolua_function(tolua_S,NULL,"set_slow",toluaI_spells_set_slow00);
+ tolua_function(tolua_S,NULL,"set_tim_reflect",toluaI_spells_set_tim_reflect00);
+ tolua_function(tolua_S,NULL,"wizard_lock",toluaI_spells_wizard_lock00);
+ tolua_function(tolua_S,NULL,"set_shield",toluaI_spells_set_shield00);
+ tolua_function(tolua_S,NULL,"set_tim_thunder",toluaI_spells_set_tim_thunder00);
+ tolua_function(tolua_S,NULL,"set_tim_regen",toluaI_spells_set_tim_regen00);
+ tolua_function(tolua_S,NULL,"set_tim_mp2hp",toluaI_spells_set_tim_mp2hp00);
+ tolua_function(tolua_S,NULL,"set_tim_ffall",toluaI_spells_set_tim_ffall00);
+ tolua_function(tolua_S,NULL,"set_tim_lev",toluaI_spells_set_tim_lev00);
+ tolua_function(tolua_S,NULL,"set_blessed",toluaI_spells_set_blessed00);
+ tolua_function(tolua_S,NULL,"set_dispersion",toluaI_spells_set_dispersion00);
+ tolua_function(tolua_S,NULL,"set_res_fear",toluaI_spells_set_res_fear00);
+ tolua_function(tolua_S,NULL,"set_hero",toluaI_spells_set_hero00);
+ tolua_function(tolua_S,NULL,"set_shero",toluaI_spells_set_shero00);
+ tolua_function(tolua_S,NULL,"set_protevil",toluaI_spells_set_protevil00);
+ tolua_function(tolua_S,NULL,"set_zeal",toluaI_spells_set_zeal00);
+ tolua_function(tolua_S,NULL,"set_martyr",toluaI_spells_set_martyr00);
+ tolua_function(tolua_S,NULL,"set_invuln",toluaI_spells_set_invuln00);
+ tolua_function(tolua_S,NULL,"set_tim_invis",toluaI_spells_set_tim_invis00);
+ tolua_function(tolua_S,NULL,"set_tim_infra",toluaI_spells_set_tim_infra00);
+ tolua_function(tolua_S,NULL,"set_mindboost",toluaI_spells_set_mindboost00);
+ tolua_function(tolua_S,NULL,"set_kinetic_shield",toluaI_spells_set_kinetic_shield00);
+ tolua_function(tolua_S,NULL,"set_savingthrow",toluaI_spells_set_savingthrow00);
+ tolua_function(tolua_S,NULL,"set_spirit_shield",toluaI_spells_set_spirit_shield00);
+ tolua_function(tolua_S,NULL,"identify_fully",toluaI_spells_identify_fully00);
+ tolua_function(tolua_S,NULL,"self_knowledge",toluaI_spells_self_knowledge00);
+ tolua_function(tolua_S,NULL,"ident_spell",toluaI_spells_ident_spell00);
+ tolua_function(tolua_S,NULL,"map_area",toluaI_spells_map_area00);
+ tolua_function(tolua_S,NULL,"mind_map_level",toluaI_spells_mind_map_level00);
+ tolua_function(tolua_S,NULL,"wiz_lite",toluaI_spells_wiz_lite00);
+ tolua_function(tolua_S,NULL,"wiz_lite_extra",toluaI_spells_wiz_lite_extra00);
+ tolua_function(tolua_S,NULL,"wiz_lite_spell",toluaI_spells_wiz_lite_spell00);
+ tolua_function(tolua_S,NULL,"wiz_dark",toluaI_spells_wiz_dark00);
+ tolua_function(tolua_S,NULL,"detect_creatures_xxx",toluaI_spells_detect_creatures_xxx00);
+ tolua_function(tolua_S,NULL,"detect_creatures",toluaI_spells_detect_creatures00);
+ tolua_function(tolua_S,NULL,"place_foe",toluaI_spells_place_foe00);
+ tolua_function(tolua_S,NULL,"heal_insanity",toluaI_spells_heal_insanity00);
+ tolua_function(tolua_S,NULL,"summon_cyber",toluaI_spells_summon_cyber00);
+ tolua_function(tolua_S,NULL,"golem_creation",toluaI_spells_golem_creation00);
+ tolua_function(tolua_S,NULL,"hp_player",toluaI_spells_hp_player00);
+ tolua_function(tolua_S,NULL,"warding_glyph",toluaI_spells_warding_glyph01);
+ tolua_function(tolua_S,NULL,"do_dec_stat",toluaI_spells_do_dec_stat00);
+ tolua_function(tolua_S,NULL,"do_res_stat",toluaI_spells_do_res_stat00);
+ tolua_function(tolua_S,NULL,"do_inc_stat",toluaI_spells_do_inc_stat00);
+ tolua_function(tolua_S,NULL,"identify_pack",toluaI_spells_identify_pack00);
+ tolua_function(tolua_S,NULL,"message_pain",toluaI_spells_message_pain00);
+ tolua_function(tolua_S,NULL,"remove_curse",toluaI_spells_remove_curse00);
+ tolua_function(tolua_S,NULL,"remove_all_curse",toluaI_spells_remove_all_curse00);
+ tolua_function(tolua_S,NULL,"restore_level",toluaI_spells_restore_level00);
+ tolua_function(tolua_S,NULL,"self_knowledge",toluaI_spells_self_knowledge01);
+ tolua_function(tolua_S,NULL,"lose_all_info",toluaI_spells_lose_all_info00);
+ tolua_function(tolua_S,NULL,"detect_treasure",toluaI_spells_detect_treasure00);
+ tolua_function(tolua_S,NULL,"detect_magic",toluaI_spells_detect_magic00);
+ tolua_function(tolua_S,NULL,"detect_invisible",toluaI_spells_detect_invisible00);
+ tolua_function(tolua_S,NULL,"detect_evil",toluaI_spells_detect_evil00);
+ tolua_function(tolua_S,NULL,"detect_living",toluaI_spells_detect_living00);
+ tolua_function(tolua_S,NULL,"detect_noise",toluaI_spells_detect_noise00);
+ tolua_function(tolua_S,NULL,"detection",toluaI_spells_detection00);
+ tolua_function(tolua_S,NULL,"detect_object",toluaI_spells_detect_object00);
+ tolua_function(tolua_S,NULL,"detect_trap",toluaI_spells_detect_trap00);
+ tolua_function(tolua_S,NULL,"detect_sdoor",toluaI_spells_detect_sdoor00);
+ tolua_function(tolua_S,NULL,"stair_creation",toluaI_spells_stair_creation00);
+ tolua_function(tolua_S,NULL,"enchant",toluaI_spells_enchant00);
+ tolua_function(tolua_S,NULL,"enchant_spell",toluaI_spells_enchant_spell00);
+ tolua_function(tolua_S,NULL,"enchant_spell_aux",toluaI_spells_enchant_spell_aux00);
+ tolua_function(tolua_S,NULL,"ident_spell",toluaI_spells_ident_spell01);
+ tolua_function(tolua_S,NULL,"ident_spell_aux",toluaI_spells_ident_spell_aux00);
+ tolua_function(tolua_S,NULL,"identify_fully",toluaI_spells_identify_fully01);
+ tolua_function(tolua_S,NULL,"identify_fully_item",toluaI_spells_identify_fully_item00);
+ tolua_function(tolua_S,NULL,"recharge",toluaI_spells_recharge00);
+ tolua_function(tolua_S,NULL,"recharge_aux",toluaI_spells_recharge_aux00);
+ tolua_function(tolua_S,NULL,"speed_monsters",toluaI_spells_speed_monsters00);
+ tolua_function(tolua_S,NULL,"slow_monsters",toluaI_spells_slow_monsters00);
+ tolua_function(tolua_S,NULL,"sleep_monsters",toluaI_spells_sleep_monsters00);
+ tolua_function(tolua_S,NULL,"fear_monsters",toluaI_spells_fear_monsters00);
+ tolua_function(tolua_S,NULL,"stun_monsters",toluaI_spells_stun_monsters00);
+ tolua_function(tolua_S,NULL,"aggravate_monsters",toluaI_spells_aggravate_monsters00);
+ tolua_function(tolua_S,NULL,"wake_minions",toluaI_spells_wake_minions00);
+ tolua_function(tolua_S,NULL,"genocide_aux",toluaI_spells_genocide_aux00);
+ tolua_function(tolua_S,NULL,"genocide",toluaI_spells_genocide00);
+ tolua_function(tolua_S,NULL,"obliteration",toluaI_spells_obliteration00);
+ tolua_function(tolua_S,NULL,"probing",toluaI_spells_probing00);
+ tolua_function(tolua_S,NULL,"project_los_wall",toluaI_spells_project_los_wall00);
+ tolua_function(tolua_S,NULL,"project_los",toluaI_spells_project_los00);
+ tolua_function(tolua_S,NULL,"away_evil",toluaI_spells_away_evil00);
+ tolua_function(tolua_S,NULL,"dispel_evil",toluaI_spells_dispel_evil00);
+ tolua_function(tolua_S,NULL,"dispel_undead",toluaI_spells_dispel_undead00);
+ tolua_function(tolua_S,NULL,"dispel_demons",toluaI_spells_dispel_demons00);
+ tolua_function(tolua_S,NULL,"dispel_monsters",toluaI_spells_dispel_monsters00);
+ tolua_function(tolua_S,NULL,"turn_undead",toluaI_spells_turn_undead00);
+ tolua_function(tolua_S,NULL,"destroy_area",toluaI_spells_destroy_area00);
+ tolua_function(tolua_S,NULL,"earthquake",toluaI_spells_earthquake00);
+ tolua_function(tolua_S,NULL,"open_rift",toluaI_spells_open_rift00);
+ tolua_function(tolua_S,NULL,"wipe_spell",toluaI_spells_wipe_spell00);
+ tolua_function(tolua_S,NULL,"target_okay",toluaI_spells_target_okay00);
+ tolua_function(tolua_S,NULL,"lite_room",toluaI_spells_lite_room00);
+ tolua_function(tolua_S,NULL,"unlite_room",toluaI_spells_unlite_room00);
+ tolua_function(tolua_S,NULL,"lite_area",toluaI_spells_lite_area00);
+ tolua_function(tolua_S,NULL,"unlite_area",toluaI_spells_unlite_area00);
+ tolua_function(tolua_S,NULL,"fire_ball",toluaI_spells_fire_ball00);
+ tolua_function(tolua_S,NULL,"fire_burst",toluaI_spells_fire_burst00);
+ tolua_function(tolua_S,NULL,"fire_swarm",toluaI_spells_fire_swarm00);
+ tolua_function(tolua_S,NULL,"fire_cone",toluaI_spells_fire_cone00);
+ tolua_function(tolua_S,NULL,"fire_shot",toluaI_spells_fire_shot00);
+ tolua_function(tolua_S,NULL,"fire_wall",toluaI_spells_fire_wall00);
+ tolua_function(tolua_S,NULL,"fire_wall_wide",toluaI_spells_fire_wall_wide00);
+ tolua_function(tolua_S,NULL,"fire_nova",toluaI_spells_fire_nova00);
+ tolua_function(tolua_S,NULL,"fire_cloud",toluaI_spells_fire_cloud00);
+ tolua_function(tolua_S,NULL,"fire_wave",toluaI_spells_fire_wave00);
+ tolua_function(tolua_S,NULL,"fire_bolt",toluaI_spells_fire_bolt00);
+ tolua_function(tolua_S,NULL,"fire_beam",toluaI_spells_fire_beam00);
+ tolua_function(tolua_S,NULL,"fire_bolt_or_beam",toluaI_spells_fire_bolt_or_beam00);
+ tolua_function(tolua_S,NULL,"fire_grid_bolt",toluaI_spells_fire_grid_bolt00);
+ tolua_function(tolua_S,NULL,"fire_grid_beam",toluaI_spells_fire_grid_beam00);
+ tolua_function(tolua_S,NULL,"lite_line",toluaI_spells_lite_line00);
+ tolua_function(tolua_S,NULL,"drain_life",toluaI_spells_drain_life00);
+ tolua_function(tolua_S,NULL,"wall_to_mud",toluaI_spells_wall_to_mud00);
+ tolua_function(tolua_S,NULL,"destroy_trap_door",toluaI_spells_destroy_trap_door00);
+ tolua_function(tolua_S,NULL,"disarm_trap_door",toluaI_spells_disarm_trap_door00);
+ tolua_function(tolua_S,NULL,"heal_monster",toluaI_spells_heal_monster00);
+ tolua_function(tolua_S,NULL,"speed_monster",toluaI_spells_speed_monster00);
+ tolua_function(tolua_S,NULL,"slow_monster",toluaI_spells_slow_monster00);
+ tolua_function(tolua_S,NULL,"sleep_monster",toluaI_spells_sleep_monster00);
+ tolua_function(tolua_S,NULL,"confuse_monster",toluaI_spells_confuse_monster00);
+ tolua_function(tolua_S,NULL,"fear_monster",toluaI_spells_fear_monster00);
+ tolua_function(tolua_S,NULL,"poly_monster",toluaI_spells_poly_monster00);
+ tolua_function(tolua_S,NULL,"clone_monster",toluaI_spells_clone_monster00);
+ tolua_function(tolua_S,NULL,"teleport_monster",toluaI_spells_teleport_monster00);
+ tolua_function(tolua_S,NULL,"cure_light_wounds_proj",toluaI_spells_cure_light_wounds_proj00);
+ tolua_function(tolua_S,NULL,"cure_serious_wounds_proj",toluaI_spells_cure_serious_wounds_proj00);
+ tolua_function(tolua_S,NULL,"cure_critical_wounds_proj",toluaI_spells_cure_critical_wounds_proj00);
+ tolua_function(tolua_S,NULL,"grow_trees",toluaI_spells_grow_trees00);
+ tolua_function(tolua_S,NULL,"heal_other_proj",toluaI_spells_heal_other_proj00);
+ tolua_function(tolua_S,NULL,"door_creation",toluaI_spells_door_creation00);
+ tolua_function(tolua_S,NULL,"trap_creation",toluaI_spells_trap_creation00);
+ tolua_function(tolua_S,NULL,"destroy_doors_touch",toluaI_spells_destroy_doors_touch00);
+ tolua_function(tolua_S,NULL,"destroy_traps_touch",toluaI_spells_destroy_traps_touch00);
+ tolua_function(tolua_S,NULL,"destroy_traps_doors_touch",toluaI_spells_destroy_traps_doors_touch00);
+ tolua_function(tolua_S,NULL,"sleep_monsters_touch",toluaI_spells_sleep_monsters_touch00);
+ tolua_function(tolua_S,NULL,"create_artifact",toluaI_spells_create_artifact00);
+ tolua_function(tolua_S,NULL,"create_artifact_aux",toluaI_spells_create_artifact_aux00);
+ tolua_function(tolua_S,NULL,"curse_spell",toluaI_spells_curse_spell00);
+ tolua_function(tolua_S,NULL,"curse_spell_aux",toluaI_spells_curse_spell_aux00);
+ tolua_function(tolua_S,NULL,"house_creation",toluaI_spells_house_creation00);
+ tolua_function(tolua_S,NULL,"do_vermin_control",toluaI_spells_do_vermin_control00);
+ tolua_function(tolua_S,NULL,"do_autokinesis_to",toluaI_spells_do_autokinesis_to00);
+ tolua_function(tolua_S,NULL,"do_mstopcharm",toluaI_spells_do_mstopcharm00);
+ tolua_function(tolua_S,NULL,"cast_raindrop",toluaI_spells_cast_raindrop00);
+ tolua_function(tolua_S,NULL,"cast_snowflake",toluaI_spells_cast_snowflake00);
+ tolua_function(tolua_S,NULL,"cast_fireworks",toluaI_spells_cast_fireworks00);
+ tolua_function(tolua_S,NULL,"cast_falling_star",toluaI_spells_cast_falling_star00);
+ tolua_function(tolua_S,NULL,"thunderstorm_visual",toluaI_spells_thunderstorm_visual00);
+ tolua_function(tolua_S,NULL,"place_trap_specific",toluaI_spells_place_trap_specific00);
+ tolua_function(tolua_S,NULL,"rune_enchant",toluaI_spells_rune_enchant00);
+ tolua_function(tolua_S,NULL,"warding_rune",toluaI_spells_warding_rune00);
+ tolua_function(tolua_S,NULL,"warding_rune_break",toluaI_spells_warding_rune_break00);
+ tolua_function(tolua_S,NULL,"py_warding_rune_break",toluaI_spells_py_warding_rune_break00);
+ tolua_function(tolua_S,NULL,"create_garden",toluaI_spells_create_garden00);
+ tolua_function(tolua_S,NULL,"do_banish_animals",toluaI_spells_do_banish_animals00);
+ tolua_function(tolua_S,NULL,"do_xtra_stats",toluaI_spells_do_xtra_stats00);
+ tolua_function(tolua_S,NULL,"do_focus",toluaI_spells_do_focus00);
+ tolua_function(tolua_S,NULL,"set_tim_lcage",toluaI_spells_set_tim_lcage00);
+ tolua_function(tolua_S,NULL,"divine_vengeance",toluaI_spells_divine_vengeance00);
+ tolua_function(tolua_S,NULL,"divine_gateway",toluaI_spells_divine_gateway00);
+ tolua_function(tolua_S,NULL,"do_divine_xtra_res",toluaI_spells_do_divine_xtra_res00);
+ tolua_function(tolua_S,NULL,"do_divine_hp",toluaI_spells_do_divine_hp00);
+ tolua_function(tolua_S,NULL,"do_divine_crit",toluaI_spells_do_divine_crit00);
+ tolua_function(tolua_S,NULL,"set_recall_depth",toluaI_spells_set_recall_depth00);
+ tolua_function(tolua_S,NULL,"set_recall_timer",toluaI_spells_set_recall_timer00);
+ tolua_function(tolua_S,NULL,"set_recall",toluaI_spells_set_recall00);
+ tolua_function(tolua_S,NULL,"do_shadow_gate",toluaI_spells_do_shadow_gate00);
+ tolua_function(tolua_S,NULL,"set_melee_brand",toluaI_spells_set_melee_brand00);
+ tolua_function(tolua_S,NULL,"set_ammo_brand",toluaI_spells_set_ammo_brand00);
+ tolua_function(tolua_S,NULL,"set_nimbus",toluaI_spells_set_nimbus00);
+ tolua_cclass(tolua_S,"spell_type","");
+ tolua_tablevar(tolua_S,"spell_type","name",toluaI_get_spells_spell_type_name,toluaI_set_spells_spell_type_name);
+ tolua_tablevar(tolua_S,"spell_type","skill_level",toluaI_get_spells_spell_type_skill_level,toluaI_set_spells_spell_type_skill_level);
+ tolua_tablevar(tolua_S,"spell_type","mana",toluaI_get_spells_spell_type_mana,toluaI_set_spells_spell_type_mana);
+ tolua_tablevar(tolua_S,"spell_type","mana_max",toluaI_get_spells_spell_type_mana_max,toluaI_set_spells_spell_type_mana_max);
+ tolua_tablevar(tolua_S,"spell_type","fail",toluaI_get_spells_spell_type_fail,toluaI_set_spells_spell_type_fail);
+ tolua_tablevar(tolua_S,"spell_type","level",toluaI_get_spells_spell_type_level,toluaI_set_spells_spell_type_level);
+ tolua_tablevar(tolua_S,"spell_type","spell_power",toluaI_get_spells_spell_type_spell_power,toluaI_set_spells_spell_type_spell_power);
+ tolua_cclass(tolua_S,"school_type","");
+ tolua_tablevar(tolua_S,"school_type","name",toluaI_get_spells_school_type_name,toluaI_set_spells_school_type_name);
+ tolua_tablevar(tolua_S,"school_type","skill",toluaI_get_spells_school_type_skill,toluaI_set_spells_school_type_skill);
+ tolua_globalvar(tolua_S,"project_interval",toluaI_get_spells_project_interval,toluaI_set_spells_project_interval);
+ tolua_globalvar(tolua_S,"project_time",toluaI_get_spells_project_time,toluaI_set_spells_project_time);
+ tolua_globalvar(tolua_S,"project_time_effect",toluaI_get_spells_project_time_effect,toluaI_set_spells_project_time_effect);
+ tolua_function(tolua_S,NULL,"new_school",toluaI_spells_new_school00);
+ tolua_function(tolua_S,NULL,"new_spell",toluaI_spells_new_spell00);
+ tolua_function(tolua_S,NULL,"spell",toluaI_spells_spell00);
+ tolua_function(tolua_S,NULL,"school",toluaI_spells_school00);
+ tolua_function(tolua_S,NULL,"lua_get_level",toluaI_spells_lua_get_level00);
+ tolua_function(tolua_S,NULL,"lua_spell_chance",toluaI_spells_lua_spell_chance00);
+ tolua_function(tolua_S,NULL,"lua_s_print",toluaI_spells_lua_s_print00);
+ tolua_function(tolua_S,NULL,"lua_x_print",toluaI_spells_lua_x_print00);
+ tolua_function(tolua_S,NULL,"lua_add_anote",toluaI_spells_lua_add_anote00);
+ tolua_function(tolua_S,NULL,"lua_del_anotes",toluaI_spells_lua_del_anotes00);
+ tolua_function(tolua_S,NULL,"lua_broadcast_motd",toluaI_spells_lua_broadcast_motd00);
+ tolua_function(tolua_S,NULL,"lua_count_houses",toluaI_spells_lua_count_houses00);
+ tolua_function(tolua_S,NULL,"lua_recalc_char",toluaI_spells_lua_recalc_char00);
+ tolua_function(tolua_S,NULL,"lua_examine_item",toluaI_spells_lua_examine_item00);
+ tolua_function(tolua_S,NULL,"lua_determine_level_req",toluaI_spells_lua_determine_level_req00);
+ tolua_function(tolua_S,NULL,"lua_strip_true_arts_from_absent_players",toluaI_spells_lua_strip_true_arts_from_absent_players00);
+ tolua_function(tolua_S,NULL,"lua_strip_true_arts_from_present_player",toluaI_spells_lua_strip_true_arts_from_present_player00);
+ tolua_function(tolua_S,NULL,"lua_strip_true_arts_from_floors",toluaI_spells_lua_strip_true_arts_from_floors00);
+ tolua_function(tolua_S,NULL,"lua_check_player_for_true_arts",toluaI_spells_lua_check_player_for_true_arts00);
+ tolua_function(tolua_S,NULL,"lua_get_mon_lev",toluaI_spells_lua_get_mon_lev00);
+ tolua_function(tolua_S,NULL,"lua_get_mon_name",toluaI_spells_lua_get_mon_name00);
+ tolua_function(tolua_S,NULL,"lua_towns_treset",toluaI_spells_lua_towns_treset00);
+ tolua_function(tolua_S,NULL,"lua_player_exp",toluaI_spells_lua_player_exp00);
+ tolua_function(tolua_S,NULL,"lua_fix_spellbooks",toluaI_spells_lua_fix_spellbooks00);
+ tolua_function(tolua_S,NULL,"lua_fix_spellbooks_hackfix",toluaI_spells_lua_fix_spellbooks_hackfix00);
+ tolua_function(tolua_S,NULL,"lua_fix_spellbooks2",toluaI_spells_lua_fix_spellbooks200);
+ tolua_function(tolua_S,NULL,"lua_arts_fix",toluaI_spells_lua_arts_fix00);
+ tolua_function(tolua_S,NULL,"lua_get_last_chat_line",toluaI_spells_lua_get_last_chat_line00);
+ tolua_function(tolua_S,NULL,"lua_get_last_chat_owner",toluaI_spells_lua_get_last_chat_owner00);
+ tolua_function(tolua_S,NULL,"lua_get_last_chat_account",toluaI_spells_lua_get_last_chat_account00);
+ tolua_function(tolua_S,NULL,"lua_get_pgestat",toluaI_spells_lua_get_pgestat00);
+ tolua_function(tolua_S,NULL,"lua_start_global_event",toluaI_spells_lua_start_global_event00);
+ tolua_function(tolua_S,NULL,"lua_apply_item_changes",toluaI_spells_lua_apply_item_changes00);
+ tolua_function(tolua_S,NULL,"lua_set_floor_flags",toluaI_spells_lua_set_floor_flags00);
+ tolua_function(tolua_S,NULL,"lua_get_skill_mod",toluaI_spells_lua_get_skill_mod00);
+ tolua_function(tolua_S,NULL,"lua_get_skill_value",toluaI_spells_lua_get_skill_value00);
+ tolua_function(tolua_S,NULL,"lua_fix_equip_slots",toluaI_spells_lua_fix_equip_slots00);
+ tolua_function(tolua_S,NULL,"lua_fix_skill_chart",toluaI_spells_lua_fix_skill_chart00);
+ tolua_function(tolua_S,NULL,"lua_takeoff_costumes",toluaI_spells_lua_takeoff_costumes00);
+ tolua_function(tolua_S,NULL,"lua_is_unique",toluaI_spells_lua_is_unique00);
+ tolua_function(tolua_S,NULL,"lua_mimic_eligible",toluaI_spells_lua_mimic_eligible00);
+ tolua_function(tolua_S,NULL,"lua_mimic_humanoid",toluaI_spells_lua_mimic_humanoid00);
+ tolua_function(tolua_S,NULL,"lua_forget_flavours",toluaI_spells_lua_forget_flavours00);
+ tolua_function(tolua_S,NULL,"lua_forget_map",toluaI_spells_lua_forget_map00);
+ tolua_function(tolua_S,NULL,"lua_forget_parties",toluaI_spells_lua_forget_parties00);
+ tolua_function(tolua_S,NULL,"lua_forget_guilds",toluaI_spells_lua_forget_guilds00);
+ tolua_function(tolua_S,NULL,"hack_skill",toluaI_spells_hack_skill00);
+ tolua_function(tolua_S,NULL,"wild_flags",toluaI_spells_wild_flags00);
+ tolua_globalvar(tolua_S,"__lua_HHEALING",toluaI_get_spells___lua_HHEALING,toluaI_set_spells___lua_HHEALING);
+ tolua_globalvar(tolua_S,"__lua_HBLESSING",toluaI_get_spells___lua_HBLESSING,toluaI_set_spells___lua_HBLESSING);
+ tolua_globalvar(tolua_S,"__lua_HDELFEAR",toluaI_get_spells___lua_HDELFEAR,toluaI_set_spells___lua_HDELFEAR);
+ tolua_globalvar(tolua_S,"__lua_BLINK",toluaI_get_spells___lua_BLINK,toluaI_set_spells___lua_BLINK);
+ tolua_globalvar(tolua_S,"__lua_MSCARE",toluaI_get_spells___lua_MSCARE,toluaI_set_spells___lua_MSCARE);
+ tolua_globalvar(tolua_S,"__lua_M_FIRST",toluaI_get_spells___lua_M_FIRST,toluaI_set_spells___lua_M_FIRST);
+ tolua_globalvar(tolua_S,"__lua_M_LAST",toluaI_get_spells___lua_M_LAST,toluaI_set_spells___lua_M_LAST);
+ tolua_globalvar(tolua_S,"__lua_P_FIRST",toluaI_get_spells___lua_P_FIRST,toluaI_set_spells___lua_P_FIRST);
+ tolua_globalvar(tolua_S,"__lua_P_LAST",toluaI_get_spells___lua_P_LAST,toluaI_set_spells___lua_P_LAST);
+ tolua_globalvar(tolua_S,"__lua_OFEAR",toluaI_get_spells___lua_OFEAR,toluaI_set_spells___lua_OFEAR);
+ tolua_globalvar(tolua_S,"__lua_FOCUS",toluaI_get_spells___lua_FOCUS,toluaI_set_spells___lua_FOCUS);
+ tolua_globalvar(tolua_S,"__lua_POWERBOLT",toluaI_get_spells___lua_POWERBOLT,toluaI_set_spells___lua_POWERBOLT);
+ tolua_globalvar(tolua_S,"__lua_HEALING_I",toluaI_get_spells___lua_HEALING_I,toluaI_set_spells___lua_HEALING_I);
+ tolua_globalvar(tolua_S,"sauron_weakened",toluaI_get_spells_sauron_weakened,toluaI_set_spells_sauron_weakened);
+ tolua_globalvar(tolua_S,"sauron_weakened_iddc",toluaI_get_spells_sauron_weakened_iddc,toluaI_set_spells_sauron_weakened_iddc);
+ tolua_function(tolua_S,NULL,"shriek",toluaI_spells_shriek00);
+ return 1;
+}
+/* Close function */
+void tolua_spells_close (lua_State* tolua_S)
+{
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PR_MANA");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PR_STATE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"EFF_WAVE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"EFF_STORM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"EFF_THINWAVE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"EFF_VORTEX");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_ELEC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_COLD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_FIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_ACID");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_POIS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_BASE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_CHAO");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_VORP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_BALL_FIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_BALL_COLD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_BALL_ELEC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_BALL_ACID");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_BALL_SOUN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_HELLFIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_VAMPIRIC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_ICE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_PLASMA");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_F_EXTERN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_F_POTION_MUSHROOM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_F_MAINHAND");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_F_OFFHAND");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TBRAND_F_DUAL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SHIELD_NONE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SHIELD_COUNTER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"SHIELD_FIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_ELEC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_POIS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_ACID");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_COLD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_FIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SHOT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_ARROW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_BOLT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_BOULDER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_MISSILE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_ACID_BLIND");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_PLASMA");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_HOLY_ORB");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_WATER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_LITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DARK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_LITE_WEAK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DARK_WEAK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_PROTEVIL_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SHARDS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SOUND");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_CONFUSION");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_FORCE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_INERTIA");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_MANA");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_METEOR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_ICE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_CHAOS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_NETHER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DISENCHANT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_NEXUS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_TIME");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_GRAVITY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_KILL_WALL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_KILL_DOOR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_KILL_TRAP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_KILL_TRAP_DOOR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_MAKE_WALL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_MAKE_DOOR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_MAKE_TRAP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_OLD_CLONE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_OLD_POLY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_OLD_HEAL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_OLD_SPEED");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_OLD_SLOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_OLD_CONF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_OLD_SLEEP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_OLD_DRAIN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_AWAY_UNDEAD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_AWAY_EVIL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_AWAY_ALL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_TURN_UNDEAD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_TURN_EVIL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_TURN_ALL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DISP_UNDEAD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DISP_EVIL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DISP_ALL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_HEAL_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_STONE_WALL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_EARTHQUAKE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_WRAITH_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SPEED_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SHIELD_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RECALL_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_STUN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_IDENTIFY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_PSI");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_HOLY_FIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DISINTEGRATE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_HELLFIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_NETHER_WEAK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_REMCURSE_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_KILL_GLYPH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_STARLITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_TERROR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_HAVOC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_INFERNO");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DETONATION");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_ROCKET");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_REMFEAR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_HERO_MONSTER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_LIFEHEAL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DEC_STR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DEC_DEX");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DEC_CON");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RES_STR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RES_DEX");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RES_CON");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_INC_STR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_INC_DEX");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_INC_CON");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_AUGMENTATION");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RUINATION");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_EXP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_MIND_SLOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_TBRAND_POIS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_CODE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_NUKE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_BLIND");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_HOLD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DOMINATE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_BLESS_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_REMFEAR_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SATHUNGER_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RESFIRE_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RESCOLD_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_CUREPOISON_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SEEINVIS_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SEEMAP_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_CURECUT_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_CURESTUN_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DETECTCREATURE_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DETECTDOOR_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DETECTTRAP_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_TELEPORTLVL_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RESPOIS_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RESELEC_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RESACID_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_HPINCREASE_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_HERO_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SHERO_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_UNBREATH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_WAVE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_TELEPORT_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RESTORE_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_VAPOUR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_CURE_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RESURRECT_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SANITY_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_ZEAL_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DISP_DEMON");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SOULCURE_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_MINDBOOST_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_REMCONF_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_REMIMAGE_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SLOWPOISON_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_CURING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_TELE_TO");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_HAND_DOOM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_STASIS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_CURSE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_HEALINGCLOUD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_WATERPOISON");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_ICEPOISON");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_EXTRA_STATS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_EXTRA_TOHIT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_PUSH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SILENCE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_CHARMIGNORE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_STOP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_CAUSE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_FLARE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_LIFE_SLOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_NO_REGEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_THUNDER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_ANNIHILATION");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_VINE_SLOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DISP_UNDEAD_DEMON");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RIFT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RESTORING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_UNHEALTH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DISEASE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DEC_INT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DEC_WIS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_DEC_CHR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RES_INT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RES_WIS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RES_CHR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_INC_INT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_INC_WIS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_INC_CHR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SNOWFLAKE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_FW_FIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_FW_ELEC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_FW_POIS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_FW_LITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_FW_YCLD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_FW_SHDM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_FW_MULT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_RAINDROP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_LEAF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_SHOW_LIGHTNING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"GF_THUNDER_VISUAL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"warding_glyph");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"cave_set_feat");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"cave_set_feat_live");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"custom_cave_set_feat");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"custom_cave_set_feat_live");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"check_feat");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"dun_get_wid");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"dun_get_hgt");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"check_monster");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"check_monster_ego");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"check_item_tval");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"check_item_sval");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"custom_place_item_module");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"place_item_module");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"place_monster_ego");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"custom_place_monster_ego");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"players_on_depth");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"level_up_x");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"level_up_y");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"level_down_x");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"level_down_y");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"level_rand_x");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"level_rand_y");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"new_level_up_x");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"new_level_up_y");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"new_level_down_x");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"new_level_down_y");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"new_level_rand_x");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"new_level_rand_y");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"make_wpos");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"summon_override");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"generate_cave_blank");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_cmd_fusion");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"place_up_stairs");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"spell_color");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"take_hit");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"take_xp_hit");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"take_sanity_hit");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"poly_r_idx");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"check_st_anchor");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"swap_position");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"teleport_away");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"teleport_player");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"teleport_player_to");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"teleport_player_level");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"retreat_player");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"bypass_invuln"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"acid_dam");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"elec_dam");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_dam");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"cold_dam");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"inc_stat");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"dec_stat");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"res_stat");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"apply_disenchant");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"apply_discharge");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"apply_discharge_item");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"project_hook");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"project");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_all_destroy");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_cold_destroy");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_impact_destroy");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_water_destroy");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"equip_damage");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"inven_damage");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"weapon_takes_damage");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_oppose_acid");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_oppose_elec");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_oppose_fire");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_oppose_cold");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_oppose_pois");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_stun");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_cut");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_food");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_invuln_short");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_biofeedback");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_adrenaline");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_esp");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_st_anchor");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_prob_travel");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_mimic");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_traps");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_manashield");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_invis");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_shroud");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_fury");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_meditation");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_wraith");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_wraithstep");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_blind");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_confused");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_poisoned");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_diseased");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_afraid");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_paralyzed");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_stopped");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_image");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_fast");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_slow");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_reflect");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"wizard_lock");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_shield");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_thunder");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_regen");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_mp2hp");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_ffall");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_lev");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_blessed");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_dispersion");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_res_fear");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_hero");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_shero");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_protevil");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_zeal");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_martyr");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_invuln");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_invis");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_infra");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_mindboost");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_kinetic_shield");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_savingthrow");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_spirit_shield");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"identify_fully");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"self_knowledge");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"ident_spell");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"map_area");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"mind_map_level");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"wiz_lite");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"wiz_lite_extra");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"wiz_lite_spell");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"wiz_dark");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detect_creatures_xxx");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detect_creatures");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"place_foe");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"heal_insanity");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"summon_cyber");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"golem_creation");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"hp_player");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"warding_glyph");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_dec_stat");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_res_stat");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_inc_stat");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"identify_pack");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"message_pain");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"remove_curse");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"remove_all_curse");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"restore_level");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"self_knowledge");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lose_all_info");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detect_treasure");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detect_magic");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detect_invisible");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detect_evil");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detect_living");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detect_noise");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detection");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detect_object");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detect_trap");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"detect_sdoor");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"stair_creation");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"enchant");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"enchant_spell");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"enchant_spell_aux");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"ident_spell");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"ident_spell_aux");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"identify_fully");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"identify_fully_item");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"recharge");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"recharge_aux");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"speed_monsters");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"slow_monsters");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"sleep_monsters");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fear_monsters");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"stun_monsters");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"aggravate_monsters");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"wake_minions");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"genocide_aux");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"genocide");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"obliteration");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"probing");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"project_los_wall");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"project_los");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"away_evil");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"dispel_evil");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"dispel_undead");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"dispel_demons");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"dispel_monsters");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"turn_undead");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"destroy_area");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"earthquake");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"open_rift");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"wipe_spell");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"target_okay");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lite_room");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"unlite_room");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lite_area");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"unlite_area");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_ball");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_burst");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_swarm");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_cone");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_shot");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_wall");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_wall_wide");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_nova");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_cloud");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_wave");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_bolt");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_beam");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_bolt_or_beam");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_grid_bolt");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fire_grid_beam");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lite_line");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"drain_life");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"wall_to_mud");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"destroy_trap_door");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"disarm_trap_door");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"heal_monster");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"speed_monster");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"slow_monster");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"sleep_monster");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"confuse_monster");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fear_monster");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"poly_monster");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"clone_monster");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"teleport_monster");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"cure_light_wounds_proj");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"cure_serious_wounds_proj");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"cure_critical_wounds_proj");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"grow_trees");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"heal_other_proj");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"door_creation");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"trap_creation");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"destroy_doors_touch");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"destroy_traps_touch");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"destroy_traps_doors_touch");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"sleep_monsters_touch");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"create_artifact");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"create_artifact_aux");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"curse_spell");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"curse_spell_aux");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"house_creation");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_vermin_control");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_autokinesis_to");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_mstopcharm");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"cast_raindrop");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"cast_snowflake");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"cast_fireworks");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"cast_falling_star");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"thunderstorm_visual");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"place_trap_specific");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"rune_enchant");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"warding_rune");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"warding_rune_break");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"py_warding_rune_break");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"create_garden");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_banish_animals");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_xtra_stats");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_focus");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_tim_lcage");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"divine_vengeance");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"divine_gateway");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_divine_xtra_res");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_divine_hp");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_divine_crit");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_recall_depth");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_recall_timer");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_recall");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"do_shadow_gate");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_melee_brand");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_ammo_brand");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"set_nimbus");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"spell_type");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"school_type");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"project_interval"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"project_time"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"project_time_effect"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"new_school");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"new_spell");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"spell");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"school");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_get_level");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_spell_chance");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_s_print");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_x_print");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_add_anote");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_del_anotes");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_broadcast_motd");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_count_houses");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_recalc_char");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_examine_item");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_determine_level_req");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_strip_true_arts_from_absent_players");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_strip_true_arts_from_present_player");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_strip_true_arts_from_floors");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_check_player_for_true_arts");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_get_mon_lev");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_get_mon_name");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_towns_treset");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_player_exp");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_fix_spellbooks");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_fix_spellbooks_hackfix");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_fix_spellbooks2");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_arts_fix");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_get_last_chat_line");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_get_last_chat_owner");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_get_last_chat_account");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_get_pgestat");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_start_global_event");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_apply_item_changes");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_set_floor_flags");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_get_skill_mod");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_get_skill_value");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_fix_equip_slots");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_fix_skill_chart");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_takeoff_costumes");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_is_unique");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_mimic_eligible");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_mimic_humanoid");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_forget_flavours");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_forget_map");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_forget_parties");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_forget_guilds");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"hack_skill");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"wild_flags");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_HHEALING"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_HBLESSING"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_HDELFEAR"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_BLINK"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_MSCARE"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_M_FIRST"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_M_LAST"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_P_FIRST"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_P_LAST"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_OFEAR"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_FOCUS"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_POWERBOLT"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__lua_HEALING_I"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"sauron_weakened"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"sauron_weakened_iddc"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"shriek");
+}
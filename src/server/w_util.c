@@ -0,0 +1,8164 @@
+/*
+** Lua binding: util
+** Generated automatically by tolua 4.0a - angband on Mon Oct 19 05:16:51 2026.
+*/
+
+#include "lua/tolua.h"
+
+/* Exported function */
+int tolua_util_open (lua_State* tolua_S);
+void tolua_util_close (lua_State* tolua_S);
+
+#define SERVER
+#include "angband.h"
+extern u32b intMod(u32b a, u32b b);
+extern u32b intAnd(u32b a, u32b b);
+extern u32b intOr(u32b a, u32b b);
+extern u32b intXor(u32b a, u32b b);
+extern u32b intShiftl(u32b a, u32b b);
+extern u32b intShiftr(u32b a, u32b b);
+extern u32b intBitNot(u32b b);
+static int lua_level_speed(worldpos *wpos) { return level_speed(wpos); }
+
+/* function to register type */
+static void toluaI_reg_types (lua_State* tolua_S)
+{
+ tolua_usertype(tolua_S,"hooks_chain");
+ tolua_usertype(tolua_S,"object_type");
+ tolua_usertype(tolua_S,"worldpos");
+ tolua_usertype(tolua_S,"time_t");
+ tolua_usertype(tolua_S,"monster_type");
+ tolua_usertype(tolua_S,"artifact_type");
+ tolua_usertype(tolua_S,"guild_type");
+ tolua_usertype(tolua_S,"party_type");
+ tolua_usertype(tolua_S,"hash_entry");
+ tolua_usertype(tolua_S,"server_opts");
+ tolua_usertype(tolua_S,"monster_race");
+}
+
+/* error messages */
+#define TOLUA_ERR_SELF tolua_error(tolua_S,"invalid 'self'")
+#define TOLUA_ERR_ASSIGN tolua_error(tolua_S,"#vinvalid type in variable assignment.")
+
+/* get function: id of class  hash_entry */
+static int toluaI_get_util_hash_entry_id(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->id);
+ return 1;
+}
+
+/* set function: id of class  hash_entry */
+static int toluaI_set_util_hash_entry_id(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->id = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: account of class  hash_entry */
+static int toluaI_get_util_hash_entry_account(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->account);
+ return 1;
+}
+
+/* set function: account of class  hash_entry */
+static int toluaI_set_util_hash_entry_account(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->account = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: name of class  hash_entry */
+static int toluaI_get_util_hash_entry_name(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->name);
+ return 1;
+}
+
+/* set function: name of class  hash_entry */
+static int toluaI_set_util_hash_entry_name(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->name = ((cptr)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: level of class  hash_entry */
+static int toluaI_get_util_hash_entry_level(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->level);
+ return 1;
+}
+
+/* set function: level of class  hash_entry */
+static int toluaI_set_util_hash_entry_level(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->level = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: party of class  hash_entry */
+static int toluaI_get_util_hash_entry_party(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->party);
+ return 1;
+}
+
+/* set function: party of class  hash_entry */
+static int toluaI_set_util_hash_entry_party(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->party = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: guild of class  hash_entry */
+static int toluaI_get_util_hash_entry_guild(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->guild);
+ return 1;
+}
+
+/* set function: guild of class  hash_entry */
+static int toluaI_set_util_hash_entry_guild(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->guild = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: xorder of class  hash_entry */
+static int toluaI_get_util_hash_entry_xorder(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->xorder);
+ return 1;
+}
+
+/* set function: xorder of class  hash_entry */
+static int toluaI_set_util_hash_entry_xorder(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->xorder = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: laston of class  hash_entry */
+static int toluaI_get_util_hash_entry_laston(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->laston,tolua_tag(tolua_S,"time_t"));
+ return 1;
+}
+
+/* set function: laston of class  hash_entry */
+static int toluaI_set_util_hash_entry_laston(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"time_t"),0))
+ TOLUA_ERR_ASSIGN;
+  self->laston = *((time_t*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: next of class  hash_entry */
+static int toluaI_get_util_hash_entry_next(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)self->next,tolua_tag(tolua_S,"hash_entry"));
+ return 1;
+}
+
+/* set function: next of class  hash_entry */
+static int toluaI_set_util_hash_entry_next(lua_State* tolua_S)
+{
+  hash_entry* self = (hash_entry*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"hash_entry"),0))
+ TOLUA_ERR_ASSIGN;
+  self->next = ((struct hash_entry*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* function: lookup_player */
+static int toluaI_util_lookup_player00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int id = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  struct hash_entry* toluaI_ret = (struct hash_entry*)  lookup_player(id);
+ tolua_pushusertype(tolua_S,(void*)toluaI_ret,tolua_tag(tolua_S,"hash_entry"));
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lookup_player'.");
+ return 0;
+}
+
+/* function: lookup_player_id */
+static int toluaI_util_lookup_player_id00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  cptr name = ((cptr)  tolua_getstring(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  lookup_player_id(name);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lookup_player_id'.");
+ return 0;
+}
+
+/* function: lookup_player_id_messy */
+static int toluaI_util_lookup_player_id_messy00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  cptr name = ((cptr)  tolua_getstring(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  lookup_player_id_messy(name);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lookup_player_id_messy'.");
+ return 0;
+}
+
+/* get function: runlevel of class  server_opts */
+static int toluaI_get_util_server_opts_runlevel(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->runlevel);
+ return 1;
+}
+
+/* set function: runlevel of class  server_opts */
+static int toluaI_set_util_server_opts_runlevel(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->runlevel = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: runtime of class  server_opts */
+static int toluaI_get_util_server_opts_runtime(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->runtime,tolua_tag(tolua_S,"time_t"));
+ return 1;
+}
+
+/* set function: runtime of class  server_opts */
+static int toluaI_set_util_server_opts_runtime(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"time_t"),0))
+ TOLUA_ERR_ASSIGN;
+  self->runtime = *((time_t*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: closetime of class  server_opts */
+static int toluaI_get_util_server_opts_closetime(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->closetime,tolua_tag(tolua_S,"time_t"));
+ return 1;
+}
+
+/* set function: closetime of class  server_opts */
+static int toluaI_set_util_server_opts_closetime(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"time_t"),0))
+ TOLUA_ERR_ASSIGN;
+  self->closetime = *((time_t*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: meta_address of class  server_opts */
+static int toluaI_get_util_server_opts_meta_address(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->meta_address);
+ return 1;
+}
+
+/* set function: meta_address of class  server_opts */
+static int toluaI_set_util_server_opts_meta_address(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->meta_address = ((char*)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: meta_port of class  server_opts */
+static int toluaI_get_util_server_opts_meta_port(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->meta_port);
+ return 1;
+}
+
+/* set function: meta_port of class  server_opts */
+static int toluaI_set_util_server_opts_meta_port(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->meta_port = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: bind_name of class  server_opts */
+static int toluaI_get_util_server_opts_bind_name(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->bind_name);
+ return 1;
+}
+
+/* set function: bind_name of class  server_opts */
+static int toluaI_set_util_server_opts_bind_name(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->bind_name = ((char*)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: console_password of class  server_opts */
+static int toluaI_get_util_server_opts_console_password(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->console_password);
+ return 1;
+}
+
+/* set function: console_password of class  server_opts */
+static int toluaI_set_util_server_opts_console_password(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->console_password = ((char*)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: admin_wizard of class  server_opts */
+static int toluaI_get_util_server_opts_admin_wizard(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->admin_wizard);
+ return 1;
+}
+
+/* set function: admin_wizard of class  server_opts */
+static int toluaI_set_util_server_opts_admin_wizard(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->admin_wizard = ((char*)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dungeon_master of class  server_opts */
+static int toluaI_get_util_server_opts_dungeon_master(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->dungeon_master);
+ return 1;
+}
+
+/* set function: dungeon_master of class  server_opts */
+static int toluaI_set_util_server_opts_dungeon_master(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->dungeon_master = ((char*)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: wserver of class  server_opts */
+static int toluaI_get_util_server_opts_wserver(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->wserver);
+ return 1;
+}
+
+/* set function: wserver of class  server_opts */
+static int toluaI_set_util_server_opts_wserver(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->wserver = ((char*)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pass of class  server_opts */
+static int toluaI_get_util_server_opts_pass(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->pass);
+ return 1;
+}
+
+/* set function: pass of class  server_opts */
+static int toluaI_set_util_server_opts_pass(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->pass = ((char*)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: preserve_death_level of class  server_opts */
+static int toluaI_get_util_server_opts_preserve_death_level(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->preserve_death_level);
+ return 1;
+}
+
+/* set function: preserve_death_level of class  server_opts */
+static int toluaI_set_util_server_opts_preserve_death_level(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->preserve_death_level = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: unique_respawn_time of class  server_opts */
+static int toluaI_get_util_server_opts_unique_respawn_time(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->unique_respawn_time);
+ return 1;
+}
+
+/* set function: unique_respawn_time of class  server_opts */
+static int toluaI_set_util_server_opts_unique_respawn_time(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->unique_respawn_time = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: unique_max_respawn_time of class  server_opts */
+static int toluaI_get_util_server_opts_unique_max_respawn_time(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->unique_max_respawn_time);
+ return 1;
+}
+
+/* set function: unique_max_respawn_time of class  server_opts */
+static int toluaI_set_util_server_opts_unique_max_respawn_time(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->unique_max_respawn_time = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: level_unstatic_chance of class  server_opts */
+static int toluaI_get_util_server_opts_level_unstatic_chance(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->level_unstatic_chance);
+ return 1;
+}
+
+/* set function: level_unstatic_chance of class  server_opts */
+static int toluaI_set_util_server_opts_level_unstatic_chance(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->level_unstatic_chance = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: min_unstatic_level of class  server_opts */
+static int toluaI_get_util_server_opts_min_unstatic_level(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->min_unstatic_level);
+ return 1;
+}
+
+/* set function: min_unstatic_level of class  server_opts */
+static int toluaI_set_util_server_opts_min_unstatic_level(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->min_unstatic_level = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: retire_timer of class  server_opts */
+static int toluaI_get_util_server_opts_retire_timer(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->retire_timer);
+ return 1;
+}
+
+/* set function: retire_timer of class  server_opts */
+static int toluaI_set_util_server_opts_retire_timer(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->retire_timer = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: game_port of class  server_opts */
+static int toluaI_get_util_server_opts_game_port(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->game_port);
+ return 1;
+}
+
+/* set function: game_port of class  server_opts */
+static int toluaI_set_util_server_opts_game_port(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->game_port = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: console_port of class  server_opts */
+static int toluaI_get_util_server_opts_console_port(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->console_port);
+ return 1;
+}
+
+/* set function: console_port of class  server_opts */
+static int toluaI_set_util_server_opts_console_port(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->console_port = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: gw_port of class  server_opts */
+static int toluaI_get_util_server_opts_gw_port(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->gw_port);
+ return 1;
+}
+
+/* set function: gw_port of class  server_opts */
+static int toluaI_set_util_server_opts_gw_port(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->gw_port = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: spell_interfere of class  server_opts */
+static int toluaI_get_util_server_opts_spell_interfere(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->spell_interfere);
+ return 1;
+}
+
+/* set function: spell_interfere of class  server_opts */
+static int toluaI_set_util_server_opts_spell_interfere(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->spell_interfere = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: spell_stack_limit of class  server_opts */
+static int toluaI_get_util_server_opts_spell_stack_limit(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->spell_stack_limit);
+ return 1;
+}
+
+/* set function: spell_stack_limit of class  server_opts */
+static int toluaI_set_util_server_opts_spell_stack_limit(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->spell_stack_limit = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: fps of class  server_opts */
+static int toluaI_get_util_server_opts_fps(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->fps);
+ return 1;
+}
+
+/* set function: fps of class  server_opts */
+static int toluaI_set_util_server_opts_fps(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->fps = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: players_never_expire of class  server_opts */
+static int toluaI_get_util_server_opts_players_never_expire(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->players_never_expire);
+ return 1;
+}
+
+/* set function: players_never_expire of class  server_opts */
+static int toluaI_set_util_server_opts_players_never_expire(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->players_never_expire = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: admins_never_expire of class  server_opts */
+static int toluaI_get_util_server_opts_admins_never_expire(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->admins_never_expire);
+ return 1;
+}
+
+/* set function: admins_never_expire of class  server_opts */
+static int toluaI_set_util_server_opts_admins_never_expire(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->admins_never_expire = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: newbies_cannot_drop of class  server_opts */
+static int toluaI_get_util_server_opts_newbies_cannot_drop(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->newbies_cannot_drop);
+ return 1;
+}
+
+/* set function: newbies_cannot_drop of class  server_opts */
+static int toluaI_set_util_server_opts_newbies_cannot_drop(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->newbies_cannot_drop = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: running_speed of class  server_opts */
+static int toluaI_get_util_server_opts_running_speed(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->running_speed);
+ return 1;
+}
+
+/* set function: running_speed of class  server_opts */
+static int toluaI_set_util_server_opts_running_speed(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->running_speed = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: anti_scum of class  server_opts */
+static int toluaI_get_util_server_opts_anti_scum(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->anti_scum);
+ return 1;
+}
+
+/* set function: anti_scum of class  server_opts */
+static int toluaI_set_util_server_opts_anti_scum(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->anti_scum = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dun_unusual of class  server_opts */
+static int toluaI_get_util_server_opts_dun_unusual(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dun_unusual);
+ return 1;
+}
+
+/* set function: dun_unusual of class  server_opts */
+static int toluaI_set_util_server_opts_dun_unusual(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dun_unusual = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: town_x of class  server_opts */
+static int toluaI_get_util_server_opts_town_x(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->town_x);
+ return 1;
+}
+
+/* set function: town_x of class  server_opts */
+static int toluaI_set_util_server_opts_town_x(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->town_x = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: town_y of class  server_opts */
+static int toluaI_get_util_server_opts_town_y(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->town_y);
+ return 1;
+}
+
+/* set function: town_y of class  server_opts */
+static int toluaI_set_util_server_opts_town_y(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->town_y = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: town_base of class  server_opts */
+static int toluaI_get_util_server_opts_town_base(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->town_base);
+ return 1;
+}
+
+/* set function: town_base of class  server_opts */
+static int toluaI_set_util_server_opts_town_base(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->town_base = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: store_turns of class  server_opts */
+static int toluaI_get_util_server_opts_store_turns(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->store_turns);
+ return 1;
+}
+
+/* set function: store_turns of class  server_opts */
+static int toluaI_set_util_server_opts_store_turns(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->store_turns = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dun_store_turns of class  server_opts */
+static int toluaI_get_util_server_opts_dun_store_turns(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dun_store_turns);
+ return 1;
+}
+
+/* set function: dun_store_turns of class  server_opts */
+static int toluaI_set_util_server_opts_dun_store_turns(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dun_store_turns = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: book_store_turns_perc of class  server_opts */
+static int toluaI_get_util_server_opts_book_store_turns_perc(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->book_store_turns_perc);
+ return 1;
+}
+
+/* set function: book_store_turns_perc of class  server_opts */
+static int toluaI_set_util_server_opts_book_store_turns_perc(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->book_store_turns_perc = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: resting_rate of class  server_opts */
+static int toluaI_get_util_server_opts_resting_rate(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->resting_rate);
+ return 1;
+}
+
+/* set function: resting_rate of class  server_opts */
+static int toluaI_set_util_server_opts_resting_rate(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->resting_rate = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: party_xp_boost of class  server_opts */
+static int toluaI_get_util_server_opts_party_xp_boost(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->party_xp_boost);
+ return 1;
+}
+
+/* set function: party_xp_boost of class  server_opts */
+static int toluaI_set_util_server_opts_party_xp_boost(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->party_xp_boost = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: use_pk_rules of class  server_opts */
+static int toluaI_get_util_server_opts_use_pk_rules(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->use_pk_rules);
+ return 1;
+}
+
+/* set function: use_pk_rules of class  server_opts */
+static int toluaI_set_util_server_opts_use_pk_rules(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->use_pk_rules = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: quit_ban_mode of class  server_opts */
+static int toluaI_get_util_server_opts_quit_ban_mode(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->quit_ban_mode);
+ return 1;
+}
+
+/* set function: quit_ban_mode of class  server_opts */
+static int toluaI_set_util_server_opts_quit_ban_mode(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->quit_ban_mode = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: zang_monsters of class  server_opts */
+static int toluaI_get_util_server_opts_zang_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->zang_monsters);
+ return 1;
+}
+
+/* set function: zang_monsters of class  server_opts */
+static int toluaI_set_util_server_opts_zang_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->zang_monsters = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pern_monsters of class  server_opts */
+static int toluaI_get_util_server_opts_pern_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pern_monsters);
+ return 1;
+}
+
+/* set function: pern_monsters of class  server_opts */
+static int toluaI_set_util_server_opts_pern_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pern_monsters = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cth_monsters of class  server_opts */
+static int toluaI_get_util_server_opts_cth_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cth_monsters);
+ return 1;
+}
+
+/* set function: cth_monsters of class  server_opts */
+static int toluaI_set_util_server_opts_cth_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cth_monsters = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: joke_monsters of class  server_opts */
+static int toluaI_get_util_server_opts_joke_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->joke_monsters);
+ return 1;
+}
+
+/* set function: joke_monsters of class  server_opts */
+static int toluaI_set_util_server_opts_joke_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->joke_monsters = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cblue_monsters of class  server_opts */
+static int toluaI_get_util_server_opts_cblue_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cblue_monsters);
+ return 1;
+}
+
+/* set function: cblue_monsters of class  server_opts */
+static int toluaI_set_util_server_opts_cblue_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cblue_monsters = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: vanilla_monsters of class  server_opts */
+static int toluaI_get_util_server_opts_vanilla_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->vanilla_monsters);
+ return 1;
+}
+
+/* set function: vanilla_monsters of class  server_opts */
+static int toluaI_set_util_server_opts_vanilla_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->vanilla_monsters = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pet_monsters of class  server_opts */
+static int toluaI_get_util_server_opts_pet_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pet_monsters);
+ return 1;
+}
+
+/* set function: pet_monsters of class  server_opts */
+static int toluaI_set_util_server_opts_pet_monsters(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pet_monsters = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: report_to_meta of class  server_opts */
+static int toluaI_get_util_server_opts_report_to_meta(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->report_to_meta);
+ return 1;
+}
+
+/* set function: report_to_meta of class  server_opts */
+static int toluaI_set_util_server_opts_report_to_meta(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->report_to_meta = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: secret_dungeon_master of class  server_opts */
+static int toluaI_get_util_server_opts_secret_dungeon_master(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->secret_dungeon_master);
+ return 1;
+}
+
+/* set function: secret_dungeon_master of class  server_opts */
+static int toluaI_set_util_server_opts_secret_dungeon_master(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->secret_dungeon_master = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: anti_arts_hoard of class  server_opts */
+static int toluaI_get_util_server_opts_anti_arts_hoard(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->anti_arts_hoard);
+ return 1;
+}
+
+/* set function: anti_arts_hoard of class  server_opts */
+static int toluaI_set_util_server_opts_anti_arts_hoard(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->anti_arts_hoard = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: anti_arts_house of class  server_opts */
+static int toluaI_get_util_server_opts_anti_arts_house(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->anti_arts_house);
+ return 1;
+}
+
+/* set function: anti_arts_house of class  server_opts */
+static int toluaI_set_util_server_opts_anti_arts_house(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->anti_arts_house = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: anti_arts_wild of class  server_opts */
+static int toluaI_get_util_server_opts_anti_arts_wild(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->anti_arts_wild);
+ return 1;
+}
+
+/* set function: anti_arts_wild of class  server_opts */
+static int toluaI_set_util_server_opts_anti_arts_wild(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->anti_arts_wild = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: anti_arts_shop of class  server_opts */
+static int toluaI_get_util_server_opts_anti_arts_shop(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->anti_arts_shop);
+ return 1;
+}
+
+/* set function: anti_arts_shop of class  server_opts */
+static int toluaI_set_util_server_opts_anti_arts_shop(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->anti_arts_shop = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: anti_arts_pickup of class  server_opts */
+static int toluaI_get_util_server_opts_anti_arts_pickup(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->anti_arts_pickup);
+ return 1;
+}
+
+/* set function: anti_arts_pickup of class  server_opts */
+static int toluaI_set_util_server_opts_anti_arts_pickup(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->anti_arts_pickup = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: anti_arts_send of class  server_opts */
+static int toluaI_get_util_server_opts_anti_arts_send(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->anti_arts_send);
+ return 1;
+}
+
+/* set function: anti_arts_send of class  server_opts */
+static int toluaI_set_util_server_opts_anti_arts_send(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->anti_arts_send = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: persistent_artifacts of class  server_opts */
+static int toluaI_get_util_server_opts_persistent_artifacts(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->persistent_artifacts);
+ return 1;
+}
+
+/* set function: persistent_artifacts of class  server_opts */
+static int toluaI_set_util_server_opts_persistent_artifacts(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->persistent_artifacts = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: anti_cheeze_pickup of class  server_opts */
+static int toluaI_get_util_server_opts_anti_cheeze_pickup(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->anti_cheeze_pickup);
+ return 1;
+}
+
+/* set function: anti_cheeze_pickup of class  server_opts */
+static int toluaI_set_util_server_opts_anti_cheeze_pickup(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->anti_cheeze_pickup = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: anti_cheeze_telekinesis of class  server_opts */
+static int toluaI_get_util_server_opts_anti_cheeze_telekinesis(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->anti_cheeze_telekinesis);
+ return 1;
+}
+
+/* set function: anti_cheeze_telekinesis of class  server_opts */
+static int toluaI_set_util_server_opts_anti_cheeze_telekinesis(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->anti_cheeze_telekinesis = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: surface_item_removal of class  server_opts */
+static int toluaI_get_util_server_opts_surface_item_removal(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->surface_item_removal);
+ return 1;
+}
+
+/* set function: surface_item_removal of class  server_opts */
+static int toluaI_set_util_server_opts_surface_item_removal(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->surface_item_removal = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dungeon_item_removal of class  server_opts */
+static int toluaI_get_util_server_opts_dungeon_item_removal(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dungeon_item_removal);
+ return 1;
+}
+
+/* set function: dungeon_item_removal of class  server_opts */
+static int toluaI_set_util_server_opts_dungeon_item_removal(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dungeon_item_removal = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: death_wild_item_removal of class  server_opts */
+static int toluaI_get_util_server_opts_death_wild_item_removal(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->death_wild_item_removal);
+ return 1;
+}
+
+/* set function: death_wild_item_removal of class  server_opts */
+static int toluaI_set_util_server_opts_death_wild_item_removal(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->death_wild_item_removal = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: long_wild_item_removal of class  server_opts */
+static int toluaI_get_util_server_opts_long_wild_item_removal(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->long_wild_item_removal);
+ return 1;
+}
+
+/* set function: long_wild_item_removal of class  server_opts */
+static int toluaI_set_util_server_opts_long_wild_item_removal(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->long_wild_item_removal = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dungeon_shop_chance of class  server_opts */
+static int toluaI_get_util_server_opts_dungeon_shop_chance(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dungeon_shop_chance);
+ return 1;
+}
+
+/* set function: dungeon_shop_chance of class  server_opts */
+static int toluaI_set_util_server_opts_dungeon_shop_chance(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dungeon_shop_chance = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dungeon_shop_type of class  server_opts */
+static int toluaI_get_util_server_opts_dungeon_shop_type(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dungeon_shop_type);
+ return 1;
+}
+
+/* set function: dungeon_shop_type of class  server_opts */
+static int toluaI_set_util_server_opts_dungeon_shop_type(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dungeon_shop_type = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dungeon_shop_timeout of class  server_opts */
+static int toluaI_get_util_server_opts_dungeon_shop_timeout(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dungeon_shop_timeout);
+ return 1;
+}
+
+/* set function: dungeon_shop_timeout of class  server_opts */
+static int toluaI_set_util_server_opts_dungeon_shop_timeout(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dungeon_shop_timeout = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mage_hp_bonus of class  server_opts */
+static int toluaI_get_util_server_opts_mage_hp_bonus(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mage_hp_bonus);
+ return 1;
+}
+
+/* set function: mage_hp_bonus of class  server_opts */
+static int toluaI_set_util_server_opts_mage_hp_bonus(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mage_hp_bonus = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: door_bump_open of class  server_opts */
+static int toluaI_get_util_server_opts_door_bump_open(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->door_bump_open);
+ return 1;
+}
+
+/* set function: door_bump_open of class  server_opts */
+static int toluaI_set_util_server_opts_door_bump_open(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->door_bump_open = ((char)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: no_ghost of class  server_opts */
+static int toluaI_get_util_server_opts_no_ghost(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->no_ghost);
+ return 1;
+}
+
+/* set function: no_ghost of class  server_opts */
+static int toluaI_set_util_server_opts_no_ghost(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->no_ghost = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: lifes of class  server_opts */
+static int toluaI_get_util_server_opts_lifes(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->lifes);
+ return 1;
+}
+
+/* set function: lifes of class  server_opts */
+static int toluaI_set_util_server_opts_lifes(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->lifes = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: houses_per_player of class  server_opts */
+static int toluaI_get_util_server_opts_houses_per_player(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->houses_per_player);
+ return 1;
+}
+
+/* set function: houses_per_player of class  server_opts */
+static int toluaI_set_util_server_opts_houses_per_player(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->houses_per_player = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: castles_per_player of class  server_opts */
+static int toluaI_get_util_server_opts_castles_per_player(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->castles_per_player);
+ return 1;
+}
+
+/* set function: castles_per_player of class  server_opts */
+static int toluaI_set_util_server_opts_castles_per_player(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->castles_per_player = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: castles_for_kings of class  server_opts */
+static int toluaI_get_util_server_opts_castles_for_kings(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->castles_for_kings);
+ return 1;
+}
+
+/* set function: castles_for_kings of class  server_opts */
+static int toluaI_set_util_server_opts_castles_for_kings(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->castles_for_kings = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: acc_house_limit of class  server_opts */
+static int toluaI_get_util_server_opts_acc_house_limit(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->acc_house_limit);
+ return 1;
+}
+
+/* set function: acc_house_limit of class  server_opts */
+static int toluaI_set_util_server_opts_acc_house_limit(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->acc_house_limit = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: maximize of class  server_opts */
+static int toluaI_get_util_server_opts_maximize(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->maximize);
+ return 1;
+}
+
+/* set function: maximize of class  server_opts */
+static int toluaI_set_util_server_opts_maximize(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->maximize = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: kings_etiquette of class  server_opts */
+static int toluaI_get_util_server_opts_kings_etiquette(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->kings_etiquette);
+ return 1;
+}
+
+/* set function: kings_etiquette of class  server_opts */
+static int toluaI_set_util_server_opts_kings_etiquette(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->kings_etiquette = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: fallenkings_etiquette of class  server_opts */
+static int toluaI_get_util_server_opts_fallenkings_etiquette(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->fallenkings_etiquette);
+ return 1;
+}
+
+/* set function: fallenkings_etiquette of class  server_opts */
+static int toluaI_set_util_server_opts_fallenkings_etiquette(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->fallenkings_etiquette = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: strict_etiquette of class  server_opts */
+static int toluaI_get_util_server_opts_strict_etiquette(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->strict_etiquette);
+ return 1;
+}
+
+/* set function: strict_etiquette of class  server_opts */
+static int toluaI_set_util_server_opts_strict_etiquette(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->strict_etiquette = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: public_rfe of class  server_opts */
+static int toluaI_get_util_server_opts_public_rfe(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->public_rfe);
+ return 1;
+}
+
+/* set function: public_rfe of class  server_opts */
+static int toluaI_set_util_server_opts_public_rfe(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->public_rfe = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: auto_purge of class  server_opts */
+static int toluaI_get_util_server_opts_auto_purge(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->auto_purge);
+ return 1;
+}
+
+/* set function: auto_purge of class  server_opts */
+static int toluaI_set_util_server_opts_auto_purge(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->auto_purge = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: log_u of class  server_opts */
+static int toluaI_get_util_server_opts_log_u(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->log_u);
+ return 1;
+}
+
+/* set function: log_u of class  server_opts */
+static int toluaI_set_util_server_opts_log_u(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->log_u = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: replace_hiscore of class  server_opts */
+static int toluaI_get_util_server_opts_replace_hiscore(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->replace_hiscore);
+ return 1;
+}
+
+/* set function: replace_hiscore of class  server_opts */
+static int toluaI_set_util_server_opts_replace_hiscore(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->replace_hiscore = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: unikill_format of class  server_opts */
+static int toluaI_get_util_server_opts_unikill_format(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->unikill_format);
+ return 1;
+}
+
+/* set function: unikill_format of class  server_opts */
+static int toluaI_set_util_server_opts_unikill_format(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->unikill_format = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: server_notes of class  server_opts */
+static int toluaI_get_util_server_opts_server_notes(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->server_notes);
+ return 1;
+}
+
+/* set function: server_notes of class  server_opts */
+static int toluaI_set_util_server_opts_server_notes(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  self->server_notes = ((char*)  tolua_getstring(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: arts_disabled of class  server_opts */
+static int toluaI_get_util_server_opts_arts_disabled(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->arts_disabled);
+ return 1;
+}
+
+/* set function: arts_disabled of class  server_opts */
+static int toluaI_set_util_server_opts_arts_disabled(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->arts_disabled = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: winners_find_randarts of class  server_opts */
+static int toluaI_get_util_server_opts_winners_find_randarts(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->winners_find_randarts);
+ return 1;
+}
+
+/* set function: winners_find_randarts of class  server_opts */
+static int toluaI_set_util_server_opts_winners_find_randarts(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->winners_find_randarts = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: arts_level_req of class  server_opts */
+static int toluaI_get_util_server_opts_arts_level_req(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->arts_level_req);
+ return 1;
+}
+
+/* set function: arts_level_req of class  server_opts */
+static int toluaI_set_util_server_opts_arts_level_req(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->arts_level_req = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: surface_summoning of class  server_opts */
+static int toluaI_get_util_server_opts_surface_summoning(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->surface_summoning);
+ return 1;
+}
+
+/* set function: surface_summoning of class  server_opts */
+static int toluaI_set_util_server_opts_surface_summoning(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->surface_summoning = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: clone_summoning of class  server_opts */
+static int toluaI_get_util_server_opts_clone_summoning(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->clone_summoning);
+ return 1;
+}
+
+/* set function: clone_summoning of class  server_opts */
+static int toluaI_set_util_server_opts_clone_summoning(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->clone_summoning = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: henc_strictness of class  server_opts */
+static int toluaI_get_util_server_opts_henc_strictness(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->henc_strictness);
+ return 1;
+}
+
+/* set function: henc_strictness of class  server_opts */
+static int toluaI_set_util_server_opts_henc_strictness(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->henc_strictness = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: bonus_calc_type of class  server_opts */
+static int toluaI_get_util_server_opts_bonus_calc_type(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->bonus_calc_type);
+ return 1;
+}
+
+/* set function: bonus_calc_type of class  server_opts */
+static int toluaI_set_util_server_opts_bonus_calc_type(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->bonus_calc_type = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: charmode_trading_restrictions of class  server_opts */
+static int toluaI_get_util_server_opts_charmode_trading_restrictions(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->charmode_trading_restrictions);
+ return 1;
+}
+
+/* set function: charmode_trading_restrictions of class  server_opts */
+static int toluaI_set_util_server_opts_charmode_trading_restrictions(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->charmode_trading_restrictions = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: item_awareness of class  server_opts */
+static int toluaI_get_util_server_opts_item_awareness(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->item_awareness);
+ return 1;
+}
+
+/* set function: item_awareness of class  server_opts */
+static int toluaI_set_util_server_opts_item_awareness(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->item_awareness = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: worldd_pubchat of class  server_opts */
+static int toluaI_get_util_server_opts_worldd_pubchat(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->worldd_pubchat);
+ return 1;
+}
+
+/* set function: worldd_pubchat of class  server_opts */
+static int toluaI_set_util_server_opts_worldd_pubchat(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->worldd_pubchat = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: worldd_privchat of class  server_opts */
+static int toluaI_get_util_server_opts_worldd_privchat(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->worldd_privchat);
+ return 1;
+}
+
+/* set function: worldd_privchat of class  server_opts */
+static int toluaI_set_util_server_opts_worldd_privchat(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->worldd_privchat = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: worldd_broadcast of class  server_opts */
+static int toluaI_get_util_server_opts_worldd_broadcast(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->worldd_broadcast);
+ return 1;
+}
+
+/* set function: worldd_broadcast of class  server_opts */
+static int toluaI_set_util_server_opts_worldd_broadcast(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->worldd_broadcast = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: worldd_lvlup of class  server_opts */
+static int toluaI_get_util_server_opts_worldd_lvlup(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->worldd_lvlup);
+ return 1;
+}
+
+/* set function: worldd_lvlup of class  server_opts */
+static int toluaI_set_util_server_opts_worldd_lvlup(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->worldd_lvlup = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: worldd_unideath of class  server_opts */
+static int toluaI_get_util_server_opts_worldd_unideath(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->worldd_unideath);
+ return 1;
+}
+
+/* set function: worldd_unideath of class  server_opts */
+static int toluaI_set_util_server_opts_worldd_unideath(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->worldd_unideath = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: worldd_pwin of class  server_opts */
+static int toluaI_get_util_server_opts_worldd_pwin(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->worldd_pwin);
+ return 1;
+}
+
+/* set function: worldd_pwin of class  server_opts */
+static int toluaI_set_util_server_opts_worldd_pwin(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->worldd_pwin = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: worldd_pdeath of class  server_opts */
+static int toluaI_get_util_server_opts_worldd_pdeath(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->worldd_pdeath);
+ return 1;
+}
+
+/* set function: worldd_pdeath of class  server_opts */
+static int toluaI_set_util_server_opts_worldd_pdeath(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->worldd_pdeath = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: worldd_pjoin of class  server_opts */
+static int toluaI_get_util_server_opts_worldd_pjoin(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->worldd_pjoin);
+ return 1;
+}
+
+/* set function: worldd_pjoin of class  server_opts */
+static int toluaI_set_util_server_opts_worldd_pjoin(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->worldd_pjoin = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: worldd_pleave of class  server_opts */
+static int toluaI_get_util_server_opts_worldd_pleave(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->worldd_pleave);
+ return 1;
+}
+
+/* set function: worldd_pleave of class  server_opts */
+static int toluaI_set_util_server_opts_worldd_pleave(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->worldd_pleave = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: worldd_plist of class  server_opts */
+static int toluaI_get_util_server_opts_worldd_plist(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->worldd_plist);
+ return 1;
+}
+
+/* set function: worldd_plist of class  server_opts */
+static int toluaI_set_util_server_opts_worldd_plist(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->worldd_plist = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: worldd_events of class  server_opts */
+static int toluaI_get_util_server_opts_worldd_events(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->worldd_events);
+ return 1;
+}
+
+/* set function: worldd_events of class  server_opts */
+static int toluaI_set_util_server_opts_worldd_events(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->worldd_events = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: leak_info of class  server_opts */
+static int toluaI_get_util_server_opts_leak_info(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->leak_info);
+ return 1;
+}
+
+/* set function: leak_info of class  server_opts */
+static int toluaI_set_util_server_opts_leak_info(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->leak_info = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cmdq_rate_limit of class  server_opts */
+static int toluaI_get_util_server_opts_cmdq_rate_limit(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cmdq_rate_limit);
+ return 1;
+}
+
+/* set function: cmdq_rate_limit of class  server_opts */
+static int toluaI_set_util_server_opts_cmdq_rate_limit(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cmdq_rate_limit = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cmdq_max_depth of class  server_opts */
+static int toluaI_get_util_server_opts_cmdq_max_depth(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cmdq_max_depth);
+ return 1;
+}
+
+/* set function: cmdq_max_depth of class  server_opts */
+static int toluaI_set_util_server_opts_cmdq_max_depth(lua_State* tolua_S)
+{
+  server_opts* self = (server_opts*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cmdq_max_depth = ((int)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: turn */
+static int toluaI_get_util_turn(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)turn);
+ return 1;
+}
+
+/* set function: turn */
+static int toluaI_set_util_turn(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  turn = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: session_turn */
+static int toluaI_get_util_session_turn(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)session_turn);
+ return 1;
+}
+
+/* set function: session_turn */
+static int toluaI_set_util_session_turn(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  session_turn = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: turn_overflow */
+static int toluaI_get_util_turn_overflow(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)turn_overflow);
+ return 1;
+}
+
+/* set function: turn_overflow */
+static int toluaI_set_util_turn_overflow(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  turn_overflow = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: cfg */
+static int toluaI_get_util_cfg(lua_State* tolua_S)
+{
+ tolua_pushusertype(tolua_S,(void*)&cfg,tolua_tag(tolua_S,"server_opts"));
+ return 1;
+}
+
+/* set function: cfg */
+static int toluaI_set_util_cfg(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,tolua_tag(tolua_S,"server_opts"),0))
+ TOLUA_ERR_ASSIGN;
+  cfg = *((server_opts*)  tolua_getusertype(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: player_exp */
+static int toluaI_get_util_player_exp(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=101)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)player_exp[toluaI_index]);
+ return 1;
+}
+
+/* set function: player_exp */
+static int toluaI_set_util_player_exp(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=101)
+ tolua_error(tolua_S,"array indexing out of range.");
+  player_exp[toluaI_index] = ((s32b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: seed_flavor */
+static int toluaI_get_util_seed_flavor(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)seed_flavor);
+ return 1;
+}
+
+/* get function: seed_town */
+static int toluaI_get_util_seed_town(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)seed_town);
+ return 1;
+}
+
+/* get function: seed_wild_extra */
+static int toluaI_get_util_seed_wild_extra(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)seed_wild_extra);
+ return 1;
+}
+
+/* function: intMod */
+static int toluaI_util_mod00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  u32b a = ((u32b)  tolua_getnumber(tolua_S,1,0));
+  u32b b = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ {
+  u32b toluaI_ret = (u32b)  intMod(a,b);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'mod'.");
+ return 0;
+}
+
+/* function: intAnd */
+static int toluaI_util_band00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  u32b a = ((u32b)  tolua_getnumber(tolua_S,1,0));
+  u32b b = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ {
+  u32b toluaI_ret = (u32b)  intAnd(a,b);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'band'.");
+ return 0;
+}
+
+/* function: intOr */
+static int toluaI_util_bor00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  u32b a = ((u32b)  tolua_getnumber(tolua_S,1,0));
+  u32b b = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ {
+  u32b toluaI_ret = (u32b)  intOr(a,b);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'bor'.");
+ return 0;
+}
+
+/* function: intXor */
+static int toluaI_util_bxor00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  u32b a = ((u32b)  tolua_getnumber(tolua_S,1,0));
+  u32b b = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ {
+  u32b toluaI_ret = (u32b)  intXor(a,b);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'bxor'.");
+ return 0;
+}
+
+/* function: intShiftl */
+static int toluaI_util_bshl00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  u32b a = ((u32b)  tolua_getnumber(tolua_S,1,0));
+  u32b b = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ {
+  u32b toluaI_ret = (u32b)  intShiftl(a,b);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'bshl'.");
+ return 0;
+}
+
+/* function: intShiftr */
+static int toluaI_util_bshr00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  u32b a = ((u32b)  tolua_getnumber(tolua_S,1,0));
+  u32b b = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ {
+  u32b toluaI_ret = (u32b)  intShiftr(a,b);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'bshr'.");
+ return 0;
+}
+
+/* function: intBitNot */
+static int toluaI_util_bnot00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  u32b b = ((u32b)  tolua_getnumber(tolua_S,1,0));
+ {
+  u32b toluaI_ret = (u32b)  intBitNot(b);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'bnot'.");
+ return 0;
+}
+
+/* function: pern_dofile */
+static int toluaI_util_pern_dofile00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  char* file = ((char*)  tolua_getstring(tolua_S,2,0));
+ {
+  bool toluaI_ret = (bool)  pern_dofile(Ind,file);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'pern_dofile'.");
+ return 0;
+}
+
+/* function: exec_lua */
+static int toluaI_util_exec_lua00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  char* file = ((char*)  tolua_getstring(tolua_S,2,0));
+ {
+  int toluaI_ret = (int)  exec_lua(Ind,file);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'exec_lua'.");
+ return 0;
+}
+
+/* function: cat_script */
+static int toluaI_util_cat_script00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  char* name = ((char*)  tolua_getstring(tolua_S,2,0));
+ {
+  cat_script(Ind,name);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'cat_script'.");
+ return 0;
+}
+
+/* function: msg_print */
+static int toluaI_util_msg_print00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  cptr msg = ((cptr)  tolua_getstring(tolua_S,2,0));
+ {
+  msg_print(Ind,msg);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'msg_print'.");
+ return 0;
+}
+
+/* function: msg_broadcast */
+static int toluaI_util_msg_broadcast00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  cptr msg = ((cptr)  tolua_getstring(tolua_S,2,0));
+ {
+  msg_broadcast(Ind,msg);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'msg_broadcast'.");
+ return 0;
+}
+
+/* function: msg_print_near */
+static int toluaI_util_msg_print_near00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  cptr msg = ((cptr)  tolua_getstring(tolua_S,2,0));
+ {
+  msg_print_near(Ind,msg);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'msg_print_near'.");
+ return 0;
+}
+
+/* function: msg_admins */
+static int toluaI_util_msg_admins00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  cptr msg = ((cptr)  tolua_getstring(tolua_S,2,0));
+ {
+  msg_admins(Ind,msg);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'msg_admins'.");
+ return 0;
+}
+
+/* function: lua_level_speed */
+static int toluaI_util_level_speed00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,tolua_tag(tolua_S,"worldpos"),0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  worldpos* wpos = ((worldpos*)  tolua_getusertype(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  lua_level_speed(wpos);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'level_speed'.");
+ return 0;
+}
+
+/* function: remote_update_lua */
+static int toluaI_util_remote_update_lua00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  cptr file = ((cptr)  tolua_getstring(tolua_S,2,0));
+ {
+  remote_update_lua(Ind,file);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'remote_update_lua'.");
+ return 0;
+}
+
+/* function: wipe_hooks */
+static int toluaI_util_wipe_hooks00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  wipe_hooks();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'wipe_hooks'.");
+ return 0;
+}
+
+/* function: dump_hooks */
+static int toluaI_util_dump_hooks00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  dump_hooks();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'dump_hooks'.");
+ return 0;
+}
+
+/* function: add_hook */
+static int toluaI_util_add_hook00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,3,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,4)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int h_idx = ((int)  tolua_getnumber(tolua_S,1,0));
+  cptr script = ((cptr)  tolua_getstring(tolua_S,2,0));
+  cptr name = ((cptr)  tolua_getstring(tolua_S,3,0));
+ {
+  hooks_chain* toluaI_ret = (hooks_chain*)  add_hook(h_idx,script,name);
+ tolua_pushusertype(tolua_S,(void*)toluaI_ret,tolua_tag(tolua_S,"hooks_chain"));
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'add_hook'.");
+ return 0;
+}
+
+/* get function: dungeon_store_timer */
+static int toluaI_get_util_dungeon_store_timer(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)dungeon_store_timer);
+ return 1;
+}
+
+/* set function: dungeon_store_timer */
+static int toluaI_set_util_dungeon_store_timer(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  dungeon_store_timer = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: dungeon_store2_timer */
+static int toluaI_get_util_dungeon_store2_timer(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)dungeon_store2_timer);
+ return 1;
+}
+
+/* set function: dungeon_store2_timer */
+static int toluaI_set_util_dungeon_store2_timer(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  dungeon_store2_timer = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: great_pumpkin_timer */
+static int toluaI_get_util_great_pumpkin_timer(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)great_pumpkin_timer);
+ return 1;
+}
+
+/* set function: great_pumpkin_timer */
+static int toluaI_set_util_great_pumpkin_timer(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  great_pumpkin_timer = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: great_pumpkin_killer1 */
+static int toluaI_get_util_great_pumpkin_killer1(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=NAME_LEN)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)great_pumpkin_killer1[toluaI_index]);
+ return 1;
+}
+
+/* set function: great_pumpkin_killer1 */
+static int toluaI_set_util_great_pumpkin_killer1(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=NAME_LEN)
+ tolua_error(tolua_S,"array indexing out of range.");
+  great_pumpkin_killer1[toluaI_index] = ((char)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: great_pumpkin_killer2 */
+static int toluaI_get_util_great_pumpkin_killer2(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=NAME_LEN)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)great_pumpkin_killer2[toluaI_index]);
+ return 1;
+}
+
+/* set function: great_pumpkin_killer2 */
+static int toluaI_set_util_great_pumpkin_killer2(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=NAME_LEN)
+ tolua_error(tolua_S,"array indexing out of range.");
+  great_pumpkin_killer2[toluaI_index] = ((char)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: great_pumpkin_duration */
+static int toluaI_get_util_great_pumpkin_duration(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)great_pumpkin_duration);
+ return 1;
+}
+
+/* set function: great_pumpkin_duration */
+static int toluaI_set_util_great_pumpkin_duration(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  great_pumpkin_duration = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: santa_claus_timer */
+static int toluaI_get_util_santa_claus_timer(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)santa_claus_timer);
+ return 1;
+}
+
+/* set function: santa_claus_timer */
+static int toluaI_set_util_santa_claus_timer(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  santa_claus_timer = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: night_surface */
+static int toluaI_get_util_night_surface(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)night_surface);
+ return 1;
+}
+
+/* set function: night_surface */
+static int toluaI_set_util_night_surface(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  night_surface = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_s_idx */
+static int toluaI_get_util_max_s_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_s_idx);
+ return 1;
+}
+
+/* set function: max_s_idx */
+static int toluaI_set_util_max_s_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_s_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_r_idx */
+static int toluaI_get_util_max_r_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_r_idx);
+ return 1;
+}
+
+/* set function: max_r_idx */
+static int toluaI_set_util_max_r_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_r_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_rur_idx */
+static int toluaI_get_util_max_rur_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_rur_idx);
+ return 1;
+}
+
+/* set function: max_rur_idx */
+static int toluaI_set_util_max_rur_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_rur_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_re_idx */
+static int toluaI_get_util_max_re_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_re_idx);
+ return 1;
+}
+
+/* set function: max_re_idx */
+static int toluaI_set_util_max_re_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_re_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_k_idx */
+static int toluaI_get_util_max_k_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_k_idx);
+ return 1;
+}
+
+/* set function: max_k_idx */
+static int toluaI_set_util_max_k_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_k_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_v_idx */
+static int toluaI_get_util_max_v_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_v_idx);
+ return 1;
+}
+
+/* set function: max_v_idx */
+static int toluaI_set_util_max_v_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_v_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_f_idx */
+static int toluaI_get_util_max_f_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_f_idx);
+ return 1;
+}
+
+/* set function: max_f_idx */
+static int toluaI_set_util_max_f_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_f_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_a_idx */
+static int toluaI_get_util_max_a_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_a_idx);
+ return 1;
+}
+
+/* set function: max_a_idx */
+static int toluaI_set_util_max_a_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_a_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_e_idx */
+static int toluaI_get_util_max_e_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_e_idx);
+ return 1;
+}
+
+/* set function: max_e_idx */
+static int toluaI_set_util_max_e_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_e_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_d_idx */
+static int toluaI_get_util_max_d_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_d_idx);
+ return 1;
+}
+
+/* set function: max_d_idx */
+static int toluaI_set_util_max_d_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_d_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_o_idx */
+static int toluaI_get_util_max_o_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_o_idx);
+ return 1;
+}
+
+/* set function: max_o_idx */
+static int toluaI_set_util_max_o_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_o_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_m_idx */
+static int toluaI_get_util_max_m_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_m_idx);
+ return 1;
+}
+
+/* set function: max_m_idx */
+static int toluaI_set_util_max_m_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_m_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_tr_idx */
+static int toluaI_get_util_max_tr_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_tr_idx);
+ return 1;
+}
+
+/* set function: max_tr_idx */
+static int toluaI_set_util_max_tr_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_tr_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_st_idx */
+static int toluaI_get_util_max_st_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_st_idx);
+ return 1;
+}
+
+/* set function: max_st_idx */
+static int toluaI_set_util_max_st_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_st_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_ow_idx */
+static int toluaI_get_util_max_ow_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_ow_idx);
+ return 1;
+}
+
+/* set function: max_ow_idx */
+static int toluaI_set_util_max_ow_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_ow_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_q_idx */
+static int toluaI_get_util_max_q_idx(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_q_idx);
+ return 1;
+}
+
+/* set function: max_q_idx */
+static int toluaI_set_util_max_q_idx(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_q_idx = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: global_luck */
+static int toluaI_get_util_global_luck(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)global_luck);
+ return 1;
+}
+
+/* set function: global_luck */
+static int toluaI_set_util_global_luck(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  global_luck = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* function: lua_intrusion */
+static int toluaI_util_lua_intrusion00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  char* problem_diz = ((char*)  tolua_getstring(tolua_S,2,0));
+ {
+  lua_intrusion(Ind,problem_diz);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_intrusion'.");
+ return 0;
+}
+
+/* get function: sST */
+static int toluaI_get_util_sST(lua_State* tolua_S)
+{
+ tolua_pushstring(tolua_S,(const char*)sST);
+ return 1;
+}
+
+/* set function: sST */
+static int toluaI_set_util_sST(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  sST = ((char*)  tolua_getstring(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: watch_morgoth */
+static int toluaI_get_util_watch_morgoth(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)watch_morgoth);
+ return 1;
+}
+
+/* set function: watch_morgoth */
+static int toluaI_set_util_watch_morgoth(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  watch_morgoth = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: watch_cp */
+static int toluaI_get_util_watch_cp(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)watch_cp);
+ return 1;
+}
+
+/* set function: watch_cp */
+static int toluaI_set_util_watch_cp(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  watch_cp = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: watch_nr */
+static int toluaI_get_util_watch_nr(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)watch_nr);
+ return 1;
+}
+
+/* set function: watch_nr */
+static int toluaI_set_util_watch_nr(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  watch_nr = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: watch_df */
+static int toluaI_get_util_watch_df(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)watch_df);
+ return 1;
+}
+
+/* set function: watch_df */
+static int toluaI_set_util_watch_df(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  watch_df = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: regen_boost_stamina */
+static int toluaI_get_util_regen_boost_stamina(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)regen_boost_stamina);
+ return 1;
+}
+
+/* set function: regen_boost_stamina */
+static int toluaI_set_util_regen_boost_stamina(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  regen_boost_stamina = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: updated_savegame_birth */
+static int toluaI_get_util_updated_savegame_birth(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)updated_savegame_birth);
+ return 1;
+}
+
+/* set function: updated_savegame_birth */
+static int toluaI_set_util_updated_savegame_birth(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  updated_savegame_birth = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: updated_server */
+static int toluaI_get_util_updated_server(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)updated_server);
+ return 1;
+}
+
+/* set function: updated_server */
+static int toluaI_set_util_updated_server(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  updated_server = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: runtime_server */
+static int toluaI_get_util_runtime_server(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)runtime_server);
+ return 1;
+}
+
+/* set function: runtime_server */
+static int toluaI_set_util_runtime_server(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  runtime_server = ((unsigned char)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: artifact_reset */
+static int toluaI_get_util_artifact_reset(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)artifact_reset);
+ return 1;
+}
+
+/* set function: artifact_reset */
+static int toluaI_set_util_artifact_reset(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  artifact_reset = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: name of class  artifact_type */
+static int toluaI_get_util_artifact_type_name(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->name);
+ return 1;
+}
+
+/* set function: name of class  artifact_type */
+static int toluaI_set_util_artifact_type_name(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->name = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: text of class  artifact_type */
+static int toluaI_get_util_artifact_type_text(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->text);
+ return 1;
+}
+
+/* set function: text of class  artifact_type */
+static int toluaI_set_util_artifact_type_text(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->text = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: tval of class  artifact_type */
+static int toluaI_get_util_artifact_type_tval(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->tval);
+ return 1;
+}
+
+/* set function: tval of class  artifact_type */
+static int toluaI_set_util_artifact_type_tval(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->tval = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: sval of class  artifact_type */
+static int toluaI_get_util_artifact_type_sval(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->sval);
+ return 1;
+}
+
+/* set function: sval of class  artifact_type */
+static int toluaI_set_util_artifact_type_sval(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->sval = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pval of class  artifact_type */
+static int toluaI_get_util_artifact_type_pval(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pval);
+ return 1;
+}
+
+/* set function: pval of class  artifact_type */
+static int toluaI_set_util_artifact_type_pval(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pval = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_h of class  artifact_type */
+static int toluaI_get_util_artifact_type_to_h(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_h);
+ return 1;
+}
+
+/* set function: to_h of class  artifact_type */
+static int toluaI_set_util_artifact_type_to_h(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_h = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_d of class  artifact_type */
+static int toluaI_get_util_artifact_type_to_d(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_d);
+ return 1;
+}
+
+/* set function: to_d of class  artifact_type */
+static int toluaI_set_util_artifact_type_to_d(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_d = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: to_a of class  artifact_type */
+static int toluaI_get_util_artifact_type_to_a(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->to_a);
+ return 1;
+}
+
+/* set function: to_a of class  artifact_type */
+static int toluaI_set_util_artifact_type_to_a(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->to_a = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ac of class  artifact_type */
+static int toluaI_get_util_artifact_type_ac(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ac);
+ return 1;
+}
+
+/* set function: ac of class  artifact_type */
+static int toluaI_set_util_artifact_type_ac(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ac = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: dd of class  artifact_type */
+static int toluaI_get_util_artifact_type_dd(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->dd);
+ return 1;
+}
+
+/* set function: dd of class  artifact_type */
+static int toluaI_set_util_artifact_type_dd(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->dd = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ds of class  artifact_type */
+static int toluaI_get_util_artifact_type_ds(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ds);
+ return 1;
+}
+
+/* set function: ds of class  artifact_type */
+static int toluaI_set_util_artifact_type_ds(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ds = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: weight of class  artifact_type */
+static int toluaI_get_util_artifact_type_weight(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->weight);
+ return 1;
+}
+
+/* set function: weight of class  artifact_type */
+static int toluaI_set_util_artifact_type_weight(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->weight = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cost of class  artifact_type */
+static int toluaI_get_util_artifact_type_cost(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cost);
+ return 1;
+}
+
+/* set function: cost of class  artifact_type */
+static int toluaI_set_util_artifact_type_cost(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cost = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: flags1 of class  artifact_type */
+static int toluaI_get_util_artifact_type_flags1(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->flags1);
+ return 1;
+}
+
+/* set function: flags1 of class  artifact_type */
+static int toluaI_set_util_artifact_type_flags1(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->flags1 = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: flags2 of class  artifact_type */
+static int toluaI_get_util_artifact_type_flags2(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->flags2);
+ return 1;
+}
+
+/* set function: flags2 of class  artifact_type */
+static int toluaI_set_util_artifact_type_flags2(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->flags2 = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: flags3 of class  artifact_type */
+static int toluaI_get_util_artifact_type_flags3(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->flags3);
+ return 1;
+}
+
+/* set function: flags3 of class  artifact_type */
+static int toluaI_set_util_artifact_type_flags3(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->flags3 = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: flags4 of class  artifact_type */
+static int toluaI_get_util_artifact_type_flags4(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->flags4);
+ return 1;
+}
+
+/* set function: flags4 of class  artifact_type */
+static int toluaI_set_util_artifact_type_flags4(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->flags4 = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: flags5 of class  artifact_type */
+static int toluaI_get_util_artifact_type_flags5(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->flags5);
+ return 1;
+}
+
+/* set function: flags5 of class  artifact_type */
+static int toluaI_set_util_artifact_type_flags5(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->flags5 = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: flags6 of class  artifact_type */
+static int toluaI_get_util_artifact_type_flags6(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->flags6);
+ return 1;
+}
+
+/* set function: flags6 of class  artifact_type */
+static int toluaI_set_util_artifact_type_flags6(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->flags6 = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: level of class  artifact_type */
+static int toluaI_get_util_artifact_type_level(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->level);
+ return 1;
+}
+
+/* set function: level of class  artifact_type */
+static int toluaI_set_util_artifact_type_level(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->level = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: rarity of class  artifact_type */
+static int toluaI_get_util_artifact_type_rarity(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->rarity);
+ return 1;
+}
+
+/* set function: rarity of class  artifact_type */
+static int toluaI_set_util_artifact_type_rarity(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->rarity = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cur_num of class  artifact_type */
+static int toluaI_get_util_artifact_type_cur_num(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cur_num);
+ return 1;
+}
+
+/* set function: cur_num of class  artifact_type */
+static int toluaI_set_util_artifact_type_cur_num(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cur_num = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: max_num of class  artifact_type */
+static int toluaI_get_util_artifact_type_max_num(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->max_num);
+ return 1;
+}
+
+/* set function: max_num of class  artifact_type */
+static int toluaI_set_util_artifact_type_max_num(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->max_num = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: esp of class  artifact_type */
+static int toluaI_get_util_artifact_type_esp(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->esp);
+ return 1;
+}
+
+/* set function: esp of class  artifact_type */
+static int toluaI_set_util_artifact_type_esp(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->esp = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: known of class  artifact_type */
+static int toluaI_get_util_artifact_type_known(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->known);
+ return 1;
+}
+
+/* set function: known of class  artifact_type */
+static int toluaI_set_util_artifact_type_known(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->known = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: carrier of class  artifact_type */
+static int toluaI_get_util_artifact_type_carrier(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->carrier);
+ return 1;
+}
+
+/* set function: carrier of class  artifact_type */
+static int toluaI_set_util_artifact_type_carrier(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->carrier = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: timeout of class  artifact_type */
+static int toluaI_get_util_artifact_type_timeout(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->timeout);
+ return 1;
+}
+
+/* set function: timeout of class  artifact_type */
+static int toluaI_set_util_artifact_type_timeout(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->timeout = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: iddc of class  artifact_type */
+static int toluaI_get_util_artifact_type_iddc(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->iddc);
+ return 1;
+}
+
+/* set function: iddc of class  artifact_type */
+static int toluaI_set_util_artifact_type_iddc(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->iddc = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: winner of class  artifact_type */
+static int toluaI_get_util_artifact_type_winner(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->winner);
+ return 1;
+}
+
+/* set function: winner of class  artifact_type */
+static int toluaI_set_util_artifact_type_winner(lua_State* tolua_S)
+{
+  artifact_type* self = (artifact_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->winner = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: a_info */
+static int toluaI_get_util_a_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_A_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&a_info[toluaI_index],tolua_tag(tolua_S,"artifact_type"));
+ return 1;
+}
+
+/* set function: a_info */
+static int toluaI_set_util_a_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_A_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  a_info[toluaI_index] = *((artifact_type*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: cur_num of class  monster_race */
+static int toluaI_get_util_monster_race_cur_num(lua_State* tolua_S)
+{
+  monster_race* self = (monster_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cur_num);
+ return 1;
+}
+
+/* set function: cur_num of class  monster_race */
+static int toluaI_set_util_monster_race_cur_num(lua_State* tolua_S)
+{
+  monster_race* self = (monster_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cur_num = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: max_num of class  monster_race */
+static int toluaI_get_util_monster_race_max_num(lua_State* tolua_S)
+{
+  monster_race* self = (monster_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->max_num);
+ return 1;
+}
+
+/* set function: max_num of class  monster_race */
+static int toluaI_set_util_monster_race_max_num(lua_State* tolua_S)
+{
+  monster_race* self = (monster_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->max_num = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: r_sights of class  monster_race */
+static int toluaI_get_util_monster_race_r_sights(lua_State* tolua_S)
+{
+  monster_race* self = (monster_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->r_sights);
+ return 1;
+}
+
+/* set function: r_sights of class  monster_race */
+static int toluaI_set_util_monster_race_r_sights(lua_State* tolua_S)
+{
+  monster_race* self = (monster_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->r_sights = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: r_deaths of class  monster_race */
+static int toluaI_get_util_monster_race_r_deaths(lua_State* tolua_S)
+{
+  monster_race* self = (monster_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->r_deaths);
+ return 1;
+}
+
+/* set function: r_deaths of class  monster_race */
+static int toluaI_set_util_monster_race_r_deaths(lua_State* tolua_S)
+{
+  monster_race* self = (monster_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->r_deaths = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: r_tkills of class  monster_race */
+static int toluaI_get_util_monster_race_r_tkills(lua_State* tolua_S)
+{
+  monster_race* self = (monster_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->r_tkills);
+ return 1;
+}
+
+/* set function: r_tkills of class  monster_race */
+static int toluaI_set_util_monster_race_r_tkills(lua_State* tolua_S)
+{
+  monster_race* self = (monster_race*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->r_tkills = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: r_info */
+static int toluaI_get_util_r_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_R_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&r_info[toluaI_index],tolua_tag(tolua_S,"monster_race"));
+ return 1;
+}
+
+/* set function: r_info */
+static int toluaI_set_util_r_info(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_R_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  r_info[toluaI_index] = *((monster_race*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: sector000separation */
+static int toluaI_get_util_sector000separation(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)sector000separation);
+ return 1;
+}
+
+/* set function: sector000separation */
+static int toluaI_set_util_sector000separation(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  sector000separation = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: ge_special_sector */
+static int toluaI_get_util_ge_special_sector(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)ge_special_sector);
+ return 1;
+}
+
+/* set function: ge_special_sector */
+static int toluaI_set_util_ge_special_sector(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  ge_special_sector = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: ge_contender_buffer_ID */
+static int toluaI_get_util_ge_contender_buffer_ID(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_CONTENDER_BUFFERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)ge_contender_buffer_ID[toluaI_index]);
+ return 1;
+}
+
+/* set function: ge_contender_buffer_ID */
+static int toluaI_set_util_ge_contender_buffer_ID(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_CONTENDER_BUFFERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  ge_contender_buffer_ID[toluaI_index] = ((u32b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: ge_contender_buffer_deed */
+static int toluaI_get_util_ge_contender_buffer_deed(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_ACHIEVEMENT_BUFFERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)ge_contender_buffer_deed[toluaI_index]);
+ return 1;
+}
+
+/* set function: ge_contender_buffer_deed */
+static int toluaI_set_util_ge_contender_buffer_deed(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_ACHIEVEMENT_BUFFERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  ge_contender_buffer_deed[toluaI_index] = ((int)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: name of class  party_type */
+static int toluaI_get_util_party_type_name(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->name);
+ return 1;
+}
+
+/* get function: owner of class  party_type */
+static int toluaI_get_util_party_type_owner(lua_State* tolua_S)
+{
+ int toluaI_index;
+  party_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (party_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=NAME_LEN)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)self->owner[toluaI_index]);
+ return 1;
+}
+
+/* set function: owner of class  party_type */
+static int toluaI_set_util_party_type_owner(lua_State* tolua_S)
+{
+ int toluaI_index;
+  party_type* self;
+ lua_pushstring(tolua_S,".self");
+ lua_rawget(tolua_S,1);
+ self = (party_type*)  lua_touserdata(tolua_S,-1);
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=NAME_LEN)
+ tolua_error(tolua_S,"array indexing out of range.");
+  self->owner[toluaI_index] = ((char)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: members of class  party_type */
+static int toluaI_get_util_party_type_members(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->members);
+ return 1;
+}
+
+/* set function: members of class  party_type */
+static int toluaI_set_util_party_type_members(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->members = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: created of class  party_type */
+static int toluaI_get_util_party_type_created(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->created);
+ return 1;
+}
+
+/* set function: created of class  party_type */
+static int toluaI_set_util_party_type_created(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->created = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cmode of class  party_type */
+static int toluaI_get_util_party_type_cmode(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cmode);
+ return 1;
+}
+
+/* set function: cmode of class  party_type */
+static int toluaI_set_util_party_type_cmode(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cmode = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mode of class  party_type */
+static int toluaI_get_util_party_type_mode(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mode);
+ return 1;
+}
+
+/* set function: mode of class  party_type */
+static int toluaI_set_util_party_type_mode(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mode = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: experience of class  party_type */
+static int toluaI_get_util_party_type_experience(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->experience);
+ return 1;
+}
+
+/* set function: experience of class  party_type */
+static int toluaI_set_util_party_type_experience(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->experience = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: flags of class  party_type */
+static int toluaI_get_util_party_type_flags(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->flags);
+ return 1;
+}
+
+/* set function: flags of class  party_type */
+static int toluaI_set_util_party_type_flags(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->flags = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: iron_trade of class  party_type */
+static int toluaI_get_util_party_type_iron_trade(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->iron_trade);
+ return 1;
+}
+
+/* set function: iron_trade of class  party_type */
+static int toluaI_set_util_party_type_iron_trade(lua_State* tolua_S)
+{
+  party_type* self = (party_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->iron_trade = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: parties */
+static int toluaI_get_util_parties(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_PARTIES)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&parties[toluaI_index],tolua_tag(tolua_S,"party_type"));
+ return 1;
+}
+
+/* set function: parties */
+static int toluaI_set_util_parties(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_PARTIES)
+ tolua_error(tolua_S,"array indexing out of range.");
+  parties[toluaI_index] = *((party_type*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: name of class  guild_type */
+static int toluaI_get_util_guild_type_name(lua_State* tolua_S)
+{
+  guild_type* self = (guild_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushstring(tolua_S,(const char*)self->name);
+ return 1;
+}
+
+/* get function: master of class  guild_type */
+static int toluaI_get_util_guild_type_master(lua_State* tolua_S)
+{
+  guild_type* self = (guild_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->master);
+ return 1;
+}
+
+/* set function: master of class  guild_type */
+static int toluaI_set_util_guild_type_master(lua_State* tolua_S)
+{
+  guild_type* self = (guild_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->master = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: members of class  guild_type */
+static int toluaI_get_util_guild_type_members(lua_State* tolua_S)
+{
+  guild_type* self = (guild_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->members);
+ return 1;
+}
+
+/* set function: members of class  guild_type */
+static int toluaI_set_util_guild_type_members(lua_State* tolua_S)
+{
+  guild_type* self = (guild_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->members = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cmode of class  guild_type */
+static int toluaI_get_util_guild_type_cmode(lua_State* tolua_S)
+{
+  guild_type* self = (guild_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cmode);
+ return 1;
+}
+
+/* set function: cmode of class  guild_type */
+static int toluaI_set_util_guild_type_cmode(lua_State* tolua_S)
+{
+  guild_type* self = (guild_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cmode = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: flags of class  guild_type */
+static int toluaI_get_util_guild_type_flags(lua_State* tolua_S)
+{
+  guild_type* self = (guild_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->flags);
+ return 1;
+}
+
+/* set function: flags of class  guild_type */
+static int toluaI_set_util_guild_type_flags(lua_State* tolua_S)
+{
+  guild_type* self = (guild_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->flags = ((u32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: minlev of class  guild_type */
+static int toluaI_get_util_guild_type_minlev(lua_State* tolua_S)
+{
+  guild_type* self = (guild_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->minlev);
+ return 1;
+}
+
+/* set function: minlev of class  guild_type */
+static int toluaI_set_util_guild_type_minlev(lua_State* tolua_S)
+{
+  guild_type* self = (guild_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->minlev = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: guilds */
+static int toluaI_get_util_guilds(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_GUILDS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&guilds[toluaI_index],tolua_tag(tolua_S,"guild_type"));
+ return 1;
+}
+
+/* set function: guilds */
+static int toluaI_set_util_guilds(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_GUILDS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  guilds[toluaI_index] = *((guild_type*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* function: lua_season_change */
+static int toluaI_util_lua_season_change00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int s = ((int)  tolua_getnumber(tolua_S,1,0));
+  int force = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  lua_season_change(s,force);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_season_change'.");
+ return 0;
+}
+
+/* function: lively_wild */
+static int toluaI_util_lively_wild00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  u32b flags = ((u32b)  tolua_getnumber(tolua_S,1,0));
+ {
+  lively_wild(flags);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lively_wild'.");
+ return 0;
+}
+
+/* get function: season */
+static int toluaI_get_util_season(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)season);
+ return 1;
+}
+
+/* set function: season */
+static int toluaI_set_util_season(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  season = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: weather */
+static int toluaI_get_util_weather(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)weather);
+ return 1;
+}
+
+/* set function: weather */
+static int toluaI_set_util_weather(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  weather = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: weather_duration */
+static int toluaI_get_util_weather_duration(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)weather_duration);
+ return 1;
+}
+
+/* set function: weather_duration */
+static int toluaI_set_util_weather_duration(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  weather_duration = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: weather_frequency */
+static int toluaI_get_util_weather_frequency(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)weather_frequency);
+ return 1;
+}
+
+/* set function: weather_frequency */
+static int toluaI_set_util_weather_frequency(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  weather_frequency = ((byte)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: wind_gust */
+static int toluaI_get_util_wind_gust(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)wind_gust);
+ return 1;
+}
+
+/* set function: wind_gust */
+static int toluaI_set_util_wind_gust(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  wind_gust = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: wind_gust_delay */
+static int toluaI_get_util_wind_gust_delay(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)wind_gust_delay);
+ return 1;
+}
+
+/* set function: wind_gust_delay */
+static int toluaI_set_util_wind_gust_delay(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  wind_gust_delay = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: clouds */
+static int toluaI_get_util_clouds(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)clouds);
+ return 1;
+}
+
+/* set function: clouds */
+static int toluaI_set_util_clouds(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  clouds = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: max_clouds_seasonal */
+static int toluaI_get_util_max_clouds_seasonal(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)max_clouds_seasonal);
+ return 1;
+}
+
+/* set function: max_clouds_seasonal */
+static int toluaI_set_util_max_clouds_seasonal(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  max_clouds_seasonal = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: season_halloween */
+static int toluaI_get_util_season_halloween(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)season_halloween);
+ return 1;
+}
+
+/* set function: season_halloween */
+static int toluaI_set_util_season_halloween(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  season_halloween = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: season_xmas */
+static int toluaI_get_util_season_xmas(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)season_xmas);
+ return 1;
+}
+
+/* set function: season_xmas */
+static int toluaI_set_util_season_xmas(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  season_xmas = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: season_newyearseve */
+static int toluaI_get_util_season_newyearseve(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)season_newyearseve);
+ return 1;
+}
+
+/* set function: season_newyearseve */
+static int toluaI_set_util_season_newyearseve(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  season_newyearseve = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* function: handle_seasonal_music */
+static int toluaI_util_handle_seasonal_music00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  handle_seasonal_music();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'handle_seasonal_music'.");
+ return 0;
+}
+
+/* get function: fireworks */
+static int toluaI_get_util_fireworks(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)fireworks);
+ return 1;
+}
+
+/* set function: fireworks */
+static int toluaI_set_util_fireworks(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  fireworks = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: fireworks_delay */
+static int toluaI_get_util_fireworks_delay(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)fireworks_delay);
+ return 1;
+}
+
+/* set function: fireworks_delay */
+static int toluaI_set_util_fireworks_delay(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  fireworks_delay = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: firework_dungeon */
+static int toluaI_get_util_firework_dungeon(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)firework_dungeon);
+ return 1;
+}
+
+/* set function: firework_dungeon */
+static int toluaI_set_util_firework_dungeon(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  firework_dungeon = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: firework_dungeon_chance */
+static int toluaI_get_util_firework_dungeon_chance(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)firework_dungeon_chance);
+ return 1;
+}
+
+/* set function: firework_dungeon_chance */
+static int toluaI_set_util_firework_dungeon_chance(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  firework_dungeon_chance = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: ANGBAND_DIR */
+static int toluaI_get_util_ANGBAND_DIR(lua_State* tolua_S)
+{
+ tolua_pushstring(tolua_S,(const char*)ANGBAND_DIR);
+ return 1;
+}
+
+/* set function: ANGBAND_DIR */
+static int toluaI_set_util_ANGBAND_DIR(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TSTRING,0))
+ TOLUA_ERR_ASSIGN;
+  ANGBAND_DIR = ((cptr)  tolua_getstring(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: timer_pvparena1 */
+static int toluaI_get_util_timer_pvparena1(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)timer_pvparena1);
+ return 1;
+}
+
+/* set function: timer_pvparena1 */
+static int toluaI_set_util_timer_pvparena1(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  timer_pvparena1 = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: timer_pvparena2 */
+static int toluaI_get_util_timer_pvparena2(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)timer_pvparena2);
+ return 1;
+}
+
+/* set function: timer_pvparena2 */
+static int toluaI_set_util_timer_pvparena2(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  timer_pvparena2 = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: timer_falling_star */
+static int toluaI_get_util_timer_falling_star(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)timer_falling_star);
+ return 1;
+}
+
+/* set function: timer_falling_star */
+static int toluaI_set_util_timer_falling_star(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  timer_falling_star = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* function: Send_weather */
+static int toluaI_util_Send_weather00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,7,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,8,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,9)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int weather_type = ((int)  tolua_getnumber(tolua_S,2,0));
+  int weather_wind = ((int)  tolua_getnumber(tolua_S,3,0));
+  int weather_gen_speed = ((int)  tolua_getnumber(tolua_S,4,0));
+  int weather_intensity = ((int)  tolua_getnumber(tolua_S,5,0));
+  int weather_speed = ((int)  tolua_getnumber(tolua_S,6,0));
+  bool update_clouds = ((bool)  tolua_getnumber(tolua_S,7,0));
+  bool revoke_clouds = ((bool)  tolua_getnumber(tolua_S,8,0));
+ {
+  int toluaI_ret = (int)  Send_weather(ind,weather_type,weather_wind,weather_gen_speed,weather_intensity,weather_speed,update_clouds,revoke_clouds);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'Send_weather'.");
+ return 0;
+}
+
+/* function: timed_shutdown */
+static int toluaI_util_timed_shutdown00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int k = ((int)  tolua_getnumber(tolua_S,1,0));
+  bool terminate = ((bool)  tolua_getnumber(tolua_S,2,0));
+ {
+  timed_shutdown(k,terminate);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'timed_shutdown'.");
+ return 0;
+}
+
+/* function: geno_towns */
+static int toluaI_util_geno_towns00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  geno_towns();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'geno_towns'.");
+ return 0;
+}
+
+/* get function: go_game_up */
+static int toluaI_get_util_go_game_up(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)go_game_up);
+ return 1;
+}
+
+/* set function: go_game_up */
+static int toluaI_set_util_go_game_up(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  go_game_up = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: go_wait_for_sgf */
+static int toluaI_get_util_go_wait_for_sgf(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)go_wait_for_sgf);
+ return 1;
+}
+
+/* set function: go_wait_for_sgf */
+static int toluaI_set_util_go_wait_for_sgf(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  go_wait_for_sgf = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: go_engine_player_id */
+static int toluaI_get_util_go_engine_player_id(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)go_engine_player_id);
+ return 1;
+}
+
+/* set function: go_engine_player_id */
+static int toluaI_set_util_go_engine_player_id(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  go_engine_player_id = ((u32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* function: go_engine_init */
+static int toluaI_util_go_engine_init00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  int toluaI_ret = (int)  go_engine_init();
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'go_engine_init'.");
+ return 0;
+}
+
+/* function: go_engine_terminate */
+static int toluaI_util_go_engine_terminate00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  go_engine_terminate();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'go_engine_terminate'.");
+ return 0;
+}
+
+/* function: go_challenge_cancel */
+static int toluaI_util_go_challenge_cancel00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  go_challenge_cancel();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'go_challenge_cancel'.");
+ return 0;
+}
+
+/* get function: numtowns */
+static int toluaI_get_util_numtowns(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)numtowns);
+ return 1;
+}
+
+/* set function: numtowns */
+static int toluaI_set_util_numtowns(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  numtowns = ((u16b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: quark__num */
+static int toluaI_get_util_quark__num(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)quark__num);
+ return 1;
+}
+
+/* set function: quark__num */
+static int toluaI_set_util_quark__num(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  quark__num = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* function: swear_add */
+static int toluaI_util_swear_add00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  char* word = ((char*)  tolua_getstring(tolua_S,1,0));
+  int level = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  swear_add(word,level);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'swear_add'.");
+ return 0;
+}
+
+/* function: swear_get_word */
+static int toluaI_util_swear_get_word00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int i = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  char* toluaI_ret = (char*)  swear_get_word(i);
+ tolua_pushstring(tolua_S,(const char*)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'swear_get_word'.");
+ return 0;
+}
+
+/* function: swear_get_level */
+static int toluaI_util_swear_get_level00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int i = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  swear_get_level(i);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'swear_get_level'.");
+ return 0;
+}
+
+/* function: nonswear_add */
+static int toluaI_util_nonswear_add00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  char* word = ((char*)  tolua_getstring(tolua_S,1,0));
+  int affix = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  nonswear_add(word,affix);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'nonswear_add'.");
+ return 0;
+}
+
+/* function: nonswear_get */
+static int toluaI_util_nonswear_get00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int i = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  char* toluaI_ret = (char*)  nonswear_get(i);
+ tolua_pushstring(tolua_S,(const char*)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'nonswear_get'.");
+ return 0;
+}
+
+/* function: nonswear_affix_get */
+static int toluaI_util_nonswear_affix_get00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int i = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  int toluaI_ret = (int)  nonswear_affix_get(i);
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'nonswear_affix_get'.");
+ return 0;
+}
+
+/* function: init_swearing */
+static int toluaI_util_init_swearing00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  init_swearing();
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'init_swearing'.");
+ return 0;
+}
+
+/* function: lua_swear_list */
+static int toluaI_util_lua_swear_list00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int level = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  lua_swear_list(Ind,level);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_swear_list'.");
+ return 0;
+}
+
+/* function: lua_nonswear_list */
+static int toluaI_util_lua_nonswear_list00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  lua_nonswear_list(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'lua_nonswear_list'.");
+ return 0;
+}
+
+/* function: scan_iddc */
+static int toluaI_util_scan_iddc00(lua_State* tolua_S)
+{
+ if (
+ !tolua_isnoobj(tolua_S,1)
+ )
+ goto tolua_lerror;
+ else
+ {
+ {
+  int toluaI_ret = (int)  scan_iddc();
+ tolua_pushnumber(tolua_S,(long)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'scan_iddc'.");
+ return 0;
+}
+
+/* get function: dungeon_visit_frequency */
+static int toluaI_get_util_dungeon_visit_frequency(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=128)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)dungeon_visit_frequency[toluaI_index]);
+ return 1;
+}
+
+/* set function: dungeon_visit_frequency */
+static int toluaI_set_util_dungeon_visit_frequency(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=128)
+ tolua_error(tolua_S,"array indexing out of range.");
+  dungeon_visit_frequency[toluaI_index] = ((u16b)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: dungeon_bonus */
+static int toluaI_get_util_dungeon_bonus(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=128)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)dungeon_bonus[toluaI_index]);
+ return 1;
+}
+
+/* set function: dungeon_bonus */
+static int toluaI_set_util_dungeon_bonus(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=128)
+ tolua_error(tolua_S,"array indexing out of range.");
+  dungeon_bonus[toluaI_index] = ((int)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: dungeon_id_max */
+static int toluaI_get_util_dungeon_id_max(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)dungeon_id_max);
+ return 1;
+}
+
+/* set function: dungeon_id_max */
+static int toluaI_set_util_dungeon_id_max(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  dungeon_id_max = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: jails_enabled */
+static int toluaI_get_util_jails_enabled(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)jails_enabled);
+ return 1;
+}
+
+/* set function: jails_enabled */
+static int toluaI_set_util_jails_enabled(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  jails_enabled = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: allow_requesting_estate */
+static int toluaI_get_util_allow_requesting_estate(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)allow_requesting_estate);
+ return 1;
+}
+
+/* set function: allow_requesting_estate */
+static int toluaI_set_util_allow_requesting_estate(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  allow_requesting_estate = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: netherrealm_wpos_x */
+static int toluaI_get_util_netherrealm_wpos_x(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)netherrealm_wpos_x);
+ return 1;
+}
+
+/* set function: netherrealm_wpos_x */
+static int toluaI_set_util_netherrealm_wpos_x(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  netherrealm_wpos_x = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: netherrealm_wpos_y */
+static int toluaI_get_util_netherrealm_wpos_y(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)netherrealm_wpos_y);
+ return 1;
+}
+
+/* set function: netherrealm_wpos_y */
+static int toluaI_set_util_netherrealm_wpos_y(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  netherrealm_wpos_y = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: netherrealm_wpos_z */
+static int toluaI_get_util_netherrealm_wpos_z(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)netherrealm_wpos_z);
+ return 1;
+}
+
+/* set function: netherrealm_wpos_z */
+static int toluaI_set_util_netherrealm_wpos_z(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  netherrealm_wpos_z = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: netherrealm_start */
+static int toluaI_get_util_netherrealm_start(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)netherrealm_start);
+ return 1;
+}
+
+/* set function: netherrealm_start */
+static int toluaI_set_util_netherrealm_start(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  netherrealm_start = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: netherrealm_end */
+static int toluaI_get_util_netherrealm_end(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)netherrealm_end);
+ return 1;
+}
+
+/* set function: netherrealm_end */
+static int toluaI_set_util_netherrealm_end(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  netherrealm_end = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: valinor_wpos_x */
+static int toluaI_get_util_valinor_wpos_x(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)valinor_wpos_x);
+ return 1;
+}
+
+/* set function: valinor_wpos_x */
+static int toluaI_set_util_valinor_wpos_x(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  valinor_wpos_x = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: valinor_wpos_y */
+static int toluaI_get_util_valinor_wpos_y(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)valinor_wpos_y);
+ return 1;
+}
+
+/* set function: valinor_wpos_y */
+static int toluaI_set_util_valinor_wpos_y(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  valinor_wpos_y = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: valinor_wpos_z */
+static int toluaI_get_util_valinor_wpos_z(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)valinor_wpos_z);
+ return 1;
+}
+
+/* set function: valinor_wpos_z */
+static int toluaI_set_util_valinor_wpos_z(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  valinor_wpos_z = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* function: fix_max_depth_towerdungeon */
+static int toluaI_util_fix_max_depth_towerdungeon00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  fix_max_depth_towerdungeon(Ind);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'fix_max_depth_towerdungeon'.");
+ return 0;
+}
+
+/* get function: __audio_sfx_max */
+static int toluaI_get_util___audio_sfx_max(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__audio_sfx_max);
+ return 1;
+}
+
+/* set function: __audio_sfx_max */
+static int toluaI_set_util___audio_sfx_max(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __audio_sfx_max = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: __audio_mus_max */
+static int toluaI_get_util___audio_mus_max(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)__audio_mus_max);
+ return 1;
+}
+
+/* set function: __audio_mus_max */
+static int toluaI_set_util___audio_mus_max(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  __audio_mus_max = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: allow_similar_names */
+static int toluaI_get_util_allow_similar_names(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)allow_similar_names);
+ return 1;
+}
+
+/* set function: allow_similar_names */
+static int toluaI_set_util_allow_similar_names(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  allow_similar_names = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: pvp_disabled */
+static int toluaI_get_util_pvp_disabled(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)pvp_disabled);
+ return 1;
+}
+
+/* set function: pvp_disabled */
+static int toluaI_set_util_pvp_disabled(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  pvp_disabled = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: r_ptr of class  monster_type */
+static int toluaI_get_util_monster_type_r_ptr(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)self->r_ptr,tolua_tag(tolua_S,"monster_race"));
+ return 1;
+}
+
+/* set function: r_ptr of class  monster_type */
+static int toluaI_set_util_monster_type_r_ptr(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"monster_race"),0))
+ TOLUA_ERR_ASSIGN;
+  self->r_ptr = ((monster_race*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: special of class  monster_type */
+static int toluaI_get_util_monster_type_special(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->special);
+ return 1;
+}
+
+/* set function: special of class  monster_type */
+static int toluaI_set_util_monster_type_special(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->special = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: pet of class  monster_type */
+static int toluaI_get_util_monster_type_pet(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->pet);
+ return 1;
+}
+
+/* set function: pet of class  monster_type */
+static int toluaI_set_util_monster_type_pet(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->pet = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: r_idx of class  monster_type */
+static int toluaI_get_util_monster_type_r_idx(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->r_idx);
+ return 1;
+}
+
+/* set function: r_idx of class  monster_type */
+static int toluaI_set_util_monster_type_r_idx(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->r_idx = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: owner of class  monster_type */
+static int toluaI_get_util_monster_type_owner(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->owner);
+ return 1;
+}
+
+/* set function: owner of class  monster_type */
+static int toluaI_set_util_monster_type_owner(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->owner = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: related of class  monster_type */
+static int toluaI_get_util_monster_type_related(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->related);
+ return 1;
+}
+
+/* set function: related of class  monster_type */
+static int toluaI_set_util_monster_type_related(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->related = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: related_type of class  monster_type */
+static int toluaI_get_util_monster_type_related_type(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->related_type);
+ return 1;
+}
+
+/* set function: related_type of class  monster_type */
+static int toluaI_set_util_monster_type_related_type(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->related_type = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: fy of class  monster_type */
+static int toluaI_get_util_monster_type_fy(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->fy);
+ return 1;
+}
+
+/* set function: fy of class  monster_type */
+static int toluaI_set_util_monster_type_fy(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->fy = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: fx of class  monster_type */
+static int toluaI_get_util_monster_type_fx(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->fx);
+ return 1;
+}
+
+/* set function: fx of class  monster_type */
+static int toluaI_set_util_monster_type_fx(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->fx = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: wpos of class  monster_type */
+static int toluaI_get_util_monster_type_wpos(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushusertype(tolua_S,(void*)&self->wpos,tolua_tag(tolua_S,"worldpos"));
+ return 1;
+}
+
+/* set function: wpos of class  monster_type */
+static int toluaI_set_util_monster_type_wpos(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,tolua_tag(tolua_S,"worldpos"),0))
+ TOLUA_ERR_ASSIGN;
+  self->wpos = *((struct worldpos*)  tolua_getusertype(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: exp of class  monster_type */
+static int toluaI_get_util_monster_type_exp(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->exp);
+ return 1;
+}
+
+/* set function: exp of class  monster_type */
+static int toluaI_set_util_monster_type_exp(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->exp = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: level of class  monster_type */
+static int toluaI_get_util_monster_type_level(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->level);
+ return 1;
+}
+
+/* set function: level of class  monster_type */
+static int toluaI_set_util_monster_type_level(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->level = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: hold_o_idx of class  monster_type */
+static int toluaI_get_util_monster_type_hold_o_idx(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->hold_o_idx);
+ return 1;
+}
+
+/* set function: hold_o_idx of class  monster_type */
+static int toluaI_set_util_monster_type_hold_o_idx(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->hold_o_idx = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: cdis of class  monster_type */
+static int toluaI_get_util_monster_type_cdis(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->cdis);
+ return 1;
+}
+
+/* set function: cdis of class  monster_type */
+static int toluaI_set_util_monster_type_cdis(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->cdis = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: closest_player of class  monster_type */
+static int toluaI_get_util_monster_type_closest_player(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->closest_player);
+ return 1;
+}
+
+/* set function: closest_player of class  monster_type */
+static int toluaI_set_util_monster_type_closest_player(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->closest_player = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: clone of class  monster_type */
+static int toluaI_get_util_monster_type_clone(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->clone);
+ return 1;
+}
+
+/* set function: clone of class  monster_type */
+static int toluaI_set_util_monster_type_clone(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->clone = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: clone_summoning of class  monster_type */
+static int toluaI_get_util_monster_type_clone_summoning(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->clone_summoning);
+ return 1;
+}
+
+/* set function: clone_summoning of class  monster_type */
+static int toluaI_set_util_monster_type_clone_summoning(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->clone_summoning = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: mind of class  monster_type */
+static int toluaI_get_util_monster_type_mind(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->mind);
+ return 1;
+}
+
+/* set function: mind of class  monster_type */
+static int toluaI_set_util_monster_type_mind(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->mind = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: ego of class  monster_type */
+static int toluaI_get_util_monster_type_ego(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->ego);
+ return 1;
+}
+
+/* set function: ego of class  monster_type */
+static int toluaI_set_util_monster_type_ego(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->ego = ((u16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: name3 of class  monster_type */
+static int toluaI_get_util_monster_type_name3(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->name3);
+ return 1;
+}
+
+/* set function: name3 of class  monster_type */
+static int toluaI_set_util_monster_type_name3(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->name3 = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: status of class  monster_type */
+static int toluaI_get_util_monster_type_status(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->status);
+ return 1;
+}
+
+/* set function: status of class  monster_type */
+static int toluaI_set_util_monster_type_status(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->status = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: target of class  monster_type */
+static int toluaI_get_util_monster_type_target(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->target);
+ return 1;
+}
+
+/* set function: target of class  monster_type */
+static int toluaI_set_util_monster_type_target(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->target = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: backstabbed of class  monster_type */
+static int toluaI_get_util_monster_type_backstabbed(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->backstabbed);
+ return 1;
+}
+
+/* set function: backstabbed of class  monster_type */
+static int toluaI_set_util_monster_type_backstabbed(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->backstabbed = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: henc of class  monster_type */
+static int toluaI_get_util_monster_type_henc(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->henc);
+ return 1;
+}
+
+/* set function: henc of class  monster_type */
+static int toluaI_set_util_monster_type_henc(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->henc = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: henc_top of class  monster_type */
+static int toluaI_get_util_monster_type_henc_top(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->henc_top);
+ return 1;
+}
+
+/* set function: henc_top of class  monster_type */
+static int toluaI_set_util_monster_type_henc_top(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->henc_top = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: astar_idx of class  monster_type */
+static int toluaI_get_util_monster_type_astar_idx(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->astar_idx);
+ return 1;
+}
+
+/* set function: astar_idx of class  monster_type */
+static int toluaI_set_util_monster_type_astar_idx(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->astar_idx = ((s32b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: quest of class  monster_type */
+static int toluaI_get_util_monster_type_quest(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->quest);
+ return 1;
+}
+
+/* set function: quest of class  monster_type */
+static int toluaI_set_util_monster_type_quest(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->quest = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: questor_idx of class  monster_type */
+static int toluaI_get_util_monster_type_questor_idx(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->questor_idx);
+ return 1;
+}
+
+/* set function: questor_idx of class  monster_type */
+static int toluaI_set_util_monster_type_questor_idx(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->questor_idx = ((s16b)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: questor of class  monster_type */
+static int toluaI_get_util_monster_type_questor(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->questor);
+ return 1;
+}
+
+/* set function: questor of class  monster_type */
+static int toluaI_set_util_monster_type_questor(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->questor = ((bool)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: questor_invincible of class  monster_type */
+static int toluaI_get_util_monster_type_questor_invincible(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->questor_invincible);
+ return 1;
+}
+
+/* set function: questor_invincible of class  monster_type */
+static int toluaI_set_util_monster_type_questor_invincible(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->questor_invincible = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: questor_hostile of class  monster_type */
+static int toluaI_get_util_monster_type_questor_hostile(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->questor_hostile);
+ return 1;
+}
+
+/* set function: questor_hostile of class  monster_type */
+static int toluaI_set_util_monster_type_questor_hostile(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->questor_hostile = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: questor_target of class  monster_type */
+static int toluaI_get_util_monster_type_questor_target(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ tolua_pushnumber(tolua_S,(long)self->questor_target);
+ return 1;
+}
+
+/* set function: questor_target of class  monster_type */
+static int toluaI_set_util_monster_type_questor_target(lua_State* tolua_S)
+{
+  monster_type* self = (monster_type*)  tolua_getusertype(tolua_S,1,0);
+ if (!self) TOLUA_ERR_SELF;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  self->questor_target = ((byte)  tolua_getnumber(tolua_S,2,0));
+ return 0;
+}
+
+/* get function: o_nxt */
+static int toluaI_get_util_o_nxt(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)o_nxt);
+ return 1;
+}
+
+/* set function: o_nxt */
+static int toluaI_set_util_o_nxt(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  o_nxt = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: o_max */
+static int toluaI_get_util_o_max(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)o_max);
+ return 1;
+}
+
+/* set function: o_max */
+static int toluaI_set_util_o_max(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  o_max = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: o_top */
+static int toluaI_get_util_o_top(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)o_top);
+ return 1;
+}
+
+/* set function: o_top */
+static int toluaI_set_util_o_top(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  o_top = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: m_nxt */
+static int toluaI_get_util_m_nxt(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)m_nxt);
+ return 1;
+}
+
+/* set function: m_nxt */
+static int toluaI_set_util_m_nxt(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  m_nxt = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: m_max */
+static int toluaI_get_util_m_max(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)m_max);
+ return 1;
+}
+
+/* set function: m_max */
+static int toluaI_set_util_m_max(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  m_max = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: m_top */
+static int toluaI_get_util_m_top(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)m_top);
+ return 1;
+}
+
+/* set function: m_top */
+static int toluaI_set_util_m_top(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  m_top = ((s32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: o_list */
+static int toluaI_get_util_o_list(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_O_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&o_list[toluaI_index],tolua_tag(tolua_S,"object_type"));
+ return 1;
+}
+
+/* set function: o_list */
+static int toluaI_set_util_o_list(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_O_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  o_list[toluaI_index] = *((object_type*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: m_list */
+static int toluaI_get_util_m_list(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_M_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushusertype(tolua_S,(void*)&m_list[toluaI_index],tolua_tag(tolua_S,"monster_type"));
+ return 1;
+}
+
+/* set function: m_list */
+static int toluaI_set_util_m_list(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=MAX_M_IDX)
+ tolua_error(tolua_S,"array indexing out of range.");
+  m_list[toluaI_index] = *((monster_type*)  tolua_getusertype(tolua_S,3,0));
+ return 0;
+}
+
+/* function: verify_expfact */
+static int toluaI_util_verify_expfact00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int Ind = ((int)  tolua_getnumber(tolua_S,1,0));
+  int p = ((int)  tolua_getnumber(tolua_S,2,0));
+ {
+  verify_expfact(Ind,p);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'verify_expfact'.");
+ return 0;
+}
+
+/* function: loadmap */
+static int toluaI_util_loadmap00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TSTRING,0) ||
+ !tolua_istype(tolua_S,2,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,3,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,4,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,5,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,6,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,7)
+ )
+ goto tolua_lerror;
+ else
+ {
+  cptr name = ((cptr)  tolua_getstring(tolua_S,1,0));
+  int wx = ((int)  tolua_getnumber(tolua_S,2,0));
+  int wy = ((int)  tolua_getnumber(tolua_S,3,0));
+  int wz = ((int)  tolua_getnumber(tolua_S,4,0));
+  int x = ((int)  tolua_getnumber(tolua_S,5,0));
+  int y = ((int)  tolua_getnumber(tolua_S,6,0));
+ {
+  loadmap(name,wx,wy,wz,x,y);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'loadmap'.");
+ return 0;
+}
+
+/* get function: restart_panic */
+static int toluaI_get_util_restart_panic(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)restart_panic);
+ return 1;
+}
+
+/* set function: restart_panic */
+static int toluaI_set_util_restart_panic(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  restart_panic = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: restart_unstatice_bree */
+static int toluaI_get_util_restart_unstatice_bree(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)restart_unstatice_bree);
+ return 1;
+}
+
+/* set function: restart_unstatice_bree */
+static int toluaI_set_util_restart_unstatice_bree(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  restart_unstatice_bree = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: restart_unstatice_towns */
+static int toluaI_get_util_restart_unstatice_towns(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)restart_unstatice_towns);
+ return 1;
+}
+
+/* set function: restart_unstatice_towns */
+static int toluaI_set_util_restart_unstatice_towns(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  restart_unstatice_towns = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: restart_unstatice_surface */
+static int toluaI_get_util_restart_unstatice_surface(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)restart_unstatice_surface);
+ return 1;
+}
+
+/* set function: restart_unstatice_surface */
+static int toluaI_set_util_restart_unstatice_surface(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  restart_unstatice_surface = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: restart_unstatice_dungeons */
+static int toluaI_get_util_restart_unstatice_dungeons(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)restart_unstatice_dungeons);
+ return 1;
+}
+
+/* set function: restart_unstatice_dungeons */
+static int toluaI_set_util_restart_unstatice_dungeons(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  restart_unstatice_dungeons = ((bool)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: sflags0 */
+static int toluaI_get_util_sflags0(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)sflags0);
+ return 1;
+}
+
+/* set function: sflags0 */
+static int toluaI_set_util_sflags0(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  sflags0 = ((u32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: sflags1 */
+static int toluaI_get_util_sflags1(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)sflags1);
+ return 1;
+}
+
+/* set function: sflags1 */
+static int toluaI_set_util_sflags1(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  sflags1 = ((u32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: sflags2 */
+static int toluaI_get_util_sflags2(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)sflags2);
+ return 1;
+}
+
+/* set function: sflags2 */
+static int toluaI_set_util_sflags2(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  sflags2 = ((u32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: sflags3 */
+static int toluaI_get_util_sflags3(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)sflags3);
+ return 1;
+}
+
+/* set function: sflags3 */
+static int toluaI_set_util_sflags3(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  sflags3 = ((u32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: sflags_TEMP */
+static int toluaI_get_util_sflags_TEMP(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)sflags_TEMP);
+ return 1;
+}
+
+/* set function: sflags_TEMP */
+static int toluaI_set_util_sflags_TEMP(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  sflags_TEMP = ((u32b)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: custom_lua_timer_timeout */
+static int toluaI_get_util_custom_lua_timer_timeout(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=CUSTOM_LUA_TIMERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)custom_lua_timer_timeout[toluaI_index]);
+ return 1;
+}
+
+/* set function: custom_lua_timer_timeout */
+static int toluaI_set_util_custom_lua_timer_timeout(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=CUSTOM_LUA_TIMERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  custom_lua_timer_timeout[toluaI_index] = ((int)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: custom_lua_timer_parm1 */
+static int toluaI_get_util_custom_lua_timer_parm1(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=CUSTOM_LUA_TIMERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)custom_lua_timer_parm1[toluaI_index]);
+ return 1;
+}
+
+/* set function: custom_lua_timer_parm1 */
+static int toluaI_set_util_custom_lua_timer_parm1(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=CUSTOM_LUA_TIMERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  custom_lua_timer_parm1[toluaI_index] = ((int)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: custom_lua_timer_parm2 */
+static int toluaI_get_util_custom_lua_timer_parm2(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=CUSTOM_LUA_TIMERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)custom_lua_timer_parm2[toluaI_index]);
+ return 1;
+}
+
+/* set function: custom_lua_timer_parm2 */
+static int toluaI_set_util_custom_lua_timer_parm2(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=CUSTOM_LUA_TIMERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  custom_lua_timer_parm2[toluaI_index] = ((int)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* get function: custom_lua_timer_parm3 */
+static int toluaI_get_util_custom_lua_timer_parm3(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=CUSTOM_LUA_TIMERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+ tolua_pushnumber(tolua_S,(long)custom_lua_timer_parm3[toluaI_index]);
+ return 1;
+}
+
+/* set function: custom_lua_timer_parm3 */
+static int toluaI_set_util_custom_lua_timer_parm3(lua_State* tolua_S)
+{
+ int toluaI_index;
+ if (!tolua_istype(tolua_S,2,LUA_TNUMBER,0))
+ tolua_error(tolua_S,"invalid type in array indexing.");
+ toluaI_index = (int)tolua_getnumber(tolua_S,2,0)-1;
+ if (toluaI_index<0 || toluaI_index>=CUSTOM_LUA_TIMERS)
+ tolua_error(tolua_S,"array indexing out of range.");
+  custom_lua_timer_parm3[toluaI_index] = ((int)  tolua_getnumber(tolua_S,3,0));
+ return 0;
+}
+
+/* function: custom_lua_timer_parmstr_get */
+static int toluaI_util_custom_lua_timer_parmstr_get00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_isnoobj(tolua_S,2)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int i = ((int)  tolua_getnumber(tolua_S,1,0));
+ {
+  char* toluaI_ret = (char*)  custom_lua_timer_parmstr_get(i);
+ tolua_pushstring(tolua_S,(const char*)toluaI_ret);
+ }
+ }
+ return 1;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'custom_lua_timer_parmstr_get'.");
+ return 0;
+}
+
+/* function: custom_lua_timer_parmstr_set */
+static int toluaI_util_custom_lua_timer_parmstr_set00(lua_State* tolua_S)
+{
+ if (
+ !tolua_istype(tolua_S,1,LUA_TNUMBER,0) ||
+ !tolua_istype(tolua_S,2,LUA_TSTRING,0) ||
+ !tolua_isnoobj(tolua_S,3)
+ )
+ goto tolua_lerror;
+ else
+ {
+  int i = ((int)  tolua_getnumber(tolua_S,1,0));
+  char* str = ((char*)  tolua_getstring(tolua_S,2,0));
+ {
+  custom_lua_timer_parmstr_set(i,str);
+ }
+ }
+ return 0;
+tolua_lerror:
+ tolua_error(tolua_S,"#ferror in function 'custom_lua_timer_parmstr_set'.");
+ return 0;
+}
+
+/* get function: debug_drain_hp */
+static int toluaI_get_util_debug_drain_hp(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)debug_drain_hp);
+ return 1;
+}
+
+/* set function: debug_drain_hp */
+static int toluaI_set_util_debug_drain_hp(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  debug_drain_hp = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* get function: debug_drain_mp */
+static int toluaI_get_util_debug_drain_mp(lua_State* tolua_S)
+{
+ tolua_pushnumber(tolua_S,(long)debug_drain_mp);
+ return 1;
+}
+
+/* set function: debug_drain_mp */
+static int toluaI_set_util_debug_drain_mp(lua_State* tolua_S)
+{
+ if (!tolua_istype(tolua_S,1,LUA_TNUMBER,0))
+ TOLUA_ERR_ASSIGN;
+  debug_drain_mp = ((int)  tolua_getnumber(tolua_S,1,0));
+ return 0;
+}
+
+/* Open function */
+int tolua_util_open (lua_State* tolua_S)
+{
+ tolua_open(tolua_S);
+ toluaI_reg_types(tolua_S);
+ tolua_constant(tolua_S,NULL,"USE_EQUIP",USE_EQUIP);
+ tolua_constant(tolua_S,NULL,"USE_INVEN",USE_INVEN);
+ tolua_constant(tolua_S,NULL,"USE_SUBINVEN",USE_SUBINVEN);
+ tolua_constant(tolua_S,NULL,"EXCLUDE_SUBINVEN",EXCLUDE_SUBINVEN);
+ tolua_constant(tolua_S,NULL,"CAPS_ALT",CAPS_ALT);
+ tolua_constant(tolua_S,NULL,"BASE_PALETTE_SIZE",BASE_PALETTE_SIZE);
+ tolua_constant(tolua_S,NULL,"CLIENT_PALETTE_SIZE",CLIENT_PALETTE_SIZE);
+ tolua_constant(tolua_S,NULL,"TERM_DARK",TERM_DARK);
+ tolua_constant(tolua_S,NULL,"TERM_WHITE",TERM_WHITE);
+ tolua_constant(tolua_S,NULL,"TERM_SLATE",TERM_SLATE);
+ tolua_constant(tolua_S,NULL,"TERM_ORANGE",TERM_ORANGE);
+ tolua_constant(tolua_S,NULL,"TERM_RED",TERM_RED);
+ tolua_constant(tolua_S,NULL,"TERM_GREEN",TERM_GREEN);
+ tolua_constant(tolua_S,NULL,"TERM_BLUE",TERM_BLUE);
+ tolua_constant(tolua_S,NULL,"TERM_UMBER",TERM_UMBER);
+ tolua_constant(tolua_S,NULL,"TERM_L_DARK",TERM_L_DARK);
+ tolua_constant(tolua_S,NULL,"TERM_L_WHITE",TERM_L_WHITE);
+ tolua_constant(tolua_S,NULL,"TERM_VIOLET",TERM_VIOLET);
+ tolua_constant(tolua_S,NULL,"TERM_YELLOW",TERM_YELLOW);
+ tolua_constant(tolua_S,NULL,"TERM_L_RED",TERM_L_RED);
+ tolua_constant(tolua_S,NULL,"TERM_L_GREEN",TERM_L_GREEN);
+ tolua_constant(tolua_S,NULL,"TERM_L_BLUE",TERM_L_BLUE);
+ tolua_constant(tolua_S,NULL,"TERM_L_UMBER",TERM_L_UMBER);
+ tolua_constant(tolua_S,NULL,"TERM_MULTI",TERM_MULTI);
+ tolua_constant(tolua_S,NULL,"TERM_POIS",TERM_POIS);
+ tolua_constant(tolua_S,NULL,"TERM_FIRE",TERM_FIRE);
+ tolua_constant(tolua_S,NULL,"TERM_COLD",TERM_COLD);
+ tolua_constant(tolua_S,NULL,"TERM_ACID",TERM_ACID);
+ tolua_constant(tolua_S,NULL,"TERM_ELEC",TERM_ELEC);
+ tolua_constant(tolua_S,NULL,"TERM_CONF",TERM_CONF);
+ tolua_constant(tolua_S,NULL,"TERM_SOUN",TERM_SOUN);
+ tolua_constant(tolua_S,NULL,"TERM_SHAR",TERM_SHAR);
+ tolua_constant(tolua_S,NULL,"TERM_LITE",TERM_LITE);
+ tolua_constant(tolua_S,NULL,"TERM_DARKNESS",TERM_DARKNESS);
+ tolua_constant(tolua_S,NULL,"TERM_SHIELDM",TERM_SHIELDM);
+ tolua_constant(tolua_S,NULL,"TERM_SHIELDM_LOW",TERM_SHIELDM_LOW);
+ tolua_constant(tolua_S,NULL,"TERM_SHIELDI",TERM_SHIELDI);
+ tolua_constant(tolua_S,NULL,"TERM_CURSE",TERM_CURSE);
+ tolua_constant(tolua_S,NULL,"TERM_ANNI",TERM_ANNI);
+ tolua_constant(tolua_S,NULL,"TERM_HALF",TERM_HALF);
+ tolua_constant(tolua_S,NULL,"TERM_OLD_BNW",TERM_OLD_BNW);
+ tolua_constant(tolua_S,NULL,"TERM_OLD_PVP",TERM_OLD_PVP);
+ tolua_constant(tolua_S,NULL,"TERM_PSI",TERM_PSI);
+ tolua_constant(tolua_S,NULL,"TERM_NEXU",TERM_NEXU);
+ tolua_constant(tolua_S,NULL,"TERM_NETH",TERM_NETH);
+ tolua_constant(tolua_S,NULL,"TERM_DISE",TERM_DISE);
+ tolua_constant(tolua_S,NULL,"TERM_INER",TERM_INER);
+ tolua_constant(tolua_S,NULL,"TERM_FORC",TERM_FORC);
+ tolua_constant(tolua_S,NULL,"TERM_GRAV",TERM_GRAV);
+ tolua_constant(tolua_S,NULL,"TERM_TIME",TERM_TIME);
+ tolua_constant(tolua_S,NULL,"TERM_METEOR",TERM_METEOR);
+ tolua_constant(tolua_S,NULL,"TERM_MANA",TERM_MANA);
+ tolua_constant(tolua_S,NULL,"TERM_DISI",TERM_DISI);
+ tolua_constant(tolua_S,NULL,"TERM_WATE",TERM_WATE);
+ tolua_constant(tolua_S,NULL,"TERM_ICE",TERM_ICE);
+ tolua_constant(tolua_S,NULL,"TERM_PLAS",TERM_PLAS);
+ tolua_constant(tolua_S,NULL,"TERM_DETO",TERM_DETO);
+ tolua_constant(tolua_S,NULL,"TERM_NUKE",TERM_NUKE);
+ tolua_constant(tolua_S,NULL,"TERM_UNBREATH",TERM_UNBREATH);
+ tolua_constant(tolua_S,NULL,"TERM_HOLYORB",TERM_HOLYORB);
+ tolua_constant(tolua_S,NULL,"TERM_HOLYFIRE",TERM_HOLYFIRE);
+ tolua_constant(tolua_S,NULL,"TERM_HELLFIRE",TERM_HELLFIRE);
+ tolua_constant(tolua_S,NULL,"TERM_THUNDER",TERM_THUNDER);
+ tolua_constant(tolua_S,NULL,"TERM_LAMP",TERM_LAMP);
+ tolua_constant(tolua_S,NULL,"TERM_LAMP_DARK",TERM_LAMP_DARK);
+ tolua_constant(tolua_S,NULL,"TERM_EMBER",TERM_EMBER);
+ tolua_constant(tolua_S,NULL,"TERM_STARLITE",TERM_STARLITE);
+ tolua_constant(tolua_S,NULL,"TERM_HAVOC",TERM_HAVOC);
+ tolua_constant(tolua_S,NULL,"TERM_SELECTOR",TERM_SELECTOR);
+ tolua_constant(tolua_S,NULL,"TERM_SMOOTHPAL",TERM_SMOOTHPAL);
+ tolua_constant(tolua_S,NULL,"TERM_SEL_RED",TERM_SEL_RED);
+ tolua_constant(tolua_S,NULL,"TERM_SEL_BLUE",TERM_SEL_BLUE);
+ tolua_constant(tolua_S,NULL,"TERM_SRCLITE",TERM_SRCLITE);
+ tolua_constant(tolua_S,NULL,"TERMA_OFFSET",TERMA_OFFSET);
+ tolua_constant(tolua_S,NULL,"TERMA_DARK",TERMA_DARK);
+ tolua_constant(tolua_S,NULL,"TERMA_WHITE",TERMA_WHITE);
+ tolua_constant(tolua_S,NULL,"TERMA_SLATE",TERMA_SLATE);
+ tolua_constant(tolua_S,NULL,"TERMA_ORANGE",TERMA_ORANGE);
+ tolua_constant(tolua_S,NULL,"TERMA_RED",TERMA_RED);
+ tolua_constant(tolua_S,NULL,"TERMA_GREEN",TERMA_GREEN);
+ tolua_constant(tolua_S,NULL,"TERMA_BLUE",TERMA_BLUE);
+ tolua_constant(tolua_S,NULL,"TERMA_UMBER",TERMA_UMBER);
+ tolua_constant(tolua_S,NULL,"TERMA_L_DARK",TERMA_L_DARK);
+ tolua_constant(tolua_S,NULL,"TERMA_L_WHITE",TERMA_L_WHITE);
+ tolua_constant(tolua_S,NULL,"TERMA_VIOLET",TERMA_VIOLET);
+ tolua_constant(tolua_S,NULL,"TERMA_YELLOW",TERMA_YELLOW);
+ tolua_constant(tolua_S,NULL,"TERMA_L_RED",TERMA_L_RED);
+ tolua_constant(tolua_S,NULL,"TERMA_L_GREEN",TERMA_L_GREEN);
+ tolua_constant(tolua_S,NULL,"TERMA_L_BLUE",TERMA_L_BLUE);
+ tolua_constant(tolua_S,NULL,"TERMA_L_UMBER",TERMA_L_UMBER);
+ tolua_constant(tolua_S,NULL,"TERM_ANIM_WATER_EAST",TERM_ANIM_WATER_EAST);
+ tolua_constant(tolua_S,NULL,"TERM_ANIM_WATER_WEST",TERM_ANIM_WATER_WEST);
+ tolua_constant(tolua_S,NULL,"TERM_ANIM_WATER_NORTH",TERM_ANIM_WATER_NORTH);
+ tolua_constant(tolua_S,NULL,"TERM_ANIM_WATER_SOUTH",TERM_ANIM_WATER_SOUTH);
+ tolua_constant(tolua_S,NULL,"TERM_ANIM_LAVA_EAST",TERM_ANIM_LAVA_EAST);
+ tolua_constant(tolua_S,NULL,"TERM_ANIM_LAVA_WEST",TERM_ANIM_LAVA_WEST);
+ tolua_constant(tolua_S,NULL,"TERM_ANIM_LAVA_NORTH",TERM_ANIM_LAVA_NORTH);
+ tolua_constant(tolua_S,NULL,"TERM_ANIM_LAVA_SOUTH",TERM_ANIM_LAVA_SOUTH);
+ tolua_constant(tolua_S,NULL,"TERM_BNW",TERM_BNW);
+ tolua_constant(tolua_S,NULL,"TERM_BNWM",TERM_BNWM);
+ tolua_constant(tolua_S,NULL,"TERM_BNWSR",TERM_BNWSR);
+ tolua_constant(tolua_S,NULL,"TERM_BNWKS",TERM_BNWKS);
+ tolua_constant(tolua_S,NULL,"TERM_BNWKS2",TERM_BNWKS2);
+ tolua_constant(tolua_S,NULL,"TERM_PVPBB",TERM_PVPBB);
+ tolua_constant(tolua_S,NULL,"TERM_PVP",TERM_PVP);
+ tolua_constant(tolua_S,NULL,"TERM_RESERVED",TERM_RESERVED);
+ tolua_constant(tolua_S,NULL,"TERM_HILITE_PLAYER",TERM_HILITE_PLAYER);
+ tolua_constant(tolua_S,NULL,"TERM_OLD2_BNW",TERM_OLD2_BNW);
+ tolua_constant(tolua_S,NULL,"TERM_OLD2_PVP",TERM_OLD2_PVP);
+ tolua_constant(tolua_S,NULL,"TERM_OLD3_BNW",TERM_OLD3_BNW);
+ tolua_constant(tolua_S,NULL,"TERM_OLD3_BNWM",TERM_OLD3_BNWM);
+ tolua_constant(tolua_S,NULL,"TERM_OLD3_BNWSR",TERM_OLD3_BNWSR);
+ tolua_constant(tolua_S,NULL,"TERM_OLD3_BNWKS",TERM_OLD3_BNWKS);
+ tolua_constant(tolua_S,NULL,"TERM_OLD3_BNWKS2",TERM_OLD3_BNWKS2);
+ tolua_constant(tolua_S,NULL,"TERM_OLD3_PVPBB",TERM_OLD3_PVPBB);
+ tolua_constant(tolua_S,NULL,"TERM_OLD3_PVP",TERM_OLD3_PVP);
+ tolua_constant(tolua_S,NULL,"TERM_RESERVED_RLE",TERM_RESERVED_RLE);
+ tolua_constant(tolua_S,NULL,"TERM_SEL_GREEN",TERM_SEL_GREEN);
+ tolua_constant(tolua_S,NULL,"TERMX_START",TERMX_START);
+ tolua_constant(tolua_S,NULL,"TERMX_AMT",TERMX_AMT);
+ tolua_constant(tolua_S,NULL,"TERMX_BLUE",TERMX_BLUE);
+ tolua_constant(tolua_S,NULL,"TERMX_GREEN",TERMX_GREEN);
+ tolua_constant(tolua_S,NULL,"TERMX_RED",TERMX_RED);
+ tolua_constant(tolua_S,NULL,"TERMX_YELLOW",TERMX_YELLOW);
+ tolua_constant(tolua_S,NULL,"TERMX_GREY",TERMX_GREY);
+ tolua_constant(tolua_S,NULL,"TERMX_WHITE",TERMX_WHITE);
+ tolua_constant(tolua_S,NULL,"TERMX_PURPLE",TERMX_PURPLE);
+ tolua_constant(tolua_S,NULL,"HOOK_MONSTER_DEATH",HOOK_MONSTER_DEATH);
+ tolua_constant(tolua_S,NULL,"HOOK_OPEN",HOOK_OPEN);
+ tolua_constant(tolua_S,NULL,"HOOK_GEN_QUEST",HOOK_GEN_QUEST);
+ tolua_constant(tolua_S,NULL,"HOOK_END_TURN",HOOK_END_TURN);
+ tolua_constant(tolua_S,NULL,"HOOK_FEELING",HOOK_FEELING);
+ tolua_constant(tolua_S,NULL,"HOOK_NEW_MONSTER",HOOK_NEW_MONSTER);
+ tolua_constant(tolua_S,NULL,"HOOK_GEN_LEVEL",HOOK_GEN_LEVEL);
+ tolua_constant(tolua_S,NULL,"HOOK_BUILD_ROOM1",HOOK_BUILD_ROOM1);
+ tolua_constant(tolua_S,NULL,"HOOK_NEW_LEVEL",HOOK_NEW_LEVEL);
+ tolua_constant(tolua_S,NULL,"HOOK_QUEST_FINISH",HOOK_QUEST_FINISH);
+ tolua_constant(tolua_S,NULL,"HOOK_QUEST_FAIL",HOOK_QUEST_FAIL);
+ tolua_constant(tolua_S,NULL,"HOOK_GIVE",HOOK_GIVE);
+ tolua_constant(tolua_S,NULL,"HOOK_CHAR_DUMP",HOOK_CHAR_DUMP);
+ tolua_constant(tolua_S,NULL,"HOOK_INIT_QUEST",HOOK_INIT_QUEST);
+ tolua_constant(tolua_S,NULL,"HOOK_WILD_GEN",HOOK_WILD_GEN);
+ tolua_constant(tolua_S,NULL,"HOOK_DROP",HOOK_DROP);
+ tolua_constant(tolua_S,NULL,"HOOK_IDENTIFY",HOOK_IDENTIFY);
+ tolua_constant(tolua_S,NULL,"HOOK_MOVE",HOOK_MOVE);
+ tolua_constant(tolua_S,NULL,"HOOK_STAIR",HOOK_STAIR);
+ tolua_constant(tolua_S,NULL,"HOOK_MONSTER_AI",HOOK_MONSTER_AI);
+ tolua_constant(tolua_S,NULL,"HOOK_PLAYER_LEVEL",HOOK_PLAYER_LEVEL);
+ tolua_constant(tolua_S,NULL,"HOOK_WIELD",HOOK_WIELD);
+ tolua_constant(tolua_S,NULL,"HOOK_INIT",HOOK_INIT);
+ tolua_constant(tolua_S,NULL,"HOOK_QUAFF",HOOK_QUAFF);
+ tolua_constant(tolua_S,NULL,"HOOK_AIM",HOOK_AIM);
+ tolua_constant(tolua_S,NULL,"HOOK_USE",HOOK_USE);
+ tolua_constant(tolua_S,NULL,"HOOK_ACTIVATE",HOOK_ACTIVATE);
+ tolua_constant(tolua_S,NULL,"HOOK_ZAP",HOOK_ZAP);
+ tolua_constant(tolua_S,NULL,"HOOK_READ",HOOK_READ);
+ tolua_constant(tolua_S,NULL,"HOOK_CALC_BONUS",HOOK_CALC_BONUS);
+ tolua_constant(tolua_S,NULL,"HOOK_PLAYER_FLAGS",HOOK_PLAYER_FLAGS);
+ tolua_constant(tolua_S,NULL,"HOOK_KEYPRESS",HOOK_KEYPRESS);
+ tolua_constant(tolua_S,NULL,"HOOK_CHAT",HOOK_CHAT);
+ tolua_constant(tolua_S,NULL,"HOOK_MON_SPEAK",HOOK_MON_SPEAK);
+ tolua_constant(tolua_S,NULL,"HOOK_MKEY",HOOK_MKEY);
+ tolua_constant(tolua_S,NULL,"HOOK_BIRTH_OBJECTS",HOOK_BIRTH_OBJECTS);
+ tolua_constant(tolua_S,NULL,"HOOK_ACTIVATE_DESC",HOOK_ACTIVATE_DESC);
+ tolua_constant(tolua_S,NULL,"HOOK_INIT_GAME",HOOK_INIT_GAME);
+ tolua_constant(tolua_S,NULL,"HOOK_ACTIVATE_POWER",HOOK_ACTIVATE_POWER);
+ tolua_constant(tolua_S,NULL,"HOOK_ITEM_NAME",HOOK_ITEM_NAME);
+ tolua_constant(tolua_S,NULL,"HOOK_SAVE_GAME",HOOK_SAVE_GAME);
+ tolua_constant(tolua_S,NULL,"HOOK_LOAD_GAME",HOOK_LOAD_GAME);
+ tolua_constant(tolua_S,NULL,"HOOK_LEVEL_REGEN",HOOK_LEVEL_REGEN);
+ tolua_constant(tolua_S,NULL,"HOOK_LEVEL_END_GEN",HOOK_LEVEL_END_GEN);
+ tolua_constant(tolua_S,NULL,"HOOK_BUILDING_ACTION",HOOK_BUILDING_ACTION);
+ tolua_constant(tolua_S,NULL,"HOOK_PROCESS_WORLD",HOOK_PROCESS_WORLD);
+ tolua_constant(tolua_S,NULL,"HOOK_WIELD_SLOT",HOOK_WIELD_SLOT);
+ tolua_constant(tolua_S,NULL,"HOOK_STORE_STOCK",HOOK_STORE_STOCK);
+ tolua_constant(tolua_S,NULL,"HOOK_STORE_BUY",HOOK_STORE_BUY);
+ tolua_constant(tolua_S,NULL,"HOOK_GEN_LEVEL_BEGIN",HOOK_GEN_LEVEL_BEGIN);
+ tolua_constant(tolua_S,NULL,"HOOK_GET",HOOK_GET);
+ tolua_constant(tolua_S,NULL,"HOOK_NPCTEST",HOOK_NPCTEST);
+ tolua_constant(tolua_S,NULL,"MAX_HOOKS",MAX_HOOKS);
+ tolua_constant(tolua_S,NULL,"PROJECT_JUMP",PROJECT_JUMP);
+ tolua_constant(tolua_S,NULL,"PROJECT_BEAM",PROJECT_BEAM);
+ tolua_constant(tolua_S,NULL,"PROJECT_THRU",PROJECT_THRU);
+ tolua_constant(tolua_S,NULL,"PROJECT_STOP",PROJECT_STOP);
+ tolua_constant(tolua_S,NULL,"PROJECT_GRID",PROJECT_GRID);
+ tolua_constant(tolua_S,NULL,"PROJECT_ITEM",PROJECT_ITEM);
+ tolua_constant(tolua_S,NULL,"PROJECT_KILL",PROJECT_KILL);
+ tolua_constant(tolua_S,NULL,"PROJECT_HIDE",PROJECT_HIDE);
+ tolua_constant(tolua_S,NULL,"PROJECT_STAY",PROJECT_STAY);
+ tolua_constant(tolua_S,NULL,"PROJECT_SELF",PROJECT_SELF);
+ tolua_constant(tolua_S,NULL,"PROJECT_DUMY",PROJECT_DUMY);
+ tolua_constant(tolua_S,NULL,"PROJECT_GRAV",PROJECT_GRAV);
+ tolua_constant(tolua_S,NULL,"PROJECT_PLAY",PROJECT_PLAY);
+ tolua_constant(tolua_S,NULL,"PROJECT_NORF",PROJECT_NORF);
+ tolua_constant(tolua_S,NULL,"PROJECT_FULL",PROJECT_FULL);
+ tolua_constant(tolua_S,NULL,"PROJECT_EVSG",PROJECT_EVSG);
+ tolua_constant(tolua_S,NULL,"PROJECT_NODO",PROJECT_NODO);
+ tolua_constant(tolua_S,NULL,"PROJECT_LODF",PROJECT_LODF);
+ tolua_constant(tolua_S,NULL,"PROJECT_NODF",PROJECT_NODF);
+ tolua_constant(tolua_S,NULL,"PROJECT_RNAF",PROJECT_RNAF);
+ tolua_constant(tolua_S,NULL,"PROJECT_STAR",PROJECT_STAR);
+ tolua_constant(tolua_S,NULL,"PROJECT_TRAP",PROJECT_TRAP);
+ tolua_constant(tolua_S,NULL,"PROJECTOR_UNUSUAL",PROJECTOR_UNUSUAL);
+ tolua_constant(tolua_S,NULL,"PROJECTOR_TRAP",PROJECTOR_TRAP);
+ tolua_constant(tolua_S,NULL,"PROJECTOR_POTION",PROJECTOR_POTION);
+ tolua_constant(tolua_S,NULL,"PROJECTOR_TERRAIN",PROJECTOR_TERRAIN);
+ tolua_constant(tolua_S,NULL,"PROJECTOR_MON_TRAP",PROJECTOR_MON_TRAP);
+ tolua_constant(tolua_S,NULL,"PROJECTOR_EFFECT",PROJECTOR_EFFECT);
+ tolua_constant(tolua_S,NULL,"PROJECTOR_PLAYER",PROJECTOR_PLAYER);
+ tolua_constant(tolua_S,NULL,"PROJECTOR_RUNE",PROJECTOR_RUNE);
+ tolua_constant(tolua_S,NULL,"TRUE",TRUE);
+ tolua_constant(tolua_S,NULL,"FALSE",FALSE);
+ tolua_cclass(tolua_S,"hash_entry","");
+ tolua_tablevar(tolua_S,"hash_entry","id",toluaI_get_util_hash_entry_id,toluaI_set_util_hash_entry_id);
+ tolua_tablevar(tolua_S,"hash_entry","account",toluaI_get_util_hash_entry_account,toluaI_set_util_hash_entry_account);
+ tolua_tablevar(tolua_S,"hash_entry","name",toluaI_get_util_hash_entry_name,toluaI_set_util_hash_entry_name);
+ tolua_tablevar(tolua_S,"hash_entry","level",toluaI_get_util_hash_entry_level,toluaI_set_util_hash_entry_level);
+ tolua_tablevar(tolua_S,"hash_entry","party",toluaI_get_util_hash_entry_party,toluaI_set_util_hash_entry_party);
+ tolua_tablevar(tolua_S,"hash_entry","guild",toluaI_get_util_hash_entry_guild,toluaI_set_util_hash_entry_guild);
+ tolua_tablevar(tolua_S,"hash_entry","xorder",toluaI_get_util_hash_entry_xorder,toluaI_set_util_hash_entry_xorder);
+ tolua_tablevar(tolua_S,"hash_entry","laston",toluaI_get_util_hash_entry_laston,toluaI_set_util_hash_entry_laston);
+ tolua_tablevar(tolua_S,"hash_entry","next",toluaI_get_util_hash_entry_next,toluaI_set_util_hash_entry_next);
+ tolua_function(tolua_S,NULL,"lookup_player",toluaI_util_lookup_player00);
+ tolua_function(tolua_S,NULL,"lookup_player_id",toluaI_util_lookup_player_id00);
+ tolua_function(tolua_S,NULL,"lookup_player_id_messy",toluaI_util_lookup_player_id_messy00);
+ tolua_cclass(tolua_S,"server_opts","");
+ tolua_tablevar(tolua_S,"server_opts","runlevel",toluaI_get_util_server_opts_runlevel,toluaI_set_util_server_opts_runlevel);
+ tolua_tablevar(tolua_S,"server_opts","runtime",toluaI_get_util_server_opts_runtime,toluaI_set_util_server_opts_runtime);
+ tolua_tablevar(tolua_S,"server_opts","closetime",toluaI_get_util_server_opts_closetime,toluaI_set_util_server_opts_closetime);
+ tolua_tablevar(tolua_S,"server_opts","meta_address",toluaI_get_util_server_opts_meta_address,toluaI_set_util_server_opts_meta_address);
+ tolua_tablevar(tolua_S,"server_opts","meta_port",toluaI_get_util_server_opts_meta_port,toluaI_set_util_server_opts_meta_port);
+ tolua_tablevar(tolua_S,"server_opts","bind_name",toluaI_get_util_server_opts_bind_name,toluaI_set_util_server_opts_bind_name);
+ tolua_tablevar(tolua_S,"server_opts","console_password",toluaI_get_util_server_opts_console_password,toluaI_set_util_server_opts_console_password);
+ tolua_tablevar(tolua_S,"server_opts","admin_wizard",toluaI_get_util_server_opts_admin_wizard,toluaI_set_util_server_opts_admin_wizard);
+ tolua_tablevar(tolua_S,"server_opts","dungeon_master",toluaI_get_util_server_opts_dungeon_master,toluaI_set_util_server_opts_dungeon_master);
+ tolua_tablevar(tolua_S,"server_opts","wserver",toluaI_get_util_server_opts_wserver,toluaI_set_util_server_opts_wserver);
+ tolua_tablevar(tolua_S,"server_opts","pass",toluaI_get_util_server_opts_pass,toluaI_set_util_server_opts_pass);
+ tolua_tablevar(tolua_S,"server_opts","preserve_death_level",toluaI_get_util_server_opts_preserve_death_level,toluaI_set_util_server_opts_preserve_death_level);
+ tolua_tablevar(tolua_S,"server_opts","unique_respawn_time",toluaI_get_util_server_opts_unique_respawn_time,toluaI_set_util_server_opts_unique_respawn_time);
+ tolua_tablevar(tolua_S,"server_opts","unique_max_respawn_time",toluaI_get_util_server_opts_unique_max_respawn_time,toluaI_set_util_server_opts_unique_max_respawn_time);
+ tolua_tablevar(tolua_S,"server_opts","level_unstatic_chance",toluaI_get_util_server_opts_level_unstatic_chance,toluaI_set_util_server_opts_level_unstatic_chance);
+ tolua_tablevar(tolua_S,"server_opts","min_unstatic_level",toluaI_get_util_server_opts_min_unstatic_level,toluaI_set_util_server_opts_min_unstatic_level);
+ tolua_tablevar(tolua_S,"server_opts","retire_timer",toluaI_get_util_server_opts_retire_timer,toluaI_set_util_server_opts_retire_timer);
+ tolua_tablevar(tolua_S,"server_opts","game_port",toluaI_get_util_server_opts_game_port,toluaI_set_util_server_opts_game_port);
+ tolua_tablevar(tolua_S,"server_opts","console_port",toluaI_get_util_server_opts_console_port,toluaI_set_util_server_opts_console_port);
+ tolua_tablevar(tolua_S,"server_opts","gw_port",toluaI_get_util_server_opts_gw_port,toluaI_set_util_server_opts_gw_port);
+ tolua_tablevar(tolua_S,"server_opts","spell_interfere",toluaI_get_util_server_opts_spell_interfere,toluaI_set_util_server_opts_spell_interfere);
+ tolua_tablevar(tolua_S,"server_opts","spell_stack_limit",toluaI_get_util_server_opts_spell_stack_limit,toluaI_set_util_server_opts_spell_stack_limit);
+ tolua_tablevar(tolua_S,"server_opts","fps",toluaI_get_util_server_opts_fps,toluaI_set_util_server_opts_fps);
+ tolua_tablevar(tolua_S,"server_opts","players_never_expire",toluaI_get_util_server_opts_players_never_expire,toluaI_set_util_server_opts_players_never_expire);
+ tolua_tablevar(tolua_S,"server_opts","admins_never_expire",toluaI_get_util_server_opts_admins_never_expire,toluaI_set_util_server_opts_admins_never_expire);
+ tolua_tablevar(tolua_S,"server_opts","newbies_cannot_drop",toluaI_get_util_server_opts_newbies_cannot_drop,toluaI_set_util_server_opts_newbies_cannot_drop);
+ tolua_tablevar(tolua_S,"server_opts","running_speed",toluaI_get_util_server_opts_running_speed,toluaI_set_util_server_opts_running_speed);
+ tolua_tablevar(tolua_S,"server_opts","anti_scum",toluaI_get_util_server_opts_anti_scum,toluaI_set_util_server_opts_anti_scum);
+ tolua_tablevar(tolua_S,"server_opts","dun_unusual",toluaI_get_util_server_opts_dun_unusual,toluaI_set_util_server_opts_dun_unusual);
+ tolua_tablevar(tolua_S,"server_opts","town_x",toluaI_get_util_server_opts_town_x,toluaI_set_util_server_opts_town_x);
+ tolua_tablevar(tolua_S,"server_opts","town_y",toluaI_get_util_server_opts_town_y,toluaI_set_util_server_opts_town_y);
+ tolua_tablevar(tolua_S,"server_opts","town_base",toluaI_get_util_server_opts_town_base,toluaI_set_util_server_opts_town_base);
+ tolua_tablevar(tolua_S,"server_opts","store_turns",toluaI_get_util_server_opts_store_turns,toluaI_set_util_server_opts_store_turns);
+ tolua_tablevar(tolua_S,"server_opts","dun_store_turns",toluaI_get_util_server_opts_dun_store_turns,toluaI_set_util_server_opts_dun_store_turns);
+ tolua_tablevar(tolua_S,"server_opts","book_store_turns_perc",toluaI_get_util_server_opts_book_store_turns_perc,toluaI_set_util_server_opts_book_store_turns_perc);
+ tolua_tablevar(tolua_S,"server_opts","resting_rate",toluaI_get_util_server_opts_resting_rate,toluaI_set_util_server_opts_resting_rate);
+ tolua_tablevar(tolua_S,"server_opts","party_xp_boost",toluaI_get_util_server_opts_party_xp_boost,toluaI_set_util_server_opts_party_xp_boost);
+ tolua_tablevar(tolua_S,"server_opts","use_pk_rules",toluaI_get_util_server_opts_use_pk_rules,toluaI_set_util_server_opts_use_pk_rules);
+ tolua_tablevar(tolua_S,"server_opts","quit_ban_mode",toluaI_get_util_server_opts_quit_ban_mode,toluaI_set_util_server_opts_quit_ban_mode);
+ tolua_tablevar(tolua_S,"server_opts","zang_monsters",toluaI_get_util_server_opts_zang_monsters,toluaI_set_util_server_opts_zang_monsters);
+ tolua_tablevar(tolua_S,"server_opts","pern_monsters",toluaI_get_util_server_opts_pern_monsters,toluaI_set_util_server_opts_pern_monsters);
+ tolua_tablevar(tolua_S,"server_opts","cth_monsters",toluaI_get_util_server_opts_cth_monsters,toluaI_set_util_server_opts_cth_monsters);
+ tolua_tablevar(tolua_S,"server_opts","joke_monsters",toluaI_get_util_server_opts_joke_monsters,toluaI_set_util_server_opts_joke_monsters);
+ tolua_tablevar(tolua_S,"server_opts","cblue_monsters",toluaI_get_util_server_opts_cblue_monsters,toluaI_set_util_server_opts_cblue_monsters);
+ tolua_tablevar(tolua_S,"server_opts","vanilla_monsters",toluaI_get_util_server_opts_vanilla_monsters,toluaI_set_util_server_opts_vanilla_monsters);
+ tolua_tablevar(tolua_S,"server_opts","pet_monsters",toluaI_get_util_server_opts_pet_monsters,toluaI_set_util_server_opts_pet_monsters);
+ tolua_tablevar(tolua_S,"server_opts","report_to_meta",toluaI_get_util_server_opts_report_to_meta,toluaI_set_util_server_opts_report_to_meta);
+ tolua_tablevar(tolua_S,"server_opts","secret_dungeon_master",toluaI_get_util_server_opts_secret_dungeon_master,toluaI_set_util_server_opts_secret_dungeon_master);
+ tolua_tablevar(tolua_S,"server_opts","anti_arts_hoard",toluaI_get_util_server_opts_anti_arts_hoard,toluaI_set_util_server_opts_anti_arts_hoard);
+ tolua_tablevar(tolua_S,"server_opts","anti_arts_house",toluaI_get_util_server_opts_anti_arts_house,toluaI_set_util_server_opts_anti_arts_house);
+ tolua_tablevar(tolua_S,"server_opts","anti_arts_wild",toluaI_get_util_server_opts_anti_arts_wild,toluaI_set_util_server_opts_anti_arts_wild);
+ tolua_tablevar(tolua_S,"server_opts","anti_arts_shop",toluaI_get_util_server_opts_anti_arts_shop,toluaI_set_util_server_opts_anti_arts_shop);
+ tolua_tablevar(tolua_S,"server_opts","anti_arts_pickup",toluaI_get_util_server_opts_anti_arts_pickup,toluaI_set_util_server_opts_anti_arts_pickup);
+ tolua_tablevar(tolua_S,"server_opts","anti_arts_send",toluaI_get_util_server_opts_anti_arts_send,toluaI_set_util_server_opts_anti_arts_send);
+ tolua_tablevar(tolua_S,"server_opts","persistent_artifacts",toluaI_get_util_server_opts_persistent_artifacts,toluaI_set_util_server_opts_persistent_artifacts);
+ tolua_tablevar(tolua_S,"server_opts","anti_cheeze_pickup",toluaI_get_util_server_opts_anti_cheeze_pickup,toluaI_set_util_server_opts_anti_cheeze_pickup);
+ tolua_tablevar(tolua_S,"server_opts","anti_cheeze_telekinesis",toluaI_get_util_server_opts_anti_cheeze_telekinesis,toluaI_set_util_server_opts_anti_cheeze_telekinesis);
+ tolua_tablevar(tolua_S,"server_opts","surface_item_removal",toluaI_get_util_server_opts_surface_item_removal,toluaI_set_util_server_opts_surface_item_removal);
+ tolua_tablevar(tolua_S,"server_opts","dungeon_item_removal",toluaI_get_util_server_opts_dungeon_item_removal,toluaI_set_util_server_opts_dungeon_item_removal);
+ tolua_tablevar(tolua_S,"server_opts","death_wild_item_removal",toluaI_get_util_server_opts_death_wild_item_removal,toluaI_set_util_server_opts_death_wild_item_removal);
+ tolua_tablevar(tolua_S,"server_opts","long_wild_item_removal",toluaI_get_util_server_opts_long_wild_item_removal,toluaI_set_util_server_opts_long_wild_item_removal);
+ tolua_tablevar(tolua_S,"server_opts","dungeon_shop_chance",toluaI_get_util_server_opts_dungeon_shop_chance,toluaI_set_util_server_opts_dungeon_shop_chance);
+ tolua_tablevar(tolua_S,"server_opts","dungeon_shop_type",toluaI_get_util_server_opts_dungeon_shop_type,toluaI_set_util_server_opts_dungeon_shop_type);
+ tolua_tablevar(tolua_S,"server_opts","dungeon_shop_timeout",toluaI_get_util_server_opts_dungeon_shop_timeout,toluaI_set_util_server_opts_dungeon_shop_timeout);
+ tolua_tablevar(tolua_S,"server_opts","mage_hp_bonus",toluaI_get_util_server_opts_mage_hp_bonus,toluaI_set_util_server_opts_mage_hp_bonus);
+ tolua_tablevar(tolua_S,"server_opts","door_bump_open",toluaI_get_util_server_opts_door_bump_open,toluaI_set_util_server_opts_door_bump_open);
+ tolua_tablevar(tolua_S,"server_opts","no_ghost",toluaI_get_util_server_opts_no_ghost,toluaI_set_util_server_opts_no_ghost);
+ tolua_tablevar(tolua_S,"server_opts","lifes",toluaI_get_util_server_opts_lifes,toluaI_set_util_server_opts_lifes);
+ tolua_tablevar(tolua_S,"server_opts","houses_per_player",toluaI_get_util_server_opts_houses_per_player,toluaI_set_util_server_opts_houses_per_player);
+ tolua_tablevar(tolua_S,"server_opts","castles_per_player",toluaI_get_util_server_opts_castles_per_player,toluaI_set_util_server_opts_castles_per_player);
+ tolua_tablevar(tolua_S,"server_opts","castles_for_kings",toluaI_get_util_server_opts_castles_for_kings,toluaI_set_util_server_opts_castles_for_kings);
+ tolua_tablevar(tolua_S,"server_opts","acc_house_limit",toluaI_get_util_server_opts_acc_house_limit,toluaI_set_util_server_opts_acc_house_limit);
+ tolua_tablevar(tolua_S,"server_opts","maximize",toluaI_get_util_server_opts_maximize,toluaI_set_util_server_opts_maximize);
+ tolua_tablevar(tolua_S,"server_opts","kings_etiquette",toluaI_get_util_server_opts_kings_etiquette,toluaI_set_util_server_opts_kings_etiquette);
+ tolua_tablevar(tolua_S,"server_opts","fallenkings_etiquette",toluaI_get_util_server_opts_fallenkings_etiquette,toluaI_set_util_server_opts_fallenkings_etiquette);
+ tolua_tablevar(tolua_S,"server_opts","strict_etiquette",toluaI_get_util_server_opts_strict_etiquette,toluaI_set_util_server_opts_strict_etiquette);
+ tolua_tablevar(tolua_S,"server_opts","public_rfe",toluaI_get_util_server_opts_public_rfe,toluaI_set_util_server_opts_public_rfe);
+ tolua_tablevar(tolua_S,"server_opts","auto_purge",toluaI_get_util_server_opts_auto_purge,toluaI_set_util_server_opts_auto_purge);
+ tolua_tablevar(tolua_S,"server_opts","log_u",toluaI_get_util_server_opts_log_u,toluaI_set_util_server_opts_log_u);
+ tolua_tablevar(tolua_S,"server_opts","replace_hiscore",toluaI_get_util_server_opts_replace_hiscore,toluaI_set_util_server_opts_replace_hiscore);
+ tolua_tablevar(tolua_S,"server_opts","unikill_format",toluaI_get_util_server_opts_unikill_format,toluaI_set_util_server_opts_unikill_format);
+ tolua_tablevar(tolua_S,"server_opts","server_notes",toluaI_get_util_server_opts_server_notes,toluaI_set_util_server_opts_server_notes);
+ tolua_tablevar(tolua_S,"server_opts","arts_disabled",toluaI_get_util_server_opts_arts_disabled,toluaI_set_util_server_opts_arts_disabled);
+ tolua_tablevar(tolua_S,"server_opts","winners_find_randarts",toluaI_get_util_server_opts_winners_find_randarts,toluaI_set_util_server_opts_winners_find_randarts);
+ tolua_tablevar(tolua_S,"server_opts","arts_level_req",toluaI_get_util_server_opts_arts_level_req,toluaI_set_util_server_opts_arts_level_req);
+ tolua_tablevar(tolua_S,"server_opts","surface_summoning",toluaI_get_util_server_opts_surface_summoning,toluaI_set_util_server_opts_surface_summoning);
+ tolua_tablevar(tolua_S,"server_opts","clone_summoning",toluaI_get_util_server_opts_clone_summoning,toluaI_set_util_server_opts_clone_summoning);
+ tolua_tablevar(tolua_S,"server_opts","henc_strictness",toluaI_get_util_server_opts_henc_strictness,toluaI_set_util_server_opts_henc_strictness);
+ tolua_tablevar(tolua_S,"server_opts","bonus_calc_type",toluaI_get_util_server_opts_bonus_calc_type,toluaI_set_util_server_opts_bonus_calc_type);
+ tolua_tablevar(tolua_S,"server_opts","charmode_trading_restrictions",toluaI_get_util_server_opts_charmode_trading_restrictions,toluaI_set_util_server_opts_charmode_trading_restrictions);
+ tolua_tablevar(tolua_S,"server_opts","item_awareness",toluaI_get_util_server_opts_item_awareness,toluaI_set_util_server_opts_item_awareness);
+ tolua_tablevar(tolua_S,"server_opts","worldd_pubchat",toluaI_get_util_server_opts_worldd_pubchat,toluaI_set_util_server_opts_worldd_pubchat);
+ tolua_tablevar(tolua_S,"server_opts","worldd_privchat",toluaI_get_util_server_opts_worldd_privchat,toluaI_set_util_server_opts_worldd_privchat);
+ tolua_tablevar(tolua_S,"server_opts","worldd_broadcast",toluaI_get_util_server_opts_worldd_broadcast,toluaI_set_util_server_opts_worldd_broadcast);
+ tolua_tablevar(tolua_S,"server_opts","worldd_lvlup",toluaI_get_util_server_opts_worldd_lvlup,toluaI_set_util_server_opts_worldd_lvlup);
+ tolua_tablevar(tolua_S,"server_opts","worldd_unideath",toluaI_get_util_server_opts_worldd_unideath,toluaI_set_util_server_opts_worldd_unideath);
+ tolua_tablevar(tolua_S,"server_opts","worldd_pwin",toluaI_get_util_server_opts_worldd_pwin,toluaI_set_util_server_opts_worldd_pwin);
+ tolua_tablevar(tolua_S,"server_opts","worldd_pdeath",toluaI_get_util_server_opts_worldd_pdeath,toluaI_set_util_server_opts_worldd_pdeath);
+ tolua_tablevar(tolua_S,"server_opts","worldd_pjoin",toluaI_get_util_server_opts_worldd_pjoin,toluaI_set_util_server_opts_worldd_pjoin);
+ tolua_tablevar(tolua_S,"server_opts","worldd_pleave",toluaI_get_util_server_opts_worldd_pleave,toluaI_set_util_server_opts_worldd_pleave);
+ tolua_tablevar(tolua_S,"server_opts","worldd_plist",toluaI_get_util_server_opts_worldd_plist,toluaI_set_util_server_opts_worldd_plist);
+ tolua_tablevar(tolua_S,"server_opts","worldd_events",toluaI_get_util_server_opts_worldd_events,toluaI_set_util_server_opts_worldd_events);
+ tolua_tablevar(tolua_S,"server_opts","leak_info",toluaI_get_util_server_opts_leak_info,toluaI_set_util_server_opts_leak_info);
+ tolua_tablevar(tolua_S,"server_opts","cmdq_rate_limit",toluaI_get_util_server_opts_cmdq_rate_limit,toluaI_set_util_server_opts_cmdq_rate_limit);
+ tolua_tablevar(tolua_S,"server_opts","cmdq_max_depth",toluaI_get_util_server_opts_cmdq_max_depth,toluaI_set_util_server_opts_cmdq_max_depth);
+ tolua_globalvar(tolua_S,"turn",toluaI_get_util_turn,toluaI_set_util_turn);
+ tolua_globalvar(tolua_S,"session_turn",toluaI_get_util_session_turn,toluaI_set_util_session_turn);
+ tolua_globalvar(tolua_S,"turn_overflow",toluaI_get_util_turn_overflow,toluaI_set_util_turn_overflow);
+ tolua_globalvar(tolua_S,"cfg",toluaI_get_util_cfg,toluaI_set_util_cfg);
+ tolua_globalarray(tolua_S,"player_exp",toluaI_get_util_player_exp,toluaI_set_util_player_exp);
+ tolua_globalvar(tolua_S,"seed_flavor",toluaI_get_util_seed_flavor,NULL);
+ tolua_globalvar(tolua_S,"seed_town",toluaI_get_util_seed_town,NULL);
+ tolua_globalvar(tolua_S,"seed_wild_extra",toluaI_get_util_seed_wild_extra,NULL);
+ tolua_function(tolua_S,NULL,"mod",toluaI_util_mod00);
+ tolua_function(tolua_S,NULL,"band",toluaI_util_band00);
+ tolua_function(tolua_S,NULL,"bor",toluaI_util_bor00);
+ tolua_function(tolua_S,NULL,"bxor",toluaI_util_bxor00);
+ tolua_function(tolua_S,NULL,"bshl",toluaI_util_bshl00);
+ tolua_function(tolua_S,NULL,"bshr",toluaI_util_bshr00);
+ tolua_function(tolua_S,NULL,"bnot",toluaI_util_bnot00);
+ tolua_function(tolua_S,NULL,"pern_dofile",toluaI_util_pern_dofile00);
+ tolua_function(tolua_S,NULL,"exec_lua",toluaI_util_exec_lua00);
+ tolua_function(tolua_S,NULL,"cat_script",toluaI_util_cat_script00);
+ tolua_function(tolua_S,NULL,"msg_print",toluaI_util_msg_print00);
+ tolua_function(tolua_S,NULL,"msg_broadcast",toluaI_util_msg_broadcast00);
+ tolua_function(tolua_S,NULL,"msg_print_near",toluaI_util_msg_print_near00);
+ tolua_function(tolua_S,NULL,"msg_admins",toluaI_util_msg_admins00);
+ tolua_function(tolua_S,NULL,"level_speed",toluaI_util_level_speed00);
+ tolua_function(tolua_S,NULL,"remote_update_lua",toluaI_util_remote_update_lua00);
+ tolua_function(tolua_S,NULL,"wipe_hooks",toluaI_util_wipe_hooks00);
+ tolua_function(tolua_S,NULL,"dump_hooks",toluaI_util_dump_hooks00);
+ tolua_function(tolua_S,NULL,"add_hook",toluaI_util_add_hook00);
+ tolua_globalvar(tolua_S,"dungeon_store_timer",toluaI_get_util_dungeon_store_timer,toluaI_set_util_dungeon_store_timer);
+ tolua_globalvar(tolua_S,"dungeon_store2_timer",toluaI_get_util_dungeon_store2_timer,toluaI_set_util_dungeon_store2_timer);
+ tolua_globalvar(tolua_S,"great_pumpkin_timer",toluaI_get_util_great_pumpkin_timer,toluaI_set_util_great_pumpkin_timer);
+ tolua_globalarray(tolua_S,"great_pumpkin_killer1",toluaI_get_util_great_pumpkin_killer1,toluaI_set_util_great_pumpkin_killer1);
+ tolua_globalarray(tolua_S,"great_pumpkin_killer2",toluaI_get_util_great_pumpkin_killer2,toluaI_set_util_great_pumpkin_killer2);
+ tolua_globalvar(tolua_S,"great_pumpkin_duration",toluaI_get_util_great_pumpkin_duration,toluaI_set_util_great_pumpkin_duration);
+ tolua_globalvar(tolua_S,"santa_claus_timer",toluaI_get_util_santa_claus_timer,toluaI_set_util_santa_claus_timer);
+ tolua_globalvar(tolua_S,"night_surface",toluaI_get_util_night_surface,toluaI_set_util_night_surface);
+ tolua_globalvar(tolua_S,"max_s_idx",toluaI_get_util_max_s_idx,toluaI_set_util_max_s_idx);
+ tolua_globalvar(tolua_S,"max_r_idx",toluaI_get_util_max_r_idx,toluaI_set_util_max_r_idx);
+ tolua_globalvar(tolua_S,"max_rur_idx",toluaI_get_util_max_rur_idx,toluaI_set_util_max_rur_idx);
+ tolua_globalvar(tolua_S,"max_re_idx",toluaI_get_util_max_re_idx,toluaI_set_util_max_re_idx);
+ tolua_globalvar(tolua_S,"max_k_idx",toluaI_get_util_max_k_idx,toluaI_set_util_max_k_idx);
+ tolua_globalvar(tolua_S,"max_v_idx",toluaI_get_util_max_v_idx,toluaI_set_util_max_v_idx);
+ tolua_globalvar(tolua_S,"max_f_idx",toluaI_get_util_max_f_idx,toluaI_set_util_max_f_idx);
+ tolua_globalvar(tolua_S,"max_a_idx",toluaI_get_util_max_a_idx,toluaI_set_util_max_a_idx);
+ tolua_globalvar(tolua_S,"max_e_idx",toluaI_get_util_max_e_idx,toluaI_set_util_max_e_idx);
+ tolua_globalvar(tolua_S,"max_d_idx",toluaI_get_util_max_d_idx,toluaI_set_util_max_d_idx);
+ tolua_globalvar(tolua_S,"max_o_idx",toluaI_get_util_max_o_idx,toluaI_set_util_max_o_idx);
+ tolua_globalvar(tolua_S,"max_m_idx",toluaI_get_util_max_m_idx,toluaI_set_util_max_m_idx);
+ tolua_globalvar(tolua_S,"max_tr_idx",toluaI_get_util_max_tr_idx,toluaI_set_util_max_tr_idx);
+ tolua_globalvar(tolua_S,"max_st_idx",toluaI_get_util_max_st_idx,toluaI_set_util_max_st_idx);
+ tolua_globalvar(tolua_S,"max_ow_idx",toluaI_get_util_max_ow_idx,toluaI_set_util_max_ow_idx);
+ tolua_globalvar(tolua_S,"max_q_idx",toluaI_get_util_max_q_idx,toluaI_set_util_max_q_idx);
+ tolua_globalvar(tolua_S,"global_luck",toluaI_get_util_global_luck,toluaI_set_util_global_luck);
+ tolua_function(tolua_S,NULL,"lua_intrusion",toluaI_util_lua_intrusion00);
+ tolua_globalvar(tolua_S,"sST",toluaI_get_util_sST,toluaI_set_util_sST);
+ tolua_globalvar(tolua_S,"watch_morgoth",toluaI_get_util_watch_morgoth,toluaI_set_util_watch_morgoth);
+ tolua_globalvar(tolua_S,"watch_cp",toluaI_get_util_watch_cp,toluaI_set_util_watch_cp);
+ tolua_globalvar(tolua_S,"watch_nr",toluaI_get_util_watch_nr,toluaI_set_util_watch_nr);
+ tolua_globalvar(tolua_S,"watch_df",toluaI_get_util_watch_df,toluaI_set_util_watch_df);
+ tolua_globalvar(tolua_S,"regen_boost_stamina",toluaI_get_util_regen_boost_stamina,toluaI_set_util_regen_boost_stamina);
+ tolua_globalvar(tolua_S,"updated_savegame_birth",toluaI_get_util_updated_savegame_birth,toluaI_set_util_updated_savegame_birth);
+ tolua_globalvar(tolua_S,"updated_server",toluaI_get_util_updated_server,toluaI_set_util_updated_server);
+ tolua_globalvar(tolua_S,"runtime_server",toluaI_get_util_runtime_server,toluaI_set_util_runtime_server);
+ tolua_globalvar(tolua_S,"artifact_reset",toluaI_get_util_artifact_reset,toluaI_set_util_artifact_reset);
+ tolua_cclass(tolua_S,"artifact_type","");
+ tolua_tablevar(tolua_S,"artifact_type","name",toluaI_get_util_artifact_type_name,toluaI_set_util_artifact_type_name);
+ tolua_tablevar(tolua_S,"artifact_type","text",toluaI_get_util_artifact_type_text,toluaI_set_util_artifact_type_text);
+ tolua_tablevar(tolua_S,"artifact_type","tval",toluaI_get_util_artifact_type_tval,toluaI_set_util_artifact_type_tval);
+ tolua_tablevar(tolua_S,"artifact_type","sval",toluaI_get_util_artifact_type_sval,toluaI_set_util_artifact_type_sval);
+ tolua_tablevar(tolua_S,"artifact_type","pval",toluaI_get_util_artifact_type_pval,toluaI_set_util_artifact_type_pval);
+ tolua_tablevar(tolua_S,"artifact_type","to_h",toluaI_get_util_artifact_type_to_h,toluaI_set_util_artifact_type_to_h);
+ tolua_tablevar(tolua_S,"artifact_type","to_d",toluaI_get_util_artifact_type_to_d,toluaI_set_util_artifact_type_to_d);
+ tolua_tablevar(tolua_S,"artifact_type","to_a",toluaI_get_util_artifact_type_to_a,toluaI_set_util_artifact_type_to_a);
+ tolua_tablevar(tolua_S,"artifact_type","ac",toluaI_get_util_artifact_type_ac,toluaI_set_util_artifact_type_ac);
+ tolua_tablevar(tolua_S,"artifact_type","dd",toluaI_get_util_artifact_type_dd,toluaI_set_util_artifact_type_dd);
+ tolua_tablevar(tolua_S,"artifact_type","ds",toluaI_get_util_artifact_type_ds,toluaI_set_util_artifact_type_ds);
+ tolua_tablevar(tolua_S,"artifact_type","weight",toluaI_get_util_artifact_type_weight,toluaI_set_util_artifact_type_weight);
+ tolua_tablevar(tolua_S,"artifact_type","cost",toluaI_get_util_artifact_type_cost,toluaI_set_util_artifact_type_cost);
+ tolua_tablevar(tolua_S,"artifact_type","flags1",toluaI_get_util_artifact_type_flags1,toluaI_set_util_artifact_type_flags1);
+ tolua_tablevar(tolua_S,"artifact_type","flags2",toluaI_get_util_artifact_type_flags2,toluaI_set_util_artifact_type_flags2);
+ tolua_tablevar(tolua_S,"artifact_type","flags3",toluaI_get_util_artifact_type_flags3,toluaI_set_util_artifact_type_flags3);
+ tolua_tablevar(tolua_S,"artifact_type","flags4",toluaI_get_util_artifact_type_flags4,toluaI_set_util_artifact_type_flags4);
+ tolua_tablevar(tolua_S,"artifact_type","flags5",toluaI_get_util_artifact_type_flags5,toluaI_set_util_artifact_type_flags5);
+ tolua_tablevar(tolua_S,"artifact_type","flags6",toluaI_get_util_artifact_type_flags6,toluaI_set_util_artifact_type_flags6);
+ tolua_tablevar(tolua_S,"artifact_type","level",toluaI_get_util_artifact_type_level,toluaI_set_util_artifact_type_level);
+ tolua_tablevar(tolua_S,"artifact_type","rarity",toluaI_get_util_artifact_type_rarity,toluaI_set_util_artifact_type_rarity);
+ tolua_tablevar(tolua_S,"artifact_type","cur_num",toluaI_get_util_artifact_type_cur_num,toluaI_set_util_artifact_type_cur_num);
+ tolua_tablevar(tolua_S,"artifact_type","max_num",toluaI_get_util_artifact_type_max_num,toluaI_set_util_artifact_type_max_num);
+ tolua_tablevar(tolua_S,"artifact_type","esp",toluaI_get_util_artifact_type_esp,toluaI_set_util_artifact_type_esp);
+ tolua_tablevar(tolua_S,"artifact_type","known",toluaI_get_util_artifact_type_known,toluaI_set_util_artifact_type_known);
+ tolua_tablevar(tolua_S,"artifact_type","carrier",toluaI_get_util_artifact_type_carrier,toluaI_set_util_artifact_type_carrier);
+ tolua_tablevar(tolua_S,"artifact_type","timeout",toluaI_get_util_artifact_type_timeout,toluaI_set_util_artifact_type_timeout);
+ tolua_tablevar(tolua_S,"artifact_type","iddc",toluaI_get_util_artifact_type_iddc,toluaI_set_util_artifact_type_iddc);
+ tolua_tablevar(tolua_S,"artifact_type","winner",toluaI_get_util_artifact_type_winner,toluaI_set_util_artifact_type_winner);
+ tolua_globalarray(tolua_S,"a_info",toluaI_get_util_a_info,toluaI_set_util_a_info);
+ tolua_cclass(tolua_S,"monster_race","");
+ tolua_tablevar(tolua_S,"monster_race","cur_num",toluaI_get_util_monster_race_cur_num,toluaI_set_util_monster_race_cur_num);
+ tolua_tablevar(tolua_S,"monster_race","max_num",toluaI_get_util_monster_race_max_num,toluaI_set_util_monster_race_max_num);
+ tolua_tablevar(tolua_S,"monster_race","r_sights",toluaI_get_util_monster_race_r_sights,toluaI_set_util_monster_race_r_sights);
+ tolua_tablevar(tolua_S,"monster_race","r_deaths",toluaI_get_util_monster_race_r_deaths,toluaI_set_util_monster_race_r_deaths);
+ tolua_tablevar(tolua_S,"monster_race","r_tkills",toluaI_get_util_monster_race_r_tkills,toluaI_set_util_monster_race_r_tkills);
+ tolua_globalarray(tolua_S,"r_info",toluaI_get_util_r_info,toluaI_set_util_r_info);
+ tolua_globalvar(tolua_S,"sector000separation",toluaI_get_util_sector000separation,toluaI_set_util_sector000separation);
+ tolua_globalvar(tolua_S,"ge_special_sector",toluaI_get_util_ge_special_sector,toluaI_set_util_ge_special_sector);
+ tolua_globalarray(tolua_S,"ge_contender_buffer_ID",toluaI_get_util_ge_contender_buffer_ID,toluaI_set_util_ge_contender_buffer_ID);
+ tolua_globalarray(tolua_S,"ge_contender_buffer_deed",toluaI_get_util_ge_contender_buffer_deed,toluaI_set_util_ge_contender_buffer_deed);
+ tolua_cclass(tolua_S,"party_type","");
+ tolua_tablevar(tolua_S,"party_type","name",toluaI_get_util_party_type_name,NULL);
+ tolua_tablearray(tolua_S,"party_type","owner",toluaI_get_util_party_type_owner,toluaI_set_util_party_type_owner);
+ tolua_tablevar(tolua_S,"party_type","members",toluaI_get_util_party_type_members,toluaI_set_util_party_type_members);
+ tolua_tablevar(tolua_S,"party_type","created",toluaI_get_util_party_type_created,toluaI_set_util_party_type_created);
+ tolua_tablevar(tolua_S,"party_type","cmode",toluaI_get_util_party_type_cmode,toluaI_set_util_party_type_cmode);
+ tolua_tablevar(tolua_S,"party_type","mode",toluaI_get_util_party_type_mode,toluaI_set_util_party_type_mode);
+ tolua_tablevar(tolua_S,"party_type","experience",toluaI_get_util_party_type_experience,toluaI_set_util_party_type_experience);
+ tolua_tablevar(tolua_S,"party_type","flags",toluaI_get_util_party_type_flags,toluaI_set_util_party_type_flags);
+ tolua_tablevar(tolua_S,"party_type","iron_trade",toluaI_get_util_party_type_iron_trade,toluaI_set_util_party_type_iron_trade);
+ tolua_globalarray(tolua_S,"parties",toluaI_get_util_parties,toluaI_set_util_parties);
+ tolua_cclass(tolua_S,"guild_type","");
+ tolua_tablevar(tolua_S,"guild_type","name",toluaI_get_util_guild_type_name,NULL);
+ tolua_tablevar(tolua_S,"guild_type","master",toluaI_get_util_guild_type_master,toluaI_set_util_guild_type_master);
+ tolua_tablevar(tolua_S,"guild_type","members",toluaI_get_util_guild_type_members,toluaI_set_util_guild_type_members);
+ tolua_tablevar(tolua_S,"guild_type","cmode",toluaI_get_util_guild_type_cmode,toluaI_set_util_guild_type_cmode);
+ tolua_tablevar(tolua_S,"guild_type","flags",toluaI_get_util_guild_type_flags,toluaI_set_util_guild_type_flags);
+ tolua_tablevar(tolua_S,"guild_type","minlev",toluaI_get_util_guild_type_minlev,toluaI_set_util_guild_type_minlev);
+ tolua_globalarray(tolua_S,"guilds",toluaI_get_util_guilds,toluaI_set_util_guilds);
+ tolua_function(tolua_S,NULL,"lua_season_change",toluaI_util_lua_season_change00);
+ tolua_function(tolua_S,NULL,"lively_wild",toluaI_util_lively_wild00);
+ tolua_globalvar(tolua_S,"season",toluaI_get_util_season,toluaI_set_util_season);
+ tolua_globalvar(tolua_S,"weather",toluaI_get_util_weather,toluaI_set_util_weather);
+ tolua_globalvar(tolua_S,"weather_duration",toluaI_get_util_weather_duration,toluaI_set_util_weather_duration);
+ tolua_globalvar(tolua_S,"weather_frequency",toluaI_get_util_weather_frequency,toluaI_set_util_weather_frequency);
+ tolua_globalvar(tolua_S,"wind_gust",toluaI_get_util_wind_gust,toluaI_set_util_wind_gust);
+ tolua_globalvar(tolua_S,"wind_gust_delay",toluaI_get_util_wind_gust_delay,toluaI_set_util_wind_gust_delay);
+ tolua_globalvar(tolua_S,"clouds",toluaI_get_util_clouds,toluaI_set_util_clouds);
+ tolua_globalvar(tolua_S,"max_clouds_seasonal",toluaI_get_util_max_clouds_seasonal,toluaI_set_util_max_clouds_seasonal);
+ tolua_globalvar(tolua_S,"season_halloween",toluaI_get_util_season_halloween,toluaI_set_util_season_halloween);
+ tolua_globalvar(tolua_S,"season_xmas",toluaI_get_util_season_xmas,toluaI_set_util_season_xmas);
+ tolua_globalvar(tolua_S,"season_newyearseve",toluaI_get_util_season_newyearseve,toluaI_set_util_season_newyearseve);
+ tolua_function(tolua_S,NULL,"handle_seasonal_music",toluaI_util_handle_seasonal_music00);
+ tolua_globalvar(tolua_S,"fireworks",toluaI_get_util_fireworks,toluaI_set_util_fireworks);
+ tolua_globalvar(tolua_S,"fireworks_delay",toluaI_get_util_fireworks_delay,toluaI_set_util_fireworks_delay);
+ tolua_globalvar(tolua_S,"firework_dungeon",toluaI_get_util_firework_dungeon,toluaI_set_util_firework_dungeon);
+ tolua_globalvar(tolua_S,"firework_dungeon_chance",toluaI_get_util_firework_dungeon_chance,toluaI_set_util_firework_dungeon_chance);
+ tolua_globalvar(tolua_S,"ANGBAND_DIR",toluaI_get_util_ANGBAND_DIR,toluaI_set_util_ANGBAND_DIR);
+ tolua_globalvar(tolua_S,"timer_pvparena1",toluaI_get_util_timer_pvparena1,toluaI_set_util_timer_pvparena1);
+ tolua_globalvar(tolua_S,"timer_pvparena2",toluaI_get_util_timer_pvparena2,toluaI_set_util_timer_pvparena2);
+ tolua_globalvar(tolua_S,"timer_falling_star",toluaI_get_util_timer_falling_star,toluaI_set_util_timer_falling_star);
+ tolua_function(tolua_S,NULL,"Send_weather",toluaI_util_Send_weather00);
+ tolua_function(tolua_S,NULL,"timed_shutdown",toluaI_util_timed_shutdown00);
+ tolua_function(tolua_S,NULL,"geno_towns",toluaI_util_geno_towns00);
+ tolua_globalvar(tolua_S,"go_game_up",toluaI_get_util_go_game_up,toluaI_set_util_go_game_up);
+ tolua_globalvar(tolua_S,"go_wait_for_sgf",toluaI_get_util_go_wait_for_sgf,toluaI_set_util_go_wait_for_sgf);
+ tolua_globalvar(tolua_S,"go_engine_player_id",toluaI_get_util_go_engine_player_id,toluaI_set_util_go_engine_player_id);
+ tolua_function(tolua_S,NULL,"go_engine_init",toluaI_util_go_engine_init00);
+ tolua_function(tolua_S,NULL,"go_engine_terminate",toluaI_util_go_engine_terminate00);
+ tolua_function(tolua_S,NULL,"go_challenge_cancel",toluaI_util_go_challenge_cancel00);
+ tolua_globalvar(tolua_S,"numtowns",toluaI_get_util_numtowns,toluaI_set_util_numtowns);
+ tolua_globalvar(tolua_S,"quark__num",toluaI_get_util_quark__num,toluaI_set_util_quark__num);
+ tolua_function(tolua_S,NULL,"swear_add",toluaI_util_swear_add00);
+ tolua_function(tolua_S,NULL,"swear_get_word",toluaI_util_swear_get_word00);
+ tolua_function(tolua_S,NULL,"swear_get_level",toluaI_util_swear_get_level00);
+ tolua_function(tolua_S,NULL,"nonswear_add",toluaI_util_nonswear_add00);
+ tolua_function(tolua_S,NULL,"nonswear_get",toluaI_util_nonswear_get00);
+ tolua_function(tolua_S,NULL,"nonswear_affix_get",toluaI_util_nonswear_affix_get00);
+ tolua_function(tolua_S,NULL,"init_swearing",toluaI_util_init_swearing00);
+ tolua_function(tolua_S,NULL,"lua_swear_list",toluaI_util_lua_swear_list00);
+ tolua_function(tolua_S,NULL,"lua_nonswear_list",toluaI_util_lua_nonswear_list00);
+ tolua_function(tolua_S,NULL,"scan_iddc",toluaI_util_scan_iddc00);
+ tolua_globalarray(tolua_S,"dungeon_visit_frequency",toluaI_get_util_dungeon_visit_frequency,toluaI_set_util_dungeon_visit_frequency);
+ tolua_globalarray(tolua_S,"dungeon_bonus",toluaI_get_util_dungeon_bonus,toluaI_set_util_dungeon_bonus);
+ tolua_globalvar(tolua_S,"dungeon_id_max",toluaI_get_util_dungeon_id_max,toluaI_set_util_dungeon_id_max);
+ tolua_globalvar(tolua_S,"jails_enabled",toluaI_get_util_jails_enabled,toluaI_set_util_jails_enabled);
+ tolua_globalvar(tolua_S,"allow_requesting_estate",toluaI_get_util_allow_requesting_estate,toluaI_set_util_allow_requesting_estate);
+ tolua_globalvar(tolua_S,"netherrealm_wpos_x",toluaI_get_util_netherrealm_wpos_x,toluaI_set_util_netherrealm_wpos_x);
+ tolua_globalvar(tolua_S,"netherrealm_wpos_y",toluaI_get_util_netherrealm_wpos_y,toluaI_set_util_netherrealm_wpos_y);
+ tolua_globalvar(tolua_S,"netherrealm_wpos_z",toluaI_get_util_netherrealm_wpos_z,toluaI_set_util_netherrealm_wpos_z);
+ tolua_globalvar(tolua_S,"netherrealm_start",toluaI_get_util_netherrealm_start,toluaI_set_util_netherrealm_start);
+ tolua_globalvar(tolua_S,"netherrealm_end",toluaI_get_util_netherrealm_end,toluaI_set_util_netherrealm_end);
+ tolua_globalvar(tolua_S,"valinor_wpos_x",toluaI_get_util_valinor_wpos_x,toluaI_set_util_valinor_wpos_x);
+ tolua_globalvar(tolua_S,"valinor_wpos_y",toluaI_get_util_valinor_wpos_y,toluaI_set_util_valinor_wpos_y);
+ tolua_globalvar(tolua_S,"valinor_wpos_z",toluaI_get_util_valinor_wpos_z,toluaI_set_util_valinor_wpos_z);
+ tolua_function(tolua_S,NULL,"fix_max_depth_towerdungeon",toluaI_util_fix_max_depth_towerdungeon00);
+ tolua_globalvar(tolua_S,"__audio_sfx_max",toluaI_get_util___audio_sfx_max,toluaI_set_util___audio_sfx_max);
+ tolua_globalvar(tolua_S,"__audio_mus_max",toluaI_get_util___audio_mus_max,toluaI_set_util___audio_mus_max);
+ tolua_globalvar(tolua_S,"allow_similar_names",toluaI_get_util_allow_similar_names,toluaI_set_util_allow_similar_names);
+ tolua_globalvar(tolua_S,"pvp_disabled",toluaI_get_util_pvp_disabled,toluaI_set_util_pvp_disabled);
+ tolua_cclass(tolua_S,"monster_type","");
+ tolua_tablevar(tolua_S,"monster_type","r_ptr",toluaI_get_util_monster_type_r_ptr,toluaI_set_util_monster_type_r_ptr);
+ tolua_tablevar(tolua_S,"monster_type","special",toluaI_get_util_monster_type_special,toluaI_set_util_monster_type_special);
+ tolua_tablevar(tolua_S,"monster_type","pet",toluaI_get_util_monster_type_pet,toluaI_set_util_monster_type_pet);
+ tolua_tablevar(tolua_S,"monster_type","r_idx",toluaI_get_util_monster_type_r_idx,toluaI_set_util_monster_type_r_idx);
+ tolua_tablevar(tolua_S,"monster_type","owner",toluaI_get_util_monster_type_owner,toluaI_set_util_monster_type_owner);
+ tolua_tablevar(tolua_S,"monster_type","related",toluaI_get_util_monster_type_related,toluaI_set_util_monster_type_related);
+ tolua_tablevar(tolua_S,"monster_type","related_type",toluaI_get_util_monster_type_related_type,toluaI_set_util_monster_type_related_type);
+ tolua_tablevar(tolua_S,"monster_type","fy",toluaI_get_util_monster_type_fy,toluaI_set_util_monster_type_fy);
+ tolua_tablevar(tolua_S,"monster_type","fx",toluaI_get_util_monster_type_fx,toluaI_set_util_monster_type_fx);
+ tolua_tablevar(tolua_S,"monster_type","wpos",toluaI_get_util_monster_type_wpos,toluaI_set_util_monster_type_wpos);
+ tolua_tablevar(tolua_S,"monster_type","exp",toluaI_get_util_monster_type_exp,toluaI_set_util_monster_type_exp);
+ tolua_tablevar(tolua_S,"monster_type","level",toluaI_get_util_monster_type_level,toluaI_set_util_monster_type_level);
+ tolua_tablevar(tolua_S,"monster_type","hold_o_idx",toluaI_get_util_monster_type_hold_o_idx,toluaI_set_util_monster_type_hold_o_idx);
+ tolua_tablevar(tolua_S,"monster_type","cdis",toluaI_get_util_monster_type_cdis,toluaI_set_util_monster_type_cdis);
+ tolua_tablevar(tolua_S,"monster_type","closest_player",toluaI_get_util_monster_type_closest_player,toluaI_set_util_monster_type_closest_player);
+ tolua_tablevar(tolua_S,"monster_type","clone",toluaI_get_util_monster_type_clone,toluaI_set_util_monster_type_clone);
+ tolua_tablevar(tolua_S,"monster_type","clone_summoning",toluaI_get_util_monster_type_clone_summoning,toluaI_set_util_monster_type_clone_summoning);
+ tolua_tablevar(tolua_S,"monster_type","mind",toluaI_get_util_monster_type_mind,toluaI_set_util_monster_type_mind);
+ tolua_tablevar(tolua_S,"monster_type","ego",toluaI_get_util_monster_type_ego,toluaI_set_util_monster_type_ego);
+ tolua_tablevar(tolua_S,"monster_type","name3",toluaI_get_util_monster_type_name3,toluaI_set_util_monster_type_name3);
+ tolua_tablevar(tolua_S,"monster_type","status",toluaI_get_util_monster_type_status,toluaI_set_util_monster_type_status);
+ tolua_tablevar(tolua_S,"monster_type","target",toluaI_get_util_monster_type_target,toluaI_set_util_monster_type_target);
+ tolua_tablevar(tolua_S,"monster_type","backstabbed",toluaI_get_util_monster_type_backstabbed,toluaI_set_util_monster_type_backstabbed);
+ tolua_tablevar(tolua_S,"monster_type","henc",toluaI_get_util_monster_type_henc,toluaI_set_util_monster_type_henc);
+ tolua_tablevar(tolua_S,"monster_type","henc_top",toluaI_get_util_monster_type_henc_top,toluaI_set_util_monster_type_henc_top);
+ tolua_tablevar(tolua_S,"monster_type","astar_idx",toluaI_get_util_monster_type_astar_idx,toluaI_set_util_monster_type_astar_idx);
+ tolua_tablevar(tolua_S,"monster_type","quest",toluaI_get_util_monster_type_quest,toluaI_set_util_monster_type_quest);
+ tolua_tablevar(tolua_S,"monster_type","questor_idx",toluaI_get_util_monster_type_questor_idx,toluaI_set_util_monster_type_questor_idx);
+ tolua_tablevar(tolua_S,"monster_type","questor",toluaI_get_util_monster_type_questor,toluaI_set_util_monster_type_questor);
+ tolua_tablevar(tolua_S,"monster_type","questor_invincible",toluaI_get_util_monster_type_questor_invincible,toluaI_set_util_monster_type_questor_invincible);
+ tolua_tablevar(tolua_S,"monster_type","questor_hostile",toluaI_get_util_monster_type_questor_hostile,toluaI_set_util_monster_type_questor_hostile);
+ tolua_tablevar(tolua_S,"monster_type","questor_target",toluaI_get_util_monster_type_questor_target,toluaI_set_util_monster_type_questor_target);
+ tolua_globalvar(tolua_S,"o_nxt",toluaI_get_util_o_nxt,toluaI_set_util_o_nxt);
+ tolua_globalvar(tolua_S,"o_max",toluaI_get_util_o_max,toluaI_set_util_o_max);
+ tolua_globalvar(tolua_S,"o_top",toluaI_get_util_o_top,toluaI_set_util_o_top);
+ tolua_globalvar(tolua_S,"m_nxt",toluaI_get_util_m_nxt,toluaI_set_util_m_nxt);
+ tolua_globalvar(tolua_S,"m_max",toluaI_get_util_m_max,toluaI_set_util_m_max);
+ tolua_globalvar(tolua_S,"m_top",toluaI_get_util_m_top,toluaI_set_util_m_top);
+ tolua_globalarray(tolua_S,"o_list",toluaI_get_util_o_list,toluaI_set_util_o_list);
+ tolua_globalarray(tolua_S,"m_list",toluaI_get_util_m_list,toluaI_set_util_m_list);
+ tolua_function(tolua_S,NULL,"verify_expfact",toluaI_util_verify_expfact00);
+ tolua_function(tolua_S,NULL,"loadmap",toluaI_util_loadmap00);
+ tolua_globalvar(tolua_S,"restart_panic",toluaI_get_util_restart_panic,toluaI_set_util_restart_panic);
+ tolua_globalvar(tolua_S,"restart_unstatice_bree",toluaI_get_util_restart_unstatice_bree,toluaI_set_util_restart_unstatice_bree);
+ tolua_globalvar(tolua_S,"restart_unstatice_towns",toluaI_get_util_restart_unstatice_towns,toluaI_set_util_restart_unstatice_towns);
+ tolua_globalvar(tolua_S,"restart_unstatice_surface",toluaI_get_util_restart_unstatice_surface,toluaI_set_util_restart_unstatice_surface);
+ tolua_globalvar(tolua_S,"restart_unstatice_dungeons",toluaI_get_util_restart_unstatice_dungeons,toluaI_set_util_restart_unstatice_dungeons);
+ tolua_globalvar(tolua_S,"sflags0",toluaI_get_util_sflags0,toluaI_set_util_sflags0);
+ tolua_globalvar(tolua_S,"sflags1",toluaI_get_util_sflags1,toluaI_set_util_sflags1);
+ tolua_globalvar(tolua_S,"sflags2",toluaI_get_util_sflags2,toluaI_set_util_sflags2);
+ tolua_globalvar(tolua_S,"sflags3",toluaI_get_util_sflags3,toluaI_set_util_sflags3);
+ tolua_globalvar(tolua_S,"sflags_TEMP",toluaI_get_util_sflags_TEMP,toluaI_set_util_sflags_TEMP);
+ tolua_globalarray(tolua_S,"custom_lua_timer_timeout",toluaI_get_util_custom_lua_timer_timeout,toluaI_set_util_custom_lua_timer_timeout);
+ tolua_globalarray(tolua_S,"custom_lua_timer_parm1",toluaI_get_util_custom_lua_timer_parm1,toluaI_set_util_custom_lua_timer_parm1);
+ tolua_globalarray(tolua_S,"custom_lua_timer_parm2",toluaI_get_util_custom_lua_timer_parm2,toluaI_set_util_custom_lua_timer_parm2);
+ tolua_globalarray(tolua_S,"custom_lua_timer_parm3",toluaI_get_util_custom_lua_timer_parm3,toluaI_set_util_custom_lua_timer_parm3);
+ tolua_function(tolua_S,NULL,"custom_lua_timer_parmstr_get",toluaI_util_custom_lua_timer_parmstr_get00);
+ tolua_function(tolua_S,NULL,"custom_lua_timer_parmstr_set",toluaI_util_custom_lua_timer_parmstr_set00);
+ tolua_globalvar(tolua_S,"debug_drain_hp",toluaI_get_util_debug_drain_hp,toluaI_set_util_debug_drain_hp);
+ tolua_globalvar(tolua_S,"debug_drain_mp",toluaI_get_util_debug_drain_mp,toluaI_set_util_debug_drain_mp);
+ return 1;
+}
+/* Close function */
+void tolua_util_close (lua_State* tolua_S)
+{
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"USE_EQUIP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"USE_INVEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"USE_SUBINVEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"EXCLUDE_SUBINVEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CAPS_ALT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"BASE_PALETTE_SIZE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"CLIENT_PALETTE_SIZE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_DARK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_WHITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SLATE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ORANGE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_RED");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_GREEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_BLUE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_UMBER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_L_DARK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_L_WHITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_VIOLET");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_YELLOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_L_RED");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_L_GREEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_L_BLUE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_L_UMBER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_MULTI");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_POIS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_FIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_COLD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ACID");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ELEC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_CONF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SOUN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SHAR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_LITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_DARKNESS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SHIELDM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SHIELDM_LOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SHIELDI");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_CURSE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ANNI");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_HALF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_OLD_BNW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_OLD_PVP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_PSI");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_NEXU");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_NETH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_DISE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_INER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_FORC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_GRAV");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_TIME");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_METEOR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_MANA");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_DISI");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_WATE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ICE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_PLAS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_DETO");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_NUKE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_UNBREATH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_HOLYORB");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_HOLYFIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_HELLFIRE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_THUNDER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_LAMP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_LAMP_DARK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_EMBER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_STARLITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_HAVOC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SELECTOR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SMOOTHPAL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SEL_RED");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SEL_BLUE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SRCLITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_OFFSET");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_DARK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_WHITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_SLATE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_ORANGE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_RED");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_GREEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_BLUE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_UMBER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_L_DARK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_L_WHITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_VIOLET");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_YELLOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_L_RED");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_L_GREEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_L_BLUE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMA_L_UMBER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ANIM_WATER_EAST");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ANIM_WATER_WEST");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ANIM_WATER_NORTH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ANIM_WATER_SOUTH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ANIM_LAVA_EAST");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ANIM_LAVA_WEST");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ANIM_LAVA_NORTH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_ANIM_LAVA_SOUTH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_BNW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_BNWM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_BNWSR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_BNWKS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_BNWKS2");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_PVPBB");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_PVP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_RESERVED");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_HILITE_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_OLD2_BNW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_OLD2_PVP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_OLD3_BNW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_OLD3_BNWM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_OLD3_BNWSR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_OLD3_BNWKS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_OLD3_BNWKS2");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_OLD3_PVPBB");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_OLD3_PVP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_RESERVED_RLE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERM_SEL_GREEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMX_START");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMX_AMT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMX_BLUE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMX_GREEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMX_RED");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMX_YELLOW");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMX_GREY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMX_WHITE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TERMX_PURPLE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_MONSTER_DEATH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_OPEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_GEN_QUEST");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_END_TURN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_FEELING");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_NEW_MONSTER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_GEN_LEVEL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_BUILD_ROOM1");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_NEW_LEVEL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_QUEST_FINISH");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_QUEST_FAIL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_GIVE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_CHAR_DUMP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_INIT_QUEST");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_WILD_GEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_DROP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_IDENTIFY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_MOVE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_STAIR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_MONSTER_AI");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_PLAYER_LEVEL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_WIELD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_INIT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_QUAFF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_AIM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_USE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_ACTIVATE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_ZAP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_READ");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_CALC_BONUS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_PLAYER_FLAGS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_KEYPRESS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_CHAT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_MON_SPEAK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_MKEY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_BIRTH_OBJECTS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_ACTIVATE_DESC");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_INIT_GAME");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_ACTIVATE_POWER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_ITEM_NAME");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_SAVE_GAME");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_LOAD_GAME");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_LEVEL_REGEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_LEVEL_END_GEN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_BUILDING_ACTION");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_PROCESS_WORLD");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_WIELD_SLOT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_STORE_STOCK");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_STORE_BUY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_GEN_LEVEL_BEGIN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_GET");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"HOOK_NPCTEST");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"MAX_HOOKS");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_JUMP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_BEAM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_THRU");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_STOP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_GRID");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_ITEM");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_KILL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_HIDE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_STAY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_SELF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_DUMY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_GRAV");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_PLAY");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_NORF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_FULL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_EVSG");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_NODO");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_LODF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_NODF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_RNAF");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_STAR");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECT_TRAP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECTOR_UNUSUAL");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECTOR_TRAP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECTOR_POTION");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECTOR_TERRAIN");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECTOR_MON_TRAP");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECTOR_EFFECT");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECTOR_PLAYER");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"PROJECTOR_RUNE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"TRUE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"FALSE");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"hash_entry");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lookup_player");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lookup_player_id");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lookup_player_id_messy");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"server_opts");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"turn"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"session_turn"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"turn_overflow"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"cfg"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"player_exp");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"seed_flavor"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"seed_town"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"seed_wild_extra"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"mod");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"band");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"bor");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"bxor");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"bshl");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"bshr");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"bnot");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"pern_dofile");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"exec_lua");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"cat_script");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"msg_print");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"msg_broadcast");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"msg_print_near");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"msg_admins");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"level_speed");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"remote_update_lua");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"wipe_hooks");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"dump_hooks");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"add_hook");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"dungeon_store_timer"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"dungeon_store2_timer"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"great_pumpkin_timer"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"great_pumpkin_killer1");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"great_pumpkin_killer2");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"great_pumpkin_duration"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"santa_claus_timer"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"night_surface"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_s_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_r_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_rur_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_re_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_k_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_v_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_f_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_a_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_e_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_d_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_o_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_m_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_tr_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_st_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_ow_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_q_idx"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"global_luck"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_intrusion");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"sST"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"watch_morgoth"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"watch_cp"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"watch_nr"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"watch_df"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"regen_boost_stamina"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"updated_savegame_birth"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"updated_server"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"runtime_server"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"artifact_reset"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"artifact_type");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"a_info");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"monster_race");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"r_info");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"sector000separation"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"ge_special_sector"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"ge_contender_buffer_ID");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"ge_contender_buffer_deed");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"party_type");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"parties");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"guild_type");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"guilds");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_season_change");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lively_wild");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"season"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"weather"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"weather_duration"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"weather_frequency"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"wind_gust"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"wind_gust_delay"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"clouds"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"max_clouds_seasonal"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"season_halloween"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"season_xmas"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"season_newyearseve"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"handle_seasonal_music");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"fireworks"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"fireworks_delay"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"firework_dungeon"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"firework_dungeon_chance"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"ANGBAND_DIR"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"timer_pvparena1"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"timer_pvparena2"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"timer_falling_star"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"Send_weather");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"timed_shutdown");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"geno_towns");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"go_game_up"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"go_wait_for_sgf"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"go_engine_player_id"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"go_engine_init");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"go_engine_terminate");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"go_challenge_cancel");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"numtowns"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"quark__num"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"swear_add");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"swear_get_word");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"swear_get_level");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"nonswear_add");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"nonswear_get");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"nonswear_affix_get");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"init_swearing");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_swear_list");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"lua_nonswear_list");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"scan_iddc");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"dungeon_visit_frequency");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"dungeon_bonus");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"dungeon_id_max"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"jails_enabled"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"allow_requesting_estate"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"netherrealm_wpos_x"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"netherrealm_wpos_y"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"netherrealm_wpos_z"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"netherrealm_start"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"netherrealm_end"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"valinor_wpos_x"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"valinor_wpos_y"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"valinor_wpos_z"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"fix_max_depth_towerdungeon");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__audio_sfx_max"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"__audio_mus_max"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"allow_similar_names"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"pvp_disabled"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"monster_type");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"o_nxt"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"o_max"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"o_top"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"m_nxt"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"m_max"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"m_top"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"o_list");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"m_list");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"verify_expfact");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"loadmap");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"restart_panic"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"restart_unstatice_bree"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"restart_unstatice_towns"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"restart_unstatice_surface"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"restart_unstatice_dungeons"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"sflags0"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"sflags1"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"sflags2"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"sflags3"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"sflags_TEMP"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"custom_lua_timer_timeout");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"custom_lua_timer_parm1");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"custom_lua_timer_parm2");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"custom_lua_timer_parm3");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"custom_lua_timer_parmstr_get");
+ lua_pushnil(tolua_S); lua_setglobal(tolua_S,"custom_lua_timer_parmstr_set");
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"debug_drain_hp"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+ lua_getglobals(tolua_S);
+ lua_pushstring(tolua_S,"debug_drain_mp"); lua_pushnil(tolua_S); lua_rawset(tolua_S,-3);
+ lua_pop(tolua_S,1);
+}
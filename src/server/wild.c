@@ -243,7 +243,11 @@ void deltown(int Ind) {
 		    y <= wpos->wy + wild_info[wpos->wy][wpos->wx].radius; y++)
 			if (in_bounds_wild(y, x) && (towndist(x, y, &tlev) <= abs(wpos->wx - x) + abs(wpos->wy - y))) {
 				tpos.wx = x; tpos.wy = y; tpos.wz = 0;
+#ifdef HOUSE_INDEX
+				for (i = house_first_at(&tpos); i != -1; i = house_next_at(i))
+#else
 				for (i = 0; i < num_houses; i++)
+#endif
 					if (inarea(&tpos, &houses[i].wpos)) {
 //#if 0
 						fill_house(&houses[i], FILL_MAKEHOUSE, NULL);
@@ -739,6 +743,20 @@ static bool wild_monst_aux_mountain(int r_idx) {
 	return(FALSE);
 }
 
+/* Number the hooks above (which only look at the monster race) for get_mon_num()'s cache, 0 if 'hook' isn't one of them */
+int wild_monst_hook_id(bool (*hook)(int r_idx)) {
+	static bool (*hooks[])(int r_idx) = {
+		wild_monst_aux_town, wild_monst_aux_lake, wild_monst_aux_river, wild_monst_aux_grassland,
+		wild_monst_aux_forest, wild_monst_aux_swamp, wild_monst_aux_denseforest, wild_monst_aux_wasteland,
+		wild_monst_aux_desert, wild_monst_aux_ice, wild_monst_aux_ocean, wild_monst_aux_oceanbed,
+		wild_monst_aux_shore, wild_monst_aux_volcano, wild_monst_aux_mountain, NULL };
+	int i;
+
+	for (i = 0; hooks[i]; i++)
+		if (hooks[i] == hook) return(i + 1);
+	return(0);
+}
+
 void set_mon_num_hook_wild(struct worldpos *wpos) {
 	switch (wild_info[wpos->wy][wpos->wx].type) {
 	case WILD_OCEANBED1: case WILD_OCEANBED2: get_mon_num_hook = wild_monst_aux_oceanbed; break;
@@ -1924,6 +1942,9 @@ static void wild_add_dwelling(struct worldpos *wpos, int x, int y) {
 #endif	// USE_MANG_HOUSE_ONLY
 
 			h_idx = num_houses;
+#ifdef HOUSE_INDEX
+			house_index_add(num_houses);
+#endif
 			num_houses++;
 			if ((house_alloc - num_houses) < 32) {
 				GROW(houses, house_alloc, house_alloc + 512, house_type);
@@ -3588,7 +3609,11 @@ void wild_add_uhouse(house_type *h_ptr) {
 void wild_add_uhouses(struct worldpos *wpos) {
 	int i;
 
+#ifdef HOUSE_INDEX
+	for (i = house_first_at(wpos); i != -1; i = house_next_at(i)) {
+#else
 	for (i = 0; i < num_houses; i++) {
+#endif
 		if (inarea(&houses[i].wpos, wpos) && !(houses[i].flags & HF_STOCK))
 			wild_add_uhouse(&houses[i]);
 	}
@@ -4185,6 +4210,9 @@ void wilderness_gen(struct worldpos *wpos) {
 
 	/* set all those flags */
 	w_ptr->flags |= WILD_F_INVADERS | WILD_F_HOME_OWNERS | WILD_F_BONES | WILD_F_FOOD | WILD_F_OBJECTS | WILD_F_CASH | WILD_F_GARDENS;
+
+	/* Also called on already allocated sectors, eg by quests */
+	bump_feat_epoch(wpos);
 }
 
 
@@ -5165,6 +5193,7 @@ void wpos_apply_season_daytime(worldpos *wpos, cave_type **zcave) {
 				if (feat_is_shal_water(c_ptr->feat)) c_ptr->feat = FEAT_ICE;
 			}
 	}
+	bump_feat_epoch(wpos);
 
 	/* apply nightly darkening or daylight */
 	if (!wpos->wz || (d_ptr && (d_ptr->flags3 & DF3_OUTDOORS))) {
@@ -15,6 +15,11 @@
 
 #include "angband.h"
 
+/* For gettimeofday() */
+#include <sys/time.h>
+/* For offsetof() */
+#include <stddef.h>
+
 
 /* Mage staves count as 'blunt' weapons (instead of not using any mastery skill at all)
    and thereby use Blunt-Mastery skill?
@@ -3094,6 +3099,269 @@ int calc_crit_obj(object_type *o_ptr) {
 }
 
 
+/* calc_boni() statistics, see /boni */
+u32b boni_calls = 0;
+u64b boni_usecs = 0;
+time_t boni_since = 0;
+
+#ifdef BONI_SLOT_CACHE
+bool boni_slot_cache_enabled = TRUE;
+bool boni_slot_check = FALSE;	/* Debug: verify every cache hit against a fresh extraction and every calc_boni() against an uncached one */
+u32b boni_slot_serial = 1;
+u32b boni_slot_hits = 0, boni_slot_misses = 0, boni_slot_mismatches = 0;
+
+/* Forget all equipment slot records, eg after k_info/e_info/a_info got reloaded */
+void boni_slot_flush(void) {
+	if (!++boni_slot_serial) boni_slot_serial = 1;
+}
+
+/* Extract everything calc_boni() needs to know about the flags of an item.
+   Note that object_flags(), ego_make() and randart_make() may adjust the item. */
+static void boni_slot_make(object_type *o_ptr, boni_slot *b) {
+	artifact_type *a_ptr;
+
+	object_flags(o_ptr, &b->f1, &b->f2, &b->f3, &b->f4, &b->f5, &b->f6, &b->esp);
+
+	b->ego_f1 = b->ego_f5 = b->art_f1 = b->art_f5 = 0x0;
+	if (o_ptr->name2) {
+		a_ptr = ego_make(o_ptr);
+		b->ego_f1 = a_ptr->flags1;
+		b->ego_f5 = a_ptr->flags5;
+	}
+	if (o_ptr->name1 == ART_RANDART) {
+		if ((a_ptr = randart_make(o_ptr))) {
+			b->art_f1 = a_ptr->flags1;
+			b->art_f5 = a_ptr->flags5;
+		} else b->art_f1 = b->art_f5 = 0xFFFFFFFF; /* clear nothing */
+	}
+
+	b->obj = *o_ptr;
+	b->serial = boni_slot_serial;
+}
+
+static bool boni_slot_differs(boni_slot *a, boni_slot *b) {
+	return(a->f1 != b->f1 || a->f2 != b->f2 || a->f3 != b->f3 || a->f4 != b->f4 ||
+	    a->f5 != b->f5 || a->f6 != b->f6 || a->esp != b->esp ||
+	    a->ego_f1 != b->ego_f1 || a->ego_f5 != b->ego_f5 ||
+	    a->art_f1 != b->art_f1 || a->art_f5 != b->art_f5);
+}
+
+/* The record of an equipment slot, rebuilt if the item in it changed in any way.
+   Regenerating ego powers and randarts from their seeds is what makes the
+   equipment part of calc_boni() expensive, while the items rarely change. */
+static boni_slot *calc_boni_slot(player_type *p_ptr, int slot) {
+	object_type *o_ptr = &p_ptr->inventory[slot];
+	boni_slot *b = &p_ptr->boni_slots[slot - INVEN_WIELD], fresh;
+
+	if (!boni_slot_cache_enabled) {
+		boni_slot_make(o_ptr, b);
+		return(b);
+	}
+
+	if (b->serial == boni_slot_serial && !memcmp(&b->obj, o_ptr, sizeof(object_type))) {
+		boni_slot_hits++;
+		if (!boni_slot_check) return(b);
+
+		boni_slot_make(o_ptr, &fresh);
+		if (boni_slot_differs(b, &fresh)) {
+			boni_slot_mismatches++;
+			s_printf("BONI_SLOT_MISMATCH: %s slot %d (%d,%d) f1 %08x/%08x f3 %08x/%08x f5 %08x/%08x\n",
+			    p_ptr->name, slot, o_ptr->tval, o_ptr->sval, b->f1, fresh.f1, b->f3, fresh.f3, b->f5, fresh.f5);
+			*b = fresh;
+		}
+		return(b);
+	}
+
+	boni_slot_misses++;
+	boni_slot_make(o_ptr, b);
+	return(b);
+}
+#endif
+
+/* object_flags() of an equipped item */
+static void equip_flags(player_type *p_ptr, int slot, u32b *f1, u32b *f2, u32b *f3, u32b *f4, u32b *f5, u32b *f6, u32b *esp) {
+#ifdef BONI_SLOT_CACHE
+	boni_slot *b = calc_boni_slot(p_ptr, slot);
+
+	*f1 = b->f1; *f2 = b->f2; *f3 = b->f3; *f4 = b->f4; *f5 = b->f5; *f6 = b->f6; *esp = b->esp;
+#else
+	object_flags(&p_ptr->inventory[slot], f1, f2, f3, f4, f5, f6, esp);
+#endif
+}
+
+/* flags1/flags5 of an equipped item's ego power or randart, for clearing out the
+   pval flags of the base item it doesn't have */
+static void equip_pval_flags(player_type *p_ptr, int slot, bool randart, u32b *g1, u32b *g5) {
+#ifdef BONI_SLOT_CACHE
+	boni_slot *b = calc_boni_slot(p_ptr, slot);
+
+	if (randart) {
+		*g1 = b->art_f1;
+		*g5 = b->art_f5;
+	} else {
+		*g1 = b->ego_f1;
+		*g5 = b->ego_f5;
+	}
+#else
+	object_type *o_ptr = &p_ptr->inventory[slot];
+	artifact_type *a_ptr = randart ? randart_make(o_ptr) : ego_make(o_ptr);
+
+	*g1 = a_ptr->flags1;
+	*g5 = a_ptr->flags5;
+#endif
+}
+
+static void calc_boni_aux(int Ind);
+
+#ifdef BONI_SLOT_CACHE
+/* What calc_boni() derives for a player, compared by boni_check_pass() */
+#define BONI_FIELD(f)	{ #f, offsetof(player_type, f), sizeof(((player_type *)0)->f) }
+static struct {
+	cptr name;
+	size_t offset, size;
+} boni_fields[] = {
+	BONI_FIELD(stat_use), BONI_FIELD(stat_top), BONI_FIELD(stat_add), BONI_FIELD(stat_tmp), BONI_FIELD(stat_ind),
+	BONI_FIELD(immune_acid), BONI_FIELD(immune_elec), BONI_FIELD(immune_fire), BONI_FIELD(immune_cold),
+	BONI_FIELD(immune_poison), BONI_FIELD(immune_water), BONI_FIELD(immune_neth),
+	BONI_FIELD(reduc_fire), BONI_FIELD(reduc_elec), BONI_FIELD(reduc_acid), BONI_FIELD(reduc_cold),
+	BONI_FIELD(resist_acid), BONI_FIELD(resist_elec), BONI_FIELD(resist_fire), BONI_FIELD(resist_cold),
+	BONI_FIELD(resist_pois), BONI_FIELD(resist_conf), BONI_FIELD(resist_sound), BONI_FIELD(resist_lite),
+	BONI_FIELD(resist_dark), BONI_FIELD(resist_chaos), BONI_FIELD(resist_disen), BONI_FIELD(resist_discharge),
+	BONI_FIELD(resist_shard), BONI_FIELD(resist_nexus), BONI_FIELD(resist_blind), BONI_FIELD(resist_neth),
+	BONI_FIELD(resist_fear), BONI_FIELD(resist_time), BONI_FIELD(resist_mana), BONI_FIELD(resist_water),
+	BONI_FIELD(sustain_str), BONI_FIELD(sustain_int), BONI_FIELD(sustain_wis), BONI_FIELD(sustain_dex),
+	BONI_FIELD(sustain_con), BONI_FIELD(sustain_chr),
+	BONI_FIELD(aggravate), BONI_FIELD(teleport), BONI_FIELD(feather_fall), BONI_FIELD(lite), BONI_FIELD(cur_lite),
+	BONI_FIELD(free_act), BONI_FIELD(see_inv), BONI_FIELD(regenerate), BONI_FIELD(regen_mana),
+	BONI_FIELD(keep_life), BONI_FIELD(hold_life), BONI_FIELD(telepathy), BONI_FIELD(slow_digest),
+	BONI_FIELD(blessed_weapon), BONI_FIELD(xtra_might), BONI_FIELD(impact), BONI_FIELD(auto_id),
+	BONI_FIELD(reduce_insanity), BONI_FIELD(invis), BONI_FIELD(levitate), BONI_FIELD(can_swim), BONI_FIELD(climb),
+	BONI_FIELD(pass_trees), BONI_FIELD(reflect), BONI_FIELD(no_cut), BONI_FIELD(anti_tele), BONI_FIELD(res_tele),
+	BONI_FIELD(anti_magic), BONI_FIELD(antimagic), BONI_FIELD(antimagic_dis), BONI_FIELD(xtra_crit),
+	BONI_FIELD(dodge_level), BONI_FIELD(shield_deflect), BONI_FIELD(weapon_parry), BONI_FIELD(luck),
+	BONI_FIELD(sh_fire), BONI_FIELD(sh_elec), BONI_FIELD(sh_cold), BONI_FIELD(drain_exp), BONI_FIELD(drain_mana),
+	BONI_FIELD(drain_life), BONI_FIELD(slay), BONI_FIELD(slay_melee), BONI_FIELD(slay_equip),
+	BONI_FIELD(vampiric_melee), BONI_FIELD(vampiric_ranged), BONI_FIELD(ty_curse), BONI_FIELD(dg_curse),
+	BONI_FIELD(dis_to_h), BONI_FIELD(dis_to_d), BONI_FIELD(dis_to_h_ranged), BONI_FIELD(dis_to_d_ranged),
+	BONI_FIELD(dis_to_a), BONI_FIELD(dis_ac), BONI_FIELD(to_h), BONI_FIELD(to_d), BONI_FIELD(to_h_melee),
+	BONI_FIELD(to_d_melee), BONI_FIELD(to_h_ranged), BONI_FIELD(to_d_ranged), BONI_FIELD(to_a),
+	BONI_FIELD(to_h_thrown), BONI_FIELD(unknown_ac), BONI_FIELD(ac), BONI_FIELD(to_m), BONI_FIELD(to_l),
+	BONI_FIELD(to_hp), BONI_FIELD(see_infra), BONI_FIELD(skill_dis), BONI_FIELD(skill_dev), BONI_FIELD(skill_sav),
+	BONI_FIELD(skill_stl), BONI_FIELD(skill_srh), BONI_FIELD(skill_fos), BONI_FIELD(skill_thn),
+	BONI_FIELD(skill_thb), BONI_FIELD(skill_tht), BONI_FIELD(skill_dig), BONI_FIELD(num_blow),
+	BONI_FIELD(extra_blows), BONI_FIELD(num_fire), BONI_FIELD(num_spell), BONI_FIELD(tval_xtra),
+	BONI_FIELD(tval_ammo), BONI_FIELD(pspeed), BONI_FIELD(dual_wield), BONI_FIELD(stormbringer),
+	{ NULL, 0, 0 },
+};
+u32b boni_pass_checks = 0, boni_pass_mismatches = 0;
+
+/* Debug: redo a calc_boni() that used the slot cache without it and compare the outcome.
+   Runs calc_boni() a second time, so the client gets everything sent twice. */
+static void boni_check_pass(int Ind) {
+	static player_type *cached = NULL;
+	player_type *p_ptr = Players[Ind];
+	int i;
+	bool differs = FALSE;
+
+	if (!cached) MAKE(cached, player_type);
+	*cached = *p_ptr;
+
+	boni_slot_cache_enabled = FALSE;
+	calc_boni_aux(Ind);
+	boni_slot_cache_enabled = TRUE;
+
+	boni_pass_checks++;
+	for (i = 0; boni_fields[i].name; i++) {
+		if (!memcmp((char *)cached + boni_fields[i].offset, (char *)p_ptr + boni_fields[i].offset, boni_fields[i].size)) continue;
+		s_printf("BONI_PASS_MISMATCH: %s %s\n", p_ptr->name, boni_fields[i].name);
+		differs = TRUE;
+	}
+	if (differs) boni_pass_mismatches++;
+}
+#endif
+
+/* Keep track of how often calc_boni() runs and how long it takes */
+void calc_boni(int Ind) {
+	struct timeval tv0, tv1;
+
+	gettimeofday(&tv0, NULL);
+	calc_boni_aux(Ind);
+	gettimeofday(&tv1, NULL);
+
+	boni_calls++;
+	boni_usecs += (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+	if (!boni_since) boni_since = time(NULL);
+
+#ifdef BONI_SLOT_CACHE
+	if (boni_slot_check && boni_slot_cache_enabled) boni_check_pass(Ind);
+#endif
+}
+
+void boni_reset(void) {
+	boni_calls = 0;
+	boni_usecs = 0;
+	boni_since = time(NULL);
+#ifdef BONI_SLOT_CACHE
+	boni_slot_hits = boni_slot_misses = boni_slot_mismatches = 0;
+	boni_pass_checks = boni_pass_mismatches = 0;
+#endif
+}
+
+void boni_report(int Ind) {
+	long secs = boni_since ? (long)(time(NULL) - boni_since) : 0;
+
+	msg_format(Ind, "calc_boni(): %u calls in %lds (%ld/s), %lu us avg.",
+	    boni_calls, secs, secs ? (long)(boni_calls / secs) : 0L,
+	    boni_calls ? (unsigned long)(boni_usecs / boni_calls) : 0UL);
+#ifdef BONI_SLOT_CACHE
+	msg_format(Ind, "Slot cache %s%s: %u hits, %u misses, %u mismatches.",
+	    boni_slot_cache_enabled ? "on" : "off", boni_slot_check ? " (checking)" : "",
+	    boni_slot_hits, boni_slot_misses, boni_slot_mismatches);
+	if (boni_pass_checks) msg_format(Ind, "Uncached cross-check: %u calls, %u differed.", boni_pass_checks, boni_pass_mismatches);
+#endif
+}
+
+#ifdef BONI_SLOT_CACHE
+/* Time the equipment part of calc_boni() for the admin's own equipment,
+   extracting the flags from scratch vs using the slot records. Doesn't call
+   calc_boni() itself as that would resend the character sheet each time. */
+void boni_bench(int Ind, int count) {
+	player_type *p_ptr = Players[Ind];
+	struct timeval tv0, tv1;
+	u32b hits = boni_slot_hits, misses = boni_slot_misses;
+	long t_fresh, t_cached;
+	int n, i, slots = 0;
+	boni_slot tmp;
+
+	for (i = INVEN_WIELD; i < INVEN_TOTAL; i++)
+		if (p_ptr->inventory[i].k_idx) slots++;
+	if (!slots) {
+		msg_print(Ind, "You have nothing equipped.");
+		return;
+	}
+
+	gettimeofday(&tv0, NULL);
+	for (n = 0; n < count; n++)
+		for (i = INVEN_WIELD; i < INVEN_TOTAL; i++)
+			if (p_ptr->inventory[i].k_idx) boni_slot_make(&p_ptr->inventory[i], &tmp);
+	gettimeofday(&tv1, NULL);
+	t_fresh = (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+
+	gettimeofday(&tv0, NULL);
+	for (n = 0; n < count; n++)
+		for (i = INVEN_WIELD; i < INVEN_TOTAL; i++)
+			if (p_ptr->inventory[i].k_idx) (void)calc_boni_slot(p_ptr, i);
+	gettimeofday(&tv1, NULL);
+	t_cached = (tv1.tv_sec - tv0.tv_sec) * 1000000 + (tv1.tv_usec - tv0.tv_usec);
+
+	boni_slot_hits = hits;
+	boni_slot_misses = misses;
+
+	msg_format(Ind, "%d x %d slots: fresh %ld us (%ld ns/call), cached %ld us (%ld ns/call).",
+	    count, slots, t_fresh, (t_fresh * 1000) / count, t_cached, (t_cached * 1000) / count);
+}
+#endif
+
 /*
  * Calculate the players current "state", taking into account
  * not only race/class intrinsics, but also objects being worn
@@ -3114,7 +3382,7 @@ int calc_crit_obj(object_type *o_ptr) {
  *
  * This function induces various "status" messages.
  */
-void calc_boni(int Ind) {
+static void calc_boni_aux(int Ind) {
 #ifdef TOGGLE_TELE
 	cptr inscription = NULL;
 #endif
@@ -4186,7 +4454,7 @@ void calc_boni(int Ind) {
 		p_ptr->total_weight += o_ptr->weight * o_ptr->number;
 
 		/* Extract the item flags */
-		object_flags(o_ptr, &f1, &f2, &f3, &f4, &f5, &f6, &esp);
+		equip_flags(p_ptr, i, &f1, &f2, &f3, &f4, &f5, &f6, &esp);
 
 		/* Note cursed/hidden status... */
 		if ((f3 & TR3_CURSED) || (f3 & TR3_HEAVY_CURSE) || (f3 & TR3_PERMA_CURSE)) csheet_boni[i-INVEN_WIELD].cb[12] |= CB13_XCRSE;
@@ -4391,11 +4659,11 @@ void calc_boni(int Ind) {
 		 * bonus but not the ego bonus so we don't add them twice.
 		 */
 		if (o_ptr->name2) {
-			artifact_type *a_ptr;
+			u32b g1, g5;
 
-			a_ptr = ego_make(o_ptr);
-			f1 &= ~(k_ptr->flags1 & TR1_PVAL_MASK & ~a_ptr->flags1);
-			f5 &= ~(k_ptr->flags5 & TR5_PVAL_MASK & ~a_ptr->flags5);
+			equip_pval_flags(p_ptr, i, FALSE, &g1, &g5);
+			f1 &= ~(k_ptr->flags1 & TR1_PVAL_MASK & ~g1);
+			f5 &= ~(k_ptr->flags5 & TR5_PVAL_MASK & ~g5);
 
 			/* Hack: Stormbringer! */
 			if (o_ptr->name2 == EGO_STORMBRINGER) {
@@ -4416,11 +4684,11 @@ void calc_boni(int Ind) {
 		}
 
 		if (o_ptr->name1 == ART_RANDART) {
-			artifact_type *a_ptr;
+			u32b g1, g5;
 
-			a_ptr =	randart_make(o_ptr);
-			f1 &= ~(k_ptr->flags1 & TR1_PVAL_MASK & ~a_ptr->flags1);
-			f5 &= ~(k_ptr->flags5 & TR5_PVAL_MASK & ~a_ptr->flags5);
+			equip_pval_flags(p_ptr, i, TRUE, &g1, &g5);
+			f1 &= ~(k_ptr->flags1 & TR1_PVAL_MASK & ~g1);
+			f5 &= ~(k_ptr->flags5 & TR5_PVAL_MASK & ~g5);
 		}
 
 		/* Affect stats */
@@ -6259,7 +6527,7 @@ void calc_boni(int Ind) {
 	//if (inventory[INVEN_WIELD + i].k_idx && inventory[INVEN_ARM + i].k_idx)
 	if (p_ptr->inventory[INVEN_WIELD].k_idx && p_ptr->inventory[INVEN_ARM].k_idx) {
 		/* Extract the item flags */
-		object_flags(&p_ptr->inventory[INVEN_WIELD], &f1, &f2, &f3, &f4, &f5, &f6, &esp);
+		equip_flags(p_ptr, INVEN_WIELD, &f1, &f2, &f3, &f4, &f5, &f6, &esp);
 
 		if (f4 & TR4_SHOULD2H) {
 			/* Reduce the real boni */
@@ -6287,13 +6555,13 @@ void calc_boni(int Ind) {
 #endif
 
 	if (p_ptr->inventory[INVEN_WIELD].k_idx && !p_ptr->inventory[INVEN_ARM].k_idx) {
-		object_flags(&p_ptr->inventory[INVEN_WIELD], &f1, &f2, &f3, &f4, &f5, &f6, &esp);
+		equip_flags(p_ptr, INVEN_WIELD, &f1, &f2, &f3, &f4, &f5, &f6, &esp);
 		if (f4 & TR4_COULD2H) p_ptr->easy_wield = TRUE;
 	}
 	/* for dual-wield..*/
 	if (!p_ptr->inventory[INVEN_WIELD].k_idx &&
 	    p_ptr->inventory[INVEN_ARM].k_idx && p_ptr->inventory[INVEN_ARM].tval != TV_SHIELD) {
-		object_flags(&p_ptr->inventory[INVEN_ARM], &f1, &f2, &f3, &f4, &f5, &f6, &esp);
+		equip_flags(p_ptr, INVEN_ARM, &f1, &f2, &f3, &f4, &f5, &f6, &esp);
 		if (f4 & TR4_COULD2H) p_ptr->easy_wield = TRUE;
 	}
 
@@ -7463,16 +7731,12 @@ void calc_boni(int Ind) {
 
 							/*todo: build a_ptr for ego/art powers and mask out k1/k5 pval mask from it,
 							  to get the -real- pvals (no more witans +8 stealth if +10 speed..) */
-							if (o_ptr->name2) {
-								artifact_type *a_ptr = ego_make(o_ptr);
+							if (o_ptr->name2 || o_ptr->name1 == ART_RANDART) {
+								u32b g1, g5;
 
-								f1 &= ~(k_ptr->flags1 & TR1_PVAL_MASK & ~a_ptr->flags1);
-								f5 &= ~(k_ptr->flags5 & TR5_PVAL_MASK & ~a_ptr->flags5);
-							} else if (o_ptr->name1 == ART_RANDART) {
-								artifact_type *a_ptr = randart_make(o_ptr);
-
-								f1 &= ~(k_ptr->flags1 & TR1_PVAL_MASK & ~a_ptr->flags1);
-								f5 &= ~(k_ptr->flags5 & TR5_PVAL_MASK & ~a_ptr->flags5);
+								equip_pval_flags(p_ptr, i + INVEN_WIELD, !o_ptr->name2, &g1, &g5);
+								f1 &= ~(k_ptr->flags1 & TR1_PVAL_MASK & ~g1);
+								f5 &= ~(k_ptr->flags5 & TR5_PVAL_MASK & ~g5);
 							}
 
 							if (f1 & TR1_SPEED) csheet_boni[i].spd += pval;
@@ -9502,6 +9766,7 @@ static void process_global_event(int ge_id) {
 					default: c_ptr->feat = FEAT_GRASS; break;
 					}
 			}
+			bump_feat_epoch(&wpos);
 			if (ge->extra[4]) {
 				/* Generate the level from fixed arena layout */
 				s_printf("EVENT_LAYOUT: Generating arena %d at %d,%d,%d\n", ge->extra[4], wpos.wx, wpos.wy, wpos.wz);
@@ -10173,6 +10438,8 @@ static void process_global_event(int ge_id) {
 				zcave[y + 2 * ddy[door_pos[k]]][x + 2 * ddx[door_pos[k]]].feat = FEAT_DOOR_HEAD;
 			}
 
+			bump_feat_epoch(&wpos);
+
 #if 1
 			/* maybe - randomly add void gate pairs */
 			k = 0;
@@ -10339,6 +10606,7 @@ static void process_global_event(int ge_id) {
 						zcave[y][x].feat = FEAT_DEEP_LAVA;
 						everyone_lite_spot(&wpos, y, x);
 					}
+				bump_feat_epoch(&wpos);
 				break;
 			}
 			/* if it's not that late yet, just fill some lava.. */
@@ -10359,6 +10627,7 @@ static void process_global_event(int ge_id) {
 				zcave[y][x].feat = FEAT_DEEP_LAVA;
 				everyone_lite_spot(&wpos, y, x);
 			}
+			bump_feat_epoch(&wpos);
 			break;
 		case 255: /* clean-up */
 			s_printf("(Clean-up event, state0 %d)\n", ge->state[0]);
@@ -9338,6 +9338,7 @@ static void erase_player(int Ind, int death_type, bool static_floor) {
 			time_t now = time(&now);
 
 			l_ptr->lastused = now;
+			floor_lru_update(&p_ptr->wpos, TRUE);
 		}
 	}
 
@@ -12332,9 +12333,9 @@ bool mon_take_hit(int Ind, int m_idx, int dam, bool *fear, cptr note) {
 				m_ptr->extra = 2;
 				m_ptr->extra2 = 0;
 
-				for (i = 0; i < MAX_EFFECTS; i++)
-					if (effects[i].flags & EFF_METEOR)
-						erase_effects(i);
+				for (i = effects_active_num - 1; i >= 0; i--)
+					if (effects[effects_active[i]].flags & EFF_METEOR)
+						erase_effects(effects_active[i]);
 
 				s_printf("MIRROR2: %s (%d/%d) won.\n", p_ptr->name, p_ptr->max_plv, p_ptr->max_lev);
 				p_ptr->test_dam += m_ptr->hp; // don't count the final HP as we cannot die
@@ -15892,18 +15893,21 @@ bool master_level(int Ind, char * parms) {
 				new_level_down_y(&p_ptr->wpos, p_ptr->py);
 				new_level_down_x(&p_ptr->wpos, p_ptr->px);
 				if ((zcave = getcave(&p_ptr->wpos))) zcave[p_ptr->py][p_ptr->px].feat = FEAT_LESS;
+				bump_feat_epoch(&p_ptr->wpos);
 			} else {
 				s_printf("Added predefined dungeon %d.\n", i);
 				add_dungeon(&p_ptr->wpos, 0, 0, 0, 0, 0, FALSE, i, 0, 0, 0);
 				new_level_up_y(&p_ptr->wpos, p_ptr->py);
 				new_level_up_x(&p_ptr->wpos, p_ptr->px);
 				if ((zcave = getcave(&p_ptr->wpos))) zcave[p_ptr->py][p_ptr->px].feat = FEAT_MORE;
+				bump_feat_epoch(&p_ptr->wpos);
 			}
 		} else { /* Custom tower/dungeon */
 			if (parms[3] == 't' && !(wild_info[p_ptr->wpos.wy][p_ptr->wpos.wx].flags & WILD_F_UP)) {
 				s_printf("tower: flags %x,%x,%x\n", f1, f2, f3);
 				if ((zcave = getcave(&p_ptr->wpos))) {
 					zcave[p_ptr->py][p_ptr->px].feat = FEAT_LESS;
+					bump_feat_epoch(&p_ptr->wpos);
 					if (zcave[p_ptr->py][p_ptr->px].info & CAVE_JAIL) {
 						apply_jail_flags(&f1, &f2, &f3);
 						msg_print(Ind, "Applied jail flags.");
@@ -15918,6 +15922,7 @@ bool master_level(int Ind, char * parms) {
 				s_printf("dungeon: flags %x,%x,%x\n", f1, f2, f3);
 				if ((zcave = getcave(&p_ptr->wpos))) {
 					zcave[p_ptr->py][p_ptr->px].feat = FEAT_MORE;
+					bump_feat_epoch(&p_ptr->wpos);
 					if (zcave[p_ptr->py][p_ptr->px].info & CAVE_JAIL) {
 						apply_jail_flags(&f1, &f2, &f3);
 						msg_print(Ind, "Applied jail flags.");
@@ -15957,10 +15962,12 @@ bool master_level(int Ind, char * parms) {
 			case FEAT_MORE:
 				(void)rem_dungeon(&p_ptr->wpos, FALSE);
 				zcave[p_ptr->py][p_ptr->px].feat = FEAT_GRASS;
+				bump_feat_epoch(&p_ptr->wpos);
 				break;
 			case FEAT_LESS:
 				(void)rem_dungeon(&p_ptr->wpos, TRUE);
 				zcave[p_ptr->py][p_ptr->px].feat = FEAT_GRASS;
+				bump_feat_epoch(&p_ptr->wpos);
 				break;
 			default:
 				msg_print(Ind, "There is no dungeon here");
@@ -15985,7 +15992,11 @@ bool master_level(int Ind, char * parms) {
 		//wipe_t_list(&p_ptr->wpos);
 
 		/* dont do this where there are houses! */
+#ifdef HOUSE_INDEX
+		for (i = house_first_at(&p_ptr->wpos); i != -1; i = house_next_at(i)) {
+#else
 		for (i = 0; i < num_houses; i++) {
+#endif
 			if (inarea(&p_ptr->wpos, &houses[i].wpos))
 				houses[i].flags |= HF_DELETED;
 		}
@@ -16102,7 +16113,11 @@ bool guild_build(int Ind) {
 	player_type *p_ptr = Players[Ind];
 	int i;
 
+#ifdef HOUSE_INDEX
+	for (i = house_first_at(&p_ptr->wpos); i != -1; i = house_next_at(i)) {
+#else
 	for (i = 0; i < num_houses; i++) {
+#endif
 		if (inarea(&houses[i].wpos, &p_ptr->wpos)) {
 			if (fill_house(&houses[i], FILL_PLAYER, p_ptr)) {
 				if (access_door(Ind, houses[i].dna, FALSE) || admin_p(Ind)) {